@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <pybind11/stl_bind.h>
@@ -29,6 +30,7 @@
 #include <velox/type/Variant.h>
 #include <velox/vector/DictionaryVector.h>
 #include <velox/vector/FlatVector.h>
+#include <velox/vector/arrow/Bridge.h>
 #include "folly/json.h"
 
 #include "context.h"
@@ -104,6 +106,32 @@ static py::object getItemFromSimpleVector(
     SimpleVectorPtr<NativeType>& vector,
     vector_size_t idx);
 
+// Wraps the values buffer of a flat primitive vector in a read-only NumPy
+// array without copying. The array holds a reference to the vector, so the
+// buffer stays live for as long as the array does.
+template <typename NativeType>
+static py::object flatVectorToNumpy(FlatVectorPtr<NativeType>& vector) {
+  if (vector->mayHaveNulls() &&
+      BaseVector::countNulls(vector->nulls(), vector->size()) > 0) {
+    throw py::value_error(
+        "Cannot export a vector with nulls to NumPy without copying");
+  }
+  auto* holder = new FlatVectorPtr<NativeType>(vector);
+  py::capsule base(holder, [](void* ptr) {
+    delete static_cast<FlatVectorPtr<NativeType>*>(ptr);
+  });
+  py::array result(
+      py::dtype::of<NativeType>(),
+      {static_cast<py::ssize_t>(vector->size())},
+      {static_cast<py::ssize_t>(sizeof(NativeType))},
+      vector->rawValues(),
+      base);
+  // The data is shared with the vector, don't let Python mutate it.
+  py::detail::array_proxy(result.ptr())->flags &=
+      ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_;
+  return result;
+}
+
 template <typename NativeType>
 inline void setItemInFlatVector(
     FlatVectorPtr<NativeType>& vector,
@@ -293,18 +321,27 @@ static void registerTypedVectors(
             return v->slice(start, length);
           });
 
-  py::class_<
+  auto flatVectorClass = py::class_<
       FlatVector<NativeType>,
       FlatVectorPtr<NativeType>,
       SimpleVector<NativeType>>(
       m,
       ("FlatVector_" + typeName).c_str(),
-      py::module_local(asModuleLocalDefinitions))
-      .def(
-          "__setitem__",
-          [](FlatVectorPtr<NativeType> v, vector_size_t idx, py::handle& obj) {
-            setItemInFlatVector(v, idx, obj);
-          });
+      py::module_local(asModuleLocalDefinitions));
+  flatVectorClass.def(
+      "__setitem__",
+      [](FlatVectorPtr<NativeType> v, vector_size_t idx, py::handle& obj) {
+        setItemInFlatVector(v, idx, obj);
+      });
+  // Booleans are bit packed and strings are StringViews, neither of which
+  // maps onto a NumPy buffer without a copy.
+  if constexpr (
+      std::is_arithmetic_v<NativeType> && !std::is_same_v<NativeType, bool>) {
+    flatVectorClass.def(
+        "to_numpy",
+        [](FlatVectorPtr<NativeType> v) { return flatVectorToNumpy(v); },
+        "Returns a read-only NumPy array sharing the values buffer of the vector. Throws if the vector has nulls");
+  }
 
   py::class_<
       ConstantVector<NativeType>,
@@ -451,6 +488,26 @@ static void addVectorBindings(
             std::move(baseVector),
             PyVeloxContext::getSingletonInstance().pool());
       });
+
+  m.def(
+      "export_to_arrow",
+      [](VectorPtr& vector, uintptr_t arrayAddress, uintptr_t schemaAddress) {
+        if (!arrayAddress || !schemaAddress) {
+          throw py::value_error(
+              "Must provide addresses of ArrowArray and ArrowSchema structs");
+        }
+        // Buffers are shared where the layouts match; the exported structs
+        // keep the vector alive until their release callbacks run.
+        exportToArrow(
+            vector,
+            *reinterpret_cast<ArrowArray*>(arrayAddress),
+            PyVeloxContext::getSingletonInstance().pool());
+        exportToArrow(vector, *reinterpret_cast<ArrowSchema*>(schemaAddress));
+      },
+      "Exports the vector through the Arrow C Data Interface into the ArrowArray and ArrowSchema structs at the given addresses",
+      py::arg("vector"),
+      py::arg("array_addr"),
+      py::arg("schema_addr"));
 }
 
 static void addExpressionBindings(
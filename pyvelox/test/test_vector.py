@@ -273,3 +273,57 @@ class TestVeloxVector(unittest.TestCase):
 
         with self.assertRaises(NotImplementedError):
             e = a[3:8:3]
+
+    def test_to_numpy(self):
+        try:
+            import numpy as np
+        except ImportError:
+            raise unittest.SkipTest("numpy is not installed")
+
+        ints = pv.from_list([1, 2, 3])
+        arr = ints.to_numpy()
+        self.assertEqual(arr.dtype, np.int64)
+        self.assertEqual(arr.tolist(), [1, 2, 3])
+
+        doubles = pv.from_list([1.5, -2.5])
+        self.assertEqual(doubles.to_numpy().tolist(), [1.5, -2.5])
+
+        # The array shares the vector's buffer, so it is read-only and
+        # reflects later writes through the vector.
+        self.assertFalse(arr.flags.writeable)
+        with self.assertRaises(ValueError):
+            arr[0] = 42
+        ints[1] = 20
+        self.assertEqual(arr.tolist(), [1, 20, 3])
+
+        # Nulls cannot be represented without copying.
+        with self.assertRaises(ValueError):
+            pv.from_list([1, None, 3]).to_numpy()
+
+        # Strings have no zero-copy NumPy representation.
+        self.assertFalse(hasattr(pv.from_list(["a", "b"]), "to_numpy"))
+
+    def test_export_to_arrow(self):
+        try:
+            import pyarrow as pa
+            from pyarrow.cffi import ffi
+        except ImportError:
+            raise unittest.SkipTest("pyarrow is not installed")
+
+        vector = pv.from_list([1, 2, None, 4])
+        c_array = ffi.new("struct ArrowArray*")
+        c_schema = ffi.new("struct ArrowSchema*")
+        pv.export_to_arrow(
+            vector,
+            int(ffi.cast("uintptr_t", c_array)),
+            int(ffi.cast("uintptr_t", c_schema)),
+        )
+        arrow_array = pa.Array._import_from_c(
+            int(ffi.cast("uintptr_t", c_array)),
+            int(ffi.cast("uintptr_t", c_schema)),
+        )
+        self.assertEqual(arrow_array.type, pa.int64())
+        self.assertEqual(arrow_array.to_pylist(), [1, 2, None, 4])
+
+        with self.assertRaises(ValueError):
+            pv.export_to_arrow(vector, 0, 0)
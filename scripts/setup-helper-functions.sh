@@ -47,6 +47,8 @@ function github_checkout {
 #   arm64  : Target Apple silicon.
 #   aarch64: Target general 64 bit arm cpus.
 #   avx:     Target Intel CPUs with AVX.
+#   avx512:  Target Intel CPUs with AVX-512 (e.g. Ice Lake). Must be
+#            requested explicitly via CPU_TARGET.
 #   sse:     Target Intel CPUs with sse.
 # Echo's the appropriate compiler flags which can be captured as so
 # CXX_FLAGS=$(get_cxx_flags) or
@@ -107,6 +109,15 @@ function get_cxx_flags {
       echo -n "-mavx2 -mfma -mavx -mf16c -mlzcnt -std=c++17 -mbmi2 $ADDITIONAL_FLAGS"
     ;;
 
+    "avx512")
+      # The hand-written xsimd kernels stay on the proven 256 bit AVX2
+      # implementations (the lane mask tables in SimdUtil cover at most
+      # 8 lanes), so the default xsimd architecture is pinned to AVX2.
+      # The wider registers and the extra AVX-512 instructions are left
+      # to the compiler.
+      echo -n "-mavx512f -mavx512bw -mavx512dq -mavx512vl -mavx2 -mfma -mavx -mf16c -mlzcnt -std=c++17 -mbmi2 -DXSIMD_DEFAULT_ARCH=xsimd::avx2 $ADDITIONAL_FLAGS"
+    ;;
+
     "sse")
       echo -n "-msse4.2 -std=c++17 $ADDITIONAL_FLAGS"
     ;;
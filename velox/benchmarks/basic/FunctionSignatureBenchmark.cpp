@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <fmt/format.h>
+#include <folly/String.h>
+#include <folly/init/Init.h>
+#include <gflags/gflags.h>
+
+#include <iostream>
+
+#include "velox/common/time/Timer.h"
+#include "velox/expression/SignatureBinder.h"
+#include "velox/functions/FunctionRegistry.h"
+#include "velox/functions/lib/benchmarks/FunctionBenchmarkBase.h"
+#include "velox/functions/prestosql/registration/RegistrationFunctions.h"
+#include "velox/vector/fuzzer/VectorFuzzer.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/// Benchmarks any scalar function registered in the FunctionRegistry over
+/// fuzzer-generated inputs in flat, dictionary and constant encodings.
+/// Reports time per row and, where the kernel allows perf_event_open,
+/// hardware counters (cycles, instructions, L1d load misses, branch misses)
+/// per row.
+///
+/// Usage:
+///   velox_benchmark_function_signature --function=abs
+///
+/// Run without --function to list all registered function names.
+
+DEFINE_string(function, "", "Name of the function to benchmark.");
+DEFINE_int32(batch_size, 10'000, "Number of rows per input batch.");
+DEFINE_int32(num_batches, 100, "Number of batches to evaluate.");
+DEFINE_double(null_ratio, 0, "Ratio of nulls in generated inputs.");
+DEFINE_int64(fuzzer_seed, 99887766, "Seed for random input dataset generator");
+
+using namespace facebook::velox;
+
+namespace {
+
+/// Totals of a hardware counter group over a measured region.
+struct PerfCounts {
+  uint64_t cycles{0};
+  uint64_t instructions{0};
+  uint64_t l1dMisses{0};
+  uint64_t branchMisses{0};
+};
+
+/// A group of perf_event hardware counters covering user-space execution of
+/// the calling thread. Degrades to a no-op when perf_event_open is
+/// unavailable or not permitted, e.g. in containers or on non-Linux hosts.
+class PerfEventGroup {
+ public:
+  PerfEventGroup() {
+#ifdef __linux__
+    leaderFd_ = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (leaderFd_ < 0) {
+      return;
+    }
+    instructionsFd_ = openCounter(
+        PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, leaderFd_);
+    l1dMissesFd_ = openCounter(
+        PERF_TYPE_HW_CACHE,
+        PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+            (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+        leaderFd_);
+    branchMissesFd_ = openCounter(
+        PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, leaderFd_);
+#endif
+  }
+
+  ~PerfEventGroup() {
+#ifdef __linux__
+    for (auto fd :
+         {leaderFd_, instructionsFd_, l1dMissesFd_, branchMissesFd_}) {
+      if (fd >= 0) {
+        ::close(fd);
+      }
+    }
+#endif
+  }
+
+  bool enabled() const {
+#ifdef __linux__
+    return leaderFd_ >= 0;
+#else
+    return false;
+#endif
+  }
+
+  void start() {
+#ifdef __linux__
+    if (enabled()) {
+      ::ioctl(leaderFd_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      ::ioctl(leaderFd_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+  }
+
+  PerfCounts stop() {
+    PerfCounts counts;
+#ifdef __linux__
+    if (enabled()) {
+      ::ioctl(leaderFd_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+      counts.cycles = readCounter(leaderFd_);
+      counts.instructions = readCounter(instructionsFd_);
+      counts.l1dMisses = readCounter(l1dMissesFd_);
+      counts.branchMisses = readCounter(branchMissesFd_);
+    }
+#endif
+    return counts;
+  }
+
+ private:
+#ifdef __linux__
+  static int openCounter(uint32_t type, uint64_t config, int groupFd) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = type;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = (groupFd < 0) ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return static_cast<int>(
+        ::syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+  }
+
+  static uint64_t readCounter(int fd) {
+    uint64_t value = 0;
+    if (fd < 0 || ::read(fd, &value, sizeof(value)) != sizeof(value)) {
+      return 0;
+    }
+    return value;
+  }
+
+  int leaderFd_{-1};
+  int instructionsFd_{-1};
+  int l1dMissesFd_{-1};
+  int branchMissesFd_{-1};
+#endif
+};
+
+enum class InputEncoding { kFlat, kDictionary, kConstant };
+
+std::string encodingName(InputEncoding encoding) {
+  switch (encoding) {
+    case InputEncoding::kFlat:
+      return "flat";
+    case InputEncoding::kDictionary:
+      return "dict";
+    case InputEncoding::kConstant:
+      return "const";
+  }
+  return "";
+}
+
+class FunctionSignatureBenchmark
+    : public functions::test::FunctionBenchmarkBase {
+ public:
+  FunctionSignatureBenchmark() : FunctionBenchmarkBase() {
+    functions::prestosql::registerAllScalarFunctions();
+  }
+
+  /// Benchmarks every fully concrete signature of 'functionName' across all
+  /// input encodings.
+  void run(const std::string& functionName) {
+    auto signatureMap = getFunctionSignatures();
+    auto it = signatureMap.find(functionName);
+    if (it == signatureMap.end()) {
+      std::cout << "Function not registered: " << functionName << std::endl;
+      return;
+    }
+
+    PerfEventGroup counters;
+    if (!counters.enabled()) {
+      std::cout << "perf_event_open not available; reporting time only."
+                << std::endl;
+    }
+
+    for (const auto* signature : it->second) {
+      auto argTypes = tryResolveArgTypes(*signature);
+      if (!argTypes.has_value()) {
+        std::cout << fmt::format(
+                         "Skipping non-concrete signature {}{}",
+                         functionName,
+                         signature->toString())
+                  << std::endl;
+        continue;
+      }
+      for (auto encoding :
+           {InputEncoding::kFlat,
+            InputEncoding::kDictionary,
+            InputEncoding::kConstant}) {
+        runOne(functionName, argTypes.value(), encoding, counters);
+      }
+    }
+  }
+
+ private:
+  // Returns the argument types of a signature if they are all concrete.
+  // Signatures with type variables, variadic arguments or lambdas cannot be
+  // materialized without extra context and are skipped.
+  std::optional<std::vector<TypePtr>> tryResolveArgTypes(
+      const exec::FunctionSignature& signature) {
+    if (!signature.variables().empty() || signature.variableArity()) {
+      return std::nullopt;
+    }
+    std::vector<TypePtr> argTypes;
+    for (const auto& argSignature : signature.argumentTypes()) {
+      auto type = exec::SignatureBinder::tryResolveType(argSignature, {}, {});
+      if (type == nullptr || type->containsUnknown()) {
+        return std::nullopt;
+      }
+      argTypes.push_back(type);
+    }
+    return argTypes;
+  }
+
+  RowVectorPtr makeData(
+      const std::vector<TypePtr>& argTypes,
+      InputEncoding encoding) {
+    VectorFuzzer::Options opts;
+    opts.vectorSize = FLAGS_batch_size;
+    opts.nullRatio = FLAGS_null_ratio;
+    VectorFuzzer fuzzer(opts, pool(), FLAGS_fuzzer_seed);
+
+    std::vector<VectorPtr> children;
+    for (const auto& type : argTypes) {
+      switch (encoding) {
+        case InputEncoding::kFlat:
+          children.push_back(fuzzer.fuzzFlat(type));
+          break;
+        case InputEncoding::kDictionary:
+          children.push_back(fuzzer.fuzzDictionary(
+              fuzzer.fuzzFlat(type, FLAGS_batch_size / 10 + 1),
+              FLAGS_batch_size));
+          break;
+        case InputEncoding::kConstant:
+          children.push_back(fuzzer.fuzzConstant(type));
+          break;
+      }
+    }
+    return maker().rowVector(children);
+  }
+
+  void runOne(
+      const std::string& functionName,
+      const std::vector<TypePtr>& argTypes,
+      InputEncoding encoding,
+      PerfEventGroup& counters) {
+    std::vector<std::string> inputs;
+    std::vector<std::string> typeNames;
+    for (auto i = 0; i < argTypes.size(); ++i) {
+      inputs.push_back(fmt::format("c{}", i));
+      typeNames.push_back(argTypes[i]->toString());
+    }
+    auto expression =
+        fmt::format("{}({})", functionName, folly::join(", ", inputs));
+    auto label = fmt::format(
+        "{}({}) {}",
+        functionName,
+        folly::join(", ", typeNames),
+        encodingName(encoding));
+
+    try {
+      auto data = makeData(argTypes, encoding);
+      auto exprSet = compileExpression(expression, asRowType(data->type()));
+      SelectivityVector rows(data->size());
+
+      // Warm up once outside the measured region to exclude one-time setup
+      // such as regex compilation or dictionary memoization buildup.
+      evaluate(exprSet, data, rows);
+
+      const uint64_t numRows =
+          static_cast<uint64_t>(FLAGS_batch_size) * FLAGS_num_batches;
+      counters.start();
+      auto startUs = getCurrentTimeMicro();
+      for (auto i = 0; i < FLAGS_num_batches; ++i) {
+        evaluate(exprSet, data, rows);
+      }
+      auto elapsedUs = getCurrentTimeMicro() - startUs;
+      auto counts = counters.stop();
+
+      std::cout << fmt::format(
+          "{:<60} {:>10.2f} ns/row", label, elapsedUs * 1000.0 / numRows);
+      if (counters.enabled()) {
+        std::cout << fmt::format(
+            " {:>8.1f} cyc/row {:>8.1f} ins/row {:>8.3f} L1dM/row"
+            " {:>8.3f} brM/row",
+            static_cast<double>(counts.cycles) / numRows,
+            static_cast<double>(counts.instructions) / numRows,
+            static_cast<double>(counts.l1dMisses) / numRows,
+            static_cast<double>(counts.branchMisses) / numRows);
+      }
+      std::cout << std::endl;
+    } catch (const std::exception& e) {
+      std::cout << fmt::format("{:<60} failed: {}", label, e.what())
+                << std::endl;
+    }
+  }
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  folly::init(&argc, &argv);
+
+  FunctionSignatureBenchmark benchmark;
+
+  if (FLAGS_function.empty()) {
+    std::cout << "Specify a function with --function. Registered functions:"
+              << std::endl;
+    for (const auto& [name, _] : getFunctionSignatures()) {
+      std::cout << "  " << name << std::endl;
+    }
+    return 0;
+  }
+
+  benchmark.run(FLAGS_function);
+  return 0;
+}
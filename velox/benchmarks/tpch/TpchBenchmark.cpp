@@ -19,7 +19,9 @@
 #include <sys/time.h>
 
 #include <folly/Benchmark.h>
+#include <folly/dynamic.h>
 #include <folly/init/Init.h>
+#include <folly/json.h>
 #include <gflags/gflags.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -164,6 +166,19 @@ DEFINE_bool(
     "Runs one warmup of the query before "
     "measured run. Use to run warm after clearing caches.");
 
+DEFINE_bool(
+    run_all_queries,
+    false,
+    "Run all supported TPC-H queries sequentially and print a per-query "
+    "summary instead of running folly benchmarks.");
+
+DEFINE_string(
+    report_path,
+    "",
+    "Write a machine-readable JSON report with per-query execution times "
+    "and per-operator stats. Diff reports from two builds to find "
+    "regressions. Applies to --run_all_queries.");
+
 DEFINE_validator(data_path, &notEmpty);
 DEFINE_validator(data_format, &validateDataFormat);
 
@@ -329,6 +344,84 @@ class TpchBenchmark {
     }
   }
 
+  // Flattens the per-operator stats of a finished task into JSON for the
+  // regression report.
+  folly::dynamic operatorStatsJson(const exec::TaskStats& stats) const {
+    folly::dynamic operators = folly::dynamic::array;
+    for (const auto& pipeline : stats.pipelineStats) {
+      for (const auto& op : pipeline.operatorStats) {
+        folly::dynamic entry = folly::dynamic::object;
+        entry["planNodeId"] = op.planNodeId;
+        entry["operatorType"] = op.operatorType;
+        entry["numDrivers"] = op.numDrivers;
+        entry["addInputWallNanos"] = op.addInputTiming.wallNanos;
+        entry["addInputCpuNanos"] = op.addInputTiming.cpuNanos;
+        entry["getOutputWallNanos"] = op.getOutputTiming.wallNanos;
+        entry["getOutputCpuNanos"] = op.getOutputTiming.cpuNanos;
+        entry["finishWallNanos"] = op.finishTiming.wallNanos;
+        entry["blockedWallNanos"] = op.blockedWallNanos;
+        entry["rawInputBytes"] = op.rawInputBytes;
+        entry["inputPositions"] = op.inputPositions;
+        entry["outputPositions"] = op.outputPositions;
+        entry["peakMemoryBytes"] = op.memoryStats.peakTotalMemoryReservation;
+        entry["spilledBytes"] = op.spilledBytes;
+        if (FLAGS_include_custom_stats) {
+          folly::dynamic customStats = folly::dynamic::object;
+          for (const auto& [name, metric] : op.runtimeStats) {
+            customStats[name] = metric.sum;
+          }
+          entry["customStats"] = std::move(customStats);
+        }
+        operators.push_back(std::move(entry));
+      }
+    }
+    return operators;
+  }
+
+  void runAllQueries() {
+    // Queries with plans implemented in TpchQueryBuilder.
+    static const std::vector<int> kQueries = {
+        1, 3, 5, 6, 7, 8, 9, 10, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22};
+
+    folly::dynamic report = folly::dynamic::object;
+    report["numDrivers"] = FLAGS_num_drivers;
+    report["numRepeats"] = FLAGS_num_repeats;
+    folly::dynamic queries = folly::dynamic::object;
+    for (auto queryId : kQueries) {
+      const auto queryPlan = queryBuilder->getQueryPlan(queryId);
+      uint64_t micros = 0;
+      std::pair<std::unique_ptr<TaskCursor>, std::vector<RowVectorPtr>>
+          result;
+      {
+        MicrosecondTimer timer(&micros);
+        result = run(queryPlan);
+      }
+      folly::dynamic entry = folly::dynamic::object;
+      if (!result.first) {
+        entry["failed"] = true;
+        std::cout << fmt::format("q{:<3} failed", queryId) << std::endl;
+      } else {
+        const auto stats = result.first->task()->taskStats();
+        entry["wallMicros"] = micros;
+        entry["executionMs"] =
+            stats.executionEndTimeMs - stats.executionStartTimeMs;
+        entry["numSplits"] = stats.numFinishedSplits;
+        entry["operators"] = operatorStatsJson(stats);
+        std::cout << fmt::format(
+                         "q{:<3} {}", queryId, succinctMicros(micros))
+                  << std::endl;
+      }
+      queries[fmt::format("q{}", queryId)] = std::move(entry);
+    }
+    report["queries"] = std::move(queries);
+
+    if (!FLAGS_report_path.empty()) {
+      std::ofstream file(FLAGS_report_path);
+      file << folly::toPrettyJson(report) << std::endl;
+      std::cout << "Wrote report to " << FLAGS_report_path << std::endl;
+    }
+  }
+
   void readCombinations() {
     std::ifstream file(FLAGS_test_flags_file);
     std::string line;
@@ -558,7 +651,9 @@ int tpchBenchmarkMain() {
   queryBuilder =
       std::make_shared<TpchQueryBuilder>(toFileFormat(FLAGS_data_format));
   queryBuilder->initialize(FLAGS_data_path);
-  if (FLAGS_test_flags_file.empty()) {
+  if (FLAGS_run_all_queries) {
+    benchmark.runAllQueries();
+  } else if (FLAGS_test_flags_file.empty()) {
     RunStats ignore;
     benchmark.runMain(std::cout, ignore);
   } else {
@@ -123,6 +123,29 @@ class AsyncSource {
     return std::move(item_);
   }
 
+  // Drops the reference to the make function without making the item and
+  // waits for a possible in-progress prepare() to finish. The item, if made,
+  // is discarded. Called when the item is no longer needed, e.g. the consumer
+  // is being destroyed before all items are used.
+  void close() {
+    ContinueFuture wait;
+    bool mustWait = false;
+    {
+      std::lock_guard<std::mutex> l(mutex_);
+      make_ = nullptr;
+      if (making_) {
+        VELOX_CHECK_NULL(promise_);
+        promise_ = std::make_unique<ContinuePromise>();
+        wait = promise_->getSemiFuture();
+        mustWait = true;
+      }
+    }
+    if (mustWait) {
+      auto& exec = folly::QueuedImmediateExecutor::instance();
+      std::move(wait).via(&exec).wait();
+    }
+  }
+
   // If true, move() will not block. But there is no guarantee that somebody
   // else will not get the item first.
   bool hasValue() const {
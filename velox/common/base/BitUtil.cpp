@@ -16,6 +16,7 @@
 
 #include "velox/common/base/BitUtil.h"
 #include "velox/common/base/Exceptions.h"
+#include "velox/common/base/SimdUtil.h"
 #include "velox/common/process/ProcessBase.h"
 
 namespace facebook::velox::bits {
@@ -90,6 +91,73 @@ void copyBitsBackward(
   }
 }
 
+namespace {
+// Combines bits of two ranges that may start at different bit offsets:
+// target bit i = op(target bit i, source bit i). Byte-aligned ranges
+// combine a SIMD batch at a time; others go a word at a time through
+// the same load/store helpers as copyBits().
+template <typename Op>
+void mergeMisalignedBits(
+    const uint64_t* source,
+    uint64_t sourceOffset,
+    uint64_t* target,
+    uint64_t targetOffset,
+    uint64_t numBits,
+    Op op) {
+  uint64_t i = 0;
+  if ((sourceOffset & 7) == 0 && (targetOffset & 7) == 0) {
+    const auto* sourceBytes =
+        reinterpret_cast<const uint8_t*>(source) + (sourceOffset >> 3);
+    auto* targetBytes =
+        reinterpret_cast<uint8_t*>(target) + (targetOffset >> 3);
+    constexpr uint64_t kBatchBits = 8 * xsimd::batch<uint8_t>::size;
+    for (; i + kBatchBits <= numBits; i += kBatchBits) {
+      auto merged = op(
+          xsimd::batch<uint8_t>::load_unaligned(targetBytes + (i >> 3)),
+          xsimd::batch<uint8_t>::load_unaligned(sourceBytes + (i >> 3)));
+      merged.store_unaligned(targetBytes + (i >> 3));
+    }
+  }
+  for (; i + 64 <= numBits; i += 64) {
+    auto merged = op(
+        detail::loadBits<uint64_t>(target, targetOffset + i, 64),
+        detail::loadBits<uint64_t>(source, sourceOffset + i, 64));
+    detail::storeBits<uint64_t>(target, targetOffset + i, merged, 64);
+  }
+  for (; i < numBits; i += 8) {
+    auto numTailBits = std::min<uint64_t>(numBits - i, 8);
+    auto merged = op(
+        detail::loadBits<uint8_t>(target, targetOffset + i, numTailBits),
+        detail::loadBits<uint8_t>(source, sourceOffset + i, numTailBits));
+    detail::storeBits<uint8_t>(target, targetOffset + i, merged, numTailBits);
+  }
+}
+} // namespace
+
+void andMisalignedBits(
+    const uint64_t* source,
+    uint64_t sourceOffset,
+    uint64_t* target,
+    uint64_t targetOffset,
+    uint64_t numBits) {
+  mergeMisalignedBits(
+      source, sourceOffset, target, targetOffset, numBits, [](auto t, auto s) {
+        return t & s;
+      });
+}
+
+void orMisalignedBits(
+    const uint64_t* source,
+    uint64_t sourceOffset,
+    uint64_t* target,
+    uint64_t targetOffset,
+    uint64_t numBits) {
+  mergeMisalignedBits(
+      source, sourceOffset, target, targetOffset, numBits, [](auto t, auto s) {
+        return t | s;
+      });
+}
+
 void toString(const void* bits, int offset, int size, char* out) {
   for (int i = 0; i < size; ++i) {
     out[i] = '0' + isBitSet(reinterpret_cast<const uint8_t*>(bits), offset + i);
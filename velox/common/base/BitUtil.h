@@ -866,6 +866,25 @@ inline void copyBits(
   }
 }
 
+// Bit-wise ANDs 'numBits' bits of 'source' starting at bit
+// 'sourceOffset' into 'target' starting at bit 'targetOffset'. The two
+// ranges may start at different bit offsets. A typical use is merging a
+// null flag buffer into another one that starts at a different row.
+void andMisalignedBits(
+    const uint64_t* source,
+    uint64_t sourceOffset,
+    uint64_t* target,
+    uint64_t targetOffset,
+    uint64_t numBits);
+
+// Same as andMisalignedBits, with bit-wise OR.
+void orMisalignedBits(
+    const uint64_t* source,
+    uint64_t sourceOffset,
+    uint64_t* target,
+    uint64_t targetOffset,
+    uint64_t numBits);
+
 // Copies the bits from the range starting at data + sourceOffset, to another
 // range starting at data + targetOffset, where sourceOffset < targetOffset, and
 // the ranges can overlap.  The bits are copied in reverse order (the last bit
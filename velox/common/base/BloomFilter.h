@@ -81,6 +81,19 @@ class BloomFilter {
     bits::orBits(bits_.data(), bitsdata, 0, 64 * size);
   }
 
+  // Returns the backing words of the filter. Empty if reset() has not been
+  // called.
+  const std::vector<uint64_t, Allocator>& bits() const {
+    return bits_;
+  }
+
+  // Replaces the backing words of 'this' with 'bits'. The size of 'bits' must
+  // be a power of two, as produced by bits() of another BloomFilter.
+  void setBits(std::vector<uint64_t, Allocator> bits) {
+    VELOX_CHECK(bits.empty() || bits::isPowerOfTwo(bits.size()));
+    bits_ = std::move(bits);
+  }
+
   uint32_t serializedSize() const {
     return 1 /* version */
         + 4 /* number of bits */
@@ -39,6 +39,16 @@ class SelectivityInfo {
     return timeToDropValue() < right.timeToDropValue();
   }
 
+  /// Halves the accumulated counts and time so that recent observations
+  /// weigh more when the info drives adaptive decisions. Called
+  /// periodically by users that adapt to changing data, e.g. conjunct
+  /// reordering.
+  void decay() {
+    numIn_ /= 2;
+    numOut_ /= 2;
+    timeClocks_ /= 2;
+  }
+
   uint64_t numIn() const {
     return numIn_;
   }
@@ -46,6 +46,17 @@ class Semaphore {
     }
   }
 
+  /// If count > 0, decrements count and returns true. Returns false without
+  /// blocking otherwise.
+  bool tryAcquire() {
+    std::lock_guard<std::mutex> l(mutex_);
+    if (count_ > 0) {
+      --count_;
+      return true;
+    }
+    return false;
+  }
+
   /// Increments count. Releases one blocking call to acquire, if any.
   void release() {
     std::lock_guard<std::mutex> l(mutex_);
@@ -299,7 +299,30 @@ auto allSetBitMask(const A& = {}) {
 namespace detail {
 template <typename T, typename A, size_t kSizeT = sizeof(T)>
 struct Filter;
+
+// Expands a mask with one bit per pair of adjacent lanes into a mask
+// with one bit per lane.  Covers up to 4 pairs.
+inline int32_t pairBitsToLaneBits(int32_t mask) {
+  static constexpr int32_t kLaneMasks[] = {
+      0x00,
+      0x03,
+      0x0c,
+      0x0f,
+      0x30,
+      0x33,
+      0x3c,
+      0x3f,
+      0xc0,
+      0xc3,
+      0xcc,
+      0xcf,
+      0xf0,
+      0xf3,
+      0xfc,
+      0xff};
+  return kLaneMasks[mask & 15];
 }
+} // namespace detail
 
 // Rearrange elements in data, move data[i] to front of the vector if
 // bitMask[i] is set.
@@ -317,6 +340,18 @@ filter(HalfBatch<T, A> data, BitMaskType bitMask, const A& arch = {}) {
   return detail::Filter<T, A>::apply(data, bitMask, arch);
 }
 
+// Rearranges 16 byte elements made of adjacent pairs of 64 bit lanes
+// in 'data' (e.g. StringViews), moving the ith pair to the front of
+// the vector if bitMask[i] is set.  There is one bit of 'bitMask' per
+// pair of lanes.
+template <typename T, typename BitMaskType, typename A = xsimd::default_arch>
+xsimd::batch<T, A>
+filterPairs(xsimd::batch<T, A> data, BitMaskType bitMask, const A& arch = {}) {
+  static_assert(sizeof(T) == 8, "A pair of lanes must make 16 bytes");
+  return detail::Filter<T, A>::apply(
+      data, detail::pairBitsToLaneBits(bitMask), arch);
+}
+
 namespace detail {
 template <typename To, typename From, typename A>
 struct GetHalf;
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/base/WorkStealingExecutor.h"
+
+#include <fmt/format.h>
+#include <folly/system/ThreadName.h>
+
+#include "velox/common/base/Exceptions.h"
+
+namespace facebook::velox {
+
+namespace {
+// The executor the current thread is a worker of and the index of its queue.
+// Used to route add() from a worker thread to the worker's own queue.
+thread_local WorkStealingExecutor* localExecutor;
+thread_local int32_t localQueueIndex;
+} // namespace
+
+WorkStealingExecutor::WorkStealingExecutor(
+    int32_t numThreads,
+    const std::string& namePrefix) {
+  VELOX_CHECK_GT(numThreads, 0);
+  queues_.reserve(numThreads);
+  for (auto i = 0; i < numThreads; ++i) {
+    queues_.push_back(std::make_unique<Queue>());
+  }
+  threads_.reserve(numThreads);
+  for (auto i = 0; i < numThreads; ++i) {
+    threads_.emplace_back([this, i, name = fmt::format("{}{}", namePrefix, i)] {
+      folly::setThreadName(name);
+      threadLoop(i);
+    });
+  }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+  join();
+}
+
+void WorkStealingExecutor::add(folly::Func func) {
+  VELOX_CHECK(!joining_, "add() on a joined WorkStealingExecutor");
+  auto index = localExecutor == this
+      ? localQueueIndex
+      : nextQueue_++ % queues_.size();
+  {
+    std::lock_guard<std::mutex> l(queues_[index]->mutex);
+    queues_[index]->tasks.push_back(std::move(func));
+  }
+  taskSem_.release();
+}
+
+void WorkStealingExecutor::join() {
+  if (joining_.exchange(true)) {
+    return;
+  }
+  // One poison token per worker. A worker exits when it acquires a token and
+  // finds all queues empty, so all tasks added before join() run first.
+  for (size_t i = 0; i < threads_.size(); ++i) {
+    taskSem_.release();
+  }
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+folly::Func WorkStealingExecutor::poll(Queue& queue) {
+  std::lock_guard<std::mutex> l(queue.mutex);
+  if (queue.tasks.empty()) {
+    return nullptr;
+  }
+  auto func = std::move(queue.tasks.front());
+  queue.tasks.pop_front();
+  return func;
+}
+
+void WorkStealingExecutor::threadLoop(int32_t index) {
+  localExecutor = this;
+  localQueueIndex = index;
+  for (;;) {
+    taskSem_.acquire();
+    auto func = poll(*queues_[index]);
+    if (!func) {
+      for (size_t i = 1; i < queues_.size() && !func; ++i) {
+        func = poll(*queues_[(index + i) % queues_.size()]);
+        if (func) {
+          ++numStolen_;
+        }
+      }
+    }
+    if (func) {
+      func();
+      continue;
+    }
+    // The acquired token was a poison token: joining and no queued work.
+    VELOX_DCHECK(joining_);
+    return;
+  }
+}
+
+} // namespace facebook::velox
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <folly/Executor.h>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "velox/common/base/Semaphore.h"
+
+namespace facebook::velox {
+
+/// A folly::Executor with one FIFO task queue per worker thread and work
+/// stealing. A task added from a worker thread of 'this' goes to that
+/// worker's local queue, tasks added from other threads are distributed over
+/// the queues round robin. A worker that runs out of local work takes the
+/// oldest task from another worker's queue, so runnable tasks are never
+/// delayed behind a long running task on one queue while other workers sit
+/// idle.
+///
+/// This is intended as the executor for query Drivers: a Driver that goes
+/// off thread and requeues itself (e.g. after producing a batch) reenqueues
+/// from its own worker thread and stays local to it, while idle workers
+/// steal drivers from overloaded ones. This keeps short lived drivers, e.g.
+/// exchange consumers, from waiting behind long running scan drivers.
+class WorkStealingExecutor : public folly::Executor {
+ public:
+  explicit WorkStealingExecutor(
+      int32_t numThreads,
+      const std::string& namePrefix = "velox.steal");
+
+  /// Joins the workers. Tasks left in the queues are run before the workers
+  /// exit.
+  ~WorkStealingExecutor() override;
+
+  void add(folly::Func func) override;
+
+  /// Stops accepting new tasks, runs the remaining queued tasks and joins
+  /// the worker threads. Idempotent.
+  void join();
+
+  int32_t numThreads() const {
+    return threads_.size();
+  }
+
+  /// Number of tasks taken from another worker's queue. For tests and
+  /// debugging.
+  uint64_t numStolen() const {
+    return numStolen_;
+  }
+
+ private:
+  // A FIFO task queue of one worker. Tasks are pushed at the back and taken
+  // from the front, both by the owning worker and by stealing workers.
+  struct Queue {
+    std::mutex mutex;
+    std::deque<folly::Func> tasks;
+  };
+
+  // Main loop of worker 'index'. Runs local tasks first and steals from the
+  // other workers' queues when the local queue is empty.
+  void threadLoop(int32_t index);
+
+  // Takes the oldest task of 'queue'. Returns nullptr if the queue is empty.
+  folly::Func poll(Queue& queue);
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> threads_;
+
+  // Counts the queued tasks, plus one poison token per worker after join()
+  // is called.
+  Semaphore taskSem_{0};
+
+  // Round robin position for distributing tasks added from non-worker
+  // threads.
+  std::atomic<uint32_t> nextQueue_{0};
+
+  std::atomic<bool> joining_{false};
+  std::atomic<uint64_t> numStolen_{0};
+};
+
+} // namespace facebook::velox
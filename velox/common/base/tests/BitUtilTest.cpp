@@ -616,6 +616,55 @@ TEST_F(BitUtilTest, copyBits) {
   testCopyBits(source, 3, 640 - 62);
 }
 
+TEST_F(BitUtilTest, mergeMisalignedBits) {
+  std::vector<uint64_t> source(10);
+  std::vector<uint64_t> origin(10);
+  for (auto i = 0; i < source.size(); ++i) {
+    source[i] = 0x1234567890abcdef >> i;
+    origin[i] = 0xfedcba9876543210 << i;
+  }
+  auto test = [&](int sourceOffset, int targetOffset, int numBits, bool isAnd) {
+    SCOPED_TRACE(fmt::format(
+        "sourceOffset={} targetOffset={} numBits={} isAnd={}",
+        sourceOffset,
+        targetOffset,
+        numBits,
+        isAnd));
+    auto target = origin;
+    if (isAnd) {
+      andMisalignedBits(
+          source.data(), sourceOffset, target.data(), targetOffset, numBits);
+    } else {
+      orMisalignedBits(
+          source.data(), sourceOffset, target.data(), targetOffset, numBits);
+    }
+    for (int i = 0; i < target.size() * 64 - targetOffset; ++i) {
+      bool expected = isBitSet(origin.data(), targetOffset + i);
+      if (i < numBits) {
+        bool sourceBit = isBitSet(source.data(), sourceOffset + i);
+        expected = isAnd ? (expected && sourceBit) : (expected || sourceBit);
+      }
+      ASSERT_EQ(isBitSet(target.data(), targetOffset + i), expected)
+          << "at bit " << i;
+    }
+    // Bits below 'targetOffset' are unchanged.
+    for (int i = 0; i < targetOffset; ++i) {
+      ASSERT_EQ(isBitSet(target.data(), i), isBitSet(origin.data(), i));
+    }
+  };
+  for (bool isAnd : {true, false}) {
+    // Byte-aligned ranges with SIMD batches and tails.
+    test(0, 0, 512, isAnd);
+    test(8, 16, 311, isAnd);
+    test(64, 8, 77, isAnd);
+    // Misaligned ranges across word boundaries.
+    test(3, 11, 301, isAnd);
+    test(63, 1, 129, isAnd);
+    test(5, 5, 7, isAnd);
+    test(13, 60, 407, isAnd);
+  }
+}
+
 TEST_F(BitUtilTest, copyBitsBackward) {
   std::vector<uint64_t> origin(10);
   for (auto i = 0; i < origin.size(); ++i) {
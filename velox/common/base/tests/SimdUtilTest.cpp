@@ -264,6 +264,27 @@ TEST_F(SimdUtilTest, filterDouble) {
   testFilter<double>({std::nan("nan"), 23456, 111, 32000});
 }
 
+TEST_F(SimdUtilTest, filterPairs) {
+  constexpr int kNumLanes = xsimd::batch<int64_t>::size;
+  constexpr int kNumPairs = kNumLanes / 2;
+  int64_t data[kNumLanes];
+  for (auto i = 0; i < kNumLanes; ++i) {
+    data[i] = i;
+  }
+  auto batch = xsimd::load_unaligned(data);
+  for (auto mask = 0; mask < (1 << kNumPairs); ++mask) {
+    auto result = simd::filterPairs(batch, mask);
+    int32_t j = 0;
+    for (auto i = 0; i < kNumPairs; ++i) {
+      if (mask & (1 << i)) {
+        EXPECT_EQ(result.get(2 * j), data[2 * i]);
+        EXPECT_EQ(result.get(2 * j + 1), data[2 * i + 1]);
+        ++j;
+      }
+    }
+  }
+}
+
 TEST_F(SimdUtilTest, misc) {
   // Widen to int64 from 4 uints
   uint32_t uints4[4] = {10000, 0, 0, 4000000000};
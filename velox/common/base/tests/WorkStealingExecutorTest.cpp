@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/base/WorkStealingExecutor.h"
+#include <gtest/gtest.h>
+#include <atomic>
+#include "velox/common/base/Exceptions.h"
+#include "velox/common/base/Semaphore.h"
+
+using namespace facebook::velox;
+
+TEST(WorkStealingExecutorTest, basic) {
+  constexpr int32_t kNumTasks = 10'000;
+  std::atomic<int32_t> numRun{0};
+  {
+    WorkStealingExecutor executor(8);
+    for (auto i = 0; i < kNumTasks; ++i) {
+      executor.add([&]() { ++numRun; });
+    }
+    executor.join();
+  }
+  EXPECT_EQ(kNumTasks, numRun);
+}
+
+TEST(WorkStealingExecutorTest, steal) {
+  // Blocks all workers but one, then adds tasks from the unblocked worker so
+  // they land on its local queue. The other workers, once unblocked, must
+  // steal them.
+  constexpr int32_t kNumThreads = 4;
+  constexpr int32_t kNumTasks = 100;
+  WorkStealingExecutor executor(kNumThreads);
+  Semaphore blocked{0};
+  Semaphore unblock{0};
+  Semaphore resume{0};
+  for (auto i = 0; i < kNumThreads - 1; ++i) {
+    executor.add([&]() {
+      blocked.release();
+      unblock.acquire();
+    });
+  }
+  for (auto i = 0; i < kNumThreads - 1; ++i) {
+    blocked.acquire();
+  }
+  std::atomic<int32_t> numRun{0};
+  Semaphore produced{0};
+  Semaphore started{0};
+  executor.add([&]() {
+    // Runs on the only unblocked worker. All adds go to its local queue.
+    for (auto i = 0; i < kNumTasks; ++i) {
+      executor.add([&]() {
+        ++numRun;
+        started.release();
+        resume.acquire();
+      });
+    }
+    produced.release();
+  });
+  produced.acquire();
+  // Unblock the parked workers. Their local queues are empty, so the tasks
+  // they pick up come from the producer's queue by stealing.
+  for (auto i = 0; i < kNumThreads - 1; ++i) {
+    unblock.release();
+  }
+  for (auto i = 0; i < kNumThreads; ++i) {
+    started.acquire();
+  }
+  EXPECT_GE(executor.numStolen(), kNumThreads - 1);
+  for (auto i = 0; i < kNumTasks; ++i) {
+    resume.release();
+  }
+  for (auto i = 0; i < kNumTasks - kNumThreads; ++i) {
+    started.acquire();
+  }
+  executor.join();
+  EXPECT_EQ(kNumTasks, numRun);
+}
+
+TEST(WorkStealingExecutorTest, joinRunsQueued) {
+  // join() runs the tasks queued before it instead of dropping them.
+  constexpr int32_t kNumTasks = 1'000;
+  std::atomic<int32_t> numRun{0};
+  WorkStealingExecutor executor(2);
+  for (auto i = 0; i < kNumTasks; ++i) {
+    executor.add([&]() { ++numRun; });
+  }
+  executor.join();
+  EXPECT_EQ(kNumTasks, numRun);
+  EXPECT_THROW(executor.add([]() {}), VeloxRuntimeError);
+}
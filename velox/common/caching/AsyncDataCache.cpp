@@ -40,7 +40,7 @@ void AsyncDataCacheEntry::setExclusiveToShared() {
   numPins_ = 1;
   std::unique_ptr<folly::SharedPromise<bool>> promise;
   {
-    std::lock_guard<std::mutex> l(shard_->mutex());
+    std::lock_guard<folly::SharedMutex> l(shard_->mutex());
     // Enter the shard's mutex to make sure a promise is not being added during
     // the move.
     promise = std::move(promise_);
@@ -154,11 +154,36 @@ CachePin CacheShard::findOrCreate(
     RawFileCacheKey key,
     uint64_t size,
     folly::SemiFuture<bool>* wait) {
-  AsyncDataCacheEntry* entryToInit = nullptr;
   {
-    std::lock_guard<std::mutex> l(mutex_);
+    // Optimistic pass: pin an already loaded entry under the shared
+    // lock. Eviction and map updates take the lock exclusively, so the
+    // entry stays valid and cannot turn exclusive while the shared lock
+    // is held. Pinning is an atomic increment and needs no exclusive
+    // access. Entries in transition (loading, prefetched, superseded)
+    // fall through to the exclusive path below.
+    folly::SharedMutex::ReadHolder l(mutex_);
     ++eventCounter_;
     auto it = entryMap_.find(key);
+    if (it != entryMap_.end()) {
+      auto found = it->second;
+      if (!found->isExclusive() && !found->isPrefetch_ &&
+          found->size() >= size) {
+        found->touch();
+        ++numHit_;
+        hitBytes_ += found->size();
+        ++numSharedLookup_;
+        ++found->numPins_;
+        CachePin pin;
+        pin.setEntry(found);
+        return pin;
+      }
+    }
+  }
+  AsyncDataCacheEntry* entryToInit = nullptr;
+  {
+    std::lock_guard<folly::SharedMutex> l(mutex_);
+    ++numExclusiveLookup_;
+    auto it = entryMap_.find(key);
     if (it != entryMap_.end()) {
       auto found = it->second;
       if (found->isExclusive()) {
@@ -216,7 +241,7 @@ CachePin CacheShard::findOrCreate(
 }
 
 bool CacheShard::exists(RawFileCacheKey key) const {
-  std::lock_guard<std::mutex> l(mutex_);
+  folly::SharedMutex::ReadHolder l(mutex_);
   auto it = entryMap_.find(key);
   if (it != entryMap_.end()) {
     it->second->touch();
@@ -225,6 +250,18 @@ bool CacheShard::exists(RawFileCacheKey key) const {
   return false;
 }
 
+uint64_t CacheShard::cachedBytes(uint64_t fileNum) const {
+  folly::SharedMutex::ReadHolder l(mutex_);
+  uint64_t bytes = 0;
+  for (const auto& entry : entries_) {
+    if (entry && entry->key_.fileNum.hasValue() &&
+        entry->key_.fileNum.id() == fileNum && !entry->isExclusive()) {
+      bytes += entry->size();
+    }
+  }
+  return bytes;
+}
+
 CachePin CacheShard::initEntry(
     RawFileCacheKey key,
     AsyncDataCacheEntry* entry) {
@@ -298,7 +335,7 @@ void CoalescedLoad::setEndState(LoadState endState) {
 
 std::unique_ptr<folly::SharedPromise<bool>> CacheShard::removeEntry(
     AsyncDataCacheEntry* entry) {
-  std::lock_guard<std::mutex> l(mutex_);
+  std::lock_guard<folly::SharedMutex> l(mutex_);
   removeEntryLocked(entry);
   // After the entry is removed from the hash table, a promise can no longer
   // be made. It is safe to move the promise and realize it.
@@ -338,7 +375,7 @@ void CacheShard::evict(uint64_t bytesToFree, bool evictAllUnpinned) {
   auto now = accessTime();
   std::vector<memory::Allocation> toFree;
   {
-    std::lock_guard<std::mutex> l(mutex_);
+    std::lock_guard<folly::SharedMutex> l(mutex_);
     int size = entries_.size();
     if (!size) {
       return;
@@ -441,7 +478,7 @@ void CacheShard::calibrateThreshold() {
 }
 
 void CacheShard::updateStats(CacheStats& stats) {
-  std::lock_guard<std::mutex> l(mutex_);
+  std::lock_guard<folly::SharedMutex> l(mutex_);
   for (auto& entry : entries_) {
     if (!entry || !entry->key_.fileNum.hasValue()) {
       ++stats.numEmptyEntries;
@@ -467,12 +504,14 @@ void CacheShard::updateStats(CacheStats& stats) {
   stats.numEvict += numEvict_;
   stats.numEvictChecks += numEvictChecks_;
   stats.numWaitExclusive += numWaitExclusive_;
+  stats.numSharedLookup += numSharedLookup_;
+  stats.numExclusiveLookup += numExclusiveLookup_;
   stats.sumEvictScore += sumEvictScore_;
   stats.allocClocks += allocClocks_;
 }
 
 void CacheShard::appendSsdSaveable(std::vector<CachePin>& pins) {
-  std::lock_guard<std::mutex> l(mutex_);
+  std::lock_guard<folly::SharedMutex> l(mutex_);
   // Do not add more than 70% of entries to a write batch.If SSD save
   // is slower than storage read, we must not have a situation where
   // SSD save pins everything and stops reading.
@@ -520,6 +559,17 @@ bool AsyncDataCache::exists(RawFileCacheKey key) const {
   return shards_[shard]->exists(key);
 }
 
+uint64_t AsyncDataCache::cachedBytes(uint64_t fileNum) const {
+  uint64_t bytes = 0;
+  for (auto& shard : shards_) {
+    bytes += shard->cachedBytes(fileNum);
+  }
+  if (ssdCache_) {
+    bytes += ssdCache_->cachedBytes(fileNum);
+  }
+  return bytes;
+}
+
 bool AsyncDataCache::makeSpace(
     MachinePageCount numPages,
     std::function<bool()> allocate) {
@@ -19,6 +19,7 @@
 #include <deque>
 
 #include <fmt/format.h>
+#include <folly/SharedMutex.h>
 #include <folly/chrono/Hardware.h>
 #include <folly/futures/SharedPromise.h>
 #include "velox/common/base/BitUtil.h"
@@ -54,8 +55,10 @@ inline AccessTime accessTime() {
 }
 
 struct AccessStats {
-  AccessTime lastUse{0};
-  int32_t numUses{0};
+  // Updated on hits taken under a shared lock, so the values are
+  // approximate.
+  tsan_atomic<AccessTime> lastUse{0};
+  tsan_atomic<int32_t> numUses{0};
 
   // Retention score. A higher number means less worth retaining. This
   // works well with a typical formula of time over use count going to
@@ -278,7 +281,10 @@ class AsyncDataCacheEntry {
   std::unique_ptr<folly::SharedPromise<bool>> promise_;
   int32_t size_{0};
 
-  // Setting this from 0 to 1 or to kExclusive requires owning shard_->mutex_.
+  // Setting this to kExclusive requires owning shard_->mutex_. Setting
+  // this from 0 to 1 requires holding shard_->mutex_ at least in shared
+  // mode: eviction takes the mutex exclusively, so a shared holder sees
+  // a stable entry.
   std::atomic<int32_t> numPins_{0};
 
   AccessStats accessStats_;
@@ -497,6 +503,13 @@ struct CacheStats {
   // Number of times a user waited for an entry to transit from exclusive to
   // shared mode.
   int64_t numWaitExclusive{};
+  // Number of lookups served under the shard's shared lock, i.e. hits on
+  // entries that were already loaded.
+  int64_t numSharedLookup{};
+  // Number of lookups that took the exclusive shard lock: misses, hits on
+  // entries being loaded and superseded entries. The ratio of this to
+  // 'numSharedLookup' indicates how often lookups serialize on the shard.
+  int64_t numExclusiveLookup{};
   // Cumulative clocks spent in allocating or freeing memory for backing cache
   // entries.
   uint64_t allocClocks{};
@@ -523,10 +536,14 @@ class CacheShard {
   // Returns true if there is an entry for 'key'. Updates access time.
   bool exists(RawFileCacheKey key) const;
 
+  // Returns the total size of readable entries of the file 'fileNum' in
+  // 'this'. See AsyncDataCache::cachedBytes().
+  uint64_t cachedBytes(uint64_t fileNum) const;
+
   AsyncDataCache* cache() {
     return cache_;
   }
-  std::mutex& mutex() {
+  folly::SharedMutex& mutex() {
     return mutex_;
   }
 
@@ -572,7 +589,9 @@ class CacheShard {
 
   void freeAllocations(std::vector<memory::Allocation>& allocations);
 
-  mutable std::mutex mutex_;
+  // Lookups of already loaded entries take 'mutex_' in shared mode;
+  // misses, entry state changes, eviction and stats take it exclusively.
+  mutable folly::SharedMutex mutex_;
   folly::F14FastMap<RawFileCacheKey, AsyncDataCacheEntry*> entryMap_;
   // Entries associated to a key.
   std::deque<std::unique_ptr<AsyncDataCacheEntry>> entries_;
@@ -584,14 +603,21 @@ class CacheShard {
   AsyncDataCache* const cache_;
   // Index in 'entries_' for the next eviction candidate.
   uint32_t clockHand_{};
-  // Number of gets  since last stats sampling.
-  uint32_t eventCounter_{};
+  // Number of gets  since last stats sampling. Updated under the shared
+  // lock, so approximate.
+  tsan_atomic<uint32_t> eventCounter_{};
   // Maximum retainable entry score(). Anything above this is evictable.
   int32_t evictionThreshold_{kNoThreshold};
-  // Cumulative count of cache hits.
-  uint64_t numHit_{};
-  // Sum of bytes in cache hits.
-  uint64_t hitBytes_{};
+  // Cumulative count of cache hits. Updated under the shared lock, so
+  // approximate.
+  tsan_atomic<uint64_t> numHit_{};
+  // Sum of bytes in cache hits. Updated under the shared lock, so
+  // approximate.
+  tsan_atomic<uint64_t> hitBytes_{};
+  // Cumulative count of lookups served under the shared lock.
+  tsan_atomic<uint64_t> numSharedLookup_{};
+  // Cumulative count of lookups that took the exclusive lock.
+  uint64_t numExclusiveLookup_{};
   // Cumulative count of hits on entries held in exclusive mode.
   uint64_t numWaitExclusive_{};
   // Cumulative count of new entry creation.
@@ -635,6 +661,13 @@ class AsyncDataCache : public memory::MemoryAllocator {
   // Returns true if there is an entry for 'key'. Updates access time.
   bool exists(RawFileCacheKey key) const;
 
+  /// Returns the number of bytes of the file 'fileNum' (see FileIds)
+  /// resident in this cache: readable bytes in RAM plus bytes on SSD if
+  /// an SSD cache is present. An external split scheduler can query this
+  /// to place splits of a file preferentially on workers that already
+  /// hold its data.
+  uint64_t cachedBytes(uint64_t fileNum) const;
+
   Kind kind() const override {
     return allocator_->kind();
   }
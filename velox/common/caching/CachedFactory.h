@@ -31,6 +31,7 @@
 #include <mutex>
 #include <utility>
 
+#include "folly/Executor.h"
 #include "folly/container/F14Set.h"
 #include "glog/logging.h"
 
@@ -64,6 +65,15 @@ class CachedFactory {
   // miss, or Value in the cache if cache hit.
   std::pair<bool, Value> generate(const Key& key);
 
+  // Schedules generation of the value for 'key' on 'executor' unless the
+  // value is already cached or being generated. Exceptions thrown by the
+  // generator are logged and swallowed; they surface again on the next
+  // generate() call for the key. Use this to warm the cache for keys that
+  // will be needed soon, e.g. files of queued splits, so that threads
+  // calling generate() later do not block on the generator. The caller must
+  // ensure 'this' outlives the scheduled work.
+  void prefetch(folly::Executor& executor, const Key& key);
+
   // Advanced function taking in a group of keys. Separates those keys into
   // one's present in the cache (returning CachedPtrs for them) and those not
   // in the cache. Does NOT call the Generator for any key.
@@ -169,6 +179,31 @@ std::pair<bool, Value> CachedFactory<Key, Value, Generator>::generate(
   }
 }
 
+template <typename Key, typename Value, typename Generator>
+void CachedFactory<Key, Value, Generator>::prefetch(
+    folly::Executor& executor,
+    const Key& key) {
+  {
+    std::lock_guard<std::mutex> cache_lock(cacheMu_);
+    if (cache_->get(key).has_value()) {
+      return;
+    }
+  }
+  {
+    std::lock_guard<std::mutex> pending_lock(pendingMu_);
+    if (pending_.contains(key)) {
+      return;
+    }
+  }
+  executor.add([this, key]() {
+    try {
+      generate(key);
+    } catch (const std::exception& e) {
+      LOG(WARNING) << "Prefetch of cached value failed: " << e.what();
+    }
+  });
+}
+
 template <typename Key, typename Value, typename Generator>
 void CachedFactory<Key, Value, Generator>::retrieveCached(
     const std::vector<Key>& keys,
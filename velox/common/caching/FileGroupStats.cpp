@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/caching/FileGroupStats.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace facebook::velox::cache {
+
+void FileGroupStats::recordReference(
+    uint64_t /*fileId*/,
+    uint64_t groupId,
+    TrackingId trackingId,
+    int32_t bytes) {
+  if (trackingId.empty()) {
+    return;
+  }
+  std::lock_guard<std::mutex> l(mutex_);
+  // loadQuantum of 0 counts one reference per call, see
+  // TrackingData::incrementReference.
+  columns_[FileGroupKey{groupId, trackingId}].data.incrementReference(bytes, 0);
+}
+
+void FileGroupStats::recordRead(
+    uint64_t /*fileId*/,
+    uint64_t groupId,
+    TrackingId trackingId,
+    int32_t bytes) {
+  if (trackingId.empty()) {
+    return;
+  }
+  std::lock_guard<std::mutex> l(mutex_);
+  auto& column = columns_[FileGroupKey{groupId, trackingId}];
+  column.data.incrementRead(bytes);
+  column.readBytesInWindow += bytes;
+}
+
+void FileGroupStats::recordFile(
+    uint64_t /*fileId*/,
+    uint64_t groupId,
+    int32_t numStripes) {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto& group = groups_[groupId];
+  ++group.numFiles;
+  group.numStripes += numStripes;
+}
+
+bool FileGroupStats::shouldSaveToSsd(uint64_t groupId, TrackingId trackingId)
+    const {
+  if (trackingId.empty()) {
+    // No tracking information, e.g. no ScanTracker for the query. Keep
+    // the pre-admission-control behavior.
+    return true;
+  }
+  std::lock_guard<std::mutex> l(mutex_);
+  if (!filterComputed_) {
+    return true;
+  }
+  auto it = columns_.find(FileGroupKey{groupId, trackingId});
+  if (it == columns_.end()) {
+    // First access since the last update. There is no evidence against
+    // re-reference yet, so admit.
+    return true;
+  }
+  return it->second.saveToSsd;
+}
+
+std::vector<FileGroupKey> FileGroupStats::rankColumnsLocked(int32_t decayPct) {
+  std::vector<FileGroupKey> ranked;
+  ranked.reserve(columns_.size());
+  auto it = columns_.begin();
+  while (it != columns_.end()) {
+    auto& column = it->second;
+    if (decayPct) {
+      auto& data = column.data;
+      data.referencedBytes = (data.referencedBytes * (100 - decayPct)) / 100;
+      data.readBytes = (data.readBytes * (100 - decayPct)) / 100;
+      data.numReferences = (data.numReferences * (100 - decayPct)) / 100;
+      data.numReads = (data.numReads * (100 - decayPct)) / 100;
+      column.numWindowsActive =
+          (column.numWindowsActive * (100 - decayPct)) / 100 +
+          (column.readBytesInWindow > 0 ? 1 : 0);
+      column.readBytesInWindow = 0;
+      if (!data.referencedBytes && !data.readBytes) {
+        // Decayed to nothing, forget the column.
+        it = columns_.erase(it);
+        continue;
+      }
+    }
+    ranked.push_back(it->first);
+    ++it;
+  }
+  // Best to cache first: columns read in the most intervals, largest
+  // read volume breaking ties.
+  std::sort(
+      ranked.begin(), ranked.end(), [&](const auto& left, const auto& right) {
+        const auto& leftColumn = columns_[left];
+        const auto& rightColumn = columns_[right];
+        if (leftColumn.numWindowsActive != rightColumn.numWindowsActive) {
+          return leftColumn.numWindowsActive > rightColumn.numWindowsActive;
+        }
+        return leftColumn.data.readBytes > rightColumn.data.readBytes;
+      });
+  return ranked;
+}
+
+void FileGroupStats::updateSsdFilter(uint64_t ssdSize, int32_t decayPct) {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto ranked = rankColumnsLocked(decayPct);
+  // Admit the best columns until their estimated footprint fills the
+  // SSD. 'referencedBytes' is decayed, so it approximates the recent
+  // per-interval volume of the column rather than all time volume.
+  uint64_t bytes = 0;
+  for (const auto& key : ranked) {
+    auto& column = columns_[key];
+    column.saveToSsd = bytes < ssdSize;
+    bytes += column.data.referencedBytes;
+  }
+  filterComputed_ = true;
+}
+
+std::string FileGroupStats::toString(uint64_t cacheBytes) {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto ranked = rankColumnsLocked(0);
+  uint64_t totalReferenced = 0;
+  uint64_t totalRead = 0;
+  uint64_t cachedRead = 0;
+  uint64_t bytes = 0;
+  for (const auto& key : ranked) {
+    const auto& data = columns_[key].data;
+    totalReferenced += data.referencedBytes;
+    totalRead += data.readBytes;
+    if (bytes < cacheBytes) {
+      cachedRead += data.readBytes;
+    }
+    bytes += data.referencedBytes;
+  }
+  std::stringstream out;
+  out << "Tracking " << columns_.size() << " columns in " << groups_.size()
+      << " groups, " << (totalReferenced >> 20) << "MB referenced "
+      << (totalRead >> 20) << "MB read, "
+      << (totalRead ? (100 * cachedRead) / totalRead : 100)
+      << "% of reads in best columns fitting " << (cacheBytes >> 30) << "GB";
+  return out.str();
+}
+
+} // namespace facebook::velox::cache
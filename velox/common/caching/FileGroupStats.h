@@ -20,44 +20,109 @@
 
 namespace facebook::velox::cache {
 
-// Dummy implementation of SsdCache admission stats.
+// Identifies a tracked column within a file group, e.g. a partition.
+struct FileGroupKey {
+  uint64_t groupId;
+  TrackingId trackingId;
+
+  bool operator==(const FileGroupKey& other) const {
+    return groupId == other.groupId && trackingId == other.trackingId;
+  }
+
+  size_t hash() const {
+    return bits::hashMix(groupId, trackingId.hash());
+  }
+};
+
+} // namespace facebook::velox::cache
+
+namespace std {
+template <>
+struct hash<::facebook::velox::cache::FileGroupKey> {
+  size_t operator()(const ::facebook::velox::cache::FileGroupKey& key) const {
+    return key.hash();
+  }
+};
+} // namespace std
+
+namespace facebook::velox::cache {
+
+// Aggregates column access volumes from ScanTrackers at file group
+// level and selects the columns that qualify for saving to SSD. A
+// column qualifies if it is among the best columns by expected
+// re-reference that together fit in the SSD cache size. Re-reference
+// is estimated from how many updateSsdFilter() intervals the column
+// was read in: a column read in many intervals is part of a recurring
+// working set while a one time scan, e.g. a backfill, is read in one
+// interval only and stops qualifying at the next update. Everything
+// qualifies until updateSsdFilter() has run for the first time.
 class FileGroupStats {
  public:
-  // Records ScanTracker::recordReference at group level
+  // Records ScanTracker::recordReference at group level.
   void recordReference(
-      uint64_t /*fileId*/,
-      uint64_t /*groupId*/,
-      TrackingId /*trackingId*/,
-      int32_t /*bytes*/) {}
+      uint64_t fileId,
+      uint64_t groupId,
+      TrackingId trackingId,
+      int32_t bytes);
 
-  // Records ScanTracker::recordRead at group level
+  // Records ScanTracker::recordRead at group level.
   void recordRead(
-      uint64_t /*fileId*/,
-      uint64_t /*groupId*/,
-      TrackingId /*trackingId*/,
-      int32_t /*bytes*/) {}
+      uint64_t fileId,
+      uint64_t groupId,
+      TrackingId trackingId,
+      int32_t bytes);
 
-  // Records the existence of a distinct file inside 'groupId'
-  void recordFile(
-      uint64_t /*fileId*/,
-      uint64_t /*groupId*/,
-      int32_t /*numStripes*/) {}
+  // Records the existence of a distinct file inside 'groupId'.
+  void recordFile(uint64_t fileId, uint64_t groupId, int32_t numStripes);
 
   // Returns true if groupId, trackingId qualify the data to be cached to SSD.
-  bool shouldSaveToSsd(uint64_t /*groupId*/, TrackingId /*trackingId*/) const {
-    return true;
-  }
+  bool shouldSaveToSsd(uint64_t groupId, TrackingId trackingId) const;
 
-  // Updates the SSD selection criteria. 'ssdsize' is the capacity,
+  // Updates the SSD selection criteria. 'ssdSize' is the capacity,
   // 'decayPct' gives by how much old accesses are discounted.
-  void updateSsdFilter(uint64_t /*ssdSize*/, int32_t /*decayPct*/ = 0) {}
+  void updateSsdFilter(uint64_t ssdSize, int32_t decayPct = kDecayPct);
 
   // Recalculates the best groups and makes a human readable
   // summary. 'cacheBytes' is used to compute what fraction of the tracked
   // working set can be cached in 'cacheBytes'.
-  std::string toString(uint64_t /*cacheBytes*/) {
-    return "<dummy FileGroupStats>";
-  }
+  std::string toString(uint64_t cacheBytes);
+
+ private:
+  // Default percentage by which accumulated counts are discounted at
+  // each updateSsdFilter() so that the selection tracks recent
+  // traffic.
+  static constexpr int32_t kDecayPct = 50;
+
+  struct ColumnData {
+    TrackingData data;
+
+    // Bytes read since the last updateSsdFilter().
+    int64_t readBytesInWindow{0};
+
+    // Decayed count of updateSsdFilter() intervals in which the column
+    // was read. Measures recurring access as opposed to volume.
+    float numWindowsActive{0};
+
+    // True if the column made the cut at the last updateSsdFilter().
+    bool saveToSsd{true};
+  };
+
+  struct GroupData {
+    int64_t numFiles{0};
+    int64_t numStripes{0};
+  };
+
+  // Returns the columns ordered best to cache first. Decays counters
+  // if 'decayPct' is non-0. Caller must hold 'mutex_'.
+  std::vector<FileGroupKey> rankColumnsLocked(int32_t decayPct);
+
+  mutable std::mutex mutex_;
+  folly::F14FastMap<FileGroupKey, ColumnData> columns_;
+  folly::F14FastMap<uint64_t, GroupData> groups_;
+
+  // False until the first updateSsdFilter(). Everything qualifies for
+  // SSD before that.
+  bool filterComputed_{false};
 };
 
 } // namespace facebook::velox::cache
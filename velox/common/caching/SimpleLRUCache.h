@@ -15,10 +15,12 @@
  */
 #pragma once
 
+#include <chrono>
 #include <cstdint>
 #include <functional>
 #include <list>
 #include <optional>
+#include <vector>
 
 #include "folly/container/EvictingCacheMap.h"
 #include "glog/logging.h"
@@ -30,11 +32,13 @@ struct SimpleLRUCacheStats {
       size_t _maxSize,
       size_t _curSize,
       size_t _numHits,
-      size_t _numLookups)
+      size_t _numLookups,
+      size_t _numExpired = 0)
       : maxSize{_maxSize},
         curSize{_curSize},
         numHits{_numHits},
         numLookups{_numLookups},
+        numExpired{_numExpired},
         numElements{curSize},
         pinnedSize{curSize} {}
 
@@ -50,6 +54,9 @@ struct SimpleLRUCacheStats {
   // Total number of cache lookups since server start.
   const size_t numLookups;
 
+  // Total number of entries evicted because their time-to-live elapsed.
+  const size_t numExpired;
+
   // TODO: These 2 are unused, but open source Presto depends on them
   // Remove the usage in open source presto and get rid of them.
   const size_t numElements;
@@ -62,16 +69,23 @@ struct SimpleLRUCacheStats {
         "  curSize: {}\n"
         "  numHits: {}\n"
         "  numLookups: {}\n"
+        "  numExpired: {}\n"
         "}}\n",
         maxSize,
         curSize,
         numHits,
-        numLookups);
+        numLookups,
+        numExpired);
   }
 
   bool operator==(const SimpleLRUCacheStats& rhs) const {
-    return std::tie(curSize, maxSize, numHits, numLookups) ==
-        std::tie(rhs.curSize, rhs.maxSize, rhs.numHits, rhs.numLookups);
+    return std::tie(curSize, maxSize, numHits, numLookups, numExpired) ==
+        std::tie(
+               rhs.curSize,
+               rhs.maxSize,
+               rhs.numHits,
+               rhs.numLookups,
+               rhs.numExpired);
   }
 };
 
@@ -88,8 +102,13 @@ class SimpleLRUCache {
  public:
   /// Constructs a cache of the specified size. The maxSize represents the
   /// number of entries in the cache. clearSize represents the number of entries
-  /// to evict in a given time, when the cache is full.
-  explicit SimpleLRUCache(size_t maxSize, size_t clearSize = 1);
+  /// to evict in a given time, when the cache is full. expireDuration is the
+  /// time-to-live of an entry; expired entries are evicted on lookup and
+  /// periodically on insertion. Zero, the default, means entries never expire.
+  explicit SimpleLRUCache(
+      size_t maxSize,
+      size_t clearSize = 1,
+      std::chrono::milliseconds expireDuration = {});
 
   /// Add an item to the cache. Returns true if the item is successfully
   /// added, false otherwise.
@@ -118,14 +137,37 @@ class SimpleLRUCache {
         lru_.size(),
         numHits_,
         numLookups_,
+        numExpired_,
     };
   }
 
  private:
+  // An entry and the point in time after which it may no longer be returned.
+  struct TimedValue {
+    Value value;
+    std::chrono::steady_clock::time_point expireTime;
+  };
+
+  // Number of insertions between sweeps of expired entries. Lookups evict
+  // expired entries of the keys they touch; the sweep bounds how long cold
+  // expired entries can linger.
+  static constexpr size_t kSweepInterval = 256;
+
+  bool expired(const TimedValue& entry) const {
+    return expireDuration_.count() != 0 &&
+        std::chrono::steady_clock::now() >= entry.expireTime;
+  }
+
+  // Removes all expired entries.
+  void sweepExpired();
+
+  const std::chrono::milliseconds expireDuration_;
   size_t numHits_{0};
   size_t numLookups_{0};
+  size_t numExpired_{0};
+  size_t numAddsSinceSweep_{0};
 
-  folly::EvictingCacheMap<Key, Value> lru_;
+  folly::EvictingCacheMap<Key, TimedValue> lru_;
 };
 
 //
@@ -135,14 +177,24 @@ class SimpleLRUCache {
 template <typename Key, typename Value>
 inline SimpleLRUCache<Key, Value>::SimpleLRUCache(
     size_t maxSize,
-    size_t clearSize)
-    : lru_(maxSize, clearSize) {}
+    size_t clearSize,
+    std::chrono::milliseconds expireDuration)
+    : expireDuration_(expireDuration), lru_(maxSize, clearSize) {}
 
 template <typename Key, typename Value>
 inline bool SimpleLRUCache<Key, Value>::add(
     const Key& key,
     const Value& value) {
-  return lru_.insert(key, value).second;
+  if (expireDuration_.count() != 0 && ++numAddsSinceSweep_ >= kSweepInterval) {
+    numAddsSinceSweep_ = 0;
+    sweepExpired();
+  }
+  return lru_
+      .insert(
+          key,
+          TimedValue{
+              value, std::chrono::steady_clock::now() + expireDuration_})
+      .second;
 }
 
 template <typename Key, typename Value>
@@ -153,8 +205,29 @@ inline std::optional<Value> SimpleLRUCache<Key, Value>::get(const Key& key) {
     return std::nullopt;
   }
 
+  if (expired(it->second)) {
+    lru_.erase(key);
+    ++numExpired_;
+    return std::nullopt;
+  }
+
   ++numHits_;
-  return it->second;
+  return it->second.value;
+}
+
+template <typename Key, typename Value>
+inline void SimpleLRUCache<Key, Value>::sweepExpired() {
+  const auto now = std::chrono::steady_clock::now();
+  std::vector<Key> expiredKeys;
+  for (const auto& [key, entry] : lru_) {
+    if (now >= entry.expireTime) {
+      expiredKeys.push_back(key);
+    }
+  }
+  for (const auto& key : expiredKeys) {
+    lru_.erase(key);
+  }
+  numExpired_ += expiredKeys.size();
 }
 
 template <typename Key, typename Value>
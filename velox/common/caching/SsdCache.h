@@ -75,6 +75,13 @@ class SsdCache {
   // Returns  stats aggregated from all shards.
   SsdCacheStats stats() const;
 
+  // Returns the total size of the entries of 'fileNum' stored on
+  // SSD. All entries of a file are in the shard given by file().
+  // See AsyncDataCache::cachedBytes().
+  uint64_t cachedBytes(uint64_t fileNum) {
+    return file(fileNum).cachedBytes(fileNum);
+  }
+
   FileGroupStats& groupStats() const {
     return *groupStats_;
   }
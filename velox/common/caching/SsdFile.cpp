@@ -164,6 +164,21 @@ void SsdFile::unpinRegion(uint64_t offset) {
 }
 
 namespace {
+template <typename T>
+inline char* asChar(T ptr) {
+  return reinterpret_cast<char*>(ptr);
+}
+
+template <typename T>
+inline const char* asChar(const T* ptr) {
+  return reinterpret_cast<const char*>(ptr);
+}
+
+template <typename T>
+void appendNumber(std::string& log, T value) {
+  log.append(asChar(&value), sizeof(T));
+}
+
 void addEntryToIovecs(AsyncDataCacheEntry& entry, std::vector<iovec>& iovecs) {
   if (entry.tinyData()) {
     iovecs.push_back({entry.tinyData(), static_cast<size_t>(entry.size())});
@@ -214,6 +229,17 @@ bool SsdFile::erase(RawFileCacheKey key) {
   return true;
 }
 
+uint64_t SsdFile::cachedBytes(uint64_t fileNum) const {
+  std::lock_guard<std::mutex> l(mutex_);
+  uint64_t bytes = 0;
+  for (const auto& [key, run] : entries_) {
+    if (key.fileNum.id() == fileNum) {
+      bytes += run.size();
+    }
+  }
+  return bytes;
+}
+
 CoalesceIoStats SsdFile::load(
     const std::vector<SsdPin>& ssdPins,
     const std::vector<CachePin>& pins) {
@@ -401,6 +427,7 @@ void SsdFile::write(std::vector<CachePin>& pins) {
     }
     {
       std::lock_guard<std::mutex> l(mutex_);
+      std::string log;
       for (auto i = storeIndex; i < storeIndex + numWritten; ++i) {
         auto entry = pins[i].checkedEntry();
         entry->setSsdFile(this, offset);
@@ -408,6 +435,17 @@ void SsdFile::write(std::vector<CachePin>& pins) {
         FileCacheKey key = {
             entry->key().fileNum, static_cast<uint64_t>(entry->offset())};
         entries_[std::move(key)] = SsdRun(offset, size);
+        if (checkpointIntervalBytes_) {
+          // Log the add so that recovery covers entries written after
+          // the last checkpoint. The file name identifies the file
+          // since ids are not stable across restarts.
+          appendNumber(log, kLogAdd);
+          const auto name = fileIds().string(entry->key().fileNum.id());
+          appendNumber<int32_t>(log, name.size());
+          log += name;
+          appendNumber<uint64_t>(log, entry->offset());
+          appendNumber(log, SsdRun(offset, size).bits());
+        }
         if (FLAGS_ssd_verify_write) {
           verifyWrite(*entry, SsdRun(offset, size));
         }
@@ -416,6 +454,9 @@ void SsdFile::write(std::vector<CachePin>& pins) {
         stats_.bytesWritten += size;
         bytesAfterCheckpoint_ += size;
       }
+      if (!log.empty()) {
+        appendToLog(log, "Failed to log SSD cache write");
+      }
     }
     storeIndex += numWritten;
   }
@@ -513,12 +554,21 @@ void SsdFile::deleteFile() {
 }
 
 void SsdFile::logEviction(const std::vector<int32_t>& regions) {
-  if (checkpointIntervalBytes_) {
-    int32_t rc = ::write(
-        evictLogFd_, regions.data(), regions.size() * sizeof(regions[0]));
-    if (rc != regions.size() * sizeof(regions[0])) {
-      checkpointError(rc, "Failed to log eviction");
-    }
+  if (!checkpointIntervalBytes_) {
+    return;
+  }
+  std::string log;
+  for (auto region : regions) {
+    appendNumber(log, kLogEvict);
+    appendNumber(log, region);
+  }
+  appendToLog(log, "Failed to log eviction");
+}
+
+void SsdFile::appendToLog(const std::string& log, const char* message) {
+  int32_t rc = ::write(evictLogFd_, log.data(), log.size());
+  if (rc != log.size()) {
+    checkpointError(rc, message);
   }
 }
 
@@ -558,18 +608,6 @@ void SsdFile::checkpointError(int32_t rc, const std::string& error) {
   checkpointIntervalBytes_ = 0;
 }
 
-namespace {
-template <typename T>
-inline char* asChar(T ptr) {
-  return reinterpret_cast<char*>(ptr);
-}
-
-template <typename T>
-inline const char* asChar(const T* ptr) {
-  return reinterpret_cast<const char*>(ptr);
-}
-} // namespace
-
 void SsdFile::checkpoint(bool force) {
   std::lock_guard<std::mutex> l(mutex_);
   if (!force && bytesAfterCheckpoint_ < checkpointIntervalBytes_) {
@@ -754,14 +792,6 @@ void SsdFile::readCheckpoint(std::ifstream& state) {
     auto lease = StringIdLease(fileIds(), name);
     idMap[id] = std::move(lease);
   }
-  auto logSize = lseek(evictLogFd_, 0, SEEK_END);
-  std::vector<uint32_t> evicted(logSize / sizeof(uint32_t));
-  auto rc = ::pread(evictLogFd_, evicted.data(), logSize, 0);
-  VELOX_CHECK_EQ(logSize, rc, "Failed to read eviction log");
-  std::unordered_set<uint32_t> evictedMap;
-  for (auto region : evicted) {
-    evictedMap.insert(region);
-  }
   for (;;) {
     uint64_t fileNum = readNumber<uint64_t>(state);
     if (fileNum == kCheckpointEndMarker) {
@@ -769,23 +799,88 @@ void SsdFile::readCheckpoint(std::ifstream& state) {
     }
     uint64_t offset = readNumber<uint64_t>(state);
     auto run = SsdRun(readNumber<uint64_t>(state));
-    // Check that the recovered entry does not fall in an evicted region.
-    if (evictedMap.find(regionIndex(run.offset())) == evictedMap.end()) {
-      // The file may have a different id on restore.
-      auto it = idMap.find(fileNum);
-      VELOX_CHECK(it != idMap.end());
-      FileCacheKey key{it->second, offset};
+    // The file may have a different id on restore.
+    auto it = idMap.find(fileNum);
+    VELOX_CHECK(it != idMap.end());
+    FileCacheKey key{it->second, offset};
+    entries_[std::move(key)] = run;
+  }
+  // Replay the log of changes since the checkpoint in write order. An
+  // evicted region drops its entries and becomes writable; entries
+  // added after the checkpoint, including into regions evicted and
+  // refilled since, are restored. A truncated tail record means the
+  // process stopped mid-log-write, so replay stops there.
+  auto logSize = lseek(evictLogFd_, 0, SEEK_END);
+  std::string log;
+  log.resize(logSize);
+  auto rc = ::pread(evictLogFd_, log.data(), logSize, 0);
+  VELOX_CHECK_EQ(logSize, rc, "Failed to read eviction log");
+  size_t pos = 0;
+  auto readLog = [&](auto& value) {
+    if (pos + sizeof(value) > log.size()) {
+      return false;
+    }
+    memcpy(&value, log.data() + pos, sizeof(value));
+    pos += sizeof(value);
+    return true;
+  };
+  std::unordered_set<int32_t> writable;
+  for (;;) {
+    int32_t tag;
+    if (!readLog(tag)) {
+      break;
+    }
+    if (tag == kLogEvict) {
+      int32_t region;
+      if (!readLog(region)) {
+        break;
+      }
+      auto it = entries_.begin();
+      while (it != entries_.end()) {
+        if (regionIndex(it->second.offset()) == region) {
+          it = entries_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+      regionSize_[region] = 0;
+      writable.insert(region);
+    } else if (tag == kLogAdd) {
+      int32_t length;
+      if (!readLog(length)) {
+        break;
+      }
+      if (pos + length > log.size()) {
+        break;
+      }
+      std::string name(log.data() + pos, length);
+      pos += length;
+      uint64_t offset;
+      uint64_t bits;
+      if (!readLog(offset) || !readLog(bits)) {
+        break;
+      }
+      SsdRun run(bits);
+      auto region = regionIndex(run.offset());
+      FileCacheKey key{StringIdLease(fileIds(), name), offset};
       entries_[std::move(key)] = run;
+      // The region fills up again so that new entries after recovery do
+      // not overwrite the replayed ones.
+      regionSize_[region] = std::max<uint64_t>(
+          regionSize_[region],
+          run.offset() + run.size() - region * kRegionSize);
+      // The file may have grown past the checkpointed region count. Count
+      // the region as existing so that growing does not reset its fill
+      // offset and overwrite the replayed entries.
+      numRegions_ = std::max<int32_t>(numRegions_, region + 1);
+    } else {
+      VELOX_FAIL("Unexpected tag {} in SSD cache log", tag);
     }
   }
   // The state is successfully read. Install the access frequency scores and
-  // evicted regions.
+  // writable regions.
   VELOX_CHECK_EQ(scores.size(), tracker_.regionScores().size());
-  // Set the writable regions by deduplicated evicted regions.
-  writableRegions_.clear();
-  for (auto region : evictedMap) {
-    writableRegions_.push_back(region);
-  }
+  writableRegions_.assign(writable.begin(), writable.end());
   tracker_.setRegionScores(scores);
   LOG(INFO) << fmt::format(
       "Starting shard {} from checkpoint with {} entries, {} regions with {} free.",
@@ -198,6 +198,10 @@ class SsdFile {
   // Erases 'key'
   bool erase(RawFileCacheKey key);
 
+  // Returns the total size of the entries of the file 'fileNum' stored
+  // in 'this'. See AsyncDataCache::cachedBytes().
+  uint64_t cachedBytes(uint64_t fileNum) const;
+
   // Copies the data in 'ssdPins' into 'pins'. Coalesces IO for nearby
   // entries if they are in ascending order and near enough.
   CoalesceIoStats load(
@@ -256,14 +260,22 @@ class SsdFile {
 
  private:
   // 4 first bytes of a checkpoint file. Allows distinguishing between format
-  // versions.
-  static constexpr const char* FOLLY_NONNULL kCheckpointMagic = "CPT1";
+  // versions. Bumped to CPT2 when the eviction log became a log of both
+  // evictions and added entries.
+  static constexpr const char* FOLLY_NONNULL kCheckpointMagic = "CPT2";
   // Magic number separating file names from cache entry data in checkpoint
   // file.
   static constexpr int64_t kCheckpointMapMarker = 0xfffffffffffffffe;
   // Magic number at end of completed checkpoint file.
   static constexpr int64_t kCheckpointEndMarker = 0xcbedf11e;
 
+  // Tags for records in the log of changes since the last
+  // checkpoint. The log holds evictions and added entries in write
+  // order, so that recovery replays the history since the checkpoint
+  // instead of dropping it.
+  static constexpr int32_t kLogEvict = -1;
+  static constexpr int32_t kLogAdd = -2;
+
   // Increments the pin count of the region of 'offset'. Caller must hold
   // 'mutex_'.
   void pinRegionLocked(uint64_t offset) {
@@ -317,6 +329,10 @@ class SsdFile {
   // checkpoint.
   void logEviction(const std::vector<int32_t>& regions);
 
+  // Appends 'log' to the log of changes since the last
+  // checkpoint. Disables checkpointing on failure.
+  void appendToLog(const std::string& log, const char* FOLLY_NONNULL message);
+
   // Serializes access to all private data members.
   mutable std::mutex mutex_;
   // Name of cache file, used as prefix for checkpoint files.
@@ -382,7 +398,7 @@ class SsdFile {
   // Count of bytes written after last checkpoint.
   std::atomic<uint64_t> bytesAfterCheckpoint_{0};
 
-  // fd for logging evictions.
+  // fd for logging evictions and added entries between checkpoints.
   int32_t evictLogFd_{0};
 
   // True if there was an error with checkpoint and the checkpoint was deleted.
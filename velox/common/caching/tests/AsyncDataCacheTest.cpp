@@ -519,6 +519,17 @@ TEST_F(AsyncDataCacheTest, pin) {
   otherPin = pin;
   EXPECT_EQ(2, pin.entry()->numPins());
   EXPECT_FALSE(pin.entry()->isPrefetch());
+
+  // A new lookup of the loaded entry is served under the shared shard
+  // lock. The three lookups above (miss, wait for exclusive, first use
+  // of prefetched) all took the exclusive lock.
+  auto sharedPin = cache_->findOrCreate(key, kSize, &wait);
+  EXPECT_TRUE(sharedPin.checkedEntry()->isShared());
+  stats = cache_->refreshStats();
+  EXPECT_EQ(1, stats.numSharedLookup);
+  EXPECT_EQ(3, stats.numExclusiveLookup);
+  sharedPin.clear();
+
   auto largerPin = cache_->findOrCreate(key, kSize * 2, &wait);
   // We expect a new uninitialized entry with a larger size to displace the
   // previous one.
@@ -541,6 +552,30 @@ TEST_F(AsyncDataCacheTest, pin) {
   EXPECT_EQ(0, cache_->incrementPrefetchPages(0));
 }
 
+TEST_F(AsyncDataCacheTest, cachedBytes) {
+  constexpr int64_t kSize = 25000;
+  initializeCache(1 << 20);
+  StringIdLease file(fileIds(), std::string_view("cachedBytesFile"));
+  RawFileCacheKey key{file.id(), 0};
+  auto pin = cache_->findOrCreate(key, kSize, nullptr);
+  // An entry being loaded does not count as resident.
+  EXPECT_EQ(0, cache_->cachedBytes(file.id()));
+  initializeContents(key.fileNum + key.offset, pin.checkedEntry()->data());
+  pin.checkedEntry()->setExclusiveToShared();
+  EXPECT_EQ(kSize, cache_->cachedBytes(file.id()));
+  RawFileCacheKey key2{file.id(), 1 << 20};
+  auto pin2 = cache_->findOrCreate(key2, kSize, nullptr);
+  initializeContents(key2.fileNum + key2.offset, pin2.checkedEntry()->data());
+  pin2.checkedEntry()->setExclusiveToShared();
+  EXPECT_EQ(2 * kSize, cache_->cachedBytes(file.id()));
+  StringIdLease other(fileIds(), std::string_view("cachedBytesOther"));
+  EXPECT_EQ(0, cache_->cachedBytes(other.id()));
+  pin.clear();
+  pin2.clear();
+  cache_->clear();
+  EXPECT_EQ(0, cache_->cachedBytes(file.id()));
+}
+
 TEST_F(AsyncDataCacheTest, replace) {
   constexpr int64_t kMaxBytes = 64 << 20;
   FLAGS_velox_exception_user_stacktrace_enabled = false;
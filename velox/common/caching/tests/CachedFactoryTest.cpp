@@ -200,6 +200,30 @@ TEST(CachedFactoryTest, multiThreadedGenerationAgain) {
   }
 }
 
+TEST(CachedFactoryTest, prefetch) {
+  auto generator = std::make_unique<DoublerGenerator>();
+  auto* generated = &generator->generated_;
+  CachedFactory<int, int, DoublerGenerator> factory(
+      std::make_unique<SimpleLRUCache<int, int>>(1000), std::move(generator));
+  folly::EDFThreadPoolExecutor pool(
+      4, std::make_shared<folly::NamedThreadFactory>("test_pool"));
+  for (int i = 0; i < 10; ++i) {
+    factory.prefetch(pool, i);
+  }
+  // Prefetching the same keys again does not regenerate them.
+  for (int i = 0; i < 10; ++i) {
+    factory.prefetch(pool, i);
+  }
+  pool.join();
+  EXPECT_EQ(*generated, 10);
+  EXPECT_EQ(factory.currentSize(), 10);
+  for (int i = 0; i < 10; ++i) {
+    auto value = factory.generate(i);
+    EXPECT_EQ(value, cacheHit(2 * i));
+  }
+  EXPECT_EQ(*generated, 10);
+}
+
 TEST(CachedFactoryTest, retrievedCached) {
   auto generator = std::make_unique<DoublerGenerator>();
   auto* generated = &generator->generated_;
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/caching/FileGroupStats.h"
+
+#include <gtest/gtest.h>
+
+using namespace facebook::velox::cache;
+
+TEST(FileGroupStatsTest, admission) {
+  constexpr uint64_t kSsdSize = 64 << 20;
+  constexpr uint64_t kColumnBytes = 16 << 20;
+  constexpr uint64_t kFileId = 1;
+  constexpr uint64_t kHotGroup = 1;
+  constexpr uint64_t kBackfillGroup = 2;
+  const TrackingId id(11);
+  FileGroupStats stats;
+
+  // Everything is admitted before the first filter update.
+  EXPECT_TRUE(stats.shouldSaveToSsd(kHotGroup, id));
+
+  // A recurring working set: the same columns are read in every interval.
+  auto scanHotGroup = [&]() {
+    for (auto column = 0; column < 4; ++column) {
+      TrackingId trackingId(column);
+      stats.recordReference(kFileId, kHotGroup, trackingId, kColumnBytes);
+      stats.recordRead(kFileId, kHotGroup, trackingId, kColumnBytes);
+    }
+  };
+  for (auto window = 0; window < 4; ++window) {
+    scanHotGroup();
+    stats.updateSsdFilter(kSsdSize);
+  }
+  for (auto column = 0; column < 4; ++column) {
+    EXPECT_TRUE(stats.shouldSaveToSsd(kHotGroup, TrackingId(column)));
+  }
+
+  // A one time scan much larger than the SSD, e.g. a backfill. It is
+  // first seen mid-interval, so it is optimistically admitted.
+  for (auto column = 0; column < 32; ++column) {
+    TrackingId trackingId(100 + column);
+    stats.recordReference(kFileId, kBackfillGroup, trackingId, kColumnBytes);
+    stats.recordRead(kFileId, kBackfillGroup, trackingId, kColumnBytes);
+  }
+  scanHotGroup();
+  stats.updateSsdFilter(kSsdSize);
+
+  // The recurring columns stay admitted, the bulk of the one time scan
+  // does not displace them.
+  for (auto column = 0; column < 4; ++column) {
+    EXPECT_TRUE(stats.shouldSaveToSsd(kHotGroup, TrackingId(column)));
+  }
+  int32_t numAdmitted = 0;
+  for (auto column = 0; column < 32; ++column) {
+    numAdmitted +=
+        stats.shouldSaveToSsd(kBackfillGroup, TrackingId(100 + column));
+  }
+  EXPECT_LT(numAdmitted, 32);
+
+  // Untracked data keeps the pre-admission-control behavior.
+  EXPECT_TRUE(stats.shouldSaveToSsd(kBackfillGroup, TrackingId()));
+}
@@ -15,7 +15,9 @@
  */
 
 #include "velox/common/caching/SimpleLRUCache.h"
+#include <chrono>
 #include <optional>
+#include <thread>
 
 #include "gtest/gtest.h"
 
@@ -71,6 +73,22 @@ TEST(SimpleLRUCache, basicCaching) {
   EXPECT_FALSE(cache.get(2).has_value());
 }
 
+TEST(SimpleLRUCache, expiration) {
+  SimpleLRUCache<int, int> cache(
+      1000, 1, /*expireDuration=*/std::chrono::milliseconds(5));
+
+  ASSERT_TRUE(cache.add(1, 11));
+  ASSERT_EQ(cache.get(1), std::make_optional(11));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_FALSE(cache.get(1).has_value());
+  EXPECT_EQ(cache.getStats().numExpired, 1);
+
+  // A re-added entry is served again until it expires.
+  ASSERT_TRUE(cache.add(1, 22));
+  ASSERT_EQ(cache.get(1), std::make_optional(22));
+}
+
 TEST(SimpleLRUCache, eviction) {
   SimpleLRUCache<int, int> cache(1000);
 
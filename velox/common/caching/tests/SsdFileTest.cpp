@@ -22,6 +22,9 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <sys/stat.h>
+#include <unistd.h>
+
 using namespace facebook::velox;
 using namespace facebook::velox::cache;
 
@@ -50,6 +53,7 @@ class SsdFileTest : public testing::Test {
   void initializeCache(
       int64_t maxBytes,
       int64_t ssdBytes = 0,
+      uint64_t checkpointIntervalBytes = 0,
       bool setNoCowFlag = false) {
     // tmpfs does not support O_DIRECT, so turn this off for testing.
     FLAGS_ssd_odirect = false;
@@ -59,14 +63,34 @@ class SsdFileTest : public testing::Test {
     fileName_ = StringIdLease(fileIds(), "fileInStorage");
 
     tempDirectory_ = exec::test::TempDirectoryPath::create();
+    initializeSsdFile(ssdBytes, checkpointIntervalBytes, setNoCowFlag);
+  }
+
+  void initializeSsdFile(
+      int64_t ssdBytes,
+      uint64_t checkpointIntervalBytes,
+      bool setNoCowFlag = false) {
     ssdFile_ = std::make_unique<SsdFile>(
         fmt::format("{}/ssdtest", tempDirectory_->path),
         0, // shardId
         bits::roundUp(ssdBytes, SsdFile::kRegionSize) / SsdFile::kRegionSize,
-        0, // checkpointInternalBytes
+        checkpointIntervalBytes,
         setNoCowFlag);
   }
 
+  // Simulates a restart of the cache: drops the memory cache and the SsdFile
+  // without a final checkpoint and recovers the SSD state from the last
+  // checkpoint and the log of changes written since.
+  void restartCache(
+      int64_t maxBytes,
+      int64_t ssdBytes,
+      uint64_t checkpointIntervalBytes) {
+    cache_ = std::make_shared<AsyncDataCache>(
+        MemoryAllocator::createDefaultInstance(), maxBytes);
+    ssdFile_.reset();
+    initializeSsdFile(ssdBytes, checkpointIntervalBytes);
+  }
+
   static void initializeContents(int64_t sequence, memory::Allocation& alloc) {
     bool first = true;
     for (int32_t i = 0; i < alloc.numRuns(); ++i) {
@@ -222,6 +246,61 @@ class SsdFileTest : public testing::Test {
     readAndCheckPins(pins);
   }
 
+  // Writes 'numBatches' batches of entries, advancing 'startOffset' by one
+  // region worth of file offsets per batch. Appends the written entries to
+  // 'entries'.
+  void writeBatches(
+      int32_t numBatches,
+      uint64_t& startOffset,
+      std::vector<TestEntry>& entries) {
+    for (auto i = 0; i < numBatches; ++i) {
+      auto pins =
+          makePins(fileName_.id(), startOffset, 4096, 2048 * 1025, 62 * kMB);
+      ssdFile_->write(pins);
+      for (auto& pin : pins) {
+        EXPECT_EQ(ssdFile_.get(), pin.entry()->ssdFile());
+        entries.emplace_back(
+            pin.entry()->key(), pin.entry()->ssdOffset(), pin.entry()->size());
+      }
+      startOffset += SsdFile::kRegionSize;
+    }
+  }
+
+  // Returns the SSD runs of the entries of 'entries' that 'ssdFile_' serves,
+  // keyed by the entry's file offset.
+  std::unordered_map<uint64_t, SsdRun> findableRuns(
+      const std::vector<TestEntry>& entries) {
+    std::unordered_map<uint64_t, SsdRun> runs;
+    for (const auto& entry : entries) {
+      auto pin =
+          ssdFile_->find(RawFileCacheKey{fileName_.id(), entry.key.offset});
+      if (!pin.empty()) {
+        runs[entry.key.offset] = pin.run();
+      }
+    }
+    return runs;
+  }
+
+  // Loads the entry at 'offset' from 'ssdFile_' and checks that the data is
+  // the entry's own: the first word holds the sequence number the entry was
+  // initialized from, so reading another entry's bytes fails the check.
+  void verifyEntryData(uint64_t offset, int32_t size) {
+    std::vector<CachePin> pins;
+    pins.push_back(cache_->findOrCreate(
+        RawFileCacheKey{fileName_.id(), offset}, size, nullptr));
+    ASSERT_TRUE(pins.back().entry()->isExclusive());
+    std::vector<SsdPin> ssdPins;
+    ssdPins.push_back(
+        ssdFile_->find(RawFileCacheKey{fileName_.id(), offset}));
+    ASSERT_FALSE(ssdPins.back().empty());
+    ssdFile_->load(ssdPins, pins);
+    const auto& data = pins.back().entry()->data();
+    ASSERT_EQ(
+        static_cast<int64_t>(fileName_.id() + offset),
+        *reinterpret_cast<const int64_t*>(data.runAt(0).data()));
+    checkContents(data, pins.back().entry()->size());
+  }
+
   std::shared_ptr<exec::test::TempDirectoryPath> tempDirectory_;
 
   std::shared_ptr<AsyncDataCache> cache_;
@@ -297,16 +376,120 @@ TEST_F(SsdFileTest, writeAndRead) {
   }
 }
 
+TEST_F(SsdFileTest, recoverFromCheckpointedLog) {
+  constexpr int64_t kSsdSize = 16 * SsdFile::kRegionSize;
+  // Large interval so that checkpointing happens only when forced.
+  constexpr uint64_t kCheckpointIntervalBytes = 100 * SsdFile::kRegionSize;
+  initializeCache(128 * kMB, kSsdSize, kCheckpointIntervalBytes);
+  FLAGS_ssd_verify_write = false;
+
+  std::vector<TestEntry> allEntries;
+  uint64_t startOffset = 0;
+  // Fill half of the regions and checkpoint. The checkpoint truncates the
+  // log, so everything written from here on is recovered from the log alone.
+  writeBatches(8, startOffset, allEntries);
+  ssdFile_->checkpoint(true);
+
+  // Grow to the region cap and beyond it, so that regions present in the
+  // checkpoint are evicted and refilled. The log now holds the adds of the
+  // new entries and the evictions of the refilled regions in write order.
+  writeBatches(12, startOffset, allEntries);
+
+  auto runsBefore = findableRuns(allEntries);
+  // The evictions dropped some of the checkpointed entries.
+  EXPECT_LT(runsBefore.size(), allEntries.size());
+  EXPECT_GT(runsBefore.size(), 0);
+
+  restartCache(128 * kMB, kSsdSize, kCheckpointIntervalBytes);
+
+  // Entries served before the restart, including the ones added after the
+  // checkpoint, are served from the same runs. Entries of regions evicted
+  // after the checkpoint stay dropped.
+  for (const auto& entry : allEntries) {
+    auto pin =
+        ssdFile_->find(RawFileCacheKey{fileName_.id(), entry.key.offset});
+    auto it = runsBefore.find(entry.key.offset);
+    if (it == runsBefore.end()) {
+      EXPECT_TRUE(pin.empty());
+      continue;
+    }
+    ASSERT_FALSE(pin.empty());
+    EXPECT_EQ(it->second.offset(), pin.run().offset());
+    EXPECT_EQ(it->second.size(), pin.run().size());
+  }
+  for (const auto& [offset, run] : runsBefore) {
+    verifyEntryData(offset, run.size());
+  }
+
+  // New writes go into free space or evicted regions, not over the replayed
+  // entries: everything still served must hold its own data.
+  writeBatches(2, startOffset, allEntries);
+  auto runsAfter = findableRuns(allEntries);
+  // A fresh memory cache so that the reads below load from SSD.
+  cache_ = std::make_shared<AsyncDataCache>(
+      MemoryAllocator::createDefaultInstance(), 128 * kMB);
+  for (const auto& [offset, run] : runsBefore) {
+    if (runsAfter.count(offset) != 0) {
+      verifyEntryData(offset, run.size());
+    }
+  }
+}
+
+TEST_F(SsdFileTest, recoverFromTruncatedLog) {
+  constexpr int64_t kSsdSize = 16 * SsdFile::kRegionSize;
+  constexpr uint64_t kCheckpointIntervalBytes = 100 * SsdFile::kRegionSize;
+  initializeCache(128 * kMB, kSsdSize, kCheckpointIntervalBytes);
+  FLAGS_ssd_verify_write = false;
+
+  std::vector<TestEntry> allEntries;
+  uint64_t startOffset = 0;
+  writeBatches(8, startOffset, allEntries);
+  ssdFile_->checkpoint(true);
+  writeBatches(4, startOffset, allEntries);
+
+  auto runsBefore = findableRuns(allEntries);
+  EXPECT_EQ(runsBefore.size(), allEntries.size());
+
+  // Clip the log mid-record, as if the process died while logging the last
+  // add. Replay must stop at the last complete record, so only the clipped
+  // entry is lost.
+  const auto logPath = fmt::format("{}/ssdtest.log", tempDirectory_->path);
+  struct stat logStat;
+  ASSERT_EQ(0, ::stat(logPath.c_str(), &logStat));
+  ASSERT_EQ(0, ::truncate(logPath.c_str(), logStat.st_size - 5));
+
+  restartCache(128 * kMB, kSsdSize, kCheckpointIntervalBytes);
+
+  const auto clippedOffset = allEntries.back().key.offset;
+  for (const auto& entry : allEntries) {
+    auto pin =
+        ssdFile_->find(RawFileCacheKey{fileName_.id(), entry.key.offset});
+    if (entry.key.offset == clippedOffset) {
+      EXPECT_TRUE(pin.empty());
+      continue;
+    }
+    ASSERT_FALSE(pin.empty());
+    const auto& run = runsBefore.at(entry.key.offset);
+    EXPECT_EQ(run.offset(), pin.run().offset());
+    EXPECT_EQ(run.size(), pin.run().size());
+  }
+  for (const auto& entry : allEntries) {
+    if (entry.key.offset != clippedOffset) {
+      verifyEntryData(entry.key.offset, entry.size);
+    }
+  }
+}
+
 #ifdef VELOX_SSD_FILE_TEST_SET_NO_COW_FLAG
 TEST_F(SsdFileTest, disabledCow) {
   constexpr int64_t kSsdSize = 16 * SsdFile::kRegionSize;
-  initializeCache(128 * kMB, kSsdSize, true);
+  initializeCache(128 * kMB, kSsdSize, 0, true);
   EXPECT_TRUE(ssdFile_->testingIsCowDisabled());
 }
 
 TEST_F(SsdFileTest, notDisabledCow) {
   constexpr int64_t kSsdSize = 16 * SsdFile::kRegionSize;
-  initializeCache(128 * kMB, kSsdSize, false);
+  initializeCache(128 * kMB, kSsdSize, 0, false);
   EXPECT_FALSE(ssdFile_->testingIsCowDisabled());
 }
 #endif // VELOX_SSD_FILE_TEST_SET_NO_COW_FLAG
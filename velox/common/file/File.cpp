@@ -18,6 +18,7 @@
 
 #include <fmt/format.h>
 #include <glog/logging.h>
+#include <cstdlib>
 #include <memory>
 #include <stdexcept>
 
@@ -79,8 +80,31 @@ uint64_t InMemoryWriteFile::size() const {
   return file_->size();
 }
 
-LocalReadFile::LocalReadFile(std::string_view path) : path_(path) {
+namespace {
+// Alignment O_DIRECT requires of file offsets, read sizes and buffer
+// addresses. 4KB covers the logical block size of current devices.
+constexpr uint64_t kDirectIoAlignment = 4096;
+
+// Size of the thread-local bounce buffer direct IO reads go through.
+constexpr uint64_t kDirectIoBounceSize = 1 << 20;
+} // namespace
+
+LocalReadFile::LocalReadFile(std::string_view path, bool directIo)
+    : path_(path) {
+#ifdef O_DIRECT
+  directIo_ = directIo;
+  fd_ = open(path_.c_str(), directIo ? O_RDONLY | O_DIRECT : O_RDONLY);
+  if (fd_ < 0 && directIo && errno == EINVAL) {
+    // The file system does not support O_DIRECT, e.g. tmpfs. Fall back to
+    // buffered IO.
+    directIo_ = false;
+    fd_ = open(path_.c_str(), O_RDONLY);
+  }
+#else
+  // O_DIRECT is not available on this platform, e.g. macOS. Always use
+  // buffered IO.
   fd_ = open(path_.c_str(), O_RDONLY);
+#endif
   VELOX_CHECK_GE(
       fd_,
       0,
@@ -112,6 +136,10 @@ LocalReadFile::~LocalReadFile() {
 void LocalReadFile::preadInternal(uint64_t offset, uint64_t length, char* pos)
     const {
   bytesRead_ += length;
+  if (directIo_) {
+    directPread(offset, length, pos);
+    return;
+  }
   auto bytesRead = ::pread(fd_, pos, length, offset);
   VELOX_CHECK_EQ(
       bytesRead,
@@ -121,6 +149,39 @@ void LocalReadFile::preadInternal(uint64_t offset, uint64_t length, char* pos)
       length);
 }
 
+void LocalReadFile::directPread(uint64_t offset, uint64_t length, char* pos)
+    const {
+  static thread_local std::unique_ptr<char, decltype(&::free)> bounce{
+      static_cast<char*>(
+          ::aligned_alloc(kDirectIoAlignment, kDirectIoBounceSize)),
+      ::free};
+  while (length > 0) {
+    const uint64_t alignedOffset = offset & ~(kDirectIoAlignment - 1);
+    const uint64_t head = offset - alignedOffset;
+    const uint64_t readSize = std::min<uint64_t>(
+        kDirectIoBounceSize,
+        (head + length + kDirectIoAlignment - 1) & ~(kDirectIoAlignment - 1));
+    const auto bytesRead = ::pread(fd_, bounce.get(), readSize, alignedOffset);
+    VELOX_CHECK_GT(
+        bytesRead,
+        static_cast<ssize_t>(head),
+        "pread failure in LocalReadFile::directPread, {} vs {}.",
+        bytesRead,
+        head + length);
+    const auto copySize = std::min<uint64_t>(length, bytesRead - head);
+    ::memcpy(pos, bounce.get() + head, copySize);
+    pos += copySize;
+    offset += copySize;
+    length -= copySize;
+    if (length > 0 && bytesRead < static_cast<ssize_t>(readSize)) {
+      VELOX_FAIL(
+          "pread failure in LocalReadFile::directPread, {} bytes past end "
+          "of file.",
+          length);
+    }
+  }
+}
+
 std::string_view
 LocalReadFile::pread(uint64_t offset, uint64_t length, void* buf) const {
   preadInternal(offset, length, static_cast<char*>(buf));
@@ -130,6 +191,12 @@ LocalReadFile::pread(uint64_t offset, uint64_t length, void* buf) const {
 uint64_t LocalReadFile::preadv(
     uint64_t offset,
     const std::vector<folly::Range<char*>>& buffers) const {
+  if (directIo_) {
+    // The iovec fast path reads directly into caller buffers, which are
+    // not aligned for O_DIRECT. Read range by range through the aligned
+    // bounce buffer instead.
+    return ReadFile::preadv(offset, buffers);
+  }
   // Dropped bytes sized so that a typical dropped range of 50K is not
   // too many iovecs.
   static thread_local std::vector<char> droppedBytes(16 * 1024);
@@ -150,6 +217,48 @@ uint64_t LocalReadFile::preadv(
   return folly::preadv(fd_, iovecs.data(), iovecs.size(), offset);
 }
 
+void LocalReadFile::preadv(const std::vector<Segment>& segments) const {
+  if (directIo_) {
+    ReadFile::preadv(segments);
+    return;
+  }
+  std::vector<struct iovec> iovecs;
+  iovecs.reserve(std::min<size_t>(segments.size(), folly::kIovMax));
+  uint64_t batchOffset = 0;
+  uint64_t batchLength = 0;
+  auto flush = [&]() {
+    if (iovecs.empty()) {
+      return;
+    }
+    auto bytesRead =
+        folly::preadv(fd_, iovecs.data(), iovecs.size(), batchOffset);
+    VELOX_CHECK_EQ(
+        bytesRead,
+        batchLength,
+        "preadv failure in LocalReadFile::preadv, {} vs {}.",
+        bytesRead,
+        batchLength);
+    iovecs.clear();
+    batchLength = 0;
+  };
+  for (const auto& segment : segments) {
+    bytesRead_ += segment.buffer.size();
+    // Start a new batch if the segment is not contiguous with the
+    // previous one or the batch is at the iovec limit.
+    if (!iovecs.empty() &&
+        (segment.offset != batchOffset + batchLength ||
+         iovecs.size() >= folly::kIovMax)) {
+      flush();
+    }
+    if (iovecs.empty()) {
+      batchOffset = segment.offset;
+    }
+    iovecs.push_back({segment.buffer.data(), segment.buffer.size()});
+    batchLength += segment.buffer.size();
+  }
+  flush();
+}
+
 uint64_t LocalReadFile::size() const {
   return size_;
 }
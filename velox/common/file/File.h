@@ -235,7 +235,12 @@ class InMemoryWriteFile final : public WriteFile {
 
 class LocalReadFile final : public ReadFile {
  public:
-  explicit LocalReadFile(std::string_view path);
+  // Opens the file at 'path'. If 'directIo' is true the file is opened
+  // with O_DIRECT where the platform and file system support it,
+  // bypassing the OS page cache. Reads then go through an aligned bounce
+  // buffer, so callers need no alignment of their own. Falls back to
+  // buffered IO if direct IO is not supported.
+  explicit LocalReadFile(std::string_view path, bool directIo = false);
 
   explicit LocalReadFile(int32_t fd);
 
@@ -250,6 +255,11 @@ class LocalReadFile final : public ReadFile {
       uint64_t offset,
       const std::vector<folly::Range<char*>>& buffers) const final;
 
+  // Combines runs of contiguous segments into single vectored reads so
+  // that opening a stripe costs one syscall per contiguous run instead
+  // of one per stream.
+  void preadv(const std::vector<Segment>& segments) const final;
+
   uint64_t memoryUsage() const final;
 
   bool shouldCoalesce() const final {
@@ -271,9 +281,18 @@ class LocalReadFile final : public ReadFile {
   void preadInternal(uint64_t offset, uint64_t length, char* FOLLY_NONNULL pos)
       const;
 
+  // Reads [offset, offset + length) into 'pos' through a thread-local
+  // aligned bounce buffer, satisfying the offset, size and address
+  // alignment O_DIRECT requires.
+  void directPread(uint64_t offset, uint64_t length, char* FOLLY_NONNULL pos)
+      const;
+
   std::string path_;
   int32_t fd_;
   long size_;
+
+  // True if the file was opened with O_DIRECT and reads must be aligned.
+  bool directIo_{false};
 };
 
 class LocalWriteFile final : public WriteFile {
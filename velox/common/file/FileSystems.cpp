@@ -18,6 +18,7 @@
 #include <folly/synchronization/CallOnce.h>
 #include "velox/common/base/Exceptions.h"
 #include "velox/common/file/File.h"
+#include "velox/core/Config.h"
 
 #include <cstdio>
 #include <filesystem>
@@ -69,7 +70,9 @@ folly::once_flag localFSInstantiationFlag;
 class LocalFileSystem : public FileSystem {
  public:
   explicit LocalFileSystem(std::shared_ptr<const Config> config)
-      : FileSystem(config) {}
+      : FileSystem(config),
+        directIoRead_(
+            config ? config->get<bool>(kLocalDirectIoRead, false) : false) {}
 
   ~LocalFileSystem() override {}
 
@@ -87,7 +90,7 @@ class LocalFileSystem : public FileSystem {
   std::unique_ptr<ReadFile> openFileForRead(
       std::string_view path,
       const FileOptions& /*unused*/) override {
-    return std::make_unique<LocalReadFile>(extractPath(path));
+    return std::make_unique<LocalReadFile>(extractPath(path), directIoRead_);
   }
 
   std::unique_ptr<WriteFile> openFileForWrite(
@@ -191,6 +194,11 @@ class LocalFileSystem : public FileSystem {
       return lfs;
     };
   }
+
+ private:
+  // True if files are opened for read with O_DIRECT. See
+  // kLocalDirectIoRead.
+  const bool directIoRead_;
 };
 } // namespace
 
@@ -101,6 +101,13 @@ void registerFileSystem(
         std::shared_ptr<const Config>,
         std::string_view)> fileSystemGenerator);
 
+/// Name of the configuration property that makes the local file system
+/// open files for read with O_DIRECT where supported, bypassing the OS
+/// page cache. Use when the application caches file data itself, e.g. in
+/// AsyncDataCache, so that bulk scans do not also fill and evict the page
+/// cache.
+constexpr const char* kLocalDirectIoRead = "local-direct-io-read";
+
 /// Register the local filesystem.
 void registerLocalFileSystem();
 
@@ -119,6 +119,46 @@ TEST(LocalFile, writeAndRead) {
   readData(&readFile);
 }
 
+TEST(LocalFile, preadv) {
+  auto tempFile = ::exec::test::TempFilePath::create();
+  const auto& filename = tempFile->path.c_str();
+  remove(filename);
+  {
+    LocalWriteFile writeFile(filename);
+    writeData(&writeFile);
+  }
+  // aaaaa bbbbb c*1MB ddddd
+  LocalReadFile readFile(filename);
+  std::vector<std::string> buffers = {"1234", "567", "something else", "890"};
+  std::vector<std::string> expected = {"1ab4", "5b7", "scccdding else", "ddd"};
+  // The first two segments are contiguous and are combined into a single
+  // vectored read; the rest start new batches.
+  std::vector<ReadFile::Segment> readSegments = std::vector<ReadFile::Segment>{
+      {4, folly::Range<char*>{&buffers[0][1], 2UL}, {}},
+      {6, folly::Range<char*>{&buffers[1][1], 1UL}, {}},
+      {5 + 5 + kOneMB - 3, {&buffers[2][1], 5UL}, {}},
+      {5 + 5 + kOneMB + 2, {&buffers[3][0], 3UL}, {}}};
+
+  readFile.preadv(readSegments);
+
+  EXPECT_EQ(expected, buffers);
+}
+
+TEST(LocalFile, directIoRead) {
+  auto tempFile = ::exec::test::TempFilePath::create();
+  const auto& filename = tempFile->path.c_str();
+  remove(filename);
+  {
+    LocalWriteFile writeFile(filename);
+    writeData(&writeFile);
+  }
+  // Direct IO reads go through the aligned bounce buffer. Where the file
+  // system does not support O_DIRECT, e.g. tmpfs, the file falls back to
+  // buffered IO. The data read must be the same either way.
+  LocalReadFile readFile(filename, true);
+  readData(&readFile);
+}
+
 TEST(LocalFile, viaRegistry) {
   filesystems::registerLocalFileSystem();
   auto tempFile = ::exec::test::TempFilePath::create();
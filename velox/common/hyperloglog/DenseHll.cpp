@@ -18,6 +18,7 @@
 #include <exception>
 #include <sstream>
 #include "velox/common/base/IOUtils.h"
+#include "velox/common/base/SimdUtil.h"
 #include "velox/common/hyperloglog/BiasCorrection.h"
 #include "velox/common/hyperloglog/HllUtils.h"
 
@@ -568,6 +569,11 @@ void DenseHll::mergeWith(
     int16_t otherOverflows,
     const uint16_t* otherOverflowBuckets,
     const int8_t* otherOverflowValues) {
+  if (baseline_ == otherBaseline && overflows_ == 0 && otherOverflows == 0) {
+    mergeNoOverflows(otherDeltas);
+    return;
+  }
+
   int8_t newBaseline = std::max(baseline_, otherBaseline);
   int32_t baselineCount = 0;
 
@@ -623,6 +629,44 @@ void DenseHll::mergeWith(
   adjustBaselineIfNeeded();
 }
 
+void DenseHll::mergeNoOverflows(const int8_t* otherDeltas) {
+  // With equal baselines and no overflow entries on either side, each 4-bit
+  // delta pair merges independently as the max of the two, so a whole batch
+  // of packed deltas is merged per SIMD instruction.
+  constexpr int32_t kBatchSize = xsimd::batch<uint8_t>::size;
+  const auto hiMask = xsimd::broadcast<uint8_t>(0xf0);
+  const auto loMask = xsimd::broadcast<uint8_t>(0x0f);
+
+  auto* deltas = reinterpret_cast<uint8_t*>(deltas_.data());
+  const auto* other = reinterpret_cast<const uint8_t*>(otherDeltas);
+  const int32_t size = deltas_.size();
+  int32_t i = 0;
+  for (; i + kBatchSize <= size; i += kBatchSize) {
+    auto left = xsimd::batch<uint8_t>::load_unaligned(deltas + i);
+    auto right = xsimd::batch<uint8_t>::load_unaligned(other + i);
+    auto merged = xsimd::max(left & hiMask, right & hiMask) |
+        xsimd::max(left & loMask, right & loMask);
+    merged.store_unaligned(deltas + i);
+  }
+  for (; i < size; ++i) {
+    const uint8_t left = deltas[i];
+    const uint8_t right = other[i];
+    deltas[i] = std::max<uint8_t>(left & 0xf0, right & 0xf0) |
+        std::max<uint8_t>(left & 0x0f, right & 0x0f);
+  }
+
+  baselineCount_ = 0;
+  for (i = 0; i < size; ++i) {
+    if ((deltas[i] & 0xf0) == 0) {
+      ++baselineCount_;
+    }
+    if ((deltas[i] & 0x0f) == 0) {
+      ++baselineCount_;
+    }
+  }
+  adjustBaselineIfNeeded();
+}
+
 int8_t
 DenseHll::updateOverflow(int32_t index, int overflowEntry, int8_t delta) {
   if (delta > kMaxDelta) {
@@ -116,6 +116,10 @@ class DenseHll {
       const uint16_t* otherOverflowBuckets,
       const int8_t* otherOverflowValues);
 
+  /// SIMD fast path of mergeWith for the common case where both HLLs have the
+  /// same baseline and no overflow entries.
+  void mergeNoOverflows(const int8_t* otherDeltas);
+
   /// Number of first bits of the hash to calculate buckets from.
   int8_t indexBitLength_;
 
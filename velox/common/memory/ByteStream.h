@@ -334,6 +334,28 @@ class ByteStream {
     }
   }
 
+  // Appends 'values' as one unit, checking bounds once for the combined
+  // size instead of once per piece. Falls back to piece-wise append when
+  // the data does not fit in the current range.
+  void appendStringPieces(folly::Range<const folly::StringPiece*> values) {
+    int64_t total = 0;
+    for (const auto& value : values) {
+      total += value.size();
+    }
+    if (current_->position + total > current_->size) {
+      for (const auto& value : values) {
+        appendStringPiece(value);
+      }
+      return;
+    }
+    auto* target = current_->buffer + current_->position;
+    for (const auto& value : values) {
+      memcpy(target, value.data(), value.size());
+      target += value.size();
+    }
+    current_->position += total;
+  }
+
   template <typename T>
   void appendOne(const T& value) {
     append(folly::Range(&value, 1));
@@ -406,8 +428,21 @@ class IOBufOutputStream : public OutputStream {
       memory::MemoryPool& pool,
       OutputStreamListener* listener = nullptr,
       int32_t initialSize = memory::AllocationTraits::kPageSize)
+      : IOBufOutputStream(
+            std::make_shared<StreamArena>(&pool),
+            listener,
+            initialSize) {}
+
+  /// Writes into 'arena'. The IOBufs returned by getIOBuf() keep shared
+  /// ownership of 'arena', so a caller that also retains a reference
+  /// can recycle the arena once the IOBufs are freed. See
+  /// StreamArena::clear().
+  explicit IOBufOutputStream(
+      std::shared_ptr<StreamArena> arena,
+      OutputStreamListener* listener = nullptr,
+      int32_t initialSize = memory::AllocationTraits::kPageSize)
       : OutputStream(listener),
-        arena_(std::make_shared<StreamArena>(&pool)),
+        arena_(std::move(arena)),
         out_(std::make_unique<ByteStream>(arena_.get())) {
     out_->startWrite(initialSize);
   }
@@ -321,6 +321,14 @@ void HashStringAllocator::free(Header* _header) {
   } while (header);
 }
 
+void HashStringAllocator::free(folly::Range<const StringView*> views) {
+  for (const auto& view : views) {
+    if (!view.isInline()) {
+      free(headerOf(view.data()));
+    }
+  }
+}
+
 //  static
 int64_t HashStringAllocator::offset(
     Header* FOLLY_NONNULL header,
@@ -188,6 +188,50 @@ class HashStringAllocator : public StreamArena {
   // strings.
   static StringView contiguousString(StringView view, std::string& storage);
 
+  // Iterates over the contiguous pieces of a string written with
+  // copyMultipart() or a stream write, in order. Zero copy: each piece
+  // points directly into the backing blocks. Use instead of
+  // contiguousString() when the consumer can process the string
+  // piecewise, e.g. for comparison or copying into a target buffer.
+  class StringPieceIterator {
+   public:
+    explicit StringPieceIterator(StringView view)
+        : data_(view.data()), remaining_(view.size()) {
+      if (!view.isInline()) {
+        header_ = headerOf(view.data());
+      }
+    }
+
+    // True if all pieces have been returned.
+    bool atEnd() const {
+      return remaining_ == 0;
+    }
+
+    // Returns the next piece. May only be called if atEnd() is false.
+    folly::StringPiece next() {
+      if (!header_) {
+        // An inline string is a single piece.
+        folly::StringPiece piece(data_, remaining_);
+        remaining_ = 0;
+        return piece;
+      }
+      auto size = header_->size();
+      if (header_->isContinued()) {
+        size -= Header::kContinuedPtrSize;
+      }
+      size = std::min<int32_t>(size, remaining_);
+      folly::StringPiece piece(header_->begin(), size);
+      remaining_ -= size;
+      header_ = remaining_ > 0 ? header_->nextContinued() : nullptr;
+      return piece;
+    }
+
+   private:
+    Header* FOLLY_NULLABLE header_{nullptr};
+    const char* FOLLY_NONNULL data_;
+    int32_t remaining_;
+  };
+
   // Allocates 'size' contiguous bytes preceded by a Header. Returns
   // the address of Header.
   Header* FOLLY_NONNULL allocate(int32_t size) {
@@ -261,6 +305,13 @@ class HashStringAllocator : public StreamArena {
   // kContinued set) to the free list.
   void free(Header* FOLLY_NONNULL header);
 
+  // Frees the blocks backing the non-inline views in 'views'. The views
+  // must point to data written with copyMultipart() or a stream write
+  // positioned at a block of 'this'. Inline views are ignored. Use this
+  // when dropping the variable-length data of many rows at once, e.g.
+  // when erasing rows from a RowContainer.
+  void free(folly::Range<const StringView*> views);
+
   // Returns a lower bound on bytes available without growing
   // 'this'. This is the sum of free block sizes minus size of pointer
   // for each. We subtract the pointer because in the worst case we
@@ -272,10 +323,16 @@ class HashStringAllocator : public StreamArena {
     return minFree;
   }
 
-  // Frees all memory associated with 'this' and leaves 'this' ready for reuse.
+  // Frees all memory associated with 'this' and leaves 'this' ready for
+  // reuse. Returns whole slabs to 'pool()' instead of freeing the blocks
+  // one at a time, so this is the fast way to drop all state backed by
+  // the arena when the owner of 'this' controls the lifetime of every
+  // allocation, e.g. on clearing or destroying a RowContainer.
   void clear() {
     numFree_ = 0;
     freeBytes_ = 0;
+    cumulativeBytes_ = 0;
+    currentHeader_ = nullptr;
     new (&free_) CompactDoubleList();
     pool_.clear();
   }
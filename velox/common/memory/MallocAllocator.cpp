@@ -227,8 +227,15 @@ void* MallocAllocator::allocateBytes(uint64_t bytes, uint16_t alignment) {
         bytes,
         alignment);
   }
-  void* result = (alignment > kMinAlignment) ? ::aligned_alloc(alignment, bytes)
-                                             : ::malloc(bytes);
+  void* result;
+  if (alignment > kMinAlignment) {
+    result = ::aligned_alloc(alignment, bytes);
+  } else {
+    result = ThreadAllocationCache::allocate(bytes);
+    if (result == nullptr) {
+      result = ::malloc(bytes);
+    }
+  }
   if (FOLLY_UNLIKELY(result == nullptr)) {
     VELOX_MEM_LOG(ERROR) << "Failed to allocateBytes " << bytes
                          << " bytes with " << alignment << " alignment";
@@ -249,7 +256,9 @@ void* MallocAllocator::allocateZeroFilled(uint64_t bytes) {
 }
 
 void MallocAllocator::freeBytes(void* p, uint64_t bytes) noexcept {
-  ::free(p); // NOLINT
+  if (!ThreadAllocationCache::free(p, bytes)) {
+    ::free(p); // NOLINT
+  }
   decrementUsage(bytes);
 }
 
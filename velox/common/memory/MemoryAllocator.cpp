@@ -208,4 +208,68 @@ std::string Stats::toString() const {
   return out.str();
 }
 
+ThreadAllocationCache::Magazines::~Magazines() {
+  for (auto i = 0; i < kNumClasses; ++i) {
+    for (auto j = 0; j < numBlocks[i]; ++j) {
+      ::free(blocks[i][j]); // NOLINT
+    }
+  }
+}
+
+// static
+ThreadAllocationCache::Magazines& ThreadAllocationCache::magazines() {
+  static thread_local Magazines cache;
+  return cache;
+}
+
+// static
+void* FOLLY_NULLABLE ThreadAllocationCache::allocate(uint64_t bytes) {
+  const auto index = sizeIndex(bytes);
+  if (index < 0) {
+    return nullptr;
+  }
+  auto& cache = magazines();
+  if (cache.numBlocks[index] == 0) {
+    return nullptr;
+  }
+  return cache.blocks[index][--cache.numBlocks[index]];
+}
+
+// static
+bool ThreadAllocationCache::free(
+    void* FOLLY_NONNULL p,
+    uint64_t bytes) noexcept {
+  const auto index = sizeIndex(bytes);
+  if (index < 0) {
+    return false;
+  }
+  auto& cache = magazines();
+  if (cache.numBlocks[index] == kMagazineSize) {
+    return false;
+  }
+  cache.blocks[index][cache.numBlocks[index]++] = p;
+  return true;
+}
+
+// static
+void ThreadAllocationCache::flush() {
+  auto& cache = magazines();
+  for (auto i = 0; i < kNumClasses; ++i) {
+    for (auto j = 0; j < cache.numBlocks[i]; ++j) {
+      ::free(cache.blocks[i][j]); // NOLINT
+    }
+    cache.numBlocks[i] = 0;
+  }
+}
+
+// static
+int64_t ThreadAllocationCache::cachedBytes() {
+  auto& cache = magazines();
+  int64_t bytes = 0;
+  for (auto i = 0; i < kNumClasses; ++i) {
+    bytes += cache.numBlocks[i] * (kMinCached << i);
+  }
+  return bytes;
+}
+
 } // namespace facebook::velox::memory
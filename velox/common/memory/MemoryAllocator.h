@@ -401,4 +401,57 @@ class MemoryAllocator : public std::enable_shared_from_this<MemoryAllocator> {
 };
 
 std::ostream& operator<<(std::ostream& out, const MemoryAllocator::Kind& kind);
+
+/// Thread local cache of small free blocks in front of the allocators that
+/// delegate small allocations to std::malloc. Freeing an eligible size puts
+/// the block into a per size magazine of the freeing thread and a subsequent
+/// allocation of the same size pops it, saving the malloc/free pair for
+/// transient allocations like string buffer growth in expression evaluation.
+/// Cached blocks are not counted in any allocator's usage, so the cache can
+/// serve all malloc-backed allocators alike. A thread caches at most a few
+/// hundred KB; flush() gives the blocks of the calling thread back to
+/// malloc, e.g. when a Driver yields its thread.
+class ThreadAllocationCache {
+ public:
+  /// Returns a cached block of exactly 'bytes' or nullptr. Only sizes that
+  /// are powers of two between 'kMinCached' and 'kMaxCached' bytes are
+  /// cacheable. Cached blocks have malloc's alignment.
+  static void* FOLLY_NULLABLE allocate(uint64_t bytes);
+
+  /// Caches 'p' of size 'bytes'. Returns false if the size is not cacheable
+  /// or the magazine of the size is full, in which case the caller frees the
+  /// block.
+  static bool free(void* FOLLY_NONNULL p, uint64_t bytes) noexcept;
+
+  /// Returns all blocks cached by the calling thread to malloc.
+  static void flush();
+
+  /// Bytes cached by the calling thread.
+  static int64_t cachedBytes();
+
+ private:
+  static constexpr uint64_t kMinCached = 64;
+  static constexpr uint64_t kMaxCached = 4096;
+  static constexpr int32_t kNumClasses = 7;
+  static constexpr int32_t kMagazineSize = 16;
+
+  struct Magazines {
+    ~Magazines();
+
+    std::array<std::array<void*, kMagazineSize>, kNumClasses> blocks;
+    std::array<int32_t, kNumClasses> numBlocks{};
+  };
+
+  // Returns the magazine index for 'bytes', -1 if the size is not
+  // cacheable.
+  static int32_t sizeIndex(uint64_t bytes) {
+    if (bytes < kMinCached || bytes > kMaxCached ||
+        (bytes & (bytes - 1)) != 0) {
+      return -1;
+    }
+    return __builtin_ctzll(bytes) - __builtin_ctzll(kMinCached);
+  }
+
+  static Magazines& magazines();
+};
 } // namespace facebook::velox::memory
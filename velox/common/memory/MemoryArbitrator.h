@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "velox/common/base/Exceptions.h"
@@ -24,6 +25,7 @@
 
 namespace facebook::velox::memory {
 
+class ArbitrationPolicy;
 class MemoryPool;
 
 /// The memory arbitrator interface. There is one memory arbitrator object per
@@ -85,6 +87,13 @@ class MemoryArbitrator {
     /// same query on all the workers instead of a random victim query which
     /// happens to trigger the failed memory arbitration.
     bool retryArbitrationFailure{true};
+
+    /// If not null, overrides the arbitrator's builtin candidate selection
+    /// with a custom policy (see ArbitrationPolicy definition below). This
+    /// lets the embedder choose which queries to reclaim from and which
+    /// query to abort based on information the arbitrator doesn't have,
+    /// such as per-query priorities.
+    std::shared_ptr<ArbitrationPolicy> arbitrationPolicy{nullptr};
   };
   static std::unique_ptr<MemoryArbitrator> create(const Config& config);
 
@@ -126,6 +135,15 @@ class MemoryArbitrator {
       const std::vector<std::shared_ptr<MemoryPool>>& candidatePools,
       uint64_t targetBytes) = 0;
 
+  /// The stats of a candidate query root memory pool participating in the
+  /// memory arbitration.
+  struct Candidate {
+    bool reclaimable{false};
+    uint64_t reclaimableBytes{0};
+    uint64_t freeBytes{0};
+    MemoryPool* pool;
+  };
+
   /// The internal execution stats of the memory arbitrator.
   struct Stats {
     /// The number of arbitration requests.
@@ -163,17 +181,52 @@ class MemoryArbitrator {
         initMemoryPoolCapacity_(config.initMemoryPoolCapacity),
         minMemoryPoolCapacityTransferSize_(
             config.minMemoryPoolCapacityTransferSize),
-        retryArbitrationFailure_(config.retryArbitrationFailure) {}
+        retryArbitrationFailure_(config.retryArbitrationFailure),
+        arbitrationPolicy_(config.arbitrationPolicy) {}
 
   const Kind kind_;
   const uint64_t capacity_;
   const uint64_t initMemoryPoolCapacity_;
   const uint64_t minMemoryPoolCapacityTransferSize_;
   const bool retryArbitrationFailure_;
+  const std::shared_ptr<ArbitrationPolicy> arbitrationPolicy_;
 };
 
 std::ostream& operator<<(std::ostream& out, const MemoryArbitrator::Kind& kind);
 
+/// The pluggable policy interface used by the memory arbitrator to select
+/// the candidate memory pools to reclaim from and the candidate to abort
+/// when the arbitration fails. If no policy is set in the arbitrator
+/// config, the shared arbitrator reclaims from the candidate with the most
+/// reclaimable memory and aborts the candidate with the largest capacity.
+/// A custom policy lets the embedder implement schemes such as reclaiming
+/// from the query with the cheapest spill first and only aborting
+/// best-effort queries, based on information it maintains outside of Velox
+/// such as per-query priorities or observed spill throughput.
+class ArbitrationPolicy {
+ public:
+  virtual ~ArbitrationPolicy() = default;
+
+  /// Invoked to order 'candidates' for used memory reclamation. The
+  /// arbitrator reclaims from the candidates in the sorted order until it
+  /// has freed the request target, so the candidates that are the cheapest
+  /// to reclaim shall be placed first. Candidates with no reclaimable
+  /// memory shall be placed last as the arbitrator stops at the first
+  /// non-reclaimable candidate.
+  virtual void sortForReclaim(
+      std::vector<MemoryArbitrator::Candidate>& candidates) const = 0;
+
+  /// Invoked to select the candidate to abort when the arbitration fails
+  /// to free up enough memory. 'requestor' is the root memory pool which
+  /// triggered the arbitration and 'targetBytes' is its capacity growth
+  /// request. 'candidates' is guaranteed to be non-empty and the returned
+  /// reference must point into it.
+  virtual const MemoryArbitrator::Candidate& selectVictim(
+      const MemoryPool* requestor,
+      uint64_t targetBytes,
+      const std::vector<MemoryArbitrator::Candidate>& candidates) const = 0;
+};
+
 /// The memory reclaimer interface is used by memory pool to participate in
 /// the memory arbitration execution (enter/leave arbitration process) as well
 /// as reclaim memory from the associated query object. We have default
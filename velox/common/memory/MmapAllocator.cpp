@@ -16,14 +16,101 @@
 
 #include "velox/common/memory/MmapAllocator.h"
 
+#include <sched.h>
 #include <sys/mman.h>
 
+#include <fstream>
+
+#include <folly/String.h>
+
 #include "velox/common/base/Portability.h"
 #include "velox/common/memory/Memory.h"
 
 namespace facebook::velox::memory {
+
+namespace {
+// Returns a map from cpu index to NUMA node read from
+// /sys/devices/system/node. Empty if the topology cannot be read, e.g. on
+// non-Linux systems.
+std::vector<int32_t> makeCpuToNode() {
+  std::vector<int32_t> cpuToNode;
+#ifdef linux
+  for (int32_t node = 0;; ++node) {
+    std::ifstream in(
+        fmt::format("/sys/devices/system/node/node{}/cpulist", node));
+    if (!in.is_open()) {
+      break;
+    }
+    std::string list;
+    std::getline(in, list);
+    std::vector<folly::StringPiece> ranges;
+    folly::split(',', list, ranges);
+    for (auto& range : ranges) {
+      int32_t first;
+      int32_t last;
+      if (range.find('-') != folly::StringPiece::npos) {
+        if (!folly::split('-', range, first, last)) {
+          continue;
+        }
+      } else {
+        auto cpu = folly::tryTo<int32_t>(range);
+        if (!cpu.hasValue()) {
+          continue;
+        }
+        first = last = cpu.value();
+      }
+      if (last >= cpuToNode.size()) {
+        cpuToNode.resize(last + 1, 0);
+      }
+      for (auto cpu = first; cpu <= last; ++cpu) {
+        cpuToNode[cpu] = node;
+      }
+    }
+  }
+#endif
+  return cpuToNode;
+}
+
+const std::vector<int32_t>& cpuToNode() {
+  static const std::vector<int32_t> map = makeCpuToNode();
+  return map;
+}
+
+// Number of NUMA nodes of the system, 1 if the topology is not available.
+int32_t numaNodeCount() {
+  static const int32_t count = [&]() {
+    int32_t max = 0;
+    for (auto node : cpuToNode()) {
+      max = std::max(max, node);
+    }
+    return max + 1;
+  }();
+  return count;
+}
+
+// Returns the NUMA node of the cpu the calling thread runs on, modulo
+// 'numArenas'. 0 if the topology is not available.
+int32_t currentNumaArena(int32_t numArenas) {
+  if (numArenas <= 1) {
+    return 0;
+  }
+#ifdef linux
+  const auto& map = cpuToNode();
+  const auto cpu = sched_getcpu();
+  if (cpu < 0 || cpu >= map.size()) {
+    return 0;
+  }
+  return map[cpu] % numArenas;
+#else
+  return 0;
+#endif
+}
+} // namespace
+
 MmapAllocator::MmapAllocator(const Options& options)
     : kind_(MemoryAllocator::Kind::kMmap),
+      numaArenas_(
+          options.numaArenas != 0 ? options.numaArenas : numaNodeCount()),
       useMmapArena_(options.useMmapArena),
       maxMallocBytes_(options.maxMallocBytes),
       mallocReservedBytes_(
@@ -34,7 +121,8 @@ MmapAllocator::MmapAllocator(const Options& options)
           AllocationTraits::numPages(options.capacity - mallocReservedBytes_),
           64 * sizeClassSizes_.back())) {
   for (const auto& size : sizeClassSizes_) {
-    sizeClasses_.push_back(std::make_unique<SizeClass>(capacity_ / size, size));
+    sizeClasses_.push_back(
+        std::make_unique<SizeClass>(capacity_ / size, size, numaArenas_));
   }
 
   if (useMmapArena_) {
@@ -108,6 +196,7 @@ bool MmapAllocator::allocateNonContiguous(
     }
   }
   MachinePageCount newMapsNeeded = 0;
+  const auto arena = currentArena();
   for (int i = 0; i < mix.numSizes; ++i) {
     bool success;
     stats_.recordAllocate(
@@ -115,7 +204,7 @@ bool MmapAllocator::allocateNonContiguous(
         mix.sizeCounts[i],
         [&]() {
           success = sizeClasses_[mix.sizeIndices[i]]->allocate(
-              mix.sizeCounts[i], newMapsNeeded, out);
+              mix.sizeCounts[i], newMapsNeeded, out, arena);
         });
     if (success && ((i > 0) || (mix.numSizes == 1)) &&
         testingHasInjectedFailure(InjectedFailure::kAllocate)) {
@@ -373,8 +462,15 @@ void* MmapAllocator::allocateBytes(uint64_t bytes, uint16_t alignment) {
   alignmentCheck(bytes, alignment);
 
   if (useMalloc(bytes)) {
-    auto* result = alignment > kMinAlignment ? ::aligned_alloc(alignment, bytes)
-                                             : ::malloc(bytes);
+    void* result;
+    if (alignment > kMinAlignment) {
+      result = ::aligned_alloc(alignment, bytes);
+    } else {
+      result = ThreadAllocationCache::allocate(bytes);
+      if (result == nullptr) {
+        result = ::malloc(bytes);
+      }
+    }
     if (FOLLY_UNLIKELY(result == nullptr)) {
       VELOX_MEM_LOG(ERROR) << "Failed to allocateBytes " << bytes
                            << " bytes with " << alignment << " alignment";
@@ -413,7 +509,9 @@ void* MmapAllocator::allocateBytes(uint64_t bytes, uint16_t alignment) {
 
 void MmapAllocator::freeBytes(void* p, uint64_t bytes) noexcept {
   if (useMalloc(bytes)) {
-    ::free(p); // NOLINT
+    if (!ThreadAllocationCache::free(p, bytes)) {
+      ::free(p); // NOLINT
+    }
     numMallocBytes_.fetch_sub(bytes);
     return;
   }
@@ -439,8 +537,9 @@ void MmapAllocator::markAllMapped(const Allocation& allocation) {
 
 MachinePageCount MmapAllocator::adviseAway(MachinePageCount target) {
   MachinePageCount numAway = 0;
+  const auto arena = currentArena();
   for (int32_t i = sizeClasses_.size() - 1; i >= 0; --i) {
-    numAway += sizeClasses_[i]->adviseAway(target - numAway);
+    numAway += sizeClasses_[i]->adviseAway(target - numAway, arena);
     if (numAway >= target) {
       break;
     }
@@ -448,15 +547,29 @@ MachinePageCount MmapAllocator::adviseAway(MachinePageCount target) {
   return numAway;
 }
 
-MmapAllocator::SizeClass::SizeClass(size_t capacity, MachinePageCount unitSize)
+int32_t MmapAllocator::currentArena() const {
+  return currentNumaArena(numaArenas_);
+}
+
+MmapAllocator::SizeClass::SizeClass(
+    size_t capacity,
+    MachinePageCount unitSize,
+    int32_t numArenas)
     : capacity_(capacity),
       unitSize_(unitSize),
       byteSize_(AllocationTraits::pageBytes(capacity_ * unitSize_)),
       pageBitmapSize_(capacity_ / 64),
+      numArenas_(numArenas),
       // Min 8 words + 1 bit for every 512 bits in 'pageAllocated_'.
       mappedFreeLookup_((capacity_ / kPagesPerLookupBit / 64) + kSimdTail),
       pageAllocated_(pageBitmapSize_ + kSimdTail),
       pageMapped_(pageBitmapSize_ + kSimdTail) {
+  VELOX_CHECK_GE(numArenas_, 1);
+  arenaClockHand_.resize(numArenas_);
+  arenaLookupIndex_.resize(numArenas_, kNoLastLookup);
+  for (auto arena = 0; arena < numArenas_; ++arena) {
+    arenaClockHand_[arena] = arenaFirstWord(arena);
+  }
   VELOX_CHECK_EQ(
       capacity_ % 64,
       0,
@@ -542,6 +655,9 @@ std::string MmapAllocator::SizeClass::toString() const {
   auto mb = (AllocationTraits::pageBytes(count * unitSize_)) >> 20;
   out << "[size " << unitSize_ << ": " << count << "(" << mb << "MB) allocated "
       << mappedCount << " mapped";
+  if (numArenas_ > 1) {
+    out << " " << numCrossArenaPages_ << " cross-arena";
+  }
   if (mappedFreeCount != numMappedFreePages_) {
     out << "Mismatched count of mapped free pages "
         << ". Actual= " << mappedFreeCount
@@ -555,21 +671,23 @@ std::string MmapAllocator::SizeClass::toString() const {
 bool MmapAllocator::SizeClass::allocate(
     ClassPageCount numPages,
     MachinePageCount& numUnmapped,
-    Allocation& out) {
+    Allocation& out,
+    int32_t arena) {
   std::lock_guard<std::mutex> l(mutex_);
-  return allocateLocked(numPages, &numUnmapped, out);
+  return allocateLocked(numPages, &numUnmapped, out, arena);
 }
 
 bool MmapAllocator::SizeClass::allocateLocked(
     const ClassPageCount numPages,
     MachinePageCount* numUnmapped,
-    Allocation& out) {
+    Allocation& out,
+    int32_t arena) {
   const size_t numWords = pageBitmapSize_;
   ClassPageCount considerMappedOnly = std::min(numMappedFreePages_, numPages);
   auto numPagesToAllocate = numPages;
   if (considerMappedOnly > 0) {
     const auto previousPages = out.numPages();
-    allocateFromMappedFree(considerMappedOnly, out);
+    allocateFromMappedFree(considerMappedOnly, out, arena);
     const auto numAllocated = (out.numPages() - previousPages) / unitSize_;
     VELOX_CHECK_EQ(
         numAllocated,
@@ -584,7 +702,7 @@ bool MmapAllocator::SizeClass::allocateLocked(
   if (numUnmapped == nullptr) {
     return false;
   }
-  uint32_t cursor = clockHand_;
+  uint32_t cursor = arenaClockHand_[arena];
   int32_t numWordsTried = 0;
   for (;;) {
     auto previousCursor = cursor;
@@ -597,10 +715,15 @@ bool MmapAllocator::SizeClass::allocateLocked(
     uint64_t bits = pageAllocated_[cursor];
     if (bits != kAllSet) {
       const auto previousToAllocate = numPagesToAllocate;
-      allocateAny(cursor, numPagesToAllocate, *numUnmapped, out);
+      allocateAny(cursor, numPagesToAllocate, *numUnmapped, out, arena);
       numAllocatedUnmapped_ += previousToAllocate - numPagesToAllocate;
       if (numPagesToAllocate == 0) {
-        clockHand_ = previousCursor;
+        // Resume the next scan from here if still in the caller's arena,
+        // else from the start of the arena so that the hands of different
+        // arenas do not converge on the same range.
+        arenaClockHand_[arena] = wordArena(previousCursor) == arena
+            ? previousCursor
+            : arenaFirstWord(arena);
         return true;
       }
     }
@@ -614,11 +737,14 @@ bool isAllZero(xsimd::batch<uint64_t> bits) {
 }
 } // namespace
 
-uint32_t MmapAllocator::SizeClass::findMappedFreeGroup() {
+uint32_t MmapAllocator::SizeClass::findMappedFreeGroup(int32_t arena) {
   constexpr int32_t kWidth = xsimd::batch<int64_t>::size;
-  int32_t index = lastLookupIndex_;
+  int32_t index = arenaLookupIndex_[arena];
   if (index == kNoLastLookup) {
-    index = 0;
+    // Start in the arena's share of the lookup words.
+    index = std::min<int32_t>(
+        arena * (mappedFreeLookup_.size() - kSimdTail) / numArenas_,
+        mappedFreeLookup_.size() - kWidth);
   }
   auto lookupSize = mappedFreeLookup_.size() + kSimdTail;
   for (auto counter = 0; counter <= lookupSize; counter += kWidth) {
@@ -631,7 +757,7 @@ uint32_t MmapAllocator::SizeClass::findMappedFreeGroup() {
           : 0;
       continue;
     }
-    lastLookupIndex_ = index;
+    arenaLookupIndex_[arena] = index;
     auto wordIndex = count_trailing_zeros(bits);
     auto word = mappedFreeLookup_[index + wordIndex];
     auto bit = count_trailing_zeros(word);
@@ -650,12 +776,13 @@ xsimd::batch<uint64_t> MmapAllocator::SizeClass::mappedFreeBits(int32_t index) {
 
 void MmapAllocator::SizeClass::allocateFromMappedFree(
     int32_t numPages,
-    Allocation& allocation) {
+    Allocation& allocation,
+    int32_t arena) {
   constexpr int32_t kWidth = xsimd::batch<int64_t>::size;
   constexpr int32_t kWordsPerGroup = kPagesPerLookupBit / 64;
   int needed = numPages;
   for (;;) {
-    const auto group = findMappedFreeGroup();
+    const auto group = findMappedFreeGroup(arena);
     const auto startWord = group * kWordsPerGroup;
     const auto endWord = startWord + kWordsPerGroup;
     bool anyFound = false;
@@ -680,6 +807,9 @@ void MmapAllocator::SizeClass::allocateFromMappedFree(
             }
             const auto page = word * 64 + bit;
             bits::setBit(pageAllocated_.data(), page);
+            if (wordArena(word + (bit >> 6)) != arena) {
+              ++numCrossArenaPages_;
+            }
             allocation.append(
                 address_ + AllocationTraits::pageBytes(page * unitSize_),
                 unitSize_);
@@ -711,7 +841,8 @@ void MmapAllocator::SizeClass::allocateFromMappedFree(
 }
 
 MachinePageCount MmapAllocator::SizeClass::adviseAway(
-    MachinePageCount numPages) {
+    MachinePageCount numPages,
+    int32_t arena) {
   // Allocate as many mapped free pages as needed and advise them away.
   ClassPageCount target = bits::roundUp(numPages, unitSize_) / unitSize_;
   Allocation allocation;
@@ -721,7 +852,7 @@ MachinePageCount MmapAllocator::SizeClass::adviseAway(
       return 0;
     }
     target = std::min(target, numMappedFreePages_);
-    allocateLocked(target, nullptr, allocation);
+    allocateLocked(target, nullptr, allocation, arena);
     VELOX_CHECK_EQ(allocation.numPages(), target * unitSize_);
     numAllocatedMapped_ -= target;
     numAdvisedAway_ += target;
@@ -838,9 +969,13 @@ void MmapAllocator::SizeClass::allocateAny(
     int32_t wordIndex,
     ClassPageCount& numPages,
     MachinePageCount& numUnmapped,
-    Allocation& allocation) {
+    Allocation& allocation,
+    int32_t arena) {
   uint64_t freeBits = ~pageAllocated_[wordIndex];
   const auto toAlloc = std::min(numPages, __builtin_popcountll(freeBits));
+  if (wordArena(wordIndex) != arena) {
+    numCrossArenaPages_ += toAlloc;
+  }
   for (int32_t i = 0; i < toAlloc; ++i) {
     const int bit = __builtin_ctzll(freeBits);
     bits::setBit(&pageAllocated_[wordIndex], bit);
@@ -895,7 +1030,7 @@ std::string MmapAllocator::toString() const {
   std::stringstream out;
   out << "[Memory capacity " << capacity_ << " allocated " << numAllocated_
       << " mapped " << numMapped_ << " external mapped " << numExternalMapped_
-      << std::endl;
+      << " numa arenas " << numaArenas_ << std::endl;
   for (auto& sizeClass : sizeClasses_) {
     out << sizeClass->toString() << std::endl;
   }
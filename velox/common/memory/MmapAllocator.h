@@ -75,6 +75,13 @@ class MmapAllocator : public MemoryAllocator {
     /// and 'smallAllocationReservePct' will be automatically set to 0
     /// disregarding any passed in value.
     int32_t maxMallocBytes = 3072;
+
+    /// Number of NUMA arenas each size class is divided into. Threads
+    /// allocate from the arena of their current NUMA node first, so that
+    /// with first touch placement the backing pages of an arena stay local
+    /// to the node that uses them. 0 means one arena per NUMA node of the
+    /// system, 1 disables the partitioning.
+    int32_t numaArenas = 0;
   };
 
   explicit MmapAllocator(const Options& options);
@@ -177,10 +184,13 @@ class MmapAllocator : public MemoryAllocator {
   static constexpr uint64_t kAllSet = 0xffffffffffffffff;
 
   // Represents a range of virtual addresses used for allocating entries of
-  // 'unitSize_' machine pages.
+  // 'unitSize_' machine pages. The page bitmap is divided into 'numArenas'
+  // equal ranges. An allocation prefers pages from the arena of the
+  // caller's NUMA node and falls over to the other arenas when the
+  // preferred one has no free pages.
   class SizeClass {
    public:
-    SizeClass(size_t capacity, MachinePageCount unitSize);
+    SizeClass(size_t capacity, MachinePageCount unitSize, int32_t numArenas);
 
     ~SizeClass();
 
@@ -190,11 +200,12 @@ class MmapAllocator : public MemoryAllocator {
 
     // Allocates 'numPages' from 'this' and appends these to *out.
     // '*numUnmapped' is incremented by the number of pages that are not backed
-    // by memory.
+    // by memory. 'arena' is the preferred NUMA arena of the caller.
     bool allocate(
         ClassPageCount numPages,
         MachinePageCount& numUnmapped,
-        Allocation& out);
+        Allocation& out,
+        int32_t arena);
 
     // Frees all pages of 'allocation' that fall in this size
     // class. Erases the corresponding runs from 'allocation'.
@@ -207,8 +218,8 @@ class MmapAllocator : public MemoryAllocator {
 
     // Advises away backing for 'numPages' worth of unallocated mapped class
     // pages. This needs to make an Allocation, for which it needs the
-    // containing MmapAllocator.
-    MachinePageCount adviseAway(MachinePageCount numPages);
+    // containing MmapAllocator. 'arena' is the NUMA arena of the caller.
+    MachinePageCount adviseAway(MachinePageCount numPages, int32_t arena);
 
     // Sets the mapped bits for the runs in 'allocation' to 'value' for the
     // addresses that fall in the range of 'this'
@@ -240,12 +251,27 @@ class MmapAllocator : public MemoryAllocator {
     bool allocateLocked(
         ClassPageCount numPages,
         MachinePageCount* numUnmapped,
-        Allocation& out);
+        Allocation& out,
+        int32_t arena);
+
+    // First word in 'pageAllocated_'/'pageMapped_' of the range of 'arena'.
+    int32_t arenaFirstWord(int32_t arena) const {
+      return arena * pageBitmapSize_ / numArenas_;
+    }
+
+    // The arena the bitmap word at 'word' belongs to.
+    int32_t wordArena(int32_t word) const {
+      return numArenas_ == 1
+          ? 0
+          : std::min<int64_t>(
+                static_cast<int64_t>(word) * numArenas_ / pageBitmapSize_,
+                numArenas_ - 1);
+    }
 
     // Returns the bit offset of the first bit of a 512 bit group in
     // 'pageAllocated_'/'pageMapped_'  that contains at least one mapped free
-    // page.
-    uint32_t findMappedFreeGroup();
+    // page. Starts the search in the range of 'arena'.
+    uint32_t findMappedFreeGroup(int32_t arena);
 
     // Returns a word of 256 bits with a set bit for each mapped free page in
     // the range. 'index' is an index of a word in
@@ -256,7 +282,10 @@ class MmapAllocator : public MemoryAllocator {
 
     // Adds 'numPages' mapped free pages of this size class to 'allocation'. May
     // only be called if 'mappedFreePages_' >= 'numPages'.
-    void allocateFromMappedFree(int32_t numPages, Allocation& allocation);
+    void allocateFromMappedFree(
+        int32_t numPages,
+        Allocation& allocation,
+        int32_t arena);
 
     // Marks that 'page' is free and mapped. Called when freeing the page.
     // 'page' is a page number iin this class.
@@ -277,7 +306,8 @@ class MmapAllocator : public MemoryAllocator {
         int32_t wordIndex,
         ClassPageCount& numPages,
         MachinePageCount& numUnmapped,
-        Allocation& allocation);
+        Allocation& allocation,
+        int32_t arena);
 
     // Number of size class pages. Number of valid bits in
     const uint64_t capacity_;
@@ -295,18 +325,26 @@ class MmapAllocator : public MemoryAllocator {
     // Serializes access to all data members and private methods.
     std::mutex mutex_;
 
+    // Number of NUMA arenas the bitmaps are divided into.
+    const int32_t numArenas_;
+
     // Start of address range.
     uint8_t* address_;
 
-    // Index of last modified word in 'pageAllocated_'. Sweeps over
-    // the bitmaps when looking for free pages.
-    int32_t clockHand_ = 0;
+    // Per arena index of last modified word in 'pageAllocated_'. Sweeps
+    // over the bitmaps when looking for free pages, starting in the
+    // arena's own range.
+    std::vector<int32_t> arenaClockHand_;
 
     // Count of free pages backed by memory.
     ClassPageCount numMappedFreePages_ = 0;
 
-    // Last used index in 'mappedFreeLookup_'.
-    int32_t lastLookupIndex_{kNoLastLookup};
+    // Per arena last used index in 'mappedFreeLookup_'.
+    std::vector<int32_t> arenaLookupIndex_;
+
+    // Count of class pages allocated from a word outside the caller's
+    // preferred arena.
+    uint64_t numCrossArenaPages_ = 0;
 
     // has a set bit if the corresponding 8 word range in
     // pageAllocated_/pageMapped_ has at least one mapped free bit. Contains 1
@@ -359,8 +397,15 @@ class MmapAllocator : public MemoryAllocator {
 
   bool useMalloc(uint64_t bytes);
 
+  // Returns the NUMA arena of the calling thread, i.e. the NUMA node of
+  // the cpu the thread currently runs on, modulo 'numaArenas_'.
+  int32_t currentArena() const;
+
   const Kind kind_;
 
+  // Number of NUMA arenas each size class is divided into.
+  const int32_t numaArenas_;
+
   // If set true, allocations larger than the largest size class size will be
   // delegated to ManagedMmapArena. Otherwise, a system mmap call will be
   // issued for each such allocation.
@@ -39,18 +39,22 @@ void SharedArbitrator::sortCandidatesByFreeCapacity(
 
 void SharedArbitrator::sortCandidatesByReclaimableMemory(
     std::vector<Candidate>& candidates) const {
-  std::sort(
-      candidates.begin(),
-      candidates.end(),
-      [](const Candidate& lhs, const Candidate& rhs) {
-        if (!lhs.reclaimable) {
-          return false;
-        }
-        if (!rhs.reclaimable) {
-          return true;
-        }
-        return lhs.reclaimableBytes > rhs.reclaimableBytes;
-      });
+  if (arbitrationPolicy_ != nullptr) {
+    arbitrationPolicy_->sortForReclaim(candidates);
+  } else {
+    std::sort(
+        candidates.begin(),
+        candidates.end(),
+        [](const Candidate& lhs, const Candidate& rhs) {
+          if (!lhs.reclaimable) {
+            return false;
+          }
+          if (!rhs.reclaimable) {
+            return true;
+          }
+          return lhs.reclaimableBytes > rhs.reclaimableBytes;
+        });
+  }
 
   TestValue::adjust(
       "facebook::velox::memory::SharedArbitrator::sortCandidatesByReclaimableMemory",
@@ -63,6 +67,9 @@ SharedArbitrator::findCandidateWithLargestCapacity(
     uint64_t targetBytes,
     const std::vector<Candidate>& candidates) const {
   VELOX_CHECK(!candidates.empty());
+  if (arbitrationPolicy_ != nullptr) {
+    return arbitrationPolicy_->selectVictim(requestor, targetBytes, candidates);
+  }
   int32_t candidateIdx{-1};
   int64_t maxCapacity{-1};
   for (int32_t i = 0; i < candidates.size(); ++i) {
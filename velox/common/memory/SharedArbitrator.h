@@ -45,12 +45,7 @@ class SharedArbitrator : public MemoryArbitrator {
   std::string toString() const final;
 
   // The candidate memory pool stats used by arbitration.
-  struct Candidate {
-    bool reclaimable{false};
-    uint64_t reclaimableBytes{0};
-    uint64_t freeBytes{0};
-    MemoryPool* pool;
-  };
+  using Candidate = MemoryArbitrator::Candidate;
 
  private:
   class ScopedArbitration {
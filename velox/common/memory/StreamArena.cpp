@@ -31,8 +31,10 @@ void StreamArena::newRange(int32_t bytes, ByteRange* range) {
       allocations_.push_back(
           std::make_unique<memory::Allocation>(std::move(allocation_)));
     }
-    pool_->allocateNonContiguous(
-        std::max(allocationQuantum_, numPages), allocation_);
+    if (!reuseFreeAllocation(numPages)) {
+      pool_->allocateNonContiguous(
+          std::max(allocationQuantum_, numPages), allocation_);
+    }
     currentRun_ = 0;
     currentPage_ = 0;
     size_ += allocation_.byteSize();
@@ -59,4 +61,38 @@ void StreamArena::newTinyRange(int32_t bytes, ByteRange* range) {
   range->size = bytes;
 }
 
+void StreamArena::clear() {
+  if (allocation_.numRuns() > 0) {
+    allocations_.push_back(
+        std::make_unique<memory::Allocation>(std::move(allocation_)));
+  }
+  for (auto& allocation : allocations_) {
+    freeAllocations_.push_back(std::move(allocation));
+  }
+  allocations_.clear();
+  std::sort(
+      freeAllocations_.begin(),
+      freeAllocations_.end(),
+      [](const auto& left, const auto& right) {
+        return left->numPages() < right->numPages();
+      });
+  currentRun_ = 0;
+  currentPage_ = 0;
+  size_ = 0;
+  tinyRanges_.clear();
+}
+
+bool StreamArena::reuseFreeAllocation(memory::MachinePageCount numPages) {
+  // 'freeAllocations_' is sorted by size, so the first fit is the
+  // smallest size class that satisfies the request.
+  for (auto it = freeAllocations_.begin(); it != freeAllocations_.end(); ++it) {
+    if ((*it)->numPages() >= numPages) {
+      allocation_ = std::move(**it);
+      freeAllocations_.erase(it);
+      return true;
+    }
+  }
+  return false;
+}
+
 } // namespace facebook::velox
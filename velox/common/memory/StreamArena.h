@@ -40,6 +40,13 @@ class StreamArena {
   // based on data properties, not for bulk data.
   virtual void newTinyRange(int32_t bytes, ByteRange* range);
 
+  // Resets the arena to empty, moving its Allocations to a freelist
+  // instead of returning them to the pool. Subsequent newRange() calls
+  // reuse freelisted Allocations of a sufficient size class, saving
+  // allocation cost when the same arena serializes many batches. The
+  // caller must no longer reference previously returned ranges.
+  void clear();
+
   // Returns the Total size in bytes held by all Allocations.
   virtual size_t size() const {
     return size_;
@@ -50,9 +57,15 @@ class StreamArena {
   }
 
  private:
+  // Makes 'allocation_' a freelisted Allocation with at least 'numPages'
+  // pages. Returns false if the freelist has no fit.
+  bool reuseFreeAllocation(memory::MachinePageCount numPages);
+
   memory::MemoryPool* const pool_;
   // All allocations.
   std::vector<std::unique_ptr<memory::Allocation>> allocations_;
+  // Allocations retained by clear() for reuse, smallest first.
+  std::vector<std::unique_ptr<memory::Allocation>> freeAllocations_;
   // The allocation from which pages are given out. Moved to 'allocations_' when
   // used up.
   memory::Allocation allocation_;
@@ -93,6 +93,78 @@ TEST_F(ByteStreamTest, outputStream) {
   EXPECT_EQ(0, mmapAllocator_->numAllocated());
 }
 
+TEST_F(ByteStreamTest, appendStringPieces) {
+  StreamArena arena(pool_.get());
+  ByteStream stream(&arena);
+  stream.startWrite(1024);
+  std::vector<std::string> data;
+  std::string expected;
+  for (auto i = 0; i < 100; ++i) {
+    data.push_back(std::string(10 + (i % 30), 'a' + (i % 26)));
+    expected += data.back();
+  }
+  std::vector<folly::StringPiece> pieces;
+  for (const auto& str : data) {
+    pieces.push_back(folly::StringPiece(str));
+  }
+  stream.appendStringPieces(folly::Range(pieces.data(), pieces.size()));
+  EXPECT_EQ(expected.size(), stream.size());
+  std::stringstream referenceSStream;
+  OStreamOutputStream out(&referenceSStream);
+  stream.flush(&out);
+  EXPECT_EQ(expected, referenceSStream.str());
+}
+
+TEST_F(ByteStreamTest, arenaRecycling) {
+  StreamArena arena(pool_.get());
+  const std::string data(200'000, 'x');
+  {
+    ByteStream stream(&arena);
+    stream.startWrite(100);
+    stream.appendStringPiece(folly::StringPiece(data));
+  }
+  const auto numAllocated = mmapAllocator_->numAllocated();
+  EXPECT_LT(0, numAllocated);
+  arena.clear();
+  EXPECT_EQ(0, arena.size());
+  // Cleared memory is kept in the freelist, not returned to the allocator.
+  EXPECT_EQ(numAllocated, mmapAllocator_->numAllocated());
+  {
+    ByteStream stream(&arena);
+    stream.startWrite(100);
+    stream.appendStringPiece(folly::StringPiece(data));
+  }
+  // The second round is served from the freelist.
+  EXPECT_EQ(numAllocated, mmapAllocator_->numAllocated());
+}
+
+TEST_F(ByteStreamTest, outputStreamSharedArena) {
+  // The pattern used to recycle repartitioning page memory: the caller
+  // keeps a reference to the arena and serializes the next page into it
+  // once the consumer has freed the IOBufs of the previous one.
+  auto arena = std::make_shared<StreamArena>(pool_.get());
+  const std::string data(200'000, 'x');
+
+  auto writePage = [&]() {
+    IOBufOutputStream out(arena, nullptr, 100);
+    out.write(data.data(), data.size());
+    return out.getIOBuf();
+  };
+
+  auto iobuf = writePage();
+  // The IOBufs share ownership of the arena.
+  EXPECT_LT(1, arena.use_count());
+  const auto numAllocated = mmapAllocator_->numAllocated();
+  EXPECT_LT(0, numAllocated);
+
+  iobuf = nullptr;
+  EXPECT_EQ(1, arena.use_count());
+  arena->clear();
+  // The next page reuses the freelisted memory of the previous one.
+  iobuf = writePage();
+  EXPECT_EQ(numAllocated, mmapAllocator_->numAllocated());
+}
+
 TEST_F(ByteStreamTest, resetInput) {
   uint8_t* const kFakeBuffer = reinterpret_cast<uint8_t*>(this);
   std::vector<ByteRange> byteRanges;
@@ -120,6 +120,86 @@ TEST_F(HashStringAllocatorTest, allocateLarge) {
   EXPECT_LE(instance_->retainedSize() - instance_->freeSpace(), 200);
 }
 
+TEST_F(HashStringAllocatorTest, clear) {
+  std::vector<HashStringAllocator::Header*> headers;
+  for (auto i = 0; i < 10'000; ++i) {
+    headers.push_back(allocate((i % 10) * 10));
+  }
+  EXPECT_GT(instance_->cumulativeBytes(), 0);
+  EXPECT_GT(instance_->retainedSize(), 0);
+  // clear() drops all the blocks at once without freeing them one at a
+  // time.
+  instance_->clear();
+  EXPECT_EQ(instance_->cumulativeBytes(), 0);
+  EXPECT_EQ(instance_->freeSpace(), 0);
+  instance_->checkConsistency();
+  // The allocator is ready for reuse after clear().
+  headers.clear();
+  for (auto i = 0; i < 100; ++i) {
+    headers.push_back(allocate(i * 10));
+  }
+  for (auto* header : headers) {
+    instance_->free(header);
+  }
+  instance_->checkConsistency();
+}
+
+TEST_F(HashStringAllocatorTest, freeStringViews) {
+  constexpr int32_t kNumStrings = 1'000;
+  std::vector<StringView> views(kNumStrings);
+  std::vector<std::string> references(kNumStrings);
+  auto group = reinterpret_cast<char*>(views.data());
+  for (auto i = 0; i < kNumStrings; ++i) {
+    // Mix inline strings in to check that the bulk free skips them.
+    references[i] = i % 7 == 0 ? std::string("inline") : randomString();
+    views[i] = StringView(references[i]);
+    instance_->copyMultipart(group, i * sizeof(StringView));
+  }
+  std::string storage;
+  for (auto i = 0; i < kNumStrings; ++i) {
+    EXPECT_EQ(
+        StringView(references[i]),
+        HashStringAllocator::contiguousString(views[i], storage));
+  }
+  instance_->free(folly::Range<const StringView*>(views.data(), kNumStrings));
+  instance_->checkConsistency();
+  // We allow for some free overhead for free lists after all is freed.
+  EXPECT_LE(instance_->retainedSize() - instance_->freeSpace(), 250);
+}
+
+TEST_F(HashStringAllocatorTest, stringPieceIterator) {
+  constexpr int32_t kNumStrings = 1'000;
+  std::vector<StringView> views(kNumStrings);
+  std::vector<std::string> references(kNumStrings);
+  auto group = reinterpret_cast<char*>(views.data());
+  for (auto i = 0; i < kNumStrings; ++i) {
+    references[i] = i % 7 == 0 ? std::string("inline") : randomString();
+    views[i] = StringView(references[i]);
+    instance_->copyMultipart(group, i * sizeof(StringView));
+  }
+  for (auto i = 0; i < kNumStrings; ++i) {
+    // Concatenating the pieces reproduces the string without going
+    // through contiguousString().
+    HashStringAllocator::StringPieceIterator pieces(views[i]);
+    std::string actual;
+    while (!pieces.atEnd()) {
+      auto piece = pieces.next();
+      EXPECT_GT(piece.size(), 0);
+      actual.append(piece.data(), piece.size());
+    }
+    EXPECT_EQ(references[i], actual);
+    if (!views[i].isInline()) {
+      // The first piece of a non-inline string points into the arena at
+      // the address in the view, i.e. reading it is zero copy.
+      EXPECT_EQ(
+          views[i].data(),
+          HashStringAllocator::StringPieceIterator(views[i]).next().data());
+    }
+  }
+  instance_->free(folly::Range<const StringView*>(views.data(), kNumStrings));
+  instance_->checkConsistency();
+}
+
 TEST_F(HashStringAllocatorTest, multipart) {
   constexpr int32_t kNumSamples = 10'000;
   std::vector<Multipart> data(kNumSamples);
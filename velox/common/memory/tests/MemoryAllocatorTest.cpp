@@ -405,6 +405,69 @@ TEST_P(MemoryAllocatorTest, mmapAllocatorInit) {
   }
 }
 
+TEST_P(MemoryAllocatorTest, numaArenas) {
+  if (!useMmap_) {
+    return;
+  }
+  MmapAllocator::Options options;
+  options.capacity = kCapacityBytes;
+  options.numaArenas = 4;
+  auto allocator = std::make_shared<MmapAllocator>(options);
+  EXPECT_NE(allocator->toString().find("numa arenas 4"), std::string::npos);
+
+  // Allocate, free every other allocation and reallocate so that both the
+  // never mapped and the mapped free paths are exercised with partitioned
+  // arenas. The arena partitioning must not affect what can be allocated.
+  constexpr int32_t kNumAllocations = 50;
+  std::vector<Allocation> allocations(kNumAllocations);
+  for (auto repeat = 0; repeat < 3; ++repeat) {
+    for (auto i = 0; i < kNumAllocations; ++i) {
+      ASSERT_TRUE(allocator->allocateNonContiguous(64 + i, allocations[i]));
+    }
+    EXPECT_TRUE(allocator->checkConsistency());
+    for (auto i = 0; i < kNumAllocations; i += 2) {
+      allocator->freeNonContiguous(allocations[i]);
+    }
+    EXPECT_TRUE(allocator->checkConsistency());
+    for (auto i = 1; i < kNumAllocations; i += 2) {
+      allocator->freeNonContiguous(allocations[i]);
+    }
+  }
+  EXPECT_TRUE(allocator->checkConsistency());
+  EXPECT_EQ(allocator->numAllocated(), 0);
+}
+
+TEST(ThreadAllocationCacheTest, roundTrip) {
+  ThreadAllocationCache::flush();
+  MallocAllocator mallocAllocator;
+  MemoryAllocator& allocator = mallocAllocator;
+
+  // A free of a power of two size goes to the thread cache and the next
+  // allocation of the size pops the same block.
+  auto* block = allocator.allocateBytes(256);
+  allocator.freeBytes(block, 256);
+  EXPECT_EQ(ThreadAllocationCache::cachedBytes(), 256);
+  EXPECT_EQ(allocator.allocateBytes(256), block);
+  EXPECT_EQ(ThreadAllocationCache::cachedBytes(), 0);
+
+  // Odd sizes are not cached.
+  auto* oddBlock = allocator.allocateBytes(100);
+  allocator.freeBytes(oddBlock, 100);
+  EXPECT_EQ(ThreadAllocationCache::cachedBytes(), 0);
+
+  // Aligned allocations bypass the cache.
+  allocator.freeBytes(block, 256);
+  auto* alignedBlock = allocator.allocateBytes(256, 64);
+  EXPECT_NE(alignedBlock, block);
+  allocator.freeBytes(alignedBlock, 256);
+  EXPECT_EQ(ThreadAllocationCache::cachedBytes(), 512);
+
+  ThreadAllocationCache::flush();
+  EXPECT_EQ(ThreadAllocationCache::cachedBytes(), 0);
+  // Cached blocks count as freed in the allocator.
+  EXPECT_TRUE(allocator.checkConsistency());
+}
+
 TEST_P(MemoryAllocatorTest, allocationPool) {
   const size_t kNumLargeAllocPages = instance_->largestSizeClass() * 2;
   AllocationPool pool(pool_.get());
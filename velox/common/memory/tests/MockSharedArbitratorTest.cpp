@@ -343,6 +343,55 @@ MockQuery::~MockQuery() {
   }
 }
 
+// Test arbitration policy which reclaims from and aborts the candidate with
+// the lowest priority first, mimicking a deployment where batch queries
+// yield to interactive ones. Candidates without an assigned priority are
+// treated as having the highest priority.
+class PriorityArbitrationPolicy : public ArbitrationPolicy {
+ public:
+  void setPriority(const MemoryPool* pool, int32_t priority) {
+    priorities_[pool] = priority;
+  }
+
+  void sortForReclaim(
+      std::vector<MemoryArbitrator::Candidate>& candidates) const override {
+    std::sort(
+        candidates.begin(),
+        candidates.end(),
+        [&](const MemoryArbitrator::Candidate& lhs,
+            const MemoryArbitrator::Candidate& rhs) {
+          if (lhs.reclaimable != rhs.reclaimable) {
+            return lhs.reclaimable;
+          }
+          return priority(lhs.pool) < priority(rhs.pool);
+        });
+  }
+
+  const MemoryArbitrator::Candidate& selectVictim(
+      const MemoryPool* /*unused*/,
+      uint64_t /*unused*/,
+      const std::vector<MemoryArbitrator::Candidate>& candidates)
+      const override {
+    int32_t victimIdx{0};
+    for (auto i = 1; i < candidates.size(); ++i) {
+      if (priority(candidates[i].pool) <
+          priority(candidates[victimIdx].pool)) {
+        victimIdx = i;
+      }
+    }
+    return candidates[victimIdx];
+  }
+
+ private:
+  int32_t priority(const MemoryPool* pool) const {
+    const auto it = priorities_.find(pool);
+    return it == priorities_.end() ? std::numeric_limits<int32_t>::max()
+                                   : it->second;
+  }
+
+  std::unordered_map<const MemoryPool*, int32_t> priorities_;
+};
+
 class MockSharedArbitrationTest : public testing::Test {
  protected:
   static void SetUpTestCase() {
@@ -362,7 +411,8 @@ class MockSharedArbitrationTest : public testing::Test {
       int64_t memoryCapacity = 0,
       uint64_t initMemoryPoolCapacity = kMaxMemory,
       uint64_t minMemoryPoolCapacityTransferSize = 0,
-      bool retryArbitrationFailure = true) {
+      bool retryArbitrationFailure = true,
+      std::shared_ptr<ArbitrationPolicy> arbitrationPolicy = nullptr) {
     if (initMemoryPoolCapacity == kMaxMemory) {
       initMemoryPoolCapacity = kInitMemoryPoolCapacity;
     }
@@ -376,7 +426,8 @@ class MockSharedArbitrationTest : public testing::Test {
         .capacity = options.capacity,
         .initMemoryPoolCapacity = initMemoryPoolCapacity,
         .minMemoryPoolCapacityTransferSize = minMemoryPoolCapacityTransferSize,
-        .retryArbitrationFailure = retryArbitrationFailure};
+        .retryArbitrationFailure = retryArbitrationFailure,
+        .arbitrationPolicy = std::move(arbitrationPolicy)};
     options.checkUsageLeak = true;
     manager_ = std::make_unique<MemoryManager>(options);
     ASSERT_EQ(manager_->arbitrator()->kind(), MemoryArbitrator::Kind::kShared);
@@ -635,6 +686,65 @@ TEST_F(MockSharedArbitrationTest, arbitrateWithMemoryReclaim) {
   }
 }
 
+TEST_F(MockSharedArbitrationTest, arbitrationPolicyReclaimOrder) {
+  const uint64_t memoryCapacity = 256 * MB;
+  const uint64_t minPoolCapacity = 8 * MB;
+  auto policy = std::make_shared<PriorityArbitrationPolicy>();
+  setupMemory(memoryCapacity, minPoolCapacity, 0, true, policy);
+  auto* batchOp = addMemoryOp();
+  auto* interactiveOp = addMemoryOp();
+  policy->setPriority(batchOp->pool()->root(), 0);
+  policy->setPriority(interactiveOp->pool()->root(), 1);
+  const int allocateSize = 8 * MB;
+  // The interactive query ends up with much more reclaimable memory than
+  // the batch query so the default policy would reclaim from it first.
+  for (int i = 0; i < 4; ++i) {
+    batchOp->allocate(allocateSize);
+  }
+  while (arbitrator_->stats().freeCapacityBytes > 0) {
+    interactiveOp->allocate(allocateSize);
+  }
+  ASSERT_GT(
+      interactiveOp->pool()->currentBytes(), batchOp->pool()->currentBytes());
+
+  auto* arbitrateOp = addMemoryOp();
+  arbitrateOp->allocate(allocateSize);
+
+  // The policy directs the reclaim to the low priority batch query.
+  ASSERT_EQ(batchOp->reclaimer()->stats().numReclaims, 1);
+  ASSERT_EQ(interactiveOp->reclaimer()->stats().numReclaims, 0);
+  ASSERT_GT(arbitrator_->stats().numReclaimedBytes, 0);
+}
+
+TEST_F(MockSharedArbitrationTest, arbitrationPolicyVictimSelection) {
+  const uint64_t memoryCapacity = 256 * MB;
+  const uint64_t minPoolCapacity = 8 * MB;
+  auto policy = std::make_shared<PriorityArbitrationPolicy>();
+  setupMemory(memoryCapacity, minPoolCapacity, 0, true, policy);
+  // Make both queries non-reclaimable so that the arbitration failure has
+  // to abort a victim query.
+  auto* bestEffortOp = addMemoryOp(nullptr, false);
+  auto* interactiveOp = addMemoryOp(nullptr, false);
+  policy->setPriority(bestEffortOp->pool()->root(), 0);
+  policy->setPriority(interactiveOp->pool()->root(), 1);
+  const int allocateSize = 8 * MB;
+  for (int i = 0; i < 4; ++i) {
+    bestEffortOp->allocate(allocateSize);
+  }
+  while (arbitrator_->stats().freeCapacityBytes > 0) {
+    interactiveOp->allocate(allocateSize);
+  }
+
+  auto* arbitrateOp = addMemoryOp();
+  arbitrateOp->allocate(allocateSize);
+
+  // The interactive query has the largest capacity but the policy aborts
+  // the best-effort query instead.
+  ASSERT_TRUE(bestEffortOp->pool()->root()->aborted());
+  ASSERT_FALSE(interactiveOp->pool()->root()->aborted());
+  ASSERT_EQ(arbitrator_->stats().numAborted, 1);
+}
+
 TEST_F(MockSharedArbitrationTest, arbitrateBySelfMemoryReclaim) {
   const std::vector<bool> isLeafReclaimables = {true, false};
   for (const auto isLeafReclaimable : isLeafReclaimables) {
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/process/PerfEventCounters.h"
+
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace facebook::velox::process {
+
+namespace {
+// Typical line size of x86 and most arm64 data caches. Used to convert LLC
+// misses into estimated memory traffic.
+constexpr uint64_t kCacheLineSize = 64;
+
+#ifdef __linux__
+int openCounter(uint32_t type, uint64_t config) {
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.type = type;
+  attr.size = sizeof(attr);
+  attr.config = config;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  return static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+#endif
+} // namespace
+
+PerfEventCounters::PerfEventCounters() {
+#ifdef __linux__
+  llcMissesFd_ = openCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+#endif
+}
+
+PerfEventCounters::~PerfEventCounters() {
+#ifdef __linux__
+  if (llcMissesFd_ >= 0) {
+    ::close(llcMissesFd_);
+  }
+#endif
+}
+
+// static
+PerfEventCounters* PerfEventCounters::threadLocalInstance() {
+  thread_local PerfEventCounters counters;
+  return counters.llcMissesFd_ >= 0 ? &counters : nullptr;
+}
+
+void PerfEventCounters::start() {
+#ifdef __linux__
+  ::ioctl(llcMissesFd_, PERF_EVENT_IOC_RESET, 0);
+  ::ioctl(llcMissesFd_, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+}
+
+PerfEventCounters::Counts PerfEventCounters::stop() {
+  Counts counts;
+#ifdef __linux__
+  ::ioctl(llcMissesFd_, PERF_EVENT_IOC_DISABLE, 0);
+  uint64_t value = 0;
+  if (::read(llcMissesFd_, &value, sizeof(value)) == sizeof(value)) {
+    counts.llcMisses = value;
+    counts.memoryBytes = value * kCacheLineSize;
+  }
+#endif
+  return counts;
+}
+
+} // namespace facebook::velox::process
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace facebook::velox::process {
+
+/// Per-thread hardware counter group measuring last-level cache misses of
+/// the calling thread via perf_event_open. An LLC miss is served from memory,
+/// so misses multiplied by the cache line size give a close proxy for DRAM
+/// read bandwidth without the privileged, per-socket uncore counters.
+///
+/// Counters cover user-space execution of the owning thread only. The class
+/// degrades to a no-op when perf events are unavailable, e.g. on non-Linux
+/// hosts or in containers that deny perf_event_open.
+class PerfEventCounters {
+ public:
+  struct Counts {
+    /// Last-level cache misses during the measured region.
+    uint64_t llcMisses{0};
+
+    /// Estimated bytes moved from memory: llcMisses times the cache line
+    /// size.
+    uint64_t memoryBytes{0};
+  };
+
+  ~PerfEventCounters();
+
+  /// Returns the calling thread's counter group, opening the counters on
+  /// first use. Returns nullptr if the counters cannot be opened.
+  static PerfEventCounters* threadLocalInstance();
+
+  /// Resets and enables the counters.
+  void start();
+
+  /// Disables the counters and returns the counts accumulated since the
+  /// matching start().
+  Counts stop();
+
+ private:
+  PerfEventCounters();
+
+  int llcMissesFd_{-1};
+};
+
+} // namespace facebook::velox::process
@@ -21,6 +21,7 @@
 #include "velox/common/future/VeloxPromise.h"
 #include "velox/core/ExpressionEvaluator.h"
 #include "velox/vector/ComplexVector.h"
+#include "velox/vector/StringAlphabetInterner.h"
 
 #include <folly/Synchronized.h>
 
@@ -211,7 +212,8 @@ class ConnectorQueryCtx {
       memory::MemoryAllocator* FOLLY_NONNULL allocator,
       const std::string& taskId,
       const std::string& planNodeId,
-      int driverId)
+      int driverId,
+      std::shared_ptr<StringAlphabetInterner> stringAlphabetInterner = nullptr)
       : operatorPool_(operatorPool),
         connectorPool_(connectorPool),
         config_(connectorConfig),
@@ -219,7 +221,8 @@ class ConnectorQueryCtx {
         allocator_(allocator),
         scanId_(fmt::format("{}.{}", taskId, planNodeId)),
         taskId_(taskId),
-        driverId_(driverId) {}
+        driverId_(driverId),
+        stringAlphabetInterner_(std::move(stringAlphabetInterner)) {}
 
   /// Returns the associated operator's memory pool which is a leaf kind of
   /// memory pool, used for direct memory allocation use.
@@ -264,6 +267,13 @@ class ConnectorQueryCtx {
     return driverId_;
   }
 
+  // The query-wide string alphabet interning pool or nullptr if disabled.
+  // See QueryConfig::kStringAlphabetInterningBytes.
+  const std::shared_ptr<StringAlphabetInterner>& stringAlphabetInterner()
+      const {
+    return stringAlphabetInterner_;
+  }
+
  private:
   memory::MemoryPool* operatorPool_;
   memory::MemoryPool* connectorPool_;
@@ -273,6 +283,7 @@ class ConnectorQueryCtx {
   const std::string scanId_;
   const std::string taskId_;
   const int driverId_;
+  std::shared_ptr<StringAlphabetInterner> stringAlphabetInterner_;
 };
 
 class Connector {
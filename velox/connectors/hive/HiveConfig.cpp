@@ -124,4 +124,19 @@ std::optional<std::string> HiveConfig::s3IAMRole(const Config* config) {
 std::string HiveConfig::s3IAMRoleSessionName(const Config* config) {
   return config->get(kS3IamRoleSessionName, std::string("velox-session"));
 }
+
+// static
+uint32_t HiveConfig::s3MaxConnections(const Config* config) {
+  return config->get<uint32_t>(kS3MaxConnections, 25);
+}
+
+// static
+uint32_t HiveConfig::s3ParallelReadConcurrency(const Config* config) {
+  return config->get<uint32_t>(kS3ParallelReadConcurrency, 1);
+}
+
+// static
+bool HiveConfig::s3RequestHedgingEnabled(const Config* config) {
+  return config->get<bool>(kS3RequestHedgingEnabled, false);
+}
 } // namespace facebook::velox::connector::hive
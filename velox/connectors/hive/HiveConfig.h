@@ -79,6 +79,21 @@ class HiveConfig {
   static constexpr const char* kS3IamRoleSessionName =
       "hive.s3.iam-role-session-name";
 
+  /// Maximum number of concurrent connections of the S3 http client. The
+  /// connections are pooled and reused across requests.
+  static constexpr const char* kS3MaxConnections = "hive.s3.max-connections";
+
+  /// Number of concurrent sub-range GET requests issued for a single large
+  /// read. A value of 1 disables parallel sub-range fetching.
+  static constexpr const char* kS3ParallelReadConcurrency =
+      "hive.s3.parallel-read-concurrency";
+
+  /// Issue a duplicate GET request when a read has been outstanding longer
+  /// than the p99 latency of recent requests and use whichever response
+  /// arrives first.
+  static constexpr const char* kS3RequestHedgingEnabled =
+      "hive.s3.request-hedging-enabled";
+
   static InsertExistingPartitionsBehavior insertExistingPartitionsBehavior(
       const Config* config);
 
@@ -103,6 +118,12 @@ class HiveConfig {
   static std::optional<std::string> s3IAMRole(const Config* config);
 
   static std::string s3IAMRoleSessionName(const Config* config);
+
+  static uint32_t s3MaxConnections(const Config* config);
+
+  static uint32_t s3ParallelReadConcurrency(const Config* config);
+
+  static bool s3RequestHedgingEnabled(const Config* config);
 };
 
 } // namespace facebook::velox::connector::hive
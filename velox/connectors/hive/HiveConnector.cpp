@@ -32,6 +32,20 @@ DEFINE_int32(
     20'000,
     "Max number of file handles to cache.");
 
+DEFINE_int32(
+    file_handle_cache_ttl_ms,
+    0,
+    "Time in milliseconds after which a cached file handle expires and is "
+    "evicted. 0 means file handles never expire.");
+
+DEFINE_bool(
+    hive_async_cold_reads,
+    false,
+    "Run the first read of each split on the connector's IO executor and "
+    "hand the driver a future instead of blocking its thread on cold "
+    "storage reads. Requires the hive connector to be created with an IO "
+    "executor.");
+
 namespace facebook::velox::connector::hive {
 namespace {
 static const char* kPath = "$path";
@@ -325,6 +339,163 @@ void addSubfields(
   }
 }
 
+// Widens a map key filter planned by addSubfields to also accept
+// 'element'.  Returns nullptr if the combined key set cannot be
+// represented, in which case the caller drops the filter and all keys
+// are read.
+std::unique_ptr<common::Filter> widenMapKeyFilter(
+    const common::Filter* filter,
+    const common::Subfield::PathElement* element) {
+  if (auto* subscript =
+          dynamic_cast<const common::Subfield::LongSubscript*>(element)) {
+    std::vector<int64_t> values;
+    if (auto* range = dynamic_cast<const common::BigintRange*>(filter)) {
+      if (!range->isSingleValue()) {
+        return nullptr;
+      }
+      values.push_back(range->lower());
+    } else if (
+        auto* hashed =
+            dynamic_cast<const common::BigintValuesUsingHashTable*>(filter)) {
+      values = hashed->values();
+    } else if (
+        auto* bitmask =
+            dynamic_cast<const common::BigintValuesUsingBitmask*>(filter)) {
+      values = bitmask->values();
+    } else {
+      return nullptr;
+    }
+    values.push_back(subscript->index());
+    return common::createBigintValues(values, false);
+  }
+  if (auto* subscript =
+          dynamic_cast<const common::Subfield::StringSubscript*>(element)) {
+    auto* bytes = dynamic_cast<const common::BytesValues*>(filter);
+    if (!bytes) {
+      return nullptr;
+    }
+    std::vector<std::string> values(
+        bytes->values().begin(), bytes->values().end());
+    values.push_back(subscript->index());
+    return std::make_unique<common::BytesValues>(values, false);
+  }
+  return nullptr;
+}
+
+// Clears the pruning planned into 'spec' so that everything under it
+// is read.
+void widenAllSubfields(const Type& type, common::ScanSpec& spec) {
+  if (spec.isConstant()) {
+    spec.setConstantValue(nullptr);
+  }
+  if (spec.children().empty()) {
+    spec.addAllChildFields(type);
+    return;
+  }
+  switch (type.kind()) {
+    case TypeKind::ROW: {
+      auto& rowType = type.asRow();
+      for (int i = 0; i < rowType.size(); ++i) {
+        if (auto* child = spec.childByName(rowType.nameOf(i))) {
+          widenAllSubfields(*rowType.childAt(i), *child);
+        } else {
+          spec.addFieldRecursively(rowType.nameOf(i), *rowType.childAt(i), i);
+        }
+      }
+      break;
+    }
+    case TypeKind::MAP:
+      spec.childByName(common::ScanSpec::kMapKeysFieldName)
+          ->setFilter(nullptr);
+      widenAllSubfields(
+          *type.childAt(1),
+          *spec.childByName(common::ScanSpec::kMapValuesFieldName));
+      break;
+    case TypeKind::ARRAY:
+      spec.setMaxArrayElementsCount(
+          std::numeric_limits<vector_size_t>::max());
+      widenAllSubfields(
+          *type.childAt(0),
+          *spec.childByName(common::ScanSpec::kArrayElementsFieldName));
+      break;
+    default:
+      break;
+  }
+}
+
+// Widens 'spec' so that 'subfield' is read in addition to the
+// subfields planned at data source creation.  'level' indexes the path
+// element of 'subfield' that applies to the children of 'spec'.
+void widenSubfield(
+    const Type& type,
+    const common::Subfield& subfield,
+    int level,
+    common::ScanSpec& spec) {
+  if (level == subfield.path().size() || spec.isConstant()) {
+    // Either the end of the path is reached or the whole subtree was
+    // pruned away at planning time and there are no specs below to
+    // narrow the read. Read the subtree in whole.
+    widenAllSubfields(type, spec);
+    return;
+  }
+  auto* element = subfield.path()[level].get();
+  switch (type.kind()) {
+    case TypeKind::ROW: {
+      auto* nestedField =
+          dynamic_cast<const common::Subfield::NestedField*>(element);
+      VELOX_CHECK(
+          nestedField,
+          "Unsupported for row subfields widening: {}",
+          element->toString());
+      auto& rowType = type.asRow();
+      auto childIdx = rowType.getChildIdx(nestedField->name());
+      auto* child = spec.childByName(nestedField->name());
+      VELOX_CHECK_NOT_NULL(child);
+      widenSubfield(*rowType.childAt(childIdx), subfield, level + 1, *child);
+      break;
+    }
+    case TypeKind::MAP: {
+      auto* keys = spec.childByName(common::ScanSpec::kMapKeysFieldName);
+      VELOX_CHECK_NOT_NULL(keys);
+      if (keys->filter() != nullptr) {
+        if (dynamic_cast<const common::Subfield::AllSubscripts*>(element)) {
+          keys->setFilter(nullptr);
+        } else {
+          keys->setFilter(widenMapKeyFilter(keys->filter(), element));
+        }
+      }
+      widenSubfield(
+          *type.childAt(1),
+          subfield,
+          level + 1,
+          *spec.childByName(common::ScanSpec::kMapValuesFieldName));
+      break;
+    }
+    case TypeKind::ARRAY: {
+      constexpr long kMaxIndex = std::numeric_limits<vector_size_t>::max();
+      auto* subscript =
+          dynamic_cast<const common::Subfield::LongSubscript*>(element);
+      if (subscript != nullptr &&
+          spec.maxArrayElementsCount() < kMaxIndex) {
+        spec.setMaxArrayElementsCount(std::max<long>(
+            spec.maxArrayElementsCount(),
+            std::min(kMaxIndex, subscript->index())));
+      } else {
+        spec.setMaxArrayElementsCount(kMaxIndex);
+      }
+      widenSubfield(
+          *type.childAt(0),
+          subfield,
+          level + 1,
+          *spec.childByName(common::ScanSpec::kArrayElementsFieldName));
+      break;
+    }
+    default:
+      VELOX_FAIL(
+          "Subfields widening not supported on type {}", type.toString());
+  }
+}
+
 } // namespace
 
 std::shared_ptr<common::ScanSpec> HiveDataSource::makeScanSpec(
@@ -396,7 +567,8 @@ HiveDataSource::HiveDataSource(
     core::ExpressionEvaluator* expressionEvaluator,
     memory::MemoryAllocator* allocator,
     const std::string& scanId,
-    folly::Executor* executor)
+    folly::Executor* executor,
+    std::shared_ptr<StringAlphabetInterner> stringAlphabetInterner)
     : fileHandleFactory_(fileHandleFactory),
       readerOpts_(pool),
       pool_(pool),
@@ -404,7 +576,8 @@ HiveDataSource::HiveDataSource(
       expressionEvaluator_(expressionEvaluator),
       allocator_(allocator),
       scanId_(scanId),
-      executor_(executor) {
+      executor_(executor),
+      stringAlphabetInterner_(std::move(stringAlphabetInterner)) {
   // Column handled keyed on the column alias, the name used in the query.
   for (const auto& [canonicalizedName, columnHandle] : columnHandles) {
     auto handle = std::dynamic_pointer_cast<HiveColumnHandle>(columnHandle);
@@ -599,6 +772,24 @@ void HiveDataSource::addDynamicFilter(
   }
 }
 
+// static
+void HiveDataSource::widenScanSpec(
+    const Type& type,
+    const common::Subfield& subfield,
+    common::ScanSpec& spec) {
+  VELOX_CHECK_GT(subfield.path().size(), 0);
+  widenSubfield(type, subfield, 1, spec);
+}
+
+void HiveDataSource::addRequiredSubfield(
+    column_index_t outputChannel,
+    const common::Subfield& subfield) {
+  auto& fieldSpec = scanSpec_->getChildByChannel(outputChannel);
+  widenScanSpec(
+      *readerOutputType_->childAt(outputChannel), subfield, fieldSpec);
+  scanSpec_->resetCachedValues(false);
+}
+
 std::unique_ptr<dwio::common::BufferedInput>
 HiveDataSource::createBufferedInput(
     const FileHandle& fileHandle,
@@ -641,6 +832,7 @@ void HiveDataSource::configureRowReaderOptions(
         reader_->rowType(), columnNames);
   }
   options.select(cs).range(split_->start, split_->length);
+  options.setStringAlphabetInterner(stringAlphabetInterner_);
 }
 
 void HiveDataSource::addSplit(std::shared_ptr<ConnectorSplit> split) {
@@ -652,6 +844,8 @@ void HiveDataSource::addSplit(std::shared_ptr<ConnectorSplit> split) {
 
   VLOG(1) << "Adding split " << split_->toString();
 
+  firstReadOfSplit_ = true;
+
   fileHandle_ = fileHandleFactory_->generate(split_->filePath).second;
   auto input = createBufferedInput(*fileHandle_, readerOpts_);
 
@@ -761,7 +955,7 @@ void HiveDataSource::setFromDataSource(
 
 std::optional<RowVectorPtr> HiveDataSource::next(
     uint64_t size,
-    velox::ContinueFuture& /*future*/) {
+    velox::ContinueFuture& future) {
   VELOX_CHECK(split_ != nullptr, "No split to process. Call addSplit first.");
   if (emptySplit_) {
     resetSplit();
@@ -776,7 +970,44 @@ std::optional<RowVectorPtr> HiveDataSource::next(
   // column, e.g. rand() < 0.1. Evaluate that conjunct first, then scan only
   // rows that passed.
 
-  auto rowsScanned = readNext(size);
+  uint64_t rowsScanned;
+  if (asyncReadInFlight_) {
+    // Pick up the result of the read offloaded to the IO executor. The
+    // future handed to the driver is realized after the baton is posted, so
+    // this does not block in practice.
+    asyncReadBaton_.wait();
+    asyncReadBaton_.reset();
+    asyncReadInFlight_ = false;
+    if (asyncReadResult_.error) {
+      std::rethrow_exception(asyncReadResult_.error);
+    }
+    rowsScanned = asyncReadResult_.rowsScanned;
+  } else if (
+      FLAGS_hive_async_cold_reads && executor_ != nullptr &&
+      firstReadOfSplit_) {
+    // The first read of a split pays for the footer IO and the first stripe
+    // load. Run it on the IO executor and park the driver instead of
+    // blocking its thread on cold storage.
+    firstReadOfSplit_ = false;
+    auto [readPromise, readFuture] =
+        makeVeloxContinuePromiseContract("HiveDataSource::next");
+    asyncReadInFlight_ = true;
+    executor_->add([this, size, promise = std::move(readPromise)]() mutable {
+      try {
+        asyncReadResult_.rowsScanned = readNext(size);
+        asyncReadResult_.error = nullptr;
+      } catch (...) {
+        asyncReadResult_.error = std::current_exception();
+      }
+      asyncReadBaton_.post();
+      promise.setValue();
+    });
+    future = std::move(readFuture);
+    return std::nullopt;
+  } else {
+    firstReadOfSplit_ = false;
+    rowsScanned = readNext(size);
+  }
   completedRows_ += rowsScanned;
 
   if (rowsScanned) {
@@ -874,7 +1105,8 @@ void HiveDataSource::setPartitionValue(
 std::unordered_map<std::string, RuntimeCounter> HiveDataSource::runtimeStats() {
   auto res = runtimeStats_.toMap();
   res.insert(
-      {{"numPrefetch", RuntimeCounter(ioStats_->prefetch().count())},
+      {{"filterReorders", RuntimeCounter(scanSpec_->numAdaptiveReorders())},
+       {"numPrefetch", RuntimeCounter(ioStats_->prefetch().count())},
        {"prefetchBytes",
         RuntimeCounter(
             ioStats_->prefetch().sum(), RuntimeCounter::Unit::kBytes)},
@@ -922,7 +1154,9 @@ HiveConnector::HiveConnector(
       fileHandleFactory_(
           std::make_unique<
               SimpleLRUCache<std::string, std::shared_ptr<FileHandle>>>(
-              FLAGS_num_file_handle_cache),
+              FLAGS_num_file_handle_cache,
+              1,
+              std::chrono::milliseconds(FLAGS_file_handle_cache_ttl_ms)),
           std::make_unique<FileHandleGenerator>(std::move(properties))),
       executor_(executor) {}
 
@@ -15,6 +15,8 @@
  */
 #pragma once
 
+#include <folly/synchronization/Baton.h>
+
 #include "velox/connectors/hive/FileHandle.h"
 #include "velox/connectors/hive/HiveConnectorSplit.h"
 #include "velox/connectors/hive/HiveDataSink.h"
@@ -156,7 +158,16 @@ class HiveDataSource : public DataSource {
       core::ExpressionEvaluator* expressionEvaluator,
       memory::MemoryAllocator* allocator,
       const std::string& scanId,
-      folly::Executor* executor);
+      folly::Executor* executor,
+      std::shared_ptr<StringAlphabetInterner> stringAlphabetInterner =
+          nullptr);
+
+  ~HiveDataSource() override {
+    if (asyncReadInFlight_) {
+      // Block until the read offloaded to 'executor_' stops using 'this'.
+      asyncReadBaton_.wait();
+    }
+  }
 
   void addSplit(std::shared_ptr<ConnectorSplit> split) override;
 
@@ -164,6 +175,18 @@ class HiveDataSource : public DataSource {
       column_index_t outputChannel,
       const std::shared_ptr<common::Filter>& filter) override;
 
+  /// Widens the scan to read 'subfield' of the column at 'outputChannel' in
+  /// addition to the subfields requested at data source creation. Lets plans
+  /// start with a tight set of required subfields and add conditionally
+  /// accessed ones when lazy loads reveal they are needed, instead of
+  /// over-provisioning up front. Pruned struct children are un-pruned and map
+  /// key filters and array element limits are relaxed along the path. Takes
+  /// effect when the reader tree is next rebuilt, i.e. at the next stripe or
+  /// split; rows already read are not affected.
+  void addRequiredSubfield(
+      column_index_t outputChannel,
+      const common::Subfield& subfield);
+
   std::optional<RowVectorPtr> next(uint64_t size, velox::ContinueFuture& future)
       override;
 
@@ -194,6 +217,14 @@ class HiveDataSource : public DataSource {
       const std::vector<common::Subfield>& remainingFilterInputs,
       memory::MemoryPool* pool);
 
+  // Internal API, made public to be accessible in unit tests.  Widens
+  // 'spec', which reads a column of 'type', so that 'subfield' is read in
+  // addition to the subfields planned into it by makeScanSpec.
+  static void widenScanSpec(
+      const Type& type,
+      const common::Subfield& subfield,
+      common::ScanSpec& spec);
+
  protected:
   virtual uint64_t readNext(uint64_t size) {
     return rowReader_->next(size, output_);
@@ -270,6 +301,25 @@ class HiveDataSource : public DataSource {
   memory::MemoryAllocator* const allocator_;
   const std::string& scanId_;
   folly::Executor* executor_;
+  std::shared_ptr<StringAlphabetInterner> stringAlphabetInterner_;
+
+  // Set by addSplit(), cleared by the first read of the split. The first
+  // read pays for the footer IO and the first stripe load and is the one
+  // offloaded to 'executor_' when --hive_async_cold_reads is set.
+  bool firstReadOfSplit_ = false;
+
+  // Outcome of a readNext() call offloaded to 'executor_'. Consumed by the
+  // next call to next() after the future handed to the driver is realized.
+  struct AsyncReadResult {
+    uint64_t rowsScanned{0};
+    std::exception_ptr error;
+  };
+
+  AsyncReadResult asyncReadResult_;
+  bool asyncReadInFlight_ = false;
+
+  // Posted when the offloaded read is done using 'this'.
+  folly::Baton<> asyncReadBaton_;
 };
 
 class HiveConnector : public Connector {
@@ -299,7 +349,8 @@ class HiveConnector : public Connector {
         connectorQueryCtx->expressionEvaluator(),
         connectorQueryCtx->allocator(),
         connectorQueryCtx->scanId(),
-        executor_);
+        executor_,
+        connectorQueryCtx->stringAlphabetInterner());
   }
 
   bool supportsSplitPreload() override {
@@ -316,7 +367,11 @@ class HiveConnector : public Connector {
     VELOX_CHECK_NOT_NULL(
         hiveInsertHandle, "Hive connector expecting hive write handle!");
     return std::make_unique<HiveDataSink>(
-        inputType, hiveInsertHandle, connectorQueryCtx, commitStrategy);
+        inputType,
+        hiveInsertHandle,
+        connectorQueryCtx,
+        commitStrategy,
+        executor_);
   }
 
   folly::Executor* FOLLY_NULLABLE executor() const override {
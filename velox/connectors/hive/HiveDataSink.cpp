@@ -24,6 +24,7 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
+#include <folly/futures/Future.h>
 
 namespace facebook::velox::connector::hive {
 
@@ -91,11 +92,13 @@ HiveDataSink::HiveDataSink(
     RowTypePtr inputType,
     std::shared_ptr<const HiveInsertTableHandle> insertTableHandle,
     const ConnectorQueryCtx* connectorQueryCtx,
-    CommitStrategy commitStrategy)
+    CommitStrategy commitStrategy,
+    folly::Executor* FOLLY_NULLABLE writeExecutor)
     : inputType_(std::move(inputType)),
       insertTableHandle_(std::move(insertTableHandle)),
       connectorQueryCtx_(connectorQueryCtx),
       commitStrategy_(commitStrategy),
+      writeExecutor_(writeExecutor),
       partitionChannels_(getPartitionChannels(insertTableHandle_)),
       partitionIdGenerator_(
           !partitionChannels_.empty() ? std::make_unique<PartitionIdGenerator>(
@@ -139,20 +142,40 @@ void HiveDataSink::appendData(RowVectorPtr input) {
 
   computePartitionRowCountsAndIndices();
 
-  for (auto id = 0; id < numPartitions; id++) {
-    const vector_size_t partitionSize = partitionSizes_[id];
-    if (partitionSize == 0) {
-      continue;
+  if (writeExecutor_ != nullptr) {
+    // Fan the partition appends out across the executor so that a wide
+    // dynamic-partition write is not serialized on the driver thread. The
+    // driver waits for all appends before accepting the next batch.
+    std::vector<folly::Future<folly::Unit>> writeFutures;
+    for (size_t id = 0; id < numPartitions; ++id) {
+      if (partitionSizes_[id] == 0) {
+        continue;
+      }
+      writeFutures.push_back(folly::via(
+          writeExecutor_, [this, id, &input]() { writePartition(id, input); }));
     }
+    folly::collect(std::move(writeFutures)).get();
+    return;
+  }
 
-    RowVectorPtr writerInput = partitionSize == input->size()
-        ? input
-        : exec::wrap(partitionSize, partitionRows_[id], input);
-    writers_[id]->write(writerInput);
-    writerInfo_[id]->numWrittenRows += partitionSize;
+  for (size_t id = 0; id < numPartitions; id++) {
+    if (partitionSizes_[id] == 0) {
+      continue;
+    }
+    writePartition(id, input);
   }
 }
 
+void HiveDataSink::writePartition(size_t id, const RowVectorPtr& input) {
+  const vector_size_t partitionSize = partitionSizes_[id];
+
+  RowVectorPtr writerInput = partitionSize == input->size()
+      ? input
+      : exec::wrap(partitionSize, partitionRows_[id], input);
+  writers_[id]->write(writerInput);
+  writerInfo_[id]->numWrittenRows += partitionSize;
+}
+
 std::vector<std::string> HiveDataSink::finish() const {
   std::vector<std::string> partitionUpdates;
   partitionUpdates.reserve(writerInfo_.size());
@@ -223,11 +246,17 @@ void HiveDataSink::appendWriter(
   writerInfo_.push_back(
       std::make_shared<HiveWriterInfo>(std::move(writerParameters)));
 
+  // Give each writer its own child pool so that concurrent writers are
+  // accounted individually while sharing the connector pool's budget.
+  writerPools_.push_back(
+      connectorQueryCtx_->connectorMemoryPool()->addAggregateChild(
+          fmt::format("writer.{}", writerPools_.size())));
+
   auto writerFactory =
       dwio::common::getWriterFactory(insertTableHandle_->tableStorageFormat());
   dwio::common::WriterOptions options;
   options.schema = inputType_;
-  options.memoryPool = connectorQueryCtx_->connectorMemoryPool();
+  options.memoryPool = writerPools_.back().get();
   writers_.push_back(writerFactory->createWriter(
       dwio::common::DataSink::create(writePath), options));
 }
@@ -222,11 +222,15 @@ struct HiveWriterInfo {
 
 class HiveDataSink : public DataSink {
  public:
+  /// @param writeExecutor Optional executor used to append data to the
+  /// writers of different partitions in parallel. Appends run inline on the
+  /// driver thread if not provided.
   HiveDataSink(
       RowTypePtr inputType,
       std::shared_ptr<const HiveInsertTableHandle> insertTableHandle,
       const ConnectorQueryCtx* connectorQueryCtx,
-      CommitStrategy commitStrategy);
+      CommitStrategy commitStrategy,
+      folly::Executor* FOLLY_NULLABLE writeExecutor = nullptr);
 
   void appendData(RowVectorPtr input) override;
 
@@ -249,6 +253,10 @@ class HiveDataSink : public DataSink {
   // to every partition ID, based on the ID labeling of partitionIds_.
   void computePartitionRowCountsAndIndices();
 
+  // Appends the rows of 'input' that belong to partition 'id' to that
+  // partition's writer. Safe to call concurrently for different partitions.
+  void writePartition(size_t id, const RowVectorPtr& input);
+
   HiveWriterParameters getWriterParameters(
       const std::optional<std::string>& partition) const;
 
@@ -258,13 +266,18 @@ class HiveDataSink : public DataSink {
   const std::shared_ptr<const HiveInsertTableHandle> insertTableHandle_;
   const ConnectorQueryCtx* connectorQueryCtx_;
   const CommitStrategy commitStrategy_;
+  folly::Executor* FOLLY_NULLABLE const writeExecutor_;
   const std::vector<column_index_t> partitionChannels_;
   const std::unique_ptr<PartitionIdGenerator> partitionIdGenerator_;
 
-  // Below are structures for partitions from all inputs. writerInfo_ and
-  // writers_ are both indexed by partitionId.
+  // Below are structures for partitions from all inputs. writerInfo_,
+  // writers_ and writerPools_ are all indexed by partitionId.
   std::vector<std::shared_ptr<HiveWriterInfo>> writerInfo_;
   std::vector<std::unique_ptr<dwio::common::Writer>> writers_;
+  // Per-writer aggregate memory pools, children of the connector pool so
+  // that concurrent writers are accounted individually under the shared
+  // write memory budget.
+  std::vector<std::shared_ptr<memory::MemoryPool>> writerPools_;
 
   // Below are structures updated when processing current input. partitionIds_
   // are indexed by the row of input_. partitionRows_, rawPartitionRows_ and
@@ -58,6 +58,10 @@ void PartitionIdGenerator::run(
 
   // TODO Check that there are no nulls in the partition keys.
 
+  if (tryDictionaryRun(input, result)) {
+    return;
+  }
+
   // Compute value IDs using VectorHashers and store these in 'result'.
   computeValueIds(input, result);
 
@@ -88,6 +92,78 @@ void PartitionIdGenerator::run(
   }
 }
 
+bool PartitionIdGenerator::tryDictionaryRun(
+    const RowVectorPtr& input,
+    raw_vector<uint64_t>& result) {
+  if (hashers_.size() != 1) {
+    return false;
+  }
+
+  auto* key = input->childAt(partitionChannels_[0])->loadedVector();
+  if (key->encoding() != VectorEncoding::Simple::DICTIONARY ||
+      key->mayHaveNulls()) {
+    return false;
+  }
+
+  const auto& base = key->valueVector();
+  if (base != cachedDictionaryBase_) {
+    // New alphabet. Compute value IDs for all alphabet entries once;
+    // subsequent batches over the same base only remap indices.
+    const auto baseSize = base->size();
+    baseRows_.resize(baseSize);
+    baseRows_.setAll();
+    cachedValueIds_.resize(baseSize);
+
+    auto& hasher = hashers_[0];
+    hasher->decode(*base, baseRows_);
+    if (!hasher->computeValueIds(baseRows_, cachedValueIds_)) {
+      const auto multiplier = hasher->enableValueIds(1, 50);
+      VELOX_CHECK_NE(
+          multiplier,
+          exec::VectorHasher::kRangeTooLarge,
+          "Number of requested IDs is out of range.");
+
+      const bool ok = hasher->computeValueIds(baseRows_, cachedValueIds_);
+      VELOX_CHECK(ok);
+
+      // Rebuilds 'partitionIds_' and clears 'cachedDictionaryBase_'; set the
+      // cache markers after this call.
+      updateValueToPartitionIdMapping();
+    }
+
+    alphabetPartitionIds_.assign(baseSize, kUnassignedPartitionId);
+    cachedDictionaryBase_ = base;
+  }
+
+  const auto* indices = key->wrapInfo()->as<vector_size_t>();
+  const auto numRows = input->size();
+  for (auto i = 0; i < numRows; ++i) {
+    const auto slot = indices[i];
+    auto partitionId = alphabetPartitionIds_[slot];
+    if (partitionId == kUnassignedPartitionId) {
+      const auto valueId = cachedValueIds_[slot];
+      auto it = partitionIds_.find(valueId);
+      if (it != partitionIds_.end()) {
+        partitionId = it->second;
+      } else {
+        partitionId = partitionIds_.size();
+        VELOX_USER_CHECK_LT(
+            partitionId,
+            maxPartitions_,
+            "Exceeded limit of {} distinct partitions.",
+            maxPartitions_);
+
+        partitionIds_.emplace(valueId, partitionId);
+        savePartitionValues(partitionId, input, i);
+      }
+      alphabetPartitionIds_[slot] = partitionId;
+    }
+    result[i] = partitionId;
+  }
+
+  return true;
+}
+
 std::string PartitionIdGenerator::partitionName(uint64_t partitionId) const {
   return makePartitionName(partitionValues_, partitionId);
 }
@@ -130,6 +206,10 @@ void PartitionIdGenerator::computeValueIds(
 }
 
 void PartitionIdGenerator::updateValueToPartitionIdMapping() {
+  // Cached alphabet value IDs were produced by the pre-rehash hashers and are
+  // no longer valid.
+  cachedDictionaryBase_.reset();
+
   if (partitionIds_.empty()) {
     return;
   }
@@ -55,6 +55,19 @@ class PartitionIdGenerator {
  private:
   static constexpr const int32_t kHasherReservePct = 20;
 
+  // Marks an entry of 'alphabetPartitionIds_' whose partition id has not been
+  // assigned yet.
+  static constexpr int64_t kUnassignedPartitionId = -1;
+
+  // Fast path for a single partition key arriving dictionary-encoded with a
+  // stable alphabet: value ids are computed once per distinct base vector and
+  // cached per alphabet entry, so subsequent batches only remap dictionary
+  // indices. Returns false if 'input' does not qualify and the regular path
+  // must run.
+  bool tryDictionaryRun(
+      const RowVectorPtr& input,
+      raw_vector<uint64_t>& result);
+
   // Computes value IDs using VectorHashers for all rows in 'input'.
   void computeValueIds(
       const RowVectorPtr& input,
@@ -88,6 +101,21 @@ class PartitionIdGenerator {
 
   // All rows are set valid to compute partition IDs for all input rows.
   SelectivityVector allRows_;
+
+  // Base (alphabet) vector of the dictionary-encoded partition key the cache
+  // below was built for. Holding a reference keeps the producer from reusing
+  // the vector in place, which would silently invalidate the cache.
+  VectorPtr cachedDictionaryBase_;
+
+  // Value IDs of the alphabet entries of 'cachedDictionaryBase_'.
+  raw_vector<uint64_t> cachedValueIds_;
+
+  // Partition ID per alphabet entry, kUnassignedPartitionId if the entry has
+  // not been seen in any batch yet.
+  std::vector<int64_t> alphabetPartitionIds_;
+
+  // Reusable selectivity vector covering the rows of the alphabet.
+  SelectivityVector baseRows_;
 };
 
 } // namespace facebook::velox::connector::hive
@@ -22,7 +22,11 @@
 
 #include <fmt/format.h>
 #include <glog/logging.h>
+#include <array>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 
 #include <aws/core/Aws.h>
@@ -30,6 +34,7 @@
 #include <aws/core/http/HttpResponse.h>
 #include <aws/core/utils/logging/ConsoleLogSystem.h>
 #include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+#include <aws/core/utils/threading/Executor.h>
 #include <aws/identity-management/auth/STSAssumeRoleCredentialsProvider.h>
 #include <aws/s3/S3Client.h>
 #include <aws/s3/model/GetObjectRequest.h>
@@ -60,10 +65,60 @@ Aws::IOStreamFactory AwsWriteableStreamFactory(void* data, int64_t nbytes) {
   return [=]() { return Aws::New<StringViewStream>("", data, nbytes); };
 }
 
+// Tracks latencies of recent GET requests to derive the hedging deadline: a
+// duplicate request is issued once a request has been outstanding longer than
+// the p99 latency of the trailing window. Shared by all files of one
+// S3FileSystem.
+class S3RequestLatencyTracker {
+ public:
+  void record(std::chrono::milliseconds latency) {
+    std::lock_guard<std::mutex> l(mutex_);
+    samples_[numRecorded_ % kWindowSize] = latency.count();
+    ++numRecorded_;
+  }
+
+  // Returns the p99 latency of the trailing window, or a conservative default
+  // until enough samples have been recorded.
+  std::chrono::milliseconds hedgeDelay() const {
+    std::array<int64_t, kWindowSize> copy;
+    int64_t numSamples;
+    {
+      std::lock_guard<std::mutex> l(mutex_);
+      numSamples = std::min<int64_t>(numRecorded_, kWindowSize);
+      if (numSamples < kMinSamples) {
+        return kDefaultHedgeDelay;
+      }
+      std::copy(samples_.begin(), samples_.begin() + numSamples, copy.begin());
+    }
+    const auto rank = (numSamples * 99) / 100;
+    std::nth_element(
+        copy.begin(), copy.begin() + rank, copy.begin() + numSamples);
+    return std::max(kMinHedgeDelay, std::chrono::milliseconds(copy[rank]));
+  }
+
+ private:
+  static constexpr int64_t kWindowSize = 256;
+  static constexpr int64_t kMinSamples = 32;
+  static constexpr std::chrono::milliseconds kDefaultHedgeDelay{1'000};
+  static constexpr std::chrono::milliseconds kMinHedgeDelay{50};
+
+  mutable std::mutex mutex_;
+  int64_t numRecorded_{0};
+  std::array<int64_t, kWindowSize> samples_;
+};
+
 class S3ReadFile final : public ReadFile {
  public:
-  S3ReadFile(const std::string& path, Aws::S3::S3Client* client)
-      : client_(client) {
+  S3ReadFile(
+      const std::string& path,
+      Aws::S3::S3Client* client,
+      uint32_t parallelReadConcurrency,
+      bool requestHedgingEnabled,
+      std::shared_ptr<S3RequestLatencyTracker> latencyTracker)
+      : client_(client),
+        parallelReadConcurrency_(parallelReadConcurrency),
+        requestHedgingEnabled_(requestHedgingEnabled),
+        latencyTracker_(std::move(latencyTracker)) {
     bucketAndKeyFromS3Path(path, bucket_, key_);
   }
 
@@ -148,25 +203,157 @@ class S3ReadFile final : public ReadFile {
   }
 
  private:
-  // The assumption here is that "position" has space for at least "length"
-  // bytes.
-  void preadInternal(uint64_t offset, uint64_t length, char* position) const {
-    // Read the desired range of bytes.
-    Aws::S3::Model::GetObjectRequest request;
-    Aws::S3::Model::GetObjectResult result;
-
+  // Minimum number of bytes per sub-range of a parallel read. Reads shorter
+  // than twice this size are fetched with a single request.
+  static constexpr uint64_t kMinReadPartSize = 4 << 20;
+
+  // State of the in-flight asynchronous requests for one sub-range. The
+  // primary request and an optional hedge request write into the buffers owned
+  // here, so a late loser can keep writing safely after the winner's data has
+  // been copied out.
+  struct RangedFetch {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::chrono::steady_clock::time_point startTime;
+    // 0 while no request has succeeded, otherwise 1 + index of the first
+    // buffer filled successfully.
+    int32_t winner{0};
+    int32_t numFailures{0};
+    std::string error;
+    std::array<std::string, 2> buffers;
+  };
+
+  // Fills in bucket, key and the byte range of a GET request.
+  void makeGetObjectRequest(
+      uint64_t offset,
+      uint64_t length,
+      Aws::S3::Model::GetObjectRequest& request) const {
     request.SetBucket(awsString(bucket_));
     request.SetKey(awsString(key_));
     std::stringstream ss;
     ss << "bytes=" << offset << "-" << offset + length - 1;
     request.SetRange(awsString(ss.str()));
+  }
+
+  // Issues an asynchronous GET for [offset, offset + length) writing into
+  // 'fetch->buffers[bufferIndex]'. The handler keeps 'fetch' alive.
+  void issueRangeAsync(
+      uint64_t offset,
+      uint64_t length,
+      int32_t bufferIndex,
+      const std::shared_ptr<RangedFetch>& fetch) const {
+    auto& buffer = fetch->buffers[bufferIndex];
+    buffer.resize(length);
+
+    Aws::S3::Model::GetObjectRequest request;
+    makeGetObjectRequest(offset, length, request);
     request.SetResponseStreamFactory(
-        AwsWriteableStreamFactory(position, length));
-    auto outcome = client_->GetObject(request);
-    VELOX_CHECK_AWS_OUTCOME(outcome, "Failed to get S3 object", bucket_, key_);
+        AwsWriteableStreamFactory(buffer.data(), length));
+
+    client_->GetObjectAsync(
+        request,
+        [fetch, bufferIndex](
+            const Aws::S3::S3Client* /*client*/,
+            const Aws::S3::Model::GetObjectRequest& /*request*/,
+            auto outcome,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext>&
+            /*context*/) {
+          std::lock_guard<std::mutex> l(fetch->mutex);
+          if (outcome.IsSuccess()) {
+            if (fetch->winner == 0) {
+              fetch->winner = bufferIndex + 1;
+            }
+          } else {
+            ++fetch->numFailures;
+            const auto& message = outcome.GetError().GetMessage();
+            fetch->error = std::string(message.data(), message.size());
+          }
+          fetch->cv.notify_all();
+        });
+  }
+
+  // Waits for 'fetch' to produce the sub-range [offset, offset + length) and
+  // copies the winner's data to 'position'. If hedging is enabled and the
+  // primary request is outstanding longer than the p99 of recent requests,
+  // races a duplicate request against it.
+  void waitForRange(
+      uint64_t offset,
+      uint64_t length,
+      char* position,
+      const std::shared_ptr<RangedFetch>& fetch) const {
+    int32_t numIssued = 1;
+    std::unique_lock<std::mutex> l(fetch->mutex);
+    auto ready = [&]() {
+      return fetch->winner != 0 || fetch->numFailures == numIssued;
+    };
+    if (requestHedgingEnabled_ &&
+        !fetch->cv.wait_for(l, latencyTracker_->hedgeDelay(), ready)) {
+      l.unlock();
+      issueRangeAsync(offset, length, 1, fetch);
+      l.lock();
+      ++numIssued;
+    }
+    fetch->cv.wait(l, ready);
+    VELOX_CHECK_NE(
+        fetch->winner,
+        0,
+        "Failed to get S3 object, bucket: '{}', key: '{}', error: {}",
+        bucket_,
+        key_,
+        fetch->error);
+    memcpy(position, fetch->buffers[fetch->winner - 1].data(), length);
+    latencyTracker_->record(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - fetch->startTime));
+  }
+
+  // The assumption here is that "position" has space for at least "length"
+  // bytes.
+  void preadInternal(uint64_t offset, uint64_t length, char* position) const {
+    const uint64_t numParts =
+        (parallelReadConcurrency_ <= 1 || length < 2 * kMinReadPartSize)
+        ? 1
+        : std::min<uint64_t>(
+              parallelReadConcurrency_, length / kMinReadPartSize);
+
+    if (numParts == 1 && !requestHedgingEnabled_) {
+      // Single synchronous GET reading directly into 'position'.
+      const auto startTime = std::chrono::steady_clock::now();
+      Aws::S3::Model::GetObjectRequest request;
+      makeGetObjectRequest(offset, length, request);
+      request.SetResponseStreamFactory(
+          AwsWriteableStreamFactory(position, length));
+      auto outcome = client_->GetObject(request);
+      VELOX_CHECK_AWS_OUTCOME(
+          outcome, "Failed to get S3 object", bucket_, key_);
+      latencyTracker_->record(
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              std::chrono::steady_clock::now() - startTime));
+      return;
+    }
+
+    // Fetch sub-ranges concurrently, hedging stragglers.
+    const uint64_t partSize = (length + numParts - 1) / numParts;
+    std::vector<std::shared_ptr<RangedFetch>> fetches(numParts);
+    for (uint64_t i = 0; i < numParts; ++i) {
+      const auto partOffset = i * partSize;
+      const auto partLength = std::min(partSize, length - partOffset);
+      fetches[i] = std::make_shared<RangedFetch>();
+      fetches[i]->startTime = std::chrono::steady_clock::now();
+      issueRangeAsync(offset + partOffset, partLength, 0, fetches[i]);
+    }
+    for (uint64_t i = 0; i < numParts; ++i) {
+      const auto partOffset = i * partSize;
+      const auto partLength = std::min(partSize, length - partOffset);
+      waitForRange(
+          offset + partOffset, partLength, position + partOffset, fetches[i]);
+    }
   }
 
   Aws::S3::S3Client* client_;
+  const uint32_t parallelReadConcurrency_;
+  const bool requestHedgingEnabled_;
+  const std::shared_ptr<S3RequestLatencyTracker> latencyTracker_;
   std::string bucket_;
   std::string key_;
   int64_t length_ = -1;
@@ -298,6 +485,15 @@ class S3FileSystem::Impl {
 
     clientConfig.endpointOverride = HiveConfig::s3Endpoint(config_);
 
+    // Bound and reuse connections across requests. The pooled executor caps
+    // the number of threads servicing asynchronous range fetches and keeps
+    // them (and their connections) alive between requests.
+    const auto maxConnections = HiveConfig::s3MaxConnections(config_);
+    clientConfig.maxConnections = maxConnections;
+    clientConfig.executor =
+        Aws::MakeShared<Aws::Utils::Threading::PooledThreadExecutor>(
+            "S3FileSystem", maxConnections);
+
     if (HiveConfig::s3UseSSL(config_)) {
       clientConfig.scheme = Aws::Http::Scheme::HTTPS;
     } else {
@@ -320,6 +516,18 @@ class S3FileSystem::Impl {
     return client_.get();
   }
 
+  uint32_t parallelReadConcurrency() const {
+    return HiveConfig::s3ParallelReadConcurrency(config_);
+  }
+
+  bool requestHedgingEnabled() const {
+    return HiveConfig::s3RequestHedgingEnabled(config_);
+  }
+
+  const std::shared_ptr<S3RequestLatencyTracker>& latencyTracker() const {
+    return latencyTracker_;
+  }
+
   std::string getLogLevelName() const {
     return GetLogLevelName(inferS3LogLevel(HiveConfig::s3GetLogLevel(config_)));
   }
@@ -327,6 +535,8 @@ class S3FileSystem::Impl {
  private:
   const Config* config_;
   std::shared_ptr<Aws::S3::S3Client> client_;
+  const std::shared_ptr<S3RequestLatencyTracker> latencyTracker_{
+      std::make_shared<S3RequestLatencyTracker>()};
   static std::atomic<size_t> initCounter_;
 };
 
@@ -350,7 +560,12 @@ std::unique_ptr<ReadFile> S3FileSystem::openFileForRead(
     std::string_view path,
     const FileOptions& /*unused*/) {
   const std::string file = s3Path(path);
-  auto s3file = std::make_unique<S3ReadFile>(file, impl_->s3Client());
+  auto s3file = std::make_unique<S3ReadFile>(
+      file,
+      impl_->s3Client(),
+      impl_->parallelReadConcurrency(),
+      impl_->requestHedgingEnabled(),
+      impl_->latencyTracker());
   s3file->initialize();
   return s3file;
 }
@@ -182,5 +182,42 @@ TEST_F(HiveConnectorTest, makeScanSpec_requiredSubfields_allSubscripts) {
   validateNullConstant(*elements->childByName("c0c1"), *BIGINT());
 }
 
+TEST_F(HiveConnectorTest, widenScanSpec) {
+  auto columnType = ROW(
+      {{"c0c0", BIGINT()},
+       {"c0c1",
+        MAP(BIGINT(), ROW({{"c0c1c0", BIGINT()}, {"c0c1c1", BIGINT()}}))}});
+  auto rowType = ROW({{"c0", columnType}});
+  auto columnHandle =
+      makeColumnHandle("c0", columnType, {"c0.c0c1[10].c0c1c0"});
+  auto scanSpec = HiveDataSource::makeScanSpec(
+      {}, rowType, {columnHandle.get()}, {}, pool_.get());
+  auto* c0 = scanSpec->childByName("c0");
+  validateNullConstant(*c0->childByName("c0c0"), *BIGINT());
+  auto* c0c1 = c0->childByName("c0c1");
+  auto* keys = c0c1->childByName(ScanSpec::kMapKeysFieldName);
+  ASSERT_TRUE(applyFilter(*keys->filter(), 10));
+  ASSERT_FALSE(applyFilter(*keys->filter(), 20));
+  auto* values = c0c1->childByName(ScanSpec::kMapValuesFieldName);
+  validateNullConstant(*values->childByName("c0c1c1"), *BIGINT());
+
+  // Add another map key and the subfield under it mid-scan.
+  HiveDataSource::widenScanSpec(
+      *columnType, Subfield("c0.c0c1[20].c0c1c1"), *c0);
+  ASSERT_TRUE(applyFilter(*keys->filter(), 10));
+  ASSERT_TRUE(applyFilter(*keys->filter(), 20));
+  ASSERT_FALSE(applyFilter(*keys->filter(), 15));
+  ASSERT_FALSE(values->childByName("c0c1c0")->isConstant());
+  ASSERT_FALSE(values->childByName("c0c1c1")->isConstant());
+
+  // Un-prune a struct child that was dropped entirely.
+  HiveDataSource::widenScanSpec(*columnType, Subfield("c0.c0c0"), *c0);
+  ASSERT_FALSE(c0->childByName("c0c0")->isConstant());
+
+  // Widening to all keys drops the key filter.
+  HiveDataSource::widenScanSpec(*columnType, Subfield("c0.c0c1[*]"), *c0);
+  ASSERT_FALSE(keys->filter());
+}
+
 } // namespace
 } // namespace facebook::velox::connector::hive
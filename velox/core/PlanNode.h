@@ -1878,6 +1878,10 @@ class WindowNode : public PlanNode {
   /// @param windowColumnNames specifies the output column
   /// names for each window function column. So
   /// windowColumnNames.length() = windowFunctions.length().
+  /// @param inputsSorted If true, the input is already sorted on the
+  /// partition keys followed by the sorting keys. The Window operator then
+  /// streams one partition at a time instead of sorting and materializing
+  /// all input first.
   WindowNode(
       PlanNodeId id,
       std::vector<FieldAccessTypedExprPtr> partitionKeys,
@@ -1885,8 +1889,27 @@ class WindowNode : public PlanNode {
       std::vector<SortOrder> sortingOrders,
       std::vector<std::string> windowColumnNames,
       std::vector<Function> windowFunctions,
+      bool inputsSorted,
       PlanNodePtr source);
 
+  WindowNode(
+      PlanNodeId id,
+      std::vector<FieldAccessTypedExprPtr> partitionKeys,
+      std::vector<FieldAccessTypedExprPtr> sortingKeys,
+      std::vector<SortOrder> sortingOrders,
+      std::vector<std::string> windowColumnNames,
+      std::vector<Function> windowFunctions,
+      PlanNodePtr source)
+      : WindowNode(
+            std::move(id),
+            std::move(partitionKeys),
+            std::move(sortingKeys),
+            std::move(sortingOrders),
+            std::move(windowColumnNames),
+            std::move(windowFunctions),
+            false,
+            std::move(source)) {}
+
   const std::vector<PlanNodePtr>& sources() const override {
     return sources_;
   }
@@ -1913,6 +1936,10 @@ class WindowNode : public PlanNode {
     return windowFunctions_;
   }
 
+  bool inputsSorted() const {
+    return inputsSorted_;
+  }
+
   std::string_view name() const override {
     return "Window";
   }
@@ -1931,6 +1958,8 @@ class WindowNode : public PlanNode {
 
   const std::vector<Function> windowFunctions_;
 
+  const bool inputsSorted_;
+
   const std::vector<PlanNodePtr> sources_;
 
   const RowTypePtr outputType_;
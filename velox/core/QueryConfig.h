@@ -64,11 +64,39 @@ class QueryConfig {
   static constexpr const char* kExprTrackCpuUsage =
       "expression.track_cpu_usage";
 
+  // Whether to cache results of deterministic expressions over
+  // dictionary-encoded inputs keyed on the dictionary alphabet, so that
+  // consecutive batches wrapping the same alphabet reuse already computed
+  // values. True by default.
+  static constexpr const char* kExprMemoizeDictionaryResults =
+      "expression.memoize_dictionary_results";
+
+  // Whether to reuse compiled ExprSets across tasks and drivers via a
+  // process-wide pool keyed by expression text and query configuration.
+  // Meant for workloads that run the same query template repeatedly.
+  // False by default.
+  static constexpr const char* kExprReuseCompiledExpressions =
+      "expression.reuse_compiled_expressions";
+
   // Whether to track CPU usage for stages of individual operators. True by
   // default. Can be expensive when processing small batches, e.g. < 10K rows.
   static constexpr const char* kOperatorTrackCpuUsage =
       "track_operator_cpu_usage";
 
+  // Whether to collect a structured execution trace for each task. The
+  // trace records operator time slices, blocked intervals and spill
+  // events in the Chrome/Perfetto trace event format and is retrieved
+  // with Task::traceJson(). False by default.
+  static constexpr const char* kTaskTraceEnabled = "task_trace_enabled";
+
+  // Identifies a recurring query template, e.g. the text of a
+  // parameterized query that a workload runs repeatedly. When set,
+  // execution stats of successfully finished tasks are recorded in the
+  // process-wide QueryFeedbackRegistry and config defaults of later
+  // executions of the same template are seeded from that history.
+  // Empty (disabled) by default.
+  static constexpr const char* kQueryTemplateKey = "query_template_key";
+
   // Flags used to configure the CAST operator:
 
   // This flag makes the Row conversion to by applied in a way that the casting
@@ -100,6 +128,34 @@ class QueryConfig {
   static constexpr const char* kMaxPartitionedOutputBufferSize =
       "max_page_partitioning_buffer_size";
 
+  /// The compression codec for exchange pages, 'none' for no compression.
+  /// Applied by PartitionedOutput when serializing; the codec is recorded in
+  /// each page so consumers decompress without any out of band negotiation.
+  static constexpr const char* kExchangeCompressionCodec =
+      "exchange_compression_codec";
+
+  /// Target buffered bytes for each remote source of a MergeExchange. The
+  /// memory used by the merging task is roughly this times the number of
+  /// sorted partitions, so a wide merge, e.g. 200-way, stays bounded instead
+  /// of buffering the full exchange client default per source.
+  static constexpr const char* kMergeExchangeSourceBufferSize =
+      "merge_exchange_source_buffer_size";
+
+  /// Target size in bytes to coalesce small batches into in a merge
+  /// source before the merge consumes them. Producers that emit many
+  /// tiny batches otherwise cost the merge one queue operation per few
+  /// rows and poor locality.
+  static constexpr const char* kMergeSourceCoalesceBytes =
+      "merge_source_coalesce_bytes";
+
+  /// Maximum bytes of canonical string dictionary alphabets retained by
+  /// the per-query interning pool. When non-zero, file readers replace a
+  /// string dictionary alphabet already seen in the query with a shared
+  /// canonical copy, so DictionaryVectors over the same alphabet share
+  /// one physical vector. Zero disables interning.
+  static constexpr const char* kStringAlphabetInterningBytes =
+      "string_alphabet_interning_bytes";
+
   /// Preferred size of batches in bytes to be returned by operators from
   /// Operator::getOutput. It is used when an estimate of average row size is
   /// known. Otherwise kPreferredOutputBatchRows is used.
@@ -119,6 +175,24 @@ class QueryConfig {
   /// output rows.
   static constexpr const char* kMaxOutputBatchRows = "max_output_batch_rows";
 
+  /// If the percentage of input rows passing a filter is strictly below
+  /// this value, FilterProject copies the passing rows into flat output
+  /// vectors instead of wrapping the input columns in dictionaries.
+  /// Compacting costs a copy of the passing rows, but releases the
+  /// full-size input batch right away and gives downstream operators
+  /// densely packed vectors. 0 disables compaction.
+  static constexpr const char* kFilterCompactOutputMaxPct =
+      "filter_compact_output_max_pct";
+
+  /// Number of probe x build candidate rows a nested loop join with a join
+  /// condition evaluates the condition on at a time. Blocks larger than the
+  /// preferred output batch amortize per-evaluation overhead when the
+  /// condition drops most candidates, e.g. inequality joins. A batch of
+  /// output may exceed the preferred size when the condition passes most
+  /// rows.
+  static constexpr const char* kNestedLoopJoinFilterBatchRows =
+      "nested_loop_join_filter_batch_rows";
+
   /// If false, the 'group by' code is forced to use generic hash mode
   /// hashtable.
   static constexpr const char* kHashAdaptivityEnabled =
@@ -142,6 +216,27 @@ class QueryConfig {
   /// OrderBy spilling flag, only applies if "spill_enabled" flag is set.
   static constexpr const char* kOrderBySpillEnabled = "order_by_spill_enabled";
 
+  /// If true, MarkDistinct may replace its exact seen-keys table with a Bloom
+  /// filter of the seen keys when the memory arbitrator asks it to free
+  /// memory. Keys that collide in the filter are marked as duplicates, so
+  /// distinct aggregates may undercount. Off by default.
+  static constexpr const char* kMarkDistinctApproxEnabled =
+      "mark_distinct_approx_enabled";
+
+  /// If true, a terminating Task closes the drivers that were not on a
+  /// thread on an executor thread instead of inline, so that freeing
+  /// large operator state, e.g. hash tables, does not add to query
+  /// latency. Only applies when the query runs with an executor. Off
+  /// by default.
+  static constexpr const char* kTaskDeferredTeardownEnabled =
+      "task_deferred_teardown_enabled";
+
+  /// If true, the number of drivers concurrently executing a table
+  /// scan adapts to the IO profile of the scan: IO bound phases run
+  /// with more drivers than CPU bound ones. Off by default.
+  static constexpr const char* kTableScanScaleDriversEnabled =
+      "table_scan_scale_drivers_enabled";
+
   /// The max memory that a final aggregation can use before spilling. If it 0,
   /// then there is no limit.
   static constexpr const char* kAggregationSpillMemoryThreshold =
@@ -180,6 +275,13 @@ class QueryConfig {
   /// spilled files.
   static constexpr const char* kMinSpillRunSize = "min_spill_run_size";
 
+  /// The compression codec for data spilled to disk. The supported values
+  /// are 'none', 'lz4' and 'zstd'. With compression enabled, each serialized
+  /// batch is written as a separately compressed frame so batches can be
+  /// decompressed one at a time when reading back.
+  static constexpr const char* kSpillCompressionCodec =
+      "spill_compression_codec";
+
   static constexpr const char* kSpillStartPartitionBit =
       "spiller_start_partition_bit";
 
@@ -188,6 +290,14 @@ class QueryConfig {
   static constexpr const char* kSpillableReservationGrowthPct =
       "spillable_reservation_growth_pct";
 
+  /// The maximum number of build side rows for which a hash join creates a
+  /// Bloom filter over the join keys to push down into the probe side table
+  /// scan. This applies when the join's hash table is in hash mode, i.e. the
+  /// hashers do not keep per-key value ids and the exact value based dynamic
+  /// filters cannot be created. Zero disables the Bloom filter pushdown.
+  static constexpr const char* kDynamicBloomFilterMaxRows =
+      "dynamic_bloom_filter_max_rows";
+
   /// If false, size function returns null for null input.
   static constexpr const char* kSparkLegacySizeOfNull =
       "spark.legacy_size_of_null";
@@ -234,6 +344,24 @@ class QueryConfig {
     return get<uint64_t>(kMaxPartitionedOutputBufferSize, kDefault);
   }
 
+  uint64_t mergeExchangeSourceBufferSize() const {
+    static constexpr uint64_t kDefault = 8UL << 20;
+    return get<uint64_t>(kMergeExchangeSourceBufferSize, kDefault);
+  }
+
+  uint64_t mergeSourceCoalesceBytes() const {
+    static constexpr uint64_t kDefault = 256UL << 10;
+    return get<uint64_t>(kMergeSourceCoalesceBytes, kDefault);
+  }
+
+  uint64_t stringAlphabetInterningBytes() const {
+    return get<uint64_t>(kStringAlphabetInterningBytes, 0);
+  }
+
+  std::string exchangeCompressionCodec() const {
+    return get<std::string>(kExchangeCompressionCodec, "none");
+  }
+
   uint64_t maxLocalExchangeBufferSize() const {
     static constexpr uint64_t kDefault = 32UL << 20;
     return get<uint64_t>(kMaxLocalExchangeBufferSize, kDefault);
@@ -252,6 +380,14 @@ class QueryConfig {
     return get<uint32_t>(kMaxOutputBatchRows, 10'000);
   }
 
+  int32_t filterCompactOutputMaxPct() const {
+    return get<int32_t>(kFilterCompactOutputMaxPct, 0);
+  }
+
+  uint32_t nestedLoopJoinFilterBatchRows() const {
+    return get<uint32_t>(kNestedLoopJoinFilterBatchRows, 10'000);
+  }
+
   bool hashAdaptivityEnabled() const {
     return get<bool>(kHashAdaptivityEnabled, true);
   }
@@ -302,6 +438,14 @@ class QueryConfig {
     return get<bool>(kExprEvalSimplified, false);
   }
 
+  bool exprMemoizeDictionaryResults() const {
+    return get<bool>(kExprMemoizeDictionaryResults, true);
+  }
+
+  bool exprReuseCompiledExpressions() const {
+    return get<bool>(kExprReuseCompiledExpressions, false);
+  }
+
   /// Returns true if spilling is enabled.
   bool spillEnabled() const {
     return get<bool>(kSpillEnabled, false);
@@ -325,6 +469,24 @@ class QueryConfig {
     return get<bool>(kOrderBySpillEnabled, true);
   }
 
+  /// Returns true if MarkDistinct may degrade to approximate distinct
+  /// marking under memory pressure.
+  bool markDistinctApproxEnabled() const {
+    return get<bool>(kMarkDistinctApproxEnabled, false);
+  }
+
+  /// Returns true if Task teardown may release driver and operator
+  /// resources on an executor thread after termination.
+  bool taskDeferredTeardownEnabled() const {
+    return get<bool>(kTaskDeferredTeardownEnabled, false);
+  }
+
+  /// Returns true if table scan driver parallelism adapts to the IO
+  /// profile of the scan.
+  bool tableScanScaleDriversEnabled() const {
+    return get<bool>(kTableScanScaleDriversEnabled, false);
+  }
+
   // Returns a percentage of aggregation or join input batches that
   // will be forced to spill for testing. 0 means no extra spilling.
   int32_t testingSpillPct() const {
@@ -335,6 +497,14 @@ class QueryConfig {
     return get<int32_t>(kMaxSpillLevel, 4);
   }
 
+  /// Returns the max number of build side rows to summarize into a Bloom
+  /// filter for probe side scan pushdown. Zero means no Bloom filter
+  /// pushdown.
+  uint64_t dynamicBloomFilterMaxRows() const {
+    static constexpr uint64_t kDefault = 1 << 22;
+    return get<uint64_t>(kDynamicBloomFilterMaxRows, kDefault);
+  }
+
   /// Returns the start partition bit which is used with 'kSpillPartitionBits'
   /// together to calculate the spilling partition number.
   uint8_t spillStartPartitionBit() const {
@@ -362,6 +532,12 @@ class QueryConfig {
     return get<uint64_t>(kMinSpillRunSize, kDefaultMinSpillRunSize);
   }
 
+  /// Returns the compression codec used for data spilled to disk, 'none' for
+  /// no compression.
+  std::string spillCompressionCodec() const {
+    return get<std::string>(kSpillCompressionCodec, "none");
+  }
+
   /// Returns the spillable memory reservation growth percentage of the previous
   /// memory reservation size. 25 means exponential growth along a series of
   /// integer powers of 5/4. The reservation grows by this much until it no
@@ -384,6 +560,14 @@ class QueryConfig {
     return get<bool>(kOperatorTrackCpuUsage, true);
   }
 
+  bool taskTraceEnabled() const {
+    return get<bool>(kTaskTraceEnabled, false);
+  }
+
+  std::string queryTemplateKey() const {
+    return get<std::string>(kQueryTemplateKey, "");
+  }
+
   template <typename T>
   T get(const std::string& key, const T& defaultValue) const {
     return config_->get<T>(key, defaultValue);
@@ -393,6 +577,13 @@ class QueryConfig {
     return std::optional<T>(config_->get<T>(key));
   }
 
+  /// Returns a copy of the backing config values. Used to replicate the
+  /// configuration, e.g. when caching compiled expressions across
+  /// queries.
+  std::unordered_map<std::string, std::string> valuesCopy() const {
+    return config_->valuesCopy();
+  }
+
   /// Test-only method to override the current query config properties.
   /// It is not thread safe.
   void testingOverrideConfigUnsafe(
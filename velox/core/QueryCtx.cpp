@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "velox/core/QueryCtx.h"
+#include "velox/core/QueryFeedback.h"
 
 namespace facebook::velox::core {
 
@@ -29,7 +30,8 @@ QueryCtx::QueryCtx(
       allocator_(allocator),
       pool_(std::move(pool)),
       executor_(executor),
-      queryConfig_{std::move(queryConfigValues)},
+      queryConfig_{QueryFeedbackRegistry::instance()->seededConfigValues(
+          std::move(queryConfigValues))},
       queryId_(queryId),
       spillExecutor_(std::move(spillExecutor)) {
   initPool(queryId);
@@ -46,7 +48,8 @@ QueryCtx::QueryCtx(
       allocator_(allocator),
       pool_(std::move(pool)),
       executorKeepalive_(std::move(executorKeepalive)),
-      queryConfig_{std::move(queryConfigValues)},
+      queryConfig_{QueryFeedbackRegistry::instance()->seededConfigValues(
+          std::move(queryConfigValues))},
       queryId_(queryId) {
   initPool(queryId);
 }
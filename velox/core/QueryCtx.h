@@ -17,10 +17,12 @@
 
 #include <folly/Executor.h>
 #include <folly/executors/CPUThreadPoolExecutor.h>
+#include <folly/synchronization/CallOnce.h>
 #include "velox/common/memory/Memory.h"
 #include "velox/common/memory/MemoryAllocator.h"
 #include "velox/core/QueryConfig.h"
 #include "velox/vector/DecodedVector.h"
+#include "velox/vector/StringAlphabetInterner.h"
 #include "velox/vector/VectorPool.h"
 
 namespace facebook::velox::core {
@@ -78,6 +80,10 @@ class QueryCtx {
     return executor;
   }
 
+  bool isExecutorSupplied() const {
+    return executor_ != nullptr || executorKeepalive_.get() != nullptr;
+  }
+
   const QueryConfig& queryConfig() const {
     return queryConfig_;
   }
@@ -111,6 +117,21 @@ class QueryCtx {
     return spillExecutor_.get();
   }
 
+  /// Returns the query-wide string alphabet interning pool or nullptr if
+  /// interning is disabled. See QueryConfig::kStringAlphabetInterningBytes.
+  /// Created on first use so that config overrides applied after
+  /// construction take effect.
+  const std::shared_ptr<StringAlphabetInterner>& stringAlphabetInterner() {
+    folly::call_once(stringAlphabetInternerInitialized_, [&]() {
+      const auto maxBytes = queryConfig_.stringAlphabetInterningBytes();
+      if (maxBytes > 0) {
+        stringAlphabetInterner_ = std::make_shared<StringAlphabetInterner>(
+            pool_->addLeafChild("string_alphabet_interner"), maxBytes);
+      }
+    });
+    return stringAlphabetInterner_;
+  }
+
   const std::string& queryId() const {
     return queryId_;
   }
@@ -141,15 +162,29 @@ class QueryCtx {
   QueryConfig queryConfig_;
   const std::string queryId_;
   std::shared_ptr<folly::Executor> spillExecutor_;
+  folly::once_flag stringAlphabetInternerInitialized_;
+  std::shared_ptr<StringAlphabetInterner> stringAlphabetInterner_;
 };
 
 // Represents the state of one thread of query execution.
 class ExecCtx {
  public:
+  /// 'vectorPool' is an optional vector pool shared with other ExecCtxs,
+  /// e.g. the ones of the other operators in a driver pipeline so that
+  /// output vectors released by one operator can be reused by the next.
+  /// If not set, 'this' makes its own pool. A shared vector pool may only
+  /// be used from one thread at a time.
   ExecCtx(
       memory::MemoryPool* FOLLY_NONNULL pool,
-      QueryCtx* FOLLY_NULLABLE queryCtx)
-      : pool_(pool), queryCtx_(queryCtx), vectorPool_{pool} {}
+      QueryCtx* FOLLY_NULLABLE queryCtx,
+      VectorPool* FOLLY_NULLABLE vectorPool = nullptr)
+      : pool_(pool),
+        queryCtx_(queryCtx),
+        ownedVectorPool_(
+            vectorPool == nullptr ? std::make_unique<VectorPool>(pool)
+                                  : nullptr),
+        vectorPool_(
+            vectorPool == nullptr ? ownedVectorPool_.get() : vectorPool) {}
 
   velox::memory::MemoryPool* FOLLY_NONNULL pool() const {
     return pool_;
@@ -205,25 +240,25 @@ class ExecCtx {
   }
 
   VectorPool& vectorPool() {
-    return vectorPool_;
+    return *vectorPool_;
   }
 
   /// Gets a possibly recycled vector of 'type and 'size'. Allocates from
   /// 'pool_' if no pre-allocated vector.
   VectorPtr getVector(const TypePtr& type, vector_size_t size) {
-    return vectorPool_.get(type, size);
+    return vectorPool_->get(type, size, *pool_);
   }
 
   /// Moves 'vector' to the pool if it is reusable, else leaves it in
   /// place. Returns true if the vector was moved into the pool.
   bool releaseVector(VectorPtr& vector) {
-    return vectorPool_.release(vector);
+    return vectorPool_->release(vector);
   }
 
   /// Moves elements of 'vectors' to the pool if reusable, else leaves them
   /// in place. Returns number of vectors that were moved into the pool.
   size_t releaseVectors(std::vector<VectorPtr>& vectors) {
-    return vectorPool_.release(vectors);
+    return vectorPool_->release(vectors);
   }
 
  private:
@@ -235,7 +270,9 @@ class ExecCtx {
   // A pool of preallocated SelectivityVectors for use by expressions
   // and operators.
   std::vector<std::unique_ptr<SelectivityVector>> selectivityVectorPool_;
-  VectorPool vectorPool_;
+  // Set if 'this' owns its vector pool, not set if the pool is shared.
+  std::unique_ptr<VectorPool> ownedVectorPool_;
+  VectorPool* FOLLY_NONNULL vectorPool_;
 };
 
 } // namespace facebook::velox::core
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/core/QueryFeedback.h"
+
+#include <algorithm>
+
+#include "velox/core/QueryConfig.h"
+
+namespace facebook::velox::core {
+
+void QueryFeedbackStats::merge(const QueryFeedbackStats& other) {
+  numExecutions += other.numExecutions;
+  outputVectors += other.outputVectors;
+  outputRows += other.outputRows;
+  numSpilledExecutions += other.numSpilledExecutions;
+  numAbandonedPartialAggregations += other.numAbandonedPartialAggregations;
+}
+
+// static
+QueryFeedbackRegistry* QueryFeedbackRegistry::instance() {
+  static QueryFeedbackRegistry registry;
+  return &registry;
+}
+
+void QueryFeedbackRegistry::record(
+    const std::string& templateKey,
+    const QueryFeedbackStats& stats) {
+  if (templateKey.empty()) {
+    return;
+  }
+  templates_.withWLock(
+      [&](auto& templates) { templates[templateKey].merge(stats); });
+}
+
+std::unordered_map<std::string, std::string>
+QueryFeedbackRegistry::seededConfigValues(
+    std::unordered_map<std::string, std::string> configValues) const {
+  auto it = configValues.find(QueryConfig::kQueryTemplateKey);
+  if (it == configValues.end() || it->second.empty()) {
+    return configValues;
+  }
+  const auto history = templateStats(it->second);
+  if (history.numExecutions == 0) {
+    return configValues;
+  }
+
+  // emplace() leaves explicitly set values untouched.
+  if (history.outputVectors > 0) {
+    // Size output batches like the ones the template actually produced.
+    const auto avgBatchRows = std::clamp<uint64_t>(
+        history.outputRows / history.outputVectors, 64, 10'000);
+    configValues.emplace(
+        QueryConfig::kPreferredOutputBatchRows, std::to_string(avgBatchRows));
+  }
+  if (history.numAbandonedPartialAggregations * 2 >= history.numExecutions) {
+    // The template's partial aggregations historically did not reduce
+    // cardinality. Give up on them after the first batches instead of
+    // rediscovering this at the default threshold every run.
+    configValues.emplace(
+        QueryConfig::kAbandonPartialAggregationMinRows, "100");
+  }
+  if (history.numSpilledExecutions * 2 >= history.numExecutions) {
+    // The template usually spills. Start with the maximum supported
+    // spill partitioning to reduce recursive spilling.
+    configValues.emplace(QueryConfig::kSpillPartitionBits, "3");
+  }
+  return configValues;
+}
+
+QueryFeedbackStats QueryFeedbackRegistry::templateStats(
+    const std::string& templateKey) const {
+  return templates_.withRLock([&](const auto& templates) {
+    auto it = templates.find(templateKey);
+    return it == templates.end() ? QueryFeedbackStats{} : it->second;
+  });
+}
+
+void QueryFeedbackRegistry::testingClear() {
+  templates_.withWLock([](auto& templates) { templates.clear(); });
+}
+
+} // namespace facebook::velox::core
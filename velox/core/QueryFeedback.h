@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <folly/Synchronized.h>
+
+#include <string>
+#include <unordered_map>
+
+namespace facebook::velox::core {
+
+/// Aggregated execution history of one recurring query template.
+/// Counters for per-execution events (spills, abandoned partial
+/// aggregations) count executions in which the event occurred at least
+/// once.
+struct QueryFeedbackStats {
+  uint64_t numExecutions{0};
+
+  /// Total output batches and rows produced by all operators.
+  uint64_t outputVectors{0};
+  uint64_t outputRows{0};
+
+  /// Number of executions that spilled.
+  uint64_t numSpilledExecutions{0};
+
+  /// Number of executions that abandoned a partial aggregation.
+  uint64_t numAbandonedPartialAggregations{0};
+
+  void merge(const QueryFeedbackStats& other);
+};
+
+/// Process-wide store of execution history keyed by query template. A
+/// template is identified by the QueryConfig::kQueryTemplateKey config
+/// value, e.g. the text of a parameterized query that a workload runs
+/// repeatedly. Tasks of keyed queries record their stats here on
+/// successful completion and QueryCtxs of later executions of the same
+/// template get config defaults seeded from the history, so recurring
+/// queries do not start from global defaults every run. Thread safe.
+class QueryFeedbackRegistry {
+ public:
+  static QueryFeedbackRegistry* instance();
+
+  /// Merges the stats of one finished execution into the history of
+  /// 'templateKey'. No-op if 'templateKey' is empty.
+  void record(const std::string& templateKey, const QueryFeedbackStats& stats);
+
+  /// Returns 'configValues' with defaults seeded from the history of
+  /// the template named by kQueryTemplateKey in 'configValues', if any.
+  /// Explicitly set values are never overridden. Returns 'configValues'
+  /// unchanged if no template key is set or there is no history yet.
+  std::unordered_map<std::string, std::string> seededConfigValues(
+      std::unordered_map<std::string, std::string> configValues) const;
+
+  /// Returns a copy of the history of 'templateKey', all zeros if none.
+  QueryFeedbackStats templateStats(const std::string& templateKey) const;
+
+  /// Drops all recorded history. Used by tests.
+  void testingClear();
+
+ private:
+  folly::Synchronized<std::unordered_map<std::string, QueryFeedbackStats>>
+      templates_;
+};
+
+} // namespace facebook::velox::core
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "velox/core/QueryCtx.h"
+#include "velox/core/QueryFeedback.h"
+
+namespace facebook::velox::core::test {
+
+class QueryFeedbackTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    QueryFeedbackRegistry::instance()->testingClear();
+  }
+};
+
+TEST_F(QueryFeedbackTest, recordAndMerge) {
+  auto* registry = QueryFeedbackRegistry::instance();
+  QueryFeedbackStats stats;
+  stats.numExecutions = 1;
+  stats.outputVectors = 10;
+  stats.outputRows = 5'000;
+  stats.numSpilledExecutions = 1;
+  registry->record("q1", stats);
+  registry->record("q1", stats);
+  // An empty template key is ignored.
+  registry->record("", stats);
+
+  auto history = registry->templateStats("q1");
+  EXPECT_EQ(history.numExecutions, 2);
+  EXPECT_EQ(history.outputVectors, 20);
+  EXPECT_EQ(history.outputRows, 10'000);
+  EXPECT_EQ(history.numSpilledExecutions, 2);
+  EXPECT_EQ(registry->templateStats("").numExecutions, 0);
+  EXPECT_EQ(registry->templateStats("q2").numExecutions, 0);
+}
+
+TEST_F(QueryFeedbackTest, seededConfigValues) {
+  auto* registry = QueryFeedbackRegistry::instance();
+
+  // No history yet: values pass through unchanged.
+  auto values =
+      registry->seededConfigValues({{QueryConfig::kQueryTemplateKey, "q1"}});
+  EXPECT_EQ(values.size(), 1);
+
+  QueryFeedbackStats stats;
+  stats.numExecutions = 1;
+  stats.outputVectors = 100;
+  stats.outputRows = 25'600;
+  stats.numSpilledExecutions = 1;
+  stats.numAbandonedPartialAggregations = 1;
+  registry->record("q1", stats);
+
+  auto queryCtx = std::make_shared<QueryCtx>(
+      nullptr,
+      std::unordered_map<std::string, std::string>{
+          {QueryConfig::kQueryTemplateKey, "q1"}});
+  const auto& config = queryCtx->queryConfig();
+  EXPECT_EQ(config.preferredOutputBatchRows(), 256);
+  EXPECT_EQ(config.abandonPartialAggregationMinRows(), 100);
+  EXPECT_EQ(config.spillPartitionBits(), 3);
+
+  // Explicit settings win over seeded defaults.
+  auto explicitCtx = std::make_shared<QueryCtx>(
+      nullptr,
+      std::unordered_map<std::string, std::string>{
+          {QueryConfig::kQueryTemplateKey, "q1"},
+          {QueryConfig::kPreferredOutputBatchRows, "2048"}});
+  EXPECT_EQ(explicitCtx->queryConfig().preferredOutputBatchRows(), 2048);
+
+  // Other templates are unaffected.
+  auto otherCtx = std::make_shared<QueryCtx>(
+      nullptr,
+      std::unordered_map<std::string, std::string>{
+          {QueryConfig::kQueryTemplateKey, "q2"}});
+  EXPECT_EQ(otherCtx->queryConfig().preferredOutputBatchRows(), 1024);
+}
+
+} // namespace facebook::velox::core::test
@@ -165,11 +165,55 @@ int32_t decode1To24(
   return i;
 }
 
+// Unpacks 4 fields of 25-32 bits at a time. Each field is gathered 64
+// bits wide from the byte containing its first bit and shifted into
+// place, so any start bit position is handled.
+template <uint8_t width, typename T>
+int32_t decode25To32(
+    const uint64_t* bits,
+    int32_t bitOffset,
+    const int32_t* rows,
+    int32_t numRows,
+    T* result) {
+  constexpr uint64_t kMask = bits::lowMask(width);
+  int32_t i = 0;
+  for (; i + 4 <= numRows; i += 4) {
+    auto indices =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows + i));
+    auto bitIndices = _mm_add_epi32(
+        _mm_mullo_epi32(indices, _mm_set1_epi32(width)),
+        _mm_set1_epi32(bitOffset));
+    auto byteIndices = _mm_srli_epi32(bitIndices, 3);
+    auto shifts =
+        _mm256_cvtepu32_epi64(_mm_and_si128(bitIndices, _mm_set1_epi32(7)));
+    auto data = _mm256_i32gather_epi64(
+        reinterpret_cast<const long long*>(bits), byteIndices, 1);
+    data = _mm256_and_si256(
+        _mm256_srlv_epi64(data, shifts), _mm256_set1_epi64x(kMask));
+    if (sizeof(T) == 4) {
+      auto fourInts = _mm256_permutevar8x32_epi32(
+          data, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6));
+      _mm_storeu_si128(
+          reinterpret_cast<__m128i*>(result + i),
+          _mm256_castsi256_si128(fourInts));
+    } else {
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(result + i), data);
+    }
+  }
+  return i;
+}
+
 #define WIDTH_CASE(width)                                                      \
   case width:                                                                  \
     i = decode1To24<width>(bits, bitOffset, rows.data(), numSafeRows, result); \
     break;
 
+#define WIDTH_CASE_WIDE(width)                             \
+  case width:                                              \
+    i = decode25To32<width>(                               \
+        bits, bitOffset, rows.data(), numSafeRows, result); \
+    break;
+
 } // namespace
 
 #endif
@@ -260,6 +304,14 @@ void unpack(
     WIDTH_CASE(22);
     WIDTH_CASE(23);
     WIDTH_CASE(24);
+    WIDTH_CASE_WIDE(25);
+    WIDTH_CASE_WIDE(26);
+    WIDTH_CASE_WIDE(27);
+    WIDTH_CASE_WIDE(28);
+    WIDTH_CASE_WIDE(29);
+    WIDTH_CASE_WIDE(30);
+    WIDTH_CASE_WIDE(31);
+    WIDTH_CASE_WIDE(32);
     default:
       break;
   }
@@ -76,15 +76,12 @@ bool CacheInputStream::Next(const void** buffer, int32_t* size) {
     auto offsetInQuantum = position_ % loadQuantum_;
     auto nextQuantum = position_ - offsetInQuantum + loadQuantum_;
     auto prefetchThreshold = loadQuantum_ * prefetchPct_ / 100;
-    if (!prefetchStarted_ && offsetInQuantum + *size > prefetchThreshold &&
-        position_ - offsetInQuantum + loadQuantum_ < region_.length) {
+    if (offsetInQuantum + *size > prefetchThreshold &&
+        nextQuantum < region_.length) {
       // We read past 'prefetchPct_' % of the current load quantum and the
-      // current load quantum is not the last in the region. Prefetch the next
-      // load quantum.
-      auto prefetchSize =
-          std::min(region_.length, nextQuantum + loadQuantum_) - nextQuantum;
-      prefetchStarted_ = bufferedInput_->prefetch(
-          Region{region_.offset + nextQuantum, prefetchSize});
+      // current load quantum is not the last in the region. Make sure the
+      // next 'prefetchDepth_' load quanta are scheduled for read-ahead.
+      maybePrefetch(nextQuantum);
     }
   }
   position_ += *size;
@@ -95,6 +92,46 @@ bool CacheInputStream::Next(const void** buffer, int32_t* size) {
   return true;
 }
 
+void CacheInputStream::maybePrefetch(uint64_t nextQuantum) {
+  if (prefetchEnd_ < nextQuantum) {
+    prefetchEnd_ = nextQuantum;
+  }
+  const auto target = std::min<uint64_t>(
+      region_.length,
+      nextQuantum + static_cast<uint64_t>(prefetchDepth_) * loadQuantum_);
+  while (prefetchEnd_ < target) {
+    const auto prefetchSize =
+        std::min<uint64_t>(region_.length, prefetchEnd_ + loadQuantum_) -
+        prefetchEnd_;
+    if (!bufferedInput_->prefetch(
+            Region{region_.offset + prefetchEnd_, prefetchSize})) {
+      // No memory to cover the load quantum. Retry from a later Next().
+      break;
+    }
+    prefetchEnd_ += prefetchSize;
+  }
+}
+
+void CacheInputStream::maybeDeepenPrefetch() {
+  if (prefetchDepth_ >= kMaxPrefetchDepth) {
+    return;
+  }
+  const bool denseAnyway = trackingId_.empty() ||
+      trackingId_.id() == StreamIdentifier::sequentialFile().id_;
+  if (!denseAnyway && tracker_) {
+    // Do not look further ahead for a sparse reader, e.g. a heavily
+    // filtered column. Deeper read-ahead would mostly load bytes that are
+    // never accessed.
+    const auto trackingData = tracker_->trackingData(trackingId_);
+    const auto readDensity =
+        (100 * trackingData.readBytes) / (1 + trackingData.referencedBytes);
+    if (readDensity < 80) {
+      return;
+    }
+  }
+  prefetchDepth_ = std::min<int32_t>(2 * prefetchDepth_, kMaxPrefetchDepth);
+}
+
 void CacheInputStream::BackUp(int32_t count) {
   DWIO_ENSURE_GE(count, 0, "can't backup negative distances");
 
@@ -169,7 +206,6 @@ void CacheInputStream::loadSync(Region region) {
   // so as not to double count when the individual parts are
   // hit.
   ioStats_->incRawBytesRead(region.length);
-  prefetchStarted_ = false;
   do {
     folly::SemiFuture<bool> wait(false);
     cache::RawFileCacheKey key{fileNum_, region.offset};
@@ -187,12 +223,22 @@ void CacheInputStream::loadSync(Region region) {
         std::move(wait).via(&exec).wait();
       }
       ioStats_->queryThreadIoLatency().increment(usec);
+      if (region.offset - region_.offset < prefetchEnd_) {
+        // Waited for the load of a quantum that was scheduled for
+        // read-ahead. Consumption is outpacing arrival.
+        maybeDeepenPrefetch();
+      }
       continue;
     }
     auto entry = pin_.checkedEntry();
     if (entry->isExclusive()) {
       // Missed memory cache. Trying to load from ssd cache, and if again
       // missed, fall back to remote fetching.
+      if (region.offset - region_.offset < prefetchEnd_) {
+        // The quantum was scheduled for read-ahead but its load did not
+        // complete in time or the entry was evicted before use.
+        maybeDeepenPrefetch();
+      }
       entry->setGroupId(groupId_);
       entry->setTrackingId(trackingId_);
       if (loadFromSsd(region, *entry)) {
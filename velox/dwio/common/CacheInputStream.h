@@ -85,7 +85,9 @@ class CacheInputStream : public SeekableInputStream {
   /// Next triggers the read ahead of te next quantum right away. a
   /// value of over 100 causes no prefetches to be made. If there is
   /// no memory to cover the load quantum to prefetch the prefetch
-  /// fails silently.
+  /// fails silently. Read-ahead starts one load quantum deep and
+  /// doubles up to kMaxPrefetchDepth quanta every time reading
+  /// catches up with a quantum whose read-ahead has not completed.
   void setPrefetchPct(int32_t pct) {
     prefetchPct_ = pct;
   }
@@ -96,13 +98,32 @@ class CacheInputStream : public SeekableInputStream {
     noRetention_ = true;
   }
 
+  /// Returns the number of load quanta scheduled ahead of the read position.
+  /// Testing only.
+  int32_t testingPrefetchDepth() const {
+    return prefetchDepth_;
+  }
+
  private:
+  // Maximum number of load quanta scheduled ahead of the read position.
+  static constexpr int32_t kMaxPrefetchDepth = 8;
+
   // Ensures that the current position is covered by 'pin_'.
   void loadPosition();
 
   // Synchronously sets 'pin_' to cover 'region'.
   void loadSync(Region region);
 
+  // Schedules read-ahead of up to 'prefetchDepth_' load quanta starting at
+  // 'nextQuantum', which is relative to 'region_.offset'. Advances
+  // 'prefetchEnd_' past the quanta that were scheduled.
+  void maybePrefetch(uint64_t nextQuantum);
+
+  // Doubles 'prefetchDepth_' up to kMaxPrefetchDepth unless 'tracker_'
+  // identifies 'this' as a sparse reader. Called when reading catches up
+  // with a quantum whose read-ahead has not completed.
+  void maybeDeepenPrefetch();
+
   // Returns true if there is an SSD cache and 'entry' is present there and
   // successfully loaded.
   bool loadFromSsd(Region region, cache::AsyncDataCacheEntry& entry);
@@ -148,9 +169,15 @@ class CacheInputStream : public SeekableInputStream {
   // Over 100 means no prefetch.
   int32_t prefetchPct_{200};
 
-  // True if prefetch f the next 'loadQuantum_' has been started. Cleared when
-  // moving to the next load quantum.
-  bool prefetchStarted_{false};
+  // Position relative to 'region_.offset' up to which load quanta have been
+  // scheduled for read-ahead.
+  uint64_t prefetchEnd_{0};
+
+  // Number of load quanta to schedule ahead of the read position. Doubled up
+  // to kMaxPrefetchDepth when a quantum inside the read-ahead window is not
+  // in cache by the time it is read, i.e. the reader consumes data faster
+  // than read-ahead delivers it.
+  int32_t prefetchDepth_{1};
 
   // True if a pin should be set to lowest retention score after
   // unpinning. This applies to sequential reads where a second access
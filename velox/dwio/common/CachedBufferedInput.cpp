@@ -15,10 +15,13 @@
  */
 
 #include "velox/dwio/common/CachedBufferedInput.h"
+#include "velox/common/base/Semaphore.h"
 #include "velox/common/memory/Allocation.h"
 #include "velox/common/process/TraceContext.h"
 #include "velox/dwio/common/CacheInputStream.h"
 
+#include <folly/ScopeGuard.h>
+
 DEFINE_int32(
     cache_prefetch_min_pct,
     80,
@@ -29,6 +32,13 @@ DEFINE_int64(
     128 << 20,
     "Maximum size of single coalesced IO");
 
+DEFINE_int32(
+    max_inflight_prefetches,
+    64,
+    "Maximum number of read-aheads in progress at any time across all "
+    "queries. Reads issued synchronously from query threads are not "
+    "limited. 0 means no limit.");
+
 namespace facebook::velox::dwio::common {
 
 using cache::CachePin;
@@ -40,6 +50,17 @@ using cache::SsdPin;
 using cache::TrackingId;
 using memory::MemoryAllocator;
 
+namespace {
+// Returns the process-wide limit on in-flight read-aheads shared by all
+// queries, nullptr if unlimited.
+Semaphore* FOLLY_NULLABLE inflightPrefetchLimit() {
+  static std::unique_ptr<Semaphore> limit = FLAGS_max_inflight_prefetches > 0
+      ? std::make_unique<Semaphore>(FLAGS_max_inflight_prefetches)
+      : nullptr;
+  return limit.get();
+}
+} // namespace
+
 std::unique_ptr<SeekableInputStream> CachedBufferedInput::enqueue(
     Region region,
     const StreamIdentifier* si = nullptr) {
@@ -273,9 +294,22 @@ void CachedBufferedInput::makeLoads(
     for (auto i = 0; i < allCoalescedLoads_.size(); ++i) {
       auto& load = allCoalescedLoads_[i];
       if (load->state() == LoadState::kPlanned) {
+        auto* limit = inflightPrefetchLimit();
+        if (limit && !limit->tryAcquire()) {
+          // The process-wide limit on in-flight read-aheads is reached.
+          // Leave the load planned; it is read synchronously on first use so
+          // foreground reads do not queue behind other queries' read-ahead.
+          ioStats_->throttledPrefetch().increment(load->size());
+          continue;
+        }
         prefetchSize_ += load->size();
-        executor_->add([pendingLoad = load]() {
+        executor_->add([pendingLoad = load, limit]() {
           process::TraceContext trace("Read Ahead");
+          auto guard = folly::makeGuard([limit]() {
+            if (limit) {
+              limit->release();
+            }
+          });
           pendingLoad->loadOrFuture(nullptr);
         });
       } else {
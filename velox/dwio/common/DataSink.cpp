@@ -25,6 +25,49 @@
 
 namespace facebook::velox::dwio::common {
 
+namespace {
+// Alignment of the staging buffers and of O_DIRECT writes.
+constexpr uint64_t kWriteAlignment = 4096;
+
+// Writes 'size' bytes from 'data' to 'fd', retrying short writes. 'name'
+// is used in error messages.
+void writeFully(
+    int fd,
+    const char* data,
+    uint64_t size,
+    const std::string& name) {
+  uint64_t offset = 0;
+  while (offset < size) {
+    // Write system call can write fewer bytes than requested.
+    auto bytesWritten = ::write(fd, data + offset, size - offset);
+
+    // errno should only be accessed when the return value is -1.
+    DWIO_ENSURE_NE(
+        bytesWritten,
+        -1,
+        "Bad write of ",
+        name,
+        " ErrorNo ",
+        errno,
+        " Remaining ",
+        size - offset);
+
+    // ensure the file is making some forward progress in each loop.
+    DWIO_ENSURE_GT(
+        bytesWritten,
+        0,
+        "No bytes transferred ",
+        name,
+        " Size: ",
+        size,
+        " Offset: ",
+        offset);
+
+    offset += bytesWritten;
+  }
+}
+} // namespace
+
 LocalFileSink::LocalFileSink(
     const std::string& name,
     const MetricsLogPtr& metricLogger,
@@ -43,40 +86,158 @@ LocalFileSink::LocalFileSink(
 
 void LocalFileSink::write(std::vector<DataBuffer<char>>& buffers) {
   writeImpl(buffers, [&](auto& buffer) {
-    size_t size = buffer.size();
-    size_t offset = 0;
-    while (offset < size) {
-      // Write system call can write fewer bytes than requested.
-      auto bytesWritten = ::write(file_, buffer.data() + offset, size - offset);
-
-      // errno should only be accessed when the return value is -1.
-      DWIO_ENSURE_NE(
-          bytesWritten,
-          -1,
-          "Bad write of ",
-          name_,
-          " ErrorNo ",
-          errno,
-          " Remaining ",
-          size - offset);
-
-      // ensure the file is making some forward progress in each loop.
-      DWIO_ENSURE_GT(
-          bytesWritten,
-          0,
-          "No bytes transferred ",
-          name_,
-          " Size: ",
-          size,
-          " Offset: ",
-          offset);
-
-      offset += bytesWritten;
-    }
-    return size;
+    writeFully(file_, buffer.data(), buffer.size(), name_);
+    return buffer.size();
+  });
+}
+
+WriteBehindFileSink::WriteBehindFileSink(
+    const std::string& name,
+    const MetricsLogPtr& metricLogger,
+    IoStatistics* stats,
+    bool directIo,
+    uint64_t bufferSize,
+    uint64_t syncInterval)
+    : DataSink{name, metricLogger, stats},
+      bufferSize_{
+          (bufferSize + kWriteAlignment - 1) / kWriteAlignment *
+          kWriteAlignment},
+      syncInterval_{syncInterval},
+      fillBuffer_{
+          static_cast<char*>(::aligned_alloc(kWriteAlignment, bufferSize_)),
+          ::free},
+      pendingBuffer_{
+          static_cast<char*>(::aligned_alloc(kWriteAlignment, bufferSize_)),
+          ::free} {
+  auto dir = fs::path(name).parent_path();
+  if (!fs::exists(dir)) {
+    DWIO_ENSURE(velox::common::generateFileDirectory(dir.c_str()));
+  }
+  int32_t flags = O_CREAT | O_WRONLY | O_TRUNC;
+#ifdef O_DIRECT
+  if (directIo) {
+    directIo_ = true;
+    flags |= O_DIRECT;
+  }
+#endif
+  file_ = open(name_.c_str(), flags, S_IRUSR | S_IWUSR);
+  if (file_ == -1 && directIo_ && errno == EINVAL) {
+    // The file system does not support O_DIRECT, e.g. tmpfs. Fall back to
+    // buffered writes.
+    directIo_ = false;
+    file_ =
+        open(name_.c_str(), O_CREAT | O_WRONLY | O_TRUNC, S_IRUSR | S_IWUSR);
+  }
+  if (file_ == -1) {
+    markClosed();
+    DWIO_RAISE("Can't open ", name_, " ErrorNo ", errno, ": ", strerror(errno));
+  }
+  writer_ = std::thread([this]() { writerLoop(); });
+}
+
+void WriteBehindFileSink::write(std::vector<DataBuffer<char>>& buffers) {
+  writeImpl(buffers, [&](auto& buffer) {
+    append(buffer.data(), buffer.size());
+    return buffer.size();
   });
 }
 
+void WriteBehindFileSink::append(const char* data, uint64_t size) {
+  while (size > 0) {
+    const auto copySize = std::min(size, bufferSize_ - fillSize_);
+    ::memcpy(fillBuffer_.get() + fillSize_, data, copySize);
+    fillSize_ += copySize;
+    data += copySize;
+    size -= copySize;
+    if (fillSize_ == bufferSize_) {
+      waitForWriter();
+      enqueueFillBuffer();
+    }
+  }
+}
+
+void WriteBehindFileSink::enqueueFillBuffer() {
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    fillBuffer_.swap(pendingBuffer_);
+    pendingSize_ = fillSize_;
+    fillSize_ = 0;
+  }
+  writerCv_.notify_one();
+}
+
+void WriteBehindFileSink::waitForWriter() {
+  std::unique_lock<std::mutex> l(mutex_);
+  producerCv_.wait(l, [&]() { return pendingSize_ == 0; });
+  if (writerError_) {
+    auto error = writerError_;
+    writerError_ = nullptr;
+    std::rethrow_exception(error);
+  }
+}
+
+void WriteBehindFileSink::writerLoop() {
+  std::unique_lock<std::mutex> l(mutex_);
+  for (;;) {
+    writerCv_.wait(l, [&]() { return stopped_ || pendingSize_ > 0; });
+    if (pendingSize_ == 0) {
+      // Stopped with nothing left to write.
+      return;
+    }
+    const auto writeSize = pendingSize_;
+    l.unlock();
+    try {
+#ifdef O_DIRECT
+      if (directIo_ && writeSize % kWriteAlignment != 0) {
+        // The final partial buffer is not aligned for O_DIRECT. Drop the
+        // flag for the tail write.
+        ::fcntl(file_, F_SETFL, ::fcntl(file_, F_GETFL) & ~O_DIRECT);
+        directIo_ = false;
+      }
+#endif
+      writeFully(file_, pendingBuffer_.get(), writeSize, name_);
+      bytesSinceSync_ += writeSize;
+      if (bytesSinceSync_ >= syncInterval_) {
+        ::fsync(file_);
+        bytesSinceSync_ = 0;
+      }
+      l.lock();
+    } catch (...) {
+      l.lock();
+      writerError_ = std::current_exception();
+    }
+    pendingSize_ = 0;
+    producerCv_.notify_one();
+  }
+}
+
+void WriteBehindFileSink::doClose() {
+  std::exception_ptr error;
+  try {
+    // Hand over the partially filled buffer and wait for all writes.
+    waitForWriter();
+    if (fillSize_ > 0) {
+      enqueueFillBuffer();
+      waitForWriter();
+    }
+  } catch (...) {
+    error = std::current_exception();
+  }
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    stopped_ = true;
+  }
+  writerCv_.notify_one();
+  if (writer_.joinable()) {
+    writer_.join();
+  }
+  ::fsync(file_);
+  ::close(file_);
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
 static std::vector<DataSink::Factory>& factories() {
   static std::vector<DataSink::Factory> factories;
   return factories;
@@ -17,6 +17,10 @@
 #pragma once
 
 #include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
 
 #include "velox/dwio/common/Closeable.h"
 #include "velox/dwio/common/DataBuffer.h"
@@ -159,6 +163,98 @@ class LocalFileSink : public DataSink {
   int file_;
 };
 
+/**
+ * A local file sink that stages data in two aligned buffers and writes
+ * full buffers to the file from a background thread, so that the file
+ * writer does not block on device latency. The file can be opened with
+ * O_DIRECT where supported, in which case all writes except the final
+ * partial buffer bypass the OS page cache. The file is fsync'ed after
+ * every 'syncInterval' written bytes and on close, so that close does
+ * not flush the whole file at once.
+ */
+class WriteBehindFileSink : public DataSink {
+ public:
+  /// Size of each of the two staging buffers.
+  static constexpr uint64_t kDefaultBufferSize = 8 << 20;
+
+  /// Number of bytes written between fsyncs.
+  static constexpr uint64_t kDefaultSyncInterval = 64 << 20;
+
+  explicit WriteBehindFileSink(
+      const std::string& name,
+      const MetricsLogPtr& metricLogger = MetricsLog::voidLog(),
+      IoStatistics* stats = nullptr,
+      bool directIo = false,
+      uint64_t bufferSize = kDefaultBufferSize,
+      uint64_t syncInterval = kDefaultSyncInterval);
+
+  ~WriteBehindFileSink() override {
+    destroy();
+  }
+
+  using DataSink::write;
+
+  void write(std::vector<DataBuffer<char>>& buffers) override;
+
+ protected:
+  void doClose() override;
+
+ private:
+  // Appends [data, data + size) to the fill buffer, handing full buffers
+  // over to the writer thread.
+  void append(const char* data, uint64_t size);
+
+  // Hands the fill buffer over to the writer thread. The caller must have
+  // checked that the writer thread has no pending buffer.
+  void enqueueFillBuffer();
+
+  // Waits until the writer thread has no pending buffer. Rethrows an
+  // error from the writer thread, if any.
+  void waitForWriter();
+
+  // Entry point of the writer thread.
+  void writerLoop();
+
+  const uint64_t bufferSize_;
+  const uint64_t syncInterval_;
+  int file_;
+
+  // True if the file was opened with O_DIRECT. Cleared by the writer
+  // thread before an unaligned tail write.
+  bool directIo_{false};
+
+  // The buffer the producer appends to and the buffer owned by the writer
+  // thread while 'pendingSize_' is non-zero. The buffers are swapped when
+  // the fill buffer is handed over.
+  std::unique_ptr<char, decltype(&::free)> fillBuffer_;
+  std::unique_ptr<char, decltype(&::free)> pendingBuffer_;
+
+  // Number of bytes in 'fillBuffer_'. Accessed only by the producer.
+  uint64_t fillSize_{0};
+
+  std::mutex mutex_;
+  std::condition_variable producerCv_;
+  std::condition_variable writerCv_;
+
+  // Number of bytes in 'pendingBuffer_' left to write. Protected by
+  // 'mutex_'.
+  uint64_t pendingSize_{0};
+
+  // Number of bytes written since the last fsync. Accessed only by the
+  // writer thread.
+  uint64_t bytesSinceSync_{0};
+
+  // True when close tells the writer thread to exit. Protected by
+  // 'mutex_'.
+  bool stopped_{false};
+
+  // Error raised on the writer thread, rethrown to the producer. Protected
+  // by 'mutex_'.
+  std::exception_ptr writerError_;
+
+  std::thread writer_;
+};
+
 class MemorySink : public DataSink {
  public:
   MemorySink(
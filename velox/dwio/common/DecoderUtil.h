@@ -171,6 +171,17 @@ void fixedWidthScan(
       !std::is_same_v<TFilter, velox::common::AlwaysTrue>;
   constexpr bool hasHook = !std::is_same_v<THook, NoHook>;
   auto rawValues = reinterpret_cast<T*>(voidValues);
+  if constexpr (!hasFilter && !hasHook && !scatter) {
+    // All rows selected with no nulls, no filter and no hook: the
+    // encoding is a contiguous run of Ts, so copy it into place in
+    // one go with no per-row bookkeeping.
+    if (rows.back() == rows.size() - 1) {
+      readContiguous<T>(
+          rows.size(), input, rawValues + numValues, bufferStart, bufferEnd);
+      numValues += rows.size();
+      return;
+    }
+  }
   loopOverBuffers<T>(
       rows,
       0,
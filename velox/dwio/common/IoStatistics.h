@@ -99,6 +99,10 @@ class IoStatistics {
     return queryThreadIoLatency_;
   }
 
+  IoCounter& throttledPrefetch() {
+    return throttledPrefetch_;
+  }
+
   void incOperationCounters(
       const std::string& operation,
       const uint64_t resourceThrottleCount,
@@ -139,6 +143,11 @@ class IoStatistics {
   // issued IO or for an in-progress read-ahead to finish.
   IoCounter queryThreadIoLatency_;
 
+  // Read-aheads not issued because the process-wide limit on in-flight
+  // background IO was reached. These are read synchronously on first use
+  // instead.
+  IoCounter throttledPrefetch_;
+
   std::unordered_map<std::string, OperationCounters> operationStats_;
   mutable std::mutex operationStatsMutex_;
 };
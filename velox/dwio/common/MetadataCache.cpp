@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/common/MetadataCache.h"
+
+#include <fmt/format.h>
+#include <gflags/gflags.h>
+
+DEFINE_int32(
+    file_metadata_cache_size,
+    10'000,
+    "Max number of parsed file metadata entries (e.g. Parquet footers) to "
+    "cache process-wide. 0 disables metadata caching.");
+
+namespace facebook::velox::dwio::common {
+
+// static
+MetadataCache* MetadataCache::instance() {
+  if (FLAGS_file_metadata_cache_size == 0) {
+    return nullptr;
+  }
+  static MetadataCache cache(FLAGS_file_metadata_cache_size);
+  return &cache;
+}
+
+// static
+std::string MetadataCache::makeKey(std::string_view path, uint64_t size) {
+  return fmt::format("{}:{}", path, size);
+}
+
+std::shared_ptr<const void> MetadataCache::get(const std::string& key) {
+  std::lock_guard<std::mutex> l(mutex_);
+  return cache_.get(key).value_or(nullptr);
+}
+
+void MetadataCache::put(
+    const std::string& key,
+    std::shared_ptr<const void> metadata) {
+  std::lock_guard<std::mutex> l(mutex_);
+  cache_.add(key, std::move(metadata));
+}
+
+SimpleLRUCacheStats MetadataCache::stats() {
+  std::lock_guard<std::mutex> l(mutex_);
+  return cache_.getStats();
+}
+
+} // namespace facebook::velox::dwio::common
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include "velox/common/caching/SimpleLRUCache.h"
+
+namespace facebook::velox::dwio::common {
+
+/// Process-wide cache of parsed file metadata, e.g. Parquet thrift footers
+/// and the schemas derived from them. Splits of the same file, whether in one
+/// query or across queries, reuse the parsed objects instead of re-reading
+/// and re-parsing the footer. Entries are keyed by file path plus file size,
+/// matching the identity assumption of the file handle cache (files are
+/// immutable once written). Values are shared_ptrs to immutable parsed
+/// objects; each reader casts an entry back to its own metadata type.
+class MetadataCache {
+ public:
+  /// Returns the process-wide cache, or nullptr if metadata caching is
+  /// disabled (--file_metadata_cache_size=0).
+  static MetadataCache* instance();
+
+  /// Returns the cache key for a file at 'path' of 'size' bytes.
+  static std::string makeKey(std::string_view path, uint64_t size);
+
+  /// Returns the cached metadata for 'key', or nullptr on a miss.
+  std::shared_ptr<const void> get(const std::string& key);
+
+  /// Adds 'metadata' for 'key'.
+  void put(const std::string& key, std::shared_ptr<const void> metadata);
+
+  SimpleLRUCacheStats stats();
+
+ private:
+  explicit MetadataCache(size_t maxEntries) : cache_(maxEntries) {}
+
+  std::mutex mutex_;
+  SimpleLRUCache<std::string, std::shared_ptr<const void>> cache_;
+};
+
+} // namespace facebook::velox::dwio::common
@@ -29,6 +29,10 @@
 #include "velox/dwio/common/ScanSpec.h"
 #include "velox/dwio/common/encryption/Encryption.h"
 
+namespace facebook::velox {
+class StringAlphabetInterner;
+}
+
 namespace facebook {
 namespace velox {
 namespace dwio {
@@ -95,6 +99,7 @@ class RowReaderOptions {
   std::shared_ptr<ColumnSelector> selector_;
   std::shared_ptr<velox::common::ScanSpec> scanSpec_ = nullptr;
   std::shared_ptr<velox::common::MetadataFilter> metadataFilter_;
+  std::shared_ptr<velox::StringAlphabetInterner> stringAlphabetInterner_;
   // Node id for map column to a list of keys to be projected as a struct.
   std::unordered_map<uint32_t, std::vector<std::string>> flatmapNodeIdAsStruct_;
   // Optional executors to enable internal reader parallelism.
@@ -247,6 +252,19 @@ class RowReaderOptions {
     metadataFilter_ = std::move(metadataFilter);
   }
 
+  const std::shared_ptr<velox::StringAlphabetInterner>&
+  getStringAlphabetInterner() const {
+    return stringAlphabetInterner_;
+  }
+
+  // Sets the query-wide pool that dedupes string dictionary alphabets by
+  // content so readers return shared canonical alphabet vectors. May be
+  // nullptr, in which case each reader keeps its own copy.
+  void setStringAlphabetInterner(
+      std::shared_ptr<velox::StringAlphabetInterner> interner) {
+    stringAlphabetInterner_ = std::move(interner);
+  }
+
   void setFlatmapNodeIdsAsStruct(
       std::unordered_map<uint32_t, std::vector<std::string>>
           flatmapNodeIdsAsStruct) {
@@ -56,7 +56,17 @@ ScanSpec* ScanSpec::getOrCreateChild(const Subfield& subfield) {
       }
     }
     if (!found) {
-      container->children_.push_back(std::make_unique<ScanSpec>(*element));
+      auto newChild = std::make_unique<ScanSpec>(*element);
+      {
+        // Keep the stable children in sync when a child is added after
+        // the list was first handed out, e.g. when a scan is widened
+        // mid-way through a split.
+        std::lock_guard<std::mutex> l(container->mutex_);
+        if (!container->stableChildren_.empty()) {
+          container->stableChildren_.push_back(newChild.get());
+        }
+      }
+      container->children_.push_back(std::move(newChild));
       container = container->children_.back().get();
     }
   }
@@ -67,20 +77,63 @@ uint64_t ScanSpec::newRead() {
   if (!numReads_) {
     reorder();
   } else if (enableFilterReorder_) {
-    for (auto i = 1; i < children_.size(); ++i) {
-      if (!children_[i]->filter_) {
-        break;
-      }
-      if (children_[i - 1]->selectivity_.timeToDropValue() >
-          children_[i]->selectivity_.timeToDropValue()) {
-        reorder();
-        break;
+    if (++readsSinceTryout_ >= kTryoutEveryReads) {
+      tryoutDemotedFilter();
+    } else {
+      for (auto i = 1; i < children_.size(); ++i) {
+        if (!children_[i]->filter_) {
+          break;
+        }
+        if (children_[i - 1]->selectivity_.timeToDropValue() >
+            children_[i]->selectivity_.timeToDropValue()) {
+          ++numAdaptiveReorders_;
+          reorder();
+          break;
+        }
       }
     }
   }
   return numReads_++;
 }
 
+void ScanSpec::tryoutDemotedFilter() {
+  readsSinceTryout_ = 0;
+  size_t numFilters = 0;
+  while (numFilters < children_.size() && children_[numFilters]->filter_) {
+    ++numFilters;
+  }
+  if (numFilters < 2) {
+    return;
+  }
+  // Run the lowest ranked filter first for the next batch so that its
+  // stats track the current data. Without the tryout a filter demoted
+  // on an early stripe keeps stale stats forever and can never regain
+  // its place when the data changes. The regular out-of-order check
+  // restores the order on the following read if the filter is still
+  // expensive.
+  ++numAdaptiveReorders_;
+  std::rotate(
+      children_.begin(),
+      children_.begin() + numFilters - 1,
+      children_.begin() + numFilters);
+}
+
+void ScanSpec::decayAdaptation() {
+  selectivity_.decay();
+  for (auto& child : children_) {
+    child->decayAdaptation();
+  }
+  reorder();
+}
+
+int64_t ScanSpec::numAdaptiveReorders() const {
+  int64_t result = numAdaptiveReorders_;
+  for (auto& child : children_) {
+    result += child->numAdaptiveReorders();
+  }
+  return result;
+}
+
 void ScanSpec::reorder() {
   if (children_.empty()) {
     return;
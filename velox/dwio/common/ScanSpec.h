@@ -300,6 +300,18 @@ class ScanSpec {
     enableFilterReorder_ = enableFilterReorder;
   }
 
+  // Ages out accumulated filter selectivity and reorders the filters on
+  // what remains. Called at stripe/row group boundaries so that the
+  // order adapts to the data at hand: stats from earlier stripes still
+  // break ties but a change in the data quickly overrides them.
+  void decayAdaptation();
+
+  // Returns the number of times 'this' or a descendant reordered its
+  // filters while reading because the observed cost order changed,
+  // including tryouts of demoted filters. Exported in table scan
+  // runtime stats.
+  int64_t numAdaptiveReorders() const;
+
   // Returns the child which produces values for 'channel'. Throws if not found.
   ScanSpec& getChildByChannel(column_index_t channel);
 
@@ -348,6 +360,13 @@ class ScanSpec {
  private:
   void reorder();
 
+  // Moves the lowest ranked filter to the front for the next batch so
+  // that its stats track the current data. See newRead().
+  void tryoutDemotedFilter();
+
+  // Number of reads between tryouts of the lowest ranked filter.
+  static constexpr uint64_t kTryoutEveryReads = 256;
+
   // Serializes stableChildren().
   std::mutex mutex_;
 
@@ -390,6 +409,14 @@ class ScanSpec {
   // Sort children by filtering efficiency.
   bool enableFilterReorder_ = true;
 
+  // Number of reads since the lowest ranked filter was last tried out
+  // at the front.
+  uint64_t readsSinceTryout_ = 0;
+
+  // Number of selectivity driven reorders and tryouts of 'this'. Does
+  // not include children.
+  int64_t numAdaptiveReorders_ = 0;
+
   // Specification of action on child fields. This is filled in as
   // follows: Top level ScanSpec: All top level fields mentioned are
   // specified.  Nested struct/map/list: If filter-only,
@@ -245,6 +245,9 @@ void SelectiveColumnReader::getFlatValues<int8_t, bool>(
       numValues_,
       std::move(boolValues),
       std::move(stringBuffers_));
+  if (!anyNulls_) {
+    (*result)->setNullCount(0);
+  }
 }
 
 template <>
@@ -287,6 +290,76 @@ void SelectiveColumnReader::compactScalarValues<bool, bool>(
   values_->setSize(bits::nbytes(numValues_));
 }
 
+template <>
+void SelectiveColumnReader::compactScalarValues<StringView, StringView>(
+    RowSet rows,
+    bool isFinal) {
+  VELOX_CHECK_LE(rows.size(), numValues_);
+  VELOX_CHECK(!rows.empty());
+  if (!values_ || rows.size() == numValues_) {
+    if (values_) {
+      values_->setSize(numValues_ * sizeof(StringView));
+    }
+    return;
+  }
+  // A StringView is a pair of 64 bit lanes. Values are moved a vector
+  // of lanes at a time with simd::filterPairs. The padding in
+  // 'values_' allows the last load and store to run over the end.
+  constexpr int32_t kWidth = xsimd::batch<int64_t>::size / 2;
+  auto sourceWords = reinterpret_cast<int64_t*>(rawValues_);
+  RowSet sourceRows;
+  // The row numbers corresponding to elements in 'values_' are in
+  // 'valueRows_' if values have been accessed before. Otherwise
+  // they are in 'outputRows_' if these are non-empty (there is a
+  // filter) and in 'inputRows_' otherwise.
+  if (!valueRows_.empty()) {
+    sourceRows = valueRows_;
+  } else if (!outputRows_.empty()) {
+    sourceRows = outputRows_;
+  } else {
+    sourceRows = inputRows_;
+  }
+  if (valueRows_.empty()) {
+    valueRows_.resize(rows.size());
+  }
+  vector_size_t rowIndex = 0;
+  auto nextRow = rows[rowIndex];
+  bool moveNulls = shouldMoveNulls(rows);
+  bool atEnd = false;
+  for (size_t i = 0; i < numValues_ && !atEnd; i += kWidth) {
+    auto firstTarget = rowIndex;
+    int32_t mask = 0;
+    auto end = std::min<size_t>(i + kWidth, numValues_);
+    for (auto j = i; j < end; ++j) {
+      if (sourceRows[j] < nextRow) {
+        continue;
+      }
+      VELOX_DCHECK(sourceRows[j] == nextRow);
+      mask |= 1 << (j - i);
+      if (moveNulls && rowIndex != j) {
+        bits::setBit(
+            rawResultNulls_, rowIndex, bits::isBitSet(rawResultNulls_, j));
+      }
+      if (!isFinal) {
+        valueRows_[rowIndex] = nextRow;
+      }
+      rowIndex++;
+      if (rowIndex >= rows.size()) {
+        atEnd = true;
+        break;
+      }
+      nextRow = rows[rowIndex];
+    }
+    if (mask) {
+      simd::filterPairs(xsimd::load_unaligned(sourceWords + 2 * i), mask)
+          .store_unaligned(sourceWords + 2 * firstTarget);
+    }
+  }
+  numValues_ = rows.size();
+  valueRows_.resize(numValues_);
+  values_->setSize(numValues_ * sizeof(StringView));
+}
+
 char* SelectiveColumnReader::copyStringValue(folly::StringPiece value) {
   uint64_t size = value.size();
   if (stringBuffers_.empty() || rawStringUsed_ + size > rawStringSize_) {
@@ -144,6 +144,11 @@ void SelectiveColumnReader::getFlatValues(
       numValues_,
       values_,
       std::move(stringBuffers_));
+  if (!anyNulls_) {
+    // Assert the absence of nulls so that downstream consumers can
+    // skip per-row null checks.
+    (*result)->setNullCount(0);
+  }
 }
 
 template <>
@@ -270,6 +275,11 @@ void SelectiveColumnReader::compactScalarValues<bool, bool>(
     RowSet rows,
     bool isFinal);
 
+template <>
+void SelectiveColumnReader::compactScalarValues<StringView, StringView>(
+    RowSet rows,
+    bool isFinal);
+
 inline int32_t sizeOfIntKind(TypeKind kind) {
   switch (kind) {
     case TypeKind::SMALLINT:
@@ -16,6 +16,9 @@
 
 #include "velox/dwio/common/SelectiveStructColumnReader.h"
 
+#include <condition_variable>
+#include <mutex>
+
 #include "velox/dwio/common/ColumnLoader.h"
 
 namespace facebook::velox::dwio::common {
@@ -129,6 +132,10 @@ void SelectiveStructColumnReaderBase::read(
   }
 
   VELOX_CHECK(!children_.empty());
+  // Columns with no filter are mutually independent and are read after
+  // the filters, when the final row set is known. With a decoding
+  // executor they decode in parallel.
+  std::vector<SelectiveColumnReader*> nonFilterReaders;
   auto& childSpecs = scanSpec_->children();
   for (size_t i = 0; i < childSpecs.size(); ++i) {
     auto& childSpec = childSpecs[i];
@@ -160,9 +167,12 @@ void SelectiveStructColumnReaderBase::read(
         break;
       }
     } else {
-      reader->read(offset, activeRows, structNulls);
+      nonFilterReaders.push_back(reader);
     }
   }
+  if (!activeRows.empty()) {
+    readNonFilterColumns(nonFilterReaders, offset, activeRows, structNulls);
+  }
   // If this adds nulls, the field readers will miss a value for each null added
   // here.
   recordParentNullsInChildren(offset, rows);
@@ -174,6 +184,58 @@ void SelectiveStructColumnReaderBase::read(
   readOffset_ = offset + rows.back() + 1;
 }
 
+void SelectiveStructColumnReaderBase::readNonFilterColumns(
+    const std::vector<SelectiveColumnReader*>& readers,
+    vector_size_t offset,
+    RowSet rows,
+    const uint64_t* structNulls) {
+  if (decodingExecutor_ == nullptr || readers.size() < 2) {
+    for (auto* reader : readers) {
+      reader->read(offset, rows, structNulls);
+    }
+    return;
+  }
+  // Each reader writes only its own streams and buffers, so the reads
+  // are dispatched to the executor while the first one runs on the
+  // caller thread. The caller always waits for all dispatched reads,
+  // also on error, because they reference state on this stack.
+  std::mutex mutex;
+  std::condition_variable allDone;
+  int32_t numPending = readers.size() - 1;
+  std::exception_ptr error;
+  for (size_t i = 1; i < readers.size(); ++i) {
+    auto* reader = readers[i];
+    decodingExecutor_->add([&, reader]() {
+      try {
+        reader->read(offset, rows, structNulls);
+      } catch (...) {
+        std::lock_guard<std::mutex> l(mutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+      }
+      {
+        std::lock_guard<std::mutex> l(mutex);
+        --numPending;
+      }
+      allDone.notify_one();
+    });
+  }
+  try {
+    readers[0]->read(offset, rows, structNulls);
+  } catch (...) {
+    std::lock_guard<std::mutex> l(mutex);
+    if (!error) {
+      error = std::current_exception();
+    }
+  }
+  std::unique_lock<std::mutex> l(mutex);
+  allDone.wait(l, [&]() { return numPending == 0; });
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
 void SelectiveStructColumnReaderBase::recordParentNullsInChildren(
     vector_size_t offset,
     RowSet rows) {
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <folly/Executor.h>
+
 #include "velox/dwio/common/SelectiveColumnReaderInternal.h"
 
 namespace facebook::velox::dwio::common {
@@ -95,6 +97,14 @@ class SelectiveStructColumnReaderBase : public SelectiveColumnReader {
     return debugString_;
   }
 
+  /// Decodes independent projected columns of 'this' in parallel on
+  /// 'executor'. 'executor' must outlive 'this'. Used for stripes so
+  /// large that decoding them on the one driver that owns the split
+  /// would serialize the pipeline.
+  void setDecodingExecutor(folly::Executor* executor) {
+    decodingExecutor_ = executor;
+  }
+
  protected:
   SelectiveStructColumnReaderBase(
       const std::shared_ptr<const dwio::common::TypeWithId>& requestedType,
@@ -112,6 +122,16 @@ class SelectiveStructColumnReaderBase : public SelectiveColumnReader {
   // know how much to skip when seeking forward within the row group.
   void recordParentNullsInChildren(vector_size_t offset, RowSet rows);
 
+  // Reads the columns that carry no filter for 'rows'. These are
+  // mutually independent, so with a decoding executor they decode in
+  // parallel. Called after the filters have run, hence all readers see
+  // the same final row set.
+  void readNonFilterColumns(
+      const std::vector<SelectiveColumnReader*>& readers,
+      vector_size_t offset,
+      RowSet rows,
+      const uint64_t* structNulls);
+
   bool hasMutation() const override {
     return hasMutation_;
   }
@@ -135,6 +155,11 @@ class SelectiveStructColumnReaderBase : public SelectiveColumnReader {
   // around for lazy columns.
   bool hasMutation_ = false;
 
+  // If set, independent projected columns are decoded in parallel on
+  // this executor. Not owned. Set on the top level reader when the row
+  // reader options supply a decoding executor.
+  folly::Executor* decodingExecutor_ = nullptr;
+
   // Context information obtained from ExceptionContext. Stored here
   // so that LazyVector readers under this can add this to their
   // ExceptionContext. Allows contextualizing reader errors to split
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/common/SharedDictionaryCache.h"
+
+#include "velox/common/memory/Memory.h"
+
+DEFINE_int32(
+    dictionary_cache_max_mb,
+    64,
+    "Maximum size in MB of the process-wide cache of decoded column "
+    "dictionaries shared between splits of the same files. 0 disables "
+    "the cache.");
+
+namespace facebook::velox::dwio::common {
+
+SharedDictionaryCache::SharedDictionaryCache(int64_t maxBytes)
+    : maxBytes_(maxBytes),
+      pool_(
+          maxBytes_ > 0
+              ? memory::addDefaultLeafMemoryPool("SharedDictionaryCache")
+              : nullptr) {}
+
+// static
+SharedDictionaryCache& SharedDictionaryCache::instance() {
+  static SharedDictionaryCache cache(
+      static_cast<int64_t>(FLAGS_dictionary_cache_max_mb) << 20);
+  return cache;
+}
+
+DictionaryValues SharedDictionaryCache::get(uint64_t fileNum, uint64_t offset) {
+  if (!enabled()) {
+    return {};
+  }
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = entries_.find(Key{fileNum, offset});
+  if (it == entries_.end()) {
+    return {};
+  }
+  lruList_.splice(lruList_.begin(), lruList_, it->second.lruPosition);
+  return it->second.dictionary;
+}
+
+void SharedDictionaryCache::put(
+    const StringIdLease& file,
+    uint64_t offset,
+    const DictionaryValues& dictionary) {
+  if (!enabled() || !file.hasValue() || !dictionary.values) {
+    return;
+  }
+  Key key{file.id(), offset};
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    if (entries_.count(key)) {
+      return;
+    }
+  }
+  // Copy the buffers into the cache's pool outside of 'mutex_'. The copy
+  // outlives the inserting reader's pool, the original does not.
+  DictionaryValues copy;
+  copy.numValues = dictionary.numValues;
+  copy.sorted = dictionary.sorted;
+  copy.values =
+      AlignedBuffer::allocate<char>(dictionary.values->size(), pool_.get());
+  memcpy(
+      copy.values->asMutable<char>(),
+      dictionary.values->as<char>(),
+      dictionary.values->size());
+  if (dictionary.strings) {
+    copy.strings =
+        AlignedBuffer::allocate<char>(dictionary.strings->size(), pool_.get());
+    memcpy(
+        copy.strings->asMutable<char>(),
+        dictionary.strings->as<char>(),
+        dictionary.strings->size());
+    // The values are StringViews into 'dictionary.strings'. Rebase the out
+    // of line ones onto the copied characters.
+    auto* views = copy.values->asMutable<StringView>();
+    auto* oldBase = dictionary.strings->as<char>();
+    auto* newBase = copy.strings->as<char>();
+    for (auto i = 0; i < copy.numValues; ++i) {
+      if (!views[i].isInline()) {
+        views[i] =
+            StringView(newBase + (views[i].data() - oldBase), views[i].size());
+      }
+    }
+  }
+  int64_t bytes = copy.values->capacity() +
+      (copy.strings ? copy.strings->capacity() : 0);
+
+  std::lock_guard<std::mutex> l(mutex_);
+  auto [it, inserted] = entries_.try_emplace(key);
+  if (!inserted) {
+    // Another thread cached the same dictionary first.
+    return;
+  }
+  lruList_.push_front(key);
+  it->second = Entry{file, std::move(copy), bytes, lruList_.begin()};
+  cachedBytes_ += bytes;
+  evictLocked();
+}
+
+void SharedDictionaryCache::evictLocked() {
+  while (cachedBytes_ > maxBytes_ && !lruList_.empty()) {
+    auto it = entries_.find(lruList_.back());
+    VELOX_CHECK(it != entries_.end());
+    cachedBytes_ -= it->second.bytes;
+    entries_.erase(it);
+    lruList_.pop_back();
+  }
+}
+
+void SharedDictionaryCache::clear() {
+  std::lock_guard<std::mutex> l(mutex_);
+  entries_.clear();
+  lruList_.clear();
+  cachedBytes_ = 0;
+}
+
+} // namespace facebook::velox::dwio::common
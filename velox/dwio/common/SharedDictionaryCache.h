@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <list>
+#include <mutex>
+
+#include "velox/common/base/BitUtil.h"
+#include "velox/common/caching/StringIdMap.h"
+#include "velox/dwio/common/SelectiveColumnReader.h"
+
+DECLARE_int32(dictionary_cache_max_mb);
+
+namespace facebook::velox::dwio::common {
+
+/// Process-wide cache of decoded column dictionaries, keyed by file id
+/// from fileIds() and the file offset of the dictionary's stream. Splits
+/// of the same file and columns repeated across partitioned files hit the
+/// same decoded alphabet, so the decode is done once and the buffers are
+/// shared between readers via the Buffer reference count. Entries are
+/// copied into a cache-owned memory pool on insert, hence their lifetime
+/// is independent of the inserting reader's query. Evicts in LRU order
+/// when over budget. All methods are thread safe.
+class SharedDictionaryCache {
+ public:
+  explicit SharedDictionaryCache(int64_t maxBytes);
+
+  /// Returns the process-wide instance, sized according to
+  /// FLAGS_dictionary_cache_max_mb.
+  static SharedDictionaryCache& instance();
+
+  /// True if a zero budget disabled the cache. get() and put() are no-ops
+  /// in this case.
+  bool enabled() const {
+    return maxBytes_ > 0;
+  }
+
+  /// Returns the dictionary cached for the stream at 'offset' of the file
+  /// with id 'fileNum', or a DictionaryValues with nullptr 'values' if not
+  /// cached. The returned buffers stay valid after eviction as long as the
+  /// caller holds them.
+  DictionaryValues get(uint64_t fileNum, uint64_t offset);
+
+  /// Caches 'dictionary' for the stream at 'offset' of the file of 'file'.
+  /// The buffers are copied into the cache's own pool, so 'dictionary' may
+  /// reference a short lived pool. If 'dictionary.strings' is set, 'values'
+  /// is expected to hold StringViews into 'strings' and these are rebased
+  /// onto the copy. No-op if the key is already cached.
+  void put(
+      const StringIdLease& file,
+      uint64_t offset,
+      const DictionaryValues& dictionary);
+
+  int64_t cachedBytes() const {
+    std::lock_guard<std::mutex> l(mutex_);
+    return cachedBytes_;
+  }
+
+  void clear();
+
+ private:
+  struct Key {
+    uint64_t fileNum;
+    uint64_t offset;
+
+    bool operator==(const Key& other) const {
+      return fileNum == other.fileNum && offset == other.offset;
+    }
+
+    size_t hash() const {
+      return bits::hashMix(fileNum, offset);
+    }
+  };
+
+  struct KeyHasher {
+    size_t operator()(const Key& key) const {
+      return key.hash();
+    }
+  };
+
+  struct Entry {
+    // Keeps the file name to id mapping live so 'fileNum' in the key is
+    // not reused for another file while the entry exists.
+    StringIdLease file;
+    DictionaryValues dictionary;
+    int64_t bytes{0};
+    std::list<Key>::iterator lruPosition;
+  };
+
+  // Evicts entries from the LRU end until 'cachedBytes_' is within
+  // 'maxBytes_'. Caller must hold 'mutex_'.
+  void evictLocked();
+
+  const int64_t maxBytes_;
+  std::shared_ptr<memory::MemoryPool> pool_;
+
+  mutable std::mutex mutex_;
+  // Most recently used first.
+  std::list<Key> lruList_;
+  folly::F14FastMap<Key, Entry, KeyHasher> entries_;
+  int64_t cachedBytes_{0};
+};
+
+} // namespace facebook::velox::dwio::common
@@ -15,11 +15,15 @@
  */
 
 #include "velox/common/base/Fs.h"
+#include "velox/common/memory/Memory.h"
 #include "velox/dwio/common/DataSink.h"
 #include "velox/exec/tests/utils/TempDirectoryPath.h"
 
 #include <gtest/gtest.h>
 
+#include <fstream>
+#include <sstream>
+
 using namespace ::testing;
 using namespace facebook::velox::exec::test;
 
@@ -40,4 +44,39 @@ TEST(LocalFileSinkTest, create) {
   EXPECT_TRUE(fs::exists(filePath.string()));
 }
 
+TEST(LocalFileSinkTest, writeBehind) {
+  auto pool = facebook::velox::memory::addDefaultLeafMemoryPool();
+  auto root = TempDirectoryPath::create();
+  auto filePath = fs::path(root->path) / "write_behind_file.ext";
+
+  // Small staging buffers and sync interval so that the data crosses
+  // several buffer handovers and fsyncs, plus an unaligned tail.
+  constexpr uint64_t kBufferSize = 64 << 10;
+  constexpr uint64_t kChunk = 10000;
+  constexpr int32_t kNumChunks = 100;
+  std::string expected;
+  {
+    WriteBehindFileSink sink(
+        filePath.string(),
+        MetricsLog::voidLog(),
+        nullptr,
+        true,
+        kBufferSize,
+        2 * kBufferSize);
+    for (auto i = 0; i < kNumChunks; ++i) {
+      std::string chunk(kChunk, 'a' + i % 26);
+      expected += chunk;
+      DataBuffer<char> buffer(*pool);
+      buffer.append(0, chunk.data(), chunk.size());
+      sink.write(std::move(buffer));
+    }
+    EXPECT_EQ(kNumChunks * kChunk, sink.size());
+    sink.close();
+  }
+  std::ifstream file(filePath.string());
+  std::stringstream contents;
+  contents << file.rdbuf();
+  EXPECT_EQ(expected, contents.str());
+}
+
 } // namespace facebook::velox::dwio::common
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/common/MetadataCache.h"
+
+#include "gtest/gtest.h"
+
+using namespace facebook::velox::dwio::common;
+
+TEST(MetadataCacheTest, basic) {
+  auto* cache = MetadataCache::instance();
+  ASSERT_TRUE(cache != nullptr);
+
+  const auto key = MetadataCache::makeKey("/data/file.parquet", 1024);
+  EXPECT_EQ(cache->get(key), nullptr);
+
+  auto metadata = std::make_shared<int32_t>(42);
+  cache->put(key, metadata);
+
+  auto cached = std::static_pointer_cast<const int32_t>(cache->get(key));
+  ASSERT_TRUE(cached != nullptr);
+  EXPECT_EQ(*cached, 42);
+
+  // A file of the same path but different size maps to a different entry.
+  EXPECT_EQ(
+      cache->get(MetadataCache::makeKey("/data/file.parquet", 2048)), nullptr);
+}
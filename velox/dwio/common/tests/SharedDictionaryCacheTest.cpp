@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/common/SharedDictionaryCache.h"
+#include "velox/common/caching/FileIds.h"
+
+#include <gtest/gtest.h>
+
+using namespace facebook::velox;
+using namespace facebook::velox::dwio::common;
+
+class SharedDictionaryCacheTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    pool_ = memory::addDefaultLeafMemoryPool();
+  }
+
+  DictionaryValues makeLongDictionary(int32_t numValues, int64_t start) {
+    DictionaryValues dictionary;
+    dictionary.numValues = numValues;
+    dictionary.values =
+        AlignedBuffer::allocate<int64_t>(numValues, pool_.get());
+    auto* values = dictionary.values->asMutable<int64_t>();
+    for (auto i = 0; i < numValues; ++i) {
+      values[i] = start + i;
+    }
+    return dictionary;
+  }
+
+  std::shared_ptr<memory::MemoryPool> pool_;
+};
+
+TEST_F(SharedDictionaryCacheTest, roundTrip) {
+  SharedDictionaryCache cache(1 << 20);
+  StringIdLease file(fileIds(), "roundTrip");
+  EXPECT_FALSE(cache.get(file.id(), 100).values);
+
+  auto dictionary = makeLongDictionary(1000, 123);
+  cache.put(file, 100, dictionary);
+  EXPECT_GT(cache.cachedBytes(), 0);
+
+  auto cached = cache.get(file.id(), 100);
+  ASSERT_TRUE(cached.values);
+  // The cached buffer is a copy, not the inserted one.
+  EXPECT_NE(cached.values.get(), dictionary.values.get());
+  EXPECT_EQ(cached.numValues, dictionary.numValues);
+  EXPECT_EQ(
+      0,
+      memcmp(
+          cached.values->as<char>(),
+          dictionary.values->as<char>(),
+          dictionary.numValues * sizeof(int64_t)));
+
+  // A different offset or file is a different dictionary.
+  EXPECT_FALSE(cache.get(file.id(), 200).values);
+  StringIdLease otherFile(fileIds(), "roundTripOther");
+  EXPECT_FALSE(cache.get(otherFile.id(), 100).values);
+}
+
+TEST_F(SharedDictionaryCacheTest, stringRebase) {
+  constexpr int32_t kNumValues = 100;
+  constexpr int32_t kLength = 20;
+  SharedDictionaryCache cache(1 << 20);
+  StringIdLease file(fileIds(), "stringRebase");
+
+  DictionaryValues dictionary;
+  dictionary.numValues = kNumValues;
+  dictionary.values =
+      AlignedBuffer::allocate<StringView>(kNumValues, pool_.get());
+  dictionary.strings =
+      AlignedBuffer::allocate<char>(kNumValues * kLength, pool_.get());
+  auto* views = dictionary.values->asMutable<StringView>();
+  auto* strings = dictionary.strings->asMutable<char>();
+  for (auto i = 0; i < kNumValues; ++i) {
+    auto string = fmt::format("{:020}", i);
+    memcpy(strings + i * kLength, string.data(), kLength);
+    views[i] = StringView(strings + i * kLength, kLength);
+  }
+  cache.put(file, 1, dictionary);
+
+  auto cached = cache.get(file.id(), 1);
+  ASSERT_TRUE(cached.values);
+  ASSERT_TRUE(cached.strings);
+  auto* cachedViews = cached.values->as<StringView>();
+  auto* cachedBase = cached.strings->as<char>();
+  for (auto i = 0; i < kNumValues; ++i) {
+    // The views must point into the cached characters, not the inserted
+    // ones, and compare equal to the originals.
+    EXPECT_GE(cachedViews[i].data(), cachedBase);
+    EXPECT_LT(cachedViews[i].data(), cachedBase + kNumValues * kLength);
+    EXPECT_EQ(cachedViews[i], views[i]);
+  }
+}
+
+TEST_F(SharedDictionaryCacheTest, eviction) {
+  constexpr int32_t kNumValues = 1000;
+  StringIdLease file(fileIds(), "eviction");
+  // Measure the cached size of one dictionary to size the budget.
+  int64_t entryBytes;
+  {
+    SharedDictionaryCache probe(1 << 20);
+    probe.put(file, 1, makeLongDictionary(kNumValues, 0));
+    entryBytes = probe.cachedBytes();
+  }
+
+  // Room for two entries, not three.
+  SharedDictionaryCache cache(2 * entryBytes + entryBytes / 2);
+  cache.put(file, 1, makeLongDictionary(kNumValues, 0));
+  cache.put(file, 2, makeLongDictionary(kNumValues, 1000));
+  // Touch the first entry so the second is the eviction candidate.
+  EXPECT_TRUE(cache.get(file.id(), 1).values);
+  cache.put(file, 3, makeLongDictionary(kNumValues, 2000));
+
+  EXPECT_TRUE(cache.get(file.id(), 1).values);
+  EXPECT_FALSE(cache.get(file.id(), 2).values);
+  EXPECT_TRUE(cache.get(file.id(), 3).values);
+  EXPECT_LE(cache.cachedBytes(), 2 * entryBytes + entryBytes / 2);
+}
+
+TEST_F(SharedDictionaryCacheTest, disabled) {
+  SharedDictionaryCache cache(0);
+  EXPECT_FALSE(cache.enabled());
+  StringIdLease file(fileIds(), "disabled");
+  cache.put(file, 1, makeLongDictionary(10, 0));
+  EXPECT_FALSE(cache.get(file.id(), 1).values);
+  EXPECT_EQ(cache.cachedBytes(), 0);
+}
@@ -410,6 +410,9 @@ void DwrfRowReader::startNextStripe() {
   StreamLabels streamLabels(pool);
 
   if (scanSpec) {
+    // Let the filter order adapt to the new stripe: age out selectivity
+    // from previous stripes and reorder on what remains.
+    scanSpec->decayAdaptation();
     selectiveColumnReader_ = SelectiveDwrfReader::build(
         requestedType,
         dataType,
@@ -418,6 +421,16 @@ void DwrfRowReader::startNextStripe() {
         scanSpec,
         flatMapContext);
     selectiveColumnReader_->setIsTopLevel();
+    if (const auto& executor = options_.getDecodingExecutor()) {
+      // Decode independent top level columns in parallel so that a
+      // single giant stripe does not serialize on the driver that owns
+      // the split.
+      if (auto* structReader =
+              dynamic_cast<dwio::common::SelectiveStructColumnReaderBase*>(
+                  selectiveColumnReader_.get())) {
+        structReader->setDecodingExecutor(executor.get());
+      }
+    }
   } else {
     columnReader_ = ColumnReader::build(
         requestedType, dataType, stripeStreams, streamLabels, flatMapContext);
@@ -27,6 +27,9 @@ SelectiveStringDictionaryColumnReader::SelectiveStringDictionaryColumnReader(
     DwrfParams& params,
     common::ScanSpec& scanSpec)
     : SelectiveColumnReader(nodeType, params, scanSpec, nodeType->type),
+      stringAlphabetInterner_(params.stripeStreams()
+                                  .getRowReaderOptions()
+                                  .getStringAlphabetInterner()),
       lastStrideIndex_(-1),
       provider_(params.stripeStreams().getStrideIndexProvider()) {
   auto& stripe = params.stripeStreams();
@@ -197,6 +200,13 @@ void SelectiveStringDictionaryColumnReader::makeDictionaryBaseVector() {
         scanState_.dictionary.numValues /*length*/,
         scanState_.dictionary.values,
         std::vector<BufferPtr>{scanState_.dictionary.strings});
+    if (stringAlphabetInterner_) {
+      // Replace the stripe dictionary with the query-wide canonical copy
+      // so that vectors over the same alphabet share one physical
+      // alphabet across stripes, files and tasks. Stride dictionaries
+      // vary per stride and are not interned.
+      dictionaryValues_ = stringAlphabetInterner_->intern(dictionaryValues_);
+    }
   }
 }
 
@@ -18,6 +18,7 @@
 
 #include "velox/dwio/common/SelectiveColumnReaderInternal.h"
 #include "velox/dwio/dwrf/reader/DwrfData.h"
+#include "velox/vector/StringAlphabetInterner.h"
 
 namespace facebook::velox::dwrf {
 
@@ -88,6 +89,10 @@ class SelectiveStringDictionaryColumnReader
 
   FlatVectorPtr<StringView> dictionaryValues_;
 
+  // Query-wide dedupe of dictionary alphabets or nullptr. See
+  // StringAlphabetInterner.
+  const std::shared_ptr<StringAlphabetInterner> stringAlphabetInterner_;
+
   int64_t lastStrideIndex_;
   size_t positionOffset_;
   size_t strideDictSizeOffset_;
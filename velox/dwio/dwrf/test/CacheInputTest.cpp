@@ -675,6 +675,10 @@ class FileWithReadAhead {
     return stream_->Next(&buffer, &size);
   }
 
+  CacheInputStream* cacheStream() {
+    return reinterpret_cast<CacheInputStream*>(stream_.get());
+  }
+
  private:
   std::unique_ptr<StringIdLease> fileId_;
   std::unique_ptr<CachedBufferedInput> bufferedInput_;
@@ -760,3 +764,22 @@ TEST_F(CacheTest, readAhead) {
 
   LOG(INFO) << count << " prefetches with total " << bytes << " bytes";
 }
+
+TEST_F(CacheTest, adaptiveReadAhead) {
+  initializeCache(128 << 20, 0);
+  auto stats = std::make_shared<dwio::common::IoStatistics>();
+  // A null executor leaves scheduled read-aheads unexecuted, so every
+  // quantum inside the read-ahead window misses memory cache when it is
+  // read and the read-ahead depth doubles until capped.
+  FileWithReadAhead file(
+      "prefetch_adaptive", cache_.get(), stats, *pool_, nullptr);
+  EXPECT_EQ(1, file.cacheStream()->testingPrefetchDepth());
+  const void* buffer;
+  int32_t size;
+  int64_t totalRead = 0;
+  while (file.next(buffer, size)) {
+    totalRead += size;
+  }
+  EXPECT_EQ(FileWithReadAhead::kFileSize, totalRead);
+  EXPECT_GT(file.cacheStream()->testingPrefetchDepth(), 1);
+}
@@ -15,6 +15,7 @@
  */
 
 #include "velox/dwio/dwrf/writer/ColumnWriter.h"
+#include <folly/futures/Future.h>
 #include <velox/dwio/common/exception/Exception.h>
 #include "velox/dwio/common/ChainedBuffer.h"
 #include "velox/dwio/dwrf/common/EncoderUtil.h"
@@ -1588,6 +1589,22 @@ class StructColumnWriter : public BaseColumnWriter {
       std::function<proto::ColumnEncoding&(uint32_t)> encodingFactory,
       std::function<void(proto::ColumnEncoding&)> encodingOverride) override {
     BaseColumnWriter::flush(encodingFactory, encodingOverride);
+    auto* executor = context_.flushExecutor();
+    if (isRoot() && executor != nullptr && children_.size() > 1) {
+      // Flush independent top level columns in parallel. 'encodingFactory'
+      // must be thread safe. Stream layout and stripe assembly remain
+      // sequential on the writer thread.
+      std::vector<folly::Future<folly::Unit>> futures;
+      futures.reserve(children_.size());
+      for (auto& c : children_) {
+        futures.push_back(folly::via(
+            executor, [&child = *c, &encodingFactory]() {
+              child.flush(encodingFactory);
+            }));
+      }
+      folly::collect(std::move(futures)).get();
+      return;
+    }
     for (auto& c : children_) {
       c->flush(encodingFactory);
     }
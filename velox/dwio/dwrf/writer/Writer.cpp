@@ -18,6 +18,8 @@
 
 #include <folly/ScopeGuard.h>
 
+#include <mutex>
+
 #include "velox/common/time/CpuWallTimer.h"
 #include "velox/dwio/dwrf/common/Common.h"
 #include "velox/dwio/dwrf/utils/ProtoUtils.h"
@@ -225,7 +227,12 @@ void Writer::flushStripe(bool close) {
   auto& handler = context.getEncryptionHandler();
   EncodingManager encodingManager{handler};
 
+  // The stripe footer is shared across column writers which may flush in
+  // parallel, so additions to it need to be serialized. The returned
+  // encoding is only mutated by the writer that requested it.
+  std::mutex encodingMutex;
   writer_->flush([&](uint32_t nodeId) -> proto::ColumnEncoding& {
+    std::lock_guard<std::mutex> l(encodingMutex);
     return encodingManager.addEncodingToFooter(nodeId);
   });
 
@@ -46,6 +46,10 @@ struct WriterOptions {
       WriterContext& context,
       const velox::dwio::common::TypeWithId& type)>
       columnWriterFactory;
+  // Optional executor for encoding independent columns in parallel during
+  // stripe flush. Not owned and must outlive the writer. nullptr means
+  // columns are flushed sequentially on the writer thread.
+  folly::Executor* flushExecutor{nullptr};
 };
 
 class Writer : public dwio::common::Writer {
@@ -77,6 +81,7 @@ class Writer : public dwio::common::Writer {
         options.config, std::move(pool), std::move(handler));
     auto& context = writerBase_->getContext();
     context.buildPhysicalSizeAggregators(*schema_);
+    context.setFlushExecutor(options.flushExecutor);
     if (!options.flushPolicyFactory) {
       flushPolicy_ = std::make_unique<DefaultFlushPolicy>(
           context.stripeSizeFlushThreshold,
@@ -16,7 +16,10 @@
 
 #pragma once
 
+#include <folly/Executor.h>
+
 #include <limits>
+#include <mutex>
 #include "velox/common/base/GTestMacros.h"
 #include "velox/common/time/CpuWallTimer.h"
 #include "velox/dwio/dwrf/common/Common.h"
@@ -72,25 +75,30 @@ class WriterContext : public CompressionBufferPool {
     }
     validateConfigs();
     VLOG(1) << fmt::format("Compression config: {}", compression);
-    compressionBuffer_ = std::make_unique<dwio::common::DataBuffer<char>>(
-        *generalPool_, compressionBlockSize + PAGE_HEADER_SIZE);
+    compressionBuffers_.push_back(
+        std::make_unique<dwio::common::DataBuffer<char>>(
+            *generalPool_, compressionBlockSize + PAGE_HEADER_SIZE));
   }
 
   bool hasStream(const DwrfStreamIdentifier& stream) const {
+    std::lock_guard<std::mutex> l(streamsMutex_);
     return streams_.find(stream) != streams_.end();
   }
 
   const DataBufferHolder& getStream(const DwrfStreamIdentifier& stream) const {
+    std::lock_guard<std::mutex> l(streamsMutex_);
     return streams_.at(stream);
   }
 
   void addBuffer(
       const DwrfStreamIdentifier& stream,
       folly::StringPiece buffer) {
+    std::lock_guard<std::mutex> l(streamsMutex_);
     streams_.at(stream).take(buffer);
   }
 
   size_t getStreamCount() const {
+    std::lock_guard<std::mutex> l(streamsMutex_);
     return streams_.size();
   }
 
@@ -100,8 +108,11 @@ class WriterContext : public CompressionBufferPool {
   // flush policy evaluation and would be more accurate after flush.
   std::unique_ptr<BufferedOutputStream> newStream(
       const DwrfStreamIdentifier& stream) {
+    std::unique_lock<std::mutex> lock(streamsMutex_);
     DWIO_ENSURE(
-        !hasStream(stream), "Stream already exists ", stream.toString());
+        streams_.find(stream) == streams_.end(),
+        "Stream already exists ",
+        stream.toString());
     streams_.emplace(
         std::piecewise_construct,
         std::forward_as_tuple(stream),
@@ -111,6 +122,7 @@ class WriterContext : public CompressionBufferPool {
             getConfig(Config::COMPRESSION_BLOCK_SIZE_MIN),
             getConfig(Config::COMPRESSION_BLOCK_SIZE_EXTEND_RATIO)));
     auto& holder = streams_.at(stream);
+    lock.unlock();
     auto encrypter = handler_->isEncrypted(stream.encodingKey().node)
         ? std::addressof(
               handler_->getEncryptionProvider(stream.encodingKey().node))
@@ -171,9 +183,10 @@ class WriterContext : public CompressionBufferPool {
   }
 
   void suppressStream(const DwrfStreamIdentifier& stream) {
-    DWIO_ENSURE(hasStream(stream));
-    auto& collector = streams_.at(stream);
-    collector.suppress();
+    std::lock_guard<std::mutex> l(streamsMutex_);
+    auto it = streams_.find(stream);
+    DWIO_ENSURE(it != streams_.end());
+    it->second.suppress();
   }
 
   bool isStreamPaged(uint32_t nodeId) const {
@@ -287,6 +300,7 @@ class WriterContext : public CompressionBufferPool {
 
   virtual void removeStreams(
       std::function<bool(const DwrfStreamIdentifier&)> predicate) {
+    std::lock_guard<std::mutex> l(streamsMutex_);
     auto it = streams_.begin();
     while (it != streams_.end()) {
       if (predicate(it->first)) {
@@ -299,16 +313,25 @@ class WriterContext : public CompressionBufferPool {
 
   std::unique_ptr<dwio::common::DataBuffer<char>> getBuffer(
       uint64_t size) override {
-    DWIO_ENSURE_NOT_NULL(compressionBuffer_);
-    DWIO_ENSURE_GE(compressionBuffer_->size(), size);
-    return std::move(compressionBuffer_);
+    std::lock_guard<std::mutex> l(compressionBufferMutex_);
+    if (compressionBuffers_.empty()) {
+      // Multiple column writers flushing in parallel can each hold a
+      // compression buffer, so grow the pool on demand.
+      return std::make_unique<dwio::common::DataBuffer<char>>(
+          *generalPool_,
+          std::max<uint64_t>(size, compressionBlockSize + PAGE_HEADER_SIZE));
+    }
+    auto buffer = std::move(compressionBuffers_.back());
+    compressionBuffers_.pop_back();
+    DWIO_ENSURE_GE(buffer->size(), size);
+    return buffer;
   }
 
   void returnBuffer(
       std::unique_ptr<dwio::common::DataBuffer<char>> buffer) override {
     DWIO_ENSURE_NOT_NULL(buffer);
-    DWIO_ENSURE(!compressionBuffer_);
-    compressionBuffer_ = std::move(buffer);
+    std::lock_guard<std::mutex> l(compressionBufferMutex_);
+    compressionBuffers_.push_back(std::move(buffer));
   }
 
   void incrementNodeSize(uint32_t node, uint64_t size) {
@@ -380,6 +403,16 @@ class WriterContext : public CompressionBufferPool {
     return checkLowMemoryMode_;
   }
 
+  // Executor used to encode independent columns in parallel during stripe
+  // flush. nullptr means columns are flushed sequentially.
+  folly::Executor* flushExecutor() const {
+    return flushExecutor_;
+  }
+
+  void setFlushExecutor(folly::Executor* executor) {
+    flushExecutor_ = executor;
+  }
+
   void setLowMemoryMode() {
     lowMemoryMode_ = true;
   }
@@ -530,7 +563,17 @@ class WriterContext : public CompressionBufferPool {
   std::function<std::unique_ptr<IndexBuilder>(
       std::unique_ptr<BufferedOutputStream>)>
       indexBuilderFactory_;
-  std::unique_ptr<dwio::common::DataBuffer<char>> compressionBuffer_;
+  // Pool of compression buffers shared by column writers. Starts with a
+  // single buffer and grows on demand when columns flush in parallel.
+  std::vector<std::unique_ptr<dwio::common::DataBuffer<char>>>
+      compressionBuffers_;
+  std::mutex compressionBufferMutex_;
+  // Guards 'streams_' which can be mutated concurrently when columns flush
+  // in parallel (e.g. dictionary encoding abandoned at flush time).
+  mutable std::mutex streamsMutex_;
+  // Optional executor for encoding independent columns in parallel during
+  // stripe flush. Not owned. nullptr means sequential flush.
+  folly::Executor* flushExecutor_{nullptr};
   // A pool of reusable DecodedVectors.
   std::vector<std::unique_ptr<velox::DecodedVector>> decodedVectorPool_;
   // Reusable SelectivityVector
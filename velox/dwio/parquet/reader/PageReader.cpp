@@ -17,7 +17,9 @@
 #include "velox/dwio/parquet/reader/PageReader.h"
 #include "velox/dwio/common/BufferUtil.h"
 #include "velox/dwio/common/ColumnVisitors.h"
+#include "velox/dwio/common/SharedDictionaryCache.h"
 #include "velox/dwio/parquet/reader/NestedStructureDecoder.h"
+#include "velox/dwio/parquet/reader/Statistics.h"
 #include "velox/dwio/parquet/thrift/ThriftTransport.h"
 #include "velox/vector/FlatVector.h"
 
@@ -242,6 +244,11 @@ void PageReader::prepareDataPageV1(const PageHeader& pageHeader, int64_t row) {
       pageHeader.type == thrift::PageType::DATA_PAGE &&
       pageHeader.__isset.data_page_header);
   numRepDefsInPage_ = pageHeader.data_page_header.num_values;
+  hasPageStatistics_ = pageHeader.data_page_header.__isset.statistics;
+  if (hasPageStatistics_) {
+    pageStatistics_ = pageHeader.data_page_header.statistics;
+  }
+  pageStatsTested_ = false;
   setPageRowInfo(row == kRepDefOnly);
   if (row != kRepDefOnly && numRowsInPage_ != kRowsUnknown &&
       numRowsInPage_ + rowOfPage_ <= row) {
@@ -299,6 +306,11 @@ void PageReader::prepareDataPageV1(const PageHeader& pageHeader, int64_t row) {
 void PageReader::prepareDataPageV2(const PageHeader& pageHeader, int64_t row) {
   VELOX_CHECK(pageHeader.__isset.data_page_header_v2);
   numRepDefsInPage_ = pageHeader.data_page_header_v2.num_values;
+  hasPageStatistics_ = pageHeader.data_page_header_v2.__isset.statistics;
+  if (hasPageStatistics_) {
+    pageStatistics_ = pageHeader.data_page_header_v2.statistics;
+  }
+  pageStatsTested_ = false;
   setPageRowInfo(row == kRepDefOnly);
   if (row != kRepDefOnly && numRowsInPage_ != kRowsUnknown &&
       numRowsInPage_ + rowOfPage_ <= row) {
@@ -365,6 +377,23 @@ void PageReader::prepareDictionary(const PageHeader& pageHeader) {
       dictionaryEncoding_ == Encoding::PLAIN_DICTIONARY ||
       dictionaryEncoding_ == Encoding::PLAIN);
 
+  if (dictionaryCacheFile_.hasValue()) {
+    auto cached = dwio::common::SharedDictionaryCache::instance().get(
+        dictionaryCacheFile_.id(), dictionaryPageOffset_);
+    if (cached.values) {
+      // Another reader already decoded this dictionary. Share the decoded
+      // buffers and skip over the page.
+      dictionary_.values = cached.values;
+      dictionary_.strings = cached.strings;
+      skipBytes(
+          pageHeader.compressed_page_size,
+          inputStream_.get(),
+          bufferStart_,
+          bufferEnd_);
+      return;
+    }
+  }
+
   if (codec_ != thrift::CompressionCodec::UNCOMPRESSED) {
     pageData_ = readBytes(pageHeader.compressed_page_size, pageBuffer_);
     pageData_ = uncompressData(
@@ -508,9 +537,16 @@ void PageReader::prepareDictionary(const PageHeader& pageHeader) {
       VELOX_UNSUPPORTED(
           "Parquet type {} not supported for dictionary", parquetType);
   }
+
+  if (dictionaryCacheFile_.hasValue()) {
+    dwio::common::SharedDictionaryCache::instance().put(
+        dictionaryCacheFile_, dictionaryPageOffset_, dictionary_);
+  }
 }
 
-void PageReader::makeFilterCache(dwio::common::ScanState& state) {
+void PageReader::makeFilterCache(
+    dwio::common::ScanState& state,
+    const common::Filter* filter) {
   VELOX_CHECK(
       !state.dictionary2.values, "Parquet supports only one dictionary");
   state.filterCache.resize(state.dictionary.numValues);
@@ -519,6 +555,60 @@ void PageReader::makeFilterCache(dwio::common::ScanState& state) {
       dwio::common::FilterResult::kUnknown,
       state.filterCache.size());
   state.rawState.filterCache = state.filterCache.data();
+  if (!filter || !filter->isDeterministic()) {
+    return;
+  }
+  // Evaluate the filter once per dictionary entry so the decode loop
+  // only tests cached results. This applies e.g. a string filter to the
+  // alphabet instead of to every row.
+  auto* cache = state.filterCache.data();
+  const auto numValues = state.dictionary.numValues;
+  auto setResult = [&](int32_t i, bool passed) {
+    cache[i] = passed ? dwio::common::FilterResult::kSuccess
+                      : dwio::common::FilterResult::kFailure;
+  };
+  switch (type_->parquetType_.value()) {
+    case thrift::Type::INT32:
+    case thrift::Type::INT64:
+      if (type_->parquetType_.value() == thrift::Type::INT32 &&
+          !type_->type->isShortDecimal()) {
+        auto values = state.dictionary.values->as<int32_t>();
+        for (auto i = 0; i < numValues; ++i) {
+          setResult(i, filter->testInt64(values[i]));
+        }
+      } else {
+        // Short decimal INT32 dictionaries are widened to int64.
+        auto values = state.dictionary.values->as<int64_t>();
+        for (auto i = 0; i < numValues; ++i) {
+          setResult(i, filter->testInt64(values[i]));
+        }
+      }
+      break;
+    case thrift::Type::FLOAT: {
+      auto values = state.dictionary.values->as<float>();
+      for (auto i = 0; i < numValues; ++i) {
+        setResult(i, filter->testFloat(values[i]));
+      }
+      break;
+    }
+    case thrift::Type::DOUBLE: {
+      auto values = state.dictionary.values->as<double>();
+      for (auto i = 0; i < numValues; ++i) {
+        setResult(i, filter->testDouble(values[i]));
+      }
+      break;
+    }
+    case thrift::Type::BYTE_ARRAY: {
+      auto values = state.dictionary.values->as<StringView>();
+      for (auto i = 0; i < numValues; ++i) {
+        setResult(i, filter->testBytes(values[i].data(), values[i].size()));
+      }
+      break;
+    }
+    default:
+      // Other types keep the lazy per-entry evaluation.
+      break;
+  }
 }
 
 namespace {
@@ -813,6 +903,20 @@ void PageReader::startVisit(folly::Range<const vector_size_t*> rows) {
   visitBase_ = firstUnvisited_;
 }
 
+bool PageReader::pageMatches(common::Filter& filter) {
+  if (!pageStatsTested_) {
+    pageStatsTested_ = true;
+    pageMatchesResult_ = true;
+    if (hasPageStatistics_ && filter.isDeterministic()) {
+      auto columnStats = buildColumnStatisticsFromThrift(
+          pageStatistics_, *type_->type, numRowsInPage_);
+      pageMatchesResult_ = common::testFilter(
+          &filter, columnStats.get(), numRowsInPage_, type_->type);
+    }
+  }
+  return pageMatchesResult_;
+}
+
 bool PageReader::rowsForPage(
     dwio::common::SelectiveColumnReader& reader,
     bool hasFilter,
@@ -823,13 +927,31 @@ bool PageReader::rowsForPage(
     return false;
   }
   int32_t numToVisit;
-  // Check if the first row to go to is in the current page. If not, seek to the
-  // page that contains the row.
-  auto rowZero = visitBase_ + visitorRows_[currentVisitorRow_];
-  if (rowZero >= rowOfPage_ + numRowsInPage_) {
-    seekToPage(rowZero);
-    if (hasChunkRepDefs_) {
-      numLeafNullsConsumed_ = rowOfPage_;
+  for (;;) {
+    // Check if the first row to go to is in the current page. If not, seek to
+    // the page that contains the row.
+    auto rowZero = visitBase_ + visitorRows_[currentVisitorRow_];
+    if (rowZero >= rowOfPage_ + numRowsInPage_) {
+      seekToPage(rowZero);
+      if (hasChunkRepDefs_) {
+        numLeafNullsConsumed_ = rowOfPage_;
+      }
+    }
+    auto* filter =
+        hasFilter && isTopLevel_ ? reader.scanSpec()->filter() : nullptr;
+    if (!filter || pageMatches(*filter)) {
+      break;
+    }
+    // The page statistics prove that no value on the page can pass the
+    // filter. Skip the rows on this page without decoding.
+    int64_t firstRowOnNextPage = rowOfPage_ + numRowsInPage_ - visitBase_;
+    while (currentVisitorRow_ < numVisitorRows_ &&
+           visitorRows_[currentVisitorRow_] < firstRowOnNextPage) {
+      ++currentVisitorRow_;
+    }
+    firstUnvisited_ = visitBase_ + visitorRows_[currentVisitorRow_ - 1] + 1;
+    if (currentVisitorRow_ == numVisitorRows_) {
+      return false;
     }
   }
   auto& scanState = reader.scanState();
@@ -837,7 +959,7 @@ bool PageReader::rowsForPage(
     if (scanState.dictionary.values != dictionary_.values) {
       scanState.dictionary = dictionary_;
       if (hasFilter) {
-        makeFilterCache(scanState);
+        makeFilterCache(scanState, reader.scanSpec()->filter());
       }
       scanState.updateRawState();
     }
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <arrow/util/rle_encoding.h>
+#include "velox/common/caching/StringIdMap.h"
 #include "velox/dwio/common/BitConcatenation.h"
 #include "velox/dwio/common/DirectDecoder.h"
 #include "velox/dwio/common/SelectiveColumnReader.h"
@@ -120,6 +121,16 @@ class PageReader {
     dictionaryValues_.reset();
   }
 
+  /// Enables sharing the decoded dictionary of the ColumnChunk of 'this'
+  /// via the process-wide SharedDictionaryCache. 'file' keeps the file id
+  /// of the containing file live, 'offset' is the file offset of the
+  /// chunk's dictionary page. The offset identifies the same dictionary
+  /// across splits and readers of the file.
+  void setDictionaryCacheKey(StringIdLease file, uint64_t offset) {
+    dictionaryCacheFile_ = std::move(file);
+    dictionaryPageOffset_ = offset;
+  }
+
   /// Returns the range of repdefs for the top level rows covered by the last
   /// decoderepDefs().
   std::pair<int32_t, int32_t> repDefRange() const {
@@ -148,8 +159,18 @@ class PageReader {
   // current page.
   int32_t skipNulls(int32_t numRows);
 
-  // Initializes a filter result cache for the dictionary in 'state'.
-  void makeFilterCache(dwio::common::ScanState& state);
+  // Initializes a filter result cache for the dictionary in 'state'. If
+  // 'filter' is deterministic, evaluates it over the dictionary values
+  // up front so that decoding only consults the cache.
+  void makeFilterCache(
+      dwio::common::ScanState& state,
+      const common::Filter* FOLLY_NULLABLE filter);
+
+  // Returns true if rows on the current page can pass 'filter'. Returns
+  // false only if the statistics in the page header prove that no value
+  // on the page can pass. The result is computed once per page and
+  // cached.
+  bool pageMatches(common::Filter& filter);
 
   // Makes a decoder based on 'encoding_' for bytes from ''pageData_' to
   // 'pageData_' + 'encodedDataSize_'.
@@ -402,6 +423,18 @@ class PageReader {
   // level column.
   int32_t numRepDefsInPage_{0};
 
+  // Statistics from the current data page's header, set if the writer
+  // recorded them. Used for skipping pages where no value can pass the
+  // filter.
+  thrift::Statistics pageStatistics_;
+  bool hasPageStatistics_{false};
+
+  // True if 'pageMatchesResult_' is set for the current page.
+  bool pageStatsTested_{false};
+
+  // Cached result of testing the filter against 'pageStatistics_'.
+  bool pageMatchesResult_{true};
+
   // Copy of data if data straddles buffer boundary.
   BufferPtr pageBuffer_;
 
@@ -416,6 +449,15 @@ class PageReader {
   dwio::common::DictionaryValues dictionary_;
   thrift::Encoding::type dictionaryEncoding_;
 
+  // File id of the containing file if the decoded dictionary is to be
+  // shared via SharedDictionaryCache. No lease means no caching.
+  StringIdLease dictionaryCacheFile_;
+
+  // File offset of the ColumnChunk's dictionary page. Key of the chunk's
+  // dictionary in SharedDictionaryCache together with
+  // 'dictionaryCacheFile_'.
+  uint64_t dictionaryPageOffset_{0};
+
   // Offset of current page's header from start of ColumnChunk.
   uint64_t pageStart_{0};
 
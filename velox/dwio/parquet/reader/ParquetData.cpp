@@ -15,6 +15,11 @@
  */
 
 #include "velox/dwio/parquet/reader/ParquetData.h"
+#include "velox/common/caching/FileIds.h"
+#include "velox/dwio/common/DataBuffer.h"
+#include "velox/dwio/common/SharedDictionaryCache.h"
+#include "velox/dwio/common/StreamUtil.h"
+#include "velox/dwio/parquet/reader/SplitBlockBloomFilter.h"
 #include "velox/dwio/parquet/reader/Statistics.h"
 
 namespace facebook::velox::parquet {
@@ -24,7 +29,8 @@ using thrift::RowGroup;
 std::unique_ptr<dwio::common::FormatData> ParquetParams::toFormatData(
     const std::shared_ptr<const dwio::common::TypeWithId>& type,
     const common::ScanSpec& /*scanSpec*/) {
-  return std::make_unique<ParquetData>(type, metaData_.row_groups, pool());
+  return std::make_unique<ParquetData>(
+      type, input_, metaData_.row_groups, pool());
 }
 
 void ParquetData::filterRowGroups(
@@ -77,11 +83,108 @@ bool ParquetData::rowGroupMatches(
         rowGroup.columns[column].meta_data.statistics,
         *type,
         rowGroup.num_rows);
-    return testFilter(filter, columnStats.get(), rowGroup.num_rows, type);
+    if (!testFilter(filter, columnStats.get(), rowGroup.num_rows, type)) {
+      return false;
+    }
+  }
+
+  const auto values = pointFilterValues(*filter);
+  if (!values.empty()) {
+    return bloomFilterMayMatch(rowGroupId, values);
   }
   return true;
 }
 
+// static
+std::vector<int64_t> ParquetData::pointFilterValues(
+    const common::Filter& filter) {
+  // A null passing the filter defeats skipping on a Bloom filter miss.
+  if (filter.testNull()) {
+    return {};
+  }
+  switch (filter.kind()) {
+    case common::FilterKind::kBigintRange: {
+      auto& range = static_cast<const common::BigintRange&>(filter);
+      if (range.isSingleValue()) {
+        return {range.lower()};
+      }
+      return {};
+    }
+    case common::FilterKind::kBigintValuesUsingHashTable:
+      return static_cast<const common::BigintValuesUsingHashTable&>(filter)
+          .values();
+    case common::FilterKind::kBigintValuesUsingBitmask:
+      return static_cast<const common::BigintValuesUsingBitmask&>(filter)
+          .values();
+    default:
+      return {};
+  }
+}
+
+bool ParquetData::bloomFilterMayMatch(
+    uint32_t rowGroupId,
+    const std::vector<int64_t>& values) {
+  const auto& chunk = rowGroups_[rowGroupId].columns[type_->column];
+  if (!chunk.__isset.meta_data ||
+      !chunk.meta_data.__isset.bloom_filter_offset) {
+    return true;
+  }
+  // The hash covers the plain encoding of the value, so the physical type
+  // decides the hashed width.
+  const auto physicalType = type_->parquetType_;
+  if (physicalType != thrift::Type::INT32 &&
+      physicalType != thrift::Type::INT64) {
+    return true;
+  }
+  const auto offset = chunk.meta_data.bloom_filter_offset;
+
+  // The header is a handful of bytes of compact thrift directly followed by
+  // the bitset, which is at least one 32 byte block, so reading 32 bytes at
+  // 'offset' covers the header and stays inside the Bloom filter data.
+  constexpr int32_t kHeaderSizeGuess = 32;
+  auto stream =
+      input_.read(offset, kHeaderSizeGuess, dwio::common::LogType::STRIPE);
+  char headerCopy[kHeaderSizeGuess];
+  const char* bufferStart = nullptr;
+  const char* bufferEnd = nullptr;
+  dwio::common::readBytes(
+      kHeaderSizeGuess, stream.get(), headerCopy, bufferStart, bufferEnd);
+
+  std::shared_ptr<thrift::ThriftTransport> thriftTransport =
+      std::make_shared<thrift::ThriftBufferedTransport>(
+          headerCopy, kHeaderSizeGuess);
+  auto thriftProtocol = std::make_unique<
+      apache::thrift::protocol::TCompactProtocolT<thrift::ThriftTransport>>(
+      thriftTransport);
+  thrift::BloomFilterHeader header;
+  const auto headerSize = header.read(thriftProtocol.get());
+
+  if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH ||
+      !header.compression.__isset.UNCOMPRESSED || header.numBytes <= 0 ||
+      header.numBytes % 32 != 0) {
+    return true;
+  }
+
+  dwio::common::DataBuffer<char> bitset(pool_, header.numBytes);
+  stream = input_.read(
+      offset + headerSize, header.numBytes, dwio::common::LogType::STRIPE);
+  bufferStart = nullptr;
+  bufferEnd = nullptr;
+  dwio::common::readBytes(
+      header.numBytes, stream.get(), bitset.data(), bufferStart, bufferEnd);
+
+  SplitBlockBloomFilter bloomFilter(bitset.data(), header.numBytes);
+  for (const auto value : values) {
+    const auto hash = physicalType == thrift::Type::INT64
+        ? SplitBlockBloomFilter::hashInt64(value)
+        : SplitBlockBloomFilter::hashInt32(static_cast<int32_t>(value));
+    if (bloomFilter.mayContain(hash)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void ParquetData::enqueueRowGroup(
     uint32_t index,
     dwio::common::BufferedInput& input) {
@@ -107,6 +210,11 @@ void ParquetData::enqueueRowGroup(
 
   auto id = dwio::common::StreamIdentifier(type_->column);
   streams_[index] = input.enqueue({chunkReadOffset, readSize}, &id);
+
+  if (!fileId_.hasValue() &&
+      dwio::common::SharedDictionaryCache::instance().enabled()) {
+    fileId_ = StringIdLease(fileIds(), input.getName());
+  }
 }
 
 dwio::common::PositionProvider ParquetData::seekToRowGroup(uint32_t index) {
@@ -120,6 +228,10 @@ dwio::common::PositionProvider ParquetData::seekToRowGroup(uint32_t index) {
       type_,
       metadata.codec,
       metadata.total_compressed_size);
+  if (fileId_.hasValue() && metadata.__isset.dictionary_page_offset &&
+      metadata.dictionary_page_offset >= 4) {
+    reader_->setDictionaryCacheKey(fileId_, metadata.dictionary_page_offset);
+  }
   return dwio::common::PositionProvider(empty);
 }
 
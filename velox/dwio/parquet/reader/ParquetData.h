@@ -18,6 +18,7 @@
 
 #include <thrift/protocol/TCompactProtocol.h> //@manual
 #include "velox/common/base/RawVector.h"
+#include "velox/common/caching/StringIdMap.h"
 #include "velox/dwio/common/BufferUtil.h"
 #include "velox/dwio/common/BufferedInput.h"
 #include "velox/dwio/common/ScanSpec.h"
@@ -28,13 +29,17 @@
 namespace facebook::velox::parquet {
 class ParquetParams : public dwio::common::FormatParams {
  public:
-  ParquetParams(memory::MemoryPool& pool, const thrift::FileMetaData& metaData)
-      : FormatParams(pool), metaData_(metaData) {}
+  ParquetParams(
+      memory::MemoryPool& pool,
+      dwio::common::BufferedInput& input,
+      const thrift::FileMetaData& metaData)
+      : FormatParams(pool), input_(input), metaData_(metaData) {}
   std::unique_ptr<dwio::common::FormatData> toFormatData(
       const std::shared_ptr<const dwio::common::TypeWithId>& type,
       const common::ScanSpec& scanSpec) override;
 
  private:
+  dwio::common::BufferedInput& input_;
   const thrift::FileMetaData& metaData_;
 };
 
@@ -43,10 +48,12 @@ class ParquetData : public dwio::common::FormatData {
  public:
   ParquetData(
       const std::shared_ptr<const dwio::common::TypeWithId>& type,
+      dwio::common::BufferedInput& input,
       const std::vector<thrift::RowGroup>& rowGroups,
       memory::MemoryPool& pool)
       : pool_(pool),
         type_(std::static_pointer_cast<const ParquetTypeWithId>(type)),
+        input_(input),
         rowGroups_(rowGroups),
         maxDefine_(type_->maxDefine_),
         maxRepeat_(type_->maxRepeat_),
@@ -174,17 +181,35 @@ class ParquetData : public dwio::common::FormatData {
 
  private:
   /// True if 'filter' may have hits for the column of 'this' according to the
-  /// stats in 'rowGroup'.
+  /// stats and the Bloom filter, if any, in 'rowGroup'.
   bool rowGroupMatches(uint32_t rowGroupId, common::Filter* filter);
 
+  // Returns the integer values probed in a Bloom filter for 'filter', empty
+  // if 'filter' is not a point filter eligible for Bloom filter testing.
+  static std::vector<int64_t> pointFilterValues(const common::Filter& filter);
+
+  // True if the Bloom filter of the column chunk in 'rowGroupId' may contain
+  // one of 'values'. Returns true if the chunk has no Bloom filter or the
+  // filter is of an unsupported kind.
+  bool bloomFilterMayMatch(
+      uint32_t rowGroupId,
+      const std::vector<int64_t>& values);
+
  protected:
   memory::MemoryPool& pool_;
   std::shared_ptr<const ParquetTypeWithId> type_;
+  // File input for reading Bloom filters during row group filtering. Column
+  // chunk streams come from per-row group inputs, see enqueueRowGroup.
+  dwio::common::BufferedInput& input_;
   const std::vector<thrift::RowGroup>& rowGroups_;
   // Streams for this column in each of 'rowGroups_'. Will be created on or
   // ahead of first use, not at construction.
   std::vector<std::unique_ptr<dwio::common::SeekableInputStream>> streams_;
 
+  // File id lease for keying decoded dictionaries of this column in
+  // SharedDictionaryCache. Not set if the cache is disabled.
+  StringIdLease fileId_;
+
   const uint32_t maxDefine_;
   const uint32_t maxRepeat_;
   int64_t rowsInRowGroup_;
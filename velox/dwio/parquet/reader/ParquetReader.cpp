@@ -16,6 +16,7 @@
 
 #include "velox/dwio/parquet/reader/ParquetReader.h"
 #include <thrift/protocol/TCompactProtocol.h> //@manual
+#include "velox/dwio/common/MetadataCache.h"
 #include "velox/dwio/common/MetricsLog.h"
 #include "velox/dwio/common/TypeUtils.h"
 #include "velox/dwio/parquet/reader/StructColumnReader.h"
@@ -30,6 +31,16 @@ DEFINE_int32(
 
 namespace facebook::velox::parquet {
 
+namespace {
+// Parsed footer and schema of one Parquet file, shared across readers of the
+// same file via dwio::common::MetadataCache.
+struct CachedFileMetadata {
+  std::shared_ptr<const thrift::FileMetaData> fileMetaData;
+  RowTypePtr schema;
+  std::shared_ptr<const dwio::common::TypeWithId> schemaWithId;
+};
+} // namespace
+
 ReaderBase::ReaderBase(
     std::unique_ptr<dwio::common::BufferedInput> input,
     const dwio::common::ReaderOptions& options)
@@ -42,8 +53,29 @@ ReaderBase::ReaderBase(
   VELOX_CHECK_GT(fileLength_, 0, "Parquet file is empty");
   VELOX_CHECK_GE(fileLength_, 12, "Parquet file is too small");
 
+  auto* metadataCache = dwio::common::MetadataCache::instance();
+  std::string cacheKey;
+  if (metadataCache) {
+    cacheKey =
+        dwio::common::MetadataCache::makeKey(input_->getName(), fileLength_);
+    if (auto cached = std::static_pointer_cast<const CachedFileMetadata>(
+            metadataCache->get(cacheKey))) {
+      fileMetaData_ = cached->fileMetaData;
+      schema_ = cached->schema;
+      schemaWithId_ = cached->schemaWithId;
+      return;
+    }
+  }
+
   loadFileMetaData();
   initializeSchema();
+
+  if (metadataCache) {
+    metadataCache->put(
+        cacheKey,
+        std::make_shared<CachedFileMetadata>(
+            CachedFileMetadata{fileMetaData_, schema_, schemaWithId_}));
+  }
 }
 
 void ReaderBase::loadFileMetaData() {
@@ -88,8 +120,9 @@ void ReaderBase::loadFileMetaData() {
   auto thriftProtocol = std::make_unique<
       apache::thrift::protocol::TCompactProtocolT<thrift::ThriftTransport>>(
       thriftTransport);
-  fileMetaData_ = std::make_unique<thrift::FileMetaData>();
-  fileMetaData_->read(thriftProtocol.get());
+  auto fileMetaData = std::make_unique<thrift::FileMetaData>();
+  fileMetaData->read(thriftProtocol.get());
+  fileMetaData_ = std::move(fileMetaData);
 }
 
 void ReaderBase::initializeSchema() {
@@ -455,8 +488,6 @@ void ReaderBase::scheduleRowGroups(
     int32_t currentGroup,
     StructColumnReader& reader) {
   auto thisGroup = rowGroupIds[currentGroup];
-  auto nextGroup =
-      currentGroup + 1 < rowGroupIds.size() ? rowGroupIds[currentGroup + 1] : 0;
   auto input = inputs_[thisGroup].get();
   if (!input) {
     auto newInput = input_->clone();
@@ -464,22 +495,26 @@ void ReaderBase::scheduleRowGroups(
     newInput->load(dwio::common::LogType::STRIPE);
     inputs_[thisGroup] = std::move(newInput);
   }
-  for (auto counter = 0; counter < FLAGS_parquet_prefetch_rowgroups;
+  // Start loading the next groups' column chunks while 'thisGroup' is
+  // being decoded. Each group gets its own BufferedInput, so the loads
+  // proceed on the input's executor in the background when one is set.
+  for (auto counter = 1; counter <= FLAGS_parquet_prefetch_rowgroups;
        ++counter) {
-    if (nextGroup) {
-      if (inputs_.count(nextGroup) != 0) {
-        auto newInput = input_->clone();
-        reader.enqueueRowGroup(nextGroup, *newInput);
-        newInput->load(dwio::common::LogType::STRIPE);
-        inputs_[nextGroup] = std::move(newInput);
-      }
-    } else {
+    if (currentGroup + counter >= rowGroupIds.size()) {
       break;
     }
-    nextGroup =
-        nextGroup + 1 < rowGroupIds.size() ? rowGroupIds[nextGroup + 1] : 0;
+    auto nextGroup = rowGroupIds[currentGroup + counter];
+    if (inputs_.count(nextGroup) == 0) {
+      auto newInput = input_->clone();
+      reader.enqueueRowGroup(nextGroup, *newInput);
+      newInput->load(dwio::common::LogType::STRIPE);
+      inputs_[nextGroup] = std::move(newInput);
+    }
   }
-  if (currentGroup > 1) {
+  // The group before 'currentGroup' is fully decoded, so its input and
+  // buffers can be dropped. This caps the number of in-flight group
+  // buffers at FLAGS_parquet_prefetch_rowgroups + 1.
+  if (currentGroup >= 1) {
     inputs_.erase(rowGroupIds[currentGroup - 1]);
   }
 }
@@ -526,7 +561,8 @@ ParquetRowReader::ParquetRowReader(
   if (rowGroups_.empty()) {
     return; // TODO
   }
-  ParquetParams params(pool_, readerBase_->fileMetaData());
+  ParquetParams params(
+      pool_, readerBase_->bufferedInput(), readerBase_->fileMetaData());
 
   columnReader_ = ParquetColumnReader::build(
       readerBase_->schemaWithId(), // Id is schema id
@@ -615,6 +651,12 @@ bool ParquetRowReader::advanceToNextRowGroup() {
     return false;
   }
 
+  if (nextRowGroupIdsIdx_ > 0) {
+    // Let the filter order adapt to the new row group: age out
+    // selectivity from previous row groups and reorder on what remains.
+    options_.getScanSpec()->decayAdaptation();
+  }
+
   auto nextRowGroupIndex = rowGroupIds_[nextRowGroupIdsIdx_];
   readerBase_->scheduleRowGroups(
       rowGroupIds_,
@@ -209,11 +209,14 @@ void MapColumnReader::read(
 }
 
 void MapColumnReader::filterRowGroups(
-    uint64_t rowGroupSize,
-    const dwio::common::StatsContext& context,
-    dwio::common::FormatData::FilterRowGroupsResult& result) const {
-  keyReader_->filterRowGroups(rowGroupSize, context, result);
-  elementReader_->filterRowGroups(rowGroupSize, context, result);
+    uint64_t /*rowGroupSize*/,
+    const dwio::common::StatsContext& /*context*/,
+    dwio::common::FormatData::FilterRowGroupsResult& /*result*/) const {
+  // Filters under a repeated node select entries inside a single map,
+  // not top level rows. For example a key projection filter from
+  // required subfields drops the non-requested keys of each map but
+  // must keep every row, so key statistics may not eliminate row
+  // groups.
 }
 
 ListColumnReader::ListColumnReader(
@@ -311,10 +314,12 @@ void ListColumnReader::read(
 }
 
 void ListColumnReader::filterRowGroups(
-    uint64_t rowGroupSize,
-    const dwio::common::StatsContext& context,
-    dwio::common::FormatData::FilterRowGroupsResult& result) const {
-  child_->filterRowGroups(rowGroupSize, context, result);
+    uint64_t /*rowGroupSize*/,
+    const dwio::common::StatsContext& /*context*/,
+    dwio::common::FormatData::FilterRowGroupsResult& /*result*/) const {
+  // Filters under a repeated node select elements inside a single
+  // list, not top level rows, so element statistics may not eliminate
+  // row groups.
 }
 
 } // namespace facebook::velox::parquet
@@ -53,6 +53,13 @@ class RepeatedLengths {
   int32_t nextLengthIndex_{0};
 };
 
+/// Reader for Parquet maps. Maps are stored as repeated key/value
+/// groups, so unlike DWRF flat maps there is no per-key stream to
+/// skip. Key projection from required subfields is still supported:
+/// the keys ScanSpec carries a filter over the requested keys, the key
+/// reader drops the entries of non-requested keys and only the
+/// surviving entries are decoded from the values subtree and
+/// materialized.
 class MapColumnReader : public dwio::common::SelectiveMapColumnReader {
  public:
   MapColumnReader(
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/parquet/reader/SplitBlockBloomFilter.h"
+
+#include <xxhash.h>
+#include "velox/common/base/Exceptions.h"
+
+namespace facebook::velox::parquet {
+
+namespace {
+constexpr int32_t kBytesPerBlock = 32;
+constexpr int32_t kWordsPerBlock = 8;
+
+// Per-word salts from the Parquet split-block Bloom filter definition. Each
+// word of a block gets one bit derived from the low 32 bits of the hash and
+// its salt.
+constexpr uint32_t kSalt[kWordsPerBlock] = {
+    0x47b6137bU,
+    0x44974d91U,
+    0x8824ad5bU,
+    0xa2b7289dU,
+    0x705495c7U,
+    0x2df1424bU,
+    0x9efc4947U,
+    0x5c6bfb31U};
+
+// Returns the first word of the block selected by the high 32 bits of
+// 'hash', mapped onto 'numBlocks' without a division.
+inline uint32_t* blockOf(uint32_t* words, uint32_t numBlocks, uint64_t hash) {
+  const auto blockIndex = ((hash >> 32) * numBlocks) >> 32;
+  return words + blockIndex * kWordsPerBlock;
+}
+} // namespace
+
+SplitBlockBloomFilter::SplitBlockBloomFilter(void* bitset, int32_t numBytes)
+    : words_(reinterpret_cast<uint32_t*>(bitset)),
+      numBlocks_(numBytes / kBytesPerBlock) {
+  VELOX_CHECK_GT(numBytes, 0);
+  VELOX_CHECK_EQ(numBytes % kBytesPerBlock, 0);
+}
+
+// static
+uint64_t SplitBlockBloomFilter::hashBytes(const void* data, int32_t size) {
+  return XXH64(data, size, 0);
+}
+
+void SplitBlockBloomFilter::insert(uint64_t hash) {
+  auto* block = blockOf(words_, numBlocks_, hash);
+  const auto key = static_cast<uint32_t>(hash);
+  for (auto i = 0; i < kWordsPerBlock; ++i) {
+    block[i] |= 1U << ((key * kSalt[i]) >> 27);
+  }
+}
+
+bool SplitBlockBloomFilter::mayContain(uint64_t hash) const {
+  const auto* block = blockOf(words_, numBlocks_, hash);
+  const auto key = static_cast<uint32_t>(hash);
+  for (auto i = 0; i < kWordsPerBlock; ++i) {
+    if ((block[i] & (1U << ((key * kSalt[i]) >> 27))) == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace facebook::velox::parquet
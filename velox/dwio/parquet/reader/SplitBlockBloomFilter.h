@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace facebook::velox::parquet {
+
+/// Split-block Bloom filter over a caller-owned bitset, as defined by the
+/// Parquet format. The bitset is a sequence of 32-byte blocks of 8 32-bit
+/// words; a value sets/tests one salted bit in each word of one block.
+/// Values are hashed with 64-bit xxHash of their plain encoding.
+class SplitBlockBloomFilter {
+ public:
+  /// Wraps the 'numBytes' long bitset at 'bitset'. 'numBytes' must be a
+  /// non-zero multiple of 32. 'bitset' must stay live while 'this' is in
+  /// use and must be zero-initialized if values are to be inserted.
+  SplitBlockBloomFilter(void* bitset, int32_t numBytes);
+
+  /// Returns the hash of the 'size' bytes at 'data', the plain encoding of
+  /// a value.
+  static uint64_t hashBytes(const void* data, int32_t size);
+
+  /// Returns the hash of an integer value of Parquet physical type INT64.
+  static uint64_t hashInt64(int64_t value) {
+    return hashBytes(&value, sizeof(value));
+  }
+
+  /// Returns the hash of an integer value of Parquet physical type INT32.
+  static uint64_t hashInt32(int32_t value) {
+    return hashBytes(&value, sizeof(value));
+  }
+
+  void insert(uint64_t hash);
+
+  /// Returns false only if the value with 'hash' was never inserted.
+  bool mayContain(uint64_t hash) const;
+
+ private:
+  uint32_t* const words_;
+  const uint32_t numBlocks_;
+};
+
+} // namespace facebook::velox::parquet
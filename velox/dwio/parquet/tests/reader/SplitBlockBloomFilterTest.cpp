@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/dwio/parquet/reader/SplitBlockBloomFilter.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+using namespace facebook::velox::parquet;
+
+TEST(SplitBlockBloomFilterTest, empty) {
+  std::vector<char> bitset(1024, 0);
+  SplitBlockBloomFilter filter(bitset.data(), bitset.size());
+  for (int64_t value = 0; value < 1000; ++value) {
+    EXPECT_FALSE(filter.mayContain(SplitBlockBloomFilter::hashInt64(value)));
+  }
+}
+
+TEST(SplitBlockBloomFilterTest, insertAndProbe) {
+  // 2 bytes per value gives a low false positive rate.
+  std::vector<char> bitset(8192, 0);
+  SplitBlockBloomFilter filter(bitset.data(), bitset.size());
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<int64_t> dist;
+  std::vector<int64_t> inserted;
+  for (auto i = 0; i < 4000; ++i) {
+    inserted.push_back(dist(gen));
+    filter.insert(SplitBlockBloomFilter::hashInt64(inserted.back()));
+  }
+
+  // No false negatives.
+  for (const auto value : inserted) {
+    EXPECT_TRUE(filter.mayContain(SplitBlockBloomFilter::hashInt64(value)));
+  }
+
+  // Low false positive rate on values that were not inserted.
+  int32_t numFalsePositives = 0;
+  constexpr int32_t kNumProbes = 10'000;
+  for (auto i = 0; i < kNumProbes; ++i) {
+    if (filter.mayContain(SplitBlockBloomFilter::hashInt64(dist(gen)))) {
+      ++numFalsePositives;
+    }
+  }
+  EXPECT_LT(numFalsePositives, kNumProbes / 10);
+}
+
+TEST(SplitBlockBloomFilterTest, singleBlock) {
+  // The minimum legal bitset is one 32 byte block.
+  std::vector<char> bitset(32, 0);
+  SplitBlockBloomFilter filter(bitset.data(), bitset.size());
+  const auto hash = SplitBlockBloomFilter::hashInt32(123);
+  EXPECT_FALSE(filter.mayContain(hash));
+  filter.insert(hash);
+  EXPECT_TRUE(filter.mayContain(hash));
+}
+
+TEST(SplitBlockBloomFilterTest, hashIsPlainEncoding) {
+  // The same numeric value hashes differently for INT32 and INT64 physical
+  // types because the hash covers the plain encoded width.
+  EXPECT_NE(
+      SplitBlockBloomFilter::hashInt32(1), SplitBlockBloomFilter::hashInt64(1));
+  EXPECT_EQ(
+      SplitBlockBloomFilter::hashInt64(1),
+      SplitBlockBloomFilter::hashBytes(
+          "\x01\x00\x00\x00\x00\x00\x00\x00", 8));
+}
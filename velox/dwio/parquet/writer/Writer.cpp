@@ -19,7 +19,10 @@
 #include <arrow/c/bridge.h> // @manual
 #include <arrow/table.h> // @manual
 #include <parquet/arrow/writer.h> // @manual
+#include <xxhash.h>
+#include "velox/common/hyperloglog/SparseHll.h"
 #include "velox/dwio/parquet/writer/Writer.h"
+#include "velox/vector/DecodedVector.h"
 
 namespace facebook::velox::parquet {
 
@@ -96,29 +99,96 @@ struct ArrowContext {
 }
 
 std::shared_ptr<::parquet::WriterProperties> getArrowParquetWriterOptions(
-    const parquet::WriterOptions& options) {
+    const parquet::WriterOptions& options,
+    const std::vector<std::string>& plainEncodedColumns) {
   auto builder = ::parquet::WriterProperties::Builder();
   ::parquet::WriterProperties::Builder* properties = &builder;
   if (!options.enableDictionary) {
     properties = properties->disable_dictionary();
   }
+  for (const auto& column : plainEncodedColumns) {
+    properties = properties->disable_dictionary(column);
+  }
   properties =
       properties->compression(getArrowParquetCompression(options.compression));
   properties = properties->data_pagesize(options.dataPageSize);
+  properties =
+      properties->dictionary_pagesize_limit(options.dictionaryPageSizeLimit);
+  properties = properties->max_row_group_length(options.maxRowGroupLength);
   return properties->build();
 }
 
+namespace {
+// Estimates the ratio of distinct values over the first 'maxRows' rows of
+// 'vector'. Returns 0 when there is nothing to sample.
+double estimateDistinctRatio(
+    const BaseVector& vector,
+    vector_size_t maxRows,
+    memory::MemoryPool* pool) {
+  const auto numRows = std::min(vector.size(), maxRows);
+  if (numRows == 0) {
+    return 0;
+  }
+  HashStringAllocator allocator{pool};
+  common::hll::SparseHll hll{&allocator};
+  SelectivityVector rows{numRows};
+  DecodedVector decoded{vector, rows};
+  vector_size_t numSampled = 0;
+  for (vector_size_t i = 0; i < numRows; ++i) {
+    if (!decoded.isNullAt(i)) {
+      const auto value = decoded.valueAt<StringView>(i);
+      hll.insertHash(XXH64(value.data(), value.size(), 0));
+      ++numSampled;
+    }
+  }
+  if (numSampled == 0) {
+    return 0;
+  }
+  return hll.cardinality() / static_cast<double>(numSampled);
+}
+} // namespace
+
+std::vector<std::string> Writer::findHighCardinalityColumns(
+    const VectorPtr& data) const {
+  std::vector<std::string> columns;
+  if (!options_.enableDictionary ||
+      options_.dictionaryDistinctRatioThreshold >= 1) {
+    return columns;
+  }
+  auto* rowVector = data->as<RowVector>();
+  if (rowVector == nullptr) {
+    return columns;
+  }
+  const auto& rowType = rowVector->type()->asRow();
+  for (size_t i = 0; i < rowVector->childrenSize(); ++i) {
+    const auto& child = rowVector->childAt(i);
+    if (child == nullptr ||
+        (child->typeKind() != TypeKind::VARCHAR &&
+         child->typeKind() != TypeKind::VARBINARY)) {
+      continue;
+    }
+    const auto ratio = estimateDistinctRatio(
+        *child, options_.dictionarySampleRows, generalPool_.get());
+    if (ratio > options_.dictionaryDistinctRatioThreshold) {
+      columns.push_back(rowType.nameOf(i));
+    }
+  }
+  return columns;
+}
+
 Writer::Writer(
     std::unique_ptr<dwio::common::DataSink> sink,
     const WriterOptions& options,
     std::shared_ptr<memory::MemoryPool> pool)
     : rowsInRowGroup_(options.rowsInRowGroup),
       bufferGrowRatio_(options.bufferGrowRatio),
+      options_(options),
       pool_(std::move(pool)),
       generalPool_{pool_->addLeafChild(".general")},
       finalSink_(std::move(sink)) {
+  // Writer properties are finalized on first write when per-column
+  // dictionary decisions can be made from sampled data.
   arrowContext_ = std::make_shared<ArrowContext>();
-  arrowContext_->properties = getArrowParquetWriterOptions(options);
 }
 
 Writer::Writer(
@@ -143,6 +213,10 @@ void Writer::write(const VectorPtr& data) {
   if (!arrowContext_->writer) {
     stream_ =
         std::make_shared<ArrowDataBufferSink>(*generalPool_, bufferGrowRatio_);
+    if (!arrowContext_->properties) {
+      arrowContext_->properties = getArrowParquetWriterOptions(
+          options_, findHighCardinalityColumns(data));
+    }
     auto arrowProperties = ::parquet::ArrowWriterProperties::Builder().build();
     PARQUET_THROW_NOT_OK(::parquet::arrow::FileWriter::Open(
         *recordBatch->schema(),
@@ -35,7 +35,15 @@ struct WriterOptions {
   int64_t dataPageSize = 1'024 * 1'024;
   int32_t rowsInRowGroup = 10'000;
   int64_t maxRowGroupLength = 1'024 * 1'024;
+  // Size budget for a column's dictionary. Once exceeded, the remainder of
+  // the column chunk falls back to plain encoding.
   int64_t dictionaryPageSizeLimit = 1'024 * 1'024;
+  // String columns whose estimated distinct-value ratio exceeds this
+  // threshold are written without dictionary encoding. The ratio is
+  // estimated with HyperLogLog over the first 'dictionarySampleRows' rows
+  // of the first batch. Values >= 1 disable the adaptive decision.
+  double dictionaryDistinctRatioThreshold = 0.8;
+  int32_t dictionarySampleRows = 10'000;
   double bufferGrowRatio = 1;
   dwio::common::CompressionKind compression =
       dwio::common::CompressionKind_NONE;
@@ -74,8 +82,16 @@ class Writer : public dwio::common::Writer {
   void close();
 
  private:
+  // Returns names of string columns in 'data' whose sampled distinct-value
+  // ratio exceeds 'dictionaryDistinctRatioThreshold'. These are written
+  // without dictionary encoding.
+  std::vector<std::string> findHighCardinalityColumns(
+      const VectorPtr& data) const;
+
   const int32_t rowsInRowGroup_;
   const double bufferGrowRatio_;
+  // Copy of options. Used to finalize writer properties on first write.
+  const WriterOptions options_;
 
   // Pool for 'stream_'.
   std::shared_ptr<memory::MemoryPool> pool_;
@@ -183,6 +183,28 @@ class Aggregate {
       const std::vector<VectorPtr>& args,
       bool mayPushdown) = 0;
 
+  /// Returns true if the aggregate function supports retracting raw input
+  /// previously added to a single accumulator via addSingleGroupRawInput().
+  /// Used by the window operator to compute sliding frames incrementally.
+  virtual bool supportsRetract() const {
+    return false;
+  }
+
+  /// Removes previously added raw input from the single accumulator for
+  /// global aggregation. Every retracted row must have been added to the
+  /// accumulator exactly once via addSingleGroupRawInput() before. Restores
+  /// the null state of the accumulator if all added rows are retracted. Only
+  /// called if supportsRetract() returns true.
+  /// @param group Pointer to the start of the group row.
+  /// @param rows Rows of the 'args' to retract from the accumulator.
+  /// @param args Raw input previously added to the accumulator.
+  virtual void retractSingleGroupRawInput(
+      char* /*group*/,
+      const SelectivityVector& /*rows*/,
+      const std::vector<VectorPtr>& /*args*/) {
+    VELOX_NYI("Aggregate function does not support retracting input.");
+  }
+
   // Extracts final results (used for final and single aggregations).
   // @param groups Pointers to the start of the group rows.
   // @param numGroups Number of groups to extract results from.
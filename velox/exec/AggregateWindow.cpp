@@ -59,6 +59,11 @@ class AggregateWindowFunction : public exec::WindowFunction {
         name, core::AggregationNode::Step::kSingle, argTypes_, resultType);
     aggregate_->setAllocator(stringAllocator_);
 
+    // The intermediate type is needed to extract and merge the node states
+    // of the segment tree used for arbitrary frames.
+    intermediateType_ = exec::Aggregate::intermediateType(name, argTypes_);
+    segmentStateArgs_.resize(1);
+
     // Aggregate initialization.
     // Row layout is:
     //  - null flags - one bit per aggregate.
@@ -104,6 +109,11 @@ class AggregateWindowFunction : public exec::WindowFunction {
     partition_ = partition;
 
     previousFrameMetadata_.reset();
+
+    segmentTreeBuilt_ = false;
+    segmentTreeLevels_.clear();
+    segmentTreeArgVectors_.clear();
+    segmentQueryRows_.clear();
   }
 
   void apply(
@@ -151,6 +161,50 @@ class AggregateWindowFunction : public exec::WindowFunction {
           rawFrameEnds,
           resultOffset,
           result);
+    } else if (frameMetadata.slidingAggregation) {
+      vector_size_t startRow;
+      vector_size_t prevFrameStart;
+      vector_size_t prevFrameEnd;
+      if (frameMetadata.usePreviousAggregate) {
+        // The accumulator holds the frame of the last valid row of the
+        // previous block. The argument vectors are populated from the start
+        // of that frame so that its rows can be retracted as the frame
+        // slides forward.
+        startRow = previousFrameMetadata_->lastFrameStart;
+        prevFrameStart = previousFrameMetadata_->lastFrameStart;
+        prevFrameEnd = previousFrameMetadata_->lastRow + 1;
+      } else {
+        startRow = frameMetadata.firstRow;
+        prevFrameStart = frameMetadata.firstRow;
+        prevFrameEnd = frameMetadata.firstRow;
+
+        // This is the start of a new sliding aggregation. So the aggregate_
+        // function object should be initialized.
+        auto singleGroup = std::vector<vector_size_t>{0};
+        aggregate_->clear();
+        aggregate_->initializeNewGroups(&rawSingleGroupRow_, singleGroup);
+        aggregateInitialized_ = true;
+      }
+
+      fillArgVectors(startRow, frameMetadata.lastRow);
+      slidingAggregation(
+          validRows,
+          startRow,
+          frameMetadata.lastRow,
+          prevFrameStart,
+          prevFrameEnd,
+          rawFrameStarts,
+          rawFrameEnds,
+          resultOffset,
+          result);
+    } else if (partition_->numRows() >= kMinRowsForSegmentTree) {
+      // Arbitrary frames. Aggregate each frame from a segment tree of
+      // pre-aggregated partition ranges instead of scanning it in full.
+      if (!segmentTreeBuilt_) {
+        buildSegmentTree();
+      }
+      segmentTreeAggregation(
+          validRows, rawFrameStarts, rawFrameEnds, resultOffset, result);
     } else {
       fillArgVectors(frameMetadata.firstRow, frameMetadata.lastRow);
       simpleAggregation(
@@ -179,7 +233,17 @@ class AggregateWindowFunction : public exec::WindowFunction {
     // accumulated over the previous result to obtain the new result.
     bool incrementalAggregation;
 
-    // Resume incremental aggregation from the prior block.
+    // If both the frame start and the frame end rows are non-decreasing,
+    // the frame slides over the partition. Provided the aggregate function
+    // supports retracting input, the aggregation can be done by adding the
+    // rows entering the frame and retracting the rows leaving it.
+    bool slidingAggregation;
+
+    // Frame start of the last valid row in the block. Needed to resume
+    // sliding aggregation in the following block.
+    vector_size_t lastFrameStart;
+
+    // Resume incremental or sliding aggregation from the prior block.
     bool usePreviousAggregate;
   };
 
@@ -213,21 +277,35 @@ class AggregateWindowFunction : public exec::WindowFunction {
     vector_size_t firstRow = rawFrameStarts[firstValidRow];
     vector_size_t fixedFrameStartRow = firstRow;
     vector_size_t lastRow = rawFrameEnds[firstValidRow];
+    vector_size_t prevFrameStart = firstRow;
     vector_size_t prevFrameEnds = lastRow;
 
-    bool incrementalAggregation = true;
+    bool fixedStarts = true;
+    bool nonDecreasingStarts = true;
+    bool nonDecreasingEnds = true;
     validRows.applyToSelected([&](auto i) {
       firstRow = std::min(firstRow, rawFrameStarts[i]);
       lastRow = std::max(lastRow, rawFrameEnds[i]);
 
-      // Incremental aggregation can be done if :
-      // i) All rows have the same frameStart value.
-      // ii) The frame end values are non-decreasing.
-      incrementalAggregation &= (rawFrameStarts[i] == fixedFrameStartRow);
-      incrementalAggregation &= rawFrameEnds[i] >= prevFrameEnds;
+      fixedStarts &= (rawFrameStarts[i] == fixedFrameStartRow);
+      nonDecreasingStarts &= rawFrameStarts[i] >= prevFrameStart;
+      nonDecreasingEnds &= rawFrameEnds[i] >= prevFrameEnds;
+      prevFrameStart = rawFrameStarts[i];
       prevFrameEnds = rawFrameEnds[i];
     });
 
+    // Incremental aggregation can be done if :
+    // i) All rows have the same frameStart value.
+    // ii) The frame end values are non-decreasing.
+    bool incrementalAggregation = fixedStarts && nonDecreasingEnds;
+
+    // Sliding aggregation applies when the frame start values also move
+    // (so incremental aggregation doesn't apply), but both frame bounds are
+    // non-decreasing and the aggregate function can retract the rows that
+    // leave the frame.
+    bool slidingAggregation = !incrementalAggregation && nonDecreasingStarts &&
+        nonDecreasingEnds && aggregate_->supportsRetract();
+
     bool usePreviousAggregate = false;
     if (previousFrameMetadata_.has_value()) {
       auto previousFrame = previousFrameMetadata_.value();
@@ -240,9 +318,24 @@ class AggregateWindowFunction : public exec::WindowFunction {
           previousFrame.lastRow <= rawFrameEnds[firstValidRow]) {
         usePreviousAggregate = true;
       }
+
+      // Sliding aggregation continues between blocks if the non-decreasing
+      // frame bounds properties also hold between the last valid row of the
+      // previous block and the first valid row of the current block.
+      if (slidingAggregation && previousFrame.slidingAggregation &&
+          previousFrame.lastFrameStart <= rawFrameStarts[firstValidRow] &&
+          previousFrame.lastRow <= rawFrameEnds[firstValidRow]) {
+        usePreviousAggregate = true;
+      }
     }
 
-    return {firstRow, lastRow, incrementalAggregation, usePreviousAggregate};
+    return {
+        firstRow,
+        lastRow,
+        incrementalAggregation,
+        slidingAggregation,
+        prevFrameStart,
+        usePreviousAggregate};
   }
 
   void fillArgVectors(vector_size_t firstRow, vector_size_t lastRow) {
@@ -303,6 +396,236 @@ class AggregateWindowFunction : public exec::WindowFunction {
     setNullEmptyFramesResults(validRows, resultOffset, result);
   }
 
+  // Computes aggregates for frames whose start and end bounds both advance
+  // monotonically. The rows entering the frame at each row are added to the
+  // accumulator and the rows leaving it are retracted, so each input row is
+  // processed a constant number of times regardless of the frame size.
+  // 'startRow' is the first row the argument vectors are populated from.
+  // 'prevFrameStart' and 'prevFrameEnd' (end exclusive) give the frame
+  // accumulated so far.
+  void slidingAggregation(
+      const SelectivityVector& validRows,
+      vector_size_t startRow,
+      vector_size_t lastRow,
+      vector_size_t prevFrameStart,
+      vector_size_t prevFrameEnd,
+      const vector_size_t* rawFrameStarts,
+      const vector_size_t* rawFrameEnds,
+      vector_size_t resultOffset,
+      const VectorPtr& result) {
+    SelectivityVector rows;
+    rows.resize(lastRow + 1 - startRow);
+
+    auto updateRange = [&](vector_size_t begin, vector_size_t end, bool add) {
+      rows.clearAll();
+      rows.setValidRange(begin - startRow, end - startRow, true);
+      rows.updateBounds();
+      if (add) {
+        aggregate_->addSingleGroupRawInput(
+            rawSingleGroupRow_, rows, argVectors_, false);
+      } else {
+        aggregate_->retractSingleGroupRawInput(
+            rawSingleGroupRow_, rows, argVectors_);
+      }
+    };
+
+    validRows.applyToSelected([&](auto i) {
+      auto frameStart = rawFrameStarts[i];
+      auto frameEnd = rawFrameEnds[i] + 1;
+      // Add the rows entering the frame before retracting the ones leaving
+      // it. This way frames disjoint from the previous one are computed
+      // correctly as well: the retracted range cancels out any rows added
+      // ahead of the new frame start.
+      if (frameEnd > prevFrameEnd) {
+        updateRange(prevFrameEnd, frameEnd, true);
+      }
+      if (frameStart > prevFrameStart) {
+        updateRange(prevFrameStart, frameStart, false);
+      }
+
+      BaseVector::prepareForReuse(aggregateResultVector_, 1);
+      aggregate_->extractValues(
+          &rawSingleGroupRow_, 1, &aggregateResultVector_);
+      result->copy(aggregateResultVector_.get(), resultOffset + i, 0, 1);
+
+      prevFrameStart = frameStart;
+      prevFrameEnd = frameEnd;
+    });
+
+    // Set null values for empty (non valid) frames in the output block.
+    setNullEmptyFramesResults(validRows, resultOffset, result);
+  }
+
+  // Builds a segment tree over the rows of the current partition. The first
+  // level aggregates runs of kSegmentTreeFanout input rows into intermediate
+  // states; each following level aggregates runs of kSegmentTreeFanout states
+  // of the level below. Levels are added until one fits in a single run.
+  // With the tree, any frame decomposes into at most 2 * kSegmentTreeFanout
+  // values per level, making arbitrary frame aggregation O(log n) per row
+  // instead of O(frame size).
+  void buildSegmentTree() {
+    auto numRows = partition_->numRows();
+
+    // Extract the raw argument columns of the whole partition once. Queries
+    // aggregate directly over these values at the leaf level.
+    segmentTreeArgVectors_.resize(argVectors_.size());
+    for (auto i = 0; i < argIndices_.size(); i++) {
+      if (argIndices_[i] == kConstantChannel) {
+        segmentTreeArgVectors_[i] =
+            BaseVector::wrapInConstant(numRows, 0, argVectors_[i]);
+      } else {
+        segmentTreeArgVectors_[i] =
+            BaseVector::create(argTypes_[i], numRows, pool_);
+        partition_->extractColumn(
+            argIndices_[i], 0, numRows, 0, segmentTreeArgVectors_[i]);
+      }
+    }
+
+    // One all-false SelectivityVector per level (entry 0 for the input rows).
+    // addSegmentRange() sets just the queried range valid and clears it again
+    // to avoid O(partition size) work per range.
+    segmentQueryRows_.clear();
+    segmentQueryRows_.emplace_back();
+    segmentQueryRows_.back().resizeFill(numRows, false);
+
+    segmentTreeLevels_.clear();
+    const auto rowStride = bits::roundUp(
+        singleGroupRowSize_, aggregate_->accumulatorAlignmentSize());
+    vector_size_t levelSize = numRows;
+    int32_t level = -1;
+    while (levelSize > kSegmentTreeFanout) {
+      const vector_size_t numNodes =
+          bits::roundUp(levelSize, kSegmentTreeFanout) / kSegmentTreeFanout;
+
+      // Compute the node accumulators of this level in scratch rows and
+      // extract their intermediate states.
+      auto nodeRowsBuffer =
+          AlignedBuffer::allocate<char>(numNodes * rowStride, pool_);
+      auto* rawNodeRows = nodeRowsBuffer->asMutable<char>();
+      std::vector<char*> nodes(numNodes);
+      std::vector<vector_size_t> indices(numNodes);
+      for (vector_size_t j = 0; j < numNodes; j++) {
+        nodes[j] = rawNodeRows + j * rowStride;
+        indices[j] = j;
+      }
+      aggregate_->clear();
+      aggregate_->initializeNewGroups(
+          nodes.data(), folly::Range(indices.data(), numNodes));
+
+      auto& inputRows = segmentQueryRows_[level + 1];
+      for (vector_size_t j = 0; j < numNodes; j++) {
+        const auto runBegin = j * kSegmentTreeFanout;
+        const auto runEnd =
+            std::min<vector_size_t>(runBegin + kSegmentTreeFanout, levelSize);
+        inputRows.setValidRange(runBegin, runEnd, true);
+        inputRows.updateBounds();
+        if (level < 0) {
+          aggregate_->addSingleGroupRawInput(
+              nodes[j], inputRows, segmentTreeArgVectors_, false);
+        } else {
+          segmentStateArgs_[0] = segmentTreeLevels_[level];
+          aggregate_->addSingleGroupIntermediateResults(
+              nodes[j], inputRows, segmentStateArgs_, false);
+        }
+        inputRows.setValidRange(runBegin, runEnd, false);
+      }
+
+      auto states = BaseVector::create(intermediateType_, numNodes, pool_);
+      aggregate_->extractAccumulators(nodes.data(), numNodes, &states);
+      aggregate_->destroy(folly::Range(nodes.data(), numNodes));
+
+      segmentTreeLevels_.push_back(std::move(states));
+      segmentQueryRows_.emplace_back();
+      segmentQueryRows_.back().resizeFill(numNodes, false);
+
+      levelSize = numNodes;
+      ++level;
+    }
+
+    segmentTreeBuilt_ = true;
+  }
+
+  // Adds the values of rows ['begin', 'end') of segment tree 'level' to the
+  // single group accumulator. Level -1 stands for the raw input rows of the
+  // partition; higher levels add the pre-aggregated node states.
+  void addSegmentRange(int32_t level, vector_size_t begin, vector_size_t end) {
+    auto& rows = segmentQueryRows_[level + 1];
+    rows.setValidRange(begin, end, true);
+    rows.updateBounds();
+    if (level < 0) {
+      aggregate_->addSingleGroupRawInput(
+          rawSingleGroupRow_, rows, segmentTreeArgVectors_, false);
+    } else {
+      segmentStateArgs_[0] = segmentTreeLevels_[level];
+      aggregate_->addSingleGroupIntermediateResults(
+          rawSingleGroupRow_, rows, segmentStateArgs_, false);
+    }
+    rows.setValidRange(begin, end, false);
+  }
+
+  // Aggregates partition rows ['begin', 'end') into the single group
+  // accumulator using the segment tree. The covered ranges are added in row
+  // order so that order sensitive aggregates stay correct: left partial
+  // ranges on the way up, then the topmost covered span, then the right
+  // partial ranges on the way back down.
+  void segmentTreeAggregate(vector_size_t begin, vector_size_t end) {
+    int32_t level = -1;
+    rightSegmentRanges_.clear();
+    while (begin < end) {
+      if (level + 1 >= static_cast<int32_t>(segmentTreeLevels_.size())) {
+        // Top level. Scan the remaining range directly.
+        addSegmentRange(level, begin, end);
+        break;
+      }
+      const auto alignedBegin = bits::roundUp(begin, kSegmentTreeFanout);
+      const auto alignedEnd = (end / kSegmentTreeFanout) * kSegmentTreeFanout;
+      if (alignedBegin >= alignedEnd) {
+        // The range fits within a single run of the level above.
+        addSegmentRange(level, begin, end);
+        break;
+      }
+      if (begin < alignedBegin) {
+        addSegmentRange(level, begin, alignedBegin);
+      }
+      if (alignedEnd < end) {
+        rightSegmentRanges_.push_back({level, alignedEnd, end});
+      }
+      begin = alignedBegin / kSegmentTreeFanout;
+      end = alignedEnd / kSegmentTreeFanout;
+      ++level;
+    }
+    for (auto it = rightSegmentRanges_.rbegin();
+         it != rightSegmentRanges_.rend();
+         ++it) {
+      addSegmentRange(it->level, it->begin, it->end);
+    }
+  }
+
+  void segmentTreeAggregation(
+      const SelectivityVector& validRows,
+      const vector_size_t* rawFrameStarts,
+      const vector_size_t* rawFrameEnds,
+      vector_size_t resultOffset,
+      const VectorPtr& result) {
+    static auto kSingleGroup = std::vector<vector_size_t>{0};
+
+    validRows.applyToSelected([&](auto i) {
+      aggregate_->clear();
+      aggregate_->initializeNewGroups(&rawSingleGroupRow_, kSingleGroup);
+      aggregateInitialized_ = true;
+
+      segmentTreeAggregate(rawFrameStarts[i], rawFrameEnds[i] + 1);
+
+      BaseVector::prepareForReuse(aggregateResultVector_, 1);
+      aggregate_->extractValues(
+          &rawSingleGroupRow_, 1, &aggregateResultVector_);
+      result->copy(aggregateResultVector_.get(), resultOffset + i, 0, 1);
+    });
+
+    // Set null values for empty (non valid) frames in the output block.
+    setNullEmptyFramesResults(validRows, resultOffset, result);
+  }
+
   void simpleAggregation(
       const SelectivityVector& validRows,
       vector_size_t minFrame,
@@ -366,6 +689,47 @@ class AggregateWindowFunction : public exec::WindowFunction {
   // Stores metadata about the previous output block of the partition
   // to optimize aggregate computation and reading argument vectors.
   std::optional<FrameMetadata> previousFrameMetadata_;
+
+  // Number of child values aggregated into each segment tree node.
+  static constexpr vector_size_t kSegmentTreeFanout = 16;
+
+  // Partitions smaller than this are aggregated with full frame scans; the
+  // tree construction cost doesn't pay off for them.
+  static constexpr vector_size_t kMinRowsForSegmentTree = 64;
+
+  // Intermediate (partial aggregation) type of the aggregate function. Used
+  // for the vectors of segment tree node states.
+  TypePtr intermediateType_;
+
+  // True after buildSegmentTree() has run for the current partition.
+  bool segmentTreeBuilt_ = false;
+
+  // Segment tree node states, one vector of intermediate states per level.
+  // Level 0 covers runs of kSegmentTreeFanout partition rows.
+  std::vector<VectorPtr> segmentTreeLevels_;
+
+  // Raw argument vectors covering the full partition, read by leaf level
+  // segment tree queries.
+  std::vector<VectorPtr> segmentTreeArgVectors_;
+
+  // One scratch SelectivityVector per segment tree level (entry 0 for the
+  // input rows), kept all-false between uses.
+  std::vector<SelectivityVector> segmentQueryRows_;
+
+  // Single element scratch vector to pass a level of node states as the
+  // argument of addSingleGroupIntermediateResults.
+  std::vector<VectorPtr> segmentStateArgs_;
+
+  // A range of segment tree rows pending aggregation at some level.
+  struct SegmentRange {
+    int32_t level;
+    vector_size_t begin;
+    vector_size_t end;
+  };
+
+  // Right-side partial ranges collected by segmentTreeAggregate(). They are
+  // applied in reverse collection order to keep row order aggregation.
+  std::vector<SegmentRange> rightSegmentRanges_;
 };
 
 } // namespace
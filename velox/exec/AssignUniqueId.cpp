@@ -47,6 +47,7 @@ AssignUniqueId::AssignUniqueId(
 
   rowIdCounter_ = 0;
   maxRowIdCounterValue_ = 0;
+  rowIdRequestSize_ = kRowIdsPerRequest;
 }
 
 void AssignUniqueId::addInput(RowVectorPtr input) {
@@ -88,20 +89,28 @@ void AssignUniqueId::generateIdColumn(vector_size_t size) {
       requestRowIds();
     }
 
-    auto batchSize =
-        std::min(maxRowIdCounterValue_ - rowIdCounter_ + 1, kRowIdsPerRequest);
-    auto end = (int32_t)std::min((int64_t)size, start + batchSize);
-    VELOX_CHECK_EQ((rowIdCounter_ + end - 1) & uniqueValueMask_, 0);
+    auto count = (vector_size_t)std::min(
+        maxRowIdCounterValue_ - rowIdCounter_, (int64_t)(size - start));
+    VELOX_CHECK_EQ((rowIdCounter_ + count - 1) & uniqueValueMask_, 0);
     std::iota(
-        rawResults + start, rawResults + end, uniqueValueMask_ | rowIdCounter_);
-    rowIdCounter_ += end;
-    start = end;
+        rawResults + start,
+        rawResults + start + count,
+        uniqueValueMask_ | rowIdCounter_);
+    rowIdCounter_ += count;
+    start += count;
   }
 }
 
 void AssignUniqueId::requestRowIds() {
-  rowIdCounter_ = rowIdPool_->fetch_add(kRowIdsPerRequest);
+  rowIdCounter_ = rowIdPool_->fetch_add(rowIdRequestSize_);
+  VELOX_CHECK_LT(
+      rowIdCounter_, kMaxRowId, "Ran out of unique IDs for the task");
   maxRowIdCounterValue_ =
-      std::min(rowIdCounter_ + kRowIdsPerRequest, kMaxRowId);
+      std::min(rowIdCounter_ + rowIdRequestSize_, kMaxRowId);
+  // Drivers that exhaust a range ask for exponentially larger ones, up
+  // to a cap. This amortizes traffic on the shared counter for
+  // long-running pipelines without wasting ID space on drivers that
+  // see little data.
+  rowIdRequestSize_ = std::min(rowIdRequestSize_ * 2, kMaxRowIdsPerRequest);
 }
 } // namespace facebook::velox::exec
@@ -56,6 +56,7 @@ class AssignUniqueId : public Operator {
   void requestRowIds();
 
   const int64_t kRowIdsPerRequest = 1L << 20;
+  const int64_t kMaxRowIdsPerRequest = 1L << 26;
   const int64_t kMaxRowId = 1L << 40;
   const int64_t kTaskUniqueIdLimit = 1L << 24;
 
@@ -63,6 +64,11 @@ class AssignUniqueId : public Operator {
   int64_t rowIdCounter_;
   int64_t maxRowIdCounterValue_;
 
+  /// Number of row IDs to fetch from 'rowIdPool_' on the next request.
+  /// Starts at kRowIdsPerRequest and doubles on every request up to
+  /// kMaxRowIdsPerRequest.
+  int64_t rowIdRequestSize_;
+
   std::shared_ptr<std::atomic_int64_t> rowIdPool_;
 };
 } // namespace facebook::velox::exec
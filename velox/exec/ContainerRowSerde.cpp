@@ -572,6 +572,46 @@ StringView readStringView(ByteStream& stream, std::string& storage) {
   return StringView(storage);
 }
 
+// Compares the next string of 'left' and 'right', consuming each stream
+// piecewise without copying. Consumes the full string from both streams
+// even when the comparison is decided early, so that the streams stay
+// positioned for the next field.
+int32_t compareStringsAsc(ByteStream& left, ByteStream& right) {
+  const int32_t leftSize = left.read<int32_t>();
+  const int32_t rightSize = right.read<int32_t>();
+  int32_t leftToFetch = leftSize;
+  int32_t rightToFetch = rightSize;
+  std::string_view leftView;
+  std::string_view rightView;
+  int32_t result = 0;
+  for (;;) {
+    if (leftView.empty()) {
+      if (leftToFetch == 0) {
+        break;
+      }
+      leftView = left.nextView(leftToFetch);
+      leftToFetch -= leftView.size();
+    }
+    if (rightView.empty()) {
+      if (rightToFetch == 0) {
+        break;
+      }
+      rightView = right.nextView(rightToFetch);
+      rightToFetch -= rightView.size();
+    }
+    auto compareSize = std::min(leftView.size(), rightView.size());
+    result = memcmp(leftView.data(), rightView.data(), compareSize);
+    if (result != 0) {
+      break;
+    }
+    leftView.remove_prefix(compareSize);
+    rightView.remove_prefix(compareSize);
+  }
+  left.skip(leftToFetch);
+  right.skip(rightToFetch);
+  return result != 0 ? result : leftSize - rightSize;
+}
+
 // Comparison of two serializations.
 int32_t compareSwitch(
     ByteStream& left,
@@ -602,12 +642,8 @@ int32_t compare<TypeKind::VARCHAR>(
     CompareFlags flags) {
   VELOX_DCHECK(!flags.stopAtNull, "not supported compare flag");
 
-  std::string leftStorage;
-  std::string rightStorage;
-  StringView leftValue = readStringView(left, leftStorage);
-  StringView rightValue = readStringView(right, rightStorage);
-  return flags.ascending ? leftValue.compare(rightValue)
-                         : rightValue.compare(leftValue);
+  auto result = compareStringsAsc(left, right);
+  return flags.ascending ? result : result * -1;
 }
 
 template <>
@@ -618,12 +654,8 @@ int32_t compare<TypeKind::VARBINARY>(
     CompareFlags flags) {
   VELOX_DCHECK(!flags.stopAtNull, "not supported compare flag");
 
-  std::string leftStorage;
-  std::string rightStorage;
-  StringView leftValue = readStringView(left, leftStorage);
-  StringView rightValue = readStringView(right, rightStorage);
-  return flags.ascending ? leftValue.compare(rightValue)
-                         : rightValue.compare(leftValue);
+  auto result = compareStringsAsc(left, right);
+  return flags.ascending ? result : result * -1;
 }
 
 int32_t compareArrays(
@@ -18,6 +18,8 @@
 #include <folly/executors/QueuedImmediateExecutor.h>
 #include <folly/executors/thread_factory/InitThreadFactory.h>
 #include <gflags/gflags.h>
+#include "velox/common/memory/MemoryAllocator.h"
+#include "velox/common/process/PerfEventCounters.h"
 #include "velox/common/testutil/TestValue.h"
 #include "velox/common/time/Timer.h"
 #include "velox/exec/Operator.h"
@@ -26,6 +28,13 @@
 
 using facebook::velox::common::testutil::TestValue;
 
+DEFINE_bool(
+    velox_driver_track_memory_access,
+    false,
+    "Measure last-level cache misses and estimated memory bytes of each "
+    "operator call with perf events and record them in the operator's "
+    "runtime stats.");
+
 namespace facebook::velox::exec {
 
 DriverCtx::DriverCtx(
@@ -38,7 +47,8 @@ DriverCtx::DriverCtx(
       pipelineId(_pipelineId),
       splitGroupId(_splitGroupId),
       partitionId(_partitionId),
-      task(_task) {}
+      task(_task),
+      vectorPool(std::make_unique<VectorPool>(task->pool())) {}
 
 const core::QueryConfig& DriverCtx::queryConfig() const {
   return task->queryCtx()->queryConfig();
@@ -64,6 +74,7 @@ std::optional<Spiller::Config> DriverCtx::makeSpillConfig(
           task->spillDirectory(), pipelineId, driverId, operatorId),
       queryConfig.maxSpillFileSize(),
       queryConfig.minSpillRunSize(),
+      queryConfig.spillCompressionCodec(),
       task->queryCtx()->spillExecutor(),
       queryConfig.spillableReservationGrowthPct(),
       HashBitRange(
@@ -212,6 +223,13 @@ void Driver::init(
   operators_ = std::move(operators);
   curOpIndex_ = operators_.size() - 1;
   trackOperatorCpuUsage_ = ctx_->queryConfig().operatorTrackCpuUsage();
+  tracer_ = ctx_->task->tracer();
+  // Install initial row budgets, e.g. cap the very first scan batch of
+  // a LIMIT query before any rows are read.
+  const int32_t numOperators = operators_.size();
+  for (int32_t i = 1; i < numOperators; ++i) {
+    pushdownRowBudget(i);
+  }
 }
 
 namespace {
@@ -276,6 +294,30 @@ void Driver::pushdownFilters(int operatorIndex) {
   op->clearDynamicFilters();
 }
 
+void Driver::pushdownRowBudget(int operatorIndex) {
+  auto op = operators_[operatorIndex].get();
+  const auto budget = op->remainingRowBudget();
+  if (!budget.has_value() || budget.value() <= 0) {
+    return;
+  }
+
+  // Walk operator list upstream and find a place to install the
+  // budget. The budget caps the batch size of the source, not the
+  // total number of rows it reads, so crossing an operator that drops
+  // rows stays correct and only costs extra batches. An operator that
+  // can produce more rows than it consumes invalidates the budget.
+  for (auto i = operatorIndex - 1; i >= 0; --i) {
+    auto prevOp = operators_[i].get();
+    if (prevOp->canAddRowBudget()) {
+      prevOp->addRowBudget(budget.value());
+      break;
+    }
+    if (!prevOp->isFilter()) {
+      break;
+    }
+  }
+}
+
 RowVectorPtr Driver::next(std::shared_ptr<BlockingState>& blockingState) {
   enqueueInternal();
 
@@ -300,6 +342,81 @@ void Driver::enqueueInternal() {
   queueTimeStartMicros_ = getCurrentTimeMicro();
 }
 
+namespace {
+// Measures last-level cache misses of a single operator call and records
+// them in the operator's runtime stats, which roll up into TaskStats. Active
+// only when --velox_driver_track_memory_access is set and the platform
+// supports perf events.
+class ScopedOperatorPerfCounters {
+ public:
+  explicit ScopedOperatorPerfCounters(Operator* op) {
+    if (FOLLY_LIKELY(!FLAGS_velox_driver_track_memory_access)) {
+      return;
+    }
+    counters_ = process::PerfEventCounters::threadLocalInstance();
+    if (counters_ != nullptr) {
+      op_ = op;
+      counters_->start();
+    }
+  }
+
+  ~ScopedOperatorPerfCounters() {
+    if (op_ == nullptr) {
+      return;
+    }
+    auto counts = counters_->stop();
+    auto lockedStats = op_->stats().wlock();
+    lockedStats->addRuntimeStat(
+        "llcMisses", RuntimeCounter(counts.llcMisses));
+    lockedStats->addRuntimeStat(
+        "llcMissBytes",
+        RuntimeCounter(counts.memoryBytes, RuntimeCounter::Unit::kBytes));
+  }
+
+ private:
+  process::PerfEventCounters* counters_{nullptr};
+  Operator* op_{nullptr};
+};
+
+// Records one operator call as a time slice in the task's execution
+// trace. No-op when tracing is not enabled for the query.
+class ScopedOperatorTraceSlice {
+ public:
+  ScopedOperatorTraceSlice(
+      TaskTracer* tracer,
+      const DriverCtx& driverCtx,
+      Operator* op,
+      const char* method)
+      : tracer_(tracer) {
+    if (FOLLY_UNLIKELY(tracer_ != nullptr)) {
+      pipelineId_ = driverCtx.pipelineId;
+      driverId_ = driverCtx.driverId;
+      name_ = fmt::format("{}::{}", op->operatorType(), method);
+      startUs_ = getCurrentTimeMicro();
+    }
+  }
+
+  ~ScopedOperatorTraceSlice() {
+    if (FOLLY_UNLIKELY(tracer_ != nullptr)) {
+      tracer_->addSlice(
+          pipelineId_,
+          driverId_,
+          std::move(name_),
+          "operator",
+          startUs_,
+          getCurrentTimeMicro());
+    }
+  }
+
+ private:
+  TaskTracer* const tracer_;
+  int32_t pipelineId_{0};
+  int32_t driverId_{0};
+  std::string name_;
+  uint64_t startUs_{0};
+};
+} // namespace
+
 #define CALL_OPERATOR(call, operator, methodName)                       \
   try {                                                                 \
     call;                                                               \
@@ -410,7 +527,14 @@ StopReason Driver::runInternal(
                     op->stats().wlock()->getOutputTiming.add(deltaTiming);
                   });
               RuntimeStatWriterScopeGuard statsWriterGuard(op);
-              CALL_OPERATOR(result = op->getOutput(), op, "getOutput");
+              {
+                OperatorCycleSampler sampler(*op, "get_output");
+                ScopedOperatorPerfCounters perfCounters(op);
+                ScopedOperatorTraceSlice traceSlice(
+                    tracer_, *ctx_, op, "getOutput");
+                CALL_OPERATOR(result = op->getOutput(), op, "getOutput");
+                sampler.setNumRows(result ? result->size() : 0);
+              }
               if (result) {
                 VELOX_CHECK(
                     result->size() > 0,
@@ -425,6 +549,7 @@ StopReason Driver::runInternal(
               }
             }
             pushdownFilters(i);
+            pushdownRowBudget(i);
             if (result) {
               auto timer = createDeltaCpuWallTimer(
                   [nextOp](const CpuWallTiming& timing) {
@@ -439,7 +564,14 @@ StopReason Driver::runInternal(
                   "facebook::velox::exec::Driver::runInternal::addInput",
                   nextOp);
 
-              CALL_OPERATOR(nextOp->addInput(result), nextOp, "addInput");
+              {
+                OperatorCycleSampler sampler(*nextOp, "add_input");
+                sampler.setNumRows(result->size());
+                ScopedOperatorPerfCounters perfCounters(nextOp);
+                ScopedOperatorTraceSlice traceSlice(
+                    tracer_, *ctx_, nextOp, "addInput");
+                CALL_OPERATOR(nextOp->addInput(result), nextOp, "addInput");
+              }
 
               // The next iteration will see if operators_[i + 1] has
               // output now that it got input.
@@ -489,7 +621,14 @@ StopReason Driver::runInternal(
                 createDeltaCpuWallTimer([op](const CpuWallTiming& timing) {
                   op->stats().wlock()->getOutputTiming.add(timing);
                 });
-            CALL_OPERATOR(result = op->getOutput(), op, "getOutput");
+            {
+              OperatorCycleSampler sampler(*op, "get_output");
+              ScopedOperatorPerfCounters perfCounters(op);
+              ScopedOperatorTraceSlice traceSlice(
+                  tracer_, *ctx_, op, "getOutput");
+              CALL_OPERATOR(result = op->getOutput(), op, "getOutput");
+              sampler.setNumRows(result ? result->size() : 0);
+            }
             if (result) {
               VELOX_CHECK(
                   result->size() > 0,
@@ -514,6 +653,7 @@ StopReason Driver::runInternal(
             return StopReason::kAtEnd;
           }
           pushdownFilters(i);
+          pushdownRowBudget(i);
           continue;
         }
       }
@@ -562,6 +702,9 @@ void Driver::run(std::shared_ptr<Driver> self) {
       return;
 
     case StopReason::kYield:
+      // The thread may sit in the queue for a while. Do not hold on to
+      // small free blocks in the meantime.
+      memory::ThreadAllocationCache::flush();
       // Go to the end of the queue.
       enqueue(self);
       return;
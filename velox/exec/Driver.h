@@ -33,6 +33,7 @@ class ExchangeClient;
 class Operator;
 struct OperatorStats;
 class Task;
+class TaskTracer;
 
 enum class StopReason {
   // Keep running.
@@ -213,6 +214,11 @@ struct DriverCtx {
   std::shared_ptr<Task> task;
   Driver* driver;
 
+  /// Vector pool shared by the operators of this driver's pipeline so that
+  /// output vectors released by one operator can be reused by the next.
+  /// Only used from the driver thread.
+  const std::unique_ptr<VectorPool> vectorPool;
+
   explicit DriverCtx(
       std::shared_ptr<Task> _task,
       int _driverId,
@@ -324,6 +330,11 @@ class Driver : public std::enable_shared_from_this<Driver> {
   // position in the pipeline.
   void pushdownFilters(int operatorIndex);
 
+  // Push down the remaining row budget of the operator at the specified
+  // position in the pipeline, e.g. caps the read size of a table scan at
+  // the number of rows a downstream Limit still accepts.
+  void pushdownRowBudget(int operatorIndex);
+
   /// If 'trackOperatorCpuUsage_' is true, returns initialized timer object to
   /// track cpu and wall time of an operation. Returns null otherwise.
   /// The delta CpuWallTiming object would be passes to 'func' upon destruction
@@ -353,6 +364,9 @@ class Driver : public std::enable_shared_from_this<Driver> {
 
   bool trackOperatorCpuUsage_;
 
+  // The Task's execution tracer or nullptr if tracing is not enabled.
+  TaskTracer* tracer_{nullptr};
+
   friend struct DriverFactory;
 };
 
@@ -37,6 +37,13 @@ class EnforceSingleRow : public Operator {
     return true;
   }
 
+  std::optional<int64_t> remainingRowBudget() const override {
+    // One row is expected and a second row is needed only to prove the
+    // input misbehaves, so upstream never has to decode more than two
+    // rows at a time.
+    return input_ == nullptr ? 2 : 1;
+  }
+
   void addInput(RowVectorPtr input) override;
 
   void noMoreInput() override;
@@ -93,7 +93,10 @@ class LocalExchangeSource : public ExchangeSource {
     buffers->getData(
         taskId_,
         destination_,
-        kMaxBytes,
+        // Request at most the queue's target size so a queue with a small
+        // buffer limit, e.g. a merge exchange source, is not overshot by a
+        // single large response.
+        std::min<uint64_t>(kMaxBytes, queue_->minBytes()),
         sequence_,
         // Since this lambda may outlive 'this', we need to capture a
         // shared_ptr to the current object (self).
@@ -109,6 +112,12 @@ class LocalExchangeSource : public ExchangeSource {
             data.erase(data.begin(), data.begin() + nExtra);
             sequence = requestedSequence;
           }
+          // The producer and consumer live in the same process, so the pages
+          // are used as is, without copying. The IOBufs share the memory of
+          // the producer's serialized pages, so each page holds a reference
+          // on the producer task to keep the backing memory pools alive until
+          // the page is deserialized and freed.
+          auto task = buffers->taskFor(taskId_);
           std::vector<std::unique_ptr<SerializedPage>> pages;
           bool atEnd = false;
           for (auto& inputPage : data) {
@@ -117,9 +126,16 @@ class LocalExchangeSource : public ExchangeSource {
               // Keep looping, there could be extra end markers.
               continue;
             }
-            inputPage->unshare();
-            pages.push_back(
-                std::make_unique<SerializedPage>(std::move(inputPage)));
+            if (FOLLY_UNLIKELY(task == nullptr)) {
+              // The producer's buffers were deleted concurrently. Copy the
+              // data since nothing keeps the backing memory alive.
+              inputPage->unshare();
+              pages.push_back(
+                  std::make_unique<SerializedPage>(std::move(inputPage)));
+            } else {
+              pages.push_back(std::make_unique<SerializedPage>(
+                  std::move(inputPage), [task](auto& /*iobuf*/) {}));
+            }
             inputPage = nullptr;
           }
           numPages_ += pages.size();
@@ -16,6 +16,7 @@
 #include "velox/exec/FilterProject.h"
 #include "velox/core/Expressions.h"
 #include "velox/expression/Expr.h"
+#include "velox/expression/ExprSetPool.h"
 #include "velox/expression/FieldReference.h"
 
 namespace facebook::velox::exec {
@@ -52,7 +53,9 @@ FilterProject::FilterProject(
           operatorId,
           project ? project->id() : filter->id(),
           "FilterProject"),
-      hasFilter_(filter != nullptr) {
+      hasFilter_(filter != nullptr),
+      compactOutputMaxPct_(
+          driverCtx->queryConfig().filterCompactOutputMaxPct()) {
   std::vector<core::TypedExprPtr> allExprs;
   if (hasFilter_) {
     allExprs.push_back(filter->filter());
@@ -75,7 +78,16 @@ FilterProject::FilterProject(
     isIdentityProjection_ = true;
   }
   numExprs_ = allExprs.size();
-  exprs_ = makeExprSetFromFlag(std::move(allExprs), operatorCtx_->execCtx());
+  auto* queryCtx = operatorCtx_->execCtx()->queryCtx();
+  if (queryCtx->queryConfig().exprReuseCompiledExpressions()) {
+    const auto& inputRowType = project ? project->sources()[0]->outputType()
+                                       : filter->sources()[0]->outputType();
+    exprs_ = ExprSetPool::instance().get(allExprs, inputRowType, queryCtx);
+    pooledExprs_ = exprs_ != nullptr;
+  }
+  if (exprs_ == nullptr) {
+    exprs_ = makeExprSetFromFlag(std::move(allExprs), operatorCtx_->execCtx());
+  }
 
   if (numExprs_ > 0 && !identityProjections_.empty()) {
     auto inputType = project ? project->sources()[0]->outputType()
@@ -179,10 +191,33 @@ RowVectorPtr FilterProject::getOutput() {
     project(*rows, evalCtx);
   }
 
+  if (!allRowsSelected && shouldCompactOutput(numOut)) {
+    auto output = fillOutput(numOut, filterEvalCtx_.selectedIndices);
+    for (auto& child : output->children()) {
+      BaseVector::flattenVector(child);
+    }
+    return output;
+  }
+
   return fillOutput(
       numOut, allRowsSelected ? nullptr : filterEvalCtx_.selectedIndices);
 }
 
+bool FilterProject::shouldCompactOutput(vector_size_t numOut) const {
+  if (compactOutputMaxPct_ <= 0 ||
+      numOut * 100 >= input_->size() * compactOutputMaxPct_) {
+    return false;
+  }
+  // Compacting loads lazy columns in full. Keep the dictionary wrap if an
+  // output column is a lazy vector that has not been loaded.
+  for (const auto& projection : identityProjections_) {
+    if (isLazyNotLoaded(*input_->childAt(projection.inputChannel))) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void FilterProject::project(const SelectivityVector& rows, EvalCtx& evalCtx) {
   exprs_->eval(
       hasFilter_ ? 1 : 0, numExprs_, !hasFilter_, rows, evalCtx, results_);
@@ -53,7 +53,12 @@ class FilterProject : public Operator {
 
   void close() override {
     Operator::close();
-    exprs_->clear();
+    if (pooledExprs_) {
+      // Hands the leased ExprSet back to the pool.
+      exprs_.reset();
+    } else if (exprs_ != nullptr) {
+      exprs_->clear();
+    }
   }
 
  private:
@@ -73,9 +78,21 @@ class FilterProject : public Operator {
   // pre-condition: !isIdentityProjection_
   void project(const SelectivityVector& rows, EvalCtx& evalCtx);
 
+  // True if 'numOut' passing rows out of 'input_' should be copied into
+  // flat output vectors instead of wrapping the input in dictionaries.
+  // See QueryConfig::kFilterCompactOutputMaxPct.
+  bool shouldCompactOutput(vector_size_t numOut) const;
+
   // If true exprs_[0] is a filter and the other expressions are projections
   const bool hasFilter_{false};
-  std::unique_ptr<ExprSet> exprs_;
+
+  // Filter selectivity percentage below which output is compacted by
+  // copy. 0 disables compaction.
+  const int32_t compactOutputMaxPct_;
+  std::shared_ptr<ExprSet> exprs_;
+  // True if 'exprs_' is leased from the process-wide ExprSetPool
+  // rather than compiled for this operator.
+  bool pooledExprs_{false};
   int32_t numExprs_;
 
   FilterEvalCtx filterEvalCtx_;
@@ -79,43 +79,84 @@ RowVectorPtr GroupId::getOutput() {
     return nullptr;
   }
 
-  // Make a copy of input for the grouping set at 'groupingSetIndex_'.
-  auto numInput = input_->size();
+  // Repeat the input once per grouping set in a single output batch. A
+  // grouping key appearing in multiple sets is a dictionary over the
+  // shared input column, hence downstream aggregation hashes each
+  // distinct input row once and reuses the hash across grouping sets
+  // via the VectorHasher dictionary cache.
+  const vector_size_t numInput = input_->size();
+  const auto numGroupingSets = groupingKeyMappings_.size();
+  const vector_size_t numOutput = numInput * numGroupingSets;
+
+  auto indices = allocateIndices(numOutput, pool());
+  auto* rawIndices = indices->asMutable<vector_size_t>();
+  for (auto set = 0; set < numGroupingSets; ++set) {
+    std::iota(
+        rawIndices + set * numInput,
+        rawIndices + (set + 1) * numInput,
+        0);
+  }
 
   std::vector<VectorPtr> outputColumns(outputType_->size());
 
-  const auto& mapping = groupingKeyMappings_[groupingSetIndex_];
-  auto numGroupingKeys = mapping.size();
+  auto numGroupingKeys = groupingKeyMappings_[0].size();
 
   // Fill in grouping keys.
   for (auto i = 0; i < numGroupingKeys; ++i) {
-    if (mapping[i] == kMissingGroupingKey) {
-      // Add null column.
+    column_index_t inputChannel = kMissingGroupingKey;
+    bool missingInSomeSet = false;
+    for (const auto& mapping : groupingKeyMappings_) {
+      if (mapping[i] == kMissingGroupingKey) {
+        missingInSomeSet = true;
+      } else {
+        inputChannel = mapping[i];
+      }
+    }
+
+    if (inputChannel == kMissingGroupingKey) {
+      // The key is in no grouping set. Add null column.
       outputColumns[i] = BaseVector::createNullConstant(
-          outputType_->childAt(i), numInput, pool());
-    } else {
-      outputColumns[i] = input_->childAt(mapping[i]);
+          outputType_->childAt(i), numOutput, pool());
+      continue;
     }
+
+    // Nulls for the grouping sets that do not contain the key.
+    BufferPtr nulls = nullptr;
+    if (missingInSomeSet) {
+      nulls = allocateNulls(numOutput, pool());
+      auto* rawNulls = nulls->asMutable<uint64_t>();
+      for (auto set = 0; set < numGroupingSets; ++set) {
+        if (groupingKeyMappings_[set][i] == kMissingGroupingKey) {
+          bits::fillBits(
+              rawNulls, set * numInput, (set + 1) * numInput, bits::kNull);
+        }
+      }
+    }
+
+    outputColumns[i] = BaseVector::wrapInDictionary(
+        std::move(nulls), indices, numOutput, input_->childAt(inputChannel));
   }
 
   // Fill in aggregation inputs.
   for (auto i = 0; i < aggregationInputs_.size(); ++i) {
-    outputColumns[numGroupingKeys + i] = input_->childAt(aggregationInputs_[i]);
+    outputColumns[numGroupingKeys + i] = BaseVector::wrapInDictionary(
+        nullptr, indices, numOutput, input_->childAt(aggregationInputs_[i]));
   }
 
   // Add groupId column.
-  outputColumns[outputType_->size() - 1] =
-      std::make_shared<ConstantVector<int64_t>>(
-          pool(), numInput, false, BIGINT(), groupingSetIndex_);
-
-  ++groupingSetIndex_;
-  if (groupingSetIndex_ == groupingKeyMappings_.size()) {
-    groupingSetIndex_ = 0;
-    input_ = nullptr;
+  auto groupIdVector = BaseVector::create<FlatVector<int64_t>>(
+      BIGINT(), numOutput, pool());
+  auto* rawGroupIds = groupIdVector->mutableRawValues();
+  for (auto set = 0; set < numGroupingSets; ++set) {
+    std::fill(
+        rawGroupIds + set * numInput, rawGroupIds + (set + 1) * numInput, set);
   }
+  outputColumns[outputType_->size() - 1] = std::move(groupIdVector);
+
+  input_ = nullptr;
 
   return std::make_shared<RowVector>(
-      pool(), outputType_, nullptr, numInput, std::move(outputColumns));
+      pool(), outputType_, nullptr, numOutput, std::move(outputColumns));
 }
 
 } // namespace facebook::velox::exec
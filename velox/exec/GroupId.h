@@ -57,12 +57,5 @@ class GroupId : public Operator {
   /// A list of input column indices corresponding to aggregation inputs. The
   /// position in the list identifies the column in the output.
   std::vector<column_index_t> aggregationInputs_;
-
-  /// 'getOutput()' returns 'input_' for one grouping set at a time.
-  /// 'groupingSetIndex_' contains the index of the grouping set to output in
-  /// the next 'getOutput' call. This index is used to generate groupId column
-  /// and lookup the input-to-output column mappings in the
-  /// groupingKeyMappings_.
-  int32_t groupingSetIndex_{0};
 };
 } // namespace facebook::velox::exec
@@ -94,6 +94,11 @@ GroupingSet::~GroupingSet() {
   if (isGlobal_) {
     destroyGlobalAggregations();
   }
+  // Make sure no background merge stream preparation is left running against
+  // 'spiller_' after 'this' is destroyed.
+  for (auto& source : mergeSources_) {
+    source->close();
+  }
 }
 
 std::unique_ptr<GroupingSet> GroupingSet::createForMarkDistinct(
@@ -629,6 +634,7 @@ void GroupingSet::spill(int64_t targetRows, int64_t targetBytes) {
         spillConfig_->filePath,
         spillConfig_->maxFileSize,
         spillConfig_->minSpillRunSize,
+        spillConfig_->compressionCodec,
         Spiller::spillPool(),
         spillConfig_->executor);
   }
@@ -668,6 +674,22 @@ bool GroupingSet::getOutputWithSpill(
     table_.reset();
     outputPartition_ = 0;
     nonSpilledRows_ = spiller_->finishSpill();
+
+    // Create the merge streams for all the spilled partitions up front.
+    // Sorting the last in-memory runs and opening the spill files proceeds
+    // in parallel on the spill executor and overlaps with producing output
+    // from the preceding partitions.
+    const auto numPartitions = spiller_->state().maxPartitions();
+    mergeSources_.reserve(numPartitions);
+    for (auto i = 0; i < numPartitions; ++i) {
+      mergeSources_.push_back(
+          std::make_shared<AsyncSource<TreeOfLosers<SpillMergeStream>>>(
+              [this, i]() { return spiller_->startMerge(i); }));
+      if (spillConfig_->executor != nullptr) {
+        spillConfig_->executor->add(
+            [source = mergeSources_.back()]() { source->prepare(); });
+      }
+    }
   }
 
   if (nonSpilledIndex_ < nonSpilledRows_.value().size()) {
@@ -682,7 +704,7 @@ bool GroupingSet::getOutputWithSpill(
   }
   while (outputPartition_ < spiller_->state().maxPartitions()) {
     if (!merge_) {
-      merge_ = spiller_->startMerge(outputPartition_);
+      merge_ = mergeSources_[outputPartition_]->move();
     }
     // NOTE: 'merge_' might be nullptr if 'outputPartition_' is empty.
     if (merge_ == nullptr || !mergeNext(batchSize, result)) {
@@ -768,9 +790,22 @@ void GroupingSet::abandonPartialAggregation() {
     intermediateRows_ = table_->moveRows();
     intermediateRows_->clear();
   }
+  // Recreate the hashers consumed by the dropped hash table so that partial
+  // aggregation can be resumed later to re-check the reduction.
+  hashers_.reserve(keyChannels_.size());
+  for (const auto& hasher : table_->hashers()) {
+    hashers_.push_back(VectorHasher::create(hasher->type(), hasher->channel()));
+  }
   table_ = nullptr;
 }
 
+void GroupingSet::resumePartialAggregation() {
+  VELOX_CHECK(abandonedPartialAggregation_);
+  abandonedPartialAggregation_ = false;
+  intermediateRows_.reset();
+  // 'table_' is recreated from 'hashers_' on the next input batch.
+}
+
 void GroupingSet::toIntermediate(
     const RowVectorPtr& input,
     RowVectorPtr& result) {
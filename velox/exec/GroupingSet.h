@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include "velox/common/base/AsyncSource.h"
 #include "velox/exec/AggregationMasks.h"
 #include "velox/exec/HashTable.h"
 #include "velox/exec/Spiller.h"
@@ -88,6 +89,13 @@ class GroupingSet {
 
   const HashLookup& hashLookup() const;
 
+  /// Returns the rows of the hash table, nullptr if there is no table. Used
+  /// by MarkDistinct to seed a Bloom filter of the seen keys when
+  /// downgrading to approximate distinct marking under memory pressure.
+  RowContainer* rows() const {
+    return table_ ? table_->rows() : nullptr;
+  }
+
   /// Spills content until under 'targetRows' and under 'targetBytes'
   /// of out of line data are left. If targetRows is 0, spills
   /// everything and physically frees the data in the
@@ -116,6 +124,11 @@ class GroupingSet {
   // non-productive. Must be called before toIntermediate() is used.
   void abandonPartialAggregation();
 
+  // Resumes partial aggregation after a call to abandonPartialAggregation().
+  // The hash table is recreated on the next input batch. Used to periodically
+  // re-check whether the input still achieves no reduction.
+  void resumePartialAggregation();
+
   /// Translates the raw input in input to accumulators initialized from a
   /// single input row. Passes grouping keys through.
   void toIntermediate(const RowVectorPtr& input, RowVectorPtr& result);
@@ -260,6 +273,13 @@ class GroupingSet {
   std::unique_ptr<Spiller> spiller_;
   std::unique_ptr<TreeOfLosers<SpillMergeStream>> merge_;
 
+  // Pending merge streams for the spilled partitions, in partition number
+  // order. The streams are prepared on the spill executor so that sorting the
+  // last in-memory runs and reading back the spill files proceeds in parallel
+  // with producing output from the preceding partitions.
+  std::vector<std::shared_ptr<AsyncSource<TreeOfLosers<SpillMergeStream>>>>
+      mergeSources_;
+
   // Container for materializing batches of output from spilling.
   std::unique_ptr<RowContainer> mergeRows_;
 
@@ -165,9 +165,25 @@ void HashAggregation::addInput(RowVectorPtr input) {
     pushdownChecked_ = true;
   }
   if (abandonedPartialAggregation_) {
-    input_ = input;
-    numInputRows_ += input->size();
-    return;
+    // Periodically resume hashing to re-check the reduction. The input
+    // distribution may have changed since abandonment, e.g. a sorted or
+    // clustered region with repeating keys may follow a unique prefix. If the
+    // reduction is still poor, abandonPartialAggregationEarly() kicks in again
+    // after 'abandonPartialAggregationMinRows_' rows, bounding the re-probe
+    // overhead to a small fraction of the pass-through rows.
+    constexpr int32_t kResumeIntervalMultiplier = 32;
+    if (numInputRows_ >=
+        kResumeIntervalMultiplier * abandonPartialAggregationMinRows_) {
+      groupingSet_->resumePartialAggregation();
+      abandonedPartialAggregation_ = false;
+      addRuntimeStat("resumedPartialAggregation", RuntimeCounter(1));
+      numInputRows_ = 0;
+      numOutputRows_ = 0;
+    } else {
+      input_ = input;
+      numInputRows_ += input->size();
+      return;
+    }
   }
   groupingSet_->addInput(input, mayPushdown_);
   numInputRows_ += input->size();
@@ -217,6 +233,8 @@ void HashAggregation::recordSpillStats() {
   lockedStats->spilledRows = spillStats.spilledRows;
   lockedStats->spilledPartitions = spillStats.spilledPartitions;
   lockedStats->spilledFiles = spillStats.spilledFiles;
+  lockedStats.unlock();
+  addSpillTraceEvent(spillStats.spilledBytes, spillStats.spilledRows);
 }
 
 void HashAggregation::prepareOutput(vector_size_t size) {
@@ -65,6 +65,10 @@ HashBuild::HashBuild(
   VELOX_CHECK(pool()->trackUsage());
   VELOX_CHECK_NOT_NULL(joinBridge_);
 
+  // Table sharing between tasks is disabled for join types whose probe
+  // modifies the table.
+  joinBridge_->setJoinType(joinType_);
+
   spillGroup_ = spillEnabled()
       ? operatorCtx_->task()->getSpillOperatorGroupLocked(
             operatorCtx_->driverCtx()->splitGroupId, planNodeId())
@@ -208,6 +212,7 @@ void HashBuild::setupSpiller(SpillPartition* spillPartition) {
       spillConfig.filePath,
       spillConfig.maxFileSize,
       spillConfig.minSpillRunSize,
+      spillConfig.compressionCodec,
       Spiller::spillPool(),
       spillConfig.executor);
 
@@ -284,6 +289,14 @@ void HashBuild::removeInputRowsForAntiJoinFilter() {
 void HashBuild::addInput(RowVectorPtr input) {
   checkRunning();
 
+  // If another task on this node has built and cached an identical broadcast
+  // table, the input does not need to be processed: the probe side uses the
+  // cached table. Only applies without spilling so that a partly built local
+  // table is never published.
+  if (FOLLY_UNLIKELY(!spillEnabled() && joinBridge_->hasCachedTable())) {
+    return;
+  }
+
   if (!ensureInputFits(input)) {
     VELOX_CHECK_NOT_NULL(input_);
     VELOX_CHECK(future_.valid());
@@ -743,6 +756,11 @@ bool HashBuild::finishHashBuild() {
     if (joinHasNullKeys_ && isAntiJoin(joinType_) && nullAware_ &&
         !joinNode_->filter()) {
       joinBridge_->setAntiJoinHasNullKeys();
+    } else if (!spillEnabled() && joinBridge_->hasCachedTable()) {
+      // Another task on this node has built and cached the same broadcast
+      // table. Publish the cached table to the probe side instead of
+      // finishing the local build.
+      joinBridge_->setTableFromCache();
     } else {
       if (spiller_ != nullptr) {
         spillStats += spiller_->stats();
@@ -754,6 +772,7 @@ bool HashBuild::finishHashBuild() {
           lockedStats->spilledPartitions += spillStats.spilledPartitions;
           lockedStats->spilledFiles += spillStats.spilledFiles;
         }
+        addSpillTraceEvent(spillStats.spilledBytes, spillStats.spilledRows);
 
         spiller_->finishSpill(spillPartitions);
 
@@ -764,10 +783,11 @@ bool HashBuild::finishHashBuild() {
         }
       }
 
+      // A single driver build also benefits from the executor since the key
+      // space is partitioned independently of the number of drivers.
       // TODO: re-enable parallel join build with spilling triggered after
       // https://github.com/facebookincubator/velox/issues/3567 is fixed.
-      const bool allowPrallelJoinBuild =
-          !otherTables.empty() && spillPartitions.empty();
+      const bool allowPrallelJoinBuild = spillPartitions.empty();
       table_->prepareJoinTable(
           std::move(otherTables),
           allowPrallelJoinBuild ? operatorCtx_->task()->queryCtx()->executor()
@@ -74,6 +74,17 @@ bool HashJoinBridge::setHashTable(
         hasNullKeys);
     restoringSpillPartitionId_.reset();
 
+    if (tableCacheAllowed_ && !tableCacheKey_.empty() &&
+        cachedTable_ == nullptr && spillPartitionSets_.empty() &&
+        buildResult_->spillPartitionIds.empty() &&
+        !buildResult_->restoredPartitionId.has_value()) {
+      // Shares the unspilled table with other tasks building the same
+      // broadcast side.
+      cachedTable_ = HashJoinTableCache::instance()->add(
+          tableCacheKey_,
+          HashJoinTableCacheEntry{buildResult_.value(), tableKeepAlive_});
+    }
+
     hasSpillData = !spillPartitionSets_.empty();
     promises = std::move(promises_);
   }
@@ -81,6 +92,58 @@ bool HashJoinBridge::setHashTable(
   return hasSpillData;
 }
 
+void HashJoinBridge::setTableCacheKey(
+    const std::string& key,
+    std::shared_ptr<void> keepAlive) {
+  std::lock_guard<std::mutex> l(mutex_);
+  VELOX_CHECK(!started_);
+  VELOX_CHECK(!key.empty());
+  tableCacheKey_ = key;
+  tableKeepAlive_ = std::move(keepAlive);
+}
+
+void HashJoinBridge::setJoinType(core::JoinType joinType) {
+  std::lock_guard<std::mutex> l(mutex_);
+  // Right, full and right semi join probes mark probed rows in the table's
+  // RowContainer, so tasks sharing one table would see or race on each
+  // other's marks.
+  if (isRightJoin(joinType) || isFullJoin(joinType) ||
+      isRightSemiFilterJoin(joinType) || isRightSemiProjectJoin(joinType)) {
+    tableCacheAllowed_ = false;
+  }
+}
+
+bool HashJoinBridge::ensureCachedTableLocked() {
+  if (cachedTable_ != nullptr) {
+    return true;
+  }
+  if (!tableCacheAllowed_ || tableCacheKey_.empty()) {
+    return false;
+  }
+  cachedTable_ = HashJoinTableCache::instance()->find(tableCacheKey_);
+  return cachedTable_ != nullptr;
+}
+
+bool HashJoinBridge::hasCachedTable() {
+  std::lock_guard<std::mutex> l(mutex_);
+  return ensureCachedTableLocked();
+}
+
+void HashJoinBridge::setTableFromCache() {
+  std::vector<ContinuePromise> promises;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    VELOX_CHECK(started_);
+    VELOX_CHECK(!buildResult_.has_value());
+    VELOX_CHECK(restoringSpillShards_.empty());
+    VELOX_CHECK(ensureCachedTableLocked());
+
+    buildResult_ = cachedTable_->result;
+    promises = std::move(promises_);
+  }
+  notify(std::move(promises));
+}
+
 void HashJoinBridge::setAntiJoinHasNullKeys() {
   std::vector<ContinuePromise> promises;
   SpillPartitionSet spillPartitions;
@@ -132,6 +195,9 @@ bool HashJoinBridge::probeFinished() {
     // not needed anymore. We'll wait for the HashBuild operator to build a new
     // table from the next spill partition now.
     buildResult_.reset();
+    // Drops the reference on a shared table so the cache entry can expire
+    // once all tasks have finished probing.
+    cachedTable_.reset();
 
     if (!spillPartitionSets_.empty()) {
       hasSpillInput = true;
@@ -172,6 +238,46 @@ std::optional<HashJoinBridge::SpillInput> HashJoinBridge::spillInputOrFuture(
   return SpillInput(std::move(spillShard));
 }
 
+// static
+HashJoinTableCache* HashJoinTableCache::instance() {
+  static HashJoinTableCache cache;
+  return &cache;
+}
+
+std::shared_ptr<HashJoinTableCacheEntry> HashJoinTableCache::find(
+    const std::string& key) {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    return nullptr;
+  }
+  auto entry = it->second.lock();
+  if (entry == nullptr) {
+    // The last user of the entry is gone; a later build with the same key
+    // caches a fresh table.
+    entries_.erase(it);
+  }
+  return entry;
+}
+
+std::shared_ptr<HashJoinTableCacheEntry> HashJoinTableCache::add(
+    const std::string& key,
+    HashJoinTableCacheEntry entry) {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto& slot = entries_[key];
+  if (auto existing = slot.lock()) {
+    return existing;
+  }
+  auto shared = std::make_shared<HashJoinTableCacheEntry>(std::move(entry));
+  slot = shared;
+  return shared;
+}
+
+void HashJoinTableCache::testingClear() {
+  std::lock_guard<std::mutex> l(mutex_);
+  entries_.clear();
+}
+
 bool isLeftNullAwareJoinWithFilter(
     const std::shared_ptr<const core::HashJoinNode>& joinNode) {
   return (joinNode->isAntiJoin() || joinNode->isLeftSemiProjectJoin() ||
@@ -15,12 +15,16 @@
  */
 #pragma once
 
+#include <folly/container/F14Map.h>
+
 #include "velox/exec/HashTable.h"
 #include "velox/exec/JoinBridge.h"
 #include "velox/exec/Spill.h"
 
 namespace facebook::velox::exec {
 
+struct HashJoinTableCacheEntry;
+
 /// Hands over a hash table from a multi-threaded build pipeline to a
 /// multi-threaded probe pipeline. This is owned by shared_ptr by all the build
 /// and probe Operator instances concerned. Corresponds to the Presto concept of
@@ -45,6 +49,38 @@ class HashJoinBridge : public JoinBridge {
 
   void setAntiJoinHasNullKeys();
 
+  /// Registers this bridge with the node-wide table cache (see
+  /// HashJoinTableCache) so that concurrent tasks building the same broadcast
+  /// side share one table. 'key' identifies the build side across tasks, e.g.
+  /// the plan fragment plus the build side split signature, and must only
+  /// match builds that would produce identical tables. 'keepAlive' pins
+  /// whatever owns the memory backing the table, e.g. the building task, for
+  /// as long as other tasks use the cached table. Must be called before
+  /// start(). Sharing is only safe for join types that never modify the
+  /// table while probing: the bridge ignores the key for right, full and
+  /// right semi joins, which mark probed rows in the table (see
+  /// setJoinType()).
+  void setTableCacheKey(
+      const std::string& key,
+      std::shared_ptr<void> keepAlive);
+
+  /// Invoked by HashBuild operators to declare the join type this bridge
+  /// serves. Right, full and right semi join probes mark probed rows in the
+  /// table's RowContainer, so a task reusing a shared table would see or
+  /// race on another task's marks; for these join types the bridge neither
+  /// publishes to nor reads from the table cache.
+  void setJoinType(core::JoinType joinType);
+
+  /// Returns true if the table for the 'setTableCacheKey' key is available
+  /// in the node-wide cache. Takes a reference on the first hit so the entry
+  /// stays usable until probeFinished(). Invoked by HashBuild operators to
+  /// skip building a duplicate table.
+  bool hasCachedTable();
+
+  /// Invoked by the last HashBuild operator instead of setHashTable() when
+  /// hasCachedTable() is true. Publishes the cached table to the probe side.
+  void setTableFromCache();
+
   /// Represents the result of HashBuild operators: a hash table, an optional
   /// restored spill partition id associated with the table, and the spilled
   /// partitions while building the table if not empty. In case of an anti join,
@@ -105,8 +141,27 @@ class HashJoinBridge : public JoinBridge {
       ContinueFuture* FOLLY_NONNULL future);
 
  private:
+  // Takes a reference on the cache entry for 'tableCacheKey_' if one exists
+  // and returns true. 'mutex_' must be held.
+  bool ensureCachedTableLocked();
+
   uint32_t numBuilders_{0};
 
+  // False if the join type forbids sharing the table between tasks because
+  // the probe modifies it (see setJoinType()).
+  bool tableCacheAllowed_{true};
+
+  // Key under which the built table is shared between tasks, empty if the
+  // table is not shared.
+  std::string tableCacheKey_;
+
+  // Pins the resources backing the table published under 'tableCacheKey_'.
+  std::shared_ptr<void> tableKeepAlive_;
+
+  // The cache entry this bridge published or picked up. Released when the
+  // probe side finishes.
+  std::shared_ptr<HashJoinTableCacheEntry> cachedTable_;
+
   std::optional<HashBuildResult> buildResult_;
 
   // restoringSpillPartitionXxx member variables are populated by the
@@ -130,6 +185,45 @@ class HashJoinBridge : public JoinBridge {
   SpillPartitionSet spillPartitionSets_;
 };
 
+/// A built hash table shared between tasks through HashJoinTableCache.
+struct HashJoinTableCacheEntry {
+  HashJoinBridge::HashBuildResult result;
+
+  /// Pins whatever owns the memory backing 'result', e.g. the building task.
+  std::shared_ptr<void> keepAlive;
+};
+
+/// Node-wide cache of broadcast build side hash tables. When many tasks on
+/// one worker build the same broadcast side, the first task to finish its
+/// build publishes the table under the key set with
+/// HashJoinBridge::setTableCacheKey and the other tasks probe the shared
+/// table instead of building their own copy. Entries are refcounted by the
+/// bridges that use them: an entry expires when the last probe finishes and
+/// a later build with the same key caches a fresh table.
+class HashJoinTableCache {
+ public:
+  static HashJoinTableCache* instance();
+
+  /// Returns the entry cached under 'key', or nullptr if there is none or
+  /// the last user of the previous entry is gone.
+  std::shared_ptr<HashJoinTableCacheEntry> find(const std::string& key);
+
+  /// Caches 'entry' under 'key' if there is no live entry yet. Returns the
+  /// entry that ends up cached, which is 'entry' or one concurrently added
+  /// by another task.
+  std::shared_ptr<HashJoinTableCacheEntry> add(
+      const std::string& key,
+      HashJoinTableCacheEntry entry);
+
+  /// Drops all entries. Used by tests.
+  void testingClear();
+
+ private:
+  std::mutex mutex_;
+  folly::F14FastMap<std::string, std::weak_ptr<HashJoinTableCacheEntry>>
+      entries_;
+};
+
 // Indicates if 'joinNode' is null-aware anti or left semi project join type and
 // has filter set.
 bool isLeftNullAwareJoinWithFilter(
@@ -15,6 +15,7 @@
  */
 
 #include "velox/exec/HashProbe.h"
+#include "velox/common/base/SimdUtil.h"
 #include "velox/exec/OperatorUtils.h"
 #include "velox/exec/Task.h"
 #include "velox/expression/FieldReference.h"
@@ -52,6 +53,22 @@ RowTypePtr makeTableType(
   return ROW(std::move(names), std::move(types));
 }
 
+// Adds the hashes of the non-null values in the flat vector 'keys' to
+// 'bloomFilter'. T is the native type of 'keys'.
+template <typename T>
+void addKeysToBloomFilter(
+    const VectorPtr& keys,
+    vector_size_t size,
+    BloomFilter<>& bloomFilter) {
+  auto* flatKeys = keys->asUnchecked<FlatVector<T>>();
+  for (vector_size_t i = 0; i < size; ++i) {
+    if (!flatKeys->isNullAt(i)) {
+      bloomFilter.insert(folly::hasher<int64_t>()(
+          static_cast<int64_t>(flatKeys->valueAt(i))));
+    }
+  }
+}
+
 // Copy values from 'rows' of 'table' according to 'projections' in
 // 'result'. Reuses 'result' children where possible.
 void extractColumns(
@@ -246,6 +263,7 @@ void HashProbe::maybeSetupSpillInput(
       spillConfig.filePath,
       spillConfig.maxFileSize,
       spillConfig.minSpillRunSize,
+      spillConfig.compressionCodec,
       Spiller::spillPool(),
       spillConfig.executor);
   // Set the spill partitions to the corresponding ones at the build side. The
@@ -298,8 +316,7 @@ void HashProbe::asyncWaitForHashTable() {
   } else if (
       (isInnerJoin(joinType_) || isLeftSemiFilterJoin(joinType_) ||
        isRightSemiFilterJoin(joinType_) || isRightSemiProjectJoin(joinType_)) &&
-      table_->hashMode() != BaseHashTable::HashMode::kHash && !isSpillInput() &&
-      !hasMoreSpillData()) {
+      !isSpillInput() && !hasMoreSpillData()) {
     // Find out whether there are any upstream operators that can accept
     // dynamic filters on all or a subset of the join keys. Create dynamic
     // filters to push down.
@@ -311,16 +328,78 @@ void HashProbe::asyncWaitForHashTable() {
     const auto& buildHashers = table_->hashers();
     auto channels = operatorCtx_->driverCtx()->driver->canPushdownFilters(
         this, keyChannels_);
+    const bool keepsValues =
+        table_->hashMode() != BaseHashTable::HashMode::kHash;
     for (auto i = 0; i < keyChannels_.size(); i++) {
-      if (channels.find(keyChannels_[i]) != channels.end()) {
+      if (channels.find(keyChannels_[i]) == channels.end()) {
+        continue;
+      }
+      if (keepsValues) {
         if (auto filter = buildHashers[i]->getFilter(false)) {
           dynamicFilters_.emplace(keyChannels_[i], std::move(filter));
         }
+      } else if (auto filter = tryCreateBloomFilter(i)) {
+        // In hash mode the hashers do not track the build side values.
+        // Summarize the join keys into a Bloom filter instead. The filter may
+        // pass rows that do not match; the join stays in the plan to drop
+        // them.
+        dynamicFilters_.emplace(keyChannels_[i], std::move(filter));
       }
     }
   }
 }
 
+std::unique_ptr<common::Filter> HashProbe::tryCreateBloomFilter(
+    int32_t keyIndex) {
+  const auto maxRows =
+      operatorCtx_->driverCtx()->queryConfig().dynamicBloomFilterMaxRows();
+  auto* rows = table_->rows();
+  const auto numRows = rows->numRows();
+  if (numRows == 0 || static_cast<uint64_t>(numRows) > maxRows) {
+    return nullptr;
+  }
+  const auto& keyType = probeType_->childAt(keyChannels_[keyIndex]);
+  switch (keyType->kind()) {
+    case TypeKind::TINYINT:
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+      break;
+    default:
+      // The Bloom filter test in the scan applies to integral values only.
+      return nullptr;
+  }
+
+  BloomFilter<> bloomFilter;
+  bloomFilter.reset(numRows);
+
+  std::vector<char*> tableRows(kBatchSize);
+  auto keys = BaseVector::create(keyType, kBatchSize, pool());
+  RowContainerIterator iter;
+  while (const auto numKeys =
+             rows->listRows(&iter, kBatchSize, tableRows.data())) {
+    rows->extractColumn(tableRows.data(), numKeys, keyIndex, keys);
+    switch (keyType->kind()) {
+      case TypeKind::TINYINT:
+        addKeysToBloomFilter<int8_t>(keys, numKeys, bloomFilter);
+        break;
+      case TypeKind::SMALLINT:
+        addKeysToBloomFilter<int16_t>(keys, numKeys, bloomFilter);
+        break;
+      case TypeKind::INTEGER:
+        addKeysToBloomFilter<int32_t>(keys, numKeys, bloomFilter);
+        break;
+      case TypeKind::BIGINT:
+        addKeysToBloomFilter<int64_t>(keys, numKeys, bloomFilter);
+        break;
+      default:
+        VELOX_UNREACHABLE();
+    }
+  }
+  return std::make_unique<common::BigintBloomFilter>(
+      std::move(bloomFilter), false);
+}
+
 bool HashProbe::isSpillInput() const {
   return spillInputReader_ != nullptr;
 }
@@ -333,6 +412,8 @@ void HashProbe::prepareForSpillRestore() {
   // Reset the internal states which are relevant to the previous probe run.
   noMoreSpillInput_ = false;
   table_.reset();
+  nullKeyTableFilterInputs_.clear();
+  nullKeyTableFilterInputsReady_ = false;
   spiller_.reset();
   spillInputReader_.reset();
   spillInputPartitionIds_.clear();
@@ -503,6 +584,9 @@ void HashProbe::decodeAndDetectNonNullKeys() {
 void HashProbe::addInput(RowVectorPtr input) {
   input_ = std::move(input);
 
+  // Adapt the output batch size to the measured output row width.
+  outputBatchSize_ = adaptiveOutputBatchRows();
+
   if (input_->size() > 0) {
     noInput_ = false;
   }
@@ -655,7 +739,7 @@ void HashProbe::fillLeftSemiProjectMatchColumn(vector_size_t size) {
             flatMatch->setNull(i, true);
           } else {
             // Probe key is not null.
-            bool hasMatch = outputTableRows_[i] != nullptr;
+            bool hasMatch = bits::isBitSet(joinMatchBits_.data(), i);
             if (!hasMatch && buildSideHasNullKeys_) {
               flatMatch->setNull(i, true);
             } else {
@@ -664,7 +748,8 @@ void HashProbe::fillLeftSemiProjectMatchColumn(vector_size_t size) {
           }
         }
       } else {
-        bool hasMatch = outputTableRows_[i] != nullptr;
+        bool hasMatch = filter_ ? outputTableRows_[i] != nullptr
+                                : bits::isBitSet(joinMatchBits_.data(), i);
         bits::setBit(rawValues, i, hasMatch);
       }
     }
@@ -757,6 +842,55 @@ RowVectorPtr HashProbe::getBuildSideOutput() {
   return output_;
 }
 
+RowVectorPtr HashProbe::getSemiOrAntiJoinNoFilterOutput() {
+  const auto inputSize = input_->size();
+
+  joinMatchBits_.resize(bits::nwords(inputSize));
+  BaseHashTable::joinMatchBits(*lookup_, inputSize, joinMatchBits_.data());
+
+  if (isLeftSemiProjectJoin(joinType_)) {
+    // Left semi project join outputs all probe rows, so the probe side
+    // columns pass through unchanged and the match bits become the 'match'
+    // column.
+    prepareOutput(inputSize);
+    for (auto projection : identityProjections_) {
+      output_->childAt(projection.outputChannel) =
+          input_->childAt(projection.inputChannel);
+    }
+    fillLeftSemiProjectMatchColumn(inputSize);
+    input_ = nullptr;
+    return output_;
+  }
+
+  if (isAntiJoin(joinType_)) {
+    if (nullAware_) {
+      // Anti join returns probe rows with no nulls in the join key and no
+      // match in the build side.
+      bits::negate(reinterpret_cast<char*>(joinMatchBits_.data()), inputSize);
+      bits::andBits(
+          joinMatchBits_.data(),
+          nonNullInputRows_.asRange().bits(),
+          0,
+          inputSize);
+    } else {
+      // Anti join returns probe rows with no match, including rows with null
+      // join keys which never have a hit.
+      bits::negate(reinterpret_cast<char*>(joinMatchBits_.data()), inputSize);
+    }
+  }
+
+  auto mapping =
+      initializeRowNumberMapping(outputRowMapping_, inputSize, pool());
+  const auto numOut = simd::indicesOfSetBits(
+      joinMatchBits_.data(), 0, inputSize, mapping.data());
+  input_ = nullptr;
+  if (numOut == 0) {
+    return nullptr;
+  }
+  fillOutput(numOut);
+  return output_;
+}
+
 void HashProbe::clearIdentityProjectedOutput() {
   if (!output_ || !output_.unique()) {
     return;
@@ -865,6 +999,12 @@ RowVectorPtr HashProbe::getOutput() {
 
   const bool emptyBuildSide = (table_->numDistinct() == 0);
 
+  if (isLeftSemiOrAntiJoinNoFilter && !emptyBuildSide) {
+    // The match bits of the lookup are the complete join result. No build
+    // side rows need to be listed or accessed.
+    return getSemiOrAntiJoinNoFilterOutput();
+  }
+
   // Left semi and anti joins are always cardinality reducing, e.g. for a given
   // row of input they produce zero or 1 row of output. Therefore, if there is
   // no extra filter we can process each batch of input in one go.
@@ -884,27 +1024,6 @@ RowVectorPtr HashProbe::getOutput() {
       std::iota(mapping.begin(), mapping.end(), 0);
       std::fill(outputTableRows_.begin(), outputTableRows_.end(), nullptr);
       numOut = inputSize;
-    } else if (isAntiJoin(joinType_) && !filter_) {
-      if (nullAware_) {
-        // When build side is not empty, anti join without a filter returns
-        // probe rows with no nulls in the join key and no match in the build
-        // side.
-        for (auto i = 0; i < inputSize; ++i) {
-          if (nonNullInputRows_.isValid(i) &&
-              (!activeRows_.isValid(i) || !lookup_->hits[i])) {
-            mapping[numOut] = i;
-            ++numOut;
-          }
-        }
-      } else {
-        for (auto i = 0; i < inputSize; ++i) {
-          if (!nonNullInputRows_.isValid(i) ||
-              (!activeRows_.isValid(i) || !lookup_->hits[i])) {
-            mapping[numOut] = i;
-            ++numOut;
-          }
-        }
-      }
     } else {
       numOut = table_->listJoinResults(
           results_,
@@ -1045,7 +1164,6 @@ void HashProbe::applyFilterOnTableRowsForNullAwareJoin(
   char* data[kBatchSize];
   while (auto numRows = iterator(data, kBatchSize)) {
     filterTableInput_->resize(numRows);
-    filterTableInputRows_.resizeFill(numRows, true);
     for (auto& projection : filterTableProjections_) {
       tableRows->extractColumn(
           data,
@@ -1053,39 +1171,69 @@ void HashProbe::applyFilterOnTableRowsForNullAwareJoin(
           projection.inputChannel,
           filterTableInput_->childAt(projection.outputChannel));
     }
-    rows.applyToSelected([&](vector_size_t row) {
-      for (auto& projection : filterInputProjections_) {
-        filterTableInput_->childAt(projection.outputChannel) =
-            BaseVector::wrapInConstant(
-                numRows, row, input_->childAt(projection.inputChannel));
+    applyFilterOnTableInputForNullAwareJoin(
+        rows, filterPassedRows, filterTableInput_);
+  }
+}
+
+void HashProbe::applyFilterOnTableInputForNullAwareJoin(
+    const SelectivityVector& rows,
+    SelectivityVector& filterPassedRows,
+    const RowVectorPtr& tableFilterInput) {
+  const auto numRows = tableFilterInput->size();
+  filterTableInputRows_.resizeFill(numRows, true);
+  rows.applyToSelected([&](vector_size_t row) {
+    for (auto& projection : filterInputProjections_) {
+      tableFilterInput->childAt(projection.outputChannel) =
+          BaseVector::wrapInConstant(
+              numRows, row, input_->childAt(projection.inputChannel));
+    }
+    EvalCtx evalCtx(
+        operatorCtx_->execCtx(), filter_.get(), tableFilterInput.get());
+    filter_->eval(filterTableInputRows_, evalCtx, filterTableResult_);
+    if (auto* values = getFlatFilterResult(filterTableResult_[0])) {
+      if (!bits::testSetBits(
+              values, 0, numRows, [](vector_size_t) { return false; })) {
+        filterPassedRows.setValid(row, true);
       }
-      EvalCtx evalCtx(
-          operatorCtx_->execCtx(), filter_.get(), filterTableInput_.get());
-      filter_->eval(filterTableInputRows_, evalCtx, filterTableResult_);
-      if (auto* values = getFlatFilterResult(filterTableResult_[0])) {
-        if (!bits::testSetBits(
-                values, 0, numRows, [](vector_size_t) { return false; })) {
+    } else {
+      decodedFilterTableResult_.decode(
+          *filterTableResult_[0], filterTableInputRows_);
+      if (decodedFilterTableResult_.isConstantMapping()) {
+        if (!decodedFilterTableResult_.isNullAt(0) &&
+            decodedFilterTableResult_.valueAt<bool>(0)) {
           filterPassedRows.setValid(row, true);
         }
       } else {
-        decodedFilterTableResult_.decode(
-            *filterTableResult_[0], filterTableInputRows_);
-        if (decodedFilterTableResult_.isConstantMapping()) {
-          if (!decodedFilterTableResult_.isNullAt(0) &&
-              decodedFilterTableResult_.valueAt<bool>(0)) {
+        for (vector_size_t i = 0; i < numRows; ++i) {
+          if (!decodedFilterTableResult_.isNullAt(i) &&
+              decodedFilterTableResult_.valueAt<bool>(i)) {
             filterPassedRows.setValid(row, true);
-          }
-        } else {
-          for (vector_size_t i = 0; i < numRows; ++i) {
-            if (!decodedFilterTableResult_.isNullAt(i) &&
-                decodedFilterTableResult_.valueAt<bool>(i)) {
-              filterPassedRows.setValid(row, true);
-              break;
-            }
+            break;
           }
         }
       }
-    });
+    }
+  });
+}
+
+void HashProbe::prepareNullKeyTableFilterInputs() {
+  if (nullKeyTableFilterInputsReady_) {
+    return;
+  }
+  nullKeyTableFilterInputsReady_ = true;
+  BaseHashTable::NullKeyRowsIterator iter;
+  char* data[kBatchSize];
+  while (auto numRows = table_->listNullKeyRows(&iter, kBatchSize, data)) {
+    auto tableInput =
+        BaseVector::create<RowVector>(filterInputType_, numRows, pool());
+    extractColumns(
+        table_.get(),
+        folly::Range<char**>(data, numRows),
+        filterTableProjections_,
+        pool(),
+        tableInput);
+    nullKeyTableFilterInputs_.push_back(std::move(tableInput));
   }
 }
 
@@ -1126,12 +1274,17 @@ SelectivityVector HashProbe::evalFilterForNullAwareJoin(
   }
 
   if (buildSideHasNullKeys_) {
-    BaseHashTable::NullKeyRowsIterator iter;
     nullKeyProbeRows.deselect(filterPassedRows);
-    applyFilterOnTableRowsForNullAwareJoin(
-        nullKeyProbeRows, filterPassedRows, [&](char** data, int32_t maxRows) {
-          return table_->listNullKeyRows(&iter, maxRows, data);
-        });
+    if (nullKeyProbeRows.hasSelections()) {
+      // The null-key build rows come from the precomputed null partition of
+      // the hash table; their filter columns are extracted only once per
+      // built table.
+      prepareNullKeyTableFilterInputs();
+      for (const auto& tableInput : nullKeyTableFilterInputs_) {
+        applyFilterOnTableInputForNullAwareJoin(
+            nullKeyProbeRows, filterPassedRows, tableInput);
+      }
+    }
   }
   BaseHashTable::RowsIterator iter;
   crossJoinProbeRows.deselect(filterPassedRows);
@@ -80,6 +80,13 @@ class HashProbe : public Operator {
   // asynchronously.
   void asyncWaitForHashTable();
 
+  // Creates a Bloom filter over the build side values of the join key at
+  // 'keyIndex' for pushdown towards the probe side table scan. Used when the
+  // hash table is in hash mode and the hashers cannot produce exact value
+  // filters. Returns nullptr if the key type is not integral or the build
+  // side has more rows than QueryConfig::dynamicBloomFilterMaxRows().
+  std::unique_ptr<common::Filter> tryCreateBloomFilter(int32_t keyIndex);
+
   // Invoked to set up spilling related input processing. The function sets up a
   // reader to read probe inputs from spilled data on disk if
   // 'restoredSpillPartitionId' is not null. If 'spillPartitionIds' is not
@@ -118,6 +125,12 @@ class HashProbe : public Operator {
   // for right join and full join.
   RowVectorPtr getBuildSideOutput();
 
+  // Produce the output for left semi and anti join without extra filter
+  // directly from the per-row match bits of the hash lookup. These joins need
+  // only the existence of a match per probe row, hence this path skips
+  // listJoinResults and never touches build side rows.
+  RowVectorPtr getSemiOrAntiJoinNoFilterOutput();
+
   // Applies 'filter_' to 'outputTableRows_' and updates 'outputRowMapping_'.
   // Returns the number of passing rows.
   vector_size_t evalFilter(vector_size_t numRows);
@@ -144,15 +157,29 @@ class HashProbe : public Operator {
       vector_size_t numRows,
       bool filterPropagateNulls);
 
-  // Combine the selected probe-side rows with all or null-join-key (depending
-  // on the iterator) build side rows and evaluate the filter.  Mark probe rows
-  // that pass the filter in 'filterPassedRows'. Used in null-aware join
-  // processing.
+  // Combine the selected probe-side rows with all build side rows produced by
+  // 'iterator' and evaluate the filter.  Mark probe rows that pass the filter
+  // in 'filterPassedRows'. Used in null-aware join processing.
   void applyFilterOnTableRowsForNullAwareJoin(
       const SelectivityVector& rows,
       SelectivityVector& filterPassedRows,
       std::function<int32_t(char**, int32_t)> iterator);
 
+  // Combine the selected probe-side rows with one batch of build side rows
+  // whose filter columns have already been extracted into 'tableFilterInput'
+  // and evaluate the filter. Mark probe rows that pass the filter in
+  // 'filterPassedRows'.
+  void applyFilterOnTableInputForNullAwareJoin(
+      const SelectivityVector& rows,
+      SelectivityVector& filterPassedRows,
+      const RowVectorPtr& tableFilterInput);
+
+  // Builds 'nullKeyTableFilterInputs_' from the null-key partition of the
+  // hash table on first use. The build-side filter columns of the null-key
+  // rows are extracted once per built table and reused by every probe input
+  // batch instead of being re-listed and re-extracted per batch.
+  void prepareNullKeyTableFilterInputs();
+
   void ensureLoadedIfNotAtEnd(column_index_t channel);
 
   // Indicates if the operator has more probe inputs from either the upstream
@@ -236,8 +263,9 @@ class HashProbe : public Operator {
         spillInputPartitionIds_.empty();
   }
 
-  // TODO: Define batch size as bytes based on RowContainer row sizes.
-  const uint32_t outputBatchSize_;
+  // Maximum number of rows in the output batch. Re-derived from the measured
+  // average output row size before processing each batch of input.
+  uint32_t outputBatchSize_;
 
   const std::shared_ptr<const core::HashJoinNode> joinNode_;
 
@@ -348,6 +376,13 @@ class HashProbe : public Operator {
   std::vector<VectorPtr> filterTableResult_;
   DecodedVector decodedFilterTableResult_;
 
+  // Build-side filter columns of the table rows with null join keys,
+  // extracted in batches of up to 'kBatchSize' rows. Built lazily once per
+  // built table and reused across probe input batches. Reset when the table
+  // changes on spill restore.
+  std::vector<RowVectorPtr> nullKeyTableFilterInputs_;
+  bool nullKeyTableFilterInputsReady_{false};
+
   // Row number in 'input_' for each output row.
   BufferPtr outputRowMapping_;
 
@@ -357,6 +392,11 @@ class HashProbe : public Operator {
   // Rows of table found by join probe, later filtered by 'filter_'.
   std::vector<char*> outputTableRows_;
 
+  // One bit per row of 'input_', set if the row has a match in 'table_'. Used
+  // instead of 'outputTableRows_' by left semi and anti joins without extra
+  // filter which do not access build side rows.
+  std::vector<uint64_t> joinMatchBits_;
+
   // Indicates probe-side rows which should produce a NULL in left semi project
   // with filter.
   SelectivityVector leftSemiProjectIsNull_;
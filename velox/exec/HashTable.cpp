@@ -29,7 +29,12 @@ using facebook::velox::common::testutil::TestValue;
 namespace facebook::velox::exec {
 namespace {
 constexpr int32_t kMinTableSizeForParallelJoinBuild = 1000;
-}
+
+// Largest number of disjoint key space partitions a parallel join build
+// makes when there are fewer build side tables than this. More partitions
+// than build threads is fine, the executor queues the extra ones.
+constexpr int32_t kMaxParallelJoinBuildPartitions = 64;
+} // namespace
 
 // static
 std::string BaseHashTable::modeString(HashMode mode) {
@@ -302,6 +307,14 @@ char* HashTable<ignoreNullKeys>::insertEntry(
     HashLookup& lookup,
     int32_t index,
     vector_size_t row) {
+  if (UNLIKELY(oldTags_ != nullptr)) {
+    // An incremental rehash is in progress. The key may still be in the old
+    // table, in which case its group moves to 'index' instead of making a
+    // new one.
+    if (auto* group = moveFromOldTable(lookup, index, row)) {
+      return group;
+    }
+  }
   char* group = rows_->newRow();
   lookup.hits[row] = group; // NOLINT
   storeKeys(lookup, row);
@@ -350,6 +363,44 @@ bool HashTable<ignoreNullKeys>::compareKeys(
   return true;
 }
 
+template <bool ignoreNullKeys>
+char* HashTable<ignoreNullKeys>::moveFromOldTable(
+    HashLookup& lookup,
+    int32_t index,
+    vector_size_t row) {
+  // Hash numbers do not depend on the table size (see mixNormalizedKey), so
+  // 'lookup.hashes' applies to the old table with the old mask.
+  const uint64_t hash = lookup.hashes[row];
+  const auto wantedTags = TagVector::broadcast(hashTag(hash));
+  const auto kEmptyGroup = TagVector::broadcast(ProbeState::kEmptyTag);
+  auto tagIndex = ProbeState::tagsByteOffset(hash, oldSizeMask_);
+  for (;;) {
+    const auto tagsInTable = loadTags(oldTags_, tagIndex);
+    MaskType hits =
+        simd::toBitMask(tagsInTable == wantedTags) & ProbeState::kFullMask;
+    while (hits) {
+      const auto hit = bits::getAndClearLastSetBit(hits);
+      char* group = oldTable_[tagIndex + hit];
+      const bool match = hashMode_ == HashMode::kNormalizedKey
+          ? RowContainer::normalizedKey(group) == lookup.normalizedKeys[row]
+          : compareKeys(group, lookup, row);
+      if (match) {
+        // Move the entry to its slot in the new table. The old slot becomes
+        // a tombstone so that migrateOldTable() does not insert the row a
+        // second time.
+        storeRowPointer(index, hash, group);
+        storeTag(oldTags_, tagIndex + hit, ProbeState::kTombstoneTag);
+        lookup.hits[row] = group; // NOLINT
+        return group;
+      }
+    }
+    if (simd::toBitMask(tagsInTable == kEmptyGroup) & ProbeState::kFullMask) {
+      return nullptr;
+    }
+    tagIndex = (tagIndex + sizeof(TagVector)) & oldSizeMask_;
+  }
+}
+
 template <bool ignoreNullKeys>
 template <bool isJoin>
 FOLLY_ALWAYS_INLINE void HashTable<ignoreNullKeys>::fullProbe(
@@ -421,6 +472,34 @@ void populateNormalizedKeys(HashLookup& lookup, int8_t sizeBits) {
 }
 } // namespace
 
+namespace {
+// Number of probe rows ahead of the current probe for which the bucket tag
+// line is prefetched. Hides the DRAM latency of the first tag load in
+// preProbe when the table does not fit in cache.
+constexpr int32_t kPrefetchRowsAhead = 8;
+
+// Number of old table slots an in-progress incremental rehash moves to the
+// new table at the start of each probe batch. A table of n slots finishes
+// its migration within n / kIncrementalRehashSlotsPerProbe probe batches,
+// well before the next size check forces completion.
+constexpr int64_t kIncrementalRehashSlotsPerProbe = 4096;
+
+// Prefetches the tag lines for up to 4 probes starting at 'from'.
+FOLLY_ALWAYS_INLINE void prefetchTagLines(
+    const uint8_t* tags,
+    uint64_t sizeMask,
+    const uint64_t* hashes,
+    const vector_size_t* rows,
+    int32_t from,
+    int32_t numProbes) {
+  const auto end = std::min(from + 4, numProbes);
+  for (auto i = from; i < end; ++i) {
+    __builtin_prefetch(
+        tags + ProbeState::tagsByteOffset(hashes[rows[i]], sizeMask));
+  }
+}
+} // namespace
+
 template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::groupProbe(HashLookup& lookup) {
   if (hashMode_ == HashMode::kArray) {
@@ -430,6 +509,9 @@ void HashTable<ignoreNullKeys>::groupProbe(HashLookup& lookup) {
   // Do size-based rehash before mixing hashes from normalized keys
   // because the size of the table affects the mixing.
   checkSize(lookup.rows.size());
+  if (UNLIKELY(oldTags_ != nullptr)) {
+    migrateOldTable(kIncrementalRehashSlotsPerProbe);
+  }
   if (hashMode_ == HashMode::kNormalizedKey) {
     populateNormalizedKeys(lookup, sizeBits_);
   }
@@ -441,6 +523,13 @@ void HashTable<ignoreNullKeys>::groupProbe(HashLookup& lookup) {
   int32_t numProbes = lookup.rows.size();
   auto rows = lookup.rows.data();
   for (; probeIndex + 4 <= numProbes; probeIndex += 4) {
+    prefetchTagLines(
+        tags_,
+        sizeMask_,
+        lookup.hashes.data(),
+        rows,
+        probeIndex + kPrefetchRowsAhead,
+        numProbes);
     int32_t row = rows[probeIndex];
     state1.preProbe(tags_, sizeMask_, lookup.hashes[row], row);
     row = rows[probeIndex + 1];
@@ -520,11 +609,7 @@ void HashTable<ignoreNullKeys>::arrayGroupProbe(HashLookup& lookup) {
 template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::joinProbe(HashLookup& lookup) {
   if (hashMode_ == HashMode::kArray) {
-    for (auto row : lookup.rows) {
-      auto index = lookup.hashes[row];
-      DCHECK_LT(index, capacity_);
-      lookup.hits[row] = table_[index]; // NOLINT
-    }
+    arrayJoinProbe(lookup);
     return;
   }
   if (hashMode_ == HashMode::kNormalizedKey) {
@@ -540,6 +625,13 @@ void HashTable<ignoreNullKeys>::joinProbe(HashLookup& lookup) {
   ProbeState state3;
   ProbeState state4;
   for (; probeIndex + 4 <= numProbes; probeIndex += 4) {
+    prefetchTagLines(
+        tags_,
+        sizeMask_,
+        lookup.hashes.data(),
+        rows,
+        probeIndex + kPrefetchRowsAhead,
+        numProbes);
     int32_t row = rows[probeIndex];
     state1.preProbe(tags_, sizeMask_, lookup.hashes[row], row);
     row = rows[probeIndex + 1];
@@ -565,6 +657,31 @@ void HashTable<ignoreNullKeys>::joinProbe(HashLookup& lookup) {
   }
 }
 
+template <bool ignoreNullKeys>
+void HashTable<ignoreNullKeys>::arrayJoinProbe(HashLookup& lookup) {
+  constexpr int32_t kWidth = xsimd::batch<int64_t>::size;
+  const int32_t numProbes = lookup.rows.size();
+  const vector_size_t* rows = lookup.rows.data();
+  const auto* hashes = reinterpret_cast<const int64_t*>(lookup.hashes.data());
+  const auto* table = reinterpret_cast<const int64_t*>(table_);
+  auto* hits = reinterpret_cast<int64_t*>(lookup.hits.data());
+  int32_t i = 0;
+  for (; i + kWidth <= numProbes; i += kWidth) {
+    auto rowIndices = simd::loadGatherIndices<int64_t, int32_t>(rows + i);
+    auto indices = simd::gather(hashes, rowIndices);
+    auto groups = simd::gather(table, indices);
+    for (auto j = 0; j < kWidth; ++j) {
+      hits[rows[i + j]] = groups.get(j); // NOLINT
+    }
+  }
+  for (; i < numProbes; ++i) {
+    const auto row = rows[i];
+    const auto index = lookup.hashes[row];
+    VELOX_DCHECK_LT(index, capacity_);
+    hits[row] = reinterpret_cast<int64_t>(table_[index]); // NOLINT
+  }
+}
+
 template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::joinNormalizedKeyProbe(HashLookup& lookup) {
   int32_t probeIndex = 0;
@@ -578,6 +695,13 @@ void HashTable<ignoreNullKeys>::joinNormalizedKeyProbe(HashLookup& lookup) {
   const uint64_t* hashes = lookup.hashes.data();
   char** hits = lookup.hits.data();
   for (; probeIndex + 4 <= numProbes; probeIndex += 4) {
+    prefetchTagLines(
+        tags_,
+        sizeMask_,
+        hashes,
+        rows,
+        probeIndex + kPrefetchRowsAhead,
+        numProbes);
     int32_t row = rows[probeIndex];
     state1.preProbe(tags_, sizeMask_, hashes[row], row);
     row = rows[probeIndex + 1];
@@ -631,6 +755,7 @@ void HashTable<ignoreNullKeys>::allocateTables(uint64_t size) {
 template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::clear() {
   rows_->clear();
+  dropOldTable();
   if (hashMode_ != HashMode::kArray && tags_) {
     memset(tags_, 0, capacity_);
   }
@@ -675,14 +800,73 @@ void HashTable<ignoreNullKeys>::checkSize(int32_t numNew) {
     // then the table lookup will become slow. Given that, we treat tombstone
     // slot as non-empty slot here to decide whether to trigger rehash or not.
   } else if (newNumDistincts > rehashSize()) {
+    // Rows still pending from a previous incremental rehash must be in the
+    // table before it grows again.
+    finishIncrementalRehash();
     // NOTE: we need to plus one here as number itself could be power of two.
     const auto newCapacity = bits::nextPowerOfTwo(
         std::max(newNumDistincts, capacity_ - numTombstones_) + 1);
-    allocateTables(newCapacity);
-    rehash();
+    if (!isJoinBuild_ && hashMode_ != HashMode::kArray) {
+      // Grow a group by table incrementally: keep the old arrays and move
+      // their rows to the new table a fixed number of slots per probe batch
+      // instead of re-inserting all rows at once. Probes check the old table
+      // before making a new group, so all rows stay visible throughout.
+      oldTags_ = tags_;
+      oldTable_ = table_;
+      oldSizeMask_ = sizeMask_;
+      nextOldSlot_ = 0;
+      oldTableAllocation_ = std::move(tableAllocation_);
+      allocateTables(newCapacity);
+    } else {
+      allocateTables(newCapacity);
+      rehash();
+    }
+  }
+}
+
+template <bool ignoreNullKeys>
+void HashTable<ignoreNullKeys>::migrateOldTable(int64_t maxSlots) {
+  // Hashes are made with 'initNormalizedKeys' false, reusing the normalized
+  // keys stored below the rows, so hashing cannot fail here.
+  constexpr int32_t kHashBatchSize = 1024;
+  raw_vector<uint64_t> hashes;
+  hashes.resize(kHashBatchSize);
+  char* groups[kHashBatchSize];
+  const auto end = std::min<int64_t>(oldSizeMask_ + 1, nextOldSlot_ + maxSlots);
+  int32_t numGroups = 0;
+  while (nextOldSlot_ < end) {
+    const auto tag = oldTags_[nextOldSlot_];
+    if (tag != ProbeState::kEmptyTag && tag != ProbeState::kTombstoneTag) {
+      groups[numGroups++] = oldTable_[nextOldSlot_];
+      if (numGroups == kHashBatchSize) {
+        hashRows(folly::Range(groups, numGroups), false, hashes);
+        insertForGroupBy(groups, hashes.data(), numGroups);
+        numGroups = 0;
+      }
+    }
+    ++nextOldSlot_;
+  }
+  if (numGroups > 0) {
+    hashRows(folly::Range(groups, numGroups), false, hashes);
+    insertForGroupBy(groups, hashes.data(), numGroups);
+  }
+  if (nextOldSlot_ > oldSizeMask_) {
+    dropOldTable();
   }
 }
 
+template <bool ignoreNullKeys>
+void HashTable<ignoreNullKeys>::dropOldTable() {
+  if (oldTags_ == nullptr) {
+    return;
+  }
+  oldTags_ = nullptr;
+  oldTable_ = nullptr;
+  oldSizeMask_ = 0;
+  nextOldSlot_ = 0;
+  rows_->pool()->freeContiguous(oldTableAllocation_);
+}
+
 template <bool ignoreNullKeys>
 bool HashTable<ignoreNullKeys>::hashRows(
     folly::Range<char**> rows,
@@ -749,6 +933,21 @@ void syncWorkItems(
 }
 } // namespace
 
+template <bool ignoreNullKeys>
+int32_t HashTable<ignoreNullKeys>::numParallelBuildPartitions() const {
+  const int32_t numTables = 1 + otherTables_.size();
+  const int64_t maxPartitions =
+      std::max<int64_t>(numTables, kMaxParallelJoinBuildPartitions);
+  // Make at least one partition per build side table so that as many build
+  // threads as there were build drivers can run, but do not make partitions
+  // that would have fewer than 2 * kMinTableSizeForParallelJoinBuild slots.
+  return std::max<int64_t>(
+      numTables,
+      std::min<int64_t>(
+          maxPartitions,
+          capacity_ / (2 * kMinTableSizeForParallelJoinBuild)));
+}
+
 template <bool ignoreNullKeys>
 bool HashTable<ignoreNullKeys>::canApplyParallelJoinBuild() const {
   if (!isJoinBuild_ || buildExecutor_ == nullptr) {
@@ -757,18 +956,19 @@ bool HashTable<ignoreNullKeys>::canApplyParallelJoinBuild() const {
   if (hashMode_ == HashMode::kArray) {
     return false;
   }
-  if (otherTables_.empty()) {
-    return false;
-  }
-  return (capacity_ / (1 + otherTables_.size())) >
-      kMinTableSizeForParallelJoinBuild;
+  const auto numPartitions = numParallelBuildPartitions();
+  return numPartitions > 1 &&
+      (capacity_ / numPartitions) > kMinTableSizeForParallelJoinBuild;
 }
 
 template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::parallelJoinBuild() {
   TestValue::adjust(
       "facebook::velox::exec::HashTable::parallelJoinBuild", nullptr);
-  int32_t numPartitions = 1 + otherTables_.size();
+  const int32_t numTables = 1 + otherTables_.size();
+  // The partition count is independent of the number of build side tables,
+  // so a build with few drivers still builds with many threads.
+  const int32_t numPartitions = numParallelBuildPartitions();
   VELOX_CHECK_GT(
       capacity_ / numPartitions,
       kMinTableSizeForParallelJoinBuild,
@@ -797,10 +997,10 @@ void HashTable<ignoreNullKeys>::parallelJoinBuild() {
     syncWorkItems(buildSteps, error, true);
   });
 
-  for (auto i = 0; i < numPartitions; ++i) {
+  for (auto i = 0; i < numTables; ++i) {
     auto table = i == 0 ? this : otherTables_[i - 1].get();
     partitionSteps.push_back(
-        std::make_shared<AsyncSource<bool>>([this, table, numPartitions]() {
+        std::make_shared<AsyncSource<bool>>([this, table]() {
           partitionRows(*table);
           return std::make_unique<bool>(true);
         }));
@@ -841,6 +1041,8 @@ void HashTable<ignoreNullKeys>::parallelJoinBuild() {
         0,
         capacity_,
         nullptr);
+  }
+  for (auto i = 0; i < numTables; ++i) {
     auto table = i == 0 ? this : otherTables_[i - 1].get();
     VELOX_CHECK_EQ(table->rows()->numRows(), table->numParallelBuildRows_);
   }
@@ -897,8 +1099,8 @@ void HashTable<ignoreNullKeys>::buildJoinPartition(
   constexpr int32_t kBatch = 1024;
   raw_vector<char*> rows(kBatch);
   raw_vector<uint64_t> hashes(kBatch);
-  int32_t numPartitions = 1 + otherTables_.size();
-  for (auto i = 0; i < numPartitions; ++i) {
+  const int32_t numTables = 1 + otherTables_.size();
+  for (auto i = 0; i < numTables; ++i) {
     auto table = i == 0 ? this : otherTables_[i - 1].get();
     RowContainerIterator iter;
     while (auto numRows = table->rows_->listPartitionRows(
@@ -1088,6 +1290,9 @@ void HashTable<ignoreNullKeys>::insertForJoin(
 template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::rehash() {
   ++numRehashes_;
+  // rehash() re-inserts every row from the row containers, so rows still in
+  // the old table of an incremental rehash need no separate migration.
+  dropOldTable();
   constexpr int32_t kHashBatchSize = 1024;
   if (canApplyParallelJoinBuild()) {
     parallelJoinBuild();
@@ -1117,7 +1322,14 @@ void HashTable<ignoreNullKeys>::rehash() {
 
 template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::setHashMode(HashMode mode, int32_t numNew) {
-  VELOX_CHECK_NE(hashMode_, HashMode::kHash);
+  // Normalized keys cannot be re-enabled once disabled in the RowContainer,
+  // so the only transition out of kHash is to kArray, made by
+  // tryRespecializeHashMode() after re-analyzing the keys.
+  VELOX_CHECK(
+      hashMode_ != HashMode::kHash || mode == HashMode::kArray,
+      "Invalid hash mode transition: {} to {}",
+      hashMode_,
+      mode);
   if (mode == HashMode::kArray) {
     auto bytes = capacity_ * sizeof(char*);
     constexpr auto kPageSize = memory::AllocationTraits::kPageSize;
@@ -1133,6 +1345,7 @@ void HashTable<ignoreNullKeys>::setHashMode(HashMode mode, int32_t numNew) {
       hasher->resetStats();
     }
     rows_->disableNormalizedKeys();
+    normalizedKeysDisabled_ = true;
     capacity_ = 0;
     // Makes tables of the right size and rehashes.
     checkSize(numNew);
@@ -1320,6 +1533,12 @@ void HashTable<ignoreNullKeys>::decideHashMode(
     return;
   }
   if (rangesWithReserve != VectorHasher::kRangeTooLarge) {
+    if (normalizedKeysDisabled_) {
+      // The normalized key storage was given up when first entering kHash
+      // mode, so only kArray and kHash remain possible.
+      setHashMode(HashMode::kHash, numNew);
+      return;
+    }
     std::fill(useRange.begin(), useRange.end(), true);
     setHasherMode(hashers_, useRange, rangeSizes, distinctSizes);
     setHashMode(HashMode::kNormalizedKey, numNew);
@@ -1343,6 +1562,10 @@ void HashTable<ignoreNullKeys>::decideHashMode(
     setHashMode(HashMode::kHash, numNew);
     return;
   }
+  if (normalizedKeysDisabled_) {
+    setHashMode(HashMode::kHash, numNew);
+    return;
+  }
   // The key concatenation fits in 64 bits.
   if (bestWithReserve != VectorHasher::kRangeTooLarge) {
     enableRangeWhereCan(rangeSizes, distinctSizes, useRange);
@@ -1353,6 +1576,104 @@ void HashTable<ignoreNullKeys>::decideHashMode(
   setHashMode(HashMode::kNormalizedKey, numNew);
 }
 
+template <bool ignoreNullKeys>
+bool HashTable<ignoreNullKeys>::tryRespecializeHashMode(
+    vector_size_t numInput) {
+  // Number of kHash mode input rows to see before re-checking the hash mode.
+  constexpr uint64_t kMinInputRows = 32 << 10;
+  // Required ratio of input rows to distinct keys before re-analysis is
+  // expected to pay off.
+  constexpr uint64_t kMinRowsPerDistinct = 16;
+  if (hashMode_ != HashMode::kHash || isJoinBuild_ ||
+      triedHashModeRespecialize_ || !otherTables_.empty()) {
+    return false;
+  }
+  numHashModeInputRows_ += numInput;
+  if (numDistinct_ == 0 || numDistinct_ >= VectorHasher::kMaxDistinct ||
+      numHashModeInputRows_ < kMinInputRows ||
+      numHashModeInputRows_ < numDistinct_ * kMinRowsPerDistinct) {
+    return false;
+  }
+  for (auto& hasher : hashers_) {
+    if (!VectorHasher::typeKindSupportsValueIds(hasher->typeKind())) {
+      triedHashModeRespecialize_ = true;
+      return false;
+    }
+  }
+  // The keys are analyzed only once. A cardinality that looks small now but
+  // does not fit value id addressing is unlikely to shrink with more input.
+  triedHashModeRespecialize_ = true;
+
+  // Re-analyze the keys of the accumulated rows from scratch. Entering kHash
+  // mode only cleared the accumulated values, not the sticky overflow flags,
+  // so analyze() would have skipped these hashers.
+  for (auto& hasher : hashers_) {
+    hasher->resetStatsFull();
+  }
+  constexpr int32_t kHashBatchSize = 1024;
+  // @lint-ignore CLANGTIDY
+  char* groups[kHashBatchSize];
+  RowContainerIterator iterator;
+  int32_t numGroups;
+  do {
+    numGroups = rows_->listRows(&iterator, kHashBatchSize, groups);
+    for (int32_t i = 0; i < hashers_.size(); ++i) {
+      RowColumn column = rows_->columnAt(i);
+      hashers_[i]->analyze(
+          groups,
+          numGroups,
+          column.offset(),
+          ignoreNullKeys ? 0 : column.nullByte(),
+          ignoreNullKeys ? 0 : column.nullMask());
+    }
+  } while (numGroups > 0);
+
+  // Normalized keys cannot be re-enabled once disabled in the RowContainer,
+  // so the only candidate mode is kArray with the keys in range or distinct
+  // value id mode, as in decideHashMode().
+  std::vector<uint64_t> rangeSizes(hashers_.size());
+  std::vector<uint64_t> distinctSizes(hashers_.size());
+  std::vector<bool> useRange(hashers_.size());
+  uint64_t bestWithReserve = 1;
+  for (int i = 0; i < hashers_.size(); ++i) {
+    hashers_[i]->cardinality(reservePct(), rangeSizes[i], distinctSizes[i]);
+    if (rangeSizes[i] != VectorHasher::kRangeTooLarge &&
+        (distinctSizes[i] == VectorHasher::kRangeTooLarge ||
+         rangeSizes[i] <= distinctSizes[i] * 20)) {
+      useRange[i] = true;
+      bestWithReserve = safeMul(bestWithReserve, rangeSizes[i]);
+    } else {
+      bestWithReserve = safeMul(bestWithReserve, distinctSizes[i]);
+    }
+  }
+  if (bestWithReserve >= kArrayHashMaxSize) {
+    // Stays in kHash mode. Clear the analysis so the hashers do not keep
+    // accumulating values.
+    for (auto& hasher : hashers_) {
+      hasher->resetStats();
+    }
+    return false;
+  }
+  if (disableRangeArrayHash_) {
+    clearUseRange(useRange);
+    uint64_t distinctsOnly = 1;
+    for (int i = 0; i < hashers_.size(); ++i) {
+      distinctsOnly = safeMul(
+          distinctsOnly, useRange[i] ? rangeSizes[i] : distinctSizes[i]);
+    }
+    if (distinctsOnly >= kArrayHashMaxSize) {
+      for (auto& hasher : hashers_) {
+        hasher->resetStats();
+      }
+      return false;
+    }
+  }
+  capacity_ = setHasherMode(hashers_, useRange, rangeSizes, distinctSizes);
+  numTombstones_ = 0;
+  setHashMode(HashMode::kArray, numInput);
+  return hashMode_ != HashMode::kHash;
+}
+
 template <bool ignoreNullKeys>
 std::string HashTable<ignoreNullKeys>::toString() {
   std::stringstream out;
@@ -1439,6 +1760,29 @@ void HashTable<ignoreNullKeys>::prepareJoinTable(
   }
 }
 
+// static
+void BaseHashTable::joinMatchBits(
+    const HashLookup& lookup,
+    vector_size_t numRows,
+    uint64_t* matchBits) {
+  constexpr int32_t kWidth = xsimd::batch<int64_t>::size;
+  static_assert(64 % kWidth == 0);
+  auto* hits = reinterpret_cast<const int64_t*>(lookup.hits.data());
+  std::fill(matchBits, matchBits + bits::nwords(numRows), 0);
+  vector_size_t i = 0;
+  for (; i + kWidth <= numRows; i += kWidth) {
+    auto hitWords = xsimd::batch<int64_t>::load_unaligned(hits + i);
+    if (auto mask = simd::toBitMask(hitWords != 0)) {
+      matchBits[i / 64] |= static_cast<uint64_t>(mask) << (i & 63);
+    }
+  }
+  for (; i < numRows; ++i) {
+    if (hits[i]) {
+      bits::setBit(matchBits, i);
+    }
+  }
+}
+
 template <bool ignoreNullKeys>
 int32_t HashTable<ignoreNullKeys>::listJoinResults(
     JoinResultIterator& iter,
@@ -1674,6 +2018,8 @@ template <bool ignoreNullKeys>
 void HashTable<ignoreNullKeys>::eraseWithHashes(
     folly::Range<char**> rows,
     uint64_t* hashes) {
+  // Erase probes only the current table, so all rows must be in it.
+  finishIncrementalRehash();
   auto numRows = rows.size();
   if (hashMode_ == HashMode::kArray) {
     for (auto i = 0; i < numRows; ++i) {
@@ -1725,8 +2071,19 @@ void HashTable<ignoreNullKeys>::checkConsistency() const {
       continue;
     }
   }
+  // Rows not yet moved by an incremental rehash are in the old table at or
+  // after 'nextOldSlot_' and are not in the current table.
+  uint64_t numPendingOld = 0;
+  if (oldTags_ != nullptr) {
+    for (auto i = nextOldSlot_; i <= oldSizeMask_; ++i) {
+      if (oldTags_[i] != ProbeState::kEmptyTag &&
+          oldTags_[i] != ProbeState::kTombstoneTag) {
+        ++numPendingOld;
+      }
+    }
+  }
   VELOX_CHECK_EQ(
-      numEmpty + numTombstone + numDistinct_,
+      numEmpty + numTombstone + numDistinct_ - numPendingOld,
       capacity_,
       "capacity: {}, numEmpty: {}, numTombstone: {}, numDistinct: {}",
       capacity_,
@@ -1758,7 +2115,13 @@ void BaseHashTable::prepareForProbe(
   lookup.reset(rows.end());
 
   bool rehash = false;
-  const auto mode = hashMode();
+  auto mode = hashMode();
+  if (mode == BaseHashTable::HashMode::kHash &&
+      tryRespecializeHashMode(rows.countSelected())) {
+    // The table switched to value id based addressing for the rest of the
+    // input.
+    mode = hashMode();
+  }
   for (auto i = 0; i < hashers.size(); ++i) {
     auto& hasher = hashers[i];
     if (mode != BaseHashTable::HashMode::kHash) {
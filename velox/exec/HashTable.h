@@ -152,6 +152,17 @@ class BaseHashTable {
       folly::Range<vector_size_t*> inputRows,
       folly::Range<char**> hits) = 0;
 
+  /// Fills 'matchBits' with one bit per probe row of 'lookup', set if the row
+  /// has a hit. This is the complete join result for semi and anti joins
+  /// without extra filter where only the existence of a match matters.
+  /// Unlike listJoinResults, this does not produce probe row numbers or
+  /// pointers into the table. 'matchBits' must have space for 'numRows' bits
+  /// and 'lookup.hits' must cover all of 'numRows'.
+  static void joinMatchBits(
+      const HashLookup& lookup,
+      vector_size_t numRows,
+      uint64_t* FOLLY_NONNULL matchBits);
+
   /// Returns rows with 'probed' flag unset. Used by the right/full join.
   virtual int32_t listNotProbedRows(
       RowsIterator* FOLLY_NULLABLE iter,
@@ -236,6 +247,16 @@ class BaseHashTable {
       int32_t numNew,
       bool disableRangeArrayHash = false) = 0;
 
+  /// Checks if a group by table in kHash mode can be re-specialized to value
+  /// id based addressing after the observed key cardinality has stayed
+  /// small. The first batch may have wide key bounds that force kHash even
+  /// though almost all the input maps to few distinct keys. 'numInput' is
+  /// the size of the batch about to be probed and drives the decision of
+  /// when enough input has been seen. Returns true if the hash mode changed,
+  /// in which case the caller must recompute the hashes of the key
+  /// columns. No-op for join builds and non-kHash modes.
+  virtual bool tryRespecializeHashMode(vector_size_t numInput) = 0;
+
   // Removes 'rows'  from the hash table and its RowContainer. 'rows' must exist
   // and be unique.
   virtual void erase(folly::Range<char**> rows) = 0;
@@ -434,6 +455,8 @@ class HashTable : public BaseHashTable {
   void decideHashMode(int32_t numNew, bool disableRangeArrayHash = false)
       override;
 
+  bool tryRespecializeHashMode(vector_size_t numInput) override;
+
   void erase(folly::Range<char**> rows) override;
 
   // Moves the contents of 'tables' into 'this' and prepares 'this'
@@ -498,6 +521,10 @@ class HashTable : public BaseHashTable {
 
   void arrayGroupProbe(HashLookup& lookup);
 
+  // Join probe for kArray mode. The hash is the index of the hit candidate,
+  // so the hit pointers are gathered a full SIMD batch at a time.
+  void arrayJoinProbe(HashLookup& lookup);
+
   void setHashMode(HashMode mode, int32_t numNew) override;
 
   // Fast path for join results when there are no duplicates in the table.
@@ -536,6 +563,33 @@ class HashTable : public BaseHashTable {
 
   void checkSize(int32_t numNew);
 
+  // Moves rows from up to 'maxSlots' slots of the old table kept by an
+  // in-progress incremental rehash into the current table. Frees the old
+  // table after the last slot is processed. Only group by tables in kHash
+  // or kNormalizedKey mode rehash incrementally.
+  void migrateOldTable(int64_t maxSlots);
+
+  // Completes an in-progress incremental rehash, if any. Called before
+  // operations that need all rows to be in the current table, e.g. erase
+  // or growing the table again.
+  void finishIncrementalRehash() {
+    if (oldTags_ != nullptr) {
+      migrateOldTable(oldSizeMask_ + 1);
+    }
+  }
+
+  // Drops the old table of an in-progress incremental rehash without
+  // moving its rows. Used when the table is rebuilt from 'rows_', as in
+  // rehash() or clear().
+  void dropOldTable();
+
+  // Looks up the key of 'row' of 'lookup' in the old table of an
+  // in-progress incremental rehash. If found, moves the entry to 'index'
+  // of the current table, leaving a tombstone in the old table, and
+  // returns the group. Returns nullptr if the key is not in the old table.
+  char* FOLLY_NULLABLE
+  moveFromOldTable(HashLookup& lookup, int32_t index, vector_size_t row);
+
   // Computes hash numbers of the appropriate hash mode for 'groups',
   // stores these in 'hashes' and inserts the groups using
   // insertForJoin or insertForGroupBy.
@@ -569,18 +623,24 @@ class HashTable : public BaseHashTable {
       uint64_t* FOLLY_NULLABLE hashes,
       int32_t numGroups);
 
+  // Returns the number of disjoint key space partitions a parallel join
+  // build divides the table into. At least one per build side table and
+  // more if the table is large enough, so that the build parallelism is
+  // not limited by the number of build drivers.
+  int32_t numParallelBuildPartitions() const;
+
   /// Checks if we can apply parallel table build optimization for hash join.
   /// The function returns true if all of the following conditions:
   /// 1. the hash table is built for parallel join;
-  /// 2. there is more than one sub-tables;
-  /// 3. the build executor has been set;
-  /// 4. the table is not in kArray mode;
-  /// 5. the number of table entries per each parallel build shard is no less
-  ///    than a pre-defined threshold: 1000 for now.
+  /// 2. the build executor has been set;
+  /// 3. the table is not in kArray mode;
+  /// 4. there is more than one build partition and the number of table
+  ///    entries per each parallel build shard is no less than a pre-defined
+  ///    threshold: 1000 for now.
   bool canApplyParallelJoinBuild() const;
 
-  // Builds a join table with '1 + otherTables_.size()' independent
-  // threads using 'executor_'. First all RowContainers get partition
+  // Builds a join table with 'numParallelBuildPartitions()' independent
+  // work items on 'executor_'. First all RowContainers get partition
   // numbers assigned to each row. Next, all threads pick all rows
   // assigned to their thread-specific partition and insert these. If
   // a row would overflow past the end of its partition it is added to
@@ -680,6 +740,18 @@ class HashTable : public BaseHashTable {
   uint8_t* FOLLY_NULLABLE tags_ = nullptr;
   char* FOLLY_NULLABLE* FOLLY_NULLABLE table_ = nullptr;
   memory::ContiguousAllocation tableAllocation_;
+
+  // State of an in-progress incremental rehash of a group by table. When
+  // the table grows, the previous tags and pointers arrays are kept here
+  // and their rows are moved to the new arrays a fixed number of slots per
+  // probe batch. Probes that miss the new table check the old table before
+  // making a new group. 'nextOldSlot_' is the first slot of the old table
+  // not yet visited by migrateOldTable().
+  uint8_t* FOLLY_NULLABLE oldTags_ = nullptr;
+  char* FOLLY_NULLABLE* FOLLY_NULLABLE oldTable_ = nullptr;
+  memory::ContiguousAllocation oldTableAllocation_;
+  int64_t oldSizeMask_{0};
+  int64_t nextOldSlot_{0};
   int64_t capacity_{0};
   int64_t sizeMask_{0};
   int64_t numDistinct_{0};
@@ -708,6 +780,20 @@ class HashTable : public BaseHashTable {
 
   // If true, avoids using VectorHasher value ranges with kArray hash mode.
   bool disableRangeArrayHash_{false};
+
+  // Number of input rows probed while in kHash mode. Used by
+  // tryRespecializeHashMode() to decide when enough input has been seen to
+  // trust the observed cardinality.
+  uint64_t numHashModeInputRows_{0};
+
+  // True after tryRespecializeHashMode() has re-analyzed the keys, whether
+  // or not the mode changed. The keys are only re-analyzed once.
+  bool triedHashModeRespecialize_{false};
+
+  // True after the RowContainer's normalized key storage was given up on
+  // first entering kHash mode. kNormalizedKey mode is no longer possible
+  // after this.
+  bool normalizedKeysDisabled_{false};
 };
 
 } // namespace facebook::velox::exec
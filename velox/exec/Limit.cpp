@@ -16,6 +16,20 @@
 #include "velox/exec/Limit.h"
 
 namespace facebook::velox::exec {
+namespace {
+// Returns true if 'input' can be sliced without copying. Unloaded lazy
+// children cannot be sliced; they are emitted through a dictionary wrap
+// instead so that loading stays deferred.
+bool isSliceable(const RowVector& input) {
+  for (const auto& child : input.children()) {
+    if (child != nullptr && isLazyNotLoaded(*child)) {
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
 Limit::Limit(
     int32_t operatorId,
     DriverCtx* driverCtx,
@@ -60,14 +74,19 @@ RowVectorPtr Limit::getOutput() {
   }
 
   if (remainingOffset_ > 0) {
-    // Return a subset of input_ rows.
+    // Return a subset of input_ rows, as a zero-copy slice when possible.
     auto outputSize = std::min(inputSize - remainingOffset_, remainingLimit_);
 
-    BufferPtr indices = allocateIndices(outputSize, pool());
-    auto rawIndices = indices->asMutable<vector_size_t>();
-    std::iota(rawIndices, rawIndices + outputSize, remainingOffset_);
-
-    auto output = fillOutput(outputSize, indices);
+    RowVectorPtr output;
+    if (isSliceable(*input_)) {
+      output = std::static_pointer_cast<RowVector>(
+          input_->slice(remainingOffset_, outputSize));
+    } else {
+      BufferPtr indices = allocateIndices(outputSize, pool());
+      auto rawIndices = indices->asMutable<vector_size_t>();
+      std::iota(rawIndices, rawIndices + outputSize, remainingOffset_);
+      output = fillOutput(outputSize, indices);
+    }
     remainingOffset_ = 0;
     remainingLimit_ -= outputSize;
     input_ = nullptr;
@@ -88,12 +107,20 @@ RowVectorPtr Limit::getOutput() {
     return output;
   }
 
-  auto output = std::make_shared<RowVector>(
-      input_->pool(),
-      input_->type(),
-      input_->nulls(),
-      remainingLimit_,
-      input_->children());
+  RowVectorPtr output;
+  if (isSliceable(*input_)) {
+    // Slice instead of truncating in place so that children are also
+    // resized and downstream operators never see rows past the limit.
+    output =
+        std::static_pointer_cast<RowVector>(input_->slice(0, remainingLimit_));
+  } else {
+    output = std::make_shared<RowVector>(
+        input_->pool(),
+        input_->type(),
+        input_->nulls(),
+        remainingLimit_,
+        input_->children());
+  }
   input_.reset();
   remainingLimit_ = 0;
   return output;
@@ -38,6 +38,10 @@ class Limit : public Operator {
     return finished_ || (noMoreInput_ && input_ == nullptr);
   }
 
+  std::optional<int64_t> remainingRowBudget() const override {
+    return static_cast<int64_t>(remainingOffset_) + remainingLimit_;
+  }
+
  private:
   int32_t remainingOffset_;
   int32_t remainingLimit_;
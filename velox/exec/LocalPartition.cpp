@@ -29,80 +29,96 @@ void notify(std::vector<ContinuePromise>& promises) {
 bool LocalExchangeMemoryManager::increaseMemoryUsage(
     ContinueFuture* future,
     int64_t added) {
-  std::lock_guard<std::mutex> l(mutex_);
-  bufferedBytes_ += added;
+  if (bufferedBytes_.fetch_add(added) + added < maxBufferSize_) {
+    return false;
+  }
 
-  if (bufferedBytes_ >= maxBufferSize_) {
-    promises_.emplace_back("LocalExchangeMemoryManager::updateMemoryUsage");
-    *future = promises_.back().getSemiFuture();
-    return true;
+  std::lock_guard<std::mutex> l(mutex_);
+  // Re-check under the mutex. A concurrent decrease below the limit releases
+  // promises under the same mutex, so a promise registered here is guaranteed
+  // to be fulfilled.
+  if (bufferedBytes_ < maxBufferSize_) {
+    return false;
   }
 
-  return false;
+  promises_.emplace_back("LocalExchangeMemoryManager::updateMemoryUsage");
+  *future = promises_.back().getSemiFuture();
+  return true;
 }
 
 std::vector<ContinuePromise> LocalExchangeMemoryManager::decreaseMemoryUsage(
     int64_t removed) {
   std::vector<ContinuePromise> promises;
-  {
+  const auto oldBytes = bufferedBytes_.fetch_sub(removed);
+  if (oldBytes >= maxBufferSize_ && oldBytes - removed < maxBufferSize_) {
     std::lock_guard<std::mutex> l(mutex_);
-    bufferedBytes_ -= removed;
-
-    if (bufferedBytes_ < maxBufferSize_) {
-      promises = std::move(promises_);
-    }
+    promises = std::move(promises_);
   }
   return promises;
 }
 
-void LocalExchangeQueue::addProducer() {
-  queue_.withWLock([&](auto& /*queue*/) {
-    VELOX_CHECK(!noMoreProducers_, "addProducer called after noMoreProducers");
-    ++pendingProducers_;
-  });
+int32_t LocalExchangeQueue::addProducer() {
+  std::lock_guard<std::mutex> l(mutex_);
+  VELOX_CHECK(!noMoreProducers_, "addProducer called after noMoreProducers");
+  ++pendingProducers_;
+  lanes_.push_back(std::make_unique<LocalExchangeLane>());
+  return lanes_.size() - 1;
 }
 
 void LocalExchangeQueue::noMoreProducers() {
   std::vector<ContinuePromise> consumerPromises;
   std::vector<ContinuePromise> producerPromises;
-  queue_.withWLock([&](auto& queue) {
+  {
+    std::lock_guard<std::mutex> l(mutex_);
     VELOX_CHECK(!noMoreProducers_, "noMoreProducers can be called only once");
     noMoreProducers_ = true;
     if (pendingProducers_ == 0) {
       // No more data will be produced.
+      producersDone_ = true;
+      consumerWaiting_ = false;
       consumerPromises = std::move(consumerPromises_);
 
-      if (queue.empty()) {
+      if (allLanesEmpty()) {
         // All data has been consumed.
         producerPromises = std::move(producerPromises_);
       }
     }
-  });
+  }
   notify(consumerPromises);
   notify(producerPromises);
 }
 
 BlockingReason LocalExchangeQueue::enqueue(
+    int32_t producer,
     RowVectorPtr input,
     ContinueFuture* future) {
   auto inputBytes = input->estimateFlatSize();
 
-  std::vector<ContinuePromise> consumerPromises;
-  bool isClosed = queue_.withWLock([&](auto& queue) {
-    if (closed_) {
-      return true;
+  if (closed_) {
+    return BlockingReason::kNotBlocked;
+  }
+
+  lanes_[producer]->enqueue(std::move(input));
+
+  // Wake the consumer up only if it reported that it ran out of data. The
+  // consumer re-checks the lanes after setting 'consumerWaiting_', so data
+  // enqueued before the flag is set is never missed.
+  if (consumerWaiting_) {
+    std::vector<ContinuePromise> consumerPromises;
+    {
+      std::lock_guard<std::mutex> l(mutex_);
+      consumerWaiting_ = false;
+      consumerPromises = std::move(consumerPromises_);
     }
-    queue.push(std::move(input));
-    consumerPromises = std::move(consumerPromises_);
-    return false;
-  });
+    notify(consumerPromises);
+  }
 
-  if (isClosed) {
+  if (closed_) {
+    // 'close' might have dropped the data before this producer got to account
+    // for it; do not count bytes that will never be consumed.
     return BlockingReason::kNotBlocked;
   }
 
-  notify(consumerPromises);
-
   if (memoryManager_->increaseMemoryUsage(future, inputBytes)) {
     return BlockingReason::kWaitForConsumer;
   }
@@ -113,30 +129,49 @@ BlockingReason LocalExchangeQueue::enqueue(
 void LocalExchangeQueue::noMoreData() {
   std::vector<ContinuePromise> consumerPromises;
   std::vector<ContinuePromise> producerPromises;
-  queue_.withWLock([&](auto queue) {
+  {
+    std::lock_guard<std::mutex> l(mutex_);
     VELOX_CHECK_GT(pendingProducers_, 0);
     --pendingProducers_;
     if (noMoreProducers_ && pendingProducers_ == 0) {
+      producersDone_ = true;
+      consumerWaiting_ = false;
       consumerPromises = std::move(consumerPromises_);
-      if (queue.empty()) {
+      if (allLanesEmpty()) {
         producerPromises = std::move(producerPromises_);
       }
     }
-  });
+  }
   notify(consumerPromises);
   notify(producerPromises);
 }
 
+RowVectorPtr LocalExchangeQueue::nextData() {
+  for (auto i = 0; i < lanes_.size(); ++i) {
+    const auto lane = (nextLane_ + i) % lanes_.size();
+    if (auto data = lanes_[lane]->dequeue()) {
+      nextLane_ = (lane + 1) % lanes_.size();
+      return data;
+    }
+  }
+  return nullptr;
+}
+
 BlockingReason LocalExchangeQueue::next(
     ContinueFuture* future,
     memory::MemoryPool* pool,
     RowVectorPtr* data) {
-  std::vector<ContinuePromise> producerPromises;
-  std::vector<ContinuePromise> memoryPromises;
-  auto blockingReason = queue_.withWLock([&](auto& queue) {
-    *data = nullptr;
-    if (queue.empty()) {
-      if (isFinishedLocked(queue)) {
+  *data = nextData();
+  if (*data == nullptr) {
+    std::lock_guard<std::mutex> l(mutex_);
+    // Tell producers to wake us up on the next enqueue and re-check the lanes
+    // to avoid missing data enqueued between the first check and setting the
+    // flag.
+    consumerWaiting_ = true;
+    *data = nextData();
+    if (*data == nullptr) {
+      if (isFinishedLocked()) {
+        consumerWaiting_ = false;
         return BlockingReason::kNotBlocked;
       }
 
@@ -145,31 +180,40 @@ BlockingReason LocalExchangeQueue::next(
 
       return BlockingReason::kWaitForProducer;
     }
+    consumerWaiting_ = false;
+  }
 
-    *data = queue.front();
-    queue.pop();
-
-    memoryPromises =
-        memoryManager_->decreaseMemoryUsage((*data)->estimateFlatSize());
+  auto memoryPromises =
+      memoryManager_->decreaseMemoryUsage((*data)->estimateFlatSize());
+  notify(memoryPromises);
 
-    if (noMoreProducers_ && pendingProducers_ == 0 && queue.empty()) {
+  if (producersDone_ && allLanesEmpty()) {
+    std::vector<ContinuePromise> producerPromises;
+    {
+      std::lock_guard<std::mutex> l(mutex_);
       producerPromises = std::move(producerPromises_);
     }
+    notify(producerPromises);
+  }
 
-    return BlockingReason::kNotBlocked;
-  });
-  notify(memoryPromises);
-  notify(producerPromises);
-  return blockingReason;
+  return BlockingReason::kNotBlocked;
+}
+
+bool LocalExchangeQueue::allLanesEmpty() const {
+  for (const auto& lane : lanes_) {
+    if (!lane->empty()) {
+      return false;
+    }
+  }
+  return true;
 }
 
-bool LocalExchangeQueue::isFinishedLocked(
-    const std::queue<RowVectorPtr>& queue) const {
+bool LocalExchangeQueue::isFinishedLocked() const {
   if (closed_) {
     return true;
   }
 
-  if (noMoreProducers_ && pendingProducers_ == 0 && queue.empty()) {
+  if (noMoreProducers_ && pendingProducers_ == 0 && allLanesEmpty()) {
     return true;
   }
 
@@ -177,31 +221,35 @@ bool LocalExchangeQueue::isFinishedLocked(
 }
 
 BlockingReason LocalExchangeQueue::isFinished(ContinueFuture* future) {
-  return queue_.withWLock([&](auto& queue) {
-    if (isFinishedLocked(queue)) {
-      return BlockingReason::kNotBlocked;
-    }
+  std::lock_guard<std::mutex> l(mutex_);
+  if (isFinishedLocked()) {
+    return BlockingReason::kNotBlocked;
+  }
 
-    producerPromises_.emplace_back("LocalExchangeQueue::isFinished");
-    *future = producerPromises_.back().getSemiFuture();
+  producerPromises_.emplace_back("LocalExchangeQueue::isFinished");
+  *future = producerPromises_.back().getSemiFuture();
 
-    return BlockingReason::kWaitForConsumer;
-  });
+  return BlockingReason::kWaitForConsumer;
 }
 
 bool LocalExchangeQueue::isFinished() {
-  return queue_.withWLock([&](auto& queue) { return isFinishedLocked(queue); });
+  std::lock_guard<std::mutex> l(mutex_);
+  return isFinishedLocked();
 }
 
 void LocalExchangeQueue::close() {
   std::vector<ContinuePromise> producerPromises;
   std::vector<ContinuePromise> consumerPromises;
   std::vector<ContinuePromise> memoryPromises;
-  queue_.withWLock([&](auto& queue) {
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    closed_ = true;
+
     uint64_t freedBytes = 0;
-    while (!queue.empty()) {
-      freedBytes += queue.front()->estimateFlatSize();
-      queue.pop();
+    for (auto& lane : lanes_) {
+      while (auto data = lane->dequeue()) {
+        freedBytes += data->estimateFlatSize();
+      }
     }
 
     if (freedBytes) {
@@ -210,8 +258,7 @@ void LocalExchangeQueue::close() {
 
     producerPromises = std::move(producerPromises_);
     consumerPromises = std::move(consumerPromises_);
-    closed_ = true;
-  });
+  }
   notify(producerPromises);
   notify(consumerPromises);
   notify(memoryPromises);
@@ -282,8 +329,9 @@ LocalPartition::LocalPartition(
               : planNode->partitionFunctionSpec().create(numPartitions_)) {
   VELOX_CHECK(numPartitions_ == 1 || partitionFunction_ != nullptr);
 
+  producerIds_.reserve(queues_.size());
   for (auto& queue : queues_) {
-    queue->addProducer();
+    producerIds_.push_back(queue->addProducer());
   }
 }
 
@@ -339,7 +387,7 @@ void LocalPartition::addInput(RowVectorPtr input) {
 
   if (numPartitions_ == 1) {
     ContinueFuture future;
-    auto blockingReason = queues_[0]->enqueue(input_, &future);
+    auto blockingReason = queues_[0]->enqueue(producerIds_[0], input_, &future);
     if (blockingReason != BlockingReason::kNotBlocked) {
       blockingReasons_.push_back(blockingReason);
       futures_.push_back(std::move(future));
@@ -369,7 +417,8 @@ void LocalPartition::addInput(RowVectorPtr input) {
           wrapChildren(input_, partitionSize, std::move(indexBuffers[i]));
 
       ContinueFuture future;
-      auto reason = queues_[i]->enqueue(partitionData, &future);
+      auto reason =
+          queues_[i]->enqueue(producerIds_[i], partitionData, &future);
       if (reason != BlockingReason::kNotBlocked) {
         blockingReasons_.push_back(reason);
         futures_.push_back(std::move(future));
@@ -39,16 +39,74 @@ class LocalExchangeMemoryManager {
  private:
   const int64_t maxBufferSize_;
   std::mutex mutex_;
-  int64_t bufferedBytes_{0};
+  std::atomic<int64_t> bufferedBytes_{0};
   std::vector<ContinuePromise> promises_;
 };
 
+/// Lock-free unbounded queue connecting a single producer of a local exchange
+/// to the single consumer of a LocalExchangeQueue. Each producer gets its own
+/// lane per queue, so producers never contend with each other or with the
+/// consumer when passing batches.
+class LocalExchangeLane {
+ public:
+  LocalExchangeLane() : head_{new Node()}, tail_{head_} {}
+
+  ~LocalExchangeLane() {
+    while (auto* node = head_) {
+      head_ = node->next.load();
+      delete node;
+    }
+  }
+
+  /// Appends 'data'. May be called only by the producer.
+  void enqueue(RowVectorPtr data) {
+    auto* node = new Node();
+    node->data = std::move(data);
+    tail_->next.store(node);
+    tail_ = node;
+    ++size_;
+  }
+
+  /// Removes and returns the oldest entry or nullptr if the lane is empty.
+  /// May be called only by the consumer.
+  RowVectorPtr dequeue() {
+    auto* next = head_->next.load();
+    if (next == nullptr) {
+      return nullptr;
+    }
+    auto data = std::move(next->data);
+    delete head_;
+    head_ = next;
+    --size_;
+    return data;
+  }
+
+  bool empty() const {
+    return size_ == 0;
+  }
+
+ private:
+  // Singly-linked list with a dummy node at the head so that the producer and
+  // the consumer never update the same pointer. 'head_' is owned by the
+  // consumer, 'tail_' by the producer.
+  struct Node {
+    RowVectorPtr data;
+    std::atomic<Node*> next{nullptr};
+  };
+
+  Node* head_;
+  Node* tail_;
+  std::atomic<int64_t> size_{0};
+};
+
 /// Buffers data for a single partition produced by local exchange. Allows
-/// multiple producers to enqueue data and multiple consumers fetch data. Each
-/// producer must be registered with a call to 'addProducer'. 'noMoreProducers'
-/// must be called after all producers have been registered. A producer calls
-/// 'enqueue' multiple time to put the data and calls 'noMoreData' when done.
-/// Consumers call 'next' repeatedly to fetch the data.
+/// multiple producers to enqueue data and a single consumer to fetch data.
+/// Each producer gets a dedicated single-producer single-consumer lane, hence
+/// neither 'enqueue' nor 'next' take a lock in the common case. Each producer
+/// must be registered with a call to 'addProducer'. 'noMoreProducers' must be
+/// called after all producers have been registered. A producer calls 'enqueue'
+/// multiple time to put the data and calls 'noMoreData' when done. The
+/// consumer calls 'next' repeatedly to fetch the data.
 class LocalExchangeQueue {
  public:
   LocalExchangeQueue(
@@ -60,14 +118,17 @@ class LocalExchangeQueue {
     return fmt::format("LocalExchangeQueue({})", partition_);
   }
 
-  void addProducer();
+  /// Registers a producer and returns its id to pass to 'enqueue'.
+  int32_t addProducer();
 
   void noMoreProducers();
 
   /// Used by a producer to add data. Returning kNotBlocked if can accept more
   /// data. Otherwise returns kWaitForConsumer and sets future that will be
-  /// completed when ready to accept more data.
-  BlockingReason enqueue(RowVectorPtr input, ContinueFuture* future);
+  /// completed when ready to accept more data. 'producer' is the id returned
+  /// by 'addProducer'.
+  BlockingReason
+  enqueue(int32_t producer, RowVectorPtr input, ContinueFuture* future);
 
   /// Called by a producer to indicate that no more data will be added.
   void noMoreData();
@@ -97,22 +158,42 @@ class LocalExchangeQueue {
   void close();
 
  private:
-  bool isFinishedLocked(const std::queue<RowVectorPtr>& queue) const;
+  bool isFinishedLocked() const;
+
+  bool allLanesEmpty() const;
+
+  // Removes the oldest entry across all lanes, visiting lanes round-robin.
+  // Returns nullptr if all lanes are empty. May be called only by the
+  // consumer.
+  RowVectorPtr nextData();
 
   std::shared_ptr<LocalExchangeMemoryManager> memoryManager_;
   const int partition_;
-  folly::Synchronized<std::queue<RowVectorPtr>> queue_;
+  // One lane per producer. Populated by 'addProducer' before the producers
+  // and the consumer start running and immutable afterwards.
+  std::vector<std::unique_ptr<LocalExchangeLane>> lanes_;
+  // Index of the lane to consume from next.
+  int32_t nextLane_{0};
+  // True if the consumer found all lanes empty and may be waiting on a
+  // promise in 'consumerPromises_'. Tells producers to grab 'mutex_' and wake
+  // the consumer up after enqueueing data.
+  std::atomic<bool> consumerWaiting_{false};
+  // True if noMoreProducers_ is true and pendingProducers_ is zero.
+  std::atomic<bool> producersDone_{false};
+  std::atomic<bool> closed_{false};
+
+  // Protects the members below.
+  std::mutex mutex_;
   // Satisfied when data becomes available or all producers report that they
-  // finished producing, e.g. queue_ is not empty or noMoreProducers_ is true
-  // and pendingProducers_ is zero.
+  // finished producing, e.g. some lane is not empty or noMoreProducers_ is
+  // true and pendingProducers_ is zero.
   std::vector<ContinuePromise> consumerPromises_;
   // Satisfied when all data has been fetched and no more data will be produced,
-  // e.g. queue_ is empty, noMoreProducers_ is true and pendingProducers_ is
+  // e.g. all lanes are empty, noMoreProducers_ is true and pendingProducers_ is
   // zero.
   std::vector<ContinuePromise> producerPromises_;
   int pendingProducers_{0};
   bool noMoreProducers_{false};
-  bool closed_{false};
 };
 
 /// Fetches data for a single partition produced by local exchange from
@@ -185,6 +266,8 @@ class LocalPartition : public Operator {
 
  private:
   const std::vector<std::shared_ptr<LocalExchangeQueue>> queues_;
+  // Per-queue producer ids returned by LocalExchangeQueue::addProducer.
+  std::vector<int32_t> producerIds_;
   const size_t numPartitions_;
   std::unique_ptr<core::PartitionFunction> partitionFunction_;
 
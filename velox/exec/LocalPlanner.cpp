@@ -296,14 +296,17 @@ void LocalPlanner::determineGroupedExecutionPipelines(
       factory->groupedExecution = true;
     }
 
-    // If a pipeline's leaf node is Local Partition, which has all sources
-    // belonging to pipelines that run Grouped Execution, then our pipeline
-    // should run Grouped Execution as well.
-    if (auto localPartitionNode =
-            std::dynamic_pointer_cast<const core::LocalPartitionNode>(
-                factory->planNodes.front())) {
+    // If a pipeline's leaf node is Local Partition or Local Merge, which
+    // has all sources belonging to pipelines that run Grouped Execution,
+    // then our pipeline should run Grouped Execution as well. Propagating
+    // through Local Merge lets e.g. a final streaming aggregation over
+    // scans of bucketed and sorted files run once per split group
+    // (bucket) with no repartitioning.
+    const auto& leafNode = factory->planNodes.front();
+    if (std::dynamic_pointer_cast<const core::LocalPartitionNode>(leafNode) ||
+        std::dynamic_pointer_cast<const core::LocalMergeNode>(leafNode)) {
       size_t numGroupedExecutionSources{0};
-      for (const auto& sourceNode : localPartitionNode->sources()) {
+      for (const auto& sourceNode : leafNode->sources()) {
         for (auto& anotherFactory : driverFactories) {
           if (sourceNode == anotherFactory->planNodes.back() and
               anotherFactory->groupedExecution) {
@@ -313,7 +316,7 @@ void LocalPlanner::determineGroupedExecutionPipelines(
         }
       }
       if (numGroupedExecutionSources > 0 and
-          numGroupedExecutionSources == localPartitionNode->sources().size()) {
+          numGroupedExecutionSources == leafNode->sources().size()) {
         factory->groupedExecution = true;
       }
     }
@@ -365,6 +368,67 @@ void LocalPlanner::markMixedJoinBridges(
   }
 }
 
+namespace {
+// Returns a ProjectNode equivalent to applying 'first' and then 'second'
+// when 'second' only selects columns of 'first' by name, i.e. renames,
+// reorders or duplicates them. Returns nullptr otherwise. Dropping a
+// column of 'first' prevents fusion because that would skip evaluating
+// the dropped expression, which could have side effects, e.g. errors.
+std::shared_ptr<const core::ProjectNode> tryFuseProjectNodes(
+    const std::shared_ptr<const core::ProjectNode>& first,
+    const std::shared_ptr<const core::ProjectNode>& second) {
+  std::vector<bool> referenced(first->names().size(), false);
+  std::vector<core::TypedExprPtr> projections;
+  projections.reserve(second->projections().size());
+  for (const auto& expr : second->projections()) {
+    auto field =
+        std::dynamic_pointer_cast<const core::FieldAccessTypedExpr>(expr);
+    if (!field || !field->inputs().empty()) {
+      return nullptr;
+    }
+    auto index = first->outputType()->getChildIdxIfExists(field->name());
+    if (!index.has_value()) {
+      return nullptr;
+    }
+    referenced[index.value()] = true;
+    projections.push_back(first->projections()[index.value()]);
+  }
+  for (auto wasReferenced : referenced) {
+    if (!wasReferenced) {
+      return nullptr;
+    }
+  }
+  return std::make_shared<core::ProjectNode>(
+      second->id(),
+      std::vector<std::string>(second->names()),
+      std::move(projections),
+      first->sources()[0]);
+}
+
+// Fuses select/rename/reorder ProjectNodes that directly follow
+// 'planNodes[i]' into 'projectNode' so that the chain runs as a single
+// FilterProject, advancing 'i' past the fused nodes.
+std::shared_ptr<const core::ProjectNode> fuseProjectChain(
+    std::shared_ptr<const core::ProjectNode> projectNode,
+    const std::vector<std::shared_ptr<const core::PlanNode>>& planNodes,
+    int32_t& i) {
+  while (i < planNodes.size() - 1) {
+    auto next =
+        std::dynamic_pointer_cast<const core::ProjectNode>(planNodes[i + 1]);
+    if (!next) {
+      break;
+    }
+    auto fused = tryFuseProjectNodes(projectNode, next);
+    if (!fused) {
+      break;
+    }
+    projectNode = std::move(fused);
+    ++i;
+  }
+  return projectNode;
+}
+} // namespace
+
 std::shared_ptr<Driver> DriverFactory::createDriver(
     std::unique_ptr<DriverCtx> ctx,
     std::shared_ptr<ExchangeClient> exchangeClient,
@@ -385,9 +449,10 @@ std::shared_ptr<Driver> DriverFactory::createDriver(
         auto next = planNodes[i + 1];
         if (auto projectNode =
                 std::dynamic_pointer_cast<const core::ProjectNode>(next)) {
+          i++;
+          projectNode = fuseProjectChain(std::move(projectNode), planNodes, i);
           operators.push_back(std::make_unique<FilterProject>(
               id, ctx.get(), filterNode, projectNode));
-          i++;
           continue;
         }
       }
@@ -396,6 +461,7 @@ std::shared_ptr<Driver> DriverFactory::createDriver(
     } else if (
         auto projectNode =
             std::dynamic_pointer_cast<const core::ProjectNode>(planNode)) {
+      projectNode = fuseProjectChain(std::move(projectNode), planNodes, i);
       operators.push_back(
           std::make_unique<FilterProject>(id, ctx.get(), nullptr, projectNode));
     } else if (
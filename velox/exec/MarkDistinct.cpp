@@ -19,10 +19,57 @@
 #include "velox/vector/FlatVector.h"
 
 #include <algorithm>
+#include <limits>
 #include <utility>
 
 namespace facebook::velox::exec {
 
+namespace {
+
+// Maximum combined value id range eligible for the bitmap path. Caps the
+// bitmap at 2MB.
+constexpr uint64_t kMaxValueIdRange = 1ULL << 24;
+
+// Returns the number of value ids a distinct key of 'kind' can take,
+// including one id reserved for null, or 0 if the type is not eligible for
+// the bitmap path.
+uint64_t valueIdRange(TypeKind kind) {
+  switch (kind) {
+    case TypeKind::BOOLEAN:
+      return 3;
+    case TypeKind::TINYINT:
+      return 1ULL << 8 | 1;
+    case TypeKind::SMALLINT:
+      return 1ULL << 16 | 1;
+    default:
+      return 0;
+  }
+}
+
+// Adds the value ids of one key column scaled by 'multiplier' into 'ids'. A
+// null gets id 0; other values get 1 plus the offset from the type minimum.
+template <typename T>
+void addValueIds(
+    const DecodedVector& decoded,
+    vector_size_t size,
+    uint64_t multiplier,
+    uint64_t* ids) {
+  for (auto row = 0; row < size; ++row) {
+    uint64_t id = 0;
+    if (!decoded.isNullAt(row)) {
+      if constexpr (std::is_same_v<T, bool>) {
+        id = decoded.valueAt<bool>(row) ? 2 : 1;
+      } else {
+        id = 1 +
+            static_cast<int64_t>(decoded.valueAt<T>(row)) -
+            std::numeric_limits<T>::min();
+      }
+    }
+    ids[row] += multiplier * id;
+  }
+}
+} // namespace
+
 MarkDistinct::MarkDistinct(
     int32_t operatorId,
     DriverCtx* driverCtx,
@@ -43,20 +90,152 @@ MarkDistinct::MarkDistinct(
   // We will use result[0] for distinct mask output.
   resultProjections_.emplace_back(0, inputType->size());
 
-  groupingSet_ = GroupingSet::createForMarkDistinct(
-      createVectorHashers(inputType, planNode->distinctKeys()),
-      operatorCtx_.get(),
-      &nonReclaimableSection_);
+  // If all keys have type-bounded value ids whose combined range is small,
+  // track seen key combinations in a bitmap instead of a hash table. The
+  // ranges are derived from the key types, so the ids can never overflow and
+  // no hash table fallback is needed.
+  uint64_t idRange = 1;
+  useValueIdPath_ = true;
+  for (const auto& key : planNode->distinctKeys()) {
+    const auto range = valueIdRange(key->type()->kind());
+    if (range == 0 || idRange > kMaxValueIdRange / range) {
+      useValueIdPath_ = false;
+      break;
+    }
+    keyChannels_.push_back(inputType->getChildIdx(key->name()));
+    idMultipliers_.push_back(idRange);
+    idRange *= range;
+  }
+
+  if (useValueIdPath_) {
+    decodedKeys_.resize(keyChannels_.size());
+  } else {
+    groupingSet_ = GroupingSet::createForMarkDistinct(
+        createVectorHashers(inputType, planNode->distinctKeys()),
+        operatorCtx_.get(),
+        &nonReclaimableSection_);
+    allowApproximate_ = driverCtx->queryConfig().markDistinctApproxEnabled();
+    if (allowApproximate_) {
+      filterHashers_ = createVectorHashers(inputType, planNode->distinctKeys());
+    }
+  }
 
   results_.resize(1);
 }
 
+bool MarkDistinct::canReclaim() const {
+  return allowApproximate_ && groupingSet_ != nullptr;
+}
+
+void MarkDistinct::reclaim(uint64_t /*targetBytes*/) {
+  VELOX_CHECK(canReclaim());
+
+  if (input_ != nullptr || nonReclaimableSection_) {
+    LOG(WARNING) << "Can't reclaim from mark distinct operator, has input["
+                 << (input_ != nullptr) << "], nonReclaimableSection_["
+                 << nonReclaimableSection_ << "], " << toString();
+    return;
+  }
+
+  downgradeToBloomFilter();
+  pool()->release();
+}
+
+void MarkDistinct::downgradeToBloomFilter() {
+  VELOX_CHECK_NULL(seenKeyFilter_);
+
+  constexpr int32_t kHashBatchSize = 1024;
+  auto* rows = groupingSet_->rows();
+  seenKeyFilter_ = std::make_unique<BloomFilter<>>();
+  // Size for twice the seen keys to keep the false positive rate as new keys
+  // are added after the downgrade.
+  seenKeyFilter_->reset(std::min<int64_t>(
+      rows->numRows() * 2, std::numeric_limits<int32_t>::max()));
+
+  // Seed the filter with the hashes of the seen keys. The hashes match the
+  // ones computed by 'filterHashers_' on new input, see HashTable rehashing.
+  RowContainerIterator iter;
+  std::vector<char*> rowPtrs(kHashBatchSize);
+  raw_vector<uint64_t> hashes(kHashBatchSize);
+  while (const auto numRows =
+             rows->listRows(&iter, kHashBatchSize, rowPtrs.data())) {
+    for (auto i = 0; i < filterHashers_.size(); ++i) {
+      rows->hash(
+          i,
+          folly::Range<char**>(rowPtrs.data(), numRows),
+          i > 0,
+          hashes.data());
+    }
+    for (auto i = 0; i < numRows; ++i) {
+      seenKeyFilter_->insert(hashes[i]);
+    }
+  }
+
+  groupingSet_.reset();
+  addRuntimeStat("markDistinctDowngradedToApprox", RuntimeCounter(1));
+}
+
 void MarkDistinct::addInput(RowVectorPtr input) {
-  groupingSet_->addInput(input, false /*mayPushdown*/);
+  if (!useValueIdPath_ && seenKeyFilter_ == nullptr) {
+    groupingSet_->addInput(input, false /*mayPushdown*/);
+  }
 
   input_ = std::move(input);
 }
 
+void MarkDistinct::computeDistinctMaskByBloomFilter(uint64_t* resultBits) {
+  const auto size = input_->size();
+  SelectivityVector allRows(size);
+  keyHashes_.resize(size);
+
+  for (auto i = 0; i < filterHashers_.size(); ++i) {
+    auto& hasher = filterHashers_[i];
+    hasher->decode(
+        *input_->childAt(hasher->channel())->loadedVector(), allRows);
+    hasher->hash(allRows, i > 0, keyHashes_);
+  }
+
+  for (auto row = 0; row < size; ++row) {
+    if (!seenKeyFilter_->mayContain(keyHashes_[row])) {
+      seenKeyFilter_->insert(keyHashes_[row]);
+      bits::setBit(resultBits, row, true);
+    }
+  }
+}
+
+void MarkDistinct::computeDistinctMaskByValueIds(uint64_t* resultBits) {
+  const auto size = input_->size();
+  valueIds_.resize(size);
+  std::fill(valueIds_.begin(), valueIds_.end(), 0);
+
+  for (auto i = 0; i < keyChannels_.size(); ++i) {
+    auto& decoded = decodedKeys_[i];
+    decoded.decode(*input_->childAt(keyChannels_[i]));
+    switch (decoded.base()->typeKind()) {
+      case TypeKind::BOOLEAN:
+        addValueIds<bool>(decoded, size, idMultipliers_[i], valueIds_.data());
+        break;
+      case TypeKind::TINYINT:
+        addValueIds<int8_t>(decoded, size, idMultipliers_[i], valueIds_.data());
+        break;
+      case TypeKind::SMALLINT:
+        addValueIds<int16_t>(
+            decoded, size, idMultipliers_[i], valueIds_.data());
+        break;
+      default:
+        VELOX_UNREACHABLE();
+    }
+  }
+
+  for (auto row = 0; row < size; ++row) {
+    const auto id = valueIds_[row];
+    if (!seenIds_.contains(id)) {
+      seenIds_.insert(id);
+      bits::setBit(resultBits, row, true);
+    }
+  }
+}
+
 RowVectorPtr MarkDistinct::getOutput() {
   if (isFinished() || !input_) {
     return nullptr;
@@ -78,8 +257,14 @@ RowVectorPtr MarkDistinct::getOutput() {
       results_[0]->as<FlatVector<bool>>()->mutableRawValues<uint64_t>();
 
   bits::fillBits(resultBits, 0, outputSize, false);
-  for (const auto i : groupingSet_->hashLookup().newGroups) {
-    bits::setBit(resultBits, i, true);
+  if (useValueIdPath_) {
+    computeDistinctMaskByValueIds(resultBits);
+  } else if (seenKeyFilter_ != nullptr) {
+    computeDistinctMaskByBloomFilter(resultBits);
+  } else {
+    for (const auto i : groupingSet_->hashLookup().newGroups) {
+      bits::setBit(resultBits, i, true);
+    }
   }
   auto output = fillOutput(outputSize, nullptr);
 
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include "velox/common/base/BitSet.h"
+#include "velox/common/base/BloomFilter.h"
 #include "velox/exec/GroupingSet.h"
 #include "velox/exec/Operator.h"
 
@@ -46,8 +48,57 @@ class MarkDistinct : public Operator {
 
   bool isFinished() override;
 
+  bool canReclaim() const override;
+
+  void reclaim(uint64_t targetBytes) override;
+
  private:
+  // Computes the distinct mask for 'input_' using the value id bitmap.
+  void computeDistinctMaskByValueIds(uint64_t* resultBits);
+
+  // Computes the distinct mask for 'input_' using 'seenKeyFilter_'.
+  void computeDistinctMaskByBloomFilter(uint64_t* resultBits);
+
+  // Replaces 'groupingSet_' with a Bloom filter of the hashes of the seen
+  // keys, freeing the exact seen-keys table. Keys that collide in the filter
+  // are marked as duplicates from then on, so downstream distinct aggregates
+  // may undercount.
+  void downgradeToBloomFilter();
+
   // TODO: Document spilling configuration in spilling.rst.
   std::unique_ptr<GroupingSet> groupingSet_;
+
+  // True if all distinct keys are of low-cardinality types whose combined
+  // value id range is small enough to track seen key combinations in a bitmap
+  // instead of a hash table. 'groupingSet_' is not created in that case.
+  bool useValueIdPath_{false};
+
+  // Channels of the distinct keys.
+  std::vector<column_index_t> keyChannels_;
+
+  // Per-key multiplier used to combine the value ids of individual keys into
+  // a single id, similar to VectorHasher multipliers.
+  std::vector<uint64_t> idMultipliers_;
+
+  // Ids of key combinations seen so far.
+  BitSet seenIds_{0};
+
+  // Reusable memory for decoding keys and computing value ids.
+  std::vector<DecodedVector> decodedKeys_;
+  std::vector<uint64_t> valueIds_;
+
+  // True if the query allows replacing the exact seen-keys table with a
+  // Bloom filter when the memory arbitrator signals pressure.
+  bool allowApproximate_{false};
+
+  // Set by reclaim. Holds the hashes of the seen keys once the exact table
+  // has been dropped.
+  std::unique_ptr<BloomFilter<>> seenKeyFilter_;
+
+  // Hashers used to compute seen-key hashes after the downgrade.
+  std::vector<std::unique_ptr<VectorHasher>> filterHashers_;
+
+  // Reusable memory for the key hashes of one input batch.
+  raw_vector<uint64_t> keyHashes_;
 };
 } // namespace facebook::velox::exec
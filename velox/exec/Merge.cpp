@@ -333,6 +333,10 @@ BlockingReason MergeExchange::addMergeSources(ContinueFuture* future) {
             this,
             remoteSplit->taskId,
             operatorCtx_->task()->destination(),
+            operatorCtx_->driverCtx()
+                ->queryConfig()
+                .mergeExchangeSourceBufferSize(),
+            operatorCtx_->driverCtx()->queryConfig().mergeSourceCoalesceBytes(),
             pool));
         ++numSplits_;
       } else {
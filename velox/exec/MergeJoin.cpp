@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "velox/exec/MergeJoin.h"
+#include "velox/common/base/SimdUtil.h"
 #include "velox/exec/OperatorUtils.h"
 #include "velox/exec/Task.h"
 #include "velox/expression/FieldReference.h"
@@ -156,6 +157,124 @@ int32_t MergeJoin::compare(
   return 0;
 }
 
+namespace {
+// Returns the first row in ('index', 'endIndex') of a flat 'vector' without
+// nulls whose value differs from the value at 'index', or 'endIndex' if the
+// whole range holds the same value. Uses SIMD compares for primitive types
+// that fit a vector register.
+template <TypeKind Kind>
+vector_size_t findEqualRunEndTyped(
+    const BaseVector* vector,
+    vector_size_t index,
+    vector_size_t endIndex) {
+  if constexpr (Kind == TypeKind::BOOLEAN) {
+    // Bit-packed values. The caller uses per-row compares instead.
+    VELOX_UNREACHABLE();
+  } else {
+    using T = typename TypeTraits<Kind>::NativeType;
+    const T* values = vector->asUnchecked<FlatVector<T>>()->rawValues();
+    const T value = values[index];
+    vector_size_t row = index + 1;
+    if constexpr (std::is_arithmetic_v<T> && sizeof(T) <= 8) {
+      constexpr int32_t kWidth = xsimd::batch<T>::size;
+      const auto broadcast = xsimd::batch<T>::broadcast(value);
+      for (; row + kWidth <= endIndex; row += kWidth) {
+        const auto notEqual = simd::toBitMask(
+            xsimd::batch<T>::load_unaligned(values + row) != broadcast);
+        if (notEqual) {
+          return row + __builtin_ctz(notEqual);
+        }
+      }
+    }
+    for (; row < endIndex; ++row) {
+      if (!(values[row] == value)) {
+        return row;
+      }
+    }
+    return endIndex;
+  }
+}
+} // namespace
+
+// static
+vector_size_t MergeJoin::findEndOfRun(
+    const RowVectorPtr& batch,
+    const std::vector<column_index_t>& keys,
+    vector_size_t index) {
+  // The first row where any key column differs ends the run, so each column
+  // only needs to be scanned up to the run end found in the previous columns.
+  auto endIndex = batch->size();
+  for (auto key : keys) {
+    const auto& vector = batch->childAt(key);
+    if (vector->encoding() == VectorEncoding::Simple::FLAT &&
+        vector->typeKind() != TypeKind::BOOLEAN && !vector->mayHaveNulls()) {
+      endIndex = VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
+          findEqualRunEndTyped,
+          vector->typeKind(),
+          vector.get(),
+          index,
+          endIndex);
+    } else {
+      vector_size_t row = index + 1;
+      while (row < endIndex && vector->compare(vector.get(), row, index) == 0) {
+        ++row;
+      }
+      endIndex = row;
+    }
+  }
+  return endIndex;
+}
+
+// static
+vector_size_t MergeJoin::gallop(
+    const std::vector<column_index_t>& keys,
+    const RowVectorPtr& batch,
+    vector_size_t startIndex,
+    const std::vector<column_index_t>& otherKeys,
+    const RowVectorPtr& otherBatch,
+    vector_size_t otherIndex) {
+  const auto numRows = batch->size();
+  auto lessThan = [&](vector_size_t row) {
+    return compare(keys, batch, row, otherKeys, otherBatch, otherIndex) < 0;
+  };
+  if (startIndex >= numRows) {
+    return numRows;
+  }
+  if (!lessThan(startIndex)) {
+    return startIndex;
+  }
+
+  // Exponential search for an upper bound: 'low' is the last row known to
+  // compare less, 'high' the first candidate that may not.
+  vector_size_t low = startIndex;
+  vector_size_t step = 1;
+  vector_size_t high;
+  for (;;) {
+    high = low + step;
+    if (high >= numRows) {
+      high = numRows;
+      break;
+    }
+    if (!lessThan(high)) {
+      break;
+    }
+    low = high;
+    step *= 2;
+  }
+
+  // Binary search for the first row in ('low', 'high'] that does not compare
+  // less.
+  while (low + 1 < high) {
+    const auto mid = low + (high - low) / 2;
+    if (lessThan(mid)) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+  return high;
+}
+
 bool MergeJoin::findEndOfMatch(
     Match& match,
     const RowVectorPtr& input,
@@ -170,9 +289,11 @@ bool MergeJoin::findEndOfMatch(
   auto numInput = input->size();
 
   vector_size_t endIndex = 0;
-  while (endIndex < numInput &&
-         compare(keys, input, endIndex, keys, prevInput, prevIndex) == 0) {
-    ++endIndex;
+  if (numInput > 0 &&
+      compare(keys, input, 0, keys, prevInput, prevIndex) == 0) {
+    // The first row continues the match, hence the match extends as far as
+    // the keys stay the same within 'input'.
+    endIndex = findEndOfRun(input, keys, 0);
   }
 
   if (endIndex == numInput) {
@@ -354,7 +475,79 @@ bool MergeJoin::addToOutput() {
   return outputSize_ == outputBatchSize_;
 }
 
+bool MergeJoin::drainRightMatch() {
+  prepareOutput();
+
+  // All but the last batch of the right match. The last batch may still
+  // be extended by future input and also anchors the key comparison in
+  // findEndOfMatch, so it stays in memory.
+  const size_t numRights = rightMatch_->inputs.size() - 1;
+
+  size_t firstLeftBatch;
+  vector_size_t leftStartIndex;
+  if (drainLeftCursor_) {
+    firstLeftBatch = drainLeftCursor_->batchIndex;
+    leftStartIndex = drainLeftCursor_->index;
+  } else {
+    firstLeftBatch = 0;
+    leftStartIndex = leftMatch_->startIndex;
+  }
+
+  size_t numLefts = leftMatch_->inputs.size();
+  for (size_t l = firstLeftBatch; l < numLefts; ++l) {
+    auto left = leftMatch_->inputs[l];
+    auto leftStart = l == firstLeftBatch ? leftStartIndex : 0;
+    auto leftEnd = l == numLefts - 1 ? leftMatch_->endIndex : left->size();
+
+    for (auto i = leftStart; i < leftEnd; ++i) {
+      auto firstRightBatch =
+          (l == firstLeftBatch && i == leftStart && drainRightCursor_)
+          ? drainRightCursor_->batchIndex
+          : 0;
+
+      auto rightStartIndex =
+          (l == firstLeftBatch && i == leftStart && drainRightCursor_)
+          ? drainRightCursor_->index
+          : rightMatch_->startIndex;
+
+      for (size_t r = firstRightBatch; r < numRights; ++r) {
+        auto right = rightMatch_->inputs[r];
+        auto rightStart = r == firstRightBatch ? rightStartIndex : 0;
+        auto rightEnd = right->size();
+
+        for (auto j = rightStart; j < rightEnd; ++j) {
+          if (outputSize_ == outputBatchSize_) {
+            drainLeftCursor_ = Match::Cursor{l, i};
+            drainRightCursor_ = Match::Cursor{r, j};
+            return true;
+          }
+          addOutputRow(left, i, right, j);
+        }
+      }
+    }
+  }
+
+  drainLeftCursor_.reset();
+  drainRightCursor_.reset();
+  rightMatch_->inputs.erase(
+      rightMatch_->inputs.begin(), rightMatch_->inputs.begin() + numRights);
+  rightMatch_->startIndex = 0;
+
+  return outputSize_ == outputBatchSize_;
+}
+
 namespace {
+bool mayHaveNullKeys(
+    const RowVectorPtr& rowVector,
+    const std::vector<column_index_t>& keys) {
+  for (auto key : keys) {
+    if (rowVector->childAt(key)->mayHaveNulls()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 vector_size_t firstNonNull(
     const RowVectorPtr& rowVector,
     const std::vector<column_index_t>& keys,
@@ -433,6 +626,14 @@ RowVectorPtr MergeJoin::getOutput() {
 }
 
 RowVectorPtr MergeJoin::doGetOutput() {
+  // Check if we ran out of space in the output vector in the middle of
+  // draining a still growing right-side match.
+  if (drainRightCursor_) {
+    if (drainRightMatch()) {
+      return std::move(output_);
+    }
+  }
+
   // Check if we ran out of space in the output vector in the middle of the
   // match.
   if (leftMatch_ && leftMatch_->cursor) {
@@ -470,8 +671,16 @@ RowVectorPtr MergeJoin::doGetOutput() {
 
     if (rightInput_) {
       if (!findEndOfMatch(rightMatch_.value(), rightInput_, rightKeys_)) {
-        // Continue looking for the end of the match.
+        // Continue looking for the end of the match. If the left match
+        // is already complete, emit and drop the fully matched
+        // right-side batches now instead of buffering the whole run.
+        // Not done when a left join filter tracks per-left-row output
+        // blocks, as those must stay consecutive.
         rightInput_ = nullptr;
+        if (leftMatch_->complete && !leftJoinTracker_ &&
+            rightMatch_->inputs.size() > 1 && drainRightMatch()) {
+          return std::move(output_);
+        }
         return nullptr;
       }
       if (rightMatch_->inputs.back() == rightInput_) {
@@ -552,9 +761,21 @@ RowVectorPtr MergeJoin::doGetOutput() {
         }
 
         addOutputRowForLeftJoin(input_, index_);
+        ++index_;
+      } else if (mayHaveNullKeys(input_, leftKeys_)) {
+        ++index_;
+      } else {
+        // Without nulls the batch is sorted in compare() order, so the whole
+        // range of left rows that compare less can be skipped with a binary
+        // search instead of one compare per row.
+        index_ = gallop(
+            leftKeys_,
+            input_,
+            index_ + 1,
+            rightKeys_,
+            rightInput_,
+            rightIndex_);
       }
-
-      ++index_;
       if (index_ == input_->size()) {
         // Ran out of rows on the left side.
         input_ = nullptr;
@@ -565,7 +786,18 @@ RowVectorPtr MergeJoin::doGetOutput() {
 
     // Catch up rightInput_ with input_.
     while (compareResult > 0) {
-      rightIndex_ = firstNonNull(rightInput_, rightKeys_, rightIndex_ + 1);
+      if (mayHaveNullKeys(rightInput_, rightKeys_)) {
+        rightIndex_ = firstNonNull(rightInput_, rightKeys_, rightIndex_ + 1);
+      } else {
+        // See the left side catch up above.
+        rightIndex_ = gallop(
+            rightKeys_,
+            rightInput_,
+            rightIndex_ + 1,
+            leftKeys_,
+            input_,
+            index_);
+      }
       if (rightIndex_ == rightInput_->size()) {
         // Ran out of rows on the right side.
         rightInput_ = nullptr;
@@ -577,10 +809,7 @@ RowVectorPtr MergeJoin::doGetOutput() {
     if (compareResult == 0) {
       // Found a match. Identify all rows on the left and right that have the
       // matching keys.
-      vector_size_t endIndex = index_ + 1;
-      while (endIndex < input_->size() && compareLeft(endIndex) == 0) {
-        ++endIndex;
-      }
+      auto endIndex = findEndOfRun(input_, leftKeys_, index_);
 
       if (endIndex == input_->size()) {
         // Matches continue in subsequent input. Load all lazies.
@@ -589,11 +818,7 @@ RowVectorPtr MergeJoin::doGetOutput() {
       leftMatch_ = Match{
           {input_}, index_, endIndex, endIndex < input_->size(), std::nullopt};
 
-      vector_size_t endRightIndex = rightIndex_ + 1;
-      while (endRightIndex < rightInput_->size() &&
-             compareRight(endRightIndex) == 0) {
-        ++endRightIndex;
-      }
+      auto endRightIndex = findEndOfRun(rightInput_, rightKeys_, rightIndex_);
 
       rightMatch_ = Match{
           {rightInput_},
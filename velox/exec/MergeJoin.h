@@ -65,17 +65,6 @@ class MergeJoin : public Operator {
         leftKeys_, input_, index_, rightKeys_, rightInput_, rightIndex_);
   }
 
-  // Compare two rows on the left: index_ and index.
-  int32_t compareLeft(vector_size_t index) const {
-    return compare(leftKeys_, input_, index_, leftKeys_, input_, index);
-  }
-
-  // Compare two rows on the right: rightIndex_ and index.
-  int32_t compareRight(vector_size_t index) const {
-    return compare(
-        rightKeys_, rightInput_, rightIndex_, rightKeys_, rightInput_, index);
-  }
-
   // Compare two rows from the left side.
   int32_t compareLeft(
       const RowVectorPtr& batch,
@@ -147,6 +136,30 @@ class MergeJoin : public Operator {
       const RowVectorPtr& input,
       const std::vector<column_index_t>& keys);
 
+  // Returns the first row in ('index', batch->size()) whose keys differ from
+  // the keys of 'batch' at 'index', or batch->size() if the run of equal keys
+  // extends to the end of the batch. Uses SIMD compares on flat primitive key
+  // columns without nulls and per-row compares otherwise.
+  static vector_size_t findEndOfRun(
+      const RowVectorPtr& batch,
+      const std::vector<column_index_t>& keys,
+      vector_size_t index);
+
+  // Returns the first row in ['startIndex', batch->size()) whose keys compare
+  // greater than or equal to the keys of 'otherBatch' at 'otherIndex', or
+  // batch->size() if there is none. Uses exponential followed by binary
+  // search, so long runs of non-matching rows cost a logarithmic number of
+  // compares instead of one compare per row. 'batch' must be sorted on 'keys'
+  // in compare() order, which holds for sorted merge join inputs without
+  // nulls in the keys.
+  static vector_size_t gallop(
+      const std::vector<column_index_t>& keys,
+      const RowVectorPtr& batch,
+      vector_size_t startIndex,
+      const std::vector<column_index_t>& otherKeys,
+      const RowVectorPtr& otherBatch,
+      vector_size_t otherIndex);
+
   /// Initialize 'output_' vector using 'ouputType_' and 'outputBatchSize_' if
   /// it is null.
   void prepareOutput();
@@ -160,6 +173,18 @@ class MergeJoin : public Operator {
   // rightMatchCursor_ if output_ filled up before all rows were added.
   bool addToOutput();
 
+  // Emits the cartesian product of a complete left match and the fully
+  // matched batches of a still growing right match, then drops those
+  // batches from rightMatch_->inputs. Bounds the memory used by a run
+  // of duplicate right-side keys: without this a single skewed key
+  // matching millions of right-side rows buffers all of them until the
+  // end of the run. Returns true if output_ is full; 'drainLeftCursor_'
+  // and 'drainRightCursor_' then hold the restart position. Not used
+  // for left joins with a filter because the filter machinery needs all
+  // output rows for one left-side row to be consecutive. See
+  // LeftJoinTracker.
+  bool drainRightMatch();
+
   // Adds one row of output by copying values from left and right batches at the
   // specified rows. Advances outputSize_. Assumes that output_ has room.
   //
@@ -385,6 +410,11 @@ class MergeJoin : public Operator {
   /// A set of rows with matching keys on the right side.
   std::optional<Match> rightMatch_;
 
+  /// Restart positions for drainRightMatch() for when output_ filled up
+  /// mid-drain.
+  std::optional<Match::Cursor> drainLeftCursor_;
+  std::optional<Match::Cursor> drainRightCursor_;
+
   RowVectorPtr output_;
 
   /// Number of rows accumulated in the output_.
@@ -25,8 +25,8 @@ namespace {
 
 class LocalMergeSource : public MergeSource {
  public:
-  explicit LocalMergeSource(int queueSize)
-      : queue_(LocalMergeSourceQueue(queueSize)) {}
+  LocalMergeSource(int queueSize, uint64_t coalesceBytes)
+      : queue_(LocalMergeSourceQueue(queueSize, coalesceBytes)) {}
 
   BlockingReason next(RowVectorPtr& data, ContinueFuture* future) override {
     return queue_.withWLock(
@@ -43,7 +43,8 @@ class LocalMergeSource : public MergeSource {
  private:
   class LocalMergeSourceQueue {
    public:
-    explicit LocalMergeSourceQueue(int queueSize) : data_(queueSize) {}
+    LocalMergeSourceQueue(int queueSize, uint64_t coalesceBytes)
+        : coalesceBytes_(coalesceBytes), data_(queueSize) {}
 
     BlockingReason next(RowVectorPtr& data, ContinueFuture* future) {
       data.reset();
@@ -79,7 +80,10 @@ class LocalMergeSource : public MergeSource {
         child->loadedVector();
       }
 
-      data_.push_back(input);
+      if (!tryCoalesce(input)) {
+        data_.push_back(std::move(input));
+        backIsCopy_ = false;
+      }
       notifyConsumers();
 
       if (data_.full()) {
@@ -91,6 +95,35 @@ class LocalMergeSource : public MergeSource {
     }
 
    private:
+    // Appends 'input' to the last queued vector if the combined size
+    // stays within 'coalesceBytes_'. The first append replaces the
+    // queued vector with a copy owned by the queue; vectors enqueued by
+    // the producer may share buffers with its state and must not be
+    // modified in place.
+    bool tryCoalesce(const RowVectorPtr& input) {
+      if (data_.empty()) {
+        return false;
+      }
+      auto& back = data_.back();
+      if (back->estimateFlatSize() + input->estimateFlatSize() >
+          coalesceBytes_) {
+        return false;
+      }
+      const auto oldSize = back->size();
+      const auto newSize = oldSize + input->size();
+      if (!backIsCopy_) {
+        auto copy =
+            BaseVector::create<RowVector>(back->type(), newSize, input->pool());
+        copy->copy(back.get(), 0, 0, oldSize);
+        back = std::move(copy);
+        backIsCopy_ = true;
+      } else {
+        back->resize(newSize);
+      }
+      back->copy(input.get(), oldSize, 0, input->size());
+      return true;
+    }
+
     void notifyConsumers() {
       for (auto& promise : consumerPromises_) {
         promise.setValue();
@@ -105,7 +138,11 @@ class LocalMergeSource : public MergeSource {
       producerPromises_.clear();
     }
 
+    const uint64_t coalesceBytes_;
     bool atEnd_{false};
+    // True if data_.back() is a copy owned by the queue and may grow in
+    // place.
+    bool backIsCopy_{false};
     boost::circular_buffer<RowVectorPtr> data_;
     std::vector<ContinuePromise> consumerPromises_;
     std::vector<ContinuePromise> producerPromises_;
@@ -120,9 +157,15 @@ class MergeExchangeSource : public MergeSource {
       MergeExchange* mergeExchange,
       const std::string& taskId,
       int destination,
+      int64_t maxQueuedBytes,
+      uint64_t coalesceBytes,
       memory::MemoryPool* FOLLY_NONNULL pool)
       : mergeExchange_(mergeExchange),
-        client_(std::make_unique<ExchangeClient>(destination, pool)) {
+        coalesceBytes_(coalesceBytes),
+        client_(std::make_unique<ExchangeClient>(
+            destination,
+            pool,
+            maxQueuedBytes)) {
     client_->addRemoteTaskId(taskId);
     client_->noMoreRemoteTasks();
   }
@@ -157,6 +200,23 @@ class MergeExchangeSource : public MergeSource {
           mergeExchange_->outputType(),
           &data);
 
+      // A page may contain many small batches. Combine these up to
+      // 'coalesceBytes_' so that the merge consumes fewer, larger
+      // vectors. 'data' was just deserialized and is uniquely owned, so
+      // it is safe to grow in place.
+      while (!inputStream_->atEnd() &&
+             data->estimateFlatSize() < coalesceBytes_) {
+        RowVectorPtr moreData;
+        VectorStreamGroup::read(
+            inputStream_.get(),
+            mergeExchange_->pool(),
+            mergeExchange_->outputType(),
+            &moreData);
+        const auto oldSize = data->size();
+        data->resize(oldSize + moreData->size());
+        data->copy(moreData.get(), oldSize, 0, moreData->size());
+      }
+
       auto lockedStats = mergeExchange_->stats().wlock();
       lockedStats->addInputVector(data->estimateFlatSize(), data->size());
     }
@@ -181,6 +241,7 @@ class MergeExchangeSource : public MergeSource {
 
  private:
   MergeExchange* const mergeExchange_;
+  const uint64_t coalesceBytes_;
   std::unique_ptr<ExchangeClient> client_;
   std::unique_ptr<ByteStream> inputStream_;
   std::unique_ptr<SerializedPage> currentPage_;
@@ -192,20 +253,23 @@ class MergeExchangeSource : public MergeSource {
 };
 } // namespace
 
-std::shared_ptr<MergeSource> MergeSource::createLocalMergeSource() {
+std::shared_ptr<MergeSource> MergeSource::createLocalMergeSource(
+    uint64_t coalesceBytes) {
   // Buffer up to 2 vectors from each source before blocking to wait
   // for consumers.
   static const int kDefaultQueueSize = 2;
-  return std::make_shared<LocalMergeSource>(kDefaultQueueSize);
+  return std::make_shared<LocalMergeSource>(kDefaultQueueSize, coalesceBytes);
 }
 
 std::shared_ptr<MergeSource> MergeSource::createMergeExchangeSource(
     MergeExchange* mergeExchange,
     const std::string& taskId,
     int destination,
+    int64_t maxQueuedBytes,
+    uint64_t coalesceBytes,
     memory::MemoryPool* pool) {
   return std::make_shared<MergeExchangeSource>(
-      mergeExchange, taskId, destination, pool);
+      mergeExchange, taskId, destination, maxQueuedBytes, coalesceBytes, pool);
 }
 
 namespace {
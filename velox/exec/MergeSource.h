@@ -33,13 +33,23 @@ class MergeSource {
 
   virtual void close() = 0;
 
-  // Factory methods to create MergeSources.
-  static std::shared_ptr<MergeSource> createLocalMergeSource();
-
+  // Factory methods to create MergeSources. 'coalesceBytes' is the
+  // target size to combine small incoming batches into before the merge
+  // consumes them; many tiny batches otherwise cost the merge a queue
+  // operation per few rows.
+  static std::shared_ptr<MergeSource> createLocalMergeSource(
+      uint64_t coalesceBytes);
+
+  /// 'maxQueuedBytes' caps the bytes buffered from the remote source. The
+  /// source requests at most this many bytes at a time and stops requesting
+  /// while the buffered size exceeds it, so a merge over many sorted
+  /// partitions holds only a few batches per source.
   static std::shared_ptr<MergeSource> createMergeExchangeSource(
       MergeExchange* mergeExchange,
       const std::string& taskId,
       int destination,
+      int64_t maxQueuedBytes,
+      uint64_t coalesceBytes,
       memory::MemoryPool* FOLLY_NONNULL pool);
 };
 
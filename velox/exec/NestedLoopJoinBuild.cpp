@@ -15,6 +15,7 @@
  */
 #include "velox/exec/NestedLoopJoinBuild.h"
 #include "velox/exec/Task.h"
+#include "velox/vector/FlatVector.h"
 
 namespace facebook::velox::exec {
 
@@ -58,6 +59,17 @@ void NestedLoopJoinBuild::addInput(RowVectorPtr input) {
     for (auto& child : input->children()) {
       child->loadedVector();
     }
+    // The build vectors stay alive for the duration of the join. A heavily
+    // filtered input may reference only a small fraction of the bytes in its
+    // string buffers; rewrite such strings into right-sized buffers instead
+    // of pinning the originals.
+    for (auto& child : input->children()) {
+      if (child->encoding() == VectorEncoding::Simple::FLAT &&
+          (child->typeKind() == TypeKind::VARCHAR ||
+           child->typeKind() == TypeKind::VARBINARY)) {
+        child->asUnchecked<FlatVector<StringView>>()->compactStringBuffers();
+      }
+    }
     dataVectors_.emplace_back(std::move(input));
   }
 }
@@ -55,6 +55,8 @@ NestedLoopJoinProbe::NestedLoopJoinProbe(
           joinNode->id(),
           "NestedLoopJoinProbe"),
       outputBatchSize_{outputBatchRows()},
+      filterBatchSize_{
+          driverCtx->queryConfig().nestedLoopJoinFilterBatchRows()},
       joinType_(joinNode->joinType()) {
   auto probeType = joinNode->sources()[0]->outputType();
   auto buildType = joinNode->sources()[1]->outputType();
@@ -325,13 +327,18 @@ vector_size_t NestedLoopJoinProbe::getNumProbeRows() const {
   VELOX_CHECK(!hasProbedAllBuildData());
 
   const auto inputSize = input_->size();
+  // With a join condition the cross product is only an intermediate batch of
+  // candidates for the condition to filter, so it is sized independently of
+  // the output batch to amortize the per-evaluation overhead.
+  const auto batchSize =
+      joinCondition_ != nullptr ? filterBatchSize_ : outputBatchSize_;
   auto numBuildRows = buildVectors_.value()[buildIndex_]->size();
   vector_size_t numProbeRows;
-  if (numBuildRows > outputBatchSize_) {
+  if (numBuildRows > batchSize) {
     numProbeRows = 1;
   } else {
     numProbeRows = std::min(
-        (vector_size_t)outputBatchSize_ / numBuildRows, inputSize - probeRow_);
+        (vector_size_t)batchSize / numBuildRows, inputSize - probeRow_);
   }
   return numProbeRows;
 }
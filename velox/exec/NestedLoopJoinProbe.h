@@ -57,7 +57,8 @@ class NestedLoopJoinProbe : public Operator {
   bool getBuildData(ContinueFuture* future);
 
   // Calculates the number of probe rows to match with the build side vectors
-  // given the output batch size limit.
+  // given the output batch size limit, or the filter batch size when there is
+  // a join condition.
   vector_size_t getNumProbeRows() const;
 
   // Generates cross product of next 'probeCnt' rows of input_, and all rows of
@@ -121,6 +122,9 @@ class NestedLoopJoinProbe : public Operator {
  private:
   // Maximum number of rows in the output batch.
   const uint32_t outputBatchSize_;
+  // Number of probe x build candidate rows to evaluate the join condition on
+  // at a time. Only used when there is a join condition.
+  const uint32_t filterBatchSize_;
   const core::JoinType joinType_;
 
   ProbeOperatorState state_{ProbeOperatorState::kWaitForBuild};
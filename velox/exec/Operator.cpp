@@ -16,12 +16,26 @@
 #include "velox/exec/Operator.h"
 #include "velox/common/base/SuccinctPrinter.h"
 #include "velox/common/process/ProcessBase.h"
+#include "velox/common/time/Timer.h"
 #include "velox/exec/Driver.h"
 #include "velox/exec/HashJoinBridge.h"
 #include "velox/exec/OperatorUtils.h"
 #include "velox/exec/Task.h"
 #include "velox/expression/Expr.h"
 
+#include <folly/chrono/Hardware.h>
+
+#include <unordered_set>
+
+#include "velox/common/base/StatsReporter.h"
+
+DEFINE_int32(
+    velox_operator_cycle_sampling_rate,
+    0,
+    "Sample one in this many Operator::addInput/getOutput calls per thread "
+    "with the CPU cycle counter and export per-operator-type histograms "
+    "through StatsReporter. Zero disables sampling.");
+
 namespace facebook::velox::exec {
 
 OperatorCtx::OperatorCtx(
@@ -38,7 +52,9 @@ OperatorCtx::OperatorCtx(
 core::ExecCtx* OperatorCtx::execCtx() const {
   if (!execCtx_) {
     execCtx_ = std::make_unique<core::ExecCtx>(
-        pool_, driverCtx_->task->queryCtx().get());
+        pool_,
+        driverCtx_->task->queryCtx().get(),
+        driverCtx_->vectorPool.get());
   }
   return execCtx_.get();
 }
@@ -57,7 +73,8 @@ OperatorCtx::createConnectorQueryCtx(
       driverCtx_->task->queryCtx()->allocator(),
       taskId(),
       planNodeId,
-      driverCtx_->driverId);
+      driverCtx_->driverId,
+      driverCtx_->task->queryCtx()->stringAlphabetInterner());
 }
 
 Operator::Operator(
@@ -251,6 +268,24 @@ uint32_t Operator::outputBatchRows(
       queryConfig.preferredOutputBatchBytes() / rowSize, 1);
 }
 
+uint32_t Operator::adaptiveOutputBatchRows() const {
+  // Number of output rows to observe before trusting the measured average row
+  // size.
+  static constexpr uint64_t kMinMeasuredRows = 1'000;
+
+  uint64_t outputBytes;
+  uint64_t outputPositions;
+  {
+    const auto lockedStats = stats_.rlock();
+    outputBytes = lockedStats->outputBytes;
+    outputPositions = lockedStats->outputPositions;
+  }
+  if (outputPositions < kMinMeasuredRows) {
+    return outputBatchRows();
+  }
+  return outputBatchRows(std::max<uint64_t>(outputBytes / outputPositions, 1));
+}
+
 void Operator::recordBlockingTime(uint64_t start, BlockingReason reason) {
   uint64_t now =
       std::chrono::duration_cast<std::chrono::microseconds>(
@@ -259,6 +294,17 @@ void Operator::recordBlockingTime(uint64_t start, BlockingReason reason) {
   const auto wallNanos = (now - start) * 1000;
   const auto blockReason = blockingReasonToString(reason).substr(1);
 
+  if (auto* tracer = operatorCtx_->task()->tracer()) {
+    const auto* driverCtx = operatorCtx_->driverCtx();
+    tracer->addSlice(
+        driverCtx->pipelineId,
+        driverCtx->driverId,
+        fmt::format("{}: blocked {}", operatorType(), blockReason),
+        "blocked",
+        start,
+        now);
+  }
+
   auto lockedStats = stats_.wlock();
   lockedStats->blockedWallNanos += wallNanos;
   lockedStats->addRuntimeStat(
@@ -268,6 +314,26 @@ void Operator::recordBlockingTime(uint64_t start, BlockingReason reason) {
       fmt::format("blocked{}Times", blockReason), RuntimeCounter(1));
 }
 
+void Operator::addSpillTraceEvent(
+    uint64_t spilledBytes,
+    uint64_t spilledRows) {
+  auto* tracer = operatorCtx_->task()->tracer();
+  if (tracer == nullptr) {
+    return;
+  }
+  const auto* driverCtx = operatorCtx_->driverCtx();
+  tracer->addInstant(
+      driverCtx->pipelineId,
+      driverCtx->driverId,
+      fmt::format(
+          "{}: spilled {} bytes, {} rows",
+          operatorType(),
+          spilledBytes,
+          spilledRows),
+      "spill",
+      getCurrentTimeMicro());
+}
+
 std::string Operator::toString() const {
   std::stringstream out;
   if (auto task = operatorCtx_->task()) {
@@ -473,4 +539,63 @@ void Operator::MemoryReclaimer::abort(memory::MemoryPool* pool) {
   // Calls operator close to free up major memory usage.
   op_->close();
 }
+namespace {
+// Registers the histograms for a sampled metric key on first use. Keys are
+// derived from operator types, so the set stays small.
+void ensureHistogramRegistered(
+    const std::string& key,
+    int64_t bucketWidth,
+    int64_t max) {
+  static folly::Synchronized<std::unordered_set<std::string>> registered;
+  if (registered.rlock()->count(key)) {
+    return;
+  }
+  auto locked = registered.wlock();
+  if (locked->insert(key).second) {
+    REPORT_ADD_HISTOGRAM_EXPORT_PERCENTILE(
+        key, bucketWidth, 0, max, 50, 90, 99, 100);
+  }
+}
+
+void reportCycleSample(
+    const std::string& operatorType,
+    const char* method,
+    uint64_t cycles,
+    vector_size_t numRows) {
+  auto cyclesKey = fmt::format(
+      "velox.operator.{}.{}_cycles_per_row", operatorType, method);
+  auto rowsKey =
+      fmt::format("velox.operator.{}.{}_batch_rows", operatorType, method);
+  // Track up to 1M cycles per row; slower calls land in the last bucket.
+  ensureHistogramRegistered(cyclesKey, 100, 1'000'000);
+  ensureHistogramRegistered(rowsKey, 100, 100'000);
+  REPORT_ADD_HISTOGRAM_VALUE(
+      cyclesKey, cycles / std::max<uint64_t>(1, numRows));
+  REPORT_ADD_HISTOGRAM_VALUE(rowsKey, numRows);
+}
+} // namespace
+
+OperatorCycleSampler::OperatorCycleSampler(
+    const Operator& op,
+    const char* method)
+    : op_(op), method_(method) {
+  if (FOLLY_LIKELY(FLAGS_velox_operator_cycle_sampling_rate == 0)) {
+    return;
+  }
+  thread_local uint64_t callCount = 0;
+  if (++callCount % FLAGS_velox_operator_cycle_sampling_rate != 0) {
+    return;
+  }
+  active_ = true;
+  start_ = folly::hardware_timestamp();
+}
+
+OperatorCycleSampler::~OperatorCycleSampler() {
+  if (FOLLY_LIKELY(!active_)) {
+    return;
+  }
+  const auto cycles = folly::hardware_timestamp() - start_;
+  reportCycleSample(op_.operatorType(), method_, cycles, numRows_);
+}
+
 } // namespace facebook::velox::exec
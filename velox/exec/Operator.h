@@ -363,6 +363,29 @@ class Operator : public BaseRuntimeStatWriter {
         toString());
   }
 
+  // Returns the number of rows 'this' still needs from its source
+  // before it is finished, if known. A Limit returns its remaining
+  // offset plus count. Used to cap the batch size of an upstream table
+  // scan so that the tail of a short query does not decode surplus
+  // rows.
+  virtual std::optional<int64_t> remainingRowBudget() const {
+    return std::nullopt;
+  }
+
+  // Returns true if this operator would accept a row budget produced by a
+  // downstream operator.
+  virtual bool canAddRowBudget() const {
+    return false;
+  }
+
+  // Caps the number of rows produced in one output batch at 'numRows'.
+  // Called with decreasing values as the downstream operator consumes rows
+  // and only if canAddRowBudget() returns true.
+  virtual void addRowBudget(int64_t /*numRows*/) {
+    VELOX_UNSUPPORTED(
+        "This operator doesn't support row budget pushdown: {}", toString());
+  }
+
   // Returns a list of identify projections, e.g. columns that are projected
   // as-is possibly after applying a filter.
   const std::vector<IdentityProjection>& identityProjections() const {
@@ -406,6 +429,11 @@ class Operator : public BaseRuntimeStatWriter {
 
   void recordBlockingTime(uint64_t start, BlockingReason reason);
 
+  /// Adds a spill event to the task's execution trace if tracing is
+  /// enabled. Called by spilling operators when they record their spill
+  /// stats.
+  void addSpillTraceEvent(uint64_t spilledBytes, uint64_t spilledRows);
+
   virtual std::string toString() const;
 
   velox::memory::MemoryPool* pool() const {
@@ -574,6 +602,14 @@ class Operator : public BaseRuntimeStatWriter {
   uint32_t outputBatchRows(
       std::optional<uint64_t> averageRowSize = std::nullopt) const;
 
+  /// Returns the number of rows for the output batch using the average output
+  /// row size measured from this operator's stats. This adapts the batch size
+  /// to the actual output row width: fewer rows for wide rows and more rows
+  /// for narrow ones, targeting preferredOutputBatchBytes. Returns
+  /// outputBatchRows() until the operator has produced enough output for the
+  /// measured average to be meaningful.
+  uint32_t adaptiveOutputBatchRows() const;
+
   const std::unique_ptr<OperatorCtx> operatorCtx_;
   const RowTypePtr outputType_;
   // Contains the disk spilling related configs if spilling is enabled (e.g.
@@ -652,4 +688,33 @@ class SourceOperator : public Operator {
   }
 };
 
+/// Scoped sampler of cycle-accurate timings of Operator::addInput() and
+/// Operator::getOutput() calls. When sampling is enabled via the
+/// --velox_operator_cycle_sampling_rate flag, every N-th call per thread is
+/// timed with the CPU cycle counter (rdtsc on x86) and exported through
+/// StatsReporter as per-operator-type histograms of cycles per row and batch
+/// row counts. When sampling is disabled (the default), the cost is a single
+/// thread-local counter check.
+class OperatorCycleSampler {
+ public:
+  /// 'method' names the sampled call in the exported histogram keys, e.g.
+  /// "add_input" or "get_output". Must outlive 'this'.
+  OperatorCycleSampler(const Operator& op, const char* method);
+
+  ~OperatorCycleSampler();
+
+  /// Sets the number of rows in the batch processed by the sampled call.
+  /// Cycles are reported per row.
+  void setNumRows(vector_size_t numRows) {
+    numRows_ = numRows;
+  }
+
+ private:
+  const Operator& op_;
+  const char* method_;
+  vector_size_t numRows_{0};
+  uint64_t start_{0};
+  bool active_{false};
+};
+
 } // namespace facebook::velox::exec
@@ -27,6 +27,85 @@ namespace {
 CompareFlags fromSortOrderToCompareFlags(const core::SortOrder& sortOrder) {
   return {sortOrder.isNullsFirst(), sortOrder.isAscending(), false, false};
 }
+
+// Computes the 64-bit sortable prefixes of the first sort key. The prefixes
+// are built so that comparing them as unsigned integers gives the same order
+// as comparing the key values with 'flags'. A null maps to the smallest or
+// the largest prefix depending on 'flags.nullsFirst', so a null's prefix can
+// collide with an extreme value's prefix; ties are resolved by the full row
+// compare.
+template <TypeKind Kind>
+void makeKeyPrefixesTyped(
+    const VectorPtr& keyVector,
+    const CompareFlags& flags,
+    std::vector<std::pair<uint64_t, char*>>& prefixedRows) {
+  using T = typename TypeTraits<Kind>::NativeType;
+  constexpr uint64_t kSignBit = 1ULL << 63;
+  auto* flatKeys = keyVector->asUnchecked<FlatVector<T>>();
+  const uint64_t nullPrefix = flags.nullsFirst ? 0 : ~0ULL;
+  for (size_t i = 0; i < prefixedRows.size(); ++i) {
+    if (flatKeys->isNullAt(i)) {
+      prefixedRows[i].first = nullPrefix;
+      continue;
+    }
+    int64_t value;
+    if constexpr (std::is_same_v<T, Date>) {
+      value = flatKeys->valueAt(i).days();
+    } else {
+      value = static_cast<int64_t>(flatKeys->valueAt(i));
+    }
+    // Flipping the sign bit makes the unsigned order of the bits match the
+    // signed order of the values.
+    uint64_t prefix = static_cast<uint64_t>(value) ^ kSignBit;
+    prefixedRows[i].first = flags.ascending ? prefix : ~prefix;
+  }
+}
+
+// Minimum number of rows for which a radix sort beats std::sort on the
+// prefixes. Below this the extra counting passes do not pay off.
+constexpr size_t kRadixSortMinRows = 1 << 10;
+
+// Stable LSD radix sort of 'prefixedRows' on the 64-bit prefix, one byte at
+// a time. Builds the histograms of all 8 digits in a single pass over the
+// data and skips the passes where all prefixes share the same digit, so
+// narrow keys, e.g. dates, cost only as many passes as they have distinct
+// bytes.
+void radixSortPrefixedRows(
+    std::vector<std::pair<uint64_t, char*>>& prefixedRows) {
+  constexpr int32_t kNumPasses = 8;
+  constexpr int32_t kNumBuckets = 256;
+  std::array<std::array<uint32_t, kNumBuckets>, kNumPasses> counts{};
+  for (const auto& entry : prefixedRows) {
+    for (int32_t pass = 0; pass < kNumPasses; ++pass) {
+      ++counts[pass][(entry.first >> (pass * 8)) & 0xff];
+    }
+  }
+
+  std::vector<std::pair<uint64_t, char*>> scratch(prefixedRows.size());
+  auto* source = &prefixedRows;
+  auto* target = &scratch;
+  for (int32_t pass = 0; pass < kNumPasses; ++pass) {
+    auto& count = counts[pass];
+    const int32_t shift = pass * 8;
+    if (count[((*source)[0].first >> shift) & 0xff] == prefixedRows.size()) {
+      // All prefixes have the same byte in this position.
+      continue;
+    }
+    uint32_t offset = 0;
+    for (auto& bucket : count) {
+      const auto size = bucket;
+      bucket = offset;
+      offset += size;
+    }
+    for (const auto& entry : *source) {
+      (*target)[count[(entry.first >> shift) & 0xff]++] = entry;
+    }
+    std::swap(source, target);
+  }
+  if (source != &prefixedRows) {
+    prefixedRows.swap(scratch);
+  }
+}
 } // namespace
 
 OrderBy::OrderBy(
@@ -120,9 +199,32 @@ void OrderBy::addInput(RowVectorPtr input) {
     }
   }
 
+  if (inputSorted_) {
+    // Track whether the input keeps arriving in sort order. The check stops
+    // paying after the first out-of-order row.
+    for (int i = 0; i < input->size(); ++i) {
+      if (lastInputRow_ != nullptr && rowsOutOfOrder(lastInputRow_, rows[i])) {
+        inputSorted_ = false;
+        lastInputRow_ = nullptr;
+        break;
+      }
+      lastInputRow_ = rows[i];
+    }
+  }
+
   numRows_ += allRows.size();
 }
 
+bool OrderBy::rowsOutOfOrder(const char* leftRow, const char* rightRow) const {
+  for (vector_size_t index = 0; index < numSortKeys_; ++index) {
+    if (auto result =
+            data_->compare(leftRow, rightRow, index, keyCompareFlags_[index])) {
+      return result > 0;
+    }
+  }
+  return false;
+}
+
 void OrderBy::ensureInputFits(const RowVectorPtr& input) {
   // Check if spilling is enabled or not.
   if (!spillConfig_.has_value()) {
@@ -243,10 +345,16 @@ void OrderBy::spill(int64_t targetRows, int64_t targetBytes) {
         spillConfig.filePath,
         spillConfig.maxFileSize,
         spillConfig.minSpillRunSize,
+        spillConfig.compressionCodec,
         Spiller::spillPool(),
         spillConfig.executor);
     VELOX_CHECK_EQ(spiller_->state().maxPartitions(), 1);
   }
+  // Spilled rows come back in sort order from the spill merge, so the
+  // arrival order no longer matters; 'lastInputRow_' may also have been
+  // erased from 'data_'.
+  inputSorted_ = false;
+  lastInputRow_ = nullptr;
   spiller_->spill(targetRows, targetBytes);
 }
 
@@ -266,19 +374,13 @@ void OrderBy::noMoreInput() {
     returningRows_.resize(numRows_);
     RowContainerIterator iter;
     data_->listRows(&iter, numRows_, returningRows_.data());
-    std::sort(
-        returningRows_.begin(),
-        returningRows_.end(),
-        [this](const char* leftRow, const char* rightRow) {
-          for (vector_size_t index = 0; index < numSortKeys_; ++index) {
-            if (auto result = data_->compare(
-                    leftRow, rightRow, index, keyCompareFlags_[index])) {
-              return result < 0;
-            }
-          }
-          return false;
-        });
-
+    if (inputSorted_) {
+      // The rows arrived in sort order and listRows returns them in arrival
+      // order, so there is nothing to sort.
+      addRuntimeStat("sortSkippedOnOrderedInput", RuntimeCounter(1));
+    } else {
+      sortReturningRows();
+    }
   } else {
     // Finish spill, and we shouldn't get any rows from non-spilled partition as
     // there is only one hash partition for orderBy operator.
@@ -293,6 +395,116 @@ void OrderBy::noMoreInput() {
   }
 }
 
+void OrderBy::sortReturningRows() {
+  auto compareRows = [this](const char* leftRow, const char* rightRow) {
+    for (vector_size_t index = 0; index < numSortKeys_; ++index) {
+      if (auto result = data_->compare(
+              leftRow, rightRow, index, keyCompareFlags_[index])) {
+        return result < 0;
+      }
+    }
+    return false;
+  };
+
+  std::vector<std::pair<uint64_t, char*>> prefixedRows;
+  if (!makeKeyPrefixes(prefixedRows)) {
+    std::sort(returningRows_.begin(), returningRows_.end(), compareRows);
+    return;
+  }
+
+  if (numSortKeys_ == 1 && numRows_ >= kRadixSortMinRows) {
+    // With a single key the prefixes determine the order except that nulls
+    // share their prefix with the extreme key value. Radix sort on the
+    // prefixes, then re-sort the run of rows with the null prefix.
+    radixSortPrefixedRows(prefixedRows);
+    const uint64_t nullPrefix = keyCompareFlags_[0].nullsFirst ? 0 : ~0ULL;
+    auto runBegin = std::lower_bound(
+        prefixedRows.begin(),
+        prefixedRows.end(),
+        nullPrefix,
+        [](const auto& entry, uint64_t prefix) { return entry.first < prefix; });
+    auto runEnd = std::upper_bound(
+        runBegin,
+        prefixedRows.end(),
+        nullPrefix,
+        [](uint64_t prefix, const auto& entry) { return prefix < entry.first; });
+    if (runEnd - runBegin > 1) {
+      std::sort(runBegin, runEnd, [&](const auto& left, const auto& right) {
+        return compareRows(left.second, right.second);
+      });
+    }
+  } else {
+    // Sort on the prefixes and fall back to comparing the rows in 'data_'
+    // only when the prefixes tie. The comparisons in the hot loop are then
+    // plain integer compares without per-key null checks or type dispatch.
+    std::sort(
+        prefixedRows.begin(),
+        prefixedRows.end(),
+        [&](const auto& left, const auto& right) {
+          if (left.first != right.first) {
+            return left.first < right.first;
+          }
+          return compareRows(left.second, right.second);
+        });
+  }
+  for (size_t i = 0; i < prefixedRows.size(); ++i) {
+    returningRows_[i] = prefixedRows[i].second;
+  }
+}
+
+bool OrderBy::makeKeyPrefixes(
+    std::vector<std::pair<uint64_t, char*>>& prefixedRows) {
+  const auto& keyType = data_->keyTypes()[0];
+  switch (keyType->kind()) {
+    case TypeKind::BOOLEAN:
+    case TypeKind::TINYINT:
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+    case TypeKind::DATE:
+      break;
+    default:
+      return false;
+  }
+
+  prefixedRows.resize(numRows_);
+  for (size_t i = 0; i < numRows_; ++i) {
+    prefixedRows[i].second = returningRows_[i];
+  }
+
+  auto keyVector = BaseVector::create(keyType, numRows_, pool());
+  data_->extractColumn(returningRows_.data(), numRows_, 0, keyVector);
+  switch (keyType->kind()) {
+    case TypeKind::BOOLEAN:
+      makeKeyPrefixesTyped<TypeKind::BOOLEAN>(
+          keyVector, keyCompareFlags_[0], prefixedRows);
+      break;
+    case TypeKind::TINYINT:
+      makeKeyPrefixesTyped<TypeKind::TINYINT>(
+          keyVector, keyCompareFlags_[0], prefixedRows);
+      break;
+    case TypeKind::SMALLINT:
+      makeKeyPrefixesTyped<TypeKind::SMALLINT>(
+          keyVector, keyCompareFlags_[0], prefixedRows);
+      break;
+    case TypeKind::INTEGER:
+      makeKeyPrefixesTyped<TypeKind::INTEGER>(
+          keyVector, keyCompareFlags_[0], prefixedRows);
+      break;
+    case TypeKind::BIGINT:
+      makeKeyPrefixesTyped<TypeKind::BIGINT>(
+          keyVector, keyCompareFlags_[0], prefixedRows);
+      break;
+    case TypeKind::DATE:
+      makeKeyPrefixesTyped<TypeKind::DATE>(
+          keyVector, keyCompareFlags_[0], prefixedRows);
+      break;
+    default:
+      VELOX_UNREACHABLE();
+  }
+  return true;
+}
+
 void OrderBy::recordSpillStats() {
   VELOX_CHECK_NOT_NULL(spiller_);
   VELOX_CHECK(noMoreInput_);
@@ -304,6 +516,8 @@ void OrderBy::recordSpillStats() {
   lockedStats->spilledPartitions = spillStats.spilledPartitions;
   lockedStats->spilledFiles = spillStats.spilledFiles;
   VELOX_DCHECK_LE(lockedStats->spilledPartitions, 1);
+  lockedStats.unlock();
+  addSpillTraceEvent(spillStats.spilledBytes, spillStats.spilledRows);
 }
 
 RowVectorPtr OrderBy::getOutput() {
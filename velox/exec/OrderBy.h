@@ -70,6 +70,22 @@ class OrderBy : public Operator {
   // remaining rows to return.
   void prepareOutput();
 
+  // Sorts 'returningRows_'. If the first sort key has a type that can be
+  // encoded into a 64-bit memcmp-able prefix, sorts on the prefixes and falls
+  // back to RowContainer::compare only on prefix ties; with a single sort key
+  // and enough rows the prefixes are sorted with an LSD radix sort instead of
+  // std::sort. Other key types compare whole rows.
+  void sortReturningRows();
+
+  // Fills 'prefixedRows' with a 64-bit sortable prefix of the first sort key
+  // and the row pointer for each row of 'returningRows_'. Returns false if
+  // the first key's type does not support prefix encoding.
+  bool makeKeyPrefixes(std::vector<std::pair<uint64_t, char*>>& prefixedRows);
+
+  // Returns true if 'leftRow' orders strictly after 'rightRow' on the sort
+  // keys.
+  bool rowsOutOfOrder(const char* leftRow, const char* rightRow) const;
+
   void getOutputWithoutSpill();
   void getOutputWithSpill();
 
@@ -118,6 +134,16 @@ class OrderBy : public Operator {
   // Used to collect sorted rows from 'data_' on non-spilling output path.
   std::vector<char*> returningRows_;
 
+  // True while the input rows have arrived in sort order, e.g. read from
+  // time-sorted files. Cleared on the first out-of-order row or when
+  // spilling; if still set at noMoreInput the sort is skipped.
+  bool inputSorted_ = true;
+
+  // The last row stored by addInput, used to check the sort order across
+  // input batch boundaries. nullptr before the first input and after the
+  // order check has been abandoned.
+  char* FOLLY_NULLABLE lastInputRow_ = nullptr;
+
   std::unique_ptr<Spiller> spiller_;
 
   // Counts input batches and triggers spilling if folly hash of this % 100 <=
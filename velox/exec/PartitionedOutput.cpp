@@ -15,9 +15,28 @@
  */
 
 #include "velox/exec/PartitionedOutput.h"
+#include <folly/String.h>
 #include "velox/exec/PartitionedOutputBufferManager.h"
+#include "velox/serializers/PrestoSerializer.h"
 
 namespace facebook::velox::exec {
+namespace {
+// Maps the 'exchange_compression_codec' query config value to a codec type.
+folly::io::CodecType exchangeCompressionCodecType(const std::string& codec) {
+  std::string lowerCodec = codec;
+  folly::toLowerAscii(lowerCodec);
+  if (lowerCodec == "none") {
+    return folly::io::CodecType::NO_COMPRESSION;
+  }
+  if (lowerCodec == "lz4") {
+    return folly::io::CodecType::LZ4;
+  }
+  if (lowerCodec == "zstd") {
+    return folly::io::CodecType::ZSTD;
+  }
+  VELOX_USER_FAIL("Unsupported exchange compression codec: {}", codec);
+}
+} // namespace
 
 BlockingReason Destination::advance(
     uint64_t maxBytes,
@@ -65,32 +84,55 @@ void Destination::serialize(
     vector_size_t end) {
   if (!current_) {
     current_ = std::make_unique<VectorStreamGroup>(pool_);
+  }
+  if (!current_->hasStreamTree()) {
     auto rowType = std::dynamic_pointer_cast<const RowType>(output->type());
     vector_size_t numRows = 0;
     for (vector_size_t i = begin; i < end; i++) {
       numRows += rows_[i].size;
     }
-    current_->createStreamTree(rowType, numRows);
+    current_->createStreamTree(rowType, numRows, serdeOptions_);
   }
   current_->append(output, folly::Range(&rows_[begin], end - begin));
 }
 
+std::shared_ptr<StreamArena> Destination::pageArena() {
+  for (auto& arena : pageArenas_) {
+    if (arena.use_count() == 1) {
+      // The consumer has freed all IOBufs referencing this arena, so
+      // its memory can back the next page. Only 'this' adds references,
+      // so the count cannot go back up concurrently.
+      arena->clear();
+      return arena;
+    }
+  }
+  if (pageArenas_.size() < kMaxPageArenas) {
+    pageArenas_.push_back(std::make_shared<StreamArena>(pool_));
+    return pageArenas_.back();
+  }
+  // More pages in flight than retained arenas. Serialize into a
+  // one-off arena that is freed when the consumer acknowledges.
+  return std::make_shared<StreamArena>(pool_);
+}
+
 BlockingReason Destination::flush(
     PartitionedOutputBufferManager& bufferManager,
     const std::function<void()>& bufferReleaseFn,
     ContinueFuture* future) {
-  if (!current_) {
+  if (!current_ || !current_->hasStreamTree()) {
     return BlockingReason::kNotBlocked;
   }
   // Upper limit of message size with no columns.
   constexpr int32_t kMinMessageSize = 128;
   auto listener = bufferManager.newListener();
   IOBufOutputStream stream(
-      *current_->pool(),
+      pageArena(),
       listener.get(),
       std::max<int64_t>(kMinMessageSize, current_->size()));
   current_->flush(&stream);
-  current_.reset();
+  // Keep 'current_' and recycle its arena memory for the next batch to
+  // this destination.
+  current_->clear();
   bytesInCurrent_ = 0;
   setTargetSizePct();
 
@@ -130,7 +172,14 @@ PartitionedOutput::PartitionedOutput(
       bufferReleaseFn_([task = operatorCtx_->task()]() {}),
       maxBufferedBytes_(ctx->task->queryCtx()
                             ->queryConfig()
-                            .maxPartitionedOutputBufferSize()) {
+                            .maxPartitionedOutputBufferSize()),
+      serdeOptions_(
+          std::make_unique<serializer::presto::PrestoVectorSerde::
+                               PrestoOptions>(
+              false,
+              exchangeCompressionCodecType(ctx->task->queryCtx()
+                                               ->queryConfig()
+                                               .exchangeCompressionCodec()))) {
   if (numDestinations_ == 1 || planNode->isBroadcast()) {
     VELOX_CHECK(keyChannels_.empty());
     VELOX_CHECK_NULL(partitionFunction_);
@@ -162,7 +211,8 @@ void PartitionedOutput::initializeDestinations() {
   if (destinations_.empty()) {
     auto taskId = operatorCtx_->taskId();
     for (int i = 0; i < numDestinations_; ++i) {
-      destinations_.push_back(std::make_unique<Destination>(taskId, i, pool()));
+      destinations_.push_back(std::make_unique<Destination>(
+          taskId, i, pool(), serdeOptions_.get()));
     }
   }
 }
@@ -241,8 +291,31 @@ void PartitionedOutput::addInput(RowVectorPtr input) {
         }
       }
     } else {
+      // Two-pass scatter: count the rows per destination first so that each
+      // destination's row list is allocated exactly once, then append.
+      // Consecutive rows with the same destination are coalesced into a
+      // single range, which also reduces the number of ranges the serializer
+      // has to visit.
+      rowsPerDestination_.resize(numDestinations_);
+      std::fill(rowsPerDestination_.begin(), rowsPerDestination_.end(), 0);
       for (vector_size_t i = 0; i < numInput; ++i) {
-        destinations_[partitions_[i]]->addRow(i);
+        ++rowsPerDestination_[partitions_[i]];
+      }
+      for (auto i = 0; i < numDestinations_; ++i) {
+        if (rowsPerDestination_[i] > 0) {
+          destinations_[i]->reserveRanges(rowsPerDestination_[i]);
+        }
+      }
+
+      vector_size_t begin = 0;
+      while (begin < numInput) {
+        const auto partition = partitions_[begin];
+        vector_size_t end = begin + 1;
+        while (end < numInput && partitions_[end] == partition) {
+          ++end;
+        }
+        destinations_[partition]->addRows(IndexRange{begin, end - begin});
+        begin = end;
       }
     }
   }
@@ -27,8 +27,12 @@ class Destination {
   Destination(
       const std::string& taskId,
       int destination,
-      memory::MemoryPool* FOLLY_NONNULL pool)
-      : taskId_(taskId), destination_(destination), pool_(pool) {
+      memory::MemoryPool* FOLLY_NONNULL pool,
+      const VectorSerde::Options* FOLLY_NULLABLE serdeOptions)
+      : taskId_(taskId),
+        destination_(destination),
+        pool_(pool),
+        serdeOptions_(serdeOptions) {
     setTargetSizePct();
   }
 
@@ -46,6 +50,13 @@ class Destination {
     rows_.push_back(rows);
   }
 
+  // Reserves space for up to 'numRanges' more ranges. Used by the two-pass
+  // scatter in PartitionedOutput::addInput to allocate each destination's
+  // row list exactly once per batch.
+  void reserveRanges(vector_size_t numRanges) {
+    rows_.reserve(rows_.size() + numRanges);
+  }
+
   BlockingReason advance(
       uint64_t maxBytes,
       const std::vector<vector_size_t>& sizes,
@@ -73,9 +84,19 @@ class Destination {
   }
 
  private:
+  // Maximum number of page arenas kept for reuse. Pages past this many
+  // in flight to the consumer get a fresh arena that is freed on ack.
+  static constexpr int32_t kMaxPageArenas = 4;
+
   void
   serialize(const RowVectorPtr& input, vector_size_t begin, vector_size_t end);
 
+  // Returns an arena to serialize the next page into. Reuses an arena
+  // from 'pageArenas_' whose previous page has been acknowledged and
+  // freed by the consumer, so steady-state flushing recycles the same
+  // memory instead of allocating per page.
+  std::shared_ptr<StreamArena> pageArena();
+
   // Sets the next target size for flushing. This is called at the
   // start of each batch of output for the destination. The effect is
   // to make different destinations ready at slightly different times
@@ -92,12 +113,23 @@ class Destination {
   const std::string taskId_;
   const int destination_;
   memory::MemoryPool* FOLLY_NONNULL const pool_;
+
+  // Serialization options of the owning PartitionedOutput, e.g. the exchange
+  // compression codec. Owned by the operator which outlives 'this'.
+  const VectorSerde::Options* FOLLY_NULLABLE const serdeOptions_;
+
   uint64_t bytesInCurrent_{0};
   std::vector<IndexRange> rows_;
 
   // First row of 'rows_' that is not appended to 'current_'
   vector_size_t row_{0};
   std::unique_ptr<VectorStreamGroup> current_;
+
+  // Arenas holding the memory of flushed pages. An entry is reusable
+  // when the consumer has freed all IOBufs referencing it, i.e. 'this'
+  // holds the only reference.
+  std::vector<std::shared_ptr<StreamArena>> pageArenas_;
+
   bool finished_{false};
 
   // Flush accumulated data to buffer manager after reaching this
@@ -183,6 +215,10 @@ class PartitionedOutput : public Operator {
   const std::function<void()> bufferReleaseFn_;
   const int64_t maxBufferedBytes_;
 
+  // Options passed to the serializer of each destination, e.g. the exchange
+  // compression codec from the query config.
+  const std::unique_ptr<VectorSerde::Options> serdeOptions_;
+
   BlockingReason blockingReason_{BlockingReason::kNotBlocked};
   ContinueFuture future_;
   bool finished_{false};
@@ -200,6 +236,7 @@ class PartitionedOutput : public Operator {
   SelectivityVector rows_;
   SelectivityVector nullRows_;
   std::vector<uint32_t> partitions_;
+  std::vector<vector_size_t> rowsPerDestination_;
   std::vector<DecodedVector> decodedVectors_;
 };
 
@@ -669,6 +669,14 @@ PartitionedOutputBufferManager::getBufferIfExists(const std::string& taskId) {
   });
 }
 
+std::shared_ptr<Task> PartitionedOutputBufferManager::taskFor(
+    const std::string& taskId) {
+  if (auto buffer = getBufferIfExists(taskId)) {
+    return buffer->task();
+  }
+  return nullptr;
+}
+
 uint64_t PartitionedOutputBufferManager::numBuffers() const {
   return buffers_.lock()->size();
 }
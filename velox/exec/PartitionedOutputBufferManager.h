@@ -146,6 +146,14 @@ class PartitionedOutputBuffer {
     return kind_;
   }
 
+  /// Returns the producer task. The pages handed out by getData() reference
+  /// memory owned by the task's memory pools, so an in-process consumer that
+  /// keeps the pages without copying must keep the task alive until it is done
+  /// with them.
+  std::shared_ptr<Task> task() const {
+    return task_;
+  }
+
   /// The total number of output buffers may not be known at the task start
   /// time for broadcast and arbitrary output buffer type. This method can be
   /// called to update the total number of broadcast or arbitrary destinations
@@ -352,6 +360,10 @@ class PartitionedOutputBufferManager {
 
   void removeTask(const std::string& taskId);
 
+  /// Returns the producer task of 'taskId', nullptr if the task's buffers have
+  /// been deleted already. See PartitionedOutputBuffer::task().
+  std::shared_ptr<Task> taskFor(const std::string& taskId);
+
   static std::weak_ptr<PartitionedOutputBufferManager> getInstance();
 
   uint64_t numBuffers() const;
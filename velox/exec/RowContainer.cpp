@@ -91,6 +91,14 @@ void Accumulator::destroy(folly::Range<char**> groups) {
   destroyFunction_(groups);
 }
 
+int32_t RowContainer::stringInlineBytes(TypeKind kind) const {
+  if (stringInlineLimit_ > 0 &&
+      (kind == TypeKind::VARCHAR || kind == TypeKind::VARBINARY)) {
+    return sizeof(HashStringAllocator::Header) + stringInlineLimit_;
+  }
+  return 0;
+}
+
 // static
 int32_t RowContainer::combineAlignments(int32_t a, int32_t b) {
   VELOX_CHECK_EQ(__builtin_popcount(a), 1, "Alignment can only be power of 2");
@@ -108,7 +116,8 @@ RowContainer::RowContainer(
     bool hasProbedFlag,
     bool hasNormalizedKeys,
     memory::MemoryPool* pool,
-    const RowSerde& serde)
+    const RowSerde& serde,
+    int32_t stringInlineLimit)
     : keyTypes_(keyTypes),
       nullableKeys_(nullableKeys),
       accumulators_(accumulators),
@@ -116,7 +125,8 @@ RowContainer::RowContainer(
       hasNormalizedKeys_(hasNormalizedKeys),
       rows_(pool),
       stringAllocator_(pool),
-      serde_(serde) {
+      serde_(serde),
+      stringInlineLimit_(stringInlineLimit) {
   // Compute the layout of the payload row.  The row has keys, null
   // flags, accumulators, dependent fields. All fields are fixed
   // width. If variable width data is referenced, this is done with
@@ -150,6 +160,7 @@ RowContainer::RowContainer(
     types_.push_back(type);
     offsets_.push_back(offset);
     offset += typeKindSize(type->kind());
+    offset += stringInlineBytes(type->kind());
     nullOffsets_.push_back(nullOffset);
     isVariableWidth |= !type->isFixedWidth();
     if (nullableKeys) {
@@ -199,6 +210,7 @@ RowContainer::RowContainer(
   for (auto& type : dependentTypes) {
     offsets_.push_back(offset);
     offset += typeKindSize(type->kind());
+    offset += stringInlineBytes(type->kind());
   }
   if (isVariableWidth) {
     rowSizeOffset_ = offset;
@@ -224,6 +236,7 @@ RowContainer::RowContainer(
       bits::setBit(initialNulls_.data(), i + aggregateNullOffset);
     }
   }
+  columnHasNulls_.resize(types_.size(), false);
   originalNormalizedKeySize_ = hasNormalizedKeys_
       ? bits::roundUp(sizeof(normalized_key_t), alignment_)
       : 0;
@@ -290,6 +303,7 @@ void RowContainer::eraseRows(folly::Range<char**> rows) {
 }
 
 void RowContainer::freeVariableWidthFields(folly::Range<char**> rows) {
+  std::vector<StringView> views;
   for (auto i = 0; i < types_.size(); ++i) {
     switch (typeKinds_[i]) {
       case TypeKind::VARCHAR:
@@ -298,14 +312,22 @@ void RowContainer::freeVariableWidthFields(folly::Range<char**> rows) {
       case TypeKind::ARRAY:
       case TypeKind::MAP: {
         auto column = columnAt(i);
+        views.clear();
+        views.reserve(rows.size());
         for (auto row : rows) {
           if (!isNullAt(row, column.nullByte(), column.nullMask())) {
-            StringView view = valueAt<StringView>(row, column.offset());
-            if (!view.isInline()) {
-              stringAllocator_.free(HashStringAllocator::headerOf(view.data()));
+            auto view = valueAt<StringView>(row, column.offset());
+            if (stringInlineLimit_ > 0 &&
+                isStringInRow(view, row, column.offset())) {
+              // Strings stored in the spare row bytes are freed with the
+              // row.
+              continue;
             }
+            views.push_back(view);
           }
         }
+        stringAllocator_.free(
+            folly::Range<const StringView*>(views.data(), views.size()));
       } break;
       default:;
     }
@@ -361,6 +383,9 @@ void RowContainer::store(
         offsets_[column]);
   } else {
     VELOX_DCHECK(column < keyTypes_.size() || accumulators_.empty());
+    if (decoded.mayHaveNulls()) {
+      columnHasNulls_[column] = true;
+    }
     auto rowColumn = rowColumns_[column];
     VELOX_DYNAMIC_TYPE_DISPATCH_ALL(
         storeWithNulls,
@@ -404,10 +429,13 @@ void RowContainer::extractString(
     return;
   }
   auto rawBuffer = values->getRawStringBufferWithSpace(value.size());
-  ByteStream stream;
-  HashStringAllocator::prepareRead(
-      HashStringAllocator::headerOf(value.data()), stream);
-  stream.readBytes(rawBuffer, value.size());
+  HashStringAllocator::StringPieceIterator pieces(value);
+  auto* target = rawBuffer;
+  while (!pieces.atEnd()) {
+    auto piece = pieces.next();
+    memcpy(target, piece.data(), piece.size());
+    target += piece.size();
+  }
   values->setNoCopy(index, StringView(rawBuffer, value.size()));
 }
 
@@ -437,9 +465,20 @@ int32_t RowContainer::compareStringAsc(
     StringView left,
     const DecodedVector& decoded,
     vector_size_t index) {
-  std::string storage;
-  return HashStringAllocator::contiguousString(left, storage)
-      .compare(decoded.valueAt<StringView>(index));
+  auto right = decoded.valueAt<StringView>(index);
+  // Compare piece by piece without copying 'left' out of the arena.
+  HashStringAllocator::StringPieceIterator pieces(left);
+  size_t rightOffset = 0;
+  while (!pieces.atEnd() && rightOffset < right.size()) {
+    auto piece = pieces.next();
+    auto compareSize = std::min(piece.size(), right.size() - rightOffset);
+    auto result = memcmp(piece.data(), right.data() + rightOffset, compareSize);
+    if (result != 0) {
+      return result;
+    }
+    rightOffset += compareSize;
+  }
+  return static_cast<int32_t>(left.size()) - static_cast<int32_t>(right.size());
 }
 
 // static
@@ -457,10 +496,34 @@ int RowContainer::compareComplexType(
 }
 
 int32_t RowContainer::compareStringAsc(StringView left, StringView right) {
-  std::string leftStorage;
-  std::string rightStorage;
-  return HashStringAllocator::contiguousString(left, leftStorage)
-      .compare(HashStringAllocator::contiguousString(right, rightStorage));
+  // Both strings may be multi-part. Compare the overlap of the current
+  // pieces until one side runs out.
+  HashStringAllocator::StringPieceIterator leftPieces(left);
+  HashStringAllocator::StringPieceIterator rightPieces(right);
+  folly::StringPiece leftView;
+  folly::StringPiece rightView;
+  for (;;) {
+    if (leftView.empty()) {
+      if (leftPieces.atEnd()) {
+        break;
+      }
+      leftView = leftPieces.next();
+    }
+    if (rightView.empty()) {
+      if (rightPieces.atEnd()) {
+        break;
+      }
+      rightView = rightPieces.next();
+    }
+    auto compareSize = std::min(leftView.size(), rightView.size());
+    auto result = memcmp(leftView.data(), rightView.data(), compareSize);
+    if (result != 0) {
+      return result;
+    }
+    leftView.advance(compareSize);
+    rightView.advance(compareSize);
+  }
+  return static_cast<int32_t>(left.size()) - static_cast<int32_t>(right.size());
 }
 
 int32_t RowContainer::compareComplexType(
@@ -522,7 +585,8 @@ void RowContainer::hash(
     folly::Range<char**> rows,
     bool mix,
     uint64_t* result) {
-  bool nullable = column >= keyTypes_.size() || nullableKeys_;
+  bool nullable =
+      (column >= keyTypes_.size() || nullableKeys_) && columnHasNulls_[column];
   VELOX_DYNAMIC_TYPE_DISPATCH(
       hashTyped,
       typeKinds_[column],
@@ -556,6 +620,7 @@ void RowContainer::clear() {
   normalizedKeySize_ = originalNormalizedKeySize_;
   numFreeRows_ = 0;
   firstFreeRow_ = nullptr;
+  std::fill(columnHasNulls_.begin(), columnHasNulls_.end(), false);
 }
 
 void RowContainer::setProbedFlag(char** rows, int32_t numRows) {
@@ -205,7 +205,11 @@ class RowContainer {
   // below each row for a normalized key that collapses all parts
   // into one word for faster comparison. The bulk allocation is done
   // from 'allocator'.  'serde_' is used for serializing complex
-  // type values into the container.
+  // type values into the container. If 'stringInlineLimit' is > 0,
+  // each VARCHAR/VARBINARY column reserves that many spare bytes in
+  // the row so that strings up to the limit are stored inside the row
+  // instead of 'stringAllocator_', avoiding the pointer chase in
+  // compare/hash/extract at the cost of a wider fixed row.
   RowContainer(
       const std::vector<TypePtr>& keyTypes,
       bool nullableKeys,
@@ -216,7 +220,8 @@ class RowContainer {
       bool hasProbedFlag,
       bool hasNormalizedKey,
       memory::MemoryPool* FOLLY_NONNULL pool,
-      const RowSerde& serde);
+      const RowSerde& serde,
+      int32_t stringInlineLimit = 0);
 
   // Allocates a new row and initializes possible aggregates to null.
   char* FOLLY_NONNULL newRow();
@@ -235,9 +240,16 @@ class RowContainer {
     if (!nullOffsets_.empty()) {
       memset(row + nullByte(nullOffsets_[0]), 0xff, initialNulls_.size());
       bits::clearBit(row, freeFlagOffset_);
+      std::fill(columnHasNulls_.begin(), columnHasNulls_.end(), true);
     }
   }
 
+  /// True if a null may have been stored for 'columnIndex'. Compare and
+  /// hash skip per-row null checks for columns where this is false.
+  bool columnHasNulls(int32_t columnIndex) const {
+    return columnHasNulls_[columnIndex];
+  }
+
   // The row size excluding any out-of-line stored variable length values.
   int32_t fixedRowSize() const {
     return fixedRowSize_;
@@ -747,8 +759,10 @@ class RowContainer {
     }
     *reinterpret_cast<T*>(row + offset) = decoded.valueAt<T>(index);
     if constexpr (std::is_same_v<T, StringView>) {
-      RowSizeTracker tracker(row[rowSizeOffset_], stringAllocator_);
-      stringAllocator_.copyMultipart(row, offset);
+      if (!storeStringInRow(row, offset)) {
+        RowSizeTracker tracker(row[rowSizeOffset_], stringAllocator_);
+        stringAllocator_.copyMultipart(row, offset);
+      }
     }
   }
 
@@ -761,9 +775,51 @@ class RowContainer {
     using T = typename TypeTraits<Kind>::NativeType;
     *reinterpret_cast<T*>(group + offset) = decoded.valueAt<T>(index);
     if constexpr (std::is_same_v<T, StringView>) {
-      RowSizeTracker tracker(group[rowSizeOffset_], stringAllocator_);
-      stringAllocator_.copyMultipart(group, offset);
+      if (!storeStringInRow(group, offset)) {
+        RowSizeTracker tracker(group[rowSizeOffset_], stringAllocator_);
+        stringAllocator_.copyMultipart(group, offset);
+      }
+    }
+  }
+
+  // Returns the spare bytes reserved in the row after the StringView of a
+  // VARCHAR/VARBINARY column for in-row storage of short strings. 0 for
+  // other types or when inlining is off.
+  int32_t stringInlineBytes(TypeKind kind) const;
+
+  // Copies a short non-inline string at 'offset' in 'row' into the spare
+  // bytes reserved after the StringView, avoiding an out-of-line
+  // allocation. A Header is written below the data so that readers using
+  // HashStringAllocator::contiguousString() see one contiguous piece.
+  // Returns false if the string must be copied to 'stringAllocator_'
+  // instead, i.e. inlining is off or the string does not fit.
+  inline bool storeStringInRow(char* FOLLY_NONNULL row, int32_t offset) {
+    if (!stringInlineLimit_) {
+      return false;
+    }
+    auto& view = *reinterpret_cast<StringView*>(row + offset);
+    if (view.isInline()) {
+      return true;
+    }
+    if (view.size() > static_cast<uint32_t>(stringInlineLimit_)) {
+      return false;
     }
+    auto* header = reinterpret_cast<HashStringAllocator::Header*>(
+        row + offset + sizeof(StringView));
+    new (header) HashStringAllocator::Header(stringInlineLimit_);
+    memcpy(header->begin(), view.data(), view.size());
+    view = StringView(header->begin(), view.size());
+    return true;
+  }
+
+  // True if the string at 'offset' in 'row' is stored in the spare row
+  // bytes instead of 'stringAllocator_'.
+  static inline bool isStringInRow(
+      const StringView& view,
+      const char* FOLLY_NONNULL row,
+      int32_t offset) {
+    return view.data() ==
+        row + offset + sizeof(StringView) + sizeof(HashStringAllocator::Header);
   }
 
   template <bool useRowNumbers, typename T>
@@ -964,6 +1020,32 @@ class RowContainer {
     return flags.ascending ? result : result * -1;
   }
 
+  // Fast path for compare() between rows for a column known to contain
+  // no nulls, skipping the per-row null flag loads.
+  template <TypeKind Kind>
+  inline int compareNoNulls(
+      const char* FOLLY_NONNULL left,
+      const char* FOLLY_NONNULL right,
+      const Type* FOLLY_NONNULL type,
+      RowColumn column,
+      CompareFlags flags) {
+    using T = typename KindToFlatVector<Kind>::HashRowType;
+    auto offset = column.offset();
+    if (Kind == TypeKind::ROW || Kind == TypeKind::ARRAY ||
+        Kind == TypeKind::MAP) {
+      return compareComplexType(left, right, type, offset, flags);
+    }
+    if (Kind == TypeKind::VARCHAR || Kind == TypeKind::VARBINARY) {
+      auto result = compareStringAsc(
+          valueAt<StringView>(left, offset),
+          valueAt<StringView>(right, offset));
+      return flags.ascending ? result : result * -1;
+    }
+    auto result = comparePrimitiveAsc(
+        valueAt<T>(left, offset), valueAt<T>(right, offset));
+    return flags.ascending ? result : result * -1;
+  }
+
   template <typename T>
   static inline int comparePrimitiveAsc(const T& left, const T& right) {
     if constexpr (std::is_floating_point<T>::value) {
@@ -1095,6 +1177,11 @@ class RowContainer {
   // Copied over the null bits of each row on initialization. Keys are
   // not null, aggregates are null.
   std::vector<uint8_t> initialNulls_;
+  // True for columns where a null may have been stored. Updated
+  // conservatively from the decoded vectors passed to store(). Lets
+  // compare and hash take the no-nulls path for columns that never saw
+  // a null, e.g. NOT NULL schemas with nullable containers.
+  std::vector<bool> columnHasNulls_;
   uint64_t numRows_ = 0;
   // Head of linked list of free rows.
   char* FOLLY_NULLABLE firstFreeRow_ = nullptr;
@@ -1108,6 +1195,11 @@ class RowContainer {
 
   const RowSerde& serde_;
 
+  // Strings up to this many bytes are stored in spare bytes reserved
+  // after the StringView of each VARCHAR/VARBINARY column. 0 means all
+  // non-inline strings go to 'stringAllocator_'.
+  const int32_t stringInlineLimit_;
+
   int alignment_ = 1;
 };
 
@@ -1289,6 +1381,16 @@ inline int RowContainer::compare(
     int columnIndex,
     CompareFlags flags) {
   auto type = types_[columnIndex].get();
+  if (!columnHasNulls_[columnIndex]) {
+    return VELOX_DYNAMIC_TYPE_DISPATCH(
+        compareNoNulls,
+        type->kind(),
+        left,
+        right,
+        type,
+        columnAt(columnIndex),
+        flags);
+  }
   return VELOX_DYNAMIC_TYPE_DISPATCH(
       compare, type->kind(), left, right, type, columnAt(columnIndex), flags);
 }
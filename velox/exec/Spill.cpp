@@ -15,9 +15,11 @@
  */
 
 #include "velox/exec/Spill.h"
+#include <folly/String.h>
 #include "velox/common/file/FileSystems.h"
 #include "velox/exec/OperatorUtils.h"
 #include "velox/serializers/PrestoSerializer.h"
+#include "velox/vector/FlatVector.h"
 
 namespace facebook::velox::exec {
 
@@ -31,6 +33,21 @@ static const serializer::presto::PrestoVectorSerde::PrestoOptions
 
 std::atomic<int32_t> SpillFile::ordinalCounter_;
 
+folly::io::CodecType spillCompressionCodecType(const std::string& codec) {
+  std::string lowerCodec = codec;
+  folly::toLowerAscii(lowerCodec);
+  if (lowerCodec == "none") {
+    return folly::io::CodecType::NO_COMPRESSION;
+  }
+  if (lowerCodec == "lz4") {
+    return folly::io::CodecType::LZ4;
+  }
+  if (lowerCodec == "zstd") {
+    return folly::io::CodecType::ZSTD;
+  }
+  VELOX_USER_FAIL("Unsupported spill compression codec: {}", codec);
+}
+
 void SpillInput::next(bool /*throwIfPastEnd*/) {
   int32_t readBytes = std::min(input_->size() - offset_, buffer_->capacity());
   VELOX_CHECK_LT(0, readBytes, "Reading past end of spill file");
@@ -39,16 +56,196 @@ void SpillInput::next(bool /*throwIfPastEnd*/) {
   offset_ += readBytes;
 }
 
+SpillMemoryTier::SpillMemoryTier(uint64_t maxBytes)
+    : maxBytes_(bits::roundUp(std::max(maxBytes, kBlockSize), kBlockSize)),
+      arena_(maxBytes_) {}
+
+char* SpillMemoryTier::allocateBlock() {
+  std::lock_guard<std::mutex> l(mutex_);
+  if (usedBytes_ + kBlockSize > maxBytes_) {
+    return nullptr;
+  }
+  auto* block = reinterpret_cast<char*>(arena_.allocate(kBlockSize));
+  if (block != nullptr) {
+    usedBytes_ += kBlockSize;
+  }
+  return block;
+}
+
+void SpillMemoryTier::freeBlock(char* block) {
+  std::lock_guard<std::mutex> l(mutex_);
+  arena_.free(block, kBlockSize);
+  usedBytes_ -= kBlockSize;
+}
+
+SpillMemoryRun::~SpillMemoryRun() {
+  for (auto* block : blocks_) {
+    tier_.freeBlock(block);
+  }
+}
+
+bool SpillMemoryRun::append(std::string_view data) {
+  const uint64_t freeBytes =
+      blocks_.size() * SpillMemoryTier::kBlockSize - size_;
+  if (data.size() > freeBytes) {
+    // Get all needed blocks before copying so that a failed append
+    // leaves 'this' unchanged.
+    const auto numNewBlocks =
+        bits::roundUp(data.size() - freeBytes, SpillMemoryTier::kBlockSize) /
+        SpillMemoryTier::kBlockSize;
+    std::vector<char*> newBlocks;
+    newBlocks.reserve(numNewBlocks);
+    for (uint64_t i = 0; i < numNewBlocks; ++i) {
+      auto* block = tier_.allocateBlock();
+      if (block == nullptr) {
+        for (auto* added : newBlocks) {
+          tier_.freeBlock(added);
+        }
+        return false;
+      }
+      newBlocks.push_back(block);
+    }
+    blocks_.insert(blocks_.end(), newBlocks.begin(), newBlocks.end());
+  }
+  uint64_t offset = size_;
+  const char* source = data.data();
+  uint64_t left = data.size();
+  while (left > 0) {
+    const auto inBlock = offset % SpillMemoryTier::kBlockSize;
+    const auto bytes =
+        std::min<uint64_t>(left, SpillMemoryTier::kBlockSize - inBlock);
+    memcpy(
+        blocks_[offset / SpillMemoryTier::kBlockSize] + inBlock,
+        source,
+        bytes);
+    source += bytes;
+    offset += bytes;
+    left -= bytes;
+  }
+  size_ += data.size();
+  return true;
+}
+
+void SpillMemoryRun::pread(uint64_t offset, uint64_t length, char* buf) const {
+  VELOX_CHECK_LE(offset + length, size_);
+  while (length > 0) {
+    const auto inBlock = offset % SpillMemoryTier::kBlockSize;
+    const auto bytes =
+        std::min<uint64_t>(length, SpillMemoryTier::kBlockSize - inBlock);
+    memcpy(buf, blocks_[offset / SpillMemoryTier::kBlockSize] + inBlock, bytes);
+    buf += bytes;
+    offset += bytes;
+    length -= bytes;
+  }
+}
+
+void SpillMemoryRun::writeTo(WriteFile& file) const {
+  uint64_t offset = 0;
+  for (auto* block : blocks_) {
+    const auto bytes =
+        std::min<uint64_t>(size_ - offset, SpillMemoryTier::kBlockSize);
+    file.append(std::string_view(block, bytes));
+    offset += bytes;
+  }
+}
+
+SpillTierWriteFile::SpillTierWriteFile(SpillMemoryTier& tier, std::string path)
+    : path_(std::move(path)), run_(std::make_unique<SpillMemoryRun>(tier)) {}
+
+void SpillTierWriteFile::append(std::string_view data) {
+  if (run_ != nullptr) {
+    if (run_->append(data)) {
+      return;
+    }
+    // The tier is at capacity. Move the contents written so far to the
+    // file at 'path_' and continue there.
+    auto fs = filesystems::getFileSystem(path_, nullptr);
+    file_ = fs->openFileForWrite(path_);
+    run_->writeTo(*file_);
+    run_ = nullptr;
+  }
+  file_->append(data);
+}
+
 void SpillMergeStream::pop() {
   if (++index_ >= size_) {
     setNextBatch();
   }
 }
 
+namespace {
+// Monotone mapping of a signed integer to uint64_t: the unsigned
+// results order the same way as the signed arguments.
+template <typename T>
+uint64_t encodeAscending(T value) {
+  return static_cast<uint64_t>(static_cast<int64_t>(value)) ^ (1ULL << 63);
+}
+} // namespace
+
+bool SpillMergeStream::supportsKeyPrefix() const {
+  if (!hasData()) {
+    // A stream at end is never compared.
+    return true;
+  }
+  if (numSortingKeys() == 0) {
+    return false;
+  }
+  const auto& key = rowVector_->childAt(0);
+  switch (key->typeKind()) {
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+      // Spilled batches are deserialized to flat vectors, so the
+      // encoding of the first batch holds for all batches.
+      return key->encoding() == VectorEncoding::Simple::FLAT;
+    default:
+      return false;
+  }
+}
+
+uint64_t SpillMergeStream::keyPrefix() const {
+  const auto& key = rowVector_->childAt(0);
+  const auto flags = sortCompareFlags().empty() ? CompareFlags()
+                                                : sortCompareFlags()[0];
+  if (key->isNullAt(index_)) {
+    return flags.nullsFirst ? 0 : std::numeric_limits<uint64_t>::max();
+  }
+  uint64_t encoded;
+  switch (key->typeKind()) {
+    case TypeKind::SMALLINT:
+      encoded = encodeAscending(
+          key->asUnchecked<FlatVector<int16_t>>()->valueAt(index_));
+      break;
+    case TypeKind::INTEGER:
+      encoded = encodeAscending(
+          key->asUnchecked<FlatVector<int32_t>>()->valueAt(index_));
+      break;
+    case TypeKind::BIGINT:
+      encoded = encodeAscending(
+          key->asUnchecked<FlatVector<int64_t>>()->valueAt(index_));
+      break;
+    default:
+      VELOX_UNREACHABLE();
+  }
+  if (!flags.ascending) {
+    encoded = ~encoded;
+  }
+  // Clamp into the open range so that nulls sort strictly first or
+  // last. Ties at the extremes fall back to full compares.
+  return std::max<uint64_t>(
+      1, std::min(encoded, std::numeric_limits<uint64_t>::max() - 1));
+}
+
 WriteFile& SpillFile::output() {
   if (!output_) {
-    auto fs = filesystems::getFileSystem(path_, nullptr);
-    output_ = fs->openFileForWrite(path_);
+    if (tier_ != nullptr) {
+      auto tierFile = std::make_unique<SpillTierWriteFile>(*tier_, path_);
+      tierOutput_ = tierFile.get();
+      output_ = std::move(tierFile);
+    } else {
+      auto fs = filesystems::getFileSystem(path_, nullptr);
+      output_ = fs->openFileForWrite(path_);
+    }
   }
   return *output_;
 }
@@ -58,14 +255,30 @@ void SpillFile::startRead() {
       (1 << 20) - AlignedBuffer::kPaddedSize; // 1MB - padding.
   VELOX_CHECK(!output_);
   VELOX_CHECK(!input_);
-  auto fs = filesystems::getFileSystem(path_, nullptr);
-  auto file = fs->openFileForRead(path_);
+  VELOX_CHECK(!compressedFile_);
+  std::unique_ptr<ReadFile> file;
+  if (memoryRun_ != nullptr) {
+    file = std::make_unique<SpillTierReadFile>(std::move(memoryRun_));
+  } else {
+    auto fs = filesystems::getFileSystem(path_, nullptr);
+    file = fs->openFileForRead(path_);
+  }
+  if (compressionCodec_ != folly::io::CodecType::NO_COMPRESSION) {
+    // A compressed file is read frame by frame instead of streaming, so the
+    // decompressed frames can be deserialized one at a time.
+    compressedFile_ = std::move(file);
+    codec_ = folly::io::getCodec(compressionCodec_);
+    return;
+  }
   auto buffer = AlignedBuffer::allocate<char>(
       std::min<uint64_t>(fileSize_, kMaxReadBufferSize), &pool_);
   input_ = std::make_unique<SpillInput>(std::move(file), std::move(buffer));
 }
 
 bool SpillFile::nextBatch(RowVectorPtr& rowVector) {
+  if (compressionCodec_ != folly::io::CodecType::NO_COMPRESSION) {
+    return nextCompressedBatch(rowVector);
+  }
   if (input_->atEnd()) {
     return false;
   }
@@ -74,6 +287,43 @@ bool SpillFile::nextBatch(RowVectorPtr& rowVector) {
   return true;
 }
 
+bool SpillFile::nextCompressedBatch(RowVectorPtr& rowVector) {
+  if (compressedOffset_ >= fileSize_) {
+    return false;
+  }
+  uint32_t frameSize;
+  compressedFile_->pread(
+      compressedOffset_, sizeof(frameSize), reinterpret_cast<char*>(&frameSize));
+  compressedOffset_ += sizeof(frameSize);
+  VELOX_CHECK_LE(
+      compressedOffset_ + frameSize,
+      fileSize_,
+      "Truncated frame in spill file {}",
+      path_);
+  if (compressedBuffer_ == nullptr ||
+      compressedBuffer_->capacity() < frameSize) {
+    compressedBuffer_ = AlignedBuffer::allocate<char>(frameSize, &pool_);
+  }
+  compressedFile_->pread(
+      compressedOffset_, frameSize, compressedBuffer_->asMutable<char>());
+  compressedOffset_ += frameSize;
+  const auto frame =
+      folly::IOBuf::wrapBuffer(compressedBuffer_->as<char>(), frameSize);
+  const auto uncompressed = codec_->uncompress(frame.get());
+  std::vector<ByteRange> ranges;
+  for (const auto range : *uncompressed) {
+    ranges.push_back(ByteRange{
+        const_cast<uint8_t*>(range.data()),
+        static_cast<int32_t>(range.size()),
+        0});
+  }
+  ByteStream stream;
+  stream.resetInput(std::move(ranges));
+  VectorStreamGroup::read(
+      &stream, &pool_, type_, &rowVector, &kDefaultSerdeOptions);
+  return true;
+}
+
 WriteFile& SpillFileList::currentOutput() {
   if (files_.empty() || !files_.back()->isWritable() ||
       files_.back()->size() > targetFileSize_) {
@@ -85,23 +335,67 @@ WriteFile& SpillFileList::currentOutput() {
         numSortingKeys_,
         sortCompareFlags_,
         fmt::format("{}-{}", path_, files_.size()),
-        pool_));
+        compressionCodec_,
+        pool_,
+        tier_));
   }
   return files_.back()->output();
 }
 
+void SpillFileList::writeBatch(
+    WriteFile& file,
+    std::shared_ptr<folly::IOBuf> iobuf) {
+  if (compressionCodec_ != folly::io::CodecType::NO_COMPRESSION) {
+    // Each flushed batch becomes one length prefixed compressed frame so
+    // the read side can decompress and deserialize one batch at a time.
+    if (codec_ == nullptr) {
+      codec_ = folly::io::getCodec(compressionCodec_);
+    }
+    iobuf = codec_->compress(iobuf.get());
+    const uint32_t frameSize = iobuf->computeChainDataLength();
+    file.append(std::string_view(
+        reinterpret_cast<const char*>(&frameSize), sizeof(frameSize)));
+  }
+  for (auto& range : *iobuf) {
+    file.append(std::string_view(
+        reinterpret_cast<const char*>(range.data()), range.size()));
+  }
+}
+
+void SpillFileList::waitForPendingWrite() {
+  if (pendingWrite_ == nullptr) {
+    return;
+  }
+  const auto source = std::move(pendingWrite_);
+  // move() runs the write inline if the executor has not picked it up yet
+  // and rethrows a write error, if any.
+  source->move();
+}
+
 void SpillFileList::flush() {
   if (batch_) {
     IOBufOutputStream out(
         pool_, nullptr, std::max<int64_t>(64 * 1024, batch_->size()));
     batch_->flush(&out);
     batch_.reset();
-    auto iobuf = out.getIOBuf();
+    std::shared_ptr<folly::IOBuf> iobuf = out.getIOBuf();
+    // Wait for the write scheduled by the previous flush so that at most one
+    // write is in flight at a time and the file rotation below sees the
+    // final file size.
+    waitForPendingWrite();
     auto& file = currentOutput();
-    for (auto& range : *iobuf) {
-      file.append(std::string_view(
-          reinterpret_cast<const char*>(range.data()), range.size()));
+    if (executor_ == nullptr) {
+      writeBatch(file, std::move(iobuf));
+      return;
     }
+    // Double buffered write: the caller goes on to fill the next batch while
+    // the flushed one is compressed and written on 'executor_'.
+    pendingWrite_ = std::make_shared<AsyncSource<folly::Unit>>(
+        [this, &file, iobuf = std::move(iobuf)]() {
+          writeBatch(file, iobuf);
+          return std::make_unique<folly::Unit>();
+        });
+    executor_->add([source = pendingWrite_]() { source->prepare(); });
   }
 }
 
@@ -122,6 +416,7 @@ void SpillFileList::write(
 
 void SpillFileList::finishFile() {
   flush();
+  waitForPendingWrite();
   if (files_.empty()) {
     return;
   }
@@ -173,7 +468,10 @@ void SpillState::appendToPartition(
         sortCompareFlags_,
         fmt::format("{}-spill-{}", path_, partition),
         targetFileSize_,
-        pool_);
+        compressionCodec_,
+        executor_,
+        pool_,
+        tier_);
   }
 
   IndexRange range{0, rows->size()};
@@ -16,9 +16,13 @@
 
 #pragma once
 
+#include <folly/Executor.h>
+#include <folly/compression/Compression.h>
 #include <folly/container/F14Set.h>
 
+#include "velox/common/base/AsyncSource.h"
 #include "velox/common/file/File.h"
+#include "velox/common/memory/MmapArena.h"
 #include "velox/exec/TreeOfLosers.h"
 #include "velox/exec/UnorderedStreamReader.h"
 #include "velox/vector/ComplexVector.h"
@@ -27,6 +31,11 @@
 
 namespace facebook::velox::exec {
 
+/// Returns the folly codec type for a spill compression codec name as
+/// configured by QueryConfig::spillCompressionCodec(). The supported names
+/// are 'none', 'lz4' and 'zstd'. Throws for any other name.
+folly::io::CodecType spillCompressionCodecType(const std::string& codec);
+
 // Input stream backed by spill file.
 class SpillInput : public ByteStream {
  public:
@@ -53,6 +62,150 @@ class SpillInput : public ByteStream {
   uint64_t offset_ = 0;
 };
 
+/// Memory tier for spill data. Holds spilled partitions in mmap'd
+/// memory managed by MmapArena instead of writing them to disk. The
+/// arena is anonymous mmap, so on hosts with swap on fast local SSD the
+/// kernel pages cold spill data out and reads are served by page faults
+/// instead of explicit file IO. When the tier is at capacity, spilling
+/// falls back to regular files. Thread safe: one tier is shared by all
+/// spilling operators.
+class SpillMemoryTier {
+ public:
+  /// Unit of allocation from the arena. Spill data is held as chains of
+  /// blocks of this size.
+  static constexpr uint64_t kBlockSize = memory::MmapArena::kMinGrainSizeBytes;
+
+  /// 'maxBytes' is rounded up to a multiple of kBlockSize.
+  explicit SpillMemoryTier(uint64_t maxBytes);
+
+  /// Returns a block of kBlockSize bytes or nullptr if the tier is at
+  /// capacity.
+  char* FOLLY_NULLABLE allocateBlock();
+
+  /// Returns 'block' obtained from allocateBlock() to the tier.
+  void freeBlock(char* FOLLY_NONNULL block);
+
+  uint64_t maxBytes() const {
+    return maxBytes_;
+  }
+
+  /// Returns the number of bytes currently allocated from 'this'.
+  uint64_t usedBytes() const {
+    std::lock_guard<std::mutex> l(mutex_);
+    return usedBytes_;
+  }
+
+ private:
+  const uint64_t maxBytes_;
+  mutable std::mutex mutex_;
+  memory::MmapArena arena_;
+  uint64_t usedBytes_{0};
+};
+
+/// Contents of one spill file held in SpillMemoryTier blocks.
+class SpillMemoryRun {
+ public:
+  explicit SpillMemoryRun(SpillMemoryTier& tier) : tier_(tier) {}
+
+  ~SpillMemoryRun();
+
+  /// Appends 'data' to 'this'. Returns false without changing 'this' if
+  /// the tier cannot supply the needed blocks.
+  bool append(std::string_view data);
+
+  uint64_t size() const {
+    return size_;
+  }
+
+  /// Copies the bytes at [offset, offset + length) into 'buf'.
+  void pread(uint64_t offset, uint64_t length, char* FOLLY_NONNULL buf) const;
+
+  /// Appends the contents of 'this' to 'file'. Used for migrating to
+  /// disk when the tier fills up in the middle of a write.
+  void writeTo(WriteFile& file) const;
+
+ private:
+  SpillMemoryTier& tier_;
+  std::vector<char*> blocks_;
+  uint64_t size_{0};
+};
+
+/// Write file that stores spill data in a SpillMemoryRun. If the tier
+/// runs out of space mid-write, moves the contents written so far to
+/// the file at 'path' and continues there.
+class SpillTierWriteFile : public WriteFile {
+ public:
+  SpillTierWriteFile(SpillMemoryTier& tier, std::string path);
+
+  void append(std::string_view data) final;
+
+  void flush() final {
+    if (file_ != nullptr) {
+      file_->flush();
+    }
+  }
+
+  void close() final {
+    if (file_ != nullptr) {
+      file_->close();
+    }
+  }
+
+  uint64_t size() const final {
+    return run_ != nullptr ? run_->size() : file_->size();
+  }
+
+  /// Returns the memory run holding the data, nullptr if the contents
+  /// were migrated to disk.
+  std::unique_ptr<SpillMemoryRun> takeRun() {
+    return std::move(run_);
+  }
+
+ private:
+  const std::string path_;
+  std::unique_ptr<SpillMemoryRun> run_;
+  std::unique_ptr<WriteFile> file_;
+};
+
+/// Read file over a SpillMemoryRun.
+class SpillTierReadFile : public ReadFile {
+ public:
+  explicit SpillTierReadFile(std::unique_ptr<SpillMemoryRun> run)
+      : run_(std::move(run)) {}
+
+  std::string_view pread(
+      uint64_t offset,
+      uint64_t length,
+      void* FOLLY_NONNULL buf) const override {
+    run_->pread(offset, length, reinterpret_cast<char*>(buf));
+    bytesRead_ += length;
+    return {reinterpret_cast<const char*>(buf), length};
+  }
+
+  uint64_t size() const final {
+    return run_->size();
+  }
+
+  uint64_t memoryUsage() const final {
+    return run_->size();
+  }
+
+  bool shouldCoalesce() const final {
+    return false;
+  }
+
+  std::string getName() const override {
+    return "<SpillTierReadFile>";
+  }
+
+  uint64_t getNaturalReadSize() const override {
+    return SpillMemoryTier::kBlockSize;
+  }
+
+ private:
+  std::unique_ptr<SpillMemoryRun> run_;
+};
+
 /// Represents a spill file that is first in write mode and then
 /// turns into a source of spilled RowVectors. Owns a file system file that
 /// contains the spilled data and is live for the duration of 'this'.
@@ -63,16 +216,22 @@ class SpillInput : public ByteStream {
 /// rmdir() call.
 class SpillFile {
  public:
+  /// If 'tier' is non-null, the data is placed in the memory tier and
+  /// the file at 'path' is only created if the tier fills up.
   SpillFile(
       RowTypePtr type,
       int32_t numSortingKeys,
       const std::vector<CompareFlags>& sortCompareFlags,
       const std::string& path,
-      memory::MemoryPool& pool)
+      folly::io::CodecType compressionCodec,
+      memory::MemoryPool& pool,
+      SpillMemoryTier* FOLLY_NULLABLE tier = nullptr)
       : type_(std::move(type)),
         numSortingKeys_(numSortingKeys),
         sortCompareFlags_(sortCompareFlags),
+        compressionCodec_(compressionCodec),
         pool_(pool),
+        tier_(tier),
         ordinal_(ordinalCounter_++),
         path_(fmt::format("{}-{}", path, ordinal_)) {
     // NOTE: if the spilling operator has specified the sort comparison flags,
@@ -105,6 +264,11 @@ class SpillFile {
   void finishWrite() {
     VELOX_CHECK(output_);
     fileSize_ = output_->size();
+    if (tierOutput_ != nullptr) {
+      // nullptr if the tier filled up and the data went to disk.
+      memoryRun_ = tierOutput_->takeRun();
+      tierOutput_ = nullptr;
+    }
     output_ = nullptr;
   }
 
@@ -135,12 +299,21 @@ class SpillFile {
  private:
   static std::atomic<int32_t> ordinalCounter_;
 
+  // Reads the next length prefixed compressed frame from 'readFile_',
+  // decompresses it and deserializes it into 'rowVector'. Returns false at
+  // end of file. Only used when 'compressionCodec_' is not NO_COMPRESSION.
+  bool nextCompressedBatch(RowVectorPtr& rowVector);
+
   // Type of 'rowVector_'. Needed for setting up writing.
   const RowTypePtr type_;
   const int32_t numSortingKeys_;
   const std::vector<CompareFlags> sortCompareFlags_;
+  const folly::io::CodecType compressionCodec_;
   memory::MemoryPool& pool_;
 
+  // Memory tier the data is placed in, nullptr for direct disk spill.
+  SpillMemoryTier* FOLLY_NULLABLE const tier_;
+
   // Ordinal number used for making a label for debugging.
   const int32_t ordinal_;
   const std::string path_;
@@ -148,7 +321,23 @@ class SpillFile {
   // Byte size of the backing file. Set when finishing writing.
   uint64_t fileSize_ = 0;
   std::unique_ptr<WriteFile> output_;
+
+  // Set while writing to 'tier_'. Owned by 'output_'.
+  SpillTierWriteFile* FOLLY_NULLABLE tierOutput_{nullptr};
+
+  // The contents if they stayed in 'tier_'. Set by finishWrite() and
+  // consumed by startRead().
+  std::unique_ptr<SpillMemoryRun> memoryRun_;
+
   std::unique_ptr<SpillInput> input_;
+
+  // State for reading back a compressed spill file. The file is a sequence
+  // of length prefixed frames, each holding one compressed serialized
+  // batch. Unused when 'compressionCodec_' is NO_COMPRESSION.
+  std::unique_ptr<ReadFile> compressedFile_;
+  uint64_t compressedOffset_ = 0;
+  std::unique_ptr<folly::io::Codec> codec_;
+  BufferPtr compressedBuffer_;
 };
 
 using SpillFiles = std::vector<std::unique_ptr<SpillFile>>;
@@ -166,19 +355,31 @@ class SpillFileList {
   ///
   /// When writing sorted spill runs, the caller is responsible for buffering
   /// and sorting the data. write is called multiple times, followed by flush().
+  ///
+  /// If 'executor' is non-null, flushed batches are written to the file on
+  /// the executor with at most one write in flight, so the caller can fill
+  /// the next batch while the previous one is being written.
+  /// If 'tier' is non-null, the files are placed in the memory tier as
+  /// long as it has space. See SpillFile.
   SpillFileList(
       RowTypePtr type,
       int32_t numSortingKeys,
       const std::vector<CompareFlags>& sortCompareFlags,
       const std::string& path,
       uint64_t targetFileSize,
-      memory::MemoryPool& pool)
+      folly::io::CodecType compressionCodec,
+      folly::Executor* FOLLY_NULLABLE executor,
+      memory::MemoryPool& pool,
+      SpillMemoryTier* FOLLY_NULLABLE tier = nullptr)
       : type_(type),
         numSortingKeys_(numSortingKeys),
         sortCompareFlags_(sortCompareFlags),
         path_(path),
         targetFileSize_(targetFileSize),
-        pool_(pool) {
+        compressionCodec_(compressionCodec),
+        executor_(executor),
+        pool_(pool),
+        tier_(tier) {
     // NOTE: if the associated spilling operator has specified the sort
     // comparison flags, then it must match the number of sorting keys.
     VELOX_CHECK(
@@ -186,6 +387,12 @@ class SpillFileList {
         sortCompareFlags_.size() == numSortingKeys_);
   }
 
+  ~SpillFileList() {
+    if (pendingWrite_ != nullptr) {
+      pendingWrite_->close();
+    }
+  }
+
   /// Adds 'rows' for the positions in 'indices' into 'this'. The indices
   /// must produce a view where the rows are sorted if sorting is desired.
   /// Consecutive calls must have sorted data so that the first row of the
@@ -217,9 +424,21 @@ class SpillFileList {
   // Returns the current file to write to and creates one if needed.
   WriteFile& currentOutput();
 
-  // Writes data from 'batch_' to the current output file.
+  // Writes data from 'batch_' to the current output file. If 'executor_' is
+  // set, the write happens on the executor while the caller fills the next
+  // batch.
   void flush();
 
+  // Compresses 'iobuf' if a compression codec is set and appends it to
+  // 'file' as a length prefixed frame, otherwise appends the raw bytes.
+  void writeBatch(WriteFile& file, std::shared_ptr<folly::IOBuf> iobuf);
+
+  // Waits for the write scheduled by a previous flush, if any, so that at
+  // most one write is in flight at a time. Rethrows a write error, if any.
+  // Runs the write on the caller thread if the executor has not picked it up
+  // yet.
+  void waitForPendingWrite();
+
   // Invoked by 'files()' to record stats when finish writing all the spill
   // files.
   void recordRuntimeStats();
@@ -229,8 +448,14 @@ class SpillFileList {
   const std::vector<CompareFlags> sortCompareFlags_;
   const std::string path_;
   const uint64_t targetFileSize_;
+  const folly::io::CodecType compressionCodec_;
+  folly::Executor* FOLLY_NULLABLE const executor_;
   memory::MemoryPool& pool_;
+  SpillMemoryTier* FOLLY_NULLABLE const tier_;
   std::unique_ptr<VectorStreamGroup> batch_;
+  std::unique_ptr<folly::io::Codec> codec_;
+  // The in-flight background write of the last flushed batch, if any.
+  std::shared_ptr<AsyncSource<folly::Unit>> pendingWrite_;
   SpillFiles files_;
 };
 
@@ -283,6 +508,13 @@ class SpillMergeStream : public MergeStream {
     return 0;
   }
 
+  // Supported when the leading sort key is a flat integer column, so
+  // that most compares in a wide spill merge resolve on the cached
+  // prefixes in TreeOfLosers instead of calling compare().
+  bool supportsKeyPrefix() const override;
+
+  uint64_t keyPrefix() const override;
+
   void pop();
 
   const RowVector& current() const {
@@ -548,21 +780,31 @@ class SpillState {
   /// between files. This also gives the maximum number of partitions.
   /// 'numSortingKeys' is the number of leading columns on which the data is
   /// sorted, 0 if only hash partitioning is used. 'targetFileSize' is the
-  /// target size of a single file.  'pool' owns the memory for state and
-  /// results.
+  /// target size of a single file. 'compressionCodec' names the codec used to
+  /// compress the spilled data, 'none' for no compression. If 'executor' is
+  /// non-null, writes to the spill files are overlapped with producing the
+  /// next batch. 'pool' owns the memory for state and results. If 'tier'
+  /// is non-null, spilled partitions are placed in the memory tier while
+  /// it has space and only overflow to files. See SpillMemoryTier.
   SpillState(
       const std::string& path,
       int32_t maxPartitions,
       int32_t numSortingKeys,
       const std::vector<CompareFlags>& sortCompareFlags,
       uint64_t targetFileSize,
-      memory::MemoryPool& pool)
+      const std::string& compressionCodec,
+      folly::Executor* FOLLY_NULLABLE executor,
+      memory::MemoryPool& pool,
+      SpillMemoryTier* FOLLY_NULLABLE tier = nullptr)
       : path_(path),
         maxPartitions_(maxPartitions),
         numSortingKeys_(numSortingKeys),
         sortCompareFlags_(sortCompareFlags),
         targetFileSize_(targetFileSize),
+        compressionCodec_(spillCompressionCodecType(compressionCodec)),
+        executor_(executor),
         pool_(pool),
+        tier_(tier),
         files_(maxPartitions_) {}
 
   /// Indicates if a given 'partition' has been spilled or not.
@@ -646,9 +888,13 @@ class SpillState {
   const int32_t numSortingKeys_;
   const std::vector<CompareFlags> sortCompareFlags_;
   const uint64_t targetFileSize_;
+  const folly::io::CodecType compressionCodec_;
+  folly::Executor* FOLLY_NULLABLE const executor_;
 
   memory::MemoryPool& pool_;
 
+  SpillMemoryTier* FOLLY_NULLABLE const tier_;
+
   // A set of spilled partition numbers.
   SpillPartitionNumSet spilledPartitionSet_;
 
@@ -43,6 +43,7 @@ class Spiller {
         const std::string& _filePath,
         uint64_t _maxFileSize,
         uint64_t _minSpillRunSize,
+        const std::string& _compressionCodec,
         folly::Executor* FOLLY_NULLABLE _executor,
         int32_t _spillableReservationGrowthPct,
         const HashBitRange& _hashBitRange,
@@ -53,6 +54,7 @@ class Spiller {
               _maxFileSize == 0 ? std::numeric_limits<int64_t>::max()
                                 : _maxFileSize),
           minSpillRunSize(_minSpillRunSize),
+          compressionCodec(_compressionCodec),
           executor(_executor),
           spillableReservationGrowthPct(_spillableReservationGrowthPct),
           hashBitRange(_hashBitRange),
@@ -84,6 +86,9 @@ class Spiller {
     /// generating too many small spilled files.
     uint64_t minSpillRunSize;
 
+    /// The compression codec for the spilled data, 'none' for no compression.
+    std::string compressionCodec;
+
     // Executor for spilling. If nullptr spilling writes on the Driver's thread.
     folly::Executor* FOLLY_NULLABLE executor; // Not owned.
 
@@ -120,6 +125,7 @@ class Spiller {
       const std::string& path,
       uint64_t targetFileSize,
       uint64_t minSpillRunSize,
+      const std::string& compressionCodec,
       memory::MemoryPool& pool,
       folly::Executor* FOLLY_NULLABLE executor);
 
@@ -130,6 +136,7 @@ class Spiller {
       const std::string& path,
       uint64_t targetFileSize,
       uint64_t minSpillRunSize,
+      const std::string& compressionCodec,
       memory::MemoryPool& pool,
       folly::Executor* FOLLY_NULLABLE executor);
 
@@ -144,6 +151,7 @@ class Spiller {
       const std::string& path,
       uint64_t targetFileSize,
       uint64_t minSpillRunSize,
+      const std::string& compressionCodec,
       memory::MemoryPool& pool,
       folly::Executor* FOLLY_NULLABLE executor);
 
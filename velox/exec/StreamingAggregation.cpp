@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "velox/exec/StreamingAggregation.h"
+#include "velox/common/base/SimdUtil.h"
 #include "velox/exec/Aggregate.h"
 #include "velox/exec/RowContainer.h"
 
@@ -151,6 +152,76 @@ bool equalKeys(
 
   return true;
 }
+
+// Returns true if 'decoded' is a flat, null-free column of a fixed-width
+// integer type eligible for SIMD boundary detection. Floating point keys are
+// excluded to preserve the equality semantics of NaN values.
+bool isEligibleForSimdBoundaries(const DecodedVector& decoded) {
+  if (!decoded.isIdentityMapping() || decoded.mayHaveNulls()) {
+    return false;
+  }
+  switch (decoded.base()->typeKind()) {
+    case TypeKind::TINYINT:
+    case TypeKind::SMALLINT:
+    case TypeKind::INTEGER:
+    case TypeKind::BIGINT:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Sets a bit in 'boundaries' for each row in [1, 'size') whose value differs
+// from the previous row's. Compares batches of the input against the input
+// shifted by one row and scatters the resulting comparison masks into the
+// bitmask.
+template <typename T>
+void findBoundariesTyped(
+    const T* values,
+    vector_size_t size,
+    uint64_t* boundaries) {
+  constexpr int32_t kBatchSize = xsimd::batch<T>::size;
+  vector_size_t row = 1;
+  for (; row + kBatchSize <= size; row += kBatchSize) {
+    auto differs = xsimd::batch<T>::load_unaligned(values + row) !=
+        xsimd::batch<T>::load_unaligned(values + row - 1);
+    auto mask = static_cast<uint64_t>(simd::toBitMask(differs));
+    if (mask != 0) {
+      const auto offset = row & 63;
+      boundaries[row / 64] |= mask << offset;
+      if (offset + kBatchSize > 64) {
+        boundaries[row / 64 + 1] |= mask >> (64 - offset);
+      }
+    }
+  }
+  for (; row < size; ++row) {
+    if (values[row] != values[row - 1]) {
+      bits::setBit(boundaries, row);
+    }
+  }
+}
+
+void findBoundaries(
+    const DecodedVector& decoded,
+    vector_size_t size,
+    uint64_t* boundaries) {
+  switch (decoded.base()->typeKind()) {
+    case TypeKind::TINYINT:
+      findBoundariesTyped<int8_t>(decoded.data<int8_t>(), size, boundaries);
+      break;
+    case TypeKind::SMALLINT:
+      findBoundariesTyped<int16_t>(decoded.data<int16_t>(), size, boundaries);
+      break;
+    case TypeKind::INTEGER:
+      findBoundariesTyped<int32_t>(decoded.data<int32_t>(), size, boundaries);
+      break;
+    case TypeKind::BIGINT:
+      findBoundariesTyped<int64_t>(decoded.data<int64_t>(), size, boundaries);
+      break;
+    default:
+      VELOX_UNREACHABLE();
+  }
+}
 } // namespace
 
 char* StreamingAggregation::startNewGroup(vector_size_t index) {
@@ -201,6 +272,14 @@ void StreamingAggregation::assignGroups() {
 
   inputGroups_.resize(numInput);
 
+  for (auto i = 0; i < groupingKeys_.size(); ++i) {
+    decodedKeys_[i].decode(*input_->childAt(groupingKeys_[i]), inputRows_);
+  }
+
+  if (assignGroupsVectorized(numInput)) {
+    return;
+  }
+
   // Look for the end of the last group.
   vector_size_t index = 0;
   if (prevInput_) {
@@ -216,10 +295,6 @@ void StreamingAggregation::assignGroups() {
   }
 
   if (index < numInput) {
-    for (auto i = 0; i < groupingKeys_.size(); ++i) {
-      decodedKeys_[i].decode(*input_->childAt(groupingKeys_[i]), inputRows_);
-    }
-
     auto* newGroup = startNewGroup(index);
     inputGroups_[index] = newGroup;
 
@@ -235,6 +310,49 @@ void StreamingAggregation::assignGroups() {
   }
 }
 
+bool StreamingAggregation::assignGroupsVectorized(vector_size_t numInput) {
+  for (const auto& decodedKey : decodedKeys_) {
+    if (!isEligibleForSimdBoundaries(decodedKey)) {
+      return false;
+    }
+  }
+
+  // Mark the rows whose keys differ from the previous row's. These rows start
+  // new groups.
+  groupBoundaryBits_.resize(bits::nwords(numInput));
+  std::fill(groupBoundaryBits_.begin(), groupBoundaryBits_.end(), 0);
+  for (const auto& decodedKey : decodedKeys_) {
+    findBoundaries(decodedKey, numInput, groupBoundaryBits_.data());
+  }
+
+  groupBoundaries_.resize(numInput);
+  auto numBoundaries = simd::indicesOfSetBits(
+      groupBoundaryBits_.data(), 1, numInput, groupBoundaries_.data());
+
+  // The first run continues the last group of the previous batch if the keys
+  // match; otherwise it starts a new group.
+  char* group;
+  if (prevInput_ &&
+      equalKeys(groupingKeys_, prevInput_, prevInput_->size() - 1, input_, 0)) {
+    group = groups_[numGroups_ - 1];
+  } else {
+    group = startNewGroup(0);
+  }
+
+  // Assign group pointers one run at a time.
+  vector_size_t runStart = 0;
+  for (auto i = 0; i < numBoundaries; ++i) {
+    const auto runEnd = groupBoundaries_[i];
+    std::fill(
+        inputGroups_.begin() + runStart, inputGroups_.begin() + runEnd, group);
+    group = startNewGroup(runEnd);
+    runStart = runEnd;
+  }
+  std::fill(
+      inputGroups_.begin() + runStart, inputGroups_.begin() + numInput, group);
+  return true;
+}
+
 const SelectivityVector& StreamingAggregation::getSelectivityVector(
     size_t aggregateIndex) const {
   auto* rows = masks_->activeRows(aggregateIndex);
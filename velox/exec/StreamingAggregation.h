@@ -65,6 +65,13 @@ class StreamingAggregation : public Operator {
   // assignments in inputGroups_.
   void assignGroups();
 
+  // Vectorized version of group assignment used when all grouping keys are
+  // flat, null-free columns of fixed-width integer types. Detects group
+  // boundaries by comparing each key column against itself shifted by one row
+  // using SIMD and assigns group pointers one run at a time. Returns false if
+  // the keys are not eligible and the row-by-row path must be used.
+  bool assignGroupsVectorized(vector_size_t numInput);
+
   // Add input data to accumulators.
   void evaluateAggregates();
 
@@ -102,6 +109,14 @@ class StreamingAggregation : public Operator {
   // A subset of input rows to evaluate the aggregate function on. Rows
   // where aggregation mask is false are excluded.
   SelectivityVector inputRows_;
+
+  // Bitmask with a bit set for each input row whose grouping keys differ from
+  // the previous row's. Used by assignGroupsVectorized.
+  std::vector<uint64_t> groupBoundaryBits_;
+
+  // Indices of the set bits in groupBoundaryBits_, i.e. the first rows of new
+  // groups.
+  std::vector<int32_t> groupBoundaries_;
 };
 
 } // namespace facebook::velox::exec
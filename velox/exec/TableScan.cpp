@@ -18,7 +18,12 @@
 #include "velox/exec/Task.h"
 #include "velox/expression/Expr.h"
 
-DEFINE_int32(split_preload_per_driver, 2, "Prefetch split metadata");
+DEFINE_int32(
+    split_preload_per_driver,
+    2,
+    "Number of splits to preload per driver. A preloaded split has its "
+    "DataSource created in the background, which reads the file footer and "
+    "schedules cache loads for the first stripe's selected columns.");
 
 namespace facebook::velox::exec {
 
@@ -45,17 +50,84 @@ TableScan::TableScan(
           tableHandle_->connectorId())),
       readBatchSize_(driverCtx_->task->queryCtx()
                          ->queryConfig()
-                         .preferredOutputBatchRows()) {
+                         .preferredOutputBatchRows()),
+      scaleDriversEnabled_(driverCtx_->task->queryCtx()
+                               ->queryConfig()
+                               .tableScanScaleDriversEnabled()) {
   connector_ = connector::getConnector(tableHandle_->connectorId());
 }
 
+bool ScanDriverThrottle::enter(int32_t driverId, ContinueFuture& future) {
+  std::lock_guard<std::mutex> l(mutex_);
+  if (driverId < numActive_) {
+    return true;
+  }
+  auto [promise, semiFuture] =
+      makeVeloxContinuePromiseContract("ScanDriverThrottle::enter");
+  parked_.emplace_back(driverId, std::move(promise));
+  future = std::move(semiFuture);
+  return false;
+}
+
+void ScanDriverThrottle::updateAfterSplit(
+    uint64_t ioWaitNanos,
+    uint64_t wallNanos,
+    int32_t queuedSplits) {
+  std::vector<ContinuePromise> toRelease;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    if (wallNanos == 0) {
+      return;
+    }
+    const double ioFraction = static_cast<double>(ioWaitNanos) / wallNanos;
+    if (ioFraction >= kIoBoundFraction && queuedSplits > 0 &&
+        numActive_ < numDrivers_) {
+      ++numActive_;
+      for (auto it = parked_.begin(); it != parked_.end();) {
+        if (it->first < numActive_) {
+          toRelease.push_back(std::move(it->second));
+          it = parked_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    } else if (ioFraction <= kIoBoundFraction / 5 && numActive_ > 1) {
+      --numActive_;
+    }
+  }
+  for (auto& promise : toRelease) {
+    promise.setValue();
+  }
+}
+
+void ScanDriverThrottle::releaseAll() {
+  std::vector<std::pair<int32_t, ContinuePromise>> parked;
+  {
+    std::lock_guard<std::mutex> l(mutex_);
+    numActive_ = numDrivers_;
+    parked.swap(parked_);
+  }
+  for (auto& pair : parked) {
+    pair.second.setValue();
+  }
+}
+
 RowVectorPtr TableScan::getOutput() {
   if (noMoreSplits_) {
     return nullptr;
   }
+  if (scaleDriversEnabled_ && throttle_ == nullptr) {
+    throttle_ = driverCtx_->task->getScanDriverThrottle(
+        planNodeId(), driverCtx_->task->numDrivers(driverCtx_->driver));
+  }
 
   for (;;) {
     if (needNewSplit_) {
+      if (throttle_ != nullptr &&
+          !throttle_->enter(driverCtx_->driverId, blockingFuture_)) {
+        blockingReason_ = BlockingReason::kWaitForSplit;
+        return nullptr;
+      }
       exec::Split split;
       blockingReason_ = driverCtx_->task->getSplitOrFuture(
           driverCtx_->splitGroupId,
@@ -70,6 +142,9 @@ RowVectorPtr TableScan::getOutput() {
 
       if (!split.hasConnectorSplit()) {
         noMoreSplits_ = true;
+        if (throttle_ != nullptr) {
+          throttle_->releaseAll();
+        }
         if (dataSource_) {
           auto connectorStats = dataSource_->runtimeStats();
           auto lockedStats = stats_.wlock();
@@ -93,6 +168,7 @@ RowVectorPtr TableScan::getOutput() {
 
       const auto& connectorSplit = split.connectorSplit;
       needNewSplit_ = false;
+      splitStartMicros_ = getCurrentTimeMicro();
 
       VELOX_CHECK_EQ(
           connector_->connectorId(),
@@ -141,10 +217,12 @@ RowVectorPtr TableScan::getOutput() {
       }
       ++stats_.wlock()->numSplits;
 
+      // Use the row size estimated by the connector when available, otherwise
+      // fall back to the average output row size measured so far.
       auto estimatedRowSize = dataSource_->estimatedRowSize();
       readBatchSize_ =
           estimatedRowSize == connector::DataSource::kUnknownRowSize
-          ? outputBatchRows()
+          ? adaptiveOutputBatchRows()
           : outputBatchRows(estimatedRowSize);
     }
 
@@ -160,7 +238,8 @@ RowVectorPtr TableScan::getOutput() {
          },
          &debugString_});
 
-    auto dataOptional = dataSource_->next(readBatchSize_, blockingFuture_);
+    const auto maxRows = std::min<int64_t>(readBatchSize_, rowBudget_);
+    auto dataOptional = dataSource_->next(maxRows, blockingFuture_);
     checkPreload();
 
     {
@@ -202,11 +281,31 @@ RowVectorPtr TableScan::getOutput() {
       }
     }
 
+    if (throttle_ != nullptr) {
+      updateThrottle();
+    }
     driverCtx_->task->splitFinished();
     needNewSplit_ = true;
   }
 }
 
+void TableScan::updateThrottle() {
+  uint64_t ioWaitNanos = 0;
+  for (const auto& [name, counter] : dataSource_->runtimeStats()) {
+    if (name == "ioWaitNanos") {
+      ioWaitNanos = counter.value;
+      break;
+    }
+  }
+  const auto splitIoWaitNanos = ioWaitNanos - throttleIoWaitNanos_;
+  throttleIoWaitNanos_ = ioWaitNanos;
+  throttle_->updateAfterSplit(
+      splitIoWaitNanos,
+      (getCurrentTimeMicro() - splitStartMicros_) * 1'000,
+      driverCtx_->task->numQueuedSplits(
+          driverCtx_->splitGroupId, planNodeId()));
+}
+
 void TableScan::preload(std::shared_ptr<connector::ConnectorSplit> split) {
   // The AsyncSource returns a unique_ptr to the shared_ptr of the
   // DataSource. The callback may outlive the Task, hence it captures
@@ -22,6 +22,58 @@ DECLARE_int32(split_preload_per_driver);
 
 namespace facebook::velox::exec {
 
+/// Scales the number of drivers concurrently executing one table scan
+/// node. All TableScans of the node share an instance via the Task.
+/// Drivers with ids at or above the active limit park before taking
+/// their next split and continue when the limit is raised again. The
+/// limit is raised while finished splits are IO bound and splits are
+/// queued and lowered while they are CPU bound, so cold, IO bound
+/// phases of a scan run with more drivers than warm, CPU bound ones.
+class ScanDriverThrottle {
+ public:
+  explicit ScanDriverThrottle(int32_t numDrivers)
+      : numDrivers_(numDrivers), numActive_(numDrivers) {}
+
+  /// Returns true if driver 'driverId' may take a split. Otherwise
+  /// sets 'future' to complete when the driver is reactivated and
+  /// returns false.
+  bool enter(int32_t driverId, ContinueFuture& future);
+
+  /// Adjusts the active driver limit from the IO profile of a
+  /// finished split: 'ioWaitNanos' out of 'wallNanos' were spent
+  /// waiting for IO and 'queuedSplits' splits are waiting to be
+  /// picked up.
+  void updateAfterSplit(
+      uint64_t ioWaitNanos,
+      uint64_t wallNanos,
+      int32_t queuedSplits);
+
+  /// Reactivates all parked drivers, e.g. when there are no more
+  /// splits, so that they observe the end of the scan.
+  void releaseAll();
+
+  int32_t numActiveDrivers() const {
+    std::lock_guard<std::mutex> l(mutex_);
+    return numActive_;
+  }
+
+ private:
+  // A split with at least this fraction of its wall time in IO wait
+  // counts as IO bound, with at most a fifth of this as CPU bound.
+  static constexpr double kIoBoundFraction = 0.5;
+
+  const int32_t numDrivers_;
+
+  mutable std::mutex mutex_;
+
+  // Number of drivers that may take splits, between 1 and
+  // 'numDrivers_'.
+  int32_t numActive_;
+
+  // Promises of parked drivers together with their driver ids.
+  std::vector<std::pair<int32_t, ContinuePromise>> parked_;
+};
+
 class TableScan : public SourceOperator {
  public:
   TableScan(
@@ -49,6 +101,14 @@ class TableScan : public SourceOperator {
       column_index_t outputChannel,
       const std::shared_ptr<common::Filter>& filter) override;
 
+  bool canAddRowBudget() const override {
+    return true;
+  }
+
+  void addRowBudget(int64_t numRows) override {
+    rowBudget_ = numRows;
+  }
+
   /// Returns process-wide cumulative IO wait time for all table
   /// scan. This is the blocked time. If running entirely from memory
   /// this would be 0.
@@ -65,10 +125,16 @@ class TableScan : public SourceOperator {
 
   // Sets 'split->dataSource' to be a Asyncsource that makes a
   // DataSource to read 'split'. This source will be prepared in the
-  // background on the executor of the connector. If the DataSource is
-  // needed before prepare is done, it will be made when needed.
+  // background on the executor of the connector. Preparing reads the
+  // file footer and schedules loads of the first stripe's selected
+  // columns into the data cache, so the split is warm by the time the
+  // driver gets to it. If the DataSource is needed before prepare is
+  // done, it will be made when needed.
   void preload(std::shared_ptr<connector::ConnectorSplit> split);
 
+  // Reports the IO profile of the finished split to 'throttle_'.
+  void updateThrottle();
+
   // Process-wide IO wait time.
   static std::atomic<uint64_t> ioWaitNanos_;
 
@@ -107,11 +173,32 @@ class TableScan : public SourceOperator {
 
   int32_t readBatchSize_;
 
+  // Cap on the number of rows to read in one batch, set from the
+  // remaining row count of a downstream Limit. The scan still reads all
+  // its splits; the cap only keeps the tail of a short query from
+  // decoding rows past the limit.
+  int64_t rowBudget_{std::numeric_limits<int64_t>::max()};
+
   // String shown in ExceptionContext inside DataSource and LazyVector loading.
   std::string debugString_;
 
   // The last value of the IO wait time of 'this' that has been added to the
   // global static 'ioWaitNanos_'.
   uint64_t lastIoWaitNanos_{0};
+
+  // True if the number of concurrently scanning drivers adapts to the
+  // IO profile of the scan. See ScanDriverThrottle.
+  const bool scaleDriversEnabled_;
+
+  // Shared throttle of the scan node, set on first getOutput() when
+  // 'scaleDriversEnabled_'.
+  std::shared_ptr<ScanDriverThrottle> throttle_;
+
+  // Time when the current split was assigned, for the IO fraction
+  // reported to 'throttle_'.
+  uint64_t splitStartMicros_{0};
+
+  // The IO wait time of 'this' already reported to 'throttle_'.
+  uint64_t throttleIoWaitNanos_{0};
 };
 } // namespace facebook::velox::exec
@@ -21,6 +21,7 @@
 #include "velox/codegen/Codegen.h"
 #include "velox/common/file/FileSystems.h"
 #include "velox/common/time/Timer.h"
+#include "velox/core/QueryFeedback.h"
 #include "velox/exec/Exchange.h"
 #include "velox/exec/HashBuild.h"
 #include "velox/exec/LocalPlanner.h"
@@ -28,6 +29,7 @@
 #include "velox/exec/NestedLoopJoinBuild.h"
 #include "velox/exec/OperatorUtils.h"
 #include "velox/exec/PartitionedOutputBufferManager.h"
+#include "velox/exec/TableScan.h"
 #include "velox/exec/Task.h"
 #if CODEGEN_ENABLED == 1
 #include "velox/experimental/codegen/CodegenLogger.h"
@@ -260,7 +262,11 @@ Task::Task(
       consumerSupplier_(std::move(consumerSupplier)),
       onError_(onError),
       splitsStates_(buildSplitStates(planFragment_.planNode)),
-      bufferManager_(PartitionedOutputBufferManager::getInstance()) {}
+      bufferManager_(PartitionedOutputBufferManager::getInstance()) {
+  if (queryCtx_->queryConfig().taskTraceEnabled()) {
+    tracer_ = std::make_unique<TaskTracer>();
+  }
+}
 
 Task::~Task() {
   try {
@@ -274,9 +280,37 @@ Task::~Task() {
                  << " destructor: " << e.what();
   }
 
+  maybeRecordQueryFeedback();
   removeSpillDirectoryIfExists();
 }
 
+void Task::maybeRecordQueryFeedback() {
+  if (state_ != TaskState::kFinished) {
+    return;
+  }
+  const auto templateKey = queryCtx_->queryConfig().queryTemplateKey();
+  if (templateKey.empty()) {
+    return;
+  }
+  core::QueryFeedbackStats feedback;
+  feedback.numExecutions = 1;
+  bool spilled = false;
+  bool abandonedPartialAggregation = false;
+  for (const auto& pipeline : taskStats_.pipelineStats) {
+    for (const auto& operatorStats : pipeline.operatorStats) {
+      feedback.outputRows += operatorStats.outputPositions;
+      feedback.outputVectors += operatorStats.outputVectors;
+      spilled |= operatorStats.spilledBytes > 0;
+      abandonedPartialAggregation |=
+          operatorStats.runtimeStats.count("abandonedPartialAggregation") > 0;
+    }
+  }
+  feedback.numSpilledExecutions = spilled ? 1 : 0;
+  feedback.numAbandonedPartialAggregations =
+      abandonedPartialAggregation ? 1 : 0;
+  core::QueryFeedbackRegistry::instance()->record(templateKey, feedback);
+}
+
 uint64_t Task::timeSinceStartMsLocked() const {
   if (taskStats_.executionStartTimeMs == 0UL) {
     return 0UL;
@@ -944,8 +978,19 @@ void Task::ensureSplitGroupsAreBeingProcessedLocked(
 
   while (numRunningSplitGroups_ < concurrentSplitGroups_ and
          not queuedSplitGroups_.empty()) {
-    const uint32_t splitGroupId = queuedSplitGroups_.front();
-    queuedSplitGroups_.pop();
+    // Start the queued split group with the most splits received so far, so
+    // that skewed (fat) groups are picked up as early as possible. Ties are
+    // broken by the lowest group id to keep the choice deterministic.
+    auto candidate = queuedSplitGroups_.begin();
+    for (auto it = std::next(candidate); it != queuedSplitGroups_.end();
+         ++it) {
+      if (it->second > candidate->second ||
+          (it->second == candidate->second && it->first < candidate->first)) {
+        candidate = it;
+      }
+    }
+    const uint32_t splitGroupId = candidate->first;
+    queuedSplitGroups_.erase(candidate);
 
     std::vector<std::shared_ptr<Driver>> drivers;
     drivers.reserve(numDriversPerSplitGroup_);
@@ -1072,11 +1117,18 @@ std::unique_ptr<ContinuePromise> Task::addSplitLocked(
   // Also add that split group to the set of 'seen' split groups.
   if (seenSplitGroups_.find(splitGroupId) == seenSplitGroups_.end()) {
     seenSplitGroups_.emplace(splitGroupId);
-    queuedSplitGroups_.push(splitGroupId);
+    queuedSplitGroups_.emplace(splitGroupId, 0);
     auto self = shared_from_this();
     // We might have some free driver slots to process this split group.
     ensureSplitGroupsAreBeingProcessedLocked(self);
   }
+  // Track how many splits the group accumulates while queued. This is the
+  // observed group size the scheduler uses to start the largest pending
+  // group first.
+  auto queuedIt = queuedSplitGroups_.find(splitGroupId);
+  if (queuedIt != queuedSplitGroups_.end()) {
+    ++queuedIt->second;
+  }
   return addSplitToStoreLocked(
       splitsState.groupSplitsStores[splitGroupId], std::move(split));
 }
@@ -1283,6 +1335,30 @@ void Task::multipleSplitsFinished(int32_t numSplits) {
   }
 }
 
+std::shared_ptr<ScanDriverThrottle> Task::getScanDriverThrottle(
+    const core::PlanNodeId& planNodeId,
+    int32_t numDrivers) {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto& throttle = scanThrottles_[planNodeId];
+  if (throttle == nullptr) {
+    throttle = std::make_shared<ScanDriverThrottle>(numDrivers);
+  }
+  return throttle;
+}
+
+int32_t Task::numQueuedSplits(
+    uint32_t splitGroupId,
+    const core::PlanNodeId& planNodeId) {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = splitsStates_.find(planNodeId);
+  if (it == splitsStates_.end()) {
+    return 0;
+  }
+  auto& stores = it->second.groupSplitsStores;
+  auto storeIt = stores.find(splitGroupId);
+  return storeIt == stores.end() ? 0 : storeIt->second.splits.size();
+}
+
 bool Task::isGroupedExecution() const {
   return planFragment_.isGroupedExecution();
 }
@@ -1638,9 +1714,24 @@ ContinueFuture Task::terminate(TaskState terminalState) {
   stateChangeNotifier.notify();
 
   // Get the stats and free the resources of Drivers that were not on
-  // thread.
-  for (auto& driver : offThreadDrivers) {
-    driver->closeByTask();
+  // thread. If deferred teardown is enabled, this runs on an executor
+  // thread so that freeing large operator state, e.g. hash tables,
+  // does not add to query latency. The drivers reference the Task, so
+  // the Task and its pools stay alive until the teardown is done.
+  if (!offThreadDrivers.empty()) {
+    if (queryCtx_->isExecutorSupplied() &&
+        queryCtx_->queryConfig().taskDeferredTeardownEnabled()) {
+      queryCtx_->executor()->add(
+          [drivers = std::move(offThreadDrivers)]() mutable {
+            for (auto& driver : drivers) {
+              driver->closeByTask();
+            }
+          });
+    } else {
+      for (auto& driver : offThreadDrivers) {
+        driver->closeByTask();
+      }
+    }
   }
 
   // We continue all Drivers waiting for promises known to the
@@ -1794,6 +1885,10 @@ TaskStats Task::taskStats() const {
   return taskStats;
 }
 
+std::string Task::traceJson() const {
+  return tracer_ == nullptr ? "" : tracer_->toJson(taskId_);
+}
+
 uint64_t Task::timeSinceStartMs() const {
   std::lock_guard<std::mutex> l(mutex_);
   return timeSinceStartMsLocked();
@@ -1888,7 +1983,8 @@ std::shared_ptr<MergeSource> Task::addLocalMergeSource(
     uint32_t splitGroupId,
     const core::PlanNodeId& planNodeId,
     const RowTypePtr& rowType) {
-  auto source = MergeSource::createLocalMergeSource();
+  auto source = MergeSource::createLocalMergeSource(
+      queryCtx()->queryConfig().mergeSourceCoalesceBytes());
   splitGroupStates_[splitGroupId].localMergeSources[planNodeId].push_back(
       source);
   return source;
@@ -22,6 +22,7 @@
 #include "velox/exec/Split.h"
 #include "velox/exec/TaskStats.h"
 #include "velox/exec/TaskStructs.h"
+#include "velox/exec/TaskTracer.h"
 #include "velox/vector/ComplexVector.h"
 
 namespace facebook::velox::exec {
@@ -30,6 +31,7 @@ class PartitionedOutputBufferManager;
 
 class HashJoinBridge;
 class NestedLoopJoinBridge;
+class ScanDriverThrottle;
 class Task : public std::enable_shared_from_this<Task> {
  public:
   /// Creates a task to execute a plan fragment, but doesn't start execution
@@ -252,6 +254,16 @@ class Task : public std::enable_shared_from_this<Task> {
   /// structure.
   TaskStats taskStats() const;
 
+  /// Returns the execution tracer or nullptr if tracing is not enabled
+  /// via QueryConfig::kTaskTraceEnabled.
+  TaskTracer* tracer() const {
+    return tracer_.get();
+  }
+
+  /// Returns the collected execution trace in the Chrome trace event
+  /// JSON format, or an empty string if tracing is not enabled.
+  std::string traceJson() const;
+
   /// Returns time (ms) since the task execution started or zero, if not
   /// started.
   uint64_t timeSinceStartMs() const;
@@ -341,6 +353,20 @@ class Task : public std::enable_shared_from_this<Task> {
 
   void multipleSplitsFinished(int32_t numSplits);
 
+  /// Returns the scan driver throttle for 'planNodeId', creating it
+  /// with 'numDrivers' drivers on first use. Shared by the TableScans
+  /// of the node to scale the number of concurrently scanning
+  /// drivers.
+  std::shared_ptr<ScanDriverThrottle> getScanDriverThrottle(
+      const core::PlanNodeId& planNodeId,
+      int32_t numDrivers);
+
+  /// Returns the number of splits queued for 'planNodeId' in split
+  /// group 'splitGroupId'.
+  int32_t numQueuedSplits(
+      uint32_t splitGroupId,
+      const core::PlanNodeId& planNodeId);
+
   /// Adds a MergeSource for the specified splitGroupId and planNodeId.
   std::shared_ptr<MergeSource> addLocalMergeSource(
       uint32_t splitGroupId,
@@ -646,6 +672,11 @@ class Task : public std::enable_shared_from_this<Task> {
   /// occurred. This should only be called inside mutex_ protection.
   std::string errorMessageLocked() const;
 
+  // Records execution stats of a successfully finished task into the
+  // process-wide query feedback registry if the query sets a template
+  // key. Called from the destructor when all stats are final.
+  void maybeRecordQueryFeedback();
+
   class MemoryReclaimer : public memory::MemoryReclaimer {
    public:
     static std::unique_ptr<memory::MemoryReclaimer> create(
@@ -959,10 +990,13 @@ class Task : public std::enable_shared_from_this<Task> {
   /// process in total.
   std::unordered_set<uint32_t> seenSplitGroups_;
   /// Split groups for which we have received splits but haven't started
-  /// processing. It grows with arrival of the 1st split of a previously not
-  /// seen split group and depletes with creating new sets of drivers to process
-  /// queued split groups.
-  std::queue<uint32_t> queuedSplitGroups_;
+  /// processing, with the number of splits received for each so far. It grows
+  /// with arrival of the 1st split of a previously not seen split group and
+  /// depletes with creating new sets of drivers to process queued split
+  /// groups. The split counts are the observed sizes of the split groups:
+  /// when a processing slot frees up, the largest queued group is started
+  /// first so that fat groups do not serialize the tail of the task.
+  std::unordered_map<uint32_t, uint64_t> queuedSplitGroups_;
 
   TaskState state_ = TaskState::kRunning;
 
@@ -972,6 +1006,11 @@ class Task : public std::enable_shared_from_this<Task> {
   /// manage splits of the plan nodes that expect splits.
   std::unordered_map<core::PlanNodeId, SplitsState> splitsStates_;
 
+  /// Scan driver throttles keyed by scan node id. Lazily created by
+  /// TableScan when scan driver scaling is enabled.
+  std::unordered_map<core::PlanNodeId, std::shared_ptr<ScanDriverThrottle>>
+      scanThrottles_;
+
   // Promises that are fulfilled when the task is completed (terminated).
   std::vector<ContinuePromise> taskCompletionPromises_;
 
@@ -981,6 +1020,10 @@ class Task : public std::enable_shared_from_this<Task> {
 
   TaskStats taskStats_;
 
+  // Collects execution trace events. Set only when tracing is enabled
+  // for the query.
+  std::unique_ptr<TaskTracer> tracer_;
+
   /// Stores inter-operator state (exchange, bridges) per split group.
   /// During ungrouped execution we use the [0] entry in this vector.
   std::unordered_map<uint32_t, SplitGroupState> splitGroupStates_;
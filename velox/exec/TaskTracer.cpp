@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/exec/TaskTracer.h"
+
+#include <folly/container/F14Set.h>
+#include <folly/json.h>
+
+#include <fmt/format.h>
+
+namespace facebook::velox::exec {
+
+namespace {
+// Chrome traces identify tracks by pid/tid. All events of a task share
+// one pid; the tid packs the pipeline and driver ids so that every
+// driver gets its own track.
+constexpr int32_t kTracePid = 1;
+
+int64_t trackId(int32_t pipelineId, int32_t driverId) {
+  return (static_cast<int64_t>(pipelineId) << 16) | driverId;
+}
+} // namespace
+
+void TaskTracer::addSlice(
+    int32_t pipelineId,
+    int32_t driverId,
+    std::string name,
+    std::string category,
+    uint64_t startUs,
+    uint64_t endUs) {
+  std::lock_guard<std::mutex> l(mutex_);
+  events_.push_back(
+      {pipelineId,
+       driverId,
+       std::move(name),
+       std::move(category),
+       'X',
+       startUs,
+       endUs - startUs});
+}
+
+void TaskTracer::addInstant(
+    int32_t pipelineId,
+    int32_t driverId,
+    std::string name,
+    std::string category,
+    uint64_t timeUs) {
+  std::lock_guard<std::mutex> l(mutex_);
+  events_.push_back(
+      {pipelineId,
+       driverId,
+       std::move(name),
+       std::move(category),
+       'i',
+       timeUs,
+       0});
+}
+
+std::string TaskTracer::toJson(const std::string& processName) const {
+  folly::dynamic traceEvents = folly::dynamic::array;
+  traceEvents.push_back(folly::dynamic::object("name", "process_name")(
+      "ph", "M")("pid", kTracePid)(
+      "args", folly::dynamic::object("name", processName)));
+  std::lock_guard<std::mutex> l(mutex_);
+  folly::F14FastSet<int64_t> namedTracks;
+  for (const auto& event : events_) {
+    const auto tid = trackId(event.pipelineId, event.driverId);
+    if (namedTracks.insert(tid).second) {
+      traceEvents.push_back(folly::dynamic::object("name", "thread_name")(
+          "ph", "M")("pid", kTracePid)("tid", tid)(
+          "args",
+          folly::dynamic::object(
+              "name",
+              fmt::format(
+                  "pipeline {} driver {}",
+                  event.pipelineId,
+                  event.driverId))));
+    }
+    folly::dynamic entry = folly::dynamic::object("name", event.name)(
+        "cat", event.category)("ph", std::string(1, event.phase))(
+        "ts", event.startUs)("pid", kTracePid)("tid", tid);
+    if (event.phase == 'X') {
+      entry["dur"] = event.durationUs;
+    } else {
+      // Scope instant events to their track.
+      entry["s"] = "t";
+    }
+    traceEvents.push_back(std::move(entry));
+  }
+  return folly::toJson(folly::dynamic::object("traceEvents", traceEvents));
+}
+
+} // namespace facebook::velox::exec
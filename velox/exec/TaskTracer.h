@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace facebook::velox::exec {
+
+/// Collects timestamped execution events of a single Task and renders
+/// them in the Chrome trace event JSON format, which chrome://tracing
+/// and Perfetto can open directly. The trace shows operator calls,
+/// blocked intervals and spill events of every driver on a shared
+/// timeline, so pipeline stalls can be seen instead of being
+/// reconstructed from logs. A Task creates a tracer only when
+/// QueryConfig::kTaskTraceEnabled is set, hence recording sites skip
+/// all work with a single null check when tracing is off. Thread safe.
+class TaskTracer {
+ public:
+  /// Records a completed time slice, e.g. one getOutput() call or a
+  /// blocked interval of a driver. Timestamps are epoch microseconds.
+  void addSlice(
+      int32_t pipelineId,
+      int32_t driverId,
+      std::string name,
+      std::string category,
+      uint64_t startUs,
+      uint64_t endUs);
+
+  /// Records a point-in-time event, e.g. a spill.
+  void addInstant(
+      int32_t pipelineId,
+      int32_t driverId,
+      std::string name,
+      std::string category,
+      uint64_t timeUs);
+
+  /// Renders the collected events as a Chrome trace JSON string.
+  /// 'processName' labels the whole trace, typically the task id.
+  /// Each pipeline/driver pair shows as a separate named track.
+  std::string toJson(const std::string& processName) const;
+
+ private:
+  struct Event {
+    int32_t pipelineId;
+    int32_t driverId;
+    std::string name;
+    std::string category;
+    // 'X' for a complete slice, 'i' for an instant event.
+    char phase;
+    uint64_t startUs;
+    uint64_t durationUs;
+  };
+
+  mutable std::mutex mutex_;
+  std::vector<Event> events_;
+};
+
+} // namespace facebook::velox::exec
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #include "velox/exec/TopN.h"
+#include "velox/common/base/SimdUtil.h"
 #include "velox/exec/ContainerRowSerde.h"
 #include "velox/vector/FlatVector.h"
 
@@ -36,7 +37,11 @@ TopN::TopN(
           topNNode->sortingOrders(),
           data_.get()),
       topRows_(comparator_),
-      decodedVectors_(outputType_->children().size()) {}
+      decodedVectors_(outputType_->children().size()),
+      firstKeyChannel_(exprToChannel(
+          topNNode->sortingKeys()[0].get(),
+          topNNode->outputType())),
+      firstKeyAscending_(topNNode->sortingOrders()[0].isAscending()) {}
 
 void TopN::addInput(RowVectorPtr input) {
   // TODO Decode keys first, then decode the rest only for passing positions
@@ -44,26 +49,105 @@ void TopN::addInput(RowVectorPtr input) {
     decodedVectors_[col].decode(*input->childAt(col));
   }
 
-  for (auto row = 0; row < input->size(); ++row) {
-    char* newRow = nullptr;
-    if (topRows_.size() < count_) {
-      newRow = data_->newRow();
-    } else {
-      char* topRow = topRows_.top();
-
-      if (!comparator_(decodedVectors_, row, topRow)) {
-        continue;
-      }
-      topRows_.pop();
-      // Reuse the topRow's memory.
-      newRow = data_->initializeRow(topRow, true /* reuse */);
+  if (topRows_.size() >= count_ && prefilterInput(input->size())) {
+    for (auto row : candidateRows_) {
+      addRow(row);
     }
+    return;
+  }
+
+  for (auto row = 0; row < input->size(); ++row) {
+    addRow(row);
+  }
+}
 
-    for (auto col = 0; col < input->childrenSize(); ++col) {
-      data_->store(decodedVectors_[col], row, newRow, col);
+void TopN::addRow(vector_size_t row) {
+  char* newRow = nullptr;
+  if (topRows_.size() < count_) {
+    newRow = data_->newRow();
+  } else {
+    char* topRow = topRows_.top();
+
+    if (!comparator_(decodedVectors_, row, topRow)) {
+      return;
     }
+    topRows_.pop();
+    // Reuse the topRow's memory.
+    newRow = data_->initializeRow(topRow, true /* reuse */);
+  }
+
+  for (auto col = 0; col < decodedVectors_.size(); ++col) {
+    data_->store(decodedVectors_[col], row, newRow, col);
+  }
+
+  topRows_.push(newRow);
+}
+
+bool TopN::prefilterInput(vector_size_t numRows) {
+  if (firstKeyChannel_ == kConstantChannel) {
+    return false;
+  }
+  const auto& decoded = decodedVectors_[firstKeyChannel_];
+  if (!decoded.isIdentityMapping() || decoded.mayHaveNulls()) {
+    return false;
+  }
 
-    topRows_.push(newRow);
+  const char* topRow = topRows_.top();
+  const auto column = data_->columnAt(firstKeyChannel_);
+  if (RowContainer::isNullAt(topRow, column.nullByte(), column.nullMask())) {
+    // A null threshold cannot be compared with a plain key compare.
+    return false;
+  }
+
+  switch (outputType_->childAt(firstKeyChannel_)->kind()) {
+    case TypeKind::SMALLINT:
+      prefilterTyped<int16_t>(
+          decoded.data<int16_t>(),
+          numRows,
+          *reinterpret_cast<const int16_t*>(topRow + column.offset()));
+      return true;
+    case TypeKind::INTEGER:
+      prefilterTyped<int32_t>(
+          decoded.data<int32_t>(),
+          numRows,
+          *reinterpret_cast<const int32_t*>(topRow + column.offset()));
+      return true;
+    case TypeKind::BIGINT:
+      prefilterTyped<int64_t>(
+          decoded.data<int64_t>(),
+          numRows,
+          *reinterpret_cast<const int64_t*>(topRow + column.offset()));
+      return true;
+    default:
+      return false;
+  }
+}
+
+template <typename T>
+void TopN::prefilterTyped(const T* keys, vector_size_t numRows, T threshold) {
+  candidateRows_.clear();
+
+  // A row whose first key strictly loses to the threshold key cannot make it
+  // into the top rows; a row that ties on the first key may still win on a
+  // later key, so it survives and goes through the full comparator. The
+  // threshold only tightens while a batch is inserted, so filtering with the
+  // batch-start threshold is conservative.
+  const auto thresholdBatch = xsimd::batch<T>::broadcast(threshold);
+  constexpr int32_t kBatch = xsimd::batch<T>::size;
+  vector_size_t row = 0;
+  for (; row + kBatch <= numRows; row += kBatch) {
+    auto keyBatch = xsimd::batch<T>::load_unaligned(keys + row);
+    uint16_t passing = firstKeyAscending_
+        ? simd::toBitMask(keyBatch <= thresholdBatch)
+        : simd::toBitMask(keyBatch >= thresholdBatch);
+    while (passing) {
+      candidateRows_.push_back(row + bits::getAndClearLastSetBit(passing));
+    }
+  }
+  for (; row < numRows; ++row) {
+    if (firstKeyAscending_ ? keys[row] <= threshold : keys[row] >= threshold) {
+      candidateRows_.push_back(row);
+    }
   }
 }
 
@@ -44,6 +44,20 @@ class TopN : public Operator {
   bool isFinished() override;
 
  private:
+  // Adds the input row at 'row' of the decoded input to 'topRows_' if it
+  // belongs to the top rows seen so far.
+  void addRow(vector_size_t row);
+
+  // When 'topRows_' is full, fills 'candidateRows_' with the indices of the
+  // input rows whose first sort key does not already lose to the key of the
+  // current count_-th row and returns true. Returns false if pre-filtering
+  // does not apply, e.g. the first key is not a fixed-width integer, the
+  // decoded key vector is not flat or has nulls or the threshold key is null.
+  bool prefilterInput(vector_size_t numRows);
+
+  template <typename T>
+  void prefilterTyped(const T* keys, vector_size_t numRows, T threshold);
+
   const int32_t count_;
 
   bool finished_ = false;
@@ -65,5 +79,14 @@ class TopN : public Operator {
 
   std::vector<DecodedVector> decodedVectors_;
   vector_size_t outputBatchSize_;
+
+  // Channel and sort order of the first sort key, used to pre-filter input
+  // batches against the first key of the current count_-th row once
+  // 'topRows_' is full.
+  column_index_t firstKeyChannel_;
+  bool firstKeyAscending_;
+
+  // Reusable vector of input row indices that survive the pre-filter.
+  std::vector<vector_size_t> candidateRows_;
 };
 } // namespace facebook::velox::exec
@@ -17,6 +17,39 @@
 
 namespace facebook::velox::exec {
 
+namespace {
+// Returns a 64-bit value whose unsigned order matches the sort order of
+// 'value' given 'ascending'. Flipping the sign bit makes the unsigned order
+// of the bits match the signed order of the values.
+uint64_t encodeKeyPrefix(int64_t value, bool ascending) {
+  constexpr uint64_t kSignBit = 1ULL << 63;
+  const uint64_t prefix = static_cast<uint64_t>(value) ^ kSignBit;
+  return ascending ? prefix : ~prefix;
+}
+
+template <typename T>
+void fillKeyPrefixes(
+    const DecodedVector& decoded,
+    vector_size_t numInput,
+    bool ascending,
+    uint64_t nullPrefix,
+    std::vector<uint64_t>& prefixes) {
+  for (vector_size_t i = 0; i < numInput; ++i) {
+    if (decoded.isNullAt(i)) {
+      prefixes[i] = nullPrefix;
+      continue;
+    }
+    int64_t value;
+    if constexpr (std::is_same_v<T, Date>) {
+      value = decoded.valueAt<Date>(i).days();
+    } else {
+      value = decoded.valueAt<T>(i);
+    }
+    prefixes[i] = encodeKeyPrefix(value, ascending);
+  }
+}
+} // namespace
+
 TopNRowNumber::TopNRowNumber(
     int32_t operatorId,
     DriverCtx* driverCtx,
@@ -67,6 +100,25 @@ TopNRowNumber::TopNRowNumber(
     resultProjections_.emplace_back(0, inputType_->size());
     results_.resize(1);
   }
+
+  firstKeyChannel_ = exprToChannel(node->sortingKeys()[0].get(), inputType_);
+  firstKeyAscending_ = node->sortingOrders()[0].isAscending();
+  firstKeyNullsFirst_ = node->sortingOrders()[0].isNullsFirst();
+  if (firstKeyChannel_ == kConstantChannel) {
+    keyPrefixSupported_ = false;
+  } else {
+    switch (inputType_->childAt(firstKeyChannel_)->kind()) {
+      case TypeKind::TINYINT:
+      case TypeKind::SMALLINT:
+      case TypeKind::INTEGER:
+      case TypeKind::BIGINT:
+      case TypeKind::DATE:
+        keyPrefixSupported_ = true;
+        break;
+      default:
+        keyPrefixSupported_ = false;
+    }
+  }
 }
 
 void TopNRowNumber::addInput(RowVectorPtr input) {
@@ -76,6 +128,8 @@ void TopNRowNumber::addInput(RowVectorPtr input) {
     decodedVectors_[i].decode(*input->childAt(i));
   }
 
+  computeInputPrefixes(numInput);
+
   if (table_) {
     SelectivityVector rows(numInput);
     table_->prepareForProbe(*lookup_, input, rows, false);
@@ -115,6 +169,13 @@ void TopNRowNumber::processInputRow(
   if (topRows.size() < limit_) {
     newRow = data_->newRow();
   } else {
+    if (keyPrefixSupported_ &&
+        inputPrefixes_[index] > partition.thresholdPrefix) {
+      // The row already loses to the partition's worst kept row on the first
+      // sort key alone. Drop it without running the full comparator.
+      return;
+    }
+
     char* topRow = topRows.top();
 
     if (!comparator_(decodedVectors_, index, topRow)) {
@@ -134,6 +195,75 @@ void TopNRowNumber::processInputRow(
   }
 
   topRows.push(newRow);
+
+  if (keyPrefixSupported_ && topRows.size() == limit_) {
+    updateThreshold(partition);
+  }
+}
+
+void TopNRowNumber::computeInputPrefixes(vector_size_t numInput) {
+  if (!keyPrefixSupported_) {
+    return;
+  }
+
+  inputPrefixes_.resize(numInput);
+  const auto& decoded = decodedVectors_[firstKeyChannel_];
+  const uint64_t nullPrefix = firstKeyNullsFirst_ ? 0 : ~0ULL;
+  switch (inputType_->childAt(firstKeyChannel_)->kind()) {
+    case TypeKind::TINYINT:
+      fillKeyPrefixes<int8_t>(
+          decoded, numInput, firstKeyAscending_, nullPrefix, inputPrefixes_);
+      break;
+    case TypeKind::SMALLINT:
+      fillKeyPrefixes<int16_t>(
+          decoded, numInput, firstKeyAscending_, nullPrefix, inputPrefixes_);
+      break;
+    case TypeKind::INTEGER:
+      fillKeyPrefixes<int32_t>(
+          decoded, numInput, firstKeyAscending_, nullPrefix, inputPrefixes_);
+      break;
+    case TypeKind::BIGINT:
+      fillKeyPrefixes<int64_t>(
+          decoded, numInput, firstKeyAscending_, nullPrefix, inputPrefixes_);
+      break;
+    case TypeKind::DATE:
+      fillKeyPrefixes<Date>(
+          decoded, numInput, firstKeyAscending_, nullPrefix, inputPrefixes_);
+      break;
+    default:
+      VELOX_UNREACHABLE();
+  }
+}
+
+void TopNRowNumber::updateThreshold(TopRows& partition) {
+  const char* topRow = partition.rows.top();
+  const auto column = data_->columnAt(firstKeyChannel_);
+  if (RowContainer::isNullAt(topRow, column.nullByte(), column.nullMask())) {
+    partition.thresholdPrefix = firstKeyNullsFirst_ ? 0 : ~0ULL;
+    return;
+  }
+
+  int64_t value;
+  switch (inputType_->childAt(firstKeyChannel_)->kind()) {
+    case TypeKind::TINYINT:
+      value = *reinterpret_cast<const int8_t*>(topRow + column.offset());
+      break;
+    case TypeKind::SMALLINT:
+      value = *reinterpret_cast<const int16_t*>(topRow + column.offset());
+      break;
+    case TypeKind::INTEGER:
+      value = *reinterpret_cast<const int32_t*>(topRow + column.offset());
+      break;
+    case TypeKind::BIGINT:
+      value = *reinterpret_cast<const int64_t*>(topRow + column.offset());
+      break;
+    case TypeKind::DATE:
+      value = reinterpret_cast<const Date*>(topRow + column.offset())->days();
+      break;
+    default:
+      VELOX_UNREACHABLE();
+  }
+  partition.thresholdPrefix = encodeKeyPrefix(value, firstKeyAscending_);
 }
 
 void TopNRowNumber::noMoreInput() {
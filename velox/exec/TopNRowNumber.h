@@ -71,6 +71,13 @@ class TopNRowNumber : public Operator {
     std::priority_queue<char*, std::vector<char*, StlAllocator<char*>>, Compare>
         rows;
 
+    /// 64-bit sortable prefix of the first sort key of the top (worst kept)
+    /// row. Maintained only when the partition holds 'limit' rows and the
+    /// first key's type supports prefix encoding. An input row whose prefix
+    /// is strictly greater cannot make it into the partition and is discarded
+    /// without running the full comparator.
+    uint64_t thresholdPrefix{0};
+
     TopRows(HashStringAllocator* allocator, RowComparator& comparator)
         : rows{{comparator}, StlAllocator<char*>(allocator)} {}
   };
@@ -87,6 +94,16 @@ class TopNRowNumber : public Operator {
       vector_size_t index,
       TopRows& partition);
 
+  /// Fills 'inputPrefixes_' with the sortable prefixes of the first sort key
+  /// for 'numInput' decoded input rows. No-op if the key's type does not
+  /// support prefix encoding.
+  void computeInputPrefixes(vector_size_t numInput);
+
+  /// Updates 'partition.thresholdPrefix' from the first sort key of its top
+  /// row. Called when the partition reaches 'limit' rows and whenever its top
+  /// row changes afterwards.
+  void updateThreshold(TopRows& partition);
+
   /// Returns next partition to add to output or nullptr if there are no
   /// partitions left.
   TopRows* nextPartition();
@@ -126,6 +143,16 @@ class TopNRowNumber : public Operator {
 
   std::vector<DecodedVector> decodedVectors_;
 
+  /// Channel and sort order of the first sort key and whether its type
+  /// supports 64-bit sortable prefix encoding.
+  column_index_t firstKeyChannel_;
+  bool firstKeyAscending_;
+  bool firstKeyNullsFirst_;
+  bool keyPrefixSupported_;
+
+  /// Reusable buffer of the first sort key prefixes of the current input.
+  std::vector<uint64_t> inputPrefixes_;
+
   bool finished_{false};
 
   /// Maximum number of rows in the output batch.
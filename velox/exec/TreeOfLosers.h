@@ -53,6 +53,22 @@ class MergeStream {
   virtual int32_t compare(const MergeStream& /*other*/) const {
     VELOX_UNSUPPORTED();
   }
+
+  // True if keyPrefix() is ordered consistently with compare().
+  // TreeOfLosers uses the prefix fast path only if all streams return
+  // true.
+  virtual bool supportsKeyPrefix() const {
+    return false;
+  }
+
+  // Returns a 64-bit prefix of the sort key of the first value. A
+  // stream with a lower first value must not return a higher prefix
+  // than a stream with a higher one, and differing prefixes must order
+  // the same way as compare(). Streams with equal prefixes are ordered
+  // with a full compare. hasData() must be true.
+  virtual uint64_t keyPrefix() const {
+    return 0;
+  }
 };
 
 // Implements a tree of losers algorithm for merging ordered
@@ -61,6 +77,12 @@ class MergeStream {
 // the lowest value as first value from the set of Streams. It
 // returns nullptr when all Streams are at end. The order is
 // determined by Stream::operator<.
+//
+// If all streams support keyPrefix(), the first-value prefixes are
+// kept in a flat array and most compares on the path to the root
+// resolve with a single integer compare instead of a virtual call
+// into the streams. This matters for wide merges, e.g. hundreds of
+// spill runs, where the merge loop is compare-bound.
 template <typename Stream, typename TIndex = uint16_t>
 class TreeOfLosers {
  public:
@@ -100,6 +122,11 @@ class TreeOfLosers {
     }
     values_.resize(firstStream_, kEmpty);
     equals_.resize(firstStream_, false);
+    usePrefixes_ = std::all_of(
+        streams_.begin(), streams_.end(), [](const auto& stream) {
+          return stream->supportsKeyPrefix();
+        });
+    keyPrefixes_.resize(streams_.size(), 0);
   }
 
   // Returns the stream with the lowest first element. The caller is
@@ -113,9 +140,12 @@ class TreeOfLosers {
       }
       lastIndex_ = first(0);
     } else {
-      lastIndex_ = propagate(
-          parent(firstStream_ + lastIndex_),
-          streams_[lastIndex_]->hasData() ? lastIndex_ : kEmpty);
+      TIndex last = kEmpty;
+      if (streams_[lastIndex_]->hasData()) {
+        last = lastIndex_;
+        updateKeyPrefix(last);
+      }
+      lastIndex_ = propagate(parent(firstStream_ + lastIndex_), last);
     }
     return lastIndex_ == kEmpty ? nullptr : streams_[lastIndex_].get();
   }
@@ -137,9 +167,12 @@ class TreeOfLosers {
       }
       result = firstWithEquals(0);
     } else {
-      result = propagateWithEquals(
-          parent(firstStream_ + lastIndex_),
-          streams_[lastIndex_]->hasData() ? lastIndex_ : kEmpty);
+      TIndex last = kEmpty;
+      if (streams_[lastIndex_]->hasData()) {
+        last = lastIndex_;
+        updateKeyPrefix(last);
+      }
+      result = propagateWithEquals(parent(firstStream_ + lastIndex_), last);
     }
     lastIndex_ = result.first;
 
@@ -155,10 +188,47 @@ class TreeOfLosers {
     return std::pair<TIndex, bool>{index, flag};
   }
 
+  // Caches the key prefix of the first value of 'stream'. The stream
+  // must have data. No-op if some stream does not support prefixes, in
+  // which case all prefixes stay equal and compares always go to the
+  // streams.
+  FOLLY_ALWAYS_INLINE void updateKeyPrefix(TIndex stream) {
+    if (usePrefixes_) {
+      keyPrefixes_[stream] = streams_[stream]->keyPrefix();
+    }
+  }
+
+  // Returns true if the first value of stream 'left' is less than that
+  // of 'right'. Decided by the cached key prefixes when these differ.
+  FOLLY_ALWAYS_INLINE bool isLess(TIndex left, TIndex right) const {
+    const auto leftPrefix = keyPrefixes_[left];
+    const auto rightPrefix = keyPrefixes_[right];
+    if (leftPrefix != rightPrefix) {
+      return leftPrefix < rightPrefix;
+    }
+    return *streams_[left] < *streams_[right];
+  }
+
+  // Compares the first values of streams 'left' and 'right' with
+  // compare() semantics. Decided by the cached key prefixes when these
+  // differ.
+  FOLLY_ALWAYS_INLINE int32_t compareStreams(TIndex left, TIndex right) const {
+    const auto leftPrefix = keyPrefixes_[left];
+    const auto rightPrefix = keyPrefixes_[right];
+    if (leftPrefix != rightPrefix) {
+      return leftPrefix < rightPrefix ? -1 : 1;
+    }
+    return streams_[left]->compare(*streams_[right]);
+  }
+
   TIndex first(TIndex node) {
     if (node >= firstStream_) {
-      return streams_[node - firstStream_]->hasData() ? node - firstStream_
-                                                      : kEmpty;
+      const TIndex stream = node - firstStream_;
+      if (!streams_[stream]->hasData()) {
+        return kEmpty;
+      }
+      updateKeyPrefix(stream);
+      return stream;
     }
     auto left = first(leftChild(node));
     auto right = first(rightChild(node));
@@ -166,7 +236,7 @@ class TreeOfLosers {
       return right;
     } else if (right == kEmpty) {
       return left;
-    } else if (*streams_[left] < *streams_[right]) {
+    } else if (isLess(left, right)) {
       values_[node] = right;
       return left;
     } else {
@@ -188,7 +258,7 @@ class TreeOfLosers {
       } else if (UNLIKELY(value == kEmpty)) {
         value = values_[node];
         values_[node] = kEmpty;
-      } else if (*streams_[values_[node]] < *streams_[value]) {
+      } else if (isLess(values_[node], value)) {
         // The node had the lower value, the value stays here and the previous
         // value goes up.
         std::swap(value, values_[node]);
@@ -206,11 +276,13 @@ class TreeOfLosers {
 
   IndexAndFlag firstWithEquals(TIndex node) {
     if (node >= firstStream_) {
-      VELOX_DCHECK_LT(node - firstStream_, streams_.size());
-      return indexAndFlag(
-          streams_[node - firstStream_]->hasData() ? node - firstStream_
-                                                   : kEmpty,
-          false);
+      const TIndex stream = node - firstStream_;
+      VELOX_DCHECK_LT(stream, streams_.size());
+      if (!streams_[stream]->hasData()) {
+        return indexAndFlag(kEmpty, false);
+      }
+      updateKeyPrefix(stream);
+      return indexAndFlag(stream, false);
     }
     auto left = firstWithEquals(leftChild(node));
     auto right = firstWithEquals(rightChild(node));
@@ -219,7 +291,7 @@ class TreeOfLosers {
     } else if (right.first == kEmpty) {
       return left;
     } else {
-      auto comparison = streams_[left.first]->compare(*streams_[right.first]);
+      auto comparison = compareStreams(left.first, right.first);
       if (comparison == 0) {
         values_[node] = right.first;
         equals_[node] = right.second;
@@ -253,8 +325,7 @@ class TreeOfLosers {
         values_[node] = kEmpty;
         equals_[node] = false;
       } else {
-        auto comparison =
-            streams_[values_[node]]->compare(*streams_[value.first]);
+        auto comparison = compareStreams(values_[node], value.first);
         if (comparison == 0) {
           // the value goes up with equals set.
           value.second = true;
@@ -296,6 +367,11 @@ class TreeOfLosers {
   // A byte vector is in this case faster than one of bool.
   std::vector<uint8_t> equals_;
   std::vector<std::unique_ptr<Stream>> streams_;
+  // Key prefix of the first value of each stream, indexed by stream
+  // index. All zero if 'usePrefixes_' is false.
+  std::vector<uint64_t> keyPrefixes_;
+  // True if all streams support keyPrefix().
+  bool usePrefixes_{false};
   TIndex lastIndex_ = kEmpty;
   int32_t firstStream_;
 };
@@ -131,9 +131,11 @@ RowVectorPtr Unnest::getOutput() {
   auto* rawRepeatedIndices = repeatedIndices->asMutable<vector_size_t>();
   vector_size_t index = 0;
   for (auto row = 0; row < size; ++row) {
-    for (auto i = 0; i < rawMaxSizes[row]; i++) {
-      rawRepeatedIndices[index++] = row;
-    }
+    std::fill(
+        rawRepeatedIndices + index,
+        rawRepeatedIndices + index + rawMaxSizes[row],
+        row);
+    index += rawMaxSizes[row];
   }
 
   // Wrap "replicated" columns in a dictionary using 'repeatedIndices'.
@@ -154,9 +156,19 @@ RowVectorPtr Unnest::getOutput() {
     BufferPtr elementIndices = allocateIndices(numElements, pool());
     auto* rawElementIndices = elementIndices->asMutable<vector_size_t>();
 
-    auto nulls =
-        AlignedBuffer::allocate<bool>(numElements, pool(), bits::kNotNull);
-    auto rawNulls = nulls->asMutable<uint64_t>();
+    // Nulls are only needed to pad rows whose array (or map) is null or
+    // shorter than the max cardinality across the unnested columns. The
+    // buffer is allocated on first use so that the common case of equal
+    // cardinalities produces a dictionary without a nulls buffer.
+    BufferPtr nulls;
+    uint64_t* rawNulls = nullptr;
+    auto ensureNulls = [&]() {
+      if (nulls == nullptr) {
+        nulls =
+            AlignedBuffer::allocate<bool>(numElements, pool(), bits::kNotNull);
+        rawNulls = nulls->asMutable<uint64_t>();
+      }
+    };
 
     // Make dictionary index for elements column since they may be out of order.
     index = 0;
@@ -172,19 +184,23 @@ RowVectorPtr Unnest::getOutput() {
           identityMapping = false;
         }
 
-        for (auto i = 0; i < unnestSize; i++) {
-          rawElementIndices[index++] = offset + i;
-        }
+        std::iota(
+            rawElementIndices + index,
+            rawElementIndices + index + unnestSize,
+            offset);
+        index += unnestSize;
 
-        for (auto i = unnestSize; i < maxSize; ++i) {
-          bits::setNull(rawNulls, index++, true);
+        if (unnestSize < maxSize) {
+          ensureNulls();
+          bits::fillBits(rawNulls, index, index + maxSize - unnestSize, false);
+          index += maxSize - unnestSize;
         }
       } else if (maxSize > 0) {
         identityMapping = false;
 
-        for (auto i = 0; i < maxSize; ++i) {
-          bits::setNull(rawNulls, index++, true);
-        }
+        ensureNulls();
+        bits::fillBits(rawNulls, index, index + maxSize, false);
+        index += maxSize;
       }
     }
 
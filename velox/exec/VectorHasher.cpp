@@ -55,7 +55,8 @@ namespace facebook::velox::exec {
 
 namespace {
 template <TypeKind Kind>
-uint64_t hashOne(DecodedVector& decoded, vector_size_t index) {
+uint64_t
+hashOne(DecodedVector& decoded, vector_size_t index, bool useCrcHash = false) {
   if (Kind == TypeKind::ROW || Kind == TypeKind::ARRAY ||
       Kind == TypeKind::MAP) {
     // Virtual function call for complex type.
@@ -63,6 +64,16 @@ uint64_t hashOne(DecodedVector& decoded, vector_size_t index) {
   }
   // Inlined for scalars.
   using T = typename KindToFlatVector<Kind>::HashRowType;
+  if constexpr (std::is_integral_v<T>) {
+    if (useCrcHash) {
+      // CRC32-C leaves the upper 32 bits zero. Multiply by an odd
+      // constant to spread the entropy over the word for bucket
+      // selection and normalized key mixing.
+      return simd::crc32U64(
+                 0, static_cast<uint64_t>(decoded.valueAt<T>(index))) *
+          0x9E3779B97F4A7C15UL;
+    }
+  }
   return folly::hasher<T>()(decoded.valueAt<T>(index));
 }
 } // namespace
@@ -76,7 +87,7 @@ void VectorHasher::hashValues(
   if (decoded_.isConstantMapping()) {
     auto hash = decoded_.isNullAt(rows.begin())
         ? kNullHash
-        : hashOne<Kind>(decoded_, rows.begin());
+        : hashOne<Kind>(decoded_, rows.begin(), useCrcHash_);
     rows.applyToSelected([&](vector_size_t row) {
       result[row] = mix ? bits::hashMix(result[row], hash) : hash;
     });
@@ -86,7 +97,7 @@ void VectorHasher::hashValues(
         result[row] = mix ? bits::hashMix(result[row], kNullHash) : kNullHash;
         return;
       }
-      auto hash = hashOne<Kind>(decoded_, row);
+      auto hash = hashOne<Kind>(decoded_, row, useCrcHash_);
       result[row] = mix ? bits::hashMix(result[row], hash) : hash;
     });
   } else {
@@ -100,7 +111,7 @@ void VectorHasher::hashValues(
       auto baseIndex = decoded_.index(row);
       uint64_t hash = cachedHashes_[baseIndex];
       if (hash == kNullHash) {
-        hash = hashOne<Kind>(decoded_, row);
+        hash = hashOne<Kind>(decoded_, row, useCrcHash_);
         cachedHashes_[baseIndex] = hash;
       }
       result[row] = mix ? bits::hashMix(result[row], hash) : hash;
@@ -544,7 +555,7 @@ void VectorHasher::precompute(const BaseVector& value) {
   const SelectivityVector rows(1, true);
   decoded_.decode(value, rows);
   precomputedHash_ =
-      VELOX_DYNAMIC_TYPE_DISPATCH(hashOne, typeKind_, decoded_, 0);
+      VELOX_DYNAMIC_TYPE_DISPATCH(hashOne, typeKind_, decoded_, 0, useCrcHash_);
 }
 
 void VectorHasher::analyze(
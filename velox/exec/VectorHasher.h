@@ -190,6 +190,14 @@ class VectorHasher {
   void
   hash(const SelectivityVector& rows, bool mix, raw_vector<uint64_t>& result);
 
+  // Selects hardware CRC32-C hashing of integral values in hash() in
+  // place of the default folly::hasher mix. All hashers that must
+  // agree on a hash, e.g. the build and probe sides of a join or the
+  // producers feeding one exchange, must use the same setting.
+  void setUseCrcHash(bool useCrcHash) {
+    useCrcHash_ = useCrcHash;
+  }
+
   // Computes a hash for 'rows' using precomputedHash_ (just like from a const
   // vector) and stores it in 'result'.
   // If 'mix' is true, mixes the hash with existing value in 'result'.
@@ -257,6 +265,19 @@ class VectorHasher {
     uniqueValuesStorage_.clear();
   }
 
+  // Same as resetStats() but also clears the range bounds and the sticky
+  // overflow flags so that the values can be re-analyzed from scratch, e.g.
+  // from the rows of an existing table.
+  void resetStatsFull() {
+    resetStats();
+    hasRange_ = false;
+    rangeOverflow_ = false;
+    distinctOverflow_ = false;
+    distinctStringsBytes_ = 0;
+    min_ = 1;
+    max_ = 0;
+  }
+
   // Sets 'this' to range mode and adds 'reservePct' values to the
   // range, half below and half above, staying within bounds of the
   // data type. In this mode, hashed values become offsets from the
@@ -543,6 +564,10 @@ class VectorHasher {
   DecodedVector decoded_;
   raw_vector<uint64_t> cachedHashes_;
 
+  // True if hash() uses hardware CRC32-C for integral values. See
+  // setUseCrcHash().
+  bool useCrcHash_{false};
+
   // Single precomputed hash for constant partition keys.
   uint64_t precomputedHash_{0};
 
@@ -53,6 +53,7 @@ Window::Window(
           windowNode->id(),
           "Window"),
       numInputColumns_(windowNode->sources()[0]->outputType()->size()),
+      inputsSorted_(windowNode->inputsSorted()),
       data_(std::make_unique<RowContainer>(
           windowNode->sources()[0]->outputType()->children(),
           pool())),
@@ -162,6 +163,16 @@ void Window::addInput(RowVectorPtr input) {
     for (auto col = 0; col < input->childrenSize(); ++col) {
       data_->store(decodedInputVectors_[col], row, newRow, col);
     }
+
+    if (inputsSorted_) {
+      // The rows arrive ordered by (partition keys + order by keys), so the
+      // full sort is not needed. Record the rows in arrival order and detect
+      // partition boundaries on the fly.
+      if (sortedRows_.empty() || !inSamePartition(sortedRows_.back(), newRow)) {
+        partitionStartRows_.push_back(sortedRows_.size());
+      }
+      sortedRows_.push_back(newRow);
+    }
   }
   numRows_ += inputRows_.size();
 }
@@ -185,7 +196,26 @@ inline bool Window::compareRowsWithKeys(
   return false;
 }
 
+inline bool Window::inSamePartition(const char* lhs, const char* rhs) {
+  for (auto& key : partitionKeyInfo_) {
+    if (data_->compare(
+            lhs,
+            rhs,
+            key.first,
+            {key.second.isNullsFirst(), key.second.isAscending(), false})) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void Window::createPeerAndFrameBuffers() {
+  if (peerStartBuffer_ != nullptr) {
+    // Already created. In streaming mode the buffers are created lazily by
+    // the first getOutput() call with output available.
+    return;
+  }
+
   // TODO: This computation needs to be revised. It only takes into account
   // the input columns size. We need to also account for the output columns.
   numRowsPerOutput_ = outputBatchRows(data_->estimateRowSize());
@@ -266,12 +296,19 @@ void Window::noMoreInput() {
     return;
   }
 
-  // At this point we have seen all the input rows. We can start
-  // outputting rows now.
-  // However, some preparation is needed. The rows should be
-  // separated into partitions and sort by ORDER BY keys within
-  // the partition. This will order the rows for getOutput().
-  sortPartitions();
+  if (inputsSorted_) {
+    // The rows arrived in output order and the partition boundaries were
+    // recorded in addInput(). Add the sentinel for the last partition which
+    // is complete now.
+    partitionStartRows_.push_back(numRows_);
+  } else {
+    // At this point we have seen all the input rows. We can start
+    // outputting rows now.
+    // However, some preparation is needed. The rows should be
+    // separated into partitions and sort by ORDER BY keys within
+    // the partition. This will order the rows for getOutput().
+    sortPartitions();
+  }
   createPeerAndFrameBuffers();
 }
 
@@ -577,12 +614,37 @@ void Window::callApplyLoop(
   }
 }
 
+void Window::releaseOutputPartitions() {
+  auto firstActiveRow = partitionStartRows_[currentPartition_];
+  if (firstActiveRow > numErasedRows_) {
+    data_->eraseRows(folly::Range<char**>(
+        sortedRows_.data() + numErasedRows_, firstActiveRow - numErasedRows_));
+    numErasedRows_ = firstActiveRow;
+  }
+}
+
 RowVectorPtr Window::getOutput() {
-  if (finished_ || !noMoreInput_) {
+  if (finished_) {
+    return nullptr;
+  }
+
+  vector_size_t numRowsLeft;
+  if (noMoreInput_) {
+    numRowsLeft = numRows_ - numProcessedRows_;
+  } else if (inputsSorted_ && !partitionStartRows_.empty()) {
+    // With sorted inputs, the rows of all partitions but the last seen one
+    // are final and can be output before the remaining input arrives. The
+    // last partition could still grow with the next input batch.
+    numRowsLeft = partitionStartRows_.back() - numProcessedRows_;
+  } else {
+    return nullptr;
+  }
+  if (numRowsLeft == 0) {
     return nullptr;
   }
 
-  auto numRowsLeft = numRows_ - numProcessedRows_;
+  createPeerAndFrameBuffers();
+
   auto numOutputRows = std::min(numRowsPerOutput_, numRowsLeft);
   auto result = std::dynamic_pointer_cast<RowVector>(
       BaseVector::create(outputType_, numOutputRows, operatorCtx_->pool()));
@@ -612,7 +674,11 @@ RowVectorPtr Window::getOutput() {
     result->childAt(j) = windowOutputs[j - numInputColumns_];
   }
 
-  finished_ = (numProcessedRows_ == sortedRows_.size());
+  if (inputsSorted_) {
+    releaseOutputPartitions();
+  }
+
+  finished_ = noMoreInput_ && (numProcessedRows_ == sortedRows_.size());
   return result;
 }
 
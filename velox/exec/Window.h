@@ -32,6 +32,12 @@ namespace facebook::velox::exec {
 /// It is also sorted in the order required for the WindowFunction
 /// to process it.
 ///
+/// If the WindowNode reports that the input is already sorted on the
+/// (partition_by keys + order_by keys), the operator streams instead:
+/// partition boundaries are detected as the input arrives, each complete
+/// partition is output before all input is seen and its rows are freed
+/// right after, so only the partition being accumulated is materialized.
+///
 /// We will revise this algorithm in the future using a HashTable based
 /// approach pending some profiling results.
 class Window : public Operator {
@@ -128,6 +134,16 @@ class Window : public Operator {
       const char* rhs,
       const std::vector<std::pair<column_index_t, core::SortOrder>>& keys);
 
+  // Helper function to compare the partition keys of the rows at lhs and rhs
+  // pointers for equality. Used in streaming mode to detect partition
+  // boundaries in the sorted input.
+  inline bool inSamePartition(const char* lhs, const char* rhs);
+
+  // Frees the rows of all partitions output completely so far in streaming
+  // mode. The bulk of the operator's memory is in these rows, so releasing
+  // them keeps only the active partitions in memory.
+  void releaseOutputPartitions();
+
   // Function to compute window function values for the current output
   // buffer. The buffer has numOutputRows number of rows. windowOutputs
   // has the vectors for window function columns.
@@ -161,6 +177,10 @@ class Window : public Operator {
   bool finished_ = false;
   const vector_size_t numInputColumns_;
 
+  // True if the input is sorted on (partition keys + order by keys) already
+  // and the operator streams one partition at a time. See the class comment.
+  const bool inputsSorted_;
+
   // The Window operator needs to see all the input rows before starting
   // any function computation. As the Window operators gets input rows
   // we store the rows in the RowContainer (data_).
@@ -251,7 +271,11 @@ class Window : public Operator {
   // Current partition being output. The partition might be
   // output across multiple getOutput() calls so this needs to
   // be tracked in the operator.
-  vector_size_t currentPartition_;
+  vector_size_t currentPartition_ = 0;
+
+  // Number of leading rows of sortedRows_ erased from data_ after their
+  // partitions were fully output. Only used in streaming mode.
+  vector_size_t numErasedRows_ = 0;
 
   // When traversing input partition rows, the peers are the rows
   // with the same values for the ORDER BY clause. These rows
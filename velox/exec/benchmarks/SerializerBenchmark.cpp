@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <folly/Benchmark.h>
+#include <folly/init/Init.h>
+
+#include "velox/common/memory/ByteStream.h"
+#include "velox/common/time/Timer.h"
+#include "velox/dwio/common/tests/utils/BatchMaker.h"
+#include "velox/serializers/PrestoSerializer.h"
+#include "velox/serializers/UnsafeRowSerializer.h"
+#include "velox/vector/tests/utils/VectorTestBase.h"
+
+DEFINE_int32(num_vectors, 10, "Number of vectors in each dataset");
+DEFINE_int32(rows_per_vector, 10000, "Number of rows in each vector");
+
+/// Benchmarks serialize and deserialize throughput of PrestoVectorSerde
+/// and UnsafeRowVectorSerde over datasets covering flat, dictionary and
+/// constant encodings, different null densities and nested types. Prints
+/// a GB/s table over the serialized sizes so releases can be compared.
+
+using namespace facebook::velox;
+using namespace facebook::velox::test;
+using facebook::velox::test::BatchMaker;
+
+namespace {
+
+struct Counters {
+  int64_t serializedBytes{0};
+  int64_t serializeUsec{0};
+  int64_t deserializeUsec{0};
+
+  std::string toString() const {
+    if (serializeUsec == 0 || deserializeUsec == 0) {
+      return "n/a";
+    }
+    auto gbps = [&](int64_t usec) {
+      return (serializedBytes / (1024 * 1024 * 1024.0)) / (usec / 1.0e6);
+    };
+    return fmt::format(
+        "serialize {:.2f} GB/s deserialize {:.2f} GB/s ({} MB)",
+        gbps(serializeUsec),
+        gbps(deserializeUsec),
+        serializedBytes >> 20);
+  }
+};
+
+class SerializerBenchmark : public VectorTestBase {
+ public:
+  // Serializes and deserializes each of 'vectors' with 'serde', adding
+  // the serialized size and the time spent in each direction to
+  // 'counters'.
+  void run(
+      const std::vector<RowVectorPtr>& vectors,
+      VectorSerde& serde,
+      Counters& counters) {
+    auto rowType = asRowType(vectors[0]->type());
+    std::vector<std::string> serialized;
+    serialized.reserve(vectors.size());
+    auto start = getCurrentTimeMicro();
+    for (const auto& vector : vectors) {
+      StreamArena arena(pool_.get());
+      auto serializer =
+          serde.createSerializer(rowType, vector->size(), &arena, nullptr);
+      serializer->append(vector);
+      std::ostringstream out;
+      OStreamOutputStream outStream(&out);
+      serializer->flush(&outStream);
+      serialized.push_back(out.str());
+    }
+    counters.serializeUsec += getCurrentTimeMicro() - start;
+
+    start = getCurrentTimeMicro();
+    for (const auto& data : serialized) {
+      ByteStream byteStream;
+      ByteRange byteRange{
+          reinterpret_cast<uint8_t*>(const_cast<char*>(data.data())),
+          static_cast<int32_t>(data.size()),
+          0};
+      byteStream.resetInput({byteRange});
+      RowVectorPtr result;
+      serde.deserialize(&byteStream, pool_.get(), rowType, &result, nullptr);
+      folly::doNotOptimizeAway(result);
+      counters.serializedBytes += data.size();
+    }
+    counters.deserializeUsec += getCurrentTimeMicro() - start;
+  }
+
+  std::vector<RowVectorPtr> makeDataset(
+      const RowTypePtr& type,
+      std::function<RowVectorPtr(RowVectorPtr)> transform = nullptr) {
+    std::vector<RowVectorPtr> vectors;
+    for (auto i = 0; i < FLAGS_num_vectors; ++i) {
+      auto vector = std::dynamic_pointer_cast<RowVector>(
+          BatchMaker::createBatch(type, FLAGS_rows_per_vector, *pool_));
+      vectors.push_back(transform ? transform(vector) : vector);
+    }
+    return vectors;
+  }
+
+  // Returns a copy of 'vector' with every child wrapped in a dictionary
+  // with reversed indices.
+  RowVectorPtr wrapChildrenInDictionary(const RowVectorPtr& vector) {
+    auto size = vector->size();
+    std::vector<VectorPtr> children;
+    for (const auto& child : vector->children()) {
+      auto indices = makeIndicesInReverse(size);
+      children.push_back(
+          BaseVector::wrapInDictionary(nullptr, indices, size, child));
+    }
+    return makeRowVector(children);
+  }
+
+  // Returns a row vector of the same width as 'vector' with every child
+  // replaced by a constant of its first value.
+  RowVectorPtr wrapChildrenInConstant(const RowVectorPtr& vector) {
+    auto size = vector->size();
+    std::vector<VectorPtr> children;
+    for (const auto& child : vector->children()) {
+      children.push_back(BaseVector::wrapInConstant(size, 0, child));
+    }
+    return makeRowVector(children);
+  }
+
+  // Returns a copy of 'vector' with a null set on every 'nullEvery'th row
+  // of every child.
+  RowVectorPtr setChildNulls(const RowVectorPtr& vector, int32_t nullEvery) {
+    auto size = vector->size();
+    std::vector<VectorPtr> children;
+    for (const auto& child : vector->children()) {
+      auto copy = BaseVector::copy(*child);
+      for (auto row = 0; row < size; row += nullEvery) {
+        copy->setNull(row, true);
+      }
+      children.push_back(copy);
+    }
+    return makeRowVector(children);
+  }
+};
+
+SerializerBenchmark bm;
+
+serializer::presto::PrestoVectorSerde prestoSerde;
+serializer::spark::UnsafeRowVectorSerde unsafeSerde;
+
+std::vector<RowVectorPtr> flatNoNulls;
+std::vector<RowVectorPtr> flatFewNulls;
+std::vector<RowVectorPtr> flatHalfNulls;
+std::vector<RowVectorPtr> dict;
+std::vector<RowVectorPtr> constant;
+std::vector<RowVectorPtr> deep;
+
+Counters prestoFlatNoNullsCounters;
+Counters prestoFlatFewNullsCounters;
+Counters prestoFlatHalfNullsCounters;
+Counters prestoDictCounters;
+Counters prestoConstantCounters;
+Counters prestoDeepCounters;
+Counters unsafeFlatNoNullsCounters;
+Counters unsafeFlatFewNullsCounters;
+Counters unsafeFlatHalfNullsCounters;
+Counters unsafeDictCounters;
+Counters unsafeDeepCounters;
+
+BENCHMARK(prestoFlatNoNulls) {
+  bm.run(flatNoNulls, prestoSerde, prestoFlatNoNullsCounters);
+}
+
+BENCHMARK_RELATIVE(unsafeFlatNoNulls) {
+  bm.run(flatNoNulls, unsafeSerde, unsafeFlatNoNullsCounters);
+}
+
+BENCHMARK(prestoFlatFewNulls) {
+  bm.run(flatFewNulls, prestoSerde, prestoFlatFewNullsCounters);
+}
+
+BENCHMARK_RELATIVE(unsafeFlatFewNulls) {
+  bm.run(flatFewNulls, unsafeSerde, unsafeFlatFewNullsCounters);
+}
+
+BENCHMARK(prestoFlatHalfNulls) {
+  bm.run(flatHalfNulls, prestoSerde, prestoFlatHalfNullsCounters);
+}
+
+BENCHMARK_RELATIVE(unsafeFlatHalfNulls) {
+  bm.run(flatHalfNulls, unsafeSerde, unsafeFlatHalfNullsCounters);
+}
+
+BENCHMARK(prestoDict) {
+  bm.run(dict, prestoSerde, prestoDictCounters);
+}
+
+BENCHMARK_RELATIVE(unsafeDict) {
+  bm.run(dict, unsafeSerde, unsafeDictCounters);
+}
+
+BENCHMARK(prestoConstant) {
+  bm.run(constant, prestoSerde, prestoConstantCounters);
+}
+
+BENCHMARK(prestoDeep) {
+  bm.run(deep, prestoSerde, prestoDeepCounters);
+}
+
+BENCHMARK_RELATIVE(unsafeDeep) {
+  bm.run(deep, unsafeSerde, unsafeDeepCounters);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv);
+
+  auto flatType = ROW(
+      {{"c0", BIGINT()},
+       {"c1", INTEGER()},
+       {"c2", SMALLINT()},
+       {"c3", REAL()},
+       {"c4", DOUBLE()},
+       {"c5", VARCHAR()}});
+
+  auto deepType = ROW(
+      {{"c0", BIGINT()},
+       {"array_val", ARRAY(BIGINT())},
+       {"struct_val", ROW({{"s_int", INTEGER()}, {"s_string", VARCHAR()}})},
+       {"map_val", MAP(VARCHAR(), ARRAY(INTEGER()))}});
+
+  flatNoNulls = bm.makeDataset(flatType);
+  flatFewNulls = bm.makeDataset(flatType, [&](RowVectorPtr vector) {
+    return bm.setChildNulls(vector, 10);
+  });
+  flatHalfNulls = bm.makeDataset(flatType, [&](RowVectorPtr vector) {
+    return bm.setChildNulls(vector, 2);
+  });
+  dict = bm.makeDataset(flatType, [&](RowVectorPtr vector) {
+    return bm.wrapChildrenInDictionary(vector);
+  });
+  constant = bm.makeDataset(flatType, [&](RowVectorPtr vector) {
+    return bm.wrapChildrenInConstant(vector);
+  });
+  deep = bm.makeDataset(deepType);
+
+  folly::runBenchmarks();
+  std::cout
+      << "prestoFlatNoNulls: " << prestoFlatNoNullsCounters.toString()
+      << std::endl
+      << "unsafeFlatNoNulls: " << unsafeFlatNoNullsCounters.toString()
+      << std::endl
+      << "prestoFlatFewNulls: " << prestoFlatFewNullsCounters.toString()
+      << std::endl
+      << "unsafeFlatFewNulls: " << unsafeFlatFewNullsCounters.toString()
+      << std::endl
+      << "prestoFlatHalfNulls: " << prestoFlatHalfNullsCounters.toString()
+      << std::endl
+      << "unsafeFlatHalfNulls: " << unsafeFlatHalfNullsCounters.toString()
+      << std::endl
+      << "prestoDict: " << prestoDictCounters.toString() << std::endl
+      << "unsafeDict: " << unsafeDictCounters.toString() << std::endl
+      << "prestoConstant: " << prestoConstantCounters.toString() << std::endl
+      << "prestoDeep: " << prestoDeepCounters.toString() << std::endl
+      << "unsafeDeep: " << unsafeDeepCounters.toString() << std::endl;
+  return 0;
+}
@@ -177,6 +177,53 @@ BENCHMARK_RELATIVE(computeValueIdsFlatStrings) {
   benchmarkComputeValueIdsForStrings(true);
 }
 
+namespace {
+template <typename T>
+void benchmarkHash(bool useCrcHash) {
+  folly::BenchmarkSuspender suspender;
+  vector_size_t size = 1'000;
+  BenchmarkBase base;
+  VectorHasher hasher(CppToType<T>::create(), 0);
+  hasher.setUseCrcHash(useCrcHash);
+  auto values = base.vectorMaker().flatVector<T>(
+      size, [](vector_size_t row) { return row * 31 + 7; });
+
+  raw_vector<uint64_t> hashes(size);
+  SelectivityVector rows(size);
+  suspender.dismiss();
+
+  for (int i = 0; i < 10'000; i++) {
+    hasher.decode(*values, rows);
+    hasher.hash(rows, false, hashes);
+    folly::doNotOptimizeAway(hashes[size - 1]);
+  }
+}
+} // namespace
+
+BENCHMARK(hashBigintFolly) {
+  benchmarkHash<int64_t>(false);
+}
+
+BENCHMARK_RELATIVE(hashBigintCrc) {
+  benchmarkHash<int64_t>(true);
+}
+
+BENCHMARK(hashIntegerFolly) {
+  benchmarkHash<int32_t>(false);
+}
+
+BENCHMARK_RELATIVE(hashIntegerCrc) {
+  benchmarkHash<int32_t>(true);
+}
+
+BENCHMARK(hashSmallintFolly) {
+  benchmarkHash<int16_t>(false);
+}
+
+BENCHMARK_RELATIVE(hashSmallintCrc) {
+  benchmarkHash<int16_t>(true);
+}
+
 int main(int argc, char** argv) {
   folly::init(&argc, &argv);
   folly::runBenchmarks();
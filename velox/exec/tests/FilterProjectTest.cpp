@@ -15,6 +15,7 @@
  */
 #include "velox/dwio/common/tests/utils/BatchMaker.h"
 #include "velox/exec/PlanNodeStats.h"
+#include "velox/exec/tests/utils/AssertQueryBuilder.h"
 #include "velox/exec/tests/utils/OperatorTestBase.h"
 #include "velox/exec/tests/utils/PlanBuilder.h"
 
@@ -298,6 +299,89 @@ TEST_F(FilterProjectTest, filterProjectFused) {
       "SELECT c0, c1, c0 %100 + c1 % 50, c0 % 100 FROM tmp WHERE c0 % 10 < 5");
 }
 
+TEST_F(FilterProjectTest, compactLowSelectivityOutput) {
+  auto vector = makeRowVector({
+      makeFlatVector<int64_t>(1'000, [](auto row) { return row; }),
+      makeFlatVector<double>(1'000, [](auto row) { return row * 0.1; }),
+  });
+  createDuckDbTable({vector});
+
+  // 1% of the rows pass the filter.
+  auto plan = PlanBuilder()
+                  .values({vector})
+                  .filter("c0 % 100 = 0")
+                  .planNode();
+
+  AssertQueryBuilder(plan, duckDbQueryRunner_)
+      .config(core::QueryConfig::kFilterCompactOutputMaxPct, "10")
+      .assertResults("SELECT * FROM tmp WHERE c0 % 100 = 0");
+
+  auto makeCursor = [&](int32_t pct) {
+    CursorParameters params;
+    params.planNode = plan;
+    params.queryCtx = std::make_shared<core::QueryCtx>(driverExecutor_.get());
+    params.queryCtx->testingOverrideConfigUnsafe(
+        {{core::QueryConfig::kFilterCompactOutputMaxPct,
+          std::to_string(pct)}});
+    return std::make_unique<TaskCursor>(params);
+  };
+
+  // With compaction enabled the passing rows come back in flat vectors
+  // instead of dictionaries over the full-size input.
+  auto cursor = makeCursor(10);
+  while (cursor->moveNext()) {
+    const auto& batch = cursor->current();
+    ASSERT_EQ(10, batch->size());
+    for (const auto& child : batch->children()) {
+      EXPECT_EQ(VectorEncoding::Simple::FLAT, child->encoding());
+    }
+  }
+
+  // Compaction is off by default; the same plan returns dictionary-wrapped
+  // columns.
+  cursor = makeCursor(0);
+  while (cursor->moveNext()) {
+    for (const auto& child : cursor->current()->children()) {
+      EXPECT_EQ(VectorEncoding::Simple::DICTIONARY, child->encoding());
+    }
+  }
+}
+
+TEST_F(FilterProjectTest, projectChainFused) {
+  std::vector<RowVectorPtr> vectors;
+  for (int32_t i = 0; i < 10; ++i) {
+    auto vector = std::dynamic_pointer_cast<RowVector>(
+        BatchMaker::createBatch(rowType_, 100, *pool_));
+    vectors.push_back(vector);
+  }
+  createDuckDbTable(vectors);
+
+  // A chain of projections that only rename, reorder or duplicate the
+  // columns of the first one runs as a single FilterProject.
+  auto plan = PlanBuilder()
+                  .values(vectors)
+                  .filter("c0 % 10 < 9")
+                  .project({"c0", "c1", "c0 + c1 AS s"})
+                  .project({"s", "c1", "c0"})
+                  .project({"c0 AS a", "c1 AS b", "s", "s AS s2"})
+                  .planNode();
+
+  auto task = assertQuery(
+      plan, "SELECT c0, c1, c0 + c1, c0 + c1 FROM tmp WHERE c0 % 10 < 9");
+  // Values + one fused FilterProject.
+  EXPECT_EQ(2, task->taskStats().pipelineStats[0].operatorStats.size());
+
+  // A projection that drops a column of the previous one is not fused with
+  // it, since that could skip an expression whose evaluation fails.
+  plan = PlanBuilder()
+             .values(vectors)
+             .project({"c0", "c1", "c0 + c1 AS s"})
+             .project({"s", "c0"})
+             .planNode();
+  task = assertQuery(plan, "SELECT c0 + c1, c0 FROM tmp");
+  EXPECT_EQ(3, task->taskStats().pipelineStats[0].operatorStats.size());
+}
+
 TEST_F(FilterProjectTest, projectAndIdentityOverLazy) {
   // Verify that a lazy column which is a part of both an identity projection
   // and a regular projection is loaded correctly. This is done by running a
@@ -234,20 +234,22 @@ TEST_F(GroupedExecutionTest, groupedExecutionWithOutputBuffer) {
   // Finalize one split group (8) and wait until 3 drivers are finished.
   task->noMoreSplitsForGroup("0", 8);
   waitForFinishedDrivers(task, 9);
-  // As one split group is finished, another one should kick in, so 3 drivers.
+  // As one split group is finished, the queued group with the most splits (5)
+  // should kick in, so 3 drivers.
   EXPECT_EQ(9, task->numRunningDrivers());
   EXPECT_EQ(std::unordered_set<int32_t>({8}), getCompletedSplitGroups(task));
 
-  // Finalize the second split group (1) and wait until 18 drivers are finished.
-  task->noMoreSplitsForGroup("0", 1);
+  // Finalize the second split group (5) and wait until 18 drivers are
+  // finished.
+  task->noMoreSplitsForGroup("0", 5);
   waitForFinishedDrivers(task, 18);
 
   // As one split group is finished, another one should kick in, so 3 drivers.
   EXPECT_EQ(9, task->numRunningDrivers());
-  EXPECT_EQ(std::unordered_set<int32_t>({1, 8}), getCompletedSplitGroups(task));
+  EXPECT_EQ(std::unordered_set<int32_t>({5, 8}), getCompletedSplitGroups(task));
 
-  // Finalize the third split group (5) and wait until 27 drivers are finished.
-  task->noMoreSplitsForGroup("0", 5);
+  // Finalize the third split group (1) and wait until 27 drivers are finished.
+  task->noMoreSplitsForGroup("0", 1);
   waitForFinishedDrivers(task, 27);
 
   // No split groups should be processed at the moment, so 0 drivers.
@@ -286,6 +288,82 @@ TEST_F(GroupedExecutionTest, groupedExecutionWithOutputBuffer) {
   EXPECT_EQ(18, taskStats.pipelineStats[1].operatorStats[1].inputVectors);
 }
 
+// Here we test that a local merge and a final streaming aggregation on
+// top of scans of bucketed files run grouped execution as well, so each
+// bucket (split group) is aggregated in its own set of drivers with no
+// repartitioning.
+TEST_F(GroupedExecutionTest, groupedExecutionWithLocalMerge) {
+  // Create source file - we will read from it in splits of several groups.
+  auto vectors = makeVectors(2, 1'000);
+  auto filePath = TempFilePath::create();
+  writeToFile(filePath->path, vectors);
+
+  // Scan pipeline sorts its output, the second pipeline merges the sorted
+  // streams and runs a streaming aggregation on the merged order.
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  core::PlanNodeId tableScanNodeId;
+  auto scanNode = PlanBuilder(planNodeIdGenerator)
+                      .tableScan(rowType_)
+                      .capturePlanNodeId(tableScanNodeId)
+                      .orderBy({"c0"}, true)
+                      .planNode();
+  auto planFragment =
+      PlanBuilder(planNodeIdGenerator)
+          .localMerge({"c0"}, {scanNode})
+          .aggregation(
+              {"c0"},
+              {"c0"},
+              {"count(1)"},
+              {},
+              core::AggregationNode::Step::kSingle,
+              false)
+          .partitionedOutput({}, 1)
+          .planFragment();
+  planFragment.executionStrategy = core::ExecutionStrategy::kGrouped;
+  planFragment.groupedExecutionLeafNodeIds.emplace(tableScanNodeId);
+  planFragment.numSplitGroups = 10;
+  auto queryCtx = std::make_shared<core::QueryCtx>(executor_.get());
+  auto task =
+      exec::Task::create("0", std::move(planFragment), 0, std::move(queryCtx));
+  // 2 drivers max and 1 concurrent split group.
+  task->start(task, 2, 1);
+
+  // The local merge pipeline must run grouped execution too, so no drivers
+  // should be running before the first split group arrives.
+  EXPECT_EQ(0, task->numRunningDrivers());
+
+  // Add split for group (8): 2 scan drivers plus 1 merge driver.
+  task->addSplit("0", makeHiveSplitWithGroup(filePath->path, 8));
+  EXPECT_EQ(3, task->numRunningDrivers());
+  EXPECT_EQ(std::unordered_set<int32_t>{}, getCompletedSplitGroups(task));
+
+  // Add a split for another group (1), which should remain queued.
+  task->addSplit("0", makeHiveSplitWithGroup(filePath->path, 1));
+  EXPECT_EQ(3, task->numRunningDrivers());
+
+  // Finalize split group (8) and wait until its 3 drivers are finished.
+  task->noMoreSplitsForGroup("0", 8);
+  waitForFinishedDrivers(task, 3);
+  EXPECT_EQ(std::unordered_set<int32_t>({8}), getCompletedSplitGroups(task));
+
+  // Finalize split group (1) and wait until its 3 drivers are finished.
+  task->noMoreSplitsForGroup("0", 1);
+  waitForFinishedDrivers(task, 6);
+  EXPECT_EQ(std::unordered_set<int32_t>({1, 8}), getCompletedSplitGroups(task));
+
+  // Flag that we would have no more split groups.
+  task->noMoreSplits("0");
+
+  // 'Delete results' from output buffer triggers 'set all output consumed',
+  // which should finish the task.
+  auto outputBufferManager =
+      exec::PartitionedOutputBufferManager::getInstance().lock();
+  outputBufferManager->deleteResults(task->taskId(), 0);
+
+  // Task must be finished at this stage.
+  EXPECT_EQ(exec::TaskState::kFinished, task->state());
+}
+
 // Here we test various aspects of grouped/bucketed execution involving
 // output buffer and 3 pipelines.
 TEST_F(GroupedExecutionTest, groupedExecutionWithHashAndNestedLoopJoin) {
@@ -398,23 +476,24 @@ TEST_F(GroupedExecutionTest, groupedExecutionWithHashAndNestedLoopJoin) {
     // Finalize one split group (8) and wait until 3 drivers are finished.
     task->noMoreSplitsForGroup(probeScanNodeId, 8);
     waitForFinishedDrivers(task, 3 + 9);
-    // As one split group is finished, another one should kick in, so 9 drivers.
+    // As one split group is finished, the queued group with the most splits
+    // (5) should kick in, so 9 drivers.
     EXPECT_EQ(9, task->numRunningDrivers());
     EXPECT_EQ(std::unordered_set<int32_t>({8}), getCompletedSplitGroups(task));
 
-    // Finalize the second split group (1) and wait until 18 drivers are
+    // Finalize the second split group (5) and wait until 18 drivers are
     // finished.
-    task->noMoreSplitsForGroup(probeScanNodeId, 1);
+    task->noMoreSplitsForGroup(probeScanNodeId, 5);
     waitForFinishedDrivers(task, 3 + 18);
 
     // As one split group is finished, another one should kick in, so 9 drivers.
     EXPECT_EQ(9, task->numRunningDrivers());
     EXPECT_EQ(
-        std::unordered_set<int32_t>({1, 8}), getCompletedSplitGroups(task));
+        std::unordered_set<int32_t>({5, 8}), getCompletedSplitGroups(task));
 
-    // Finalize the third split group (5) and wait until 27 drivers are
+    // Finalize the third split group (1) and wait until 27 drivers are
     // finished.
-    task->noMoreSplitsForGroup(probeScanNodeId, 5);
+    task->noMoreSplitsForGroup(probeScanNodeId, 1);
     waitForFinishedDrivers(task, 3 + 27);
 
     // No split groups should be processed at the moment, so 0 drivers.
@@ -102,6 +102,7 @@ class HashJoinBridgeTest : public testing::Test,
           1,
           std::vector<CompareFlags>({}),
           tempDir_->path + "/Spill",
+          folly::io::CodecType::NO_COMPRESSION,
           *pool_));
       // Create a fake file to avoid too many exception logs in test when spill
       // file deletion fails.
@@ -337,6 +338,80 @@ TEST_P(HashJoinBridgeTest, withSpill) {
   }
 }
 
+TEST_P(HashJoinBridgeTest, tableCache) {
+  HashJoinTableCache::instance()->testingClear();
+  const std::string cacheKey = "query1.plan2.broadcast-splits";
+
+  auto keepAlive = std::make_shared<bool>(true);
+  auto builderBridge = createJoinBridge();
+  builderBridge->setTableCacheKey(cacheKey, keepAlive);
+  builderBridge->addBuilder();
+  builderBridge->start();
+  // Nothing is cached until the first build finishes.
+  ASSERT_FALSE(builderBridge->hasCachedTable());
+  builderBridge->setHashTable(createFakeHashTable(), {}, false);
+  ASSERT_TRUE(builderBridge->hasCachedTable());
+
+  // A bridge of a concurrent task with the same key picks up the shared
+  // table without building one.
+  auto sharerBridge = createJoinBridge();
+  sharerBridge->setTableCacheKey(cacheKey, nullptr);
+  sharerBridge->addBuilder();
+  sharerBridge->start();
+  ASSERT_TRUE(sharerBridge->hasCachedTable());
+  sharerBridge->setTableFromCache();
+
+  auto future = ContinueFuture::makeEmpty();
+  auto sharedResult = sharerBridge->tableOrFuture(&future);
+  ASSERT_TRUE(sharedResult.has_value());
+  auto builderResult = builderBridge->tableOrFuture(&future);
+  ASSERT_TRUE(builderResult.has_value());
+  ASSERT_EQ(builderResult->table.get(), sharedResult->table.get());
+
+  // A bridge with a different key does not see the entry.
+  auto otherBridge = createJoinBridge();
+  otherBridge->setTableCacheKey("query1.plan3.broadcast-splits", nullptr);
+  ASSERT_FALSE(otherBridge->hasCachedTable());
+
+  // The entry expires when the last bridge that uses it finishes probing.
+  ASSERT_FALSE(builderBridge->probeFinished());
+  ASSERT_TRUE(HashJoinTableCache::instance()->find(cacheKey) != nullptr);
+  ASSERT_FALSE(sharerBridge->probeFinished());
+  ASSERT_TRUE(HashJoinTableCache::instance()->find(cacheKey) == nullptr);
+}
+
+TEST_P(HashJoinBridgeTest, tableCacheRightJoin) {
+  // Right, full and right semi join probes mark probed rows in the shared
+  // table, so their bridges neither publish nor read cached tables.
+  HashJoinTableCache::instance()->testingClear();
+  const std::string cacheKey = "query1.plan2.broadcast-splits";
+
+  // A right join build with a cache key does not publish its table.
+  auto rightBridge = createJoinBridge();
+  rightBridge->setTableCacheKey(cacheKey, nullptr);
+  rightBridge->setJoinType(core::JoinType::kRight);
+  rightBridge->addBuilder();
+  rightBridge->start();
+  rightBridge->setHashTable(createFakeHashTable(), {}, false);
+  ASSERT_FALSE(rightBridge->hasCachedTable());
+  ASSERT_TRUE(HashJoinTableCache::instance()->find(cacheKey) == nullptr);
+
+  // An inner join build publishes under the same key, but a full join
+  // bridge does not consume the entry.
+  auto innerBridge = createJoinBridge();
+  innerBridge->setTableCacheKey(cacheKey, nullptr);
+  innerBridge->setJoinType(core::JoinType::kInner);
+  innerBridge->addBuilder();
+  innerBridge->start();
+  innerBridge->setHashTable(createFakeHashTable(), {}, false);
+  ASSERT_TRUE(innerBridge->hasCachedTable());
+
+  auto fullBridge = createJoinBridge();
+  fullBridge->setTableCacheKey(cacheKey, nullptr);
+  fullBridge->setJoinType(core::JoinType::kFull);
+  ASSERT_FALSE(fullBridge->hasCachedTable());
+}
+
 TEST_P(HashJoinBridgeTest, multiThreading) {
   for (int32_t iter = 0; iter < 10; ++iter) {
     std::vector<std::thread> builderThreads;
@@ -520,6 +520,14 @@ TEST_P(HashTableTest, int2SparseNormalized) {
   testCycle(BaseHashTable::HashMode::kNormalizedKey, 10000, 2, type, 2);
 }
 
+TEST_P(HashTableTest, parallelJoinBuildSingleTable) {
+  // A build with a single sub-table builds in parallel too when an executor
+  // is set; the partition count does not depend on the number of sub-tables.
+  auto type = ROW({"k1", "k2"}, {BIGINT(), BIGINT()});
+  keySpacing_ = 1000;
+  testCycle(BaseHashTable::HashMode::kNormalizedKey, 100000, 1, type, 2);
+}
+
 TEST_P(HashTableTest, int2SparseNormalizedMostMiss) {
   auto type = ROW({"k1", "k2"}, {BIGINT(), BIGINT()});
   keySpacing_ = 1000;
@@ -724,6 +732,43 @@ TEST_P(HashTableTest, groupBySpill) {
   testGroupBySpill(5'000'000, type, 1, 1000, 1000);
 }
 
+TEST_P(HashTableTest, incrementalRehash) {
+  auto type = ROW({"k1"}, {BIGINT()});
+  auto table = createHashTableForAggregation(type, 1);
+  auto lookup = std::make_unique<HashLookup>(table->hashers());
+  table->testingSetHashMode(BaseHashTable::HashMode::kHash, 1'000);
+
+  // Inserts batches of new keys so that the table grows several times and
+  // probes existing keys while some rows are still pending in the old table
+  // of the incremental rehash.
+  constexpr int32_t kBatchSize = 1'000;
+  constexpr int32_t kNumBatches = 100;
+  int32_t sequence = 0;
+  std::vector<RowVectorPtr> batches;
+  std::vector<char*> allInserted;
+  for (auto i = 0; i < kNumBatches; ++i) {
+    makeRows(kBatchSize, 1, sequence, type, batches);
+    sequence += kBatchSize;
+    lookup->reset(kBatchSize);
+    insertGroups(*batches.back(), *lookup, *table);
+    allInserted.insert(
+        allInserted.end(), lookup->hits.begin(), lookup->hits.end());
+    table->checkConsistency();
+  }
+  ASSERT_EQ(table->numDistinct(), kBatchSize * kNumBatches);
+
+  // Every key must probe to the group made at its first insert, whether the
+  // group has been migrated to the newest table or not.
+  for (auto i = 0; i < kNumBatches; ++i) {
+    insertGroups(*batches[i], *lookup, *table);
+    for (auto row = 0; row < kBatchSize; ++row) {
+      ASSERT_EQ(lookup->hits[row], allInserted[i * kBatchSize + row]);
+    }
+  }
+  ASSERT_EQ(table->numDistinct(), kBatchSize * kNumBatches);
+  table->checkConsistency();
+}
+
 TEST_P(HashTableTest, checkSizeValidation) {
   auto rowType = ROW({"a"}, {BIGINT()});
   auto table = createHashTableForAggregation(rowType, 1);
@@ -754,6 +799,42 @@ TEST_P(HashTableTest, checkSizeValidation) {
   ASSERT_EQ(table->capacity(), 512 << 10);
 }
 
+TEST_P(HashTableTest, respecializeHashMode) {
+  auto rowType = ROW({"a"}, {BIGINT()});
+  auto table = createHashTableForAggregation(rowType, 1);
+  auto lookup = std::make_unique<HashLookup>(table->hashers());
+
+  // Force generic hashing as if an early batch had wide key bounds.
+  table->testingSetHashMode(BaseHashTable::HashMode::kHash, 1'024);
+  ASSERT_EQ(table->hashMode(), BaseHashTable::HashMode::kHash);
+
+  // Feed a low cardinality key for long enough for the table to re-analyze
+  // the keys and switch to array mode for the rest of the input.
+  constexpr int32_t kBatchSize = 1'024;
+  constexpr int32_t kNumBatches = 64;
+  constexpr int64_t kNumDistinct = 1'000;
+  for (auto batch = 0; batch < kNumBatches; ++batch) {
+    auto vector = vectorMaker_->rowVector({vectorMaker_->flatVector<int64_t>(
+        kBatchSize, [&](auto row) {
+          return (batch * kBatchSize + row) % kNumDistinct;
+        })});
+    SelectivityVector rows(vector->size());
+    table->prepareForProbe(*lookup, vector, rows, false);
+    table->groupProbe(*lookup);
+  }
+  ASSERT_EQ(table->hashMode(), BaseHashTable::HashMode::kArray);
+  ASSERT_EQ(table->numDistinct(), kNumDistinct);
+
+  // The groups made before the switch are found after it: probing the same
+  // keys again makes no new groups.
+  auto vector = vectorMaker_->rowVector({vectorMaker_->flatVector<int64_t>(
+      kNumDistinct, [](auto row) { return row; })});
+  SelectivityVector rows(vector->size());
+  table->prepareForProbe(*lookup, vector, rows, false);
+  table->groupProbe(*lookup);
+  ASSERT_EQ(table->numDistinct(), kNumDistinct);
+}
+
 TEST_P(HashTableTest, listNullKeyRows) {
   VectorPtr keys = vectorMaker_->flatVector<int64_t>(500, folly::identity);
   testListNullKeyRows(keys, BaseHashTable::HashMode::kArray);
@@ -770,6 +851,26 @@ VELOX_INSTANTIATE_TEST_SUITE_P(
     HashTableTest,
     testing::Values(true, false));
 
+TEST(HashTableTest, joinMatchBits) {
+  std::vector<std::unique_ptr<VectorHasher>> hashers;
+  hashers.push_back(VectorHasher::create(BIGINT(), 0));
+  HashLookup lookup(hashers);
+  // Use a row count that is not a multiple of the bit word size to cover the
+  // scalar tail.
+  constexpr int32_t kNumRows = 1111;
+  char dummyRow;
+  lookup.hits.resize(kNumRows);
+  for (auto i = 0; i < kNumRows; ++i) {
+    lookup.hits[i] = (i % 3 == 0 || i % 31 == 0) ? &dummyRow : nullptr;
+  }
+  std::vector<uint64_t> matchBits(bits::nwords(kNumRows), ~0ULL);
+  BaseHashTable::joinMatchBits(lookup, kNumRows, matchBits.data());
+  for (auto i = 0; i < kNumRows; ++i) {
+    ASSERT_EQ(lookup.hits[i] != nullptr, bits::isBitSet(matchBits.data(), i))
+        << "at " << i;
+  }
+}
+
 TEST(HashTableTest, modeString) {
   ASSERT_EQ("HASH", BaseHashTable::modeString(BaseHashTable::HashMode::kHash));
   ASSERT_EQ(
@@ -14,12 +14,16 @@
  * limitations under the License.
  */
 
+#include "folly/experimental/EventCount.h"
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/common/testutil/TestValue.h"
 #include "velox/exec/tests/utils/AssertQueryBuilder.h"
 #include "velox/exec/tests/utils/OperatorTestBase.h"
 #include "velox/exec/tests/utils/PlanBuilder.h"
 
 using namespace facebook::velox;
 using namespace facebook::velox::test;
+using namespace facebook::velox::common::testutil;
 using namespace facebook::velox::exec::test;
 
 class MarkDistinctTest : public OperatorTestBase {
@@ -106,6 +110,72 @@ TEST_F(MarkDistinctTest, row) {
   runBasicTest(base);
 }
 
+DEBUG_ONLY_TEST_F(MarkDistinctTest, approxDowngradeOnReclaim) {
+  // 5 batches with the same 100 keys each. The downgrade to a Bloom filter
+  // happens after the first batch, so all distinct keys are already in the
+  // filter and the remaining batches only carry true duplicates, making the
+  // result exact.
+  std::vector<RowVectorPtr> vectors;
+  for (auto i = 0; i < 5; ++i) {
+    vectors.push_back(makeRowVector(
+        {makeFlatVector<int64_t>(500, [](auto row) { return row % 100; })}));
+  }
+  createDuckDbTable(vectors);
+
+  folly::EventCount driverWait;
+  auto driverWaitKey = driverWait.prepareWait();
+  folly::EventCount testWait;
+  auto testWaitKey = testWait.prepareWait();
+
+  std::atomic<int> numInputs{0};
+  exec::Operator* op{nullptr};
+  SCOPED_TESTVALUE_SET(
+      "facebook::velox::exec::Driver::runInternal::addInput",
+      std::function<void(exec::Operator*)>([&](exec::Operator* testOp) {
+        if (testOp->operatorType() != "MarkDistinct") {
+          return;
+        }
+        op = testOp;
+        if (++numInputs != 2) {
+          return;
+        }
+        ASSERT_TRUE(op->canReclaim());
+        testWait.notify();
+        driverWait.wait(driverWaitKey);
+      }));
+
+  auto plan = PlanBuilder()
+                  .values(vectors)
+                  .markDistinct("c0_distinct", {"c0"})
+                  .singleAggregation({}, {"sum(c0)"}, {"c0_distinct"})
+                  .planNode();
+
+  std::thread taskThread([&]() {
+    AssertQueryBuilder(plan, duckDbQueryRunner_)
+        .config(core::QueryConfig::kMarkDistinctApproxEnabled, "true")
+        .maxDrivers(1)
+        .assertResults("SELECT sum(distinct c0) FROM tmp");
+  });
+
+  testWait.wait(testWaitKey);
+  ASSERT_TRUE(op != nullptr);
+  auto task = op->testingOperatorCtx()->task();
+  auto taskPauseWait = task->requestPause();
+  driverWait.notify();
+  taskPauseWait.wait();
+
+  op->reclaim(0);
+  // A downgraded operator has nothing left to reclaim.
+  ASSERT_FALSE(op->canReclaim());
+
+  exec::Task::resume(task);
+  taskThread.join();
+
+  auto stats = task->taskStats().pipelineStats[0].operatorStats;
+  ASSERT_EQ(
+      1, stats[1].runtimeStats.at("markDistinctDowngradedToApprox").count);
+}
+
 TEST_F(MarkDistinctTest, aggregation) {
   // Simulate the input over 3 splits.
   std::vector<RowVectorPtr> vectors = {
@@ -201,6 +201,15 @@ TEST_F(MergeJoinTest, duplicateMatch) {
       [](auto row) { return row / 2; }, [](auto row) { return row / 3; });
 }
 
+TEST_F(MergeJoinTest, longRunsAndGaps) {
+  // Long runs of duplicate keys exercise the vectorized detection of equal-key
+  // runs and wide ranges of non-matching keys exercise the galloping skip.
+  testJoin<int64_t>(
+      [](auto row) { return row / 64; }, [](auto row) { return row * 64; });
+  testJoin<int16_t>(
+      [](auto row) { return row / 100; }, [](auto row) { return row / 7; });
+}
+
 TEST_F(MergeJoinTest, allRowsMatch) {
   std::vector<VectorPtr> leftKeys = {
       makeFlatVector<int32_t>(2, [](auto /* row */) { return 5; }),
@@ -215,6 +224,66 @@ TEST_F(MergeJoinTest, allRowsMatch) {
   testJoin(rightKeys, leftKeys);
 }
 
+TEST_F(MergeJoinTest, skewedDuplicateMatch) {
+  // One left-side key matches a run of right-side duplicates that spans
+  // many batches. The run is emitted and dropped batch by batch instead
+  // of being buffered in full, so this exercises draining a right-side
+  // match that is still growing, including restarts when the output
+  // batch fills up mid-drain.
+  auto left = makeRowVector(
+      {"t_c0", "t_c1"},
+      {makeFlatVector<int32_t>({0, 1, 1, 2}),
+       makeFlatVector<int32_t>({10, 20, 30, 40})});
+
+  std::vector<RowVectorPtr> right;
+  vector_size_t startRow = 0;
+  for (auto i = 0; i < 7; ++i) {
+    // All batches hold key 1, except for the tail of the last one.
+    auto size = 100;
+    right.push_back(makeRowVector(
+        {"u_c0", "u_c1"},
+        {makeFlatVector<int32_t>(
+             size, [&](auto row) { return i == 6 && row >= 50 ? 2 : 1; }),
+         makeFlatVector<int32_t>(
+             size, [startRow](auto row) { return (startRow + row) * 2; })}));
+    startRow += size;
+  }
+
+  createDuckDbTable("t", {left});
+  createDuckDbTable("u", right);
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  auto makePlan = [&](core::JoinType joinType, const std::string& filter) {
+    return PlanBuilder(planNodeIdGenerator)
+        .values({left})
+        .mergeJoin(
+            {"t_c0"},
+            {"u_c0"},
+            PlanBuilder(planNodeIdGenerator).values(right).planNode(),
+            filter,
+            {"t_c0", "t_c1", "u_c1"},
+            joinType)
+        .planNode();
+  };
+
+  for (auto batchSize : {16, 1024, 10'000}) {
+    assertQuery(
+        makeCursorParameters(makePlan(core::JoinType::kInner, ""), batchSize),
+        "SELECT t_c0, t_c1, u_c1 FROM t, u WHERE t_c0 = u_c0");
+
+    assertQuery(
+        makeCursorParameters(
+            makePlan(core::JoinType::kInner, "(t_c1 + u_c1) % 4 = 0"),
+            batchSize),
+        "SELECT t_c0, t_c1, u_c1 FROM t, u "
+        "WHERE t_c0 = u_c0 AND (t_c1 + u_c1) % 4 = 0");
+
+    assertQuery(
+        makeCursorParameters(makePlan(core::JoinType::kLeft, ""), batchSize),
+        "SELECT t_c0, t_c1, u_c1 FROM t LEFT JOIN u ON t_c0 = u_c0");
+  }
+}
+
 TEST_F(MergeJoinTest, aggregationOverJoin) {
   auto left =
       makeRowVector({"t_c0"}, {makeFlatVector<int32_t>({1, 2, 3, 4, 5})});
@@ -152,6 +152,48 @@ TEST_F(MergeTest, localMerge) {
   testTwoKeys(vectors, "c3", "c0");
 }
 
+/// Verifies that sources producing many tiny batches merge correctly with
+/// batch coalescing enabled (default) and disabled.
+TEST_F(MergeTest, coalesceSmallBatches) {
+  std::vector<RowVectorPtr> vectors;
+  for (int32_t i = 0; i < 50; ++i) {
+    vectors.push_back(makeRowVector({
+        makeFlatVector<int64_t>({i * 3, i * 3 + 1, i * 3 + 2}),
+        makeFlatVector<int64_t>({i, i, i}),
+    }));
+  }
+  createDuckDbTable(vectors);
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  auto plan = PlanBuilder(planNodeIdGenerator)
+                  .localMerge(
+                      {"c0"},
+                      {
+                          PlanBuilder(planNodeIdGenerator)
+                              .values(vectors)
+                              .planNode(),
+                          PlanBuilder(planNodeIdGenerator)
+                              .values(vectors)
+                              .planNode(),
+                      })
+                  .planNode();
+
+  // '1' makes every batch too large to coalesce, covering the pass-through
+  // path.
+  for (const auto& coalesceBytes : {std::string("1"), std::string("65536")}) {
+    CursorParameters params;
+    params.planNode = plan;
+    params.queryCtx = std::make_shared<core::QueryCtx>(executor_.get());
+    params.queryCtx->testingOverrideConfigUnsafe(
+        {{core::QueryConfig::kMergeSourceCoalesceBytes, coalesceBytes}});
+    assertQueryOrdered(
+        params,
+        "SELECT * FROM (SELECT * FROM tmp UNION ALL SELECT * FROM tmp) "
+        "ORDER BY c0",
+        {0});
+  }
+}
+
 /// Verifies an edge case where output batch fills up when one of the sources
 /// has only one row left.
 TEST_F(MergeTest, offByOne) {
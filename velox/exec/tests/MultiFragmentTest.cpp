@@ -366,6 +366,67 @@ TEST_F(MultiFragmentTest, mergeExchange) {
   }
 }
 
+// Same as 'mergeExchange' but with a tiny per-source buffer limit, so the
+// merge fetches a few batches at a time from each source instead of buffering
+// the exchange client default.
+TEST_F(MultiFragmentTest, mergeExchangeSmallSourceBuffer) {
+  setupSources(20, 1000);
+  configSettings_[core::QueryConfig::kMergeExchangeSourceBufferSize] = "1024";
+
+  std::vector<std::shared_ptr<Task>> tasks;
+
+  std::vector<std::shared_ptr<TempFilePath>> filePaths0(
+      filePaths_.begin(), filePaths_.begin() + 10);
+  std::vector<std::shared_ptr<TempFilePath>> filePaths1(
+      filePaths_.begin() + 10, filePaths_.end());
+
+  std::vector<std::vector<std::shared_ptr<TempFilePath>>> filePathsList = {
+      filePaths0, filePaths1};
+
+  std::vector<std::string> partialSortTaskIds;
+  RowTypePtr outputType;
+
+  for (int i = 0; i < 2; ++i) {
+    auto sortTaskId = makeTaskId("orderby", tasks.size());
+    partialSortTaskIds.push_back(sortTaskId);
+    auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+    auto partialSortPlan = PlanBuilder(planNodeIdGenerator)
+                               .localMerge(
+                                   {"c0"},
+                                   {PlanBuilder(planNodeIdGenerator)
+                                        .tableScan(rowType_)
+                                        .orderBy({"c0"}, true)
+                                        .planNode()})
+                               .partitionedOutput({}, 1)
+                               .planNode();
+
+    auto sortTask = makeTask(sortTaskId, partialSortPlan, tasks.size());
+    tasks.push_back(sortTask);
+    Task::start(sortTask, 4);
+    addHiveSplits(sortTask, filePathsList[i]);
+    outputType = partialSortPlan->outputType();
+  }
+
+  auto finalSortTaskId = makeTaskId("orderby", tasks.size());
+  auto finalSortPlan = PlanBuilder()
+                           .mergeExchange(outputType, {"c0"})
+                           .partitionedOutput({}, 1)
+                           .planNode();
+
+  auto task = makeTask(finalSortTaskId, finalSortPlan, 0);
+  tasks.push_back(task);
+  Task::start(task, 1);
+  addRemoteSplits(task, partialSortTaskIds);
+
+  auto op = PlanBuilder().exchange(outputType).planNode();
+  assertQueryOrdered(
+      op, {finalSortTaskId}, "SELECT * FROM tmp ORDER BY 1 NULLS LAST", {0});
+
+  for (auto& task : tasks) {
+    ASSERT_TRUE(waitForTaskCompletion(task.get())) << task->taskId();
+  }
+}
+
 // Test reordering and dropping columns in PartitionedOutput operator.
 TEST_F(MultiFragmentTest, partitionedOutput) {
   setupSources(10, 1000);
@@ -142,6 +142,35 @@ TEST_F(NestedLoopJoinTest, emptyBuild) {
   runTest(probeVectors, buildVectors);
 }
 
+TEST_F(NestedLoopJoinTest, filterBatchSize) {
+  // Verifies that the size of the candidate blocks the join condition is
+  // evaluated on does not affect results.
+  auto probeVectors = makeBatches(128, 10, probeType_, pool_.get());
+  auto buildVectors = makeBatches(64, 5, buildType_, pool_.get());
+  createDuckDbTable("t", probeVectors);
+  createDuckDbTable("u", buildVectors);
+
+  auto planNodeIdGenerator = std::make_shared<core::PlanNodeIdGenerator>();
+  CursorParameters params;
+  params.planNode =
+      PlanBuilder(planNodeIdGenerator)
+          .values(probeVectors)
+          .nestedLoopJoin(
+              PlanBuilder(planNodeIdGenerator).values(buildVectors).planNode(),
+              "t0 < u0",
+              {"t0", "u0"},
+              core::JoinType::kInner)
+          .planNode();
+
+  for (const auto* filterBatchRows : {"100", "10000", "1000000"}) {
+    SCOPED_TRACE(fmt::format("filterBatchRows:{}", filterBatchRows));
+    params.queryCtx = std::make_shared<core::QueryCtx>(executor_.get());
+    params.queryCtx->testingOverrideConfigUnsafe(
+        {{core::QueryConfig::kNestedLoopJoinFilterBatchRows, filterBatchRows}});
+    assertQuery(params, "SELECT t0, u0 FROM t, u WHERE t.t0 < u.u0");
+  }
+}
+
 TEST_F(NestedLoopJoinTest, basicCrossJoin) {
   auto probeVectors = {
       makeRowVector({sequence<int32_t>(10)}),
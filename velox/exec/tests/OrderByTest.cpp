@@ -257,6 +257,45 @@ TEST_F(OrderByTest, singleKey) {
   runTest(plan, orderById, "SELECT * FROM tmp ORDER BY c0 NULLS FIRST", {0});
 }
 
+TEST_F(OrderByTest, singleKeyBoundaryValues) {
+  // Extreme key values share a sort key prefix with nulls. Verifies that the
+  // tie fallback orders them correctly for all null placements.
+  vector_size_t batchSize = 1000;
+  std::vector<RowVectorPtr> vectors;
+  for (int32_t i = 0; i < 2; ++i) {
+    auto c0 = makeFlatVector<int64_t>(
+        batchSize,
+        [](vector_size_t row) {
+          return row % 3 == 0 ? std::numeric_limits<int64_t>::min()
+              : row % 3 == 1  ? std::numeric_limits<int64_t>::max()
+                              : row;
+        },
+        nullEvery(5));
+    auto c1 = makeFlatVector<double>(
+        batchSize, [](vector_size_t row) { return row * 0.1; }, nullEvery(11));
+    vectors.push_back(makeRowVector({c0, c1}));
+  }
+  createDuckDbTable(vectors);
+
+  core::PlanNodeId orderById;
+  for (const auto& sortOrder :
+       {"ASC NULLS LAST",
+        "ASC NULLS FIRST",
+        "DESC NULLS LAST",
+        "DESC NULLS FIRST"}) {
+    auto plan = PlanBuilder()
+                    .values(vectors)
+                    .orderBy({fmt::format("c0 {}", sortOrder)}, false)
+                    .capturePlanNodeId(orderById)
+                    .planNode();
+    runTest(
+        plan,
+        orderById,
+        fmt::format("SELECT * FROM tmp ORDER BY c0 {}", sortOrder),
+        {0});
+  }
+}
+
 TEST_F(OrderByTest, multipleKeys) {
   vector_size_t batchSize = 1000;
   std::vector<RowVectorPtr> vectors;
@@ -315,6 +354,51 @@ TEST_F(OrderByTest, multiBatchResult) {
   testSingleKey(vectors, "c0");
 }
 
+TEST_F(OrderByTest, sortedInput) {
+  // Input that already arrives in sort order, e.g. read from time-sorted
+  // files, skips the sort.
+  vector_size_t batchSize = 1000;
+  std::vector<RowVectorPtr> vectors;
+  for (int32_t i = 0; i < 3; ++i) {
+    auto c0 = makeFlatVector<int64_t>(
+        batchSize, [&](vector_size_t row) { return batchSize * i + row; });
+    auto c1 = makeFlatVector<double>(
+        batchSize, [](vector_size_t row) { return row * 0.1; }, nullEvery(11));
+    vectors.push_back(makeRowVector({c0, c1}));
+  }
+  createDuckDbTable(vectors);
+
+  core::PlanNodeId orderById;
+  auto plan = PlanBuilder()
+                  .values(vectors)
+                  .orderBy({"c0 ASC NULLS LAST"}, false)
+                  .capturePlanNodeId(orderById)
+                  .planNode();
+  auto task =
+      assertQueryOrdered(plan, "SELECT * FROM tmp ORDER BY c0 NULLS LAST", {0});
+  EXPECT_EQ(
+      1,
+      toPlanStats(task->taskStats())
+          .at(orderById)
+          .customStats.at("sortSkippedOnOrderedInput")
+          .count);
+
+  // The same input is out of order for a descending sort and takes the sort
+  // path.
+  plan = PlanBuilder()
+             .values(vectors)
+             .orderBy({"c0 DESC NULLS FIRST"}, false)
+             .capturePlanNodeId(orderById)
+             .planNode();
+  task = assertQueryOrdered(
+      plan, "SELECT * FROM tmp ORDER BY c0 DESC NULLS FIRST", {0});
+  EXPECT_EQ(
+      0,
+      toPlanStats(task->taskStats())
+          .at(orderById)
+          .customStats.count("sortSkippedOnOrderedInput"));
+}
+
 TEST_F(OrderByTest, varfields) {
   vector_size_t batchSize = 1000;
   std::vector<RowVectorPtr> vectors;
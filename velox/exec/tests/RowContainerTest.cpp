@@ -754,6 +754,130 @@ TEST_F(RowContainerTest, estimateRowSize) {
   }
 }
 
+TEST_F(RowContainerTest, stringInlineLimit) {
+  constexpr int32_t kNumRows = 100;
+  constexpr int32_t kLimit = 20;
+  auto makeContainer = [&]() {
+    return std::make_unique<RowContainer>(
+        std::vector<TypePtr>{VARCHAR()},
+        true, // nullableKeys
+        std::vector<Accumulator>{},
+        std::vector<TypePtr>{VARCHAR()},
+        false, // hasNext
+        false, // isJoinBuild
+        false, // hasProbedFlag
+        false, // hasNormalizedKey
+        pool_.get(),
+        ContainerRowSerde::instance(),
+        kLimit);
+  };
+
+  // Strings whose sizes straddle both the StringView inline limit and the
+  // in-row limit.
+  std::vector<std::string> keyStrings;
+  std::vector<std::optional<std::string>> dependentStrings;
+  for (auto i = 0; i < kNumRows; ++i) {
+    keyStrings.emplace_back(i % 31, static_cast<char>('a' + i % 26));
+    if (i % 7 == 0) {
+      dependentStrings.push_back(std::nullopt);
+    } else {
+      dependentStrings.emplace_back(
+          std::string(i % 31, static_cast<char>('A' + i % 26)));
+    }
+  }
+  auto key = makeFlatVector<std::string>(keyStrings);
+  auto dependent = makeNullableFlatVector<std::string>(dependentStrings);
+  SelectivityVector allRows(kNumRows);
+  DecodedVector decodedKey(*key, allRows);
+  DecodedVector decodedDependent(*dependent, allRows);
+  auto data = makeContainer();
+  std::vector<char*> rows;
+  for (auto i = 0; i < kNumRows; ++i) {
+    auto row = data->newRow();
+    data->store(decodedKey, i, row, 0);
+    data->store(decodedDependent, i, row, 1);
+    rows.push_back(row);
+  }
+  testExtractColumn(*data, rows, 0, key);
+  testExtractColumn(*data, rows, 1, dependent);
+
+  // Reuse rows after erase to make sure in-row strings are not freed to
+  // the string allocator.
+  data->eraseRows(folly::Range<char**>(rows.data(), rows.size()));
+  rows.clear();
+  for (auto i = 0; i < kNumRows; ++i) {
+    auto row = data->newRow();
+    data->store(decodedKey, i, row, 0);
+    data->store(decodedDependent, i, row, 1);
+    rows.push_back(row);
+  }
+  testExtractColumn(*data, rows, 0, key);
+  testExtractColumn(*data, rows, 1, dependent);
+
+  // Strings above the StringView inline size but within the in-row limit
+  // take no out-of-line memory.
+  std::vector<std::string> shortStrings;
+  for (auto i = 0; i < kNumRows; ++i) {
+    shortStrings.emplace_back(
+        13 + i % (kLimit - 12), static_cast<char>('a' + i % 26));
+  }
+  auto shortKey = makeFlatVector<std::string>(shortStrings);
+  DecodedVector decodedShort(*shortKey, allRows);
+  auto shortData = makeContainer();
+  std::vector<char*> shortRows;
+  for (auto i = 0; i < kNumRows; ++i) {
+    auto row = shortData->newRow();
+    shortData->store(decodedShort, i, row, 0);
+    shortData->store(decodedShort, i, row, 1);
+    shortRows.push_back(row);
+  }
+  EXPECT_EQ(shortData->stringAllocator().retainedSize(), 0);
+  testExtractColumn(*shortData, shortRows, 0, shortKey);
+  testExtractColumn(*shortData, shortRows, 1, shortKey);
+}
+
+TEST_F(RowContainerTest, columnHasNulls) {
+  constexpr int32_t kNumRows = 100;
+  auto data = makeRowContainer({BIGINT()}, {BIGINT()}, false);
+  EXPECT_FALSE(data->columnHasNulls(0));
+  EXPECT_FALSE(data->columnHasNulls(1));
+
+  auto noNulls =
+      makeFlatVector<int64_t>(kNumRows, [](auto row) { return row; });
+  SelectivityVector allRows(kNumRows);
+  DecodedVector decoded(*noNulls, allRows);
+  std::vector<char*> rows;
+  for (auto i = 0; i < kNumRows; ++i) {
+    auto row = data->newRow();
+    data->store(decoded, i, row, 0);
+    data->store(decoded, i, row, 1);
+    rows.push_back(row);
+  }
+  // Storing a vector without nulls leaves the flags clear, so compare
+  // takes the no-nulls path.
+  EXPECT_FALSE(data->columnHasNulls(0));
+  EXPECT_FALSE(data->columnHasNulls(1));
+  EXPECT_LT(data->compare(rows[0], rows[1], 0, CompareFlags()), 0);
+  EXPECT_EQ(data->compare(rows[1], rows[1], 1, CompareFlags()), 0);
+
+  // Overwrite the dependent column with a vector that has nulls.
+  auto someNulls = makeFlatVector<int64_t>(
+      kNumRows, [](auto row) { return row; }, nullEvery(7));
+  DecodedVector decodedNulls(*someNulls, allRows);
+  for (auto i = 0; i < kNumRows; ++i) {
+    data->store(decodedNulls, i, rows[i], 1);
+  }
+  EXPECT_FALSE(data->columnHasNulls(0));
+  EXPECT_TRUE(data->columnHasNulls(1));
+  // Nulls order before values with default flags.
+  EXPECT_LT(data->compare(rows[0], rows[1], 1, CompareFlags()), 0);
+  EXPECT_EQ(data->compare(rows[0], rows[7], 1, CompareFlags()), 0);
+
+  // clear() resets the flags.
+  data->clear();
+  EXPECT_FALSE(data->columnHasNulls(1));
+}
+
 class AggregateWithAlignment : public Aggregate {
  public:
   explicit AggregateWithAlignment(TypePtr resultType, int alignment)
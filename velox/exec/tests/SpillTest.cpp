@@ -14,10 +14,12 @@
  * limitations under the License.
  */
 #include "velox/exec/Spill.h"
+#include <folly/executors/IOThreadPoolExecutor.h>
 #include <gtest/gtest.h>
 #include <algorithm>
 #include <memory>
 #include "velox/common/base/RuntimeMetrics.h"
+#include "velox/common/base/tests/GTestUtils.h"
 #include "velox/common/file/FileSystems.h"
 #include "velox/exec/OperatorUtils.h"
 #include "velox/exec/tests/utils/TempDirectoryPath.h"
@@ -144,7 +146,15 @@ class SpillTest : public testing::Test,
     // the batch number of the vector in the partition. When read back, both
     // partitions produce an ascending sequence of integers without gaps.
     state_ = std::make_unique<SpillState>(
-        spillPath_, numPartitions, 1, compareFlags, targetFileSize, *pool());
+        spillPath_,
+        numPartitions,
+        1,
+        compareFlags,
+        targetFileSize,
+        compressionCodec_,
+        executor_.get(),
+        *pool(),
+        tier_.get());
     EXPECT_EQ(targetFileSize, state_->targetFileSize());
     EXPECT_EQ(numPartitions, state_->maxPartitions());
     EXPECT_EQ(0, state_->spilledPartitions());
@@ -219,6 +229,48 @@ class SpillTest : public testing::Test,
         numPartitions * numBatches * sizeof(int64_t), state_->spilledBytes());
   }
 
+  // Reads all partitions of 'state_' back with startMerge() and checks
+  // the rows of each come in dense increasing order per 'values_'.
+  void verifySortedRead(int numBatches, int numRowsPerBatch) {
+    for (auto partition = 0; partition < state_->maxPartitions(); ++partition) {
+      int numReadBatches = 0;
+      auto merge = state_->startMerge(partition, nullptr);
+      // We expect all the rows in dense increasing order.
+      for (auto i = 0; i < numBatches * numRowsPerBatch; ++i) {
+        auto stream = merge->next();
+        ASSERT_NE(nullptr, stream);
+        bool isLastBatch = false;
+        if (values_[i].has_value()) {
+          ASSERT_EQ(
+              values_[i].value(),
+              stream->current()
+                  .childAt(0)
+                  ->asUnchecked<FlatVector<int64_t>>()
+                  ->valueAt(stream->currentIndex(&isLastBatch)))
+              << i;
+          ASSERT_EQ(
+              values_[i].value(),
+              stream->decoded(0).valueAt<int64_t>(stream->currentIndex()))
+              << i;
+        } else {
+          ASSERT_TRUE(stream->current()
+                          .childAt(0)
+                          ->asUnchecked<FlatVector<int64_t>>()
+                          ->isNullAt(stream->currentIndex(&isLastBatch)))
+              << i;
+          ASSERT_TRUE(stream->decoded(0).isNullAt(stream->currentIndex())) << i;
+        }
+        stream->pop();
+        if (isLastBatch) {
+          ++numReadBatches;
+        }
+      }
+      ASSERT_EQ(nullptr, merge->next());
+      // We do two append writes per each input batch.
+      ASSERT_EQ(numBatches, numReadBatches);
+    }
+  }
+
   // 'numDuplicates' specifies the number of duplicates generated for each
   // distinct sort key value in test.
   void spillStateTest(
@@ -259,43 +311,7 @@ class SpillTest : public testing::Test,
       EXPECT_NE(readFile.get(), nullptr);
     }
 
-    for (auto partition = 0; partition < state_->maxPartitions(); ++partition) {
-      int numReadBatches = 0;
-      auto merge = state_->startMerge(partition, nullptr);
-      // We expect all the rows in dense increasing order.
-      for (auto i = 0; i < numBatches * numRowsPerBatch; ++i) {
-        auto stream = merge->next();
-        ASSERT_NE(nullptr, stream);
-        bool isLastBatch = false;
-        if (values_[i].has_value()) {
-          ASSERT_EQ(
-              values_[i].value(),
-              stream->current()
-                  .childAt(0)
-                  ->asUnchecked<FlatVector<int64_t>>()
-                  ->valueAt(stream->currentIndex(&isLastBatch)))
-              << i;
-          ASSERT_EQ(
-              values_[i].value(),
-              stream->decoded(0).valueAt<int64_t>(stream->currentIndex()))
-              << i;
-        } else {
-          ASSERT_TRUE(stream->current()
-                          .childAt(0)
-                          ->asUnchecked<FlatVector<int64_t>>()
-                          ->isNullAt(stream->currentIndex(&isLastBatch)))
-              << i;
-          ASSERT_TRUE(stream->decoded(0).isNullAt(stream->currentIndex())) << i;
-        }
-        stream->pop();
-        if (isLastBatch) {
-          ++numReadBatches;
-        }
-      }
-      ASSERT_EQ(nullptr, merge->next());
-      // We do two append writes per each input batch.
-      ASSERT_EQ(numBatches, numReadBatches);
-    }
+    verifySortedRead(numBatches, numRowsPerBatch);
     // Both spilled bytes and files stats are cleared after merge read.
     EXPECT_EQ(0, state_->spilledBytes());
     EXPECT_EQ(0, state_->spilledFiles());
@@ -313,6 +329,10 @@ class SpillTest : public testing::Test,
   std::vector<std::optional<int64_t>> values_;
   std::vector<std::vector<RowVectorPtr>> batchesByPartition_;
   std::string spillPath_;
+  std::string compressionCodec_{"none"};
+  // Memory tier passed to 'state_' if set.
+  std::unique_ptr<SpillMemoryTier> tier_;
+  std::unique_ptr<folly::IOThreadPoolExecutor> executor_;
   std::unique_ptr<SpillState> state_;
   std::unordered_map<std::string, RuntimeMetric> stats_;
   std::unique_ptr<TestRuntimeStatWriter> statWriter_;
@@ -337,6 +357,67 @@ TEST_F(SpillTest, spillState) {
   spillStateTest(kGB, 2, 10, 10, {}, 10);
 }
 
+TEST_F(SpillTest, asyncWriteSpillState) {
+  // Verify the spilled data roundtrips when the writes are overlapped with
+  // producing the batches on an executor.
+  executor_ = std::make_unique<folly::IOThreadPoolExecutor>(2);
+  spillStateTest(kGB, 2, 10, 1, {CompareFlags{true, true}}, 10);
+  spillStateTest(1, 2, 10, 1, {}, 10 * 2);
+  compressionCodec_ = "lz4";
+  spillStateTest(kGB, 2, 10, 1, {}, 10);
+  compressionCodec_ = "none";
+  executor_.reset();
+}
+
+TEST_F(SpillTest, compressedSpillState) {
+  // Verify that the spilled data roundtrips with each supported compression
+  // codec, both within a single file and across file boundaries.
+  for (const auto& codec : std::vector<std::string>{"lz4", "zstd"}) {
+    SCOPED_TRACE(codec);
+    compressionCodec_ = codec;
+    spillStateTest(kGB, 2, 10, 1, {CompareFlags{true, true}}, 10);
+    spillStateTest(1, 2, 10, 1, {}, 10 * 2);
+  }
+  compressionCodec_ = "none";
+  VELOX_ASSERT_THROW(
+      spillCompressionCodecType("gzip"),
+      "Unsupported spill compression codec: gzip");
+}
+
+TEST_F(SpillTest, memoryTier) {
+  constexpr int kNumBatches = 10;
+  constexpr int kNumRowsPerBatch = 20'000;
+  tier_ = std::make_unique<SpillMemoryTier>(256 << 20);
+  setupSpillState(kGB, 2, kNumBatches, kNumRowsPerBatch);
+  EXPECT_GT(tier_->usedBytes(), 0);
+  // The data stays in the tier, no spill file is created on disk.
+  auto fs = filesystems::getFileSystem(tempDir_->path, nullptr);
+  for (const auto& path : state_->testingSpilledFilePaths()) {
+    EXPECT_FALSE(fs->exists(path));
+  }
+  verifySortedRead(kNumBatches, kNumRowsPerBatch);
+  // The tier space is reclaimed when the spilled data has been read.
+  state_.reset();
+  EXPECT_EQ(0, tier_->usedBytes());
+}
+
+TEST_F(SpillTest, memoryTierOverflow) {
+  constexpr int kNumBatches = 10;
+  constexpr int kNumRowsPerBatch = 20'000;
+  // A tier of a single block fills up mid-write. The data migrates to
+  // disk files and still roundtrips.
+  tier_ = std::make_unique<SpillMemoryTier>(1);
+  EXPECT_EQ(SpillMemoryTier::kBlockSize, tier_->maxBytes());
+  setupSpillState(kGB, 2, kNumBatches, kNumRowsPerBatch);
+  auto fs = filesystems::getFileSystem(tempDir_->path, nullptr);
+  int numOnDisk = 0;
+  for (const auto& path : state_->testingSpilledFilePaths()) {
+    numOnDisk += fs->exists(path) ? 1 : 0;
+  }
+  EXPECT_GT(numOnDisk, 0);
+  verifySortedRead(kNumBatches, kNumRowsPerBatch);
+}
+
 TEST_F(SpillTest, spillTimestamp) {
   // Verify that timestamp type retains it nanosecond precision when spilled and
   // read back.
@@ -350,7 +431,8 @@ TEST_F(SpillTest, spillTimestamp) {
       Timestamp{1, 17'123'456},
       Timestamp{-1, 17'123'456}};
 
-  SpillState state(spillPath, 1, 1, emptyCompareFlags, 1024, *pool());
+  SpillState state(
+      spillPath, 1, 1, emptyCompareFlags, 1024, "none", nullptr, *pool());
   int partitionIndex = 0;
   state.setPartitionSpilled(partitionIndex);
   EXPECT_TRUE(state.isPartitionSpilled(partitionIndex));
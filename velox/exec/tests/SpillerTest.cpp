@@ -404,6 +404,7 @@ class SpillerTest : public exec::test::RowContainerTestBase {
           makeError ? "/bad/path" : tempDirPath_->path,
           targetFileSize,
           minSpillRunSize,
+          compressionCodec_,
           *pool_,
           executor());
     } else if (type_ == Spiller::Type::kOrderBy) {
@@ -419,6 +420,7 @@ class SpillerTest : public exec::test::RowContainerTestBase {
           makeError ? "/bad/path" : tempDirPath_->path,
           targetFileSize,
           minSpillRunSize,
+          compressionCodec_,
           *pool_,
           executor());
     } else {
@@ -433,6 +435,7 @@ class SpillerTest : public exec::test::RowContainerTestBase {
           makeError ? "/bad/path" : tempDirPath_->path,
           targetFileSize,
           minSpillRunSize,
+          compressionCodec_,
           *pool_,
           executor());
     }
@@ -853,6 +856,7 @@ class SpillerTest : public exec::test::RowContainerTestBase {
   std::unique_ptr<folly::IOThreadPoolExecutor> executor_;
   std::shared_ptr<TempDirectoryPath> tempDirPath_;
   std::shared_ptr<FileSystem> fs_;
+  std::string compressionCodec_{"none"};
   RowTypePtr rowType_;
   int32_t numKeys_;
   std::vector<column_index_t> keyChannels_;
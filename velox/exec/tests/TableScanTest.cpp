@@ -220,6 +220,61 @@ TEST_F(TableScanTest, allColumns) {
   EXPECT_LT(0, exec::TableScan::ioWaitNanos());
 }
 
+TEST_F(TableScanTest, scanDriverThrottle) {
+  // Unit check of the throttle itself: parking, scale up on IO bound
+  // splits, scale down on CPU bound ones and release at end of scan.
+  exec::ScanDriverThrottle throttle(4);
+  EXPECT_EQ(throttle.numActiveDrivers(), 4);
+
+  // A CPU bound split lowers the limit; driver 3 parks.
+  throttle.updateAfterSplit(0, 1'000'000, 10);
+  EXPECT_EQ(throttle.numActiveDrivers(), 3);
+  ContinueFuture future = ContinueFuture::makeEmpty();
+  EXPECT_FALSE(throttle.enter(3, future));
+  EXPECT_TRUE(future.valid());
+  EXPECT_TRUE(throttle.enter(2, future));
+
+  // An IO bound split with queued work raises the limit and continues
+  // the parked driver.
+  throttle.updateAfterSplit(900'000, 1'000'000, 10);
+  EXPECT_EQ(throttle.numActiveDrivers(), 4);
+  EXPECT_TRUE(future.isReady());
+
+  // The limit stays within [1, numDrivers].
+  throttle.updateAfterSplit(900'000, 1'000'000, 10);
+  EXPECT_EQ(throttle.numActiveDrivers(), 4);
+  for (auto i = 0; i < 10; ++i) {
+    throttle.updateAfterSplit(0, 1'000'000, 10);
+  }
+  EXPECT_EQ(throttle.numActiveDrivers(), 1);
+
+  // releaseAll() reactivates all parked drivers.
+  ContinueFuture parked = ContinueFuture::makeEmpty();
+  EXPECT_FALSE(throttle.enter(2, parked));
+  throttle.releaseAll();
+  EXPECT_EQ(throttle.numActiveDrivers(), 4);
+  EXPECT_TRUE(parked.isReady());
+}
+
+TEST_F(TableScanTest, scaleDrivers) {
+  auto vectors = makeVectors(10, 1'000);
+  std::vector<std::shared_ptr<TempFilePath>> filePaths;
+  for (auto i = 0; i < 10; ++i) {
+    auto filePath = TempFilePath::create();
+    writeToFile(filePath->path, vectors[i]);
+    filePaths.push_back(std::move(filePath));
+  }
+  createDuckDbTable(vectors);
+
+  AssertQueryBuilder builder(tableScanNode(), duckDbQueryRunner_);
+  for (auto& filePath : filePaths) {
+    builder.split(makeHiveConnectorSplit(filePath->path));
+  }
+  builder.maxDrivers(4)
+      .config(core::QueryConfig::kTableScanScaleDriversEnabled, "true")
+      .assertResults("SELECT * FROM tmp");
+}
+
 TEST_F(TableScanTest, connectorStats) {
   auto hiveConnector =
       std::dynamic_pointer_cast<connector::hive::HiveConnector>(
@@ -15,6 +15,7 @@
  */
 
 #include "velox/exec/Task.h"
+#include <folly/json.h>
 #include "velox/common/base/tests/GTestUtils.h"
 #include "velox/common/future/VeloxPromise.h"
 #include "velox/common/testutil/TestValue.h"
@@ -454,6 +455,29 @@ TEST_F(TaskTest, testTerminateDeadlock) {
   VELOX_ASSERT_THROW(cursor->moveNext(), "Aborted for external error");
 }
 
+TEST_F(TaskTest, deferredTeardown) {
+  // A scan with no splits added keeps the drivers off thread until the
+  // task is cancelled, so Task::terminate tears them down. With
+  // deferred teardown enabled the drivers are closed on an executor
+  // thread after the terminate call returns.
+  CursorParameters params;
+  params.planNode =
+      PlanBuilder().tableScan(ROW({"c0"}, {BIGINT()})).planNode();
+  params.maxDrivers = 4;
+  params.queryCtx = std::make_shared<core::QueryCtx>(
+      driverExecutor_.get(),
+      std::unordered_map<std::string, std::string>{
+          {core::QueryConfig::kTaskDeferredTeardownEnabled, "true"}});
+
+  auto cursor = std::make_unique<TaskCursor>(params);
+  auto task = cursor->task();
+  cursor->start();
+  task->requestCancel();
+  VELOX_ASSERT_THROW(cursor->moveNext(), "Cancelled");
+  ASSERT_TRUE(waitForTaskCancelled(task.get()));
+  ASSERT_TRUE(waitForTaskDriversToFinish(task.get()));
+}
+
 TEST_F(TaskTest, singleThreadedExecution) {
   auto data = makeRowVector({
       makeFlatVector<int64_t>(1'000, [](auto row) { return row; }),
@@ -535,6 +559,45 @@ TEST_F(TaskTest, singleThreadedExecution) {
   VELOX_ASSERT_THROW(executeSingleThreaded(plan), "division by zero");
 }
 
+TEST_F(TaskTest, taskTrace) {
+  auto data = makeRowVector({
+      makeFlatVector<int64_t>(1'000, [](auto row) { return row; }),
+  });
+
+  auto plan = PlanBuilder()
+                  .values({data, data})
+                  .filter("c0 < 100")
+                  .project({"c0 + 5"})
+                  .planFragment();
+
+  // Tracing is off by default.
+  auto task = Task::create(
+      "task.trace.0", plan, 0, std::make_shared<core::QueryCtx>());
+  ASSERT_EQ(task->tracer(), nullptr);
+  ASSERT_EQ(task->traceJson(), "");
+
+  auto queryCtx = std::make_shared<core::QueryCtx>();
+  queryCtx->testingOverrideConfigUnsafe(
+      {{core::QueryConfig::kTaskTraceEnabled, "true"}});
+  task = Task::create("task.trace.1", plan, 0, std::move(queryCtx));
+  ASSERT_NE(task->tracer(), nullptr);
+
+  while (auto result = task->next()) {
+  }
+  ASSERT_TRUE(waitForTaskCompletion(task.get()));
+
+  auto trace = folly::parseJson(task->traceJson());
+  const auto& events = trace["traceEvents"];
+  ASSERT_GT(events.size(), 0);
+  std::unordered_set<std::string> names;
+  for (const auto& event : events) {
+    names.insert(event["name"].asString());
+  }
+  EXPECT_EQ(names.count("Values::getOutput"), 1);
+  EXPECT_EQ(names.count("FilterProject::addInput"), 1);
+  EXPECT_EQ(names.count("FilterProject::getOutput"), 1);
+}
+
 TEST_F(TaskTest, singleThreadedHashJoin) {
   auto left = makeRowVector(
       {"t_c0", "t_c1"},
@@ -164,6 +164,25 @@ TEST_F(TopNRowNumberTest, manyPartitions) {
   testLimit(1);
   testLimit(2);
   testLimit(100);
+
+  // Descending order exercises the inverted sort key prefixes used to discard
+  // losing rows early.
+  auto testDescLimit = [&](auto limit) {
+    auto plan = PlanBuilder()
+                    .values({data})
+                    .topNRowNumber({"c0"}, {"c1 DESC"}, limit, true)
+                    .planNode();
+
+    assertQuery(
+        plan,
+        fmt::format(
+            "SELECT * FROM (SELECT *, row_number() over (partition by c0 order by c1 DESC) as rn FROM tmp) "
+            " WHERE rn <= {}",
+            limit));
+  };
+
+  testDescLimit(1);
+  testDescLimit(2);
 }
 
 } // namespace
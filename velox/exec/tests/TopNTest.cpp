@@ -148,6 +148,23 @@ TEST_F(TopNTest, singleKey) {
   testSingleKey(vectors, "c0", "c0 % 2 >= 0");
 }
 
+TEST_F(TopNTest, singleKeyWithoutNulls) {
+  // A null-free bigint key exercises the vectorized pre-filter against the
+  // current limit-th row. Later batches contain mostly losing rows.
+  vector_size_t batchSize = 1000;
+  std::vector<RowVectorPtr> vectors;
+  for (int32_t i = 0; i < 5; ++i) {
+    auto c0 = makeFlatVector<int64_t>(
+        batchSize, [&](vector_size_t row) { return batchSize * i + row; });
+    auto c1 = makeFlatVector<double>(
+        batchSize, [](vector_size_t row) { return row * 0.1; }, nullEvery(11));
+    vectors.push_back(makeRowVector({c0, c1}));
+  }
+  createDuckDbTable(vectors);
+
+  testSingleKey(vectors, "c0", 10);
+}
+
 TEST_F(TopNTest, multipleKeys) {
   vector_size_t batchSize = 1000;
   std::vector<RowVectorPtr> vectors;
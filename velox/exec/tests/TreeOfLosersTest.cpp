@@ -24,8 +24,12 @@ class TreeOfLosersTest : public testing::Test, public MergeTestBase {
     seed(1);
   }
 
-  void testBoth(int32_t numValues, int32_t numStreams) {
-    TestData testData = makeTestData(numValues, numStreams);
+  void testBoth(
+      int32_t numValues,
+      int32_t numStreams,
+      bool supportsKeyPrefix = true) {
+    TestData testData =
+        makeTestData(numValues, numStreams, supportsKeyPrefix);
     test<TreeOfLosers<TestingStream>>(testData, true);
     test<MergeArray<TestingStream>>(testData, true);
   }
@@ -40,6 +44,14 @@ TEST_F(TreeOfLosersTest, merge) {
   testBoth(500, 1);
 }
 
+TEST_F(TreeOfLosersTest, mergeWithoutKeyPrefixes) {
+  // Covers the compare-only path taken when some stream does not
+  // supply key prefixes.
+  testBoth(11, 2, false);
+  testBoth(17, 17, false);
+  testBoth(5000000, 37, false);
+}
+
 TEST_F(TreeOfLosersTest, nextWithEquals) {
   constexpr int32_t kNumStreams = 17;
   std::vector<std::vector<uint32_t>> streams(kNumStreams);
@@ -15,6 +15,7 @@
  */
 #include "velox/exec/VectorHasher.h"
 #include <gtest/gtest.h>
+#include <unordered_set>
 #include "velox/common/base/tests/GTestUtils.h"
 #include "velox/type/Type.h"
 #include "velox/vector/tests/utils/VectorMaker.h"
@@ -224,6 +225,44 @@ TEST_F(VectorHasherTest, flat) {
   }
 }
 
+TEST_F(VectorHasherTest, crcHash) {
+  auto hasher = exec::VectorHasher::create(BIGINT(), 0);
+  hasher->setUseCrcHash(true);
+
+  auto vector = BaseVector::create(BIGINT(), 100, pool_.get());
+  auto flatVector = vector->asFlatVector<int64_t>();
+  for (int32_t i = 0; i < 100; i++) {
+    if (i % 5 == 0) {
+      flatVector->setNull(i, true);
+    } else {
+      flatVector->set(i, i);
+    }
+  }
+
+  raw_vector<uint64_t> hashes(100);
+  hasher->decode(*vector, allRows_);
+  hasher->hash(allRows_, false, hashes);
+  std::unordered_set<uint64_t> distinct;
+  for (int32_t i = 0; i < 100; i++) {
+    if (i % 5 == 0) {
+      EXPECT_EQ(hashes[i], exec::VectorHasher::kNullHash) << "at " << i;
+    } else {
+      EXPECT_NE(hashes[i], folly::hasher<int64_t>()(i)) << "at " << i;
+      distinct.insert(hashes[i]);
+    }
+  }
+  // CRC32-C of distinct values is distinct.
+  EXPECT_EQ(distinct.size(), 80);
+
+  // The hash is a pure function of the value.
+  raw_vector<uint64_t> hashesAgain(100);
+  hasher->decode(*vector, allRows_);
+  hasher->hash(allRows_, false, hashesAgain);
+  for (int32_t i = 0; i < 100; i++) {
+    EXPECT_EQ(hashes[i], hashesAgain[i]) << "at " << i;
+  }
+}
+
 TEST_F(VectorHasherTest, nonNullConstant) {
   auto hasher = exec::VectorHasher::create(INTEGER(), 1);
   auto vector = BaseVector::createConstant(INTEGER(), 123, 100, pool_.get());
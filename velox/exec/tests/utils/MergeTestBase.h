@@ -50,8 +50,10 @@ class MergeValue {
 // Testing source for sorted streams for merging.
 class TestingStream final : public MergeStream {
  public:
-  explicit TestingStream(std::vector<uint32_t>&& numbers)
-      : numbers_(std::move(numbers)) {}
+  explicit TestingStream(
+      std::vector<uint32_t>&& numbers,
+      bool supportsKeyPrefix = true)
+      : numbers_(std::move(numbers)), supportsKeyPrefix_(supportsKeyPrefix) {}
 
   bool hasData() const final {
     if (!numbers_.empty()) {
@@ -91,6 +93,14 @@ class TestingStream final : public MergeStream {
                                          : 1;
   }
 
+  bool supportsKeyPrefix() const final {
+    return supportsKeyPrefix_;
+  }
+
+  uint64_t keyPrefix() const final {
+    return current_.value();
+  }
+
  private:
   // True if 'current_' is initialized.
   mutable bool currentValid_{false};
@@ -98,6 +108,9 @@ class TestingStream final : public MergeStream {
 
   // The reversed sequence of values 'this represents.
   std::vector<uint32_t> numbers_;
+
+  // False to disable the key prefix fast path in TreeOfLosers.
+  const bool supportsKeyPrefix_;
 };
 
 // Test data for merging.
@@ -115,8 +128,13 @@ class MergeTestBase {
     rng_.seed(seed);
   }
 
-  // Makes 'numRuns' sorted streams totalling 'numValues' entries.
-  TestData makeTestData(int32_t numValues, int32_t numRuns) {
+  // Makes 'numRuns' sorted streams totalling 'numValues' entries. With
+  // 'supportsKeyPrefix' false the streams disable the TreeOfLosers key
+  // prefix fast path so that the compare-based path stays covered.
+  TestData makeTestData(
+      int32_t numValues,
+      int32_t numRuns,
+      bool supportsKeyPrefix = true) {
     TestData data;
     data.data.reserve(numValues);
     for (auto i = 0; i < numValues; ++i) {
@@ -141,7 +159,8 @@ class MergeTestBase {
     std::sort(data.data.begin(), data.data.end());
 
     for (auto& run : runs) {
-      data.sources.push_back(std::make_unique<TestingStream>(std::move(run)));
+      data.sources.push_back(
+          std::make_unique<TestingStream>(std::move(run), supportsKeyPrefix));
     }
     return data;
   }
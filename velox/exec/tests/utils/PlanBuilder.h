@@ -693,6 +693,11 @@ class PlanBuilder {
   ///  rows between a + 10 preceding and 10 following)"
   PlanBuilder& window(const std::vector<std::string>& windowFunctions);
 
+  /// Add a WindowNode with 'inputsSorted' set to stream over inputs already
+  /// sorted on the PARTITION BY and ORDER BY keys. The window function
+  /// strings follow the same format as in window().
+  PlanBuilder& streamingWindow(const std::vector<std::string>& windowFunctions);
+
   /// Add a RowNumberNode to compute single row_number window function with an
   /// optional limit and no sorting.
   PlanBuilder& rowNumber(
@@ -768,6 +773,10 @@ class PlanBuilder {
       const std::shared_ptr<const core::IExpr>& untypedExpr);
 
  private:
+  PlanBuilder& window(
+      const std::vector<std::string>& windowFunctions,
+      bool inputsSorted);
+
   std::shared_ptr<const core::FieldAccessTypedExpr> field(column_index_t index);
 
   std::vector<std::shared_ptr<const core::FieldAccessTypedExpr>> fields(
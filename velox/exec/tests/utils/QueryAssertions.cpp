@@ -339,6 +339,87 @@ velox::variant arrayVariantAt(
   return velox::variant::array(std::move(array));
 }
 
+// Reads one value of a primitive type directly from the data array of a
+// flattened DuckDB vector. Bypasses DataChunk::GetValue(), which
+// allocates a duckdb::Value per cell and dominates the conversion time
+// of large results.
+template <TypeKind kind>
+velox::variant directVariantAt(::duckdb::Vector& duckVector, int32_t row) {
+  using T = typename KindToFlatVector<kind>::WrapperType;
+  return velox::variant(::duckdb::FlatVector::GetData<T>(duckVector)[row]);
+}
+
+template <>
+velox::variant directVariantAt<TypeKind::VARCHAR>(
+    ::duckdb::Vector& duckVector,
+    int32_t row) {
+  auto value = ::duckdb::FlatVector::GetData<::duckdb::string_t>(duckVector);
+  return velox::variant(
+      StringView(value[row].GetDataUnsafe(), value[row].GetSize()));
+}
+
+template <>
+velox::variant directVariantAt<TypeKind::VARBINARY>(
+    ::duckdb::Vector& duckVector,
+    int32_t row) {
+  auto value = ::duckdb::FlatVector::GetData<::duckdb::string_t>(duckVector);
+  return velox::variant(
+      StringView(value[row].GetDataUnsafe(), value[row].GetSize()));
+}
+
+template <>
+velox::variant directVariantAt<TypeKind::TIMESTAMP>(
+    ::duckdb::Vector& duckVector,
+    int32_t row) {
+  auto value = ::duckdb::FlatVector::GetData<::duckdb::timestamp_t>(duckVector);
+  return velox::variant::timestamp(duckdbTimestampToVelox(value[row]));
+}
+
+template <>
+velox::variant directVariantAt<TypeKind::DATE>(
+    ::duckdb::Vector& duckVector,
+    int32_t row) {
+  auto value = ::duckdb::FlatVector::GetData<::duckdb::date_t>(duckVector);
+  return velox::variant::date(::duckdb::Date::EpochDays(value[row]));
+}
+
+// Returns true if values of 'type' can be read from the column data of
+// a flattened DuckDB vector of 'duckType' without conversion through
+// duckdb::Value.
+bool canReadDirectly(
+    const TypePtr& type,
+    const ::duckdb::LogicalType& duckType) {
+  if (type->isDecimal() || isIntervalDayTimeType(type)) {
+    return false;
+  }
+  switch (type->kind()) {
+    case TypeKind::BOOLEAN:
+      return duckType.id() == ::duckdb::LogicalTypeId::BOOLEAN;
+    case TypeKind::TINYINT:
+      return duckType.id() == ::duckdb::LogicalTypeId::TINYINT;
+    case TypeKind::SMALLINT:
+      return duckType.id() == ::duckdb::LogicalTypeId::SMALLINT;
+    case TypeKind::INTEGER:
+      return duckType.id() == ::duckdb::LogicalTypeId::INTEGER;
+    case TypeKind::BIGINT:
+      return duckType.id() == ::duckdb::LogicalTypeId::BIGINT;
+    case TypeKind::REAL:
+      return duckType.id() == ::duckdb::LogicalTypeId::FLOAT;
+    case TypeKind::DOUBLE:
+      return duckType.id() == ::duckdb::LogicalTypeId::DOUBLE;
+    case TypeKind::VARCHAR:
+      return duckType.id() == ::duckdb::LogicalTypeId::VARCHAR;
+    case TypeKind::VARBINARY:
+      return duckType.id() == ::duckdb::LogicalTypeId::BLOB;
+    case TypeKind::TIMESTAMP:
+      return duckType.id() == ::duckdb::LogicalTypeId::TIMESTAMP;
+    case TypeKind::DATE:
+      return duckType.id() == ::duckdb::LogicalTypeId::DATE;
+    default:
+      return false;
+  }
+}
+
 std::vector<MaterializedRow> materialize(
     ::duckdb::DataChunk* dataChunk,
     const std::shared_ptr<const RowType>& rowType) {
@@ -355,13 +436,32 @@ std::vector<MaterializedRow> materialize(
     nulls.emplace_back(nullVariant(rowType->childAt(j)));
   }
 
+  // Columns of primitive types are read directly from the flattened
+  // column data; the others go value by value through
+  // DataChunk::GetValue().
+  dataChunk->Normalify();
+  const auto& duckTypes = dataChunk->GetTypes();
+  std::vector<bool> directColumns;
+  directColumns.reserve(rowType->size());
+  for (size_t j = 0; j < rowType->size(); ++j) {
+    directColumns.push_back(canReadDirectly(rowType->childAt(j), duckTypes[j]));
+  }
+
   for (size_t i = 0; i < size; ++i) {
     MaterializedRow row;
     row.reserve(rowType->size());
     for (size_t j = 0; j < rowType->size(); ++j) {
       auto type = rowType->childAt(j);
       auto typeKind = type->kind();
-      if (dataChunk->GetValue(j, i).IsNull()) {
+      if (directColumns[j]) {
+        auto& duckVector = dataChunk->data[j];
+        if (!::duckdb::FlatVector::Validity(duckVector).RowIsValid(i)) {
+          row.push_back(nulls[j]);
+        } else {
+          row.push_back(VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
+              directVariantAt, typeKind, duckVector, i));
+        }
+      } else if (dataChunk->GetValue(j, i).IsNull()) {
         row.push_back(nulls[j]);
       } else if (typeKind == TypeKind::ARRAY) {
         row.push_back(arrayVariantAt(dataChunk->GetValue(j, i), type));
@@ -15,6 +15,8 @@
  */
 #pragma once
 
+#include <string>
+#include <unordered_map>
 #include "velox/experimental/codegen/compiler_utils/Compiler.h"
 #include "velox/experimental/codegen/compiler_utils/CompilerOptions.h"
 #include "velox/experimental/codegen/library_loader/NativeLibraryLoader.h"
@@ -45,9 +47,33 @@ class CodeManager {
     return loader_;
   }
 
+  /// Compile and link a generated c++ source string into a dynamic library.
+  /// Results are cached by source content, so identical generated fragments
+  /// (common with machine generated expression trees) invoke the external
+  /// compiler only once per manager.  Callers must pass the same
+  /// additionalLibraries for a given source string.
+  /// \param additionalLibraries
+  /// \param cppContent c++ file content
+  /// \return path to the generated .so
+  std::filesystem::path produceLibrary(
+      const std::vector<compiler_utils::LibraryDescriptor>& additionalLibraries,
+      const std::string& cppContent) {
+    if (auto it = libraryCache_.find(cppContent); it != libraryCache_.end()) {
+      return it->second;
+    }
+    auto compiledObject =
+        compiler_.compileString(additionalLibraries, cppContent);
+    auto dynamicObject = compiler_.link(additionalLibraries, {compiledObject});
+    libraryCache_.emplace(cppContent, dynamicObject);
+    return dynamicObject;
+  }
+
  private:
   Compiler compiler_;
   NativeLibraryLoader loader_;
   DefaultScopedTimer::EventSequence eventSequence_;
+
+  // Maps generated source content to the linked dynamic library path.
+  std::unordered_map<std::string, std::filesystem::path> libraryCache_;
 };
 } // namespace facebook::velox::codegen
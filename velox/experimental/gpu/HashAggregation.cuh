@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "velox/experimental/gpu/Common.h"
+
+namespace facebook::velox::gpu {
+
+/// Key slot value marking an empty entry in the device hash table.  Input
+/// batches must not contain this key.
+constexpr int64_t kEmptyKey = std::numeric_limits<int64_t>::min();
+
+namespace detail {
+
+__device__ inline uint64_t hashGroupKey(uint64_t key) {
+  constexpr uint64_t kMul = 0x9ddfea08eb382d69ULL;
+  uint64_t a = key * kMul;
+  a ^= (a >> 47);
+  a *= kMul;
+  a ^= (a >> 47);
+  return a;
+}
+
+/// One thread per input row.  Claims a slot in the open addressing table
+/// with linear probing and accumulates the value with an atomic add.
+__global__ void groupBySum(
+    const int64_t* keys,
+    const int64_t* values,
+    int numRows,
+    int64_t* tableKeys,
+    int64_t* tableValues,
+    uint64_t capacityMask) {
+  auto i = threadIdx.x + 1ll * blockIdx.x * blockDim.x;
+  if (i >= numRows) {
+    return;
+  }
+  auto key = keys[i];
+  auto slot = hashGroupKey(key) & capacityMask;
+  for (;;) {
+    auto old = atomicCAS(
+        reinterpret_cast<unsigned long long*>(&tableKeys[slot]),
+        static_cast<unsigned long long>(kEmptyKey),
+        static_cast<unsigned long long>(key));
+    if (old == static_cast<unsigned long long>(kEmptyKey) ||
+        old == static_cast<unsigned long long>(key)) {
+      break;
+    }
+    slot = (slot + 1) & capacityMask;
+  }
+  atomicAdd(
+      reinterpret_cast<unsigned long long*>(&tableValues[slot]),
+      static_cast<unsigned long long>(values[i]));
+}
+
+__global__ void fillKeys(int64_t* tableKeys, uint64_t capacity) {
+  auto i = threadIdx.x + 1ll * blockIdx.x * blockDim.x;
+  if (i < capacity) {
+    tableKeys[i] = kEmptyKey;
+  }
+}
+
+} // namespace detail
+
+/// Prototype of a group-by-sum over fixed-width keys and accumulators in
+/// device memory.  Input batches are staged into pinned host buffers and
+/// copied to the device asynchronously; two buffer/stream pairs are rotated
+/// so the host-to-device transfer of one batch overlaps the aggregation
+/// kernel of the previous one.  The table stays resident on the device for
+/// the whole aggregation and is read back once in finish().
+///
+/// This is the kernel-level half of a GPU aggregation operator; the
+/// exec::Operator wrapper needs the gpu module linked into exec and is left
+/// out of the prototype.
+class HashAggregation {
+ public:
+  /// `capacity` must be a power of 2 and larger than the number of distinct
+  /// keys; the table does not rehash.  `maxBatchRows` bounds the size of
+  /// batches passed to addBatch().
+  HashAggregation(uint64_t capacity, int maxBatchRows)
+      : capacity_(capacity), maxBatchRows_(maxBatchRows) {
+    assert(__builtin_popcountll(capacity) == 1);
+    CUDA_CHECK_FATAL(cudaMalloc(&tableKeys_, capacity * sizeof(int64_t)));
+    CUDA_CHECK_FATAL(cudaMalloc(&tableValues_, capacity * sizeof(int64_t)));
+    CUDA_CHECK_FATAL(cudaMemset(tableValues_, 0, capacity * sizeof(int64_t)));
+    detail::fillKeys<<<(capacity + kBlockSize - 1) / kBlockSize, kBlockSize>>>(
+        tableKeys_, capacity);
+    CUDA_CHECK_FATAL(cudaGetLastError());
+    for (int i = 0; i < 2; ++i) {
+      CUDA_CHECK_FATAL(
+          cudaMallocHost(&hostKeys_[i], maxBatchRows * sizeof(int64_t)));
+      CUDA_CHECK_FATAL(
+          cudaMallocHost(&hostValues_[i], maxBatchRows * sizeof(int64_t)));
+      CUDA_CHECK_FATAL(
+          cudaMalloc(&deviceKeys_[i], maxBatchRows * sizeof(int64_t)));
+      CUDA_CHECK_FATAL(
+          cudaMalloc(&deviceValues_[i], maxBatchRows * sizeof(int64_t)));
+      streams_[i] = createCudaStream();
+      batchDone_[i] = createCudaEvent();
+    }
+  }
+
+  ~HashAggregation() {
+    for (int i = 0; i < 2; ++i) {
+      CUDA_CHECK_LOG(cudaFree(deviceValues_[i]));
+      CUDA_CHECK_LOG(cudaFree(deviceKeys_[i]));
+      CUDA_CHECK_LOG(cudaFreeHost(hostValues_[i]));
+      CUDA_CHECK_LOG(cudaFreeHost(hostKeys_[i]));
+    }
+    CUDA_CHECK_LOG(cudaFree(tableValues_));
+    CUDA_CHECK_LOG(cudaFree(tableKeys_));
+  }
+
+  /// Aggregate one batch of rows.  Returns as soon as the inputs are staged;
+  /// the transfer and kernel run asynchronously on the buffer's stream.
+  void addBatch(const int64_t* keys, const int64_t* values, int numRows) {
+    assert(numRows <= maxBatchRows_);
+    auto i = nextBuffer_;
+    nextBuffer_ ^= 1;
+    // Wait until the previous use of this buffer pair is finished before
+    // overwriting the staging copy.
+    CUDA_CHECK_FATAL(cudaEventSynchronize(batchDone_[i].get()));
+    memcpy(hostKeys_[i], keys, numRows * sizeof(int64_t));
+    memcpy(hostValues_[i], values, numRows * sizeof(int64_t));
+    CUDA_CHECK_FATAL(cudaMemcpyAsync(
+        deviceKeys_[i],
+        hostKeys_[i],
+        numRows * sizeof(int64_t),
+        cudaMemcpyHostToDevice,
+        streams_[i].get()));
+    CUDA_CHECK_FATAL(cudaMemcpyAsync(
+        deviceValues_[i],
+        hostValues_[i],
+        numRows * sizeof(int64_t),
+        cudaMemcpyHostToDevice,
+        streams_[i].get()));
+    detail::groupBySum<<<
+        (numRows + kBlockSize - 1) / kBlockSize,
+        kBlockSize,
+        0,
+        streams_[i].get()>>>(
+        deviceKeys_[i],
+        deviceValues_[i],
+        numRows,
+        tableKeys_,
+        tableValues_,
+        capacity_ - 1);
+    CUDA_CHECK_FATAL(cudaGetLastError());
+    CUDA_CHECK_FATAL(cudaEventRecord(batchDone_[i].get(), streams_[i].get()));
+  }
+
+  /// Wait for all pending batches and read back the occupied table entries
+  /// as (key, sum) pairs in table order.
+  std::vector<std::pair<int64_t, int64_t>> finish() {
+    for (int i = 0; i < 2; ++i) {
+      CUDA_CHECK_FATAL(cudaStreamSynchronize(streams_[i].get()));
+    }
+    std::vector<int64_t> keys(capacity_);
+    std::vector<int64_t> values(capacity_);
+    CUDA_CHECK_FATAL(cudaMemcpy(
+        keys.data(),
+        tableKeys_,
+        capacity_ * sizeof(int64_t),
+        cudaMemcpyDeviceToHost));
+    CUDA_CHECK_FATAL(cudaMemcpy(
+        values.data(),
+        tableValues_,
+        capacity_ * sizeof(int64_t),
+        cudaMemcpyDeviceToHost));
+    std::vector<std::pair<int64_t, int64_t>> groups;
+    for (uint64_t i = 0; i < capacity_; ++i) {
+      if (keys[i] != kEmptyKey) {
+        groups.emplace_back(keys[i], values[i]);
+      }
+    }
+    return groups;
+  }
+
+ private:
+  static constexpr int kBlockSize = 256;
+
+  const uint64_t capacity_;
+  const int maxBatchRows_;
+  int64_t* tableKeys_;
+  int64_t* tableValues_;
+  int64_t* hostKeys_[2];
+  int64_t* hostValues_[2];
+  int64_t* deviceKeys_[2];
+  int64_t* deviceValues_[2];
+  CudaStream streams_[2];
+  CudaEvent batchDone_[2];
+  int nextBuffer_ = 0;
+};
+
+} // namespace facebook::velox::gpu
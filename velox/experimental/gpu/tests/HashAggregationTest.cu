@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <folly/init/Init.h>
+#include <gflags/gflags.h>
+#include <chrono>
+#include <random>
+#include <unordered_map>
+#include "velox/experimental/gpu/HashAggregation.cuh"
+
+DEFINE_int32(batch_rows, 1 << 20, "");
+DEFINE_int32(num_batches, 100, "");
+DEFINE_int64(num_groups, 1 << 16, "");
+DEFINE_int64(table_capacity, 1 << 18, "Must be a power of 2");
+DEFINE_bool(validate, true, "");
+
+namespace facebook::velox::gpu {
+namespace {
+
+void testHashAggregation() {
+  std::default_random_engine gen(0);
+  std::uniform_int_distribution<int64_t> keyDist(0, FLAGS_num_groups - 1);
+  std::uniform_int_distribution<int64_t> valueDist(0, 1000);
+  std::vector<int64_t> keys(1ll * FLAGS_num_batches * FLAGS_batch_rows);
+  std::vector<int64_t> values(keys.size());
+  std::unordered_map<int64_t, int64_t> expected;
+  for (size_t i = 0; i < keys.size(); ++i) {
+    keys[i] = keyDist(gen);
+    values[i] = valueDist(gen);
+    if (FLAGS_validate) {
+      expected[keys[i]] += values[i];
+    }
+  }
+
+  HashAggregation aggregation(FLAGS_table_capacity, FLAGS_batch_rows);
+  auto startTime = std::chrono::steady_clock::now();
+  for (int i = 0; i < FLAGS_num_batches; ++i) {
+    aggregation.addBatch(
+        keys.data() + 1ll * i * FLAGS_batch_rows,
+        values.data() + 1ll * i * FLAGS_batch_rows,
+        FLAGS_batch_rows);
+  }
+  auto groups = aggregation.finish();
+  auto time = std::chrono::duration_cast<std::chrono::microseconds>(
+                  std::chrono::steady_clock::now() - startTime)
+                  .count();
+  printf(
+      "Aggregated %zu rows into %zu groups: %.2f million rows/s\n",
+      keys.size(),
+      groups.size(),
+      1.0 * keys.size() / time);
+
+  if (FLAGS_validate) {
+    if (groups.size() != expected.size()) {
+      fprintf(
+          stderr,
+          "Group count mismatch: %zu vs %zu\n",
+          groups.size(),
+          expected.size());
+      abort();
+    }
+    for (auto [key, sum] : groups) {
+      auto it = expected.find(key);
+      if (it == expected.end() || it->second != sum) {
+        fprintf(stderr, "Bad sum for key %ld\n", key);
+        abort();
+      }
+    }
+    printf("Validation passed\n");
+  }
+}
+
+} // namespace
+} // namespace facebook::velox::gpu
+
+int main(int argc, char** argv) {
+  folly::init(&argc, &argv);
+  facebook::velox::gpu::testHashAggregation();
+  return 0;
+}
@@ -19,6 +19,7 @@
 #include <stdexcept>
 
 #include <fmt/format.h>
+#include <folly/Conv.h>
 
 #include <velox/common/base/VeloxException.h>
 #include "velox/common/base/Exceptions.h"
@@ -127,6 +128,88 @@ void applyIntToDecimalCastKernel(
   });
 }
 
+// Writes the decimal form of 'value' to 'out'. Returns the number of
+// characters written.
+template <typename T>
+int32_t writeInt(T value, char* out) {
+  char* pos = out;
+  uint64_t absValue;
+  if (value < 0) {
+    *pos++ = '-';
+    // Negate in the unsigned domain to handle the minimum value.
+    absValue = ~static_cast<uint64_t>(value) + 1;
+  } else {
+    absValue = static_cast<uint64_t>(value);
+  }
+  pos += folly::uint64ToBufferUnsafe(absValue, pos);
+  return pos - out;
+}
+
+// Batch kernel for casting integers to VARCHAR. Writes the digits
+// straight into the result vector instead of routing every row through
+// folly::to<std::string> and a string writer. Integer to string
+// conversion cannot fail or produce null, so there is no per-row error
+// handling.
+template <typename T>
+void applyIntToVarcharCastKernel(
+    const SelectivityVector& rows,
+    const SimpleVector<T>* input,
+    FlatVector<StringView>* result) {
+  // Maximum number of characters the decimal form of a T can take,
+  // including the sign.
+  constexpr int32_t kMaxChars = std::is_same_v<T, int64_t> ? 20
+      : std::is_same_v<T, int32_t>                         ? 11
+      : std::is_same_v<T, int16_t>                         ? 6
+                                                           : 4;
+  if constexpr (kMaxChars <= StringView::kInlineSize) {
+    // Every value fits inline in the StringView, no string buffer is
+    // needed.
+    rows.applyToSelected([&](vector_size_t row) {
+      char chars[kMaxChars];
+      const auto size = writeInt(input->valueAt(row), chars);
+      result->setNoCopy(row, StringView(chars, size));
+    });
+  } else {
+    char* rawBuffer =
+        result->getRawStringBufferWithSpace(rows.countSelected() * kMaxChars);
+    rows.applyToSelected([&](vector_size_t row) {
+      const auto size = writeInt(input->valueAt(row), rawBuffer);
+      result->setNoCopy(row, StringView(rawBuffer, size));
+      rawBuffer += size;
+    });
+  }
+}
+
+// Batch kernel for casting REAL and DOUBLE to VARCHAR. Reuses one
+// scratch string for folly's shortest-representation conversion and
+// copies the characters into a single pre-reserved string buffer.
+template <typename T>
+void applyFloatingPointToVarcharCastKernel(
+    const SelectivityVector& rows,
+    const SimpleVector<T>* input,
+    bool truncate,
+    FlatVector<StringView>* result) {
+  // Large enough for the longest shortest-form double plus the
+  // trailing ".0" added under truncate semantics.
+  constexpr int32_t kMaxChars = 32;
+  char* rawBuffer =
+      result->getRawStringBufferWithSpace(rows.countSelected() * kMaxChars);
+  std::string scratch;
+  rows.applyToSelected([&](vector_size_t row) {
+    scratch.clear();
+    folly::toAppend(input->valueAt(row), &scratch);
+    if constexpr (std::is_same_v<T, double>) {
+      if (truncate && scratch.find('.') == std::string::npos &&
+          isdigit(scratch[scratch.size() - 1])) {
+        scratch += ".0";
+      }
+    }
+    std::memcpy(rawBuffer, scratch.data(), scratch.size());
+    result->setNoCopy(row, StringView(rawBuffer, scratch.size()));
+    rawBuffer += scratch.size();
+  });
+}
+
 template <TypeKind ToKind, TypeKind FromKind>
 void applyCastPrimitives(
     const SelectivityVector& rows,
@@ -140,6 +223,23 @@ void applyCastPrimitives(
 
   const auto& queryConfig = context.execCtx()->queryCtx()->queryConfig();
 
+  if constexpr (ToKind == TypeKind::VARCHAR) {
+    if constexpr (
+        FromKind == TypeKind::TINYINT || FromKind == TypeKind::SMALLINT ||
+        FromKind == TypeKind::INTEGER || FromKind == TypeKind::BIGINT) {
+      applyIntToVarcharCastKernel(rows, inputSimpleVector, resultFlatVector);
+      return;
+    }
+    if constexpr (FromKind == TypeKind::REAL || FromKind == TypeKind::DOUBLE) {
+      applyFloatingPointToVarcharCastKernel(
+          rows,
+          inputSimpleVector,
+          queryConfig.isCastToIntByTruncate(),
+          resultFlatVector);
+      return;
+    }
+  }
+
   if (!queryConfig.isCastToIntByTruncate()) {
     context.applyToSelectedNoThrow(rows, [&](int row) {
       bool nullOutput = false;
@@ -247,12 +347,9 @@ VectorPtr CastExpr::applyMap(
   auto mapValues = input->mapValues();
 
   SelectivityVector nestedRows;
-  BufferPtr elementToTopLevelRows;
   if (fromType.keyType() != toType.keyType() ||
       fromType.valueType() != toType.valueType()) {
     nestedRows = functions::toElementRows(mapKeys->size(), rows, input);
-    elementToTopLevelRows = functions::getElementToTopLevelRows(
-        mapKeys->size(), rows, input, context.pool());
   }
 
   ErrorVectorPtr oldErrors;
@@ -286,8 +383,15 @@ VectorPtr CastExpr::applyMap(
         newMapValues);
   }
 
-  context.addElementErrorsToTopLevel(
-      nestedRows, elementToTopLevelRows, oldErrors);
+  if (context.errors()) {
+    // Build the element-to-top-level-row mapping only when element
+    // errors actually occurred; most casts between matching shapes
+    // cannot fail, so this avoids an O(elements) scan per batch.
+    auto elementToTopLevelRows = functions::getElementToTopLevelRows(
+        mapKeys->size(), rows, input, context.pool());
+    context.addElementErrorsToTopLevel(
+        nestedRows, elementToTopLevelRows, oldErrors);
+  }
   context.swapErrors(oldErrors);
 
   // Returned map vector should be addressable for every element, even those
@@ -333,8 +437,6 @@ VectorPtr CastExpr::applyArray(
 
   auto nestedRows =
       functions::toElementRows(arrayElements->size(), rows, input);
-  auto elementToTopLevelRows = functions::getElementToTopLevelRows(
-      arrayElements->size(), rows, input, context.pool());
 
   ErrorVectorPtr oldErrors;
   context.swapErrors(oldErrors);
@@ -349,6 +451,10 @@ VectorPtr CastExpr::applyArray(
       newElements);
 
   if (context.errors()) {
+    // As in applyMap, the mapping is only needed to attribute element
+    // errors to their top-level rows.
+    auto elementToTopLevelRows = functions::getElementToTopLevelRows(
+        arrayElements->size(), rows, input, context.pool());
     context.addElementErrorsToTopLevel(
         nestedRows, elementToTopLevelRows, oldErrors);
   }
@@ -168,6 +168,16 @@ void ConjunctExpr::evalSpecialForm(
   }
   if (reorderEnabled_) {
     maybeReorderInputs();
+    // Periodically decay the accumulated selectivity. Without this,
+    // early history dominates and the order stops adapting when
+    // selectivity changes partway through a scan, e.g. with data skew
+    // across partitions.
+    if (++batchesSinceDecay_ >= kSelectivityDecayBatches) {
+      for (auto& info : selectivity_) {
+        info.decay();
+      }
+      batchesSinceDecay_ = 0;
+    }
   }
 }
 
@@ -244,6 +254,39 @@ void ConjunctExpr::updateResult(
       }
       return;
     default: {
+      if (!nulls) {
+        // No nulls in 'inputResult': decide all lanes word at a time
+        // instead of testing rows one by one. For AND, rows where the
+        // input is false get a false result and drop out of
+        // 'activeRows'. For OR, rows where the input is true get a true
+        // result and drop out of 'activeRows'.
+        auto* resultValues = result->mutableRawValues<uint64_t>();
+        auto* resultNulls =
+            result->mayHaveNulls() ? result->mutableRawNulls() : nullptr;
+        auto* activeBits = activeRows->asMutableRange().bits();
+        bits::forEachWord(
+            activeRows->begin(),
+            activeRows->end(),
+            [&](int32_t index, uint64_t mask) {
+              uint64_t decided;
+              if (isAnd_) {
+                decided = activeBits[index] & ~values[index] & mask;
+                resultValues[index] &= ~decided;
+              } else {
+                decided = activeBits[index] & values[index] & mask;
+                resultValues[index] |= decided;
+              }
+              if (resultNulls) {
+                // Rows decided now may have been marked null by an
+                // earlier all-null conjunct. A decided value overrides
+                // null.
+                resultNulls[index] |= decided;
+              }
+              activeBits[index] &= ~decided;
+            });
+        activeRows->updateBounds();
+        return;
+      }
       bits::forEachSetBit(
           activeRows->asRange().bits(),
           activeRows->begin(),
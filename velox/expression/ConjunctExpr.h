@@ -94,6 +94,13 @@ class ConjunctExpr : public SpecialForm {
   std::vector<SelectivityInfo> selectivity_;
   std::vector<int32_t> inputOrder_;
 
+  // Number of batches evaluated since 'selectivity_' was last decayed.
+  // The accumulated stats are halved every kSelectivityDecayBatches
+  // batches so that the input order tracks recent data.
+  int32_t batchesSinceDecay_ = 0;
+
+  static constexpr int32_t kSelectivityDecayBatches = 256;
+
   friend class ConjunctCallToSpecialForm;
 };
 
@@ -233,7 +233,12 @@ class EvalCtx {
       const SelectivityVector& rows,
       VectorPtr& result) const {
     if (result && !isFinalSelection() && *finalSelection() != rows) {
-      BaseVector::ensureWritable(rows, result->type(), result->pool(), result);
+      BaseVector::ensureWritable(
+          rows,
+          result->type(),
+          result->pool(),
+          result,
+          &execCtx_->vectorPool());
       result->copy(localResult.get(), rows, nullptr);
     } else {
       result = localResult;
@@ -247,6 +247,9 @@ void Expr::computeMetadata() {
   }
 
   hasConditionals_ = hasConditionals(this);
+
+  isConstantSubtree_ =
+      deterministic_ && distinctFields_.empty() && !inputs_.empty();
 }
 
 namespace {
@@ -721,6 +724,35 @@ void Expr::eval(
     EvalCtx& context,
     VectorPtr& result,
     const ExprSet* parentExprSet) {
+  if (FOLLY_UNLIKELY(isConstantSubtree_)) {
+    // A deterministic subtree over constant inputs produces the same value
+    // for every row of every batch. Evaluate it once and replay the cached
+    // value afterwards. This covers subtrees that escaped constant folding
+    // at compile time, e.g. when folding is disabled.
+    if (cachedConstantValue_ != nullptr) {
+      context.moveOrCopyResult(
+          BaseVector::wrapInConstant(rows.end(), 0, cachedConstantValue_),
+          rows,
+          result);
+      return;
+    }
+    evalImpl(rows, context, result, parentExprSet);
+    if (context.errors() == nullptr && result != nullptr &&
+        rows.isValid(rows.begin())) {
+      cachedConstantValue_ =
+          BaseVector::wrapInConstant(1, rows.begin(), result);
+    }
+    return;
+  }
+
+  evalImpl(rows, context, result, parentExprSet);
+}
+
+void Expr::evalImpl(
+    const SelectivityVector& rows,
+    EvalCtx& context,
+    VectorPtr& result,
+    const ExprSet* parentExprSet) {
   if (supportsFlatNoNullsFastPath_ && context.throwOnError() &&
       context.inputFlatNoNulls() && rows.countSelected() < 1'000) {
     evalFlatNoNulls(rows, context, result, parentExprSet);
@@ -929,9 +961,14 @@ Expr::PeelEncodingsResult Expr::peelEncodings(
     context.setPeeled(fieldIndex, peeledVectors[i]);
   }
 
-  // If the expression depends on one dictionary, results are cacheable.
-  bool mayCache = distinctFields_.size() == 1 &&
-      VectorEncoding::isDictionary(context.wrapEncoding());
+  // If the inputs are peeled off a common dictionary wrap, results per base
+  // row are cacheable across batches keyed on the alphabet vectors.
+  bool mayCache = !distinctFields_.empty() &&
+      VectorEncoding::isDictionary(context.wrapEncoding()) &&
+      context.execCtx()
+          ->queryCtx()
+          ->queryConfig()
+          .exprMemoizeDictionaryResults();
 
   return {newRows, finalRowsHolder.get(), mayCache};
 }
@@ -1049,13 +1086,11 @@ void Expr::addNulls(
   }
 
   if (!result.unique() || !result->isNullsWritable()) {
-    BaseVector::ensureWritable(
-        SelectivityVector::empty(), type, context.pool(), result);
+    context.ensureWritable(SelectivityVector::empty(), type, result);
   }
 
   if (result->size() < rows.end()) {
-    BaseVector::ensureWritable(
-        SelectivityVector::empty(), type, context.pool(), result);
+    context.ensureWritable(SelectivityVector::empty(), type, result);
     result->resize(rows.end());
   }
 
@@ -1113,10 +1148,12 @@ void Expr::evalWithMemo(
     const SelectivityVector& rows,
     EvalCtx& context,
     VectorPtr& result) {
-  VectorPtr base;
-  distinctFields_[0]->evalSpecialForm(rows, context, base);
+  std::vector<VectorPtr> bases(distinctFields_.size());
+  for (auto i = 0; i < distinctFields_.size(); ++i) {
+    distinctFields_[i]->evalSpecialForm(rows, context, bases[i]);
+  }
   ++numCachableInput_;
-  if (baseDictionary_ == base) {
+  if (baseDictionaries_ == bases) {
     ++numCacheableRepeats_;
     if (cachedDictionaryIndices_) {
       LocalSelectivityVector cachedHolder(context, rows);
@@ -1169,11 +1206,11 @@ void Expr::evalWithMemo(
       }
       dictionaryCache_->copy(result.get(), *uncached, nullptr);
     }
-    context.releaseVector(base);
+    context.releaseVectors(bases);
     return;
   }
-  context.releaseVector(baseDictionary_);
-  baseDictionary_ = base;
+  context.releaseVectors(baseDictionaries_);
+  baseDictionaries_ = std::move(bases);
   evalWithNulls(rows, context, result);
 
   context.releaseVector(dictionaryCache_);
@@ -1191,7 +1228,7 @@ void Expr::setAllNulls(
     EvalCtx& context,
     VectorPtr& result) const {
   if (result) {
-    BaseVector::ensureWritable(rows, type(), context.pool(), result);
+    context.ensureWritable(rows, type(), result);
     LocalSelectivityVector notNulls(context, rows.end());
     notNulls.get()->setAll();
     notNulls.get()->deselect(rows);
@@ -1705,6 +1742,13 @@ void ExprSet::clearSharedSubexprs() {
   }
 }
 
+void ExprSet::clearCachedVectors() {
+  clearSharedSubexprs();
+  for (auto& expr : exprs_) {
+    expr->clearCachedVectors();
+  }
+}
+
 void ExprSet::clear() {
   clearSharedSubexprs();
   for (auto* memo : memoizingExprs_) {
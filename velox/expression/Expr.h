@@ -182,6 +182,12 @@ class Expr {
       VectorPtr& result,
       const ExprSet* FOLLY_NULLABLE parentExprSet = nullptr);
 
+  void evalImpl(
+      const SelectivityVector& rows,
+      EvalCtx& context,
+      VectorPtr& result,
+      const ExprSet* FOLLY_NULLABLE parentExprSet);
+
   /// Evaluates the expression using fast path that assumes all inputs and
   /// intermediate results are flat or constant and have no nulls.
   ///
@@ -239,11 +245,25 @@ class Expr {
   }
 
   void clearMemo() {
-    baseDictionary_ = nullptr;
+    baseDictionaries_.clear();
     dictionaryCache_ = nullptr;
     cachedDictionaryIndices_ = nullptr;
   }
 
+  /// Drops all vectors cached by 'this' and its inputs during
+  /// evaluation: dictionary memos, shared subexpression results and
+  /// cached constant subtree values. Used before handing the
+  /// expression to another evaluation context, e.g. when reusing
+  /// compiled expressions across tasks.
+  void clearCachedVectors() {
+    clearMemo();
+    reset();
+    cachedConstantValue_ = nullptr;
+    for (auto& input : inputs_) {
+      input->clearCachedVectors();
+    }
+  }
+
   const TypePtr& type() const {
     return type_;
   }
@@ -538,6 +558,19 @@ class Expr {
   // True if this or a sub-expression is an IF, AND or OR.
   bool hasConditionals_ = false;
 
+  // True if this is a deterministic expression with at least one input that
+  // references no input columns. Such an expression evaluates to the same
+  // value for every row of every batch. Most of these are folded into
+  // constants at compile time; this flag covers the ones that are not, e.g.
+  // when constant folding is disabled or the fold was skipped because
+  // evaluation threw.
+  bool isConstantSubtree_ = false;
+
+  // One-time evaluation result of a constant subtree wrapped in a size 1
+  // constant vector. Set on the first successful evaluation and reused for
+  // all subsequent batches.
+  VectorPtr cachedConstantValue_;
+
   bool isMultiplyReferenced_ = false;
 
   std::vector<VectorPtr> inputValues_;
@@ -553,10 +586,13 @@ class Expr {
   // evaluateSharedSubexpr() is called to the cached shared results.
   std::map<std::vector<const BaseVector*>, SharedResults> sharedSubexprResults_;
 
-  VectorPtr baseDictionary_;
+  // The alphabets of the peeled dictionary inputs, 1:1 to 'distinctFields_'.
+  // 'dictionaryCache_' stays valid across batches as long as every distinct
+  // field wraps the same alphabet vectors.
+  std::vector<VectorPtr> baseDictionaries_;
 
-  // Values computed for the base dictionary, 1:1 to the positions in
-  // 'baseDictionary_'.
+  // Values computed for the base dictionaries, 1:1 to the positions in
+  // 'baseDictionaries_' entries.
   VectorPtr dictionaryCache_;
 
   // The indices that are valid in 'dictionaryCache_'.
@@ -617,6 +653,13 @@ class ExprSet {
 
   void clear();
 
+  /// Drops all vectors cached in the contained expressions during
+  /// evaluation while keeping the compiled expressions themselves.
+  /// Called when an ExprSet is returned to a pool for reuse by another
+  /// task, so that it does not hold on to memory from the previous
+  /// task's pools.
+  void clearCachedVectors();
+
   core::ExecCtx* FOLLY_NULLABLE execCtx() const {
     return execCtx_;
   }
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/expression/ExprSetPool.h"
+
+#include <map>
+#include <sstream>
+
+#include "velox/common/memory/Memory.h"
+
+namespace facebook::velox::exec {
+namespace {
+
+std::string makeKey(
+    const std::vector<core::TypedExprPtr>& source,
+    const RowTypePtr& inputType,
+    const std::unordered_map<std::string, std::string>& configValues) {
+  std::stringstream out;
+  for (const auto& expr : source) {
+    out << expr->toString() << ";";
+  }
+  out << inputType->toString();
+  // Order the configuration values for a stable key.
+  std::map<std::string, std::string> ordered(
+      configValues.begin(), configValues.end());
+  for (const auto& [name, value] : ordered) {
+    out << "|" << name << "=" << value;
+  }
+  return out.str();
+}
+
+} // namespace
+
+// static
+ExprSetPool& ExprSetPool::instance() {
+  static ExprSetPool pool;
+  return pool;
+}
+
+std::shared_ptr<ExprSet> ExprSetPool::get(
+    const std::vector<core::TypedExprPtr>& source,
+    const RowTypePtr& inputType,
+    core::QueryCtx* queryCtx) {
+  if (queryCtx->queryConfig().exprEvalSimplified()) {
+    return nullptr;
+  }
+  auto configValues = queryCtx->queryConfig().valuesCopy();
+  const auto key = makeKey(source, inputType, configValues);
+
+  std::shared_ptr<Entry> entry;
+  {
+    auto entries = entries_.wlock();
+    auto it = entries->find(key);
+    if (it != entries->end()) {
+      entry = it->second;
+    } else {
+      entry = std::make_shared<Entry>();
+      entry->queryCtx =
+          std::make_shared<core::QueryCtx>(nullptr, std::move(configValues));
+      entry->pool = memory::addDefaultLeafMemoryPool("ExprSetPool");
+      entry->execCtx = std::make_unique<core::ExecCtx>(
+          entry->pool.get(), entry->queryCtx.get());
+      entries->emplace(key, entry);
+    }
+  }
+
+  std::unique_ptr<ExprSet> exprSet;
+  {
+    auto idle = entry->idle.wlock();
+    if (!idle->empty()) {
+      exprSet = std::move(idle->back());
+      idle->pop_back();
+    }
+  }
+  if (exprSet == nullptr) {
+    std::lock_guard<std::mutex> l(entry->compileMutex);
+    exprSet = std::make_unique<ExprSet>(source, entry->execCtx.get());
+  }
+  return {exprSet.release(), [entry](ExprSet* released) {
+            std::unique_ptr<ExprSet> owned(released);
+            // Drop vectors cached during evaluation; they are allocated
+            // from the leasing task's pools.
+            owned->clearCachedVectors();
+            auto idle = entry->idle.wlock();
+            if (idle->size() < kMaxIdlePerEntry) {
+              idle->push_back(std::move(owned));
+            }
+          }};
+}
+
+} // namespace facebook::velox::exec
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <folly/Synchronized.h>
+
+#include <mutex>
+
+#include "velox/expression/Expr.h"
+
+namespace facebook::velox::exec {
+
+/// Process-wide pool of compiled ExprSets, used to avoid recompiling
+/// identical expression trees for every task and driver of a repeating
+/// query template. ExprSets are stateful during evaluation, so they are
+/// handed out on an exclusive lease and returned to the pool when the
+/// leasing operator releases them. Entries are keyed by the text of the
+/// expressions, the input row type and the query configuration. Each
+/// entry compiles against a pool-owned QueryCtx, ExecCtx and memory
+/// pool so that cached expressions never reference task-owned state.
+/// Enabled via QueryConfig::kExprReuseCompiledExpressions.
+class ExprSetPool {
+ public:
+  static ExprSetPool& instance();
+
+  /// Returns a compiled ExprSet for 'source' with input row type
+  /// 'inputType', reusing a previously compiled idle one when
+  /// available. The returned shared_ptr hands the ExprSet back to the
+  /// pool on destruction after dropping vectors cached during
+  /// evaluation. Returns nullptr if 'queryCtx' is configured for
+  /// simplified evaluation; the caller then compiles its own ExprSet.
+  std::shared_ptr<ExprSet> get(
+      const std::vector<core::TypedExprPtr>& source,
+      const RowTypePtr& inputType,
+      core::QueryCtx* FOLLY_NONNULL queryCtx);
+
+ private:
+  struct Entry {
+    std::shared_ptr<core::QueryCtx> queryCtx;
+    std::shared_ptr<memory::MemoryPool> pool;
+    std::unique_ptr<core::ExecCtx> execCtx;
+    // Serializes compilation; 'execCtx' is not thread safe.
+    std::mutex compileMutex;
+    folly::Synchronized<std::vector<std::unique_ptr<ExprSet>>> idle;
+  };
+
+  // Maximum number of idle ExprSets kept per entry. Returned leases
+  // beyond this are destroyed.
+  static constexpr int32_t kMaxIdlePerEntry = 32;
+
+  folly::Synchronized<std::unordered_map<std::string, std::shared_ptr<Entry>>>
+      entries_;
+};
+
+} // namespace facebook::velox::exec
@@ -50,38 +50,76 @@ T singleValue(const VectorPtr& vector) {
   return simpleVector->valueAt(0);
 }
 
-const core::FieldAccessTypedExpr* asField(
-    const core::ITypedExpr* expr,
-    int index) {
-  return dynamic_cast<const core::FieldAccessTypedExpr*>(
-      expr->inputs()[index].get());
-}
-
 const core::CallTypedExpr* asCall(const core::ITypedExpr* expr) {
   return dynamic_cast<const core::CallTypedExpr*>(expr);
 }
 
-bool toSubfield(
-    const core::FieldAccessTypedExpr* field,
-    common::Subfield& subfield) {
+// Converts a constant map key or array index into a subscript path
+// element.  Returns nullptr if the value is not a constant integer or
+// string.
+std::unique_ptr<common::Subfield::PathElement> toSubscriptElement(
+    const core::ITypedExpr* index) {
+  auto* constant = dynamic_cast<const core::ConstantTypedExpr*>(index);
+  if (!constant || constant->hasValueVector() || constant->value().isNull()) {
+    return nullptr;
+  }
+  auto& value = constant->value();
+  switch (constant->type()->kind()) {
+    case TypeKind::TINYINT:
+      return std::make_unique<common::Subfield::LongSubscript>(
+          value.value<TypeKind::TINYINT>());
+    case TypeKind::SMALLINT:
+      return std::make_unique<common::Subfield::LongSubscript>(
+          value.value<TypeKind::SMALLINT>());
+    case TypeKind::INTEGER:
+      return std::make_unique<common::Subfield::LongSubscript>(
+          value.value<TypeKind::INTEGER>());
+    case TypeKind::BIGINT:
+      return std::make_unique<common::Subfield::LongSubscript>(
+          value.value<TypeKind::BIGINT>());
+    case TypeKind::VARCHAR:
+      return std::make_unique<common::Subfield::StringSubscript>(
+          value.value<TypeKind::VARCHAR>());
+    default:
+      return nullptr;
+  }
+}
+
+bool toSubfield(const core::ITypedExpr* expr, common::Subfield& subfield) {
   std::vector<std::unique_ptr<common::Subfield::PathElement>> path;
-  for (auto* current = field;;) {
+  for (auto* current = expr;;) {
+    if (auto* call = asCall(current)) {
+      if (call->name() != "subscript" && call->name() != "element_at") {
+        return false;
+      }
+      if (call->inputs().size() != 2) {
+        return false;
+      }
+      auto element = toSubscriptElement(call->inputs()[1].get());
+      if (!element) {
+        return false;
+      }
+      path.push_back(std::move(element));
+      current = call->inputs()[0].get();
+      continue;
+    }
+    auto* field = dynamic_cast<const core::FieldAccessTypedExpr*>(current);
+    if (!field) {
+      return false;
+    }
     path.push_back(
-        std::make_unique<common::Subfield::NestedField>(current->name()));
-    if (current->inputs().empty()) {
+        std::make_unique<common::Subfield::NestedField>(field->name()));
+    if (field->inputs().empty()) {
       break;
     }
-    if (current->inputs().size() != 1) {
+    if (field->inputs().size() != 1) {
       return false;
     }
-    auto* parent = current->inputs()[0].get();
-    current = dynamic_cast<const core::FieldAccessTypedExpr*>(parent);
-    if (!current) {
-      if (!dynamic_cast<const core::InputTypedExpr*>(parent)) {
-        return false;
-      }
+    auto* parent = field->inputs()[0].get();
+    if (dynamic_cast<const core::InputTypedExpr*>(parent)) {
       break;
     }
+    current = parent;
   }
   std::reverse(path.begin(), path.end());
   subfield = common::Subfield(std::move(path));
@@ -440,70 +478,52 @@ std::unique_ptr<common::Filter> leafCallToSubfieldFilter(
     core::ExpressionEvaluator* evaluator,
     bool negated) {
   if (call.name() == "eq") {
-    if (auto field = asField(&call, 0)) {
-      if (toSubfield(field, subfield)) {
-        return negated ? makeNotEqualFilter(call.inputs()[1], evaluator)
-                       : makeEqualFilter(call.inputs()[1], evaluator);
-      }
+    if (toSubfield(call.inputs()[0].get(), subfield)) {
+      return negated ? makeNotEqualFilter(call.inputs()[1], evaluator)
+                     : makeEqualFilter(call.inputs()[1], evaluator);
     }
   } else if (call.name() == "neq") {
-    if (auto field = asField(&call, 0)) {
-      if (toSubfield(field, subfield)) {
-        return negated ? makeEqualFilter(call.inputs()[1], evaluator)
-                       : makeNotEqualFilter(call.inputs()[1], evaluator);
-      }
+    if (toSubfield(call.inputs()[0].get(), subfield)) {
+      return negated ? makeEqualFilter(call.inputs()[1], evaluator)
+                     : makeNotEqualFilter(call.inputs()[1], evaluator);
     }
   } else if (call.name() == "lte") {
-    if (auto field = asField(&call, 0)) {
-      if (toSubfield(field, subfield)) {
-        return negated ? makeGreaterThanFilter(call.inputs()[1], evaluator)
-                       : makeLessThanOrEqualFilter(call.inputs()[1], evaluator);
-      }
+    if (toSubfield(call.inputs()[0].get(), subfield)) {
+      return negated ? makeGreaterThanFilter(call.inputs()[1], evaluator)
+                     : makeLessThanOrEqualFilter(call.inputs()[1], evaluator);
     }
   } else if (call.name() == "lt") {
-    if (auto field = asField(&call, 0)) {
-      if (toSubfield(field, subfield)) {
-        return negated
-            ? makeGreaterThanOrEqualFilter(call.inputs()[1], evaluator)
-            : makeLessThanFilter(call.inputs()[1], evaluator);
-      }
+    if (toSubfield(call.inputs()[0].get(), subfield)) {
+      return negated
+          ? makeGreaterThanOrEqualFilter(call.inputs()[1], evaluator)
+          : makeLessThanFilter(call.inputs()[1], evaluator);
     }
   } else if (call.name() == "gte") {
-    if (auto field = asField(&call, 0)) {
-      if (toSubfield(field, subfield)) {
-        return negated
-            ? makeLessThanFilter(call.inputs()[1], evaluator)
-            : makeGreaterThanOrEqualFilter(call.inputs()[1], evaluator);
-      }
+    if (toSubfield(call.inputs()[0].get(), subfield)) {
+      return negated
+          ? makeLessThanFilter(call.inputs()[1], evaluator)
+          : makeGreaterThanOrEqualFilter(call.inputs()[1], evaluator);
     }
   } else if (call.name() == "gt") {
-    if (auto field = asField(&call, 0)) {
-      if (toSubfield(field, subfield)) {
-        return negated ? makeLessThanOrEqualFilter(call.inputs()[1], evaluator)
-                       : makeGreaterThanFilter(call.inputs()[1], evaluator);
-      }
+    if (toSubfield(call.inputs()[0].get(), subfield)) {
+      return negated ? makeLessThanOrEqualFilter(call.inputs()[1], evaluator)
+                     : makeGreaterThanFilter(call.inputs()[1], evaluator);
     }
   } else if (call.name() == "between") {
-    if (auto field = asField(&call, 0)) {
-      if (toSubfield(field, subfield)) {
-        return makeBetweenFilter(
-            call.inputs()[1], call.inputs()[2], evaluator, negated);
-      }
+    if (toSubfield(call.inputs()[0].get(), subfield)) {
+      return makeBetweenFilter(
+          call.inputs()[1], call.inputs()[2], evaluator, negated);
     }
   } else if (call.name() == "in") {
-    if (auto field = asField(&call, 0)) {
-      if (toSubfield(field, subfield)) {
-        return makeInFilter(call.inputs()[1], evaluator, negated);
-      }
+    if (toSubfield(call.inputs()[0].get(), subfield)) {
+      return makeInFilter(call.inputs()[1], evaluator, negated);
     }
   } else if (call.name() == "is_null") {
-    if (auto field = asField(&call, 0)) {
-      if (toSubfield(field, subfield)) {
-        if (negated) {
-          return isNotNull();
-        }
-        return isNull();
+    if (toSubfield(call.inputs()[0].get(), subfield)) {
+      if (negated) {
+        return isNotNull();
       }
+      return isNull();
     }
   }
   return nullptr;
@@ -371,6 +371,10 @@ betweenHugeint(int128_t min, int128_t max, bool nullAllowed = false) {
   return std::make_unique<common::HugeintRange>(min, max, nullAllowed);
 }
 
+/// Convert an expression to subfield and filter.  Supports comparisons over
+/// nested field accesses and constant subscripts into maps and arrays, e.g.
+/// a.b[1] > 0 becomes a filter on subfield "a.b[1]".  Throws if the
+/// expression is not supported for pushdown.
 std::pair<common::Subfield, std::unique_ptr<common::Filter>> toSubfieldFilter(
     const core::TypedExprPtr& expr,
     core::ExpressionEvaluator*);
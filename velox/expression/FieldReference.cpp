@@ -16,6 +16,8 @@
 
 #include "velox/expression/FieldReference.h"
 
+#include "velox/vector/LazyVector.h"
+
 namespace facebook::velox::exec {
 
 void FieldReference::evalSpecialForm(
@@ -63,6 +65,32 @@ void FieldReference::evalSpecialForm(
     auto indices = useDecode ? decoded.indices() : nullptr;
     result->copy(child.get(), rows, indices);
   } else {
+    if (isLazyNotLoaded(*child)) {
+      // Load only the referenced subfield and only the rows that are
+      // accessed. This keeps the sibling children of a wide struct
+      // unloaded.
+      if (!useDecode) {
+        LazyVector::ensureLoadedRows(
+            child,
+            context.isFinalSelection() ? rows : *context.finalSelection());
+      } else if (context.isFinalSelection()) {
+        // Translate 'rows' to the base row numbers of the decoded struct.
+        LocalSelectivityVector baseRowsHolder(context, row->size());
+        auto* baseRows = baseRowsHolder.get();
+        baseRows->clearAll();
+        rows.applyToSelected([&](auto i) {
+          if (!decoded.isNullAt(i)) {
+            baseRows->setValid(decoded.index(i), true);
+          }
+        });
+        baseRows->updateBounds();
+        LazyVector::ensureLoadedRows(child, *baseRows);
+      }
+      // A later conditional may access more rows than 'rows' when this is
+      // not the final selection and the struct was decoded. These cannot
+      // be translated through 'decoded', so fall through and load the
+      // child fully below.
+    }
     if (child->encoding() == VectorEncoding::Simple::LAZY) {
       child = BaseVector::loadedVectorShared(child);
     }
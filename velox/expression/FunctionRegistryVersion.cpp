@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/expression/FunctionRegistryVersion.h"
+
+#include <atomic>
+
+namespace facebook::velox::exec {
+
+namespace {
+std::atomic<int64_t>& versionCounter() {
+  static std::atomic<int64_t> counter{0};
+  return counter;
+}
+} // namespace
+
+int64_t functionRegistryVersion() {
+  return versionCounter().load();
+}
+
+void bumpFunctionRegistryVersion() {
+  versionCounter().fetch_add(1);
+}
+
+} // namespace facebook::velox::exec
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace facebook::velox::exec {
+
+/// Returns the current version of the process-wide scalar function
+/// registries (simple and vector functions). The version changes on
+/// every registration and when a registry is cleared. Caches of
+/// function resolution results compare versions to detect stale
+/// entries.
+int64_t functionRegistryVersion();
+
+/// Bumps the registry version. Called by the registries whenever their
+/// contents change.
+void bumpFunctionRegistryVersion();
+
+} // namespace facebook::velox::exec
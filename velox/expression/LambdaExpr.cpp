@@ -41,6 +41,15 @@ class ExprCallable : public Callable {
     return capture_->childrenSize() > signature_->size();
   }
 
+  bool needsCaptureWrap() const override {
+    for (auto i = signature_->size(); i < capture_->childrenSize(); ++i) {
+      if (!capture_->childAt(i)->isConstantEncoding()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
   void apply(
       const SelectivityVector& rows,
       const SelectivityVector& finalSelection,
@@ -108,7 +117,13 @@ class ExprCallable : public Callable {
     std::vector<VectorPtr> allVectors = args;
     for (auto index = args.size(); index < capture_->childrenSize(); ++index) {
       auto values = capture_->childAt(index);
-      if (wrapCapture) {
+      if (values->isConstantEncoding()) {
+        // A constant covers any element row; resize it instead of
+        // wrapping in a dictionary.
+        if (values->size() < size) {
+          values = BaseVector::wrapInConstant(size, 0, values);
+        }
+      } else if (wrapCapture) {
         values = BaseVector::wrapInDictionary(
             BufferPtr(nullptr), wrapCapture, size, values);
       }
@@ -26,6 +26,20 @@ std::shared_ptr<PeeledEncoding> PeeledEncoding::peel(
     LocalDecodedVector& decodedVector,
     bool canPeelsHaveNulls,
     std::vector<VectorPtr>& peeledVectors) {
+  return peel(
+      vectorsToPeel,
+      rows,
+      *decodedVector.get(),
+      canPeelsHaveNulls,
+      peeledVectors);
+}
+
+std::shared_ptr<PeeledEncoding> PeeledEncoding::peel(
+    const std::vector<VectorPtr>& vectorsToPeel,
+    const SelectivityVector& rows,
+    DecodedVector& decodedVector,
+    bool canPeelsHaveNulls,
+    std::vector<VectorPtr>& peeledVectors) {
   std::shared_ptr<PeeledEncoding> peeledEncoding(new PeeledEncoding());
   if (peeledEncoding->peelInternal(
           vectorsToPeel,
@@ -41,14 +55,24 @@ std::shared_ptr<PeeledEncoding> PeeledEncoding::peel(
 SelectivityVector* PeeledEncoding::translateToInnerRows(
     const SelectivityVector& outerRows,
     LocalSelectivityVector& innerRowsHolder) const {
+  auto size = wrapEncoding_ == VectorEncoding::Simple::CONSTANT
+      ? constantWrapIndex_ + 1
+      : baseSize_;
+  auto* newRows = innerRowsHolder.get(size, false);
+  translateToInnerRows(outerRows, *newRows);
+  return newRows;
+}
+
+void PeeledEncoding::translateToInnerRows(
+    const SelectivityVector& outerRows,
+    SelectivityVector& innerRows) const {
   VELOX_CHECK(wrapEncoding_ != VectorEncoding::Simple::FLAT);
   if (wrapEncoding_ == VectorEncoding::Simple::CONSTANT) {
-    auto newRows = innerRowsHolder.get(constantWrapIndex_ + 1, false);
-    newRows->setValid(constantWrapIndex_, true);
-    newRows->updateBounds();
-    return newRows;
+    innerRows.resizeFill(constantWrapIndex_ + 1, false);
+    innerRows.setValid(constantWrapIndex_, true);
+    innerRows.updateBounds();
+    return;
   }
-  auto baseSize = baseSize_;
   auto indices = wrap_->as<vector_size_t>();
   // If the wrappers add nulls, do not enable the inner rows. The
   // indices for places that a dictionary sets to null are not
@@ -56,10 +80,8 @@ SelectivityVector* PeeledEncoding::translateToInnerRows(
   // null-propagating Exprs.
   auto flatNulls = wrapNulls_ ? wrapNulls_->as<uint64_t>() : nullptr;
 
-  auto* newRows = innerRowsHolder.get(baseSize, false);
-  velox::translateToInnerRows(outerRows, indices, flatNulls, *newRows);
-
-  return newRows;
+  innerRows.resizeFill(baseSize_, false);
+  velox::translateToInnerRows(outerRows, indices, flatNulls, innerRows);
 }
 
 namespace {
@@ -98,7 +120,7 @@ void PeeledEncoding::setDictionaryWrapping(
 bool PeeledEncoding::peelInternal(
     const std::vector<VectorPtr>& vectorsToPeel,
     const SelectivityVector& rows,
-    LocalDecodedVector& decodedVector,
+    DecodedVector& decodedVector,
     bool canPeelsHaveNulls,
     std::vector<VectorPtr>& peeledVectors) {
   auto numFields = vectorsToPeel.size();
@@ -213,7 +235,7 @@ bool PeeledEncoding::peelInternal(
       constantWrapIndex_ = rows.begin();
     }
   } else {
-    auto decoded = decodedVector.get();
+    auto* decoded = &decodedVector;
     auto firstWrapper = vectorsToPeel[firstPeeled];
     // Check if constant encoding can be peeled off too if the input is of the
     // form Dictionary(Constant(complex)).
@@ -302,4 +324,25 @@ VectorPtr PeeledEncoding::wrap(
   }
   return wrappedResult;
 }
+
+void MultiColumnDecoder::decode(
+    const std::vector<VectorPtr>& vectors,
+    const SelectivityVector& rows,
+    std::vector<DecodedVector>& decoded) {
+  rows_ = &rows;
+  decoded.resize(vectors.size());
+  std::vector<VectorPtr> peeledVectors;
+  peeledEncoding_ =
+      PeeledEncoding::peel(vectors, rows, peelDecoder_, true, peeledVectors);
+  if (!peeledEncoding_) {
+    for (size_t i = 0; i < vectors.size(); ++i) {
+      decoded[i].decode(*vectors[i], rows);
+    }
+    return;
+  }
+  peeledEncoding_->translateToInnerRows(rows, baseRows_);
+  for (size_t i = 0; i < vectors.size(); ++i) {
+    decoded[i].decode(*peeledVectors[i], baseRows_);
+  }
+}
 } // namespace facebook::velox::exec
@@ -17,10 +17,7 @@
 #pragma once
 
 #include "velox/vector/BaseVector.h"
-
-namespace facebook::velox {
-class DecodedVector;
-}
+#include "velox/vector/DecodedVector.h"
 
 namespace facebook::velox::exec {
 class LocalDecodedVector;
@@ -117,6 +114,16 @@ class PeeledEncoding {
       bool canPeelsHaveNulls,
       std::vector<VectorPtr>& peeledVectors);
 
+  /// Same as above, but takes a caller owned DecodedVector so that peeling
+  /// can be used outside expression evaluation where no EvalCtx is
+  /// available.
+  static std::shared_ptr<PeeledEncoding> peel(
+      const std::vector<VectorPtr>& vectorsToPeel,
+      const SelectivityVector& rows,
+      DecodedVector& decodedVector,
+      bool canPeelsHaveNulls,
+      std::vector<VectorPtr>& peeledVectors);
+
   /// Utility method used to check whether an encoding is peel-able.
   constexpr static bool isPeelable(VectorEncoding::Simple encoding) {
     switch (encoding) {
@@ -139,6 +146,25 @@ class PeeledEncoding {
       const SelectivityVector& outerRows,
       LocalSelectivityVector& innerRowsHolder) const;
 
+  /// Same as above, but fills a caller owned selectivity vector.
+  void translateToInnerRows(
+      const SelectivityVector& outerRows,
+      SelectivityVector& innerRows) const;
+
+  /// Translates a single top level row via the peel into the corresponding
+  /// inner row. The result is undefined if isNullAt(row) is true.
+  vector_size_t translateToInnerRow(vector_size_t row) const {
+    if (wrapEncoding_ == VectorEncoding::Simple::CONSTANT) {
+      return constantWrapIndex_;
+    }
+    return wrap_->as<vector_size_t>()[row];
+  }
+
+  /// Returns true if the peeled wrapping adds a null at 'row'.
+  bool isNullAt(vector_size_t row) const {
+    return wrapNulls_ && bits::isBitNull(wrapNulls_->as<uint64_t>(), row);
+  }
+
   /// Wraps the given vector 'peeledResult' with the peeled encoding and
   /// generates a vector which has valid rows as per the input 'rows'
   /// selectivity vector.
@@ -174,7 +200,7 @@ class PeeledEncoding {
   bool peelInternal(
       const std::vector<VectorPtr>& vectorsToPeel,
       const SelectivityVector& rows,
-      LocalDecodedVector& decodedVector,
+      DecodedVector& decodedVector,
       bool canPeelsHaveNulls,
       std::vector<VectorPtr>& peeledVectors);
 
@@ -201,4 +227,53 @@ class PeeledEncoding {
   /// The constant index. Only valid if wrapEncoding_ = CONSTANT.
   vector_size_t constantWrapIndex_ = 0;
 };
+
+/// Decodes multiple columns in one pass by peeling the encoding layers they
+/// share (e.g. join or sort keys wrapped in the same dictionary) only once
+/// instead of walking the wrappings per column. When a shared peel exists,
+/// each column is decoded against its peeled vector over the translated
+/// inner rows and top level rows are mapped through the peel; otherwise
+/// each column is decoded independently and the mapping is the identity.
+///
+/// Typical usage:
+///
+///   decoder.decode(keyVectors, rows, decodedKeys);
+///   rows.applyToSelected([&](auto row) {
+///     if (decoder.isNullAt(row)) { ... all keys are null ... }
+///     auto baseRow = decoder.baseRow(row);
+///     ... decodedKeys[i].valueAt<T>(baseRow) ...
+///   });
+class MultiColumnDecoder {
+ public:
+  /// Decodes 'vectors' over 'rows'. 'decoded' is resized to hold one
+  /// DecodedVector per input vector.
+  void decode(
+      const std::vector<VectorPtr>& vectors,
+      const SelectivityVector& rows,
+      std::vector<DecodedVector>& decoded);
+
+  /// Rows of the peeled vectors covering all selected top level rows.
+  /// Equals the rows passed to decode() when no shared wrapping was peeled.
+  const SelectivityVector& baseRows() const {
+    return peeledEncoding_ ? baseRows_ : *rows_;
+  }
+
+  /// Translates a top level row into the row to use with the decoded
+  /// columns. The result is undefined if isNullAt(row) is true.
+  vector_size_t baseRow(vector_size_t row) const {
+    return peeledEncoding_ ? peeledEncoding_->translateToInnerRow(row) : row;
+  }
+
+  /// Returns true if the shared wrapping adds a null at 'row', making all
+  /// columns null at that row.
+  bool isNullAt(vector_size_t row) const {
+    return peeledEncoding_ && peeledEncoding_->isNullAt(row);
+  }
+
+ private:
+  std::shared_ptr<PeeledEncoding> peeledEncoding_;
+  DecodedVector peelDecoder_;
+  SelectivityVector baseRows_;
+  const SelectivityVector* rows_{nullptr};
+};
 } // namespace facebook::velox::exec
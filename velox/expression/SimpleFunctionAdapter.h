@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <optional>
 #include <type_traits>
@@ -116,6 +117,18 @@ class SimpleFunctionAdapter : public VectorFunction {
     }() && ...);
   }
 
+  // Check if all arguments have an encoding with a fully specialized
+  // reader: flat, constant, or dictionary directly wrapping a flat
+  // vector.  Only called when allArgsFlatConstantFastPathEligible() is
+  // true, so all arguments are non-variadic primitives.
+  bool allPrimitiveArgsSpecializable(const std::vector<VectorPtr>& args) const {
+    return std::all_of(args.begin(), args.end(), [](const VectorPtr& arg) {
+      return arg->isFlatEncoding() || arg->isConstantEncoding() ||
+          (arg->encoding() == VectorEncoding::Simple::DICTIONARY &&
+           arg->valueVector()->isFlatEncoding());
+    });
+  }
+
   constexpr bool static allArgsFlatConstantFastPathEligible() {
     return allArgsFlatConstantFastPathEligibleImpl(
         std::make_index_sequence<FUNC::num_args>());
@@ -331,14 +344,19 @@ class SimpleFunctionAdapter : public VectorFunction {
     }
 
     std::vector<std::optional<LocalDecodedVector>> decoded;
-    if (allPrimitiveArgsFlatConstant(args)) {
-      if constexpr (
-          allArgsFlatConstantFastPathEligible() && specializeForAllEncodings) {
+    if constexpr (
+        allArgsFlatConstantFastPathEligible() && specializeForAllEncodings) {
+      // Branch once into a fully specialized loop for this combination
+      // of argument encodings.
+      if (allPrimitiveArgsSpecializable(args)) {
         unpackSpecializeForAllEncodings<0>(applyContext, args);
       } else {
         decoded.resize(args.size());
-        unpack<0, true>(applyContext, decoded, args);
+        unpack<0, false>(applyContext, decoded, args);
       }
+    } else if (allPrimitiveArgsFlatConstant(args)) {
+      decoded.resize(args.size());
+      unpack<0, true>(applyContext, decoded, args);
     } else {
       decoded.resize(args.size());
       unpack<0, false>(applyContext, decoded, args);
@@ -449,13 +467,18 @@ class SimpleFunctionAdapter : public VectorFunction {
         unpackSpecializeForAllEncodings<POSITION + 1>(
             applyContext, rawArgs, readers..., reader);
 
-      } else {
-        DCHECK(arg->isFlatEncoding());
-        // Should be flat if not constant.
+      } else if (arg->isFlatEncoding()) {
         auto reader = FlatVectorReader<arg_at<POSITION>>(
             *arg->asUnchecked<FlatVector<type>>());
         unpackSpecializeForAllEncodings<POSITION + 1>(
             applyContext, rawArgs, readers..., reader);
+      } else {
+        // Should be dictionary over flat if not constant or flat.
+        DCHECK(arg->encoding() == VectorEncoding::Simple::DICTIONARY);
+        auto reader = DictionaryVectorReader<arg_at<POSITION>>(
+            *arg->asUnchecked<DictionaryVector<type>>());
+        unpackSpecializeForAllEncodings<POSITION + 1>(
+            applyContext, rawArgs, readers..., reader);
       }
     }
   }
@@ -600,15 +623,23 @@ class SimpleFunctionAdapter : public VectorFunction {
           });
         }
       } else if (allNotNull) {
-        applyContext.applyToSelectedNoThrow([&](auto row) INLINE_LAMBDA {
-          // Passing a stack variable have shown to be boost the performance
-          // of functions that repeatedly update the output. The opposite
-          // optimization (eliminating the temp) is easier to do by the
-          // compiler (assuming the function call is inlined).
-          typename return_type_traits::NativeType out{};
-          bool notNull = doApplyNotNull<0>(row, out, readers...);
-          writeResult(row, notNull, out);
-        });
+        if (applyContext.allAscii) {
+          applyContext.applyToSelectedNoThrow([&](auto row) INLINE_LAMBDA {
+            typename return_type_traits::NativeType out{};
+            bool notNull = doApplyAsciiNotNull<0>(row, out, readers...);
+            writeResult(row, notNull, out);
+          });
+        } else {
+          applyContext.applyToSelectedNoThrow([&](auto row) INLINE_LAMBDA {
+            // Passing a stack variable have shown to be boost the performance
+            // of functions that repeatedly update the output. The opposite
+            // optimization (eliminating the temp) is easier to do by the
+            // compiler (assuming the function call is inlined).
+            typename return_type_traits::NativeType out{};
+            bool notNull = doApplyNotNull<0>(row, out, readers...);
+            writeResult(row, notNull, out);
+          });
+        }
       } else {
         applyContext.applyToSelectedNoThrow([&](auto row) INLINE_LAMBDA {
           typename return_type_traits::NativeType out{};
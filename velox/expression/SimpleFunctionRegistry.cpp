@@ -43,6 +43,7 @@ void SimpleFunctionRegistry::registerFunctionInternal(
     signatureMap[*metadata->signature()] =
         std::make_unique<const FunctionEntry>(metadata, factory);
   });
+  bumpFunctionRegistryVersion();
 }
 
 namespace {
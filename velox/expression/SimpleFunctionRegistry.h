@@ -17,6 +17,7 @@
 #pragma once
 
 #include "velox/core/SimpleFunctionMetadata.h"
+#include "velox/expression/FunctionRegistryVersion.h"
 #include "velox/expression/SignatureBinder.h"
 #include "velox/expression/SimpleFunctionAdapter.h"
 #include "velox/type/Type.h"
@@ -86,6 +87,7 @@ class SimpleFunctionRegistry {
 
   void clearRegistry() {
     registeredFunctions_.withWLock([&](auto& map) { map.clear(); });
+    bumpFunctionRegistryVersion();
   }
 
   std::vector<const FunctionSignature*> getFunctionSignatures(
@@ -17,6 +17,7 @@
 #include <unordered_map>
 #include "folly/Singleton.h"
 #include "folly/Synchronized.h"
+#include "velox/expression/FunctionRegistryVersion.h"
 #include "velox/expression/SignatureBinder.h"
 
 namespace facebook::velox::exec {
@@ -104,15 +105,21 @@ bool registerStatefulVectorFunction(
       functionMap[sanitizedName] = {
           std::move(signatures), std::move(factory), std::move(metadata)};
     });
+    bumpFunctionRegistryVersion();
     return true;
   }
 
-  return vectorFunctionFactories().withWLock([&](auto& functionMap) {
-    auto [iterator, inserted] = functionMap.insert(
-        {sanitizedName,
-         {std::move(signatures), std::move(factory), std::move(metadata)}});
-    return inserted;
-  });
+  const auto inserted =
+      vectorFunctionFactories().withWLock([&](auto& functionMap) {
+        auto [iterator, ok] = functionMap.insert(
+            {sanitizedName,
+             {std::move(signatures), std::move(factory), std::move(metadata)}});
+        return ok;
+      });
+  if (inserted) {
+    bumpFunctionRegistryVersion();
+  }
+  return inserted;
 }
 
 // Returns true iff an insertion actually happened
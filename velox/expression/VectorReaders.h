@@ -34,6 +34,7 @@
 #include "velox/type/Type.h"
 #include "velox/vector/BaseVector.h"
 #include "velox/vector/DecodedVector.h"
+#include "velox/vector/DictionaryVector.h"
 #include "velox/vector/FlatVector.h"
 
 namespace facebook::velox::exec {
@@ -195,6 +196,68 @@ struct FlatVectorReader {
   void setChildrenMayHaveNulls() {}
 };
 
+// This VectorReader is optimized for primitive types in dictionary vectors
+// that directly wrap a flat vector.  It reads the values through the raw
+// indices avoiding the need to go through the expensive decoding process.
+template <typename T>
+struct DictionaryVectorReader {
+  using exec_in_t = typename VectorExec::template resolver<T>::in_type;
+
+  explicit DictionaryVectorReader(DictionaryVector<exec_in_t>& vector)
+      : rawIndices_(vector.indices()->template as<vector_size_t>()),
+        rawNulls_(vector.rawNulls()) {
+    auto* base =
+        vector.valueVector()->template asUnchecked<FlatVector<exec_in_t>>();
+    baseValues_ = base->rawValues();
+    baseNulls_ = base->rawNulls();
+  }
+
+  exec_in_t operator[](vector_size_t offset) const {
+    return baseValues_[rawIndices_[offset]];
+  }
+
+  exec_in_t readNullFree(vector_size_t offset) const {
+    return operator[](offset);
+  }
+
+  bool isSet(vector_size_t offset) const {
+    if (rawNulls_ && bits::isBitNull(rawNulls_, offset)) {
+      return false;
+    }
+    return !baseNulls_ || !bits::isBitNull(baseNulls_, rawIndices_[offset]);
+  }
+
+  bool mayHaveNulls() const {
+    return rawNulls_ || baseNulls_;
+  }
+
+  bool containsNull(vector_size_t index) const {
+    return !isSet(index);
+  }
+
+  bool containsNull(vector_size_t startIndex, vector_size_t endIndex) const {
+    for (auto index = startIndex; index < endIndex; ++index) {
+      if (containsNull(index)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool mayHaveNullsRecursive() const {
+    return mayHaveNulls();
+  }
+
+  // Scalars don't have children, so this is a no-op.
+  void setChildrenMayHaveNulls() {}
+
+ private:
+  const vector_size_t* rawIndices_;
+  const uint64_t* rawNulls_;
+  const exec_in_t* baseValues_;
+  const uint64_t* baseNulls_;
+};
+
 // This VectorReader is optimized for primitive types in constant or flat
 // encoded vectors.  It operates directly on the vector's content avoiding
 // the need to go through the expensive decoding process.
@@ -1276,6 +1276,64 @@ TEST_F(ExprTest, selectiveLazyLoadingOr) {
   assertEqualVectors(expected, result);
 }
 
+TEST_F(ExprTest, lazyStructSubfield) {
+  const vector_size_t size = 1'000;
+
+  // Access one subfield of a struct with individually lazy children.
+  // Verify that the untouched sibling stays unloaded and the referenced
+  // child is loaded only for the rows selected by the struct's
+  // dictionary wrapping.
+  std::vector<vector_size_t> loadedRows;
+  VectorPtr a = std::make_shared<LazyVector>(
+      pool_.get(),
+      BIGINT(),
+      size,
+      std::make_unique<test::SimpleVectorLoader>([&](auto rows) {
+        for (auto row : rows) {
+          loadedRows.push_back(row);
+        }
+        return makeFlatVector<int64_t>(
+            rows.back() + 1, [](auto row) { return row; });
+      }));
+  VectorPtr b = std::make_shared<LazyVector>(
+      pool_.get(),
+      BIGINT(),
+      size,
+      std::make_unique<test::SimpleVectorLoader>([&](RowSet /*rows*/) {
+        VELOX_FAIL("This lazy vector is not expected to be loaded");
+        return nullptr;
+      }));
+
+  auto row = makeRowVector({makeRowVector({"a", "b"}, {a, b})});
+  auto result = evaluate("(c0).a", row);
+  assertEqualVectors(
+      makeFlatVector<int64_t>(size, [](auto r) { return r; }), result);
+  EXPECT_EQ(size, loadedRows.size());
+
+  // Repeat with the struct wrapped in a dictionary that selects only even
+  // base rows. Only these rows are expected to be loaded.
+  loadedRows.clear();
+  a = std::make_shared<LazyVector>(
+      pool_.get(),
+      BIGINT(),
+      size,
+      std::make_unique<test::SimpleVectorLoader>([&](auto rows) {
+        for (auto row : rows) {
+          loadedRows.push_back(row);
+        }
+        return makeFlatVector<int64_t>(
+            rows.back() + 1, [](auto row) { return row; });
+      }));
+
+  auto evenIndices = makeIndices(size / 2, [](auto r) { return r * 2; });
+  row = makeRowVector({wrapInDictionary(
+      evenIndices, size / 2, makeRowVector({"a", "b"}, {a, b}))});
+  result = evaluate("(c0).a", row);
+  assertEqualVectors(
+      makeFlatVector<int64_t>(size / 2, [](auto r) { return r * 2; }), result);
+  EXPECT_EQ(size / 2, loadedRows.size());
+}
+
 TEST_F(ExprTest, lazyVectorAccessTwiceWithDifferentRows) {
   const vector_size_t size = 4;
 
@@ -2080,6 +2138,48 @@ TEST_F(ExprTest, memo) {
   assertEqualVectors(expectedResult, result);
 }
 
+// Verifies that results are memoized when the expression depends on several
+// fields wrapped in a common dictionary and all the alphabets repeat across
+// batches.
+TEST_F(ExprTest, memoMultipleFields) {
+  auto base0 = makeFlatVector<int64_t>(1'000, [](auto row) { return row; });
+  auto base1 = makeFlatVector<int64_t>(1'000, [](auto row) { return row * 2; });
+
+  auto evenIndices = makeIndices(100, [](auto row) { return row * 2; });
+  auto oddIndices = makeIndices(100, [](auto row) { return row * 2 + 1; });
+
+  auto rowType = ROW({"c0", "c1"}, {BIGINT(), BIGINT()});
+  auto exprSet = compileExpression("c0 + c1", rowType);
+
+  auto result = evaluate(
+      exprSet.get(),
+      makeRowVector(
+          {wrapInDictionary(evenIndices, 100, base0),
+           wrapInDictionary(evenIndices, 100, base1)}));
+  auto expectedResult =
+      makeFlatVector<int64_t>(100, [](auto row) { return row * 2 * 3; });
+  assertEqualVectors(expectedResult, result);
+
+  result = evaluate(
+      exprSet.get(),
+      makeRowVector(
+          {wrapInDictionary(oddIndices, 100, base0),
+           wrapInDictionary(oddIndices, 100, base1)}));
+  expectedResult =
+      makeFlatVector<int64_t>(100, [](auto row) { return (row * 2 + 1) * 3; });
+  assertEqualVectors(expectedResult, result);
+
+  // Repeat the first batch. The cached rows are reused.
+  result = evaluate(
+      exprSet.get(),
+      makeRowVector(
+          {wrapInDictionary(evenIndices, 100, base0),
+           wrapInDictionary(evenIndices, 100, base1)}));
+  expectedResult =
+      makeFlatVector<int64_t>(100, [](auto row) { return row * 2 * 3; });
+  assertEqualVectors(expectedResult, result);
+}
+
 // This test triggers the situation when peelEncodings() produces an empty
 // selectivity vector, which if passed to evalWithMemo() causes the latter to
 // produce null Expr::dictionaryCache_, which leads to a crash in evaluation
@@ -3486,6 +3586,37 @@ TEST_F(ExprTest, conjunctUnderTry) {
   assertEqualVectors(expected, result);
 }
 
+TEST_F(ExprTest, conjunctWordWiseUpdate) {
+  // Exercises the word-at-a-time merge of null-free conjunct results with
+  // decided and undecided rows spanning multiple 64-bit words.
+  const vector_size_t size = 200;
+  auto input = makeRowVector({
+      makeFlatVector<int64_t>(size, [](auto row) { return row; }),
+      makeFlatVector<int64_t>(size, [](auto row) { return row % 3; }),
+      makeFlatVector<bool>(
+          size, [](auto row) { return row % 2 == 0; }, nullEvery(7)),
+  });
+
+  auto result = evaluate("c0 >= 50::bigint AND c1 = 1::bigint", input);
+  auto expected = makeFlatVector<bool>(
+      size, [](auto row) { return row >= 50 && row % 3 == 1; });
+  assertEqualVectors(expected, result);
+
+  result = evaluate("c0 >= 50::bigint OR c1 = 1::bigint", input);
+  expected = makeFlatVector<bool>(
+      size, [](auto row) { return row >= 50 || row % 3 == 1; });
+  assertEqualVectors(expected, result);
+
+  // A null conjunct followed by a null-free one. A false decided by the
+  // second conjunct overrides a null from the first.
+  result = evaluate("c2 AND c1 = 1::bigint", input);
+  expected = makeFlatVector<bool>(
+      size,
+      [](auto row) { return row % 2 == 0 && row % 3 == 1; },
+      [](auto row) { return row % 7 == 0 && row % 3 == 1; });
+  assertEqualVectors(expected, result);
+}
+
 TEST_F(ExprTest, flatNoNullsFastPathWithCse) {
   // Test CSE with flat-no-nulls fast path.
   auto input = makeRowVector({
@@ -3596,6 +3727,38 @@ TEST_F(ExprTest, cseOverDictionaryOverConstant) {
   EXPECT_EQ(5, stats.at("plus").numProcessedRows);
 }
 
+TEST_F(ExprTest, cseAcrossProjectionList) {
+  // Verify that a subexpression shared by several expressions in the same
+  // ExprSet, e.g. the projection list of a FilterProject, is evaluated only
+  // once per batch regardless of how many outputs reference it.
+  auto input = makeRowVector({
+      makeFlatVector<StringView>({"a1"_sv, "b2"_sv, "c3"_sv, "d4"_sv, "e5"_sv}),
+  });
+
+  auto [result, stats] = evaluateMultipleWithStats(
+      {"concat(upper(c0), '_x')",
+       "concat(upper(c0), '_y')",
+       "length(upper(c0))",
+       "upper(c0)"},
+      input);
+
+  assertEqualVectors(
+      makeFlatVector<StringView>(
+          {"A1_x"_sv, "B2_x"_sv, "C3_x"_sv, "D4_x"_sv, "E5_x"_sv}),
+      result[0]);
+  assertEqualVectors(
+      makeFlatVector<StringView>(
+          {"A1_y"_sv, "B2_y"_sv, "C3_y"_sv, "D4_y"_sv, "E5_y"_sv}),
+      result[1]);
+  assertEqualVectors(makeFlatVector<int64_t>({2, 2, 2, 2, 2}), result[2]);
+  assertEqualVectors(
+      makeFlatVector<StringView>({"A1"_sv, "B2"_sv, "C3"_sv, "D4"_sv, "E5"_sv}),
+      result[3]);
+
+  // upper(c0) runs once for the whole projection list.
+  EXPECT_EQ(5, stats.at("upper").numProcessedRows);
+}
+
 TEST_F(ExprTest, cseOverDictionaryAcrossMultipleExpressions) {
   // This test verifies that CSE across multiple expressions are evaluated
   // correctly, that is, make sure peeling is done before attempting to re-use
@@ -208,6 +208,41 @@ TEST_F(ExprToSubfieldFilterTest, isNotNull) {
   ASSERT_FALSE(filter->testNull());
 }
 
+TEST_F(ExprToSubfieldFilterTest, subscript) {
+  auto rowType = ROW(
+      {{"m", MAP(BIGINT(), BIGINT())},
+       {"s", MAP(VARCHAR(), BIGINT())},
+       {"a", ARRAY(BIGINT())}});
+  auto call = parseCallExpr("m[10] = 42", rowType);
+  Subfield subfield;
+  auto filter = leafCallToSubfieldFilter(*call, subfield, evaluator());
+  ASSERT_TRUE(filter);
+  ASSERT_EQ(subfield, Subfield("m[10]"));
+  ASSERT_TRUE(filter->testInt64(42));
+  ASSERT_FALSE(filter->testInt64(0));
+
+  call = parseCallExpr("element_at(s, 'foo') > 0", rowType);
+  filter = leafCallToSubfieldFilter(*call, subfield, evaluator());
+  ASSERT_TRUE(filter);
+  ASSERT_EQ(subfield, Subfield("s[\"foo\"]"));
+  ASSERT_TRUE(filter->testInt64(1));
+  ASSERT_FALSE(filter->testInt64(0));
+
+  call = parseCallExpr("a[1] is null", rowType);
+  filter = leafCallToSubfieldFilter(*call, subfield, evaluator());
+  ASSERT_TRUE(filter);
+  ASSERT_EQ(subfield, Subfield("a[1]"));
+  ASSERT_TRUE(filter->testNull());
+}
+
+TEST_F(ExprToSubfieldFilterTest, nonConstantSubscript) {
+  auto call = parseCallExpr(
+      "m[k] = 42", ROW({{"m", MAP(BIGINT(), BIGINT())}, {"k", BIGINT()}}));
+  Subfield subfield;
+  auto filter = leafCallToSubfieldFilter(*call, subfield, evaluator());
+  ASSERT_FALSE(filter);
+}
+
 TEST_F(ExprToSubfieldFilterTest, like) {
   auto call = parseCallExpr("a like 'foo%'", ROW({{"a", VARCHAR()}}));
   Subfield subfield;
@@ -19,6 +19,7 @@
 #include <folly/ScopeGuard.h>
 #include <glog/logging.h>
 #include <exception>
+#include <fstream>
 #include <unordered_set>
 
 #include "velox/common/base/Exceptions.h"
@@ -138,6 +139,23 @@ DEFINE_string(
     "of functions at every instance. Number of tickets must be a positive "
     "integer. Example: eq=3,floor=5");
 
+DEFINE_string(
+    perf_baseline_path,
+    "",
+    "File path for persisting per-function CPU time per row across fuzzer "
+    "runs. When set, the fuzzer tracks expression CPU usage, compares each "
+    "function against the baseline recorded by a previous run in this file, "
+    "logs the functions whose CPU time per row regressed beyond "
+    "--perf_regression_threshold_pct and writes the updated baselines back. "
+    "Empty string disables this feature.");
+
+DEFINE_double(
+    perf_regression_threshold_pct,
+    50,
+    "Minimum relative increase (in percent) of a function's CPU time per "
+    "row over its persisted baseline to be reported as a regression. Only "
+    "effective if --perf_baseline_path is set.");
+
 DEFINE_int32(
     max_expression_trees_per_step,
     1,
@@ -578,6 +596,12 @@ ExpressionFuzzer::ExpressionFuzzer(
   if (!exec::registerExprSetListener(statListener_)) {
     LOG(WARNING) << "Listener should only be registered once.";
   }
+
+  if (!FLAGS_perf_baseline_path.empty()) {
+    // Per-expression CPU time is not collected by default.
+    queryCtx_->testingOverrideConfigUnsafe(
+        {{core::QueryConfig::kExprTrackCpuUsage, "true"}});
+  }
 }
 
 void ExpressionFuzzer::getTicketsForFunctions() {
@@ -1134,6 +1158,54 @@ void ExpressionFuzzer::logStats() {
   }
 }
 
+void ExpressionFuzzer::checkPerfRegressions() {
+  // Load the baselines persisted by a previous run, if any. Every line
+  // holds a function name and its CPU nanoseconds per row.
+  std::unordered_map<std::string, double> baselines;
+  std::ifstream in(FLAGS_perf_baseline_path);
+  std::string name;
+  double nanosPerRow;
+  while (in >> name >> nanosPerRow) {
+    baselines[name] = nanosPerRow;
+  }
+  in.close();
+
+  int numRegressed = 0;
+  for (const auto& [funcName, stats] : exprNameToStats_) {
+    if (stats.numProcessedRows == 0 || stats.cpuNanos == 0) {
+      // The function was not exercised in this run. Keep its baseline.
+      continue;
+    }
+    const double current = (double)stats.cpuNanos / stats.numProcessedRows;
+    auto it = baselines.find(funcName);
+    if (it != baselines.end() &&
+        current >
+            it->second * (1 + FLAGS_perf_regression_threshold_pct / 100)) {
+      LOG(ERROR) << fmt::format(
+          "Perf regression: {} went from {:.1f} to {:.1f} CPU nanos per row "
+          "({:.2f}x, {} rows)",
+          funcName,
+          it->second,
+          current,
+          current / it->second,
+          stats.numProcessedRows);
+      ++numRegressed;
+    }
+    baselines[funcName] = current;
+  }
+  LOG(INFO) << "Total functions with perf regressions: " << numRegressed;
+
+  std::ofstream out(FLAGS_perf_baseline_path, std::ofstream::trunc);
+  if (!out.is_open()) {
+    LOG(ERROR) << "Unable to persist perf baselines to "
+               << FLAGS_perf_baseline_path;
+    return;
+  }
+  for (const auto& [funcName, baseline] : baselines) {
+    out << funcName << " " << baseline << std::endl;
+  }
+}
+
 void ExpressionFuzzer::ExprBank::insert(const core::TypedExprPtr& expression) {
   auto typeString = expression->type()->toString();
   if (typeToExprsByLevel_.find(typeString) == typeToExprsByLevel_.end()) {
@@ -1359,6 +1431,9 @@ void ExpressionFuzzer::go() {
     ++i;
   }
   logStats();
+  if (!FLAGS_perf_baseline_path.empty()) {
+    checkPerfRegressions();
+  }
 }
 
 void expressionFuzzer(FunctionSignatureMap signatureMap, size_t seed) {
@@ -106,6 +106,9 @@ class ExpressionFuzzer {
     int numTimesSelected = 0;
     // Num of rows processed by the expression.
     int numProcessedRows = 0;
+    // CPU time spent evaluating the expression, in nanoseconds. Only
+    // populated if --perf_baseline_path is set.
+    uint64_t cpuNanos = 0;
   };
 
   // A utility class used to keep track of stats relevant to the fuzzer.
@@ -125,6 +128,7 @@ class ExpressionFuzzer {
           continue;
         }
         itr->second.numProcessedRows += stats.numProcessedRows;
+        itr->second.cpuNanos += stats.timing.cpuNanos;
       }
     }
 
@@ -302,6 +306,14 @@ class ExpressionFuzzer {
   /// proportionOfTimesSelected numProcessedRows.
   void logStats();
 
+  /// Called at the end of a successful fuzzer run when --perf_baseline_path
+  /// is set. Computes CPU nanoseconds per row for every function that
+  /// processed rows in this run, compares them against the baselines
+  /// persisted by a previous run and logs the functions that regressed
+  /// beyond --perf_regression_threshold_pct. Writes the updated baselines
+  /// back to the baseline file.
+  void checkPerfRegressions();
+
   FuzzerGenerator rng_;
   size_t currentSeed_{0};
 
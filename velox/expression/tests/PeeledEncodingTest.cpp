@@ -503,3 +503,50 @@ TEST_F(PeeledEncodingTest, peelingFails) {
     ASSERT_TRUE(!peeledEncoding);
   }
 }
+
+TEST_F(PeeledEncodingTest, multiColumnDecoder) {
+  SelectivityVector rows(vectorSize_);
+
+  // Columns sharing dictionary layers are decoded against their base
+  // vectors with a shared outer-to-inner row mapping.
+  std::vector<VectorPtr> inputs = {
+      wrapInDictionaryLayers(flat1, {&dictWrap2, &dictWrap1}),
+      wrapInDictionaryLayers(flat2, {&dictWrap2, &dictWrap1})};
+  MultiColumnDecoder decoder;
+  std::vector<DecodedVector> decoded;
+  decoder.decode(inputs, rows, decoded);
+  ASSERT_EQ(decoded.size(), 2);
+  for (auto i = 0; i < inputs.size(); ++i) {
+    DecodedVector expected(*inputs[i], rows);
+    rows.applyToSelected([&](auto row) {
+      bool isNull =
+          decoder.isNullAt(row) || decoded[i].isNullAt(decoder.baseRow(row));
+      ASSERT_EQ(isNull, expected.isNullAt(row));
+      if (!isNull) {
+        ASSERT_EQ(
+            decoded[i].valueAt<int32_t>(decoder.baseRow(row)),
+            expected.valueAt<int32_t>(row));
+      }
+    });
+  }
+
+  // Columns with unrelated wrappings fall back to independent decoding
+  // with an identity row mapping.
+  inputs = {
+      wrapInDictionaryLayers(flat1, {&dictWrap1}),
+      wrapInDictionaryLayers(flat2, {&dictWrap2})};
+  decoder.decode(inputs, rows, decoded);
+  ASSERT_EQ(&decoder.baseRows(), &rows);
+  for (auto i = 0; i < inputs.size(); ++i) {
+    DecodedVector expected(*inputs[i], rows);
+    rows.applyToSelected([&](auto row) {
+      ASSERT_FALSE(decoder.isNullAt(row));
+      ASSERT_EQ(decoder.baseRow(row), row);
+      ASSERT_EQ(decoded[i].isNullAt(row), expected.isNullAt(row));
+      if (!expected.isNullAt(row)) {
+        ASSERT_EQ(
+            decoded[i].valueAt<int32_t>(row), expected.valueAt<int32_t>(row));
+      }
+    });
+  }
+}
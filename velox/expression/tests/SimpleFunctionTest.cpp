@@ -1064,6 +1064,39 @@ TEST_F(SimpleFunctionTest, isAsciiArgs) {
   ASSERT_TRUE(function_t::isAsciiArgs(rows, {input}));
 }
 
+template <typename T>
+struct AddInt64Function {
+  FOLLY_ALWAYS_INLINE bool
+  call(int64_t& out, const int64_t& a, const int64_t& b) {
+    out = a + b;
+    return true;
+  }
+};
+
+// Dictionary arguments directly wrapping a flat vector use a specialized
+// reader. Verify the results, including null propagation from the base
+// vector.
+TEST_F(SimpleFunctionTest, dictionaryArgs) {
+  registerFunction<AddInt64Function, int64_t, int64_t, int64_t>(
+      {"add_int64_test"});
+
+  const vector_size_t size = 100;
+  auto base = makeFlatVector<int64_t>(
+      size,
+      [](auto row) { return row; },
+      [](auto row) { return row % 7 == 0; });
+  auto dictionary = wrapInDictionary(makeIndicesInReverse(size), size, base);
+  auto flat = makeFlatVector<int64_t>(size, [](auto row) { return row; });
+
+  auto result = evaluate<SimpleVector<int64_t>>(
+      "add_int64_test(c0, c1)", makeRowVector({dictionary, flat}));
+  auto expected = makeFlatVector<int64_t>(
+      size,
+      [&](auto /*row*/) { return size - 1; },
+      [&](auto row) { return (size - 1 - row) % 7 == 0; });
+  assertEqualVectors(expected, result);
+}
+
 // Return false always.
 template <typename T>
 struct GenericOutputFunc {
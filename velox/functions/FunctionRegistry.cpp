@@ -23,6 +23,7 @@
 #include "velox/common/base/Exceptions.h"
 #include "velox/core/SimpleFunctionMetadata.h"
 #include "velox/expression/FunctionCallToSpecialForm.h"
+#include "velox/expression/FunctionRegistryVersion.h"
 #include "velox/expression/FunctionSignature.h"
 #include "velox/expression/SignatureBinder.h"
 #include "velox/expression/SimpleFunctionRegistry.h"
@@ -81,6 +82,7 @@ void clearFunctionRegistry() {
   exec::mutableSimpleFunctions().clearRegistry();
   exec::vectorFunctionFactories().withWLock(
       [](auto& functionMap) { functionMap.clear(); });
+  exec::bumpFunctionRegistryVersion();
 }
 
 std::shared_ptr<const Type> resolveFunction(
@@ -18,6 +18,7 @@
 
 #include <numeric>
 
+#include <folly/Range.h>
 #include <folly/container/F14Map.h>
 
 #include "velox/common/base/Exceptions.h"
@@ -47,6 +48,11 @@ struct ApproxMostFrequentStreamSummary {
   /// Add one or multiple new values to the summary.
   void insert(T value, int64_t count = 1);
 
+  /// Add a batch of values to the summary.  Equivalent to calling
+  /// insert(T) for each value, but pre-hashes the values a stripe at a
+  /// time to hide the cache misses of the index lookups.
+  void insert(folly::Range<const T*> values);
+
   /// Get the top `k` frequent elements with their estimated counts, sorted from
   /// most hits to least hits.
   std::vector<std::pair<T, int64_t>> topK(int k) const;
@@ -183,6 +189,35 @@ void ApproxMostFrequentStreamSummary<T, A>::insert(T value, int64_t count) {
   percolateDown(0);
 }
 
+template <typename T, typename A>
+void ApproxMostFrequentStreamSummary<T, A>::insert(
+    folly::Range<const T*> values) {
+  constexpr size_t kStripe = 8;
+  folly::F14HashToken tokens[kStripe];
+  for (size_t begin = 0; begin < values.size(); begin += kStripe) {
+    const auto len = std::min(kStripe, values.size() - begin);
+    for (size_t i = 0; i < len; ++i) {
+      tokens[i] = indices_.prehash(values[begin + i]);
+    }
+    for (size_t i = 0; i < len; ++i) {
+      const auto& value = values[begin + i];
+      if (auto it = indices_.find(tokens[i], value); it != indices_.end()) {
+        int j = it->second;
+        counts_[j] += 1;
+        generations_[j] = ++currentGeneration_;
+        percolateDown(heapIndices_[j]);
+      } else {
+        insert(value);
+        // The insert may rehash the index and invalidate the remaining
+        // tokens; recompute them.
+        for (size_t j = i + 1; j < len; ++j) {
+          tokens[j] = indices_.prehash(values[begin + j]);
+        }
+      }
+    }
+  }
+}
+
 template <typename T, typename A>
 void ApproxMostFrequentStreamSummary<T, A>::percolateUp(int pos) {
   while (pos > 0) {
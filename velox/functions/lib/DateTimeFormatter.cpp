@@ -15,7 +15,8 @@
  */
 
 #include "velox/functions/lib/DateTimeFormatter.h"
-#include <folly/String.h>
+#include <folly/Synchronized.h>
+#include <folly/container/F14Map.h>
 #include <velox/common/base/Exceptions.h>
 #include <velox/type/Date.h>
 #include <cstring>
@@ -180,38 +181,30 @@ static std::
         };
 constexpr int monthsFullLength[] = {7, 8, 5, 5, 3, 4, 4, 6, 9, 7, 8, 8};
 
-/// Pads the content with desired padding characters. E.g. if we need to pad 999
-/// with three 0s in front, the result will be '000999'
-/// \param content the content that is going to be padded.
-/// \param padding the padding that is going to be used to pad the content.
-/// \param totalDigits the total number of digits the padded result is desired
-/// to be. If totalDigits is already smaller than content length, the original
-/// content will be returned with no padding
-/// \param padFront if the padding is in front of the content or back of the
-/// content.
-template <typename T>
-std::string padContent(
-    const T& content,
-    char padding,
-    size_t totalDigits,
-    bool padFront = true) {
-  std::string strContent = folly::to<std::string>(content);
-  auto contentLength = strContent.size();
-  if (contentLength == 0) {
-    return std::string(totalDigits, padding);
+/// Appends the decimal digits of 'value' to 'result', zero padded in
+/// front to at least 'totalDigits' digits, e.g. 999 with 'totalDigits'
+/// of 6 becomes '000999'. A sign is prepended for negative values and
+/// does not count towards 'totalDigits'. Returns the number of
+/// characters written.
+int32_t padDigits(int64_t value, size_t totalDigits, char* result) {
+  char* pos = result;
+  if (value < 0) {
+    *pos++ = '-';
+    value = -value;
   }
-
-  bool isNegative = strContent[0] == '-';
-  auto digitLength = contentLength - (isNegative ? 1 : 0);
-  if (digitLength >= totalDigits) {
-    return strContent;
+  char digits[20];
+  int32_t numDigits = 0;
+  do {
+    digits[numDigits++] = char(value % 10 + '0');
+    value /= 10;
+  } while (value != 0);
+  for (auto i = static_cast<size_t>(numDigits); i < totalDigits; ++i) {
+    *pos++ = '0';
   }
-  std::string paddingStr(totalDigits - digitLength, padding);
-  if (padFront) {
-    return strContent.insert((isNegative ? 1 : 0), paddingStr);
-  } else {
-    return strContent.append(paddingStr);
+  while (numDigits != 0) {
+    *pos++ = digits[--numDigits];
   }
+  return pos - result;
 }
 
 void validateTimePoint(const std::chrono::time_point<
@@ -484,33 +477,6 @@ int64_t parseHalfDayOfDay(const char* cur, const char* end, Date& date) {
   }
 }
 
-std::string formatFractionOfSecond(
-    uint16_t subseconds,
-    size_t minRepresentDigits) {
-  char toAdd[minRepresentDigits > 3 ? minRepresentDigits + 1 : 4];
-
-  if (subseconds < 10) {
-    toAdd[0] = '0';
-    toAdd[1] = '0';
-    toAdd[2] = char(subseconds + '0');
-  } else if (subseconds < 100) {
-    toAdd[2] = char(subseconds % 10 + '0');
-    toAdd[1] = char((subseconds / 10) % 10 + '0');
-    toAdd[0] = '0';
-  } else {
-    toAdd[2] = char(subseconds % 10 + '0');
-    toAdd[1] = char((subseconds / 10) % 10 + '0');
-    toAdd[0] = char((subseconds / 100) % 10 + '0');
-  }
-
-  if (minRepresentDigits > 3) {
-    memset(toAdd + 3, '0', minRepresentDigits - 3);
-  }
-
-  toAdd[minRepresentDigits] = '\0';
-  return toAdd;
-}
-
 // According to DateTimeFormatSpecifier enum class
 std::string getSpecifierName(int enumInt) {
   switch (enumInt) {
@@ -949,9 +915,78 @@ void parseFromPattern(
 
 } // namespace
 
-std::string DateTimeFormatter::format(
-    const Timestamp& timestamp,
+size_t DateTimeFormatter::maxResultSize(
     const date::time_zone* timezone) const {
+  size_t size = 0;
+  for (const auto& token : tokens_) {
+    if (token.type == DateTimeToken::Type::kLiteral) {
+      size += token.literal.size();
+      continue;
+    }
+    switch (token.pattern.specifier) {
+      case DateTimeFormatSpecifier::ERA:
+      case DateTimeFormatSpecifier::HALFDAY_OF_DAY:
+        // "AD", "BC", "AM", "PM".
+        size += 2;
+        break;
+      case DateTimeFormatSpecifier::CENTURY_OF_ERA:
+        // Century of era is at most 3 digits.
+        size += std::max<size_t>(3, token.pattern.minRepresentDigits);
+        break;
+      case DateTimeFormatSpecifier::YEAR_OF_ERA:
+      case DateTimeFormatSpecifier::YEAR:
+        // Year is in [-32767, 32767] range, at most 5 digits plus the
+        // sign.
+        size += std::max<size_t>(5, token.pattern.minRepresentDigits) + 1;
+        break;
+      case DateTimeFormatSpecifier::DAY_OF_WEEK_0_BASED:
+      case DateTimeFormatSpecifier::DAY_OF_WEEK_1_BASED:
+        size += std::max<size_t>(1, token.pattern.minRepresentDigits);
+        break;
+      case DateTimeFormatSpecifier::DAY_OF_WEEK_TEXT:
+      case DateTimeFormatSpecifier::MONTH_OF_YEAR_TEXT:
+        // "Wednesday", "September".
+        size += 9;
+        break;
+      case DateTimeFormatSpecifier::DAY_OF_YEAR:
+        size += std::max<size_t>(3, token.pattern.minRepresentDigits);
+        break;
+      case DateTimeFormatSpecifier::MONTH_OF_YEAR:
+      case DateTimeFormatSpecifier::DAY_OF_MONTH:
+      case DateTimeFormatSpecifier::HOUR_OF_HALFDAY:
+      case DateTimeFormatSpecifier::CLOCK_HOUR_OF_HALFDAY:
+      case DateTimeFormatSpecifier::HOUR_OF_DAY:
+      case DateTimeFormatSpecifier::CLOCK_HOUR_OF_DAY:
+      case DateTimeFormatSpecifier::MINUTE_OF_HOUR:
+      case DateTimeFormatSpecifier::SECOND_OF_MINUTE:
+        size += std::max<size_t>(2, token.pattern.minRepresentDigits);
+        break;
+      case DateTimeFormatSpecifier::FRACTION_OF_SECOND:
+        size += std::max<size_t>(3, token.pattern.minRepresentDigits);
+        break;
+      case DateTimeFormatSpecifier::TIMEZONE:
+        if (timezone == nullptr) {
+          VELOX_USER_FAIL("Timezone unknown")
+        }
+        size += timezone->name().size();
+        break;
+      case DateTimeFormatSpecifier::TIMEZONE_OFFSET_ID:
+      case DateTimeFormatSpecifier::WEEK_YEAR:
+      case DateTimeFormatSpecifier::WEEK_OF_WEEK_YEAR:
+      default:
+        VELOX_UNSUPPORTED(
+            "format is not supported for specifier {}",
+            token.pattern.specifier);
+    }
+  }
+  return size;
+}
+
+int32_t DateTimeFormatter::format(
+    const Timestamp& timestamp,
+    const date::time_zone* timezone,
+    const size_t maxSize,
+    char* result) const {
   const std::chrono::
       time_point<std::chrono::system_clock, std::chrono::milliseconds>
           timePoint(std::chrono::milliseconds(timestamp.toMillis()));
@@ -962,30 +997,36 @@ std::string DateTimeFormatter::format(
   const date::year_month_day calDate(daysTimePoint);
   const date::weekday weekday(daysTimePoint);
 
-  std::string result;
+  char* pos = result;
+  auto appendString = [&pos](const std::string_view& content) {
+    std::memcpy(pos, content.data(), content.size());
+    pos += content.size();
+  };
+
   for (auto& token : tokens_) {
     if (token.type == DateTimeToken::Type::kLiteral) {
-      result += token.literal;
+      appendString(token.literal);
     } else {
       switch (token.pattern.specifier) {
         case DateTimeFormatSpecifier::ERA:
-          result += static_cast<signed>(calDate.year()) > 0 ? "AD" : "BC";
+          appendString(
+              static_cast<signed>(calDate.year()) > 0 ? "AD" : "BC");
           break;
 
         case DateTimeFormatSpecifier::CENTURY_OF_ERA: {
           auto year = static_cast<signed>(calDate.year());
           year = (year < 0 ? -year : year);
           auto century = year / 100;
-          result += padContent(century, '0', token.pattern.minRepresentDigits);
+          pos += padDigits(century, token.pattern.minRepresentDigits, pos);
         } break;
 
         case DateTimeFormatSpecifier::YEAR_OF_ERA: {
           auto year = static_cast<signed>(calDate.year());
           if (token.pattern.minRepresentDigits == 2) {
-            result += padContent(std::abs(year) % 100, '0', 2);
+            pos += padDigits(std::abs(year) % 100, 2, pos);
           } else {
             year = year <= 0 ? std::abs(year - 1) : year;
-            result += padContent(year, '0', token.pattern.minRepresentDigits);
+            pos += padDigits(year, token.pattern.minRepresentDigits, pos);
           }
         } break;
 
@@ -997,16 +1038,15 @@ std::string DateTimeFormatter::format(
                   DateTimeFormatSpecifier::DAY_OF_WEEK_1_BASED) {
             weekdayNum = 7;
           }
-          result +=
-              padContent(weekdayNum, '0', token.pattern.minRepresentDigits);
+          pos += padDigits(weekdayNum, token.pattern.minRepresentDigits, pos);
         } break;
 
         case DateTimeFormatSpecifier::DAY_OF_WEEK_TEXT: {
           auto weekdayNum = weekday.c_encoding();
           if (token.pattern.minRepresentDigits <= 3) {
-            result += weekdaysShort[weekdayNum];
+            appendString(weekdaysShort[weekdayNum]);
           } else {
-            result += weekdaysFull[weekdayNum];
+            appendString(weekdaysFull[weekdayNum]);
           }
         } break;
 
@@ -1015,13 +1055,13 @@ std::string DateTimeFormatter::format(
           if (token.pattern.minRepresentDigits == 2) {
             year = std::abs(year);
             auto twoDigitYear = year % 100;
-            result +=
-                padContent(twoDigitYear, '0', token.pattern.minRepresentDigits);
+            pos += padDigits(
+                twoDigitYear, token.pattern.minRepresentDigits, pos);
           } else {
-            result += padContent(
+            pos += padDigits(
                 static_cast<signed>(calDate.year()),
-                '0',
-                token.pattern.minRepresentDigits);
+                token.pattern.minRepresentDigits,
+                pos);
           }
         } break;
 
@@ -1032,33 +1072,35 @@ std::string DateTimeFormatter::format(
               (date::sys_days{calDate} - date::sys_days{firstDayOfTheYear})
                   .count();
           delta += 1;
-          result += padContent(delta, '0', token.pattern.minRepresentDigits);
+          pos += padDigits(delta, token.pattern.minRepresentDigits, pos);
         } break;
 
         case DateTimeFormatSpecifier::MONTH_OF_YEAR:
-          result += padContent(
+          pos += padDigits(
               static_cast<unsigned>(calDate.month()),
-              '0',
-              token.pattern.minRepresentDigits);
+              token.pattern.minRepresentDigits,
+              pos);
           break;
 
         case DateTimeFormatSpecifier::MONTH_OF_YEAR_TEXT:
           if (token.pattern.minRepresentDigits <= 3) {
-            result += monthsShort[static_cast<unsigned>(calDate.month()) - 1];
+            appendString(
+                monthsShort[static_cast<unsigned>(calDate.month()) - 1]);
           } else {
-            result += monthsFull[static_cast<unsigned>(calDate.month()) - 1];
+            appendString(
+                monthsFull[static_cast<unsigned>(calDate.month()) - 1]);
           }
           break;
 
         case DateTimeFormatSpecifier::DAY_OF_MONTH:
-          result += padContent(
+          pos += padDigits(
               static_cast<unsigned>(calDate.day()),
-              '0',
-              token.pattern.minRepresentDigits);
+              token.pattern.minRepresentDigits,
+              pos);
           break;
 
         case DateTimeFormatSpecifier::HALFDAY_OF_DAY:
-          result += durationInTheDay.hours().count() < 12 ? "AM" : "PM";
+          appendString(durationInTheDay.hours().count() < 12 ? "AM" : "PM");
           break;
 
         case DateTimeFormatSpecifier::HOUR_OF_HALFDAY:
@@ -1078,29 +1120,38 @@ std::string DateTimeFormatter::format(
               DateTimeFormatSpecifier::CLOCK_HOUR_OF_DAY) {
             hourNum = (hourNum + 23) % 24 + 1;
           }
-          result += padContent(hourNum, '0', token.pattern.minRepresentDigits);
+          pos += padDigits(hourNum, token.pattern.minRepresentDigits, pos);
         } break;
 
         case DateTimeFormatSpecifier::MINUTE_OF_HOUR:
-          result += padContent(
+          pos += padDigits(
               durationInTheDay.minutes().count() % 60,
-              '0',
-              token.pattern.minRepresentDigits);
+              token.pattern.minRepresentDigits,
+              pos);
           break;
 
         case DateTimeFormatSpecifier::SECOND_OF_MINUTE:
-          result += padContent(
+          pos += padDigits(
               durationInTheDay.seconds().count() % 60,
-              '0',
-              token.pattern.minRepresentDigits);
+              token.pattern.minRepresentDigits,
+              pos);
           break;
 
         case DateTimeFormatSpecifier::FRACTION_OF_SECOND: {
-          result += formatFractionOfSecond(
-              durationInTheDay.subseconds().count(),
-              token.pattern.minRepresentDigits);
-          break;
-        }
+          const auto& digits = token.pattern.minRepresentDigits;
+          const uint16_t subseconds = durationInTheDay.subseconds().count();
+          const char milliDigits[3] = {
+              char((subseconds / 100) % 10 + '0'),
+              char((subseconds / 10) % 10 + '0'),
+              char(subseconds % 10 + '0')};
+          const auto numCopied = std::min<size_t>(digits, 3);
+          std::memcpy(pos, milliDigits, numCopied);
+          pos += numCopied;
+          if (digits > 3) {
+            std::memset(pos, '0', digits - 3);
+            pos += digits - 3;
+          }
+        } break;
 
         case DateTimeFormatSpecifier::TIMEZONE:
           // TODO: implement short name time zone, need a map from full name to
@@ -1111,7 +1162,7 @@ std::string DateTimeFormatter::format(
           if (timezone == nullptr) {
             VELOX_USER_FAIL("Timezone unknown")
           }
-          result += timezone->name();
+          appendString(timezone->name());
           break;
 
         case DateTimeFormatSpecifier::TIMEZONE_OFFSET_ID:
@@ -1126,6 +1177,18 @@ std::string DateTimeFormatter::format(
       }
     }
   }
+  const auto resultSize = pos - result;
+  VELOX_DCHECK_LE(resultSize, maxSize);
+  return resultSize;
+}
+
+std::string DateTimeFormatter::format(
+    const Timestamp& timestamp,
+    const date::time_zone* timezone) const {
+  std::string result(maxResultSize(timezone), '\0');
+  const auto resultSize =
+      format(timestamp, timezone, result.size(), result.data());
+  result.resize(resultSize);
   return result;
 }
 
@@ -1210,7 +1273,9 @@ DateTimeResult DateTimeFormatter::parse(const std::string_view& input) const {
       util::fromDatetime(daysSinceEpoch, microsSinceMidnight), date.timezoneId};
 }
 
-std::shared_ptr<DateTimeFormatter> buildMysqlDateTimeFormatter(
+namespace {
+
+std::shared_ptr<DateTimeFormatter> buildMysqlDateTimeFormatterUncached(
     const std::string_view& format) {
   if (format.empty()) {
     VELOX_USER_FAIL("Both printing and parsing not supported");
@@ -1338,7 +1403,7 @@ std::shared_ptr<DateTimeFormatter> buildMysqlDateTimeFormatter(
   return builder.setType(DateTimeFormatterType::MYSQL).build();
 }
 
-std::shared_ptr<DateTimeFormatter> buildJodaDateTimeFormatter(
+std::shared_ptr<DateTimeFormatter> buildJodaDateTimeFormatterUncached(
     const std::string_view& format) {
   if (format.empty()) {
     VELOX_USER_FAIL("Invalid pattern specification");
@@ -1460,4 +1525,46 @@ std::shared_ptr<DateTimeFormatter> buildJodaDateTimeFormatter(
   return builder.setType(DateTimeFormatterType::JODA).build();
 }
 
+using FormatterCache = folly::Synchronized<
+    folly::F14FastMap<std::string, std::shared_ptr<DateTimeFormatter>>>;
+
+// Returns the formatter for 'format' from 'cache', building and caching
+// it on first use. Formatters are immutable once built, so a single
+// instance is shared across drivers. The cache is cleared wholesale
+// when full; workloads use a handful of distinct patterns.
+std::shared_ptr<DateTimeFormatter> getCachedFormatter(
+    const std::string_view& format,
+    std::shared_ptr<DateTimeFormatter> (*build)(const std::string_view&),
+    FormatterCache& cache) {
+  static constexpr size_t kMaxCachedFormatters = 256;
+  const std::string key(format);
+  {
+    auto formatters = cache.rlock();
+    auto it = formatters->find(key);
+    if (it != formatters->end()) {
+      return it->second;
+    }
+  }
+  auto formatter = build(format);
+  auto formatters = cache.wlock();
+  if (formatters->size() >= kMaxCachedFormatters) {
+    formatters->clear();
+  }
+  return formatters->emplace(key, std::move(formatter)).first->second;
+}
+
+} // namespace
+
+std::shared_ptr<DateTimeFormatter> buildMysqlDateTimeFormatter(
+    const std::string_view& format) {
+  static FormatterCache cache;
+  return getCachedFormatter(format, buildMysqlDateTimeFormatterUncached, cache);
+}
+
+std::shared_ptr<DateTimeFormatter> buildJodaDateTimeFormatter(
+    const std::string_view& format) {
+  static FormatterCache cache;
+  return getCachedFormatter(format, buildJodaDateTimeFormatterUncached, cache);
+}
+
 } // namespace facebook::velox::functions
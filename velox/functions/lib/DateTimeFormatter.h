@@ -175,6 +175,20 @@ class DateTimeFormatter {
 
   DateTimeResult parse(const std::string_view& input) const;
 
+  /// Returns an upper bound on the number of characters format() can
+  /// produce for any timestamp. Lets callers reserve result memory
+  /// once and format directly into it.
+  size_t maxResultSize(const date::time_zone* timezone) const;
+
+  /// Formats 'timestamp' into 'result', which must have space for at
+  /// least 'maxSize' characters ('maxSize' is typically obtained from
+  /// maxResultSize()). Returns the size of the formatted string.
+  int32_t format(
+      const Timestamp& timestamp,
+      const date::time_zone* timezone,
+      const size_t maxSize,
+      char* result) const;
+
   std::string format(
       const Timestamp& timestamp,
       const date::time_zone* timezone) const;
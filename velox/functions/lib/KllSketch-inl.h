@@ -293,6 +293,36 @@ void KllSketch<T, A, C>::insert(T value) {
   doInsert(value);
 }
 
+template <typename T, typename A, typename C>
+void KllSketch<T, A, C>::insert(folly::Range<const T*> values) {
+  if (values.empty()) {
+    return;
+  }
+  const auto [minIt, maxIt] =
+      std::minmax_element(values.begin(), values.end(), C());
+  if (n_ == 0) {
+    minValue_ = *minIt;
+    maxValue_ = *maxIt;
+  } else {
+    minValue_ = std::min(minValue_, *minIt, C());
+    maxValue_ = std::max(maxValue_, *maxIt, C());
+  }
+  size_t i = 0;
+  if (numLevels() == 1 && items_.size() < k_) {
+    // Level zero is still growing; append as much as fits in one go.
+    auto numAppend = std::min<size_t>(values.size(), k_ - items_.size());
+    items_.insert(
+        items_.end(), values.begin(), values.begin() + numAppend);
+    levels_[1] += numAppend;
+    n_ += numAppend;
+    isLevelZeroSorted_ = false;
+    i = numAppend;
+  }
+  for (; i < values.size(); ++i) {
+    doInsert(values[i]);
+  }
+}
+
 template <typename T, typename A, typename C>
 void KllSketch<T, A, C>::doInsert(T value) {
   VELOX_DCHECK_GT(k_, 0);
@@ -60,6 +60,11 @@ struct KllSketch {
   /// Add one new value to the sketch.
   void insert(T value);
 
+  /// Add a batch of values to the sketch.  Equivalent to calling
+  /// insert(T) for each value, but updates the min and max in one pass
+  /// and bulk appends to level zero while the sketch is still growing.
+  void insert(folly::Range<const T*> values);
+
   /// Call this before serialization can optimize the space used.
   void compact();
 
@@ -47,7 +47,7 @@ BufferPtr toWrapCapture(
     const Callable* callable,
     const SelectivityVector& topLevelRows,
     const std::shared_ptr<T>& topLevelVector) {
-  if (!callable->hasCapture()) {
+  if (!callable->needsCaptureWrap()) {
     return nullptr;
   }
 
@@ -21,6 +21,39 @@
 namespace facebook::velox::functions {
 namespace {
 
+// Marks all but the last of each run of equal adjacent keys within every
+// map as removed in 'uniqueKeys' and shrinks the per-row offsets and
+// sizes accordingly. Returns the number of duplicates found. Typed
+// equivalent of the equalValueAt() based scan below for flat keys of
+// scalar types.
+template <TypeKind Kind>
+vector_size_t markAdjacentDuplicateKeys(
+    const SelectivityVector& rows,
+    const BaseVector& keys,
+    vector_size_t* rawOffsets,
+    vector_size_t* rawSizes,
+    SelectivityVector& uniqueKeys) {
+  using T = typename TypeTraits<Kind>::NativeType;
+  const T* rawKeys = keys.asUnchecked<FlatVector<T>>()->rawValues();
+  vector_size_t duplicateCnt = 0;
+  rows.applyToSelected([&](vector_size_t row) {
+    auto mapOffset = rawOffsets[row];
+    auto mapSize = rawSizes[row];
+    if (duplicateCnt) {
+      rawOffsets[row] -= duplicateCnt;
+    }
+    for (vector_size_t i = 1; i < mapSize; i++) {
+      if (rawKeys[mapOffset + i] == rawKeys[mapOffset + i - 1]) {
+        duplicateCnt++;
+        // "remove" duplicate entry
+        uniqueKeys.setValid(mapOffset + i - 1, false);
+        rawSizes[row]--;
+      }
+    }
+  });
+  return duplicateCnt;
+}
+
 // See documentation at https://prestodb.io/docs/current/functions/map.html
 template <bool EmptyForNull>
 class MapConcatFunction : public exec::VectorFunction {
@@ -73,7 +106,10 @@ class MapConcatFunction : public exec::VectorFunction {
     BufferPtr sizes = allocateSizes(rows.end(), pool);
     auto rawSizes = sizes->asMutable<vector_size_t>();
 
+    // First pass lays out the per-row output ranges, second pass copies
+    // each argument's element ranges in bulk.
     vector_size_t offset = 0;
+    std::vector<std::vector<BaseVector::CopyRange>> copyRanges(numArgs);
     rows.applyToSelected([&](vector_size_t row) {
       rawOffsets[row] = offset;
       // Reuse the last offset and size if null key must create empty map
@@ -84,17 +120,27 @@ class MapConcatFunction : public exec::VectorFunction {
         }
         auto inputMap = decodedArg->base()->as<MapVector>();
         auto index = decodedArg->index(row);
-        auto inputOffset = inputMap->offsetAt(index);
         auto inputSize = inputMap->sizeAt(index);
-        combinedKeys->copy(
-            inputMap->mapKeys().get(), offset, inputOffset, inputSize);
-        combinedValues->copy(
-            inputMap->mapValues().get(), offset, inputOffset, inputSize);
+        if (inputSize > 0) {
+          copyRanges[i].push_back(
+              {inputMap->offsetAt(index), offset, inputSize});
+        }
         offset += inputSize;
       }
       rawSizes[row] = offset - rawOffsets[row];
     });
 
+    for (auto i = 0; i < numArgs; i++) {
+      if (copyRanges[i].empty()) {
+        continue;
+      }
+      auto inputMap = decodedArgs.at(i)->base()->as<MapVector>();
+      const folly::Range<const BaseVector::CopyRange*> ranges(
+          copyRanges[i].data(), copyRanges[i].size());
+      combinedKeys->copyRanges(inputMap->mapKeys().get(), ranges);
+      combinedValues->copyRanges(inputMap->mapValues().get(), ranges);
+    }
+
     auto combinedMap = std::make_shared<MapVector>(
         pool,
         outputType,
@@ -110,25 +156,39 @@ class MapConcatFunction : public exec::VectorFunction {
     combinedKeys = combinedMap->mapKeys();
     combinedValues = combinedMap->mapValues();
 
-    // Check for duplicate keys
+    // Check for duplicate keys. After canonicalize() duplicates are
+    // adjacent; compare raw values directly when the key type allows it.
     SelectivityVector uniqueKeys(offset);
     vector_size_t duplicateCnt = 0;
-    rows.applyToSelected([&](vector_size_t row) {
-      auto mapOffset = rawOffsets[row];
-      auto mapSize = rawSizes[row];
-      if (duplicateCnt) {
-        rawOffsets[row] -= duplicateCnt;
-      }
-      for (vector_size_t i = 1; i < mapSize; i++) {
-        if (combinedKeys->equalValueAt(
-                combinedKeys.get(), mapOffset + i, mapOffset + i - 1)) {
-          duplicateCnt++;
-          // "remove" duplicate entry
-          uniqueKeys.setValid(mapOffset + i - 1, false);
-          rawSizes[row]--;
+    const auto keyKind = combinedKeys->typeKind();
+    if (combinedKeys->isFlatEncoding() && keyKind >= TypeKind::TINYINT &&
+        keyKind <= TypeKind::DATE) {
+      duplicateCnt = VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
+          markAdjacentDuplicateKeys,
+          keyKind,
+          rows,
+          *combinedKeys,
+          rawOffsets,
+          rawSizes,
+          uniqueKeys);
+    } else {
+      rows.applyToSelected([&](vector_size_t row) {
+        auto mapOffset = rawOffsets[row];
+        auto mapSize = rawSizes[row];
+        if (duplicateCnt) {
+          rawOffsets[row] -= duplicateCnt;
         }
-      }
-    });
+        for (vector_size_t i = 1; i < mapSize; i++) {
+          if (combinedKeys->equalValueAt(
+                  combinedKeys.get(), mapOffset + i, mapOffset + i - 1)) {
+            duplicateCnt++;
+            // "remove" duplicate entry
+            uniqueKeys.setValid(mapOffset + i - 1, false);
+            rawSizes[row]--;
+          }
+        }
+      });
+    }
 
     if (duplicateCnt) {
       uniqueKeys.updateBounds();
@@ -15,10 +15,14 @@
  */
 #include "velox/functions/lib/Re2Functions.h"
 
+#include <folly/Synchronized.h>
 #include <re2/re2.h>
 #include <optional>
 #include <string>
 
+#include "velox/common/base/RuntimeMetrics.h"
+#include "velox/common/caching/SimpleLRUCache.h"
+#include "velox/common/time/Timer.h"
 #include "velox/expression/VectorWriters.h"
 
 namespace facebook::velox::functions {
@@ -63,6 +67,81 @@ void checkForBadPattern(const RE2& re) {
   }
 }
 
+// Process-wide cache of compiled regexes, shared across expression instances
+// and drivers. RE2 builds its DFA lazily per object, so sharing one RE2 per
+// distinct pattern also shares the hot DFA instead of keeping one copy per
+// driver. The cache is bounded: at most kMaxEntries patterns are kept, each
+// compiled with a kMaxMemPerRegex memory budget (RE2 falls back to NFA
+// execution when a DFA would exceed its budget).
+class CompiledRegexCache {
+ public:
+  // Maximum number of distinct compiled patterns kept alive.
+  static constexpr size_t kMaxEntries = 256;
+
+  // Memory budget for each compiled pattern: parse tree, programs and lazily
+  // built DFAs. This is RE2's default max_mem.
+  static constexpr int64_t kMaxMemPerRegex = 8 << 20;
+
+  static CompiledRegexCache& instance() {
+    static auto* cache = new CompiledRegexCache();
+    return *cache;
+  }
+
+  // Returns the compiled regex for 'pattern', compiling it on a cache miss.
+  // 'dotNl' selects the dot-matches-newline variant used by LIKE. The
+  // returned regex may be invalid; callers are expected to call
+  // checkForBadPattern before use.
+  std::shared_ptr<RE2> compile(const std::string& pattern, bool dotNl) {
+    // Both variants append exactly one flag byte, so flagged keys cannot
+    // collide with each other or with a different pattern.
+    std::string key = pattern;
+    key += dotNl ? 'S' : '.';
+    {
+      auto cache = cache_.wlock();
+      if (auto cached = cache->get(key)) {
+        addThreadLocalRuntimeStat("regexCacheHits", RuntimeCounter(1));
+        return *cached;
+      }
+    }
+    RE2::Options options{RE2::Quiet};
+    options.set_max_mem(kMaxMemPerRegex);
+    options.set_dot_nl(dotNl);
+    auto compiled = std::make_shared<RE2>(toStringPiece(pattern), options);
+    auto cache = cache_.wlock();
+    if (auto cached = cache->get(key)) {
+      // Another thread compiled the same pattern concurrently; keep the
+      // cached copy so all users share one DFA.
+      return *cached;
+    }
+    cache->add(key, compiled);
+    addThreadLocalRuntimeStat("regexCacheCompiles", RuntimeCounter(1));
+    return compiled;
+  }
+
+ private:
+  folly::Synchronized<SimpleLRUCache<std::string, std::shared_ptr<RE2>>>
+      cache_{folly::in_place, kMaxEntries};
+};
+
+// Reports the wall time spent matching a constant pattern to the runtime
+// stats of the operator running on this thread, keyed under
+// 'regexMatchWallNanos'.
+class RegexMatchTimeRecorder {
+ public:
+  RegexMatchTimeRecorder() : startMicros_(getCurrentTimeMicro()) {}
+
+  ~RegexMatchTimeRecorder() {
+    addThreadLocalRuntimeStat(
+        "regexMatchWallNanos",
+        RuntimeCounter(
+            (getCurrentTimeMicro() - startMicros_) * 1'000,
+            RuntimeCounter::Unit::kNanos));
+  }
+
+ private:
+  const uint64_t startMicros_;
+};
+
 FlatVector<bool>& ensureWritableBool(
     const SelectivityVector& rows,
     EvalCtx& context,
@@ -180,7 +259,7 @@ template <bool (*Fn)(StringView, const RE2&)>
 class Re2MatchConstantPattern final : public VectorFunction {
  public:
   explicit Re2MatchConstantPattern(StringView pattern)
-      : re_(toStringPiece(pattern), RE2::Quiet) {}
+      : re_(CompiledRegexCache::instance().compile(pattern.str(), false)) {}
 
   void apply(
       const SelectivityVector& rows,
@@ -192,19 +271,20 @@ class Re2MatchConstantPattern final : public VectorFunction {
     FlatVector<bool>& result = ensureWritableBool(rows, context, resultRef);
     exec::LocalDecodedVector toSearch(context, *args[0], rows);
     try {
-      checkForBadPattern(re_);
+      checkForBadPattern(*re_);
     } catch (const std::exception& e) {
       context.setErrors(rows, std::current_exception());
       return;
     }
 
+    RegexMatchTimeRecorder timeRecorder;
     context.applyToSelectedNoThrow(rows, [&](vector_size_t i) {
-      result.set(i, Fn(toSearch->valueAt<StringView>(i), re_));
+      result.set(i, Fn(toSearch->valueAt<StringView>(i), *re_));
     });
   }
 
  private:
-  RE2 re_;
+  std::shared_ptr<RE2> re_;
 };
 
 template <bool (*Fn)(StringView, const RE2&)>
@@ -246,7 +326,8 @@ class Re2SearchAndExtractConstantPattern final : public VectorFunction {
   explicit Re2SearchAndExtractConstantPattern(
       StringView pattern,
       bool emptyNoMatch)
-      : re_(toStringPiece(pattern), RE2::Quiet), emptyNoMatch_(emptyNoMatch) {}
+      : re_(CompiledRegexCache::instance().compile(pattern.str(), false)),
+        emptyNoMatch_(emptyNoMatch) {}
 
   void apply(
       const SelectivityVector& rows,
@@ -261,7 +342,7 @@ class Re2SearchAndExtractConstantPattern final : public VectorFunction {
 
     // apply() will not be invoked if the selection is empty.
     try {
-      checkForBadPattern(re_);
+      checkForBadPattern(*re_);
     } catch (const std::exception& e) {
       context.setErrors(rows, std::current_exception());
       return;
@@ -275,7 +356,7 @@ class Re2SearchAndExtractConstantPattern final : public VectorFunction {
       groups.resize(1);
       context.applyToSelectedNoThrow(rows, [&](vector_size_t i) {
         mustRefSourceStrings |=
-            re2Extract(result, i, re_, toSearch, groups, 0, emptyNoMatch_);
+            re2Extract(result, i, *re_, toSearch, groups, 0, emptyNoMatch_);
       });
       if (mustRefSourceStrings) {
         result.acquireSharedStringBuffers(toSearch->base());
@@ -285,7 +366,7 @@ class Re2SearchAndExtractConstantPattern final : public VectorFunction {
 
     if (const auto groupId = getIfConstant<T>(*args[2])) {
       try {
-        checkForBadGroupId(*groupId, re_);
+        checkForBadGroupId(*groupId, *re_);
       } catch (const std::exception& e) {
         context.setErrors(rows, std::current_exception());
         return;
@@ -294,7 +375,7 @@ class Re2SearchAndExtractConstantPattern final : public VectorFunction {
       groups.resize(*groupId + 1);
       context.applyToSelectedNoThrow(rows, [&](vector_size_t i) {
         mustRefSourceStrings |= re2Extract(
-            result, i, re_, toSearch, groups, *groupId, emptyNoMatch_);
+            result, i, *re_, toSearch, groups, *groupId, emptyNoMatch_);
       });
       if (mustRefSourceStrings) {
         result.acquireSharedStringBuffers(toSearch->base());
@@ -306,12 +387,12 @@ class Re2SearchAndExtractConstantPattern final : public VectorFunction {
     // number of capturing groups + 1.
     exec::LocalDecodedVector groupIds(context, *args[2], rows);
 
-    groups.resize(re_.NumberOfCapturingGroups() + 1);
+    groups.resize(re_->NumberOfCapturingGroups() + 1);
     context.applyToSelectedNoThrow(rows, [&](vector_size_t i) {
       T group = groupIds->valueAt<T>(i);
-      checkForBadGroupId(group, re_);
+      checkForBadGroupId(group, *re_);
       mustRefSourceStrings |=
-          re2Extract(result, i, re_, toSearch, groups, group, emptyNoMatch_);
+          re2Extract(result, i, *re_, toSearch, groups, group, emptyNoMatch_);
     });
     if (mustRefSourceStrings) {
       result.acquireSharedStringBuffers(toSearch->base());
@@ -319,7 +400,7 @@ class Re2SearchAndExtractConstantPattern final : public VectorFunction {
   }
 
  private:
-  RE2 re_;
+  std::shared_ptr<RE2> re_;
   const bool emptyNoMatch_;
 }; // namespace
 
@@ -399,6 +480,15 @@ bool matchPrefixPattern(
       std::memcmp(input.data(), pattern.data(), length) == 0;
 }
 
+// Match string 'input' with the fixed mid part of a '%fixed%' pattern.
+// 'fixedPattern' holds only the fixed part.
+bool matchSubstringPattern(StringView input, StringView fixedPattern) {
+  return std::string_view(input.data(), input.size())
+             .find(std::string_view(
+                 fixedPattern.data(), fixedPattern.size())) !=
+      std::string_view::npos;
+}
+
 // Match the last 'length' characters of string 'input' and suffix pattern.
 bool matchSuffixPattern(
     StringView input,
@@ -431,6 +521,9 @@ class OptimizedLikeWithMemcmp final : public VectorFunction {
         return matchPrefixPattern(input, pattern_, reducedPatternLength_);
       case PatternKind::kSuffix:
         return matchSuffixPattern(input, pattern_, reducedPatternLength_);
+      case PatternKind::kSubstring:
+        // 'pattern_' holds only the fixed part for substring patterns.
+        return matchSubstringPattern(input, pattern_);
     }
   }
 
@@ -473,11 +566,8 @@ class OptimizedLikeWithMemcmp final : public VectorFunction {
 class LikeWithRe2 final : public VectorFunction {
  public:
   LikeWithRe2(StringView pattern, std::optional<char> escapeChar) {
-    RE2::Options opt{RE2::Quiet};
-    opt.set_dot_nl(true);
-    re_.emplace(
-        toStringPiece(likePatternToRe2(pattern, escapeChar, validPattern_)),
-        opt);
+    re_ = CompiledRegexCache::instance().compile(
+        likePatternToRe2(pattern, escapeChar, validPattern_), true);
   }
 
   void apply(
@@ -509,6 +599,7 @@ class LikeWithRe2 final : public VectorFunction {
     auto toSearch = decodedArgs.at(0);
     if (toSearch->isIdentityMapping()) {
       auto rawStrings = toSearch->data<StringView>();
+      RegexMatchTimeRecorder timeRecorder;
       context.applyToSelectedNoThrow(rows, [&](vector_size_t i) {
         result.set(i, re2FullMatch(rawStrings[i], *re_));
       });
@@ -529,7 +620,7 @@ class LikeWithRe2 final : public VectorFunction {
   }
 
  private:
-  std::optional<RE2> re_;
+  std::shared_ptr<RE2> re_;
   bool validPattern_;
 };
 
@@ -570,7 +661,7 @@ template <typename T>
 class Re2ExtractAllConstantPattern final : public VectorFunction {
  public:
   explicit Re2ExtractAllConstantPattern(StringView pattern)
-      : re_(toStringPiece(pattern), RE2::Quiet) {}
+      : re_(CompiledRegexCache::instance().compile(pattern.str(), false)) {}
 
   void apply(
       const SelectivityVector& rows,
@@ -580,7 +671,7 @@ class Re2ExtractAllConstantPattern final : public VectorFunction {
       VectorPtr& resultRef) const final {
     VELOX_CHECK(args.size() == 2 || args.size() == 3);
     try {
-      checkForBadPattern(re_);
+      checkForBadPattern(*re_);
     } catch (const std::exception& e) {
       context.setErrors(rows, std::current_exception());
       return;
@@ -599,13 +690,13 @@ class Re2ExtractAllConstantPattern final : public VectorFunction {
       //
       groups.resize(1);
       context.applyToSelectedNoThrow(rows, [&](vector_size_t row) {
-        re2ExtractAll(resultWriter, re_, inputStrs, row, groups, 0);
+        re2ExtractAll(resultWriter, *re_, inputStrs, row, groups, 0);
       });
     } else if (const auto _groupId = getIfConstant<T>(*args[2])) {
       // Case 2: Constant groupId
       //
       try {
-        checkForBadGroupId(*_groupId, re_);
+        checkForBadGroupId(*_groupId, *re_);
       } catch (const std::exception& e) {
         context.setErrors(rows, std::current_exception());
         return;
@@ -613,18 +704,18 @@ class Re2ExtractAllConstantPattern final : public VectorFunction {
 
       groups.resize(*_groupId + 1);
       context.applyToSelectedNoThrow(rows, [&](vector_size_t row) {
-        re2ExtractAll(resultWriter, re_, inputStrs, row, groups, *_groupId);
+        re2ExtractAll(resultWriter, *re_, inputStrs, row, groups, *_groupId);
       });
     } else {
       // Case 3: Variable groupId, so resize the groups vector to accommodate
       // number of capturing groups + 1.
       exec::LocalDecodedVector groupIds(context, *args[2], rows);
 
-      groups.resize(re_.NumberOfCapturingGroups() + 1);
+      groups.resize(re_->NumberOfCapturingGroups() + 1);
       context.applyToSelectedNoThrow(rows, [&](vector_size_t row) {
         const T groupId = groupIds->valueAt<T>(row);
-        checkForBadGroupId(groupId, re_);
-        re2ExtractAll(resultWriter, re_, inputStrs, row, groups, groupId);
+        checkForBadGroupId(groupId, *re_);
+        re2ExtractAll(resultWriter, *re_, inputStrs, row, groups, groupId);
       });
     }
 
@@ -637,7 +728,7 @@ class Re2ExtractAllConstantPattern final : public VectorFunction {
   }
 
  private:
-  RE2 re_;
+  std::shared_ptr<RE2> re_;
 };
 
 template <typename T>
@@ -854,8 +945,19 @@ std::pair<PatternKind, vector_size_t> determinePatternKind(StringView pattern) {
   while (i < patternLength) {
     if (patternStr[i] == '%' || patternStr[i] == '_') {
       // Ensures that pattern has a single contiguous stream of wildcard
-      // characters.
+      // characters, except for substring patterns of the form '%fixed%':
+      // a leading '%' stream, a fixed pattern and a trailing '%' stream.
       if (wildcardStart != -1) {
+        if (wildcardStart == 0 && fixedPatternStart != -1 &&
+            !singleCharacterWildcardCount) {
+          const auto fixedPatternLength = i - fixedPatternStart;
+          while (i < patternLength && patternStr[i] == '%') {
+            i++;
+          }
+          if (i == patternLength) {
+            return {PatternKind::kSubstring, fixedPatternLength};
+          }
+        }
         return std::make_pair(PatternKind::kGeneric, 0);
       }
       // Look till the last contiguous wildcard character, starting from this
@@ -986,6 +1088,19 @@ std::shared_ptr<exec::VectorFunction> makeLike(
       case PatternKind::kSuffix:
         return std::make_shared<OptimizedLikeWithMemcmp<PatternKind::kSuffix>>(
             pattern, reducedLength);
+      case PatternKind::kSubstring: {
+        // Strip the enclosing '%' streams; the matcher only needs the fixed
+        // mid part. The StringView either inlines the bytes or points into
+        // the constant pattern vector, so it stays valid.
+        vector_size_t fixedPatternStart = 0;
+        while (pattern.data()[fixedPatternStart] == '%') {
+          ++fixedPatternStart;
+        }
+        return std::make_shared<
+            OptimizedLikeWithMemcmp<PatternKind::kSubstring>>(
+            StringView(pattern.data() + fixedPatternStart, reducedLength),
+            reducedLength);
+      }
       default:
         return std::make_shared<LikeWithRe2>(pattern, escapeChar);
     }
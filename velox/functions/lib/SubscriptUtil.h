@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <folly/container/F14Map.h>
+
 #include "velox/expression/VectorFunction.h"
 #include "velox/type/Type.h"
 #include "velox/vector/NullsBuilder.h"
@@ -99,6 +101,10 @@ class SubscriptImpl : public exec::VectorFunction {
   }
 
  private:
+  // Maps with fewer entries than this are always searched sequentially;
+  // building a hash index over the keys does not pay off.
+  static constexpr vector_size_t kMinMapSizeForKeyIndex = 8;
+
   VectorPtr applyArray(
       const SelectivityVector& rows,
       std::vector<VectorPtr>& args,
@@ -328,37 +334,106 @@ class SubscriptImpl : public exec::VectorFunction {
     auto rawSizes = baseMap->rawSizes();
     auto rawOffsets = baseMap->rawOffsets();
 
+    // Lambda that searches the map at 'mapIndex' for 'searchKey'. Returns
+    // the element offset of the first match or -1 if the key is not
+    // present.
+    auto searchMap = [&](vector_size_t mapIndex,
+                         TKey searchKey) -> vector_size_t {
+      const vector_size_t offsetStart = rawOffsets[mapIndex];
+      const vector_size_t offsetEnd = offsetStart + rawSizes[mapIndex];
+
+      if (baseMap->hasSortedKeys()) {
+        // Keys within each map are in ascending order, e.g. the map was
+        // canonicalized; binary search.
+        auto low = offsetStart;
+        auto high = offsetEnd;
+        while (low < high) {
+          const auto mid = low + (high - low) / 2;
+          const auto midKey = decodedMapKeys->valueAt<TKey>(mid);
+          if (midKey < searchKey) {
+            low = mid + 1;
+          } else if (searchKey < midKey) {
+            high = mid;
+          } else {
+            return mid;
+          }
+        }
+        return -1;
+      }
+
+      // Sequentially check each key on this map for a match. Likely has
+      // good memory locality for small maps.
+      for (auto offset = offsetStart; offset < offsetEnd; ++offset) {
+        if (decodedMapKeys->valueAt<TKey>(offset) == searchKey) {
+          return offset;
+        }
+      }
+      return -1;
+    };
+
+    // When the same base map is probed by many rows, e.g. a constant or
+    // dictionary encoded map argument, build a hash index over the keys
+    // of each probed map once and amortize its construction across the
+    // rows.
+    const bool useKeyIndex = !baseMap->hasSortedKeys() &&
+        !decodedMap->isIdentityMapping() &&
+        baseMap->size() < rows.countSelected();
+    folly::F14FastMap<vector_size_t, folly::F14FastMap<TKey, vector_size_t>>
+        keyIndices;
+
     // Lambda that does the search for a key, for each row.
     auto processRow = [&](vector_size_t row, TKey searchKey) {
-      size_t mapIndex = mapIndices[row];
-      size_t offsetStart = rawOffsets[mapIndex];
-      size_t offsetEnd = offsetStart + rawSizes[mapIndex];
-      bool found = false;
-
-      // Sequentially check each key on this map for a match. We use a
-      // sequential scan over the keys because it's easier to express (and
-      // likely has good memory locality), but if we find that this is slow
-      // for large maps we could try to canonicalize the whole vector and binary
-      // search `searchKey`.
-      for (size_t offset = offsetStart; offset < offsetEnd; ++offset) {
-        if (decodedMapKeys->valueAt<TKey>(offset) == searchKey) {
-          rawIndices[row] = offset;
-          found = true;
-          break;
+      const vector_size_t mapIndex = mapIndices[row];
+      vector_size_t foundOffset = -1;
+
+      if (useKeyIndex && rawSizes[mapIndex] >= kMinMapSizeForKeyIndex) {
+        auto [it, inserted] = keyIndices.try_emplace(mapIndex);
+        auto& keyIndex = it->second;
+        if (inserted) {
+          const vector_size_t offsetStart = rawOffsets[mapIndex];
+          const vector_size_t offsetEnd = offsetStart + rawSizes[mapIndex];
+          keyIndex.reserve(rawSizes[mapIndex]);
+          // Iterate backwards so that the first occurrence of a
+          // duplicate key wins, matching the sequential search.
+          for (auto offset = offsetEnd - 1; offset >= offsetStart; --offset) {
+            keyIndex[decodedMapKeys->valueAt<TKey>(offset)] = offset;
+          }
+        }
+        auto keyIt = keyIndex.find(searchKey);
+        if (keyIt != keyIndex.end()) {
+          foundOffset = keyIt->second;
         }
+      } else {
+        foundOffset = searchMap(mapIndex, searchKey);
       }
 
       // NB: We still allow non-existent map keys, even if out of bounds is
       // disabled for arrays.
 
       // Handle NULLs.
-      if (!found) {
+      if (foundOffset == -1) {
         nullsBuilder.setNull(row);
+      } else {
+        rawIndices[row] = foundOffset;
       }
     };
 
+    // When both the map and the key are constants, search once and reuse
+    // the result for all rows.
+    if (decodedMap->isConstantMapping() &&
+        decodedIndices->isConstantMapping()) {
+      const auto foundOffset =
+          searchMap(mapIndices[rows.begin()], decodedIndices->valueAt<TKey>(0));
+      if (foundOffset == -1) {
+        rows.applyToSelected(
+            [&](vector_size_t row) { nullsBuilder.setNull(row); });
+      } else {
+        rows.applyToSelected(
+            [&](vector_size_t row) { rawIndices[row] = foundOffset; });
+      }
+    }
     // When second argument ("at") is a constant.
-    if (decodedIndices->isConstantMapping()) {
+    else if (decodedIndices->isConstantMapping()) {
       auto searchKey = decodedIndices->valueAt<TKey>(0);
       rows.applyToSelected(
           [&](vector_size_t row) { processRow(row, searchKey); });
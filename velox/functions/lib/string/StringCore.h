@@ -20,6 +20,7 @@
 #include <string_view>
 #include "folly/CPortability.h"
 #include "velox/common/base/Exceptions.h"
+#include "velox/common/base/SimdUtil.h"
 #include "velox/external/utf8proc/utf8procImpl.h"
 
 #if (ENABLE_VECTORIZATION > 0) && !defined(_DEBUG) && !defined(DEBUG)
@@ -48,8 +49,19 @@ namespace stringCore {
 static bool isAscii(const char* str, size_t length);
 
 FOLLY_ALWAYS_INLINE bool isAscii(const char* str, size_t length) {
-  for (auto i = 0; i < length; i++) {
-    if (str[i] & 0x80) {
+  const auto* data = reinterpret_cast<const uint8_t*>(str);
+  constexpr size_t kBatchBytes = xsimd::batch<uint8_t>::size;
+  const auto highBit = xsimd::batch<uint8_t>::broadcast(0x80);
+  size_t i = 0;
+  // Check the high bit of a vector width of bytes at a time.
+  for (; i + kBatchBytes <= length; i += kBatchBytes) {
+    const auto batch = xsimd::batch<uint8_t>::load_unaligned(data + i);
+    if (simd::toBitMask((batch & highBit) == highBit) != 0) {
+      return false;
+    }
+  }
+  for (; i < length; i++) {
+    if (data[i] & 0x80) {
       return false;
     }
   }
@@ -217,15 +229,25 @@ applyAppendersRecursive(TOutStr& output, Func appenderFunc, Funcs... funcs) {
  */
 FOLLY_ALWAYS_INLINE int64_t
 lengthUnicode(const char* inputBuffer, size_t bufferLength) {
-  // First address after the last byte in the buffer
-  auto buffEndAddress = inputBuffer + bufferLength;
-  auto currentChar = inputBuffer;
+  // A character starts at every byte that is not a UTF-8 continuation
+  // byte (10xxxxxx), so the length is the count of such bytes. Count a
+  // vector width of bytes at a time, then finish the tail byte by byte.
+  const auto* data = reinterpret_cast<const uint8_t*>(inputBuffer);
+  constexpr size_t kBatchBytes = xsimd::batch<uint8_t>::size;
+  const auto continuationMask = xsimd::batch<uint8_t>::broadcast(0xC0);
+  const auto continuationTag = xsimd::batch<uint8_t>::broadcast(0x80);
+  size_t i = 0;
   int64_t size = 0;
-  while (currentChar < buffEndAddress) {
-    auto chrOffset = utf8proc_char_length(currentChar);
-    // Skip bad byte if we get utf length < 0.
-    currentChar += UNLIKELY(chrOffset < 0) ? 1 : chrOffset;
-    size++;
+  for (; i + kBatchBytes <= bufferLength; i += kBatchBytes) {
+    const auto batch = xsimd::batch<uint8_t>::load_unaligned(data + i);
+    const auto continuations =
+        simd::toBitMask((batch & continuationMask) == continuationTag);
+    size += kBatchBytes - __builtin_popcountll(continuations);
+  }
+  for (; i < bufferLength; i++) {
+    if ((data[i] & 0xC0) != 0x80) {
+      size++;
+    }
   }
   return size;
 }
@@ -396,12 +418,16 @@ inline static size_t replace(
   return writePosition;
 }
 
-/// Given a utf8 string, a starting position and length returns the
-/// corresponding underlying byte range [startByteIndex, endByteIndex).
-/// Byte indicies starts from 0, UTF8 character positions starts from 1.
+/// Given a utf8 string of 'strLength' bytes, a starting position and length
+/// returns the corresponding underlying byte range [startByteIndex,
+/// endByteIndex). Byte indicies starts from 0, UTF8 character positions
+/// starts from 1.
 template <bool isAscii>
-static inline std::pair<size_t, size_t>
-getByteRange(const char* str, size_t startCharPosition, size_t length) {
+static inline std::pair<size_t, size_t> getByteRange(
+    const char* str,
+    size_t strLength,
+    size_t startCharPosition,
+    size_t length) {
   if (startCharPosition < 1 && length > 0) {
     throw std::invalid_argument(
         "start position must be >= 1 and length must be > 0");
@@ -410,22 +436,52 @@ getByteRange(const char* str, size_t startCharPosition, size_t length) {
     return std::make_pair(
         startCharPosition - 1, startCharPosition + length - 1);
   } else {
-    size_t startByteIndex = 0;
-    size_t nextCharOffset = 0;
-
-    // Find startByteIndex
-    for (auto i = 0; i < startCharPosition - 1; i++) {
-      nextCharOffset += utf8proc_char_length(&str[nextCharOffset]);
-    }
-
-    startByteIndex = nextCharOffset;
-
-    // Find endByteIndex
-    for (auto i = 0; i < length; i++) {
-      nextCharOffset += utf8proc_char_length(&str[nextCharOffset]);
-    }
+    const auto* data = reinterpret_cast<const uint8_t*>(str);
+    constexpr size_t kBatchBytes = xsimd::batch<uint8_t>::size;
+    const auto continuationMask = xsimd::batch<uint8_t>::broadcast(0xC0);
+    const auto continuationTag = xsimd::batch<uint8_t>::broadcast(0x80);
+
+    // Returns the byte offset of the character boundary 'numChars'
+    // characters after the boundary at 'offset'. Character starts are
+    // counted a vector width of bytes at a time.
+    auto advance = [&](size_t offset, size_t numChars) -> size_t {
+      for (;;) {
+        // Land on the next character start.
+        while (offset < strLength && (data[offset] & 0xC0) == 0x80) {
+          ++offset;
+        }
+        if (numChars == 0 || offset >= strLength) {
+          return offset;
+        }
+        if (offset + kBatchBytes <= strLength) {
+          const auto batch =
+              xsimd::batch<uint8_t>::load_unaligned(data + offset);
+          uint64_t starts = ~static_cast<uint64_t>(simd::toBitMask(
+              (batch & continuationMask) == continuationTag));
+          if constexpr (kBatchBytes < 64) {
+            starts &= (1ULL << kBatchBytes) - 1;
+          }
+          const size_t numStarts = __builtin_popcountll(starts);
+          if (numStarts <= numChars) {
+            // All starts in the block are passed; the boundary is further.
+            numChars -= numStarts;
+            offset += kBatchBytes;
+            continue;
+          }
+          // Clear the first 'numChars' starts; the boundary is the next one.
+          for (size_t j = 0; j < numChars; ++j) {
+            starts &= starts - 1;
+          }
+          return offset + __builtin_ctzll(starts);
+        }
+        ++offset;
+        --numChars;
+      }
+    };
 
-    return std::make_pair(startByteIndex, nextCharOffset);
+    const size_t startByteIndex = advance(0, startCharPosition - 1);
+    const size_t endByteIndex = advance(startByteIndex, length);
+    return std::make_pair(startByteIndex, endByteIndex);
   }
 }
 } // namespace stringCore
@@ -73,6 +73,23 @@ TEST(ApproxMostFrequentStreamSummaryTest, exactRandom) {
   EXPECT_EQ(topK.size() + std::count(freq + 1, freq + M + 1, 0), M);
 }
 
+TEST(ApproxMostFrequentStreamSummaryTest, batchInsert) {
+  constexpr int M = 100;
+  ApproxMostFrequentStreamSummary<int> summary;
+  ApproxMostFrequentStreamSummary<int> summary2;
+  summary.setCapacity(M);
+  summary2.setCapacity(M);
+  std::vector<int> values(10'000);
+  ZetaDistribution dist(1.02, 1000);
+  std::default_random_engine gen(0);
+  for (auto& v : values) {
+    v = dist(gen);
+    summary.insert(v);
+  }
+  summary2.insert(folly::Range(values.data(), values.size()));
+  EXPECT_EQ(summary.topK(M), summary2.topK(M));
+}
+
 TEST(ApproxMostFrequentStreamSummaryTest, approx) {
   constexpr int kCardinality = 1000;
   constexpr double kAlpha = 1.01;
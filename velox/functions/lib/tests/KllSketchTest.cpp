@@ -103,6 +103,28 @@ TEST(KllSketchTest, estimationMode) {
   }
 }
 
+TEST(KllSketchTest, batchInsert) {
+  constexpr int N = 1e5;
+  constexpr int M = 1001;
+  KllSketch<double> kll(kDefaultK, {}, 0);
+  KllSketch<double> kll2(kDefaultK, {}, 0);
+  std::vector<double> values(N);
+  std::default_random_engine gen(0);
+  std::normal_distribution<> dist;
+  for (int i = 0; i < N; ++i) {
+    values[i] = dist(gen);
+    kll.insert(values[i]);
+  }
+  kll2.insert(folly::Range(values.data(), values.size()));
+  EXPECT_EQ(kll2.totalCount(), N);
+  kll.finish();
+  kll2.finish();
+  auto q = linspace(M);
+  auto v = kll.estimateQuantiles(folly::Range(q.begin(), q.end()));
+  auto v2 = kll2.estimateQuantiles(folly::Range(q.begin(), q.end()));
+  EXPECT_EQ(v, v2);
+}
+
 TEST(KllSketchTest, randomInput) {
   constexpr int N = 1e5;
   constexpr int M = 1001;
@@ -439,6 +439,13 @@ TEST_F(Re2FunctionsTest, likeDeterminePatternKind) {
   testPattern("%%_%aBcD", PatternKind::kGeneric, 0);
   testPattern("%%a%%BcD", PatternKind::kGeneric, 0);
   testPattern("foo%bar", PatternKind::kGeneric, 0);
+
+  testPattern("%presto%", PatternKind::kSubstring, 6);
+  testPattern("%%hello%%%", PatternKind::kSubstring, 5);
+  testPattern("%a%", PatternKind::kSubstring, 1);
+  testPattern("%%%helloPrestoWorld%%", PatternKind::kSubstring, 16);
+  testPattern("%_aBcD%", PatternKind::kGeneric, 0);
+  testPattern("%aBcD_%", PatternKind::kGeneric, 0);
 }
 
 TEST_F(Re2FunctionsTest, likePatternWildcard) {
@@ -592,6 +599,36 @@ TEST_F(Re2FunctionsTest, likePatternSuffix) {
   EXPECT_TRUE(like(input, generateString(kAnyWildcardCharacter) + input));
 }
 
+TEST_F(Re2FunctionsTest, likePatternSubstring) {
+  auto like = [&](std::string str, std::string pattern) {
+    auto likeResult = evaluateOnce<bool>(
+        fmt::format("like(c0, '{}')", pattern), std::make_optional(str));
+    VELOX_CHECK(likeResult, "Like operator evaluation failed");
+    return *likeResult;
+  };
+
+  EXPECT_TRUE(like("abcde", "%bcd%"));
+  EXPECT_TRUE(like("ABCDE", "%BCD%"));
+  EXPECT_TRUE(like("abcde", "%%cde%%"));
+  EXPECT_TRUE(like("abcde", "%abcde%"));
+  EXPECT_TRUE(like("abcde", "%a%"));
+  EXPECT_TRUE(like("abcde", "%%e%%%"));
+  EXPECT_FALSE(like("", "%a%"));
+  EXPECT_FALSE(like("abcde", "%bcq%"));
+  EXPECT_FALSE(like("ABCDE", "%bcd%"));
+  EXPECT_FALSE(like("abcde", "%%abcdef%%"));
+  EXPECT_FALSE(like("abcde", "%ce%"));
+  EXPECT_TRUE(like("\nabc\nde\n", "%c\nd%"));
+  EXPECT_TRUE(like("\nabc\tde\b", "%c\td%"));
+  EXPECT_FALSE(like("\nabcde\n", "%c\nd%"));
+
+  std::string input = generateString(kLikePatternCharacterSet, 65);
+  EXPECT_TRUE(like(
+      input,
+      generateString(kAnyWildcardCharacter) + input +
+          generateString(kAnyWildcardCharacter)));
+}
+
 TEST_F(Re2FunctionsTest, likePatternAndEscape) {
   auto like = ([&](std::optional<std::string> str,
                    std::optional<std::string> pattern,
@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "velox/common/base/SimdUtil.h"
 #include "velox/expression/VectorFunction.h"
 #include "velox/vector/DecodedVector.h"
 
@@ -43,8 +44,24 @@ void applyTyped(
     rows.applyToSelected([&](auto row) {
       auto size = rawSizes[indices[row]];
       auto offset = rawOffsets[indices[row]];
+      vector_size_t i = 0;
+
+      if constexpr (std::is_arithmetic_v<T> && sizeof(T) <= 8) {
+        // Compare a full SIMD batch of elements against the search value
+        // at a time.
+        constexpr int32_t kWidth = xsimd::batch<T>::size;
+        const auto searchBatch = xsimd::broadcast<T>(search);
+        for (; i + kWidth <= size; i += kWidth) {
+          auto data =
+              xsimd::batch<T>::load_unaligned(rawElements + offset + i);
+          if (simd::toBitMask(data == searchBatch)) {
+            flatResult.set(row, true);
+            return;
+          }
+        }
+      }
 
-      for (auto i = 0; i < size; i++) {
+      for (; i < size; i++) {
         if (rawElements[offset + i] == search) {
           flatResult.set(row, true);
           return;
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/common/base/SimdUtil.h"
+#include "velox/expression/EvalCtx.h"
+#include "velox/expression/VectorFunction.h"
+
+namespace facebook::velox::functions {
+namespace {
+
+/// Implements array_min and array_max for arrays of numeric primitives,
+/// running directly over the raw elements buffer. Arrays of other types
+/// keep the generic simple function implementation in ArrayFunctions.h.
+/// The result is null for empty arrays and for arrays containing a null
+/// element.
+template <typename T, bool isMax>
+class ArrayMinMaxFunction : public exec::VectorFunction {
+ public:
+  void apply(
+      const SelectivityVector& rows,
+      std::vector<VectorPtr>& args,
+      const TypePtr& outputType,
+      exec::EvalCtx& context,
+      VectorPtr& result) const override {
+    exec::LocalDecodedVector arrayHolder(context, *args[0], rows);
+    auto decodedArray = arrayHolder.get();
+    auto baseArray = decodedArray->base()->as<ArrayVector>();
+    auto arrayIndices = decodedArray->indices();
+    auto rawSizes = baseArray->rawSizes();
+    auto rawOffsets = baseArray->rawOffsets();
+
+    context.ensureWritable(rows, outputType, result);
+    auto flatResult = result->asFlatVector<T>();
+
+    const auto& elementsVector = baseArray->elements();
+    if (elementsVector->isFlatEncoding() && !elementsVector->mayHaveNulls()) {
+      const T* __restrict rawElements =
+          elementsVector->asUnchecked<FlatVector<T>>()->rawValues();
+
+      rows.applyToSelected([&](vector_size_t row) {
+        auto size = rawSizes[arrayIndices[row]];
+        if (size == 0) {
+          flatResult->setNull(row, true);
+        } else {
+          flatResult->set(
+              row, reduce(rawElements + rawOffsets[arrayIndices[row]], size));
+        }
+      });
+      return;
+    }
+
+    exec::LocalSelectivityVector elementsRows(context, elementsVector->size());
+    elementsRows.get()->setAll();
+    exec::LocalDecodedVector elementsHolder(
+        context, *elementsVector, *elementsRows.get());
+    auto elements = elementsHolder.get();
+
+    rows.applyToSelected([&](vector_size_t row) {
+      auto size = rawSizes[arrayIndices[row]];
+      auto offset = rawOffsets[arrayIndices[row]];
+      if (size == 0 || elements->isNullAt(offset)) {
+        flatResult->setNull(row, true);
+        return;
+      }
+      auto current = elements->valueAt<T>(offset);
+      for (vector_size_t i = 1; i < size; ++i) {
+        if (elements->isNullAt(offset + i)) {
+          flatResult->setNull(row, true);
+          return;
+        }
+        update(current, elements->valueAt<T>(offset + i));
+      }
+      flatResult->set(row, current);
+    });
+  }
+
+ private:
+  static void update(T& current, T candidate) {
+    if constexpr (isMax) {
+      if (candidate > current) {
+        current = candidate;
+      }
+    } else {
+      if (candidate < current) {
+        current = candidate;
+      }
+    }
+  }
+
+  // Reduces 'size' contiguous values to their minimum or maximum.
+  // Integer types use SIMD accumulation; floating point keeps the
+  // sequential comparison order so that NaN handling is unchanged.
+  static T reduce(const T* __restrict values, vector_size_t size) {
+    T current = values[0];
+    vector_size_t i = 1;
+    if constexpr (std::is_integral_v<T>) {
+      constexpr int32_t kWidth = xsimd::batch<T>::size;
+      if (size >= kWidth) {
+        auto accumulator = xsimd::batch<T>::load_unaligned(values);
+        i = kWidth;
+        for (; i + kWidth <= size; i += kWidth) {
+          auto data = xsimd::batch<T>::load_unaligned(values + i);
+          if constexpr (isMax) {
+            accumulator = xsimd::max(accumulator, data);
+          } else {
+            accumulator = xsimd::min(accumulator, data);
+          }
+        }
+        T lanes[kWidth];
+        accumulator.store_unaligned(lanes);
+        current = lanes[0];
+        for (int32_t lane = 1; lane < kWidth; ++lane) {
+          update(current, lanes[lane]);
+        }
+      }
+    }
+    for (; i < size; ++i) {
+      update(current, values[i]);
+    }
+    return current;
+  }
+};
+
+template <bool isMax>
+std::shared_ptr<exec::VectorFunction> create(
+    const std::string& /* name */,
+    const std::vector<exec::VectorFunctionArg>& inputArgs) {
+  auto elementType = inputArgs.front().type->childAt(0);
+  switch (elementType->kind()) {
+    case TypeKind::TINYINT:
+      return std::make_shared<ArrayMinMaxFunction<int8_t, isMax>>();
+    case TypeKind::SMALLINT:
+      return std::make_shared<ArrayMinMaxFunction<int16_t, isMax>>();
+    case TypeKind::INTEGER:
+      return std::make_shared<ArrayMinMaxFunction<int32_t, isMax>>();
+    case TypeKind::BIGINT:
+      return std::make_shared<ArrayMinMaxFunction<int64_t, isMax>>();
+    case TypeKind::REAL:
+      return std::make_shared<ArrayMinMaxFunction<float, isMax>>();
+    case TypeKind::DOUBLE:
+      return std::make_shared<ArrayMinMaxFunction<double, isMax>>();
+    default:
+      VELOX_FAIL(
+          "Unsupported element type for array_min/array_max: {}",
+          elementType->toString());
+  }
+}
+
+// array(T) -> T for numeric T. Other element types do not match these
+// signatures and resolve to the simple function instead.
+std::vector<std::shared_ptr<exec::FunctionSignature>> signatures() {
+  static const std::vector<std::string> kSupportedTypes = {
+      "tinyint", "smallint", "integer", "bigint", "real", "double"};
+  std::vector<std::shared_ptr<exec::FunctionSignature>> signatures;
+  signatures.reserve(kSupportedTypes.size());
+  for (const auto& type : kSupportedTypes) {
+    signatures.emplace_back(exec::FunctionSignatureBuilder()
+                                .returnType(type)
+                                .argumentType(fmt::format("array({})", type))
+                                .build());
+  }
+  return signatures;
+}
+
+} // namespace
+
+VELOX_DECLARE_STATEFUL_VECTOR_FUNCTION(
+    udf_array_min,
+    signatures(),
+    create<false>);
+
+VELOX_DECLARE_STATEFUL_VECTOR_FUNCTION(
+    udf_array_max,
+    signatures(),
+    create<true>);
+
+} // namespace facebook::velox::functions
@@ -44,9 +44,13 @@ class ArraySumFunction : public exec::VectorFunction {
     TOutput sum = 0;
 
     auto addElement = [](TOutput& sum, TInput value) {
-      if constexpr (std::is_same_v<TOutput, int64_t>) {
+      if constexpr (
+          std::is_same_v<TOutput, int64_t> && std::is_same_v<TInput, int64_t>) {
         sum = checkedPlus<TOutput>(sum, value);
       } else {
+        // A sum of at most 2^31 values no wider than 32 bits cannot
+        // overflow int64, so skip the overflow check and leave the loop
+        // free to vectorize.
         sum += value;
       }
     };
@@ -24,6 +24,7 @@
 #include "folly/ssl/OpenSSLHash.h"
 #pragma GCC diagnostic pop
 #include "velox/common/base/BitUtil.h"
+#include "velox/common/base/SimdUtil.h"
 #include "velox/common/encode/Base64.h"
 #include "velox/external/md5/md5.h"
 #include "velox/functions/Udf.h"
@@ -246,7 +247,33 @@ struct ToHexFunction {
         reinterpret_cast<const unsigned char*>(input.data());
     char* resultBuffer = result.data();
 
-    for (auto i = 0; i < inputSize; ++i) {
+    size_t i = 0;
+#if XSIMD_WITH_AVX2
+    // Expands 16 input bytes to 32 hex characters per step by looking
+    // up each nibble in a shuffle table.
+    const __m256i hexLut = _mm256_setr_epi8(
+        // clang-format off
+        '0', '1', '2', '3', '4', '5', '6', '7',
+        '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',
+        '0', '1', '2', '3', '4', '5', '6', '7',
+        '8', '9', 'A', 'B', 'C', 'D', 'E', 'F');
+    // clang-format on
+    for (; i + 16 <= inputSize; i += 16) {
+      const __m256i bytes = _mm256_cvtepu8_epi16(
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(inputBuffer + i)));
+      // Each 16-bit element holds one input byte; place the high nibble
+      // in its low byte and the low nibble in its high byte so the hex
+      // digits come out in order.
+      const __m256i nibbles = _mm256_or_si256(
+          _mm256_srli_epi16(bytes, 4),
+          _mm256_slli_epi16(
+              _mm256_and_si256(bytes, _mm256_set1_epi16(0x0f)), 8));
+      _mm256_storeu_si256(
+          reinterpret_cast<__m256i*>(resultBuffer + i * 2),
+          _mm256_shuffle_epi8(hexLut, nibbles));
+    }
+#endif
+    for (; i < inputSize; ++i) {
       resultBuffer[i * 2] = kHexTable[inputBuffer[i] * 2];
       resultBuffer[i * 2 + 1] = kHexTable[inputBuffer[i] * 2 + 1];
     }
@@ -288,7 +315,49 @@ struct FromHexFunction {
     const char* inputBuffer = input.data();
     char* resultBuffer = result.data();
 
-    for (auto i = 0; i < resultSize; ++i) {
+    size_t i = 0;
+#if XSIMD_WITH_AVX2
+    // Converts 32 hex characters to 16 bytes per step. A character
+    // outside [0-9A-Fa-f] stops the fast path and is reported by the
+    // scalar loop below.
+    while (i + 16 <= resultSize) {
+      const __m256i chars = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i*>(inputBuffer + i * 2));
+      const __m256i digit = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+      const __m256i isDigit = _mm256_and_si256(
+          _mm256_cmpgt_epi8(_mm256_set1_epi8(10), digit),
+          _mm256_cmpgt_epi8(digit, _mm256_set1_epi8(-1)));
+      const __m256i alpha = _mm256_sub_epi8(
+          _mm256_or_si256(chars, _mm256_set1_epi8(0x20)),
+          _mm256_set1_epi8('a'));
+      const __m256i isAlpha = _mm256_and_si256(
+          _mm256_cmpgt_epi8(_mm256_set1_epi8(6), alpha),
+          _mm256_cmpgt_epi8(alpha, _mm256_set1_epi8(-1)));
+      if (_mm256_movemask_epi8(_mm256_or_si256(isDigit, isAlpha)) != -1) {
+        break;
+      }
+
+      const __m256i values = _mm256_blendv_epi8(
+          _mm256_add_epi8(alpha, _mm256_set1_epi8(10)), digit, isDigit);
+      // Combine nibble pairs into bytes and compact the 16 result bytes
+      // of the two lanes to the front.
+      const __m256i merged =
+          _mm256_maddubs_epi16(values, _mm256_set1_epi16(0x0110));
+      __m256i packed = _mm256_shuffle_epi8(
+          merged,
+          _mm256_setr_epi8(
+              // clang-format off
+              0, 2, 4, 6, 8, 10, 12, 14, -1, -1, -1, -1, -1, -1, -1, -1,
+              0, 2, 4, 6, 8, 10, 12, 14, -1, -1, -1, -1, -1, -1, -1, -1));
+      // clang-format on
+      packed = _mm256_permute4x64_epi64(packed, 0x08);
+      _mm_storeu_si128(
+          reinterpret_cast<__m128i*>(resultBuffer + i),
+          _mm256_castsi256_si128(packed));
+      i += 16;
+    }
+#endif
+    for (; i < resultSize; ++i) {
       resultBuffer[i] =
           (fromHex(inputBuffer[i * 2]) << 4) | fromHex(inputBuffer[i * 2 + 1]);
     }
@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "velox/functions/prestosql/CheckedArithmetic.h"
+#include "velox/common/base/SimdUtil.h"
+#include "velox/functions/Udf.h"
+#include "velox/vector/BaseVector.h"
+
+namespace facebook::velox::functions {
+
+namespace {
+
+// Checked add, subtract and multiply for integer vectors with deferred
+// overflow checks. The unchecked results are computed branch-free, for
+// add and subtract with SIMD where overflown lanes are detected from the
+// operand and result signs. Only when some lane overflowed is the
+// throwing scalar path rerun to raise the error for the exact row. This
+// keeps the hot path vectorized while overflow, which essentially never
+// happens, still produces the same per-row error.
+struct CheckedPlusOp {
+  static constexpr bool kUseSimd = true;
+
+  template <typename T>
+  static xsimd::batch<T> applySimd(
+      xsimd::batch<T> a,
+      xsimd::batch<T> b,
+      xsimd::batch<T>& overflow) {
+    auto result = a + b;
+    // Signed addition overflows iff the operands have the same sign and
+    // the sum's sign differs from it.
+    overflow = overflow | (~(a ^ b) & (a ^ result));
+    return result;
+  }
+
+  template <typename T>
+  static bool apply(T a, T b, T& result) {
+    return __builtin_add_overflow(a, b, &result);
+  }
+
+  template <typename T>
+  static T applyChecked(T a, T b) {
+    return velox::checkedPlus(a, b);
+  }
+};
+
+struct CheckedMinusOp {
+  static constexpr bool kUseSimd = true;
+
+  template <typename T>
+  static xsimd::batch<T> applySimd(
+      xsimd::batch<T> a,
+      xsimd::batch<T> b,
+      xsimd::batch<T>& overflow) {
+    auto result = a - b;
+    // Signed subtraction overflows iff the operands have different signs
+    // and the difference's sign differs from the minuend's.
+    overflow = overflow | ((a ^ b) & (a ^ result));
+    return result;
+  }
+
+  template <typename T>
+  static bool apply(T a, T b, T& result) {
+    return __builtin_sub_overflow(a, b, &result);
+  }
+
+  template <typename T>
+  static T applyChecked(T a, T b) {
+    return velox::checkedMinus(a, b);
+  }
+};
+
+struct CheckedMultiplyOp {
+  // There is no sign trick for multiplication. The win comes from
+  // accumulating the overflow flags branch-free instead of testing and
+  // throwing per element.
+  static constexpr bool kUseSimd = false;
+
+  template <typename T>
+  static bool apply(T a, T b, T& result) {
+    return __builtin_mul_overflow(a, b, &result);
+  }
+
+  template <typename T>
+  static T applyChecked(T a, T b) {
+    return velox::checkedMultiply(a, b);
+  }
+};
+
+template <typename Op, typename Arch = xsimd::default_arch>
+struct SimdCheckedArithmetic {
+  template <typename T, bool isConstant>
+  inline auto loadSimdData(const T* rawData, vector_size_t offset) {
+    using d_type = xsimd::batch<T>;
+    if constexpr (isConstant) {
+      return xsimd::broadcast<T>(rawData[0]);
+    }
+    return d_type::load_unaligned(rawData + offset);
+  }
+
+  // Fills 'rawResult' with the unchecked results for [begin, end) and
+  // returns true if any element overflowed.
+  template <typename T, bool isLeftConstant, bool isRightConstant>
+  bool applyBatch(
+      const vector_size_t begin,
+      const vector_size_t end,
+      const T* rawLhs,
+      const T* rawRhs,
+      T* rawResult) {
+    bool anyOverflow = false;
+    vector_size_t i = begin;
+    if constexpr (Op::kUseSimd) {
+      using d_type = xsimd::batch<T>;
+      constexpr auto kWidth = d_type::size;
+      d_type overflow(static_cast<T>(0));
+      for (; i + kWidth <= end; i += kWidth) {
+        auto left = loadSimdData<T, isLeftConstant>(rawLhs, i);
+        auto right = loadSimdData<T, isRightConstant>(rawRhs, i);
+        Op::applySimd(left, right, overflow).store_unaligned(rawResult + i);
+      }
+      anyOverflow =
+          simd::toBitMask(overflow < d_type(static_cast<T>(0))) != 0;
+    }
+    for (; i < end; ++i) {
+      anyOverflow |= Op::apply(
+          rawLhs[isLeftConstant ? 0 : i],
+          rawRhs[isRightConstant ? 0 : i],
+          rawResult[i]);
+    }
+    return anyOverflow;
+  }
+
+  template <
+      TypeKind kind,
+      typename std::enable_if_t<
+          std::is_integral_v<typename TypeTraits<kind>::NativeType> &&
+              kind != TypeKind::BOOLEAN && kind != TypeKind::HUGEINT,
+          int> = 0>
+  void applyArithmetic(
+      const SelectivityVector& rows,
+      BaseVector& lhs,
+      BaseVector& rhs,
+      exec::EvalCtx& context,
+      VectorPtr& result) {
+    using T = typename TypeTraits<kind>::NativeType;
+
+    auto* resultVector = result->asUnchecked<FlatVector<T>>();
+
+    const auto applyCheckedScalar = [&]() {
+      exec::LocalDecodedVector lhsDecoded(context, lhs, rows);
+      exec::LocalDecodedVector rhsDecoded(context, rhs, rows);
+      context.applyToSelectedNoThrow(rows, [&](auto row) {
+        if (lhsDecoded->isNullAt(row) || rhsDecoded->isNullAt(row)) {
+          resultVector->setNull(row, true);
+          return;
+        }
+        resultVector->set(
+            row,
+            Op::applyChecked(
+                lhsDecoded->template valueAt<T>(row),
+                rhsDecoded->template valueAt<T>(row)));
+      });
+    };
+
+    const auto isSimdizable =
+        (lhs.isConstantEncoding() || lhs.isFlatEncoding()) &&
+        (rhs.isConstantEncoding() || rhs.isFlatEncoding()) &&
+        !lhs.mayHaveNulls() && !rhs.mayHaveNulls() && rows.isAllSelected();
+    if (!isSimdizable) {
+      applyCheckedScalar();
+      return;
+    }
+
+    auto* rawResult = resultVector->mutableRawValues();
+    bool overflow;
+    if (lhs.isConstantEncoding() && rhs.isConstantEncoding()) {
+      auto l = lhs.asUnchecked<ConstantVector<T>>()->valueAt(0);
+      auto r = rhs.asUnchecked<ConstantVector<T>>()->valueAt(0);
+      overflow =
+          applyBatch<T, true, true>(rows.begin(), rows.end(), &l, &r, rawResult);
+    } else if (lhs.isConstantEncoding()) {
+      auto l = lhs.asUnchecked<ConstantVector<T>>()->valueAt(0);
+      auto rawRhs = rhs.asUnchecked<FlatVector<T>>()->rawValues();
+      overflow = applyBatch<T, true, false>(
+          rows.begin(), rows.end(), &l, rawRhs, rawResult);
+    } else if (rhs.isConstantEncoding()) {
+      auto rawLhs = lhs.asUnchecked<FlatVector<T>>()->rawValues();
+      auto r = rhs.asUnchecked<ConstantVector<T>>()->valueAt(0);
+      overflow = applyBatch<T, false, true>(
+          rows.begin(), rows.end(), rawLhs, &r, rawResult);
+    } else {
+      auto rawLhs = lhs.asUnchecked<FlatVector<T>>()->rawValues();
+      auto rawRhs = rhs.asUnchecked<FlatVector<T>>()->rawValues();
+      overflow = applyBatch<T, false, false>(
+          rows.begin(), rows.end(), rawLhs, rawRhs, rawResult);
+    }
+    resultVector->clearNulls(rows);
+
+    if (UNLIKELY(overflow)) {
+      // Some lane overflowed. Rerun the throwing scalar path to raise
+      // the error for the exact rows, which also honors TRY.
+      applyCheckedScalar();
+    }
+  }
+
+  template <
+      TypeKind kind,
+      typename std::enable_if_t<
+          !std::is_integral_v<typename TypeTraits<kind>::NativeType> ||
+              kind == TypeKind::BOOLEAN || kind == TypeKind::HUGEINT,
+          int> = 0>
+  void applyArithmetic(
+      const SelectivityVector& /* rows */,
+      BaseVector& /* lhs */,
+      BaseVector& /* rhs */,
+      exec::EvalCtx& /* context */,
+      VectorPtr& /* result */) {
+    VELOX_UNSUPPORTED("Unsupported type for SIMD checked arithmetic");
+  }
+};
+
+template <typename Op>
+class CheckedArithmeticSimdFunction : public exec::VectorFunction {
+ public:
+  void apply(
+      const SelectivityVector& rows,
+      std::vector<VectorPtr>& args,
+      const TypePtr& outputType,
+      exec::EvalCtx& context,
+      VectorPtr& result) const override {
+    VELOX_CHECK_EQ(args.size(), 2, "Checked arithmetic requires 2 arguments");
+    VELOX_CHECK_EQ(args[0]->typeKind(), args[1]->typeKind());
+
+    context.ensureWritable(rows, outputType, result);
+    auto arithmetic = SimdCheckedArithmetic<Op>{};
+
+    VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH(
+        arithmetic.template applyArithmetic,
+        args[0]->typeKind(),
+        rows,
+        *args[0],
+        *args[1],
+        context,
+        result);
+  }
+
+  static std::vector<std::shared_ptr<exec::FunctionSignature>> signatures() {
+    std::vector<std::shared_ptr<exec::FunctionSignature>> signatures;
+    for (const auto& inputType :
+         {"tinyint", "smallint", "integer", "bigint"}) {
+      signatures.push_back(exec::FunctionSignatureBuilder()
+                               .returnType(inputType)
+                               .argumentType(inputType)
+                               .argumentType(inputType)
+                               .build());
+    }
+    return signatures;
+  }
+
+  bool supportsFlatNoNullsFastPath() const override {
+    return true;
+  }
+};
+
+} // namespace
+
+VELOX_DECLARE_VECTOR_FUNCTION(
+    udf_simd_checked_plus,
+    (CheckedArithmeticSimdFunction<CheckedPlusOp>::signatures()),
+    (std::make_unique<CheckedArithmeticSimdFunction<CheckedPlusOp>>()));
+
+VELOX_DECLARE_VECTOR_FUNCTION(
+    udf_simd_checked_minus,
+    (CheckedArithmeticSimdFunction<CheckedMinusOp>::signatures()),
+    (std::make_unique<CheckedArithmeticSimdFunction<CheckedMinusOp>>()));
+
+VELOX_DECLARE_VECTOR_FUNCTION(
+    udf_simd_checked_multiply,
+    (CheckedArithmeticSimdFunction<CheckedMultiplyOp>::signatures()),
+    (std::make_unique<CheckedArithmeticSimdFunction<CheckedMultiplyOp>>()));
+
+} // namespace facebook::velox::functions
@@ -972,12 +972,11 @@ struct DateFormatFunction : public TimestampWithTimezoneSupport<T> {
           std::string_view(formatString.data(), formatString.size()));
     }
 
-    auto formattedResult = mysqlDateTime_->format(timestamp, sessionTimeZone_);
-    auto resultSize = formattedResult.size();
+    const auto maxResultSize = mysqlDateTime_->maxResultSize(sessionTimeZone_);
+    result.reserve(maxResultSize);
+    const auto resultSize = mysqlDateTime_->format(
+        timestamp, sessionTimeZone_, maxResultSize, result.data());
     result.resize(resultSize);
-    if (resultSize != 0) {
-      std::memcpy(result.data(), formattedResult.data(), resultSize);
-    }
     return true;
   }
 
@@ -1064,12 +1063,11 @@ struct FormatDateTimeFunction {
           std::string_view(formatString.data(), formatString.size()));
     }
 
-    auto formattedResult = jodaDateTime_->format(timestamp, sessionTimeZone_);
-    auto resultSize = formattedResult.size();
+    const auto maxResultSize = jodaDateTime_->maxResultSize(sessionTimeZone_);
+    result.reserve(maxResultSize);
+    const auto resultSize = jodaDateTime_->format(
+        timestamp, sessionTimeZone_, maxResultSize, result.data());
     result.resize(resultSize);
-    if (resultSize != 0) {
-      std::memcpy(result.data(), formattedResult.data(), resultSize);
-    }
     return true;
   }
 };
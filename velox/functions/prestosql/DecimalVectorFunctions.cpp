@@ -29,8 +29,13 @@ template <
     typename Operation /* Arithmetic operation */>
 class DecimalBaseFunction : public exec::VectorFunction {
  public:
-  DecimalBaseFunction(uint8_t aRescale, uint8_t bRescale)
-      : aRescale_(aRescale), bRescale_(bRescale) {}
+  DecimalBaseFunction(
+      uint8_t aRescale,
+      uint8_t bRescale,
+      bool needsOverflowCheck)
+      : aRescale_(aRescale),
+        bRescale_(bRescale),
+        needsOverflowCheck_(needsOverflowCheck) {}
 
   void apply(
       const SelectivityVector& rows,
@@ -39,6 +44,14 @@ class DecimalBaseFunction : public exec::VectorFunction {
       exec::EvalCtx& context,
       VectorPtr& result) const override {
     auto rawResults = prepareResults(rows, resultType, context, result);
+    if (!needsOverflowCheck_) {
+      // The result precision was not capped at the maximum, so the result and
+      // all intermediate values are bounded by the argument precisions and
+      // cannot overflow. Evaluate without per-row checks; the plain loops
+      // vectorize.
+      applyUnchecked(rows, args, context, rawResults);
+      return;
+    }
     if (args[0]->isConstantEncoding() && args[1]->isFlatEncoding()) {
       // Fast path for (const, flat).
       auto constant = args[0]->asUnchecked<SimpleVector<A>>()->valueAt(0);
@@ -84,6 +97,49 @@ class DecimalBaseFunction : public exec::VectorFunction {
   }
 
  private:
+  void applyUnchecked(
+      const SelectivityVector& rows,
+      std::vector<VectorPtr>& args,
+      exec::EvalCtx& context,
+      R* rawResults) const {
+    if (args[0]->isConstantEncoding() && args[1]->isFlatEncoding()) {
+      auto constant = args[0]->asUnchecked<SimpleVector<A>>()->valueAt(0);
+      auto rawValues =
+          args[1]->asUnchecked<FlatVector<B>>()->mutableRawValues();
+      rows.applyToSelected([&](auto row) {
+        Operation::template applyUnchecked<R, A, B>(
+            rawResults[row], constant, rawValues[row], aRescale_, bRescale_);
+      });
+    } else if (args[0]->isFlatEncoding() && args[1]->isConstantEncoding()) {
+      auto rawValues =
+          args[0]->asUnchecked<FlatVector<A>>()->mutableRawValues();
+      auto constant = args[1]->asUnchecked<SimpleVector<B>>()->valueAt(0);
+      rows.applyToSelected([&](auto row) {
+        Operation::template applyUnchecked<R, A, B>(
+            rawResults[row], rawValues[row], constant, aRescale_, bRescale_);
+      });
+    } else if (args[0]->isFlatEncoding() && args[1]->isFlatEncoding()) {
+      auto rawA = args[0]->asUnchecked<FlatVector<A>>()->mutableRawValues();
+      auto rawB = args[1]->asUnchecked<FlatVector<B>>()->mutableRawValues();
+      rows.applyToSelected([&](auto row) {
+        Operation::template applyUnchecked<R, A, B>(
+            rawResults[row], rawA[row], rawB[row], aRescale_, bRescale_);
+      });
+    } else {
+      exec::DecodedArgs decodedArgs(rows, args, context);
+      auto a = decodedArgs.at(0);
+      auto b = decodedArgs.at(1);
+      rows.applyToSelected([&](auto row) {
+        Operation::template applyUnchecked<R, A, B>(
+            rawResults[row],
+            a->valueAt<A>(row),
+            b->valueAt<B>(row),
+            aRescale_,
+            bRescale_);
+      });
+    }
+  }
+
   R* prepareResults(
       const SelectivityVector& rows,
       const TypePtr& resultType,
@@ -96,6 +152,10 @@ class DecimalBaseFunction : public exec::VectorFunction {
 
   const uint8_t aRescale_;
   const uint8_t bRescale_;
+  // False when the result precision guarantees that neither the result nor
+  // any intermediate value can overflow, in which case the unchecked kernels
+  // are used.
+  const bool needsOverflowCheck_;
 };
 
 template <
@@ -276,6 +336,30 @@ class Addition {
     DecimalUtil::valueInRange(r);
   }
 
+  // Used when needsOverflowCheck() is false: the natural result precision
+  // fits in a long decimal, so values bounded by the argument precisions
+  // cannot overflow the result type or the intermediates.
+  template <typename R, typename A, typename B>
+  inline static void applyUnchecked(
+      R& r,
+      const A& a,
+      const B& b,
+      uint8_t aRescale,
+      uint8_t bRescale) {
+    r = R(a) * R(DecimalUtil::kPowersOfTen[aRescale]) +
+        R(b) * R(DecimalUtil::kPowersOfTen[bRescale]);
+  }
+
+  inline static bool needsOverflowCheck(
+      const uint8_t aPrecision,
+      const uint8_t aScale,
+      const uint8_t bPrecision,
+      const uint8_t bScale) {
+    return std::max(aPrecision - aScale, bPrecision - bScale) +
+        std::max(aScale, bScale) + 1 >
+        LongDecimalType::kMaxPrecision;
+  }
+
   inline static uint8_t
   computeRescaleFactor(uint8_t fromScale, uint8_t toScale, uint8_t rScale = 0) {
     return std::max(0, toScale - fromScale);
@@ -318,6 +402,26 @@ class Subtraction {
     DecimalUtil::valueInRange(r);
   }
 
+  // See Addition::applyUnchecked.
+  template <typename R, typename A, typename B>
+  inline static void applyUnchecked(
+      R& r,
+      const A& a,
+      const B& b,
+      uint8_t aRescale,
+      uint8_t bRescale) {
+    r = R(a) * R(DecimalUtil::kPowersOfTen[aRescale]) -
+        R(b) * R(DecimalUtil::kPowersOfTen[bRescale]);
+  }
+
+  inline static bool needsOverflowCheck(
+      const uint8_t aPrecision,
+      const uint8_t aScale,
+      const uint8_t bPrecision,
+      const uint8_t bScale) {
+    return Addition::needsOverflowCheck(aPrecision, aScale, bPrecision, bScale);
+  }
+
   inline static uint8_t
   computeRescaleFactor(uint8_t fromScale, uint8_t toScale, uint8_t rScale = 0) {
     return std::max(0, toScale - fromScale);
@@ -344,6 +448,26 @@ class Multiply {
     DecimalUtil::valueInRange(r);
   }
 
+  // See Addition::applyUnchecked. The product is bounded by
+  // 10^(aPrecision + bPrecision) and no rescaling takes place.
+  template <typename R, typename A, typename B>
+  inline static void applyUnchecked(
+      R& r,
+      const A& a,
+      const B& b,
+      uint8_t aRescale,
+      uint8_t bRescale) {
+    r = R(a) * R(b) * R(DecimalUtil::kPowersOfTen[aRescale + bRescale]);
+  }
+
+  inline static bool needsOverflowCheck(
+      const uint8_t aPrecision,
+      const uint8_t aScale,
+      const uint8_t bPrecision,
+      const uint8_t bScale) {
+    return aPrecision + bPrecision > LongDecimalType::kMaxPrecision;
+  }
+
   inline static uint8_t
   computeRescaleFactor(uint8_t fromScale, uint8_t toScale, uint8_t rScale = 0) {
     return 0;
@@ -367,6 +491,26 @@ class Divide {
     DecimalUtil::valueInRange(r);
   }
 
+  // Division rounds and can divide by zero, so it always takes the checked
+  // path. This overload is never called.
+  template <typename R, typename A, typename B>
+  inline static void applyUnchecked(
+      R& r,
+      const A& a,
+      const B& b,
+      uint8_t aRescale,
+      uint8_t bRescale) {
+    apply<R, A, B>(r, a, b, aRescale, bRescale);
+  }
+
+  inline static bool needsOverflowCheck(
+      const uint8_t /*aPrecision*/,
+      const uint8_t /*aScale*/,
+      const uint8_t /*bPrecision*/,
+      const uint8_t /*bScale*/) {
+    return true;
+  }
+
   inline static uint8_t
   computeRescaleFactor(uint8_t fromScale, uint8_t toScale, uint8_t rScale) {
     return rScale - fromScale + toScale;
@@ -578,6 +722,8 @@ std::shared_ptr<exec::VectorFunction> createDecimalFunction(
       aPrecision, aScale, bPrecision, bScale);
   uint8_t aRescale = Operation::computeRescaleFactor(aScale, bScale, rScale);
   uint8_t bRescale = Operation::computeRescaleFactor(bScale, aScale, rScale);
+  const bool needsOverflowCheck =
+      Operation::needsOverflowCheck(aPrecision, aScale, bPrecision, bScale);
   if (aType->isShortDecimal()) {
     if (bType->isShortDecimal()) {
       if (rPrecision > ShortDecimalType::kMaxPrecision) {
@@ -586,14 +732,14 @@ std::shared_ptr<exec::VectorFunction> createDecimalFunction(
             int128_t /*result*/,
             int64_t,
             int64_t,
-            Operation>>(aRescale, bRescale);
+            Operation>>(aRescale, bRescale, needsOverflowCheck);
       } else {
         // Arguments are short decimals and result is a short decimal.
         return std::make_shared<DecimalBaseFunction<
             int64_t /*result*/,
             int64_t,
             int64_t,
-            Operation>>(aRescale, bRescale);
+            Operation>>(aRescale, bRescale, needsOverflowCheck);
       }
     } else {
       if (rPrecision > ShortDecimalType::kMaxPrecision) {
@@ -603,7 +749,7 @@ std::shared_ptr<exec::VectorFunction> createDecimalFunction(
             int128_t /*result*/,
             int64_t,
             int128_t,
-            Operation>>(aRescale, bRescale);
+            Operation>>(aRescale, bRescale, needsOverflowCheck);
       } else {
         // In some cases such as division, the result type can still be a short
         // decimal even though RHS is a long decimal.
@@ -611,7 +757,7 @@ std::shared_ptr<exec::VectorFunction> createDecimalFunction(
             int64_t /*result*/,
             int64_t,
             int128_t,
-            Operation>>(aRescale, bRescale);
+            Operation>>(aRescale, bRescale, needsOverflowCheck);
       }
     }
   } else {
@@ -621,14 +767,14 @@ std::shared_ptr<exec::VectorFunction> createDecimalFunction(
           int128_t /*result*/,
           int128_t,
           int64_t,
-          Operation>>(aRescale, bRescale);
+          Operation>>(aRescale, bRescale, needsOverflowCheck);
     } else {
       // Arguments and result are all long decimals.
       return std::make_shared<DecimalBaseFunction<
           int128_t /*result*/,
           int128_t,
           int128_t,
-          Operation>>(aRescale, bRescale);
+          Operation>>(aRescale, bRescale, needsOverflowCheck);
     }
   }
   VELOX_UNSUPPORTED();
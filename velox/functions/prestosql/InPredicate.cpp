@@ -13,6 +13,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "velox/common/base/SimdUtil.h"
 #include "velox/expression/VectorFunction.h"
 #include "velox/type/Filter.h"
 
@@ -295,6 +296,14 @@ class InPredicate : public exec::VectorFunction {
         }
       });
     } else {
+      if constexpr (
+          std::is_same_v<T, int64_t> || std::is_same_v<T, int32_t> ||
+          std::is_same_v<T, int16_t>) {
+        if (rows.isAllSelected()) {
+          applySimd(rows, rawValues, rawResults);
+          return;
+        }
+      }
       rows.applyToSelected([&](auto row) {
         bool pass = testFunction(rawValues[row]);
         bits::setBit(rawResults, row, pass);
@@ -302,6 +311,27 @@ class InPredicate : public exec::VectorFunction {
     }
   }
 
+  // Tests a full batch of values per filter probe. For large integer IN
+  // lists the filter is a flat open-addressing hash table probed with SIMD
+  // gathers (see BigintValuesUsingHashTable::testValues), so this replaces a
+  // hash probe per row with a probe per SIMD batch.
+  template <typename T>
+  void applySimd(
+      const SelectivityVector& rows,
+      const T* rawValues,
+      uint64_t* rawResults) const {
+    constexpr int32_t kBatch = xsimd::batch<T>::size;
+    vector_size_t row = rows.begin();
+    for (; row + kBatch <= rows.end(); row += kBatch) {
+      const uint64_t mask = simd::toBitMask(
+          filter_->testValues(xsimd::batch<T>::load_unaligned(rawValues + row)));
+      bits::copyBits(&mask, 0, rawResults, row, kBatch);
+    }
+    for (; row < rows.end(); ++row) {
+      bits::setBit(rawResults, row, filter_->testInt64(rawValues[row]));
+    }
+  }
+
   const std::unique_ptr<common::Filter> filter_;
   const bool alwaysNull_;
 };
@@ -77,6 +77,11 @@ struct ApproxMostFrequentAggregate : exec::Aggregate {
       bool) override {
     decodeArguments(rows, args);
     auto summary = initSummary(group);
+    if (!decodedValues_.mayHaveNulls() && decodedValues_.isIdentityMapping() &&
+        rows.isAllSelected()) {
+      summary->insert(folly::Range(decodedValues_.data<T>(), rows.end()));
+      return;
+    }
     rows.applyToSelected([&](auto row) {
       if (!decodedValues_.isNullAt(row)) {
         summary->insert(decodedValues_.valueAt<T>(row));
@@ -52,6 +52,10 @@ struct KllSketchAccumulator {
     sketch_.insert(value);
   }
 
+  void append(folly::Range<const T*> values) {
+    sketch_.insert(values);
+  }
+
   void append(T value, int64_t count) {
     constexpr size_t kMaxBufferSize = 4096;
     constexpr int64_t kMinCountToBuffer = 512;
@@ -383,6 +387,8 @@ class ApproxPercentileAggregate : public exec::Aggregate {
 
           accumulator->append(decodedValue_.valueAt<T>(row));
         });
+      } else if (decodedValue_.isIdentityMapping() && rows.isAllSelected()) {
+        accumulator->append(folly::Range(decodedValue_.data<T>(), rows.end()));
       } else {
         rows.applyToSelected([&](auto row) {
           accumulator->append(decodedValue_.valueAt<T>(row));
@@ -156,6 +156,40 @@ class AverageAggregate : public exec::Aggregate {
     }
   }
 
+  bool supportsRetract() const override {
+    return true;
+  }
+
+  void retractSingleGroupRawInput(
+      char* group,
+      const SelectivityVector& rows,
+      const std::vector<VectorPtr>& args) override {
+    decodedRaw_.decode(*args[0], rows);
+
+    if (decodedRaw_.isConstantMapping()) {
+      if (!decodedRaw_.isNullAt(0)) {
+        const TInput value = decodedRaw_.valueAt<TInput>(0);
+        const auto numRows = rows.countSelected();
+        retractNonNullValue(group, numRows, TAccumulator(value) * numRows);
+      }
+    } else if (decodedRaw_.mayHaveNulls()) {
+      TAccumulator totalSum(0);
+      int64_t nonNullCount = 0;
+      rows.applyToSelected([&](vector_size_t i) {
+        if (!decodedRaw_.isNullAt(i)) {
+          totalSum += decodedRaw_.valueAt<TInput>(i);
+          ++nonNullCount;
+        }
+      });
+      retractNonNullValue(group, nonNullCount, totalSum);
+    } else {
+      TAccumulator totalSum(0);
+      rows.applyToSelected(
+          [&](vector_size_t i) { totalSum += decodedRaw_.valueAt<TInput>(i); });
+      retractNonNullValue(group, rows.countSelected(), totalSum);
+    }
+  }
+
   void addIntermediateResults(
       char** groups,
       const SelectivityVector& rows,
@@ -210,6 +244,20 @@ class AverageAggregate : public exec::Aggregate {
     accumulator(group)->count += count;
   }
 
+  inline void
+  retractNonNullValue(char* group, int64_t count, TAccumulator sum) {
+    auto* sumCount = accumulator(group);
+    sumCount->sum -= sum;
+    sumCount->count -= count;
+    if (sumCount->count == 0) {
+      // All added rows have been retracted. Restore the null state so the
+      // result over a frame with no non-null rows is null. Reset the sum to
+      // drop any floating point rounding error accumulated while sliding.
+      exec::Aggregate::setNull(group);
+      sumCount->sum = 0;
+    }
+  }
+
   inline SumCount<TAccumulator>* accumulator(char* group) {
     return exec::Aggregate::value<SumCount<TAccumulator>>(group);
   }
@@ -158,6 +158,11 @@ class MaxAggregate : public MinMaxAggregate<T> {
       const SelectivityVector& rows,
       const std::vector<VectorPtr>& args,
       bool mayPushdown) override {
+    if (mayPushdown && args[0]->isLazy()) {
+      BaseAggregate::template pushdownOneGroup<MinMaxHook<T, false>>(
+          group, rows, args[0]);
+      return;
+    }
     BaseAggregate::updateOneGroup(
         group,
         rows,
@@ -238,6 +243,11 @@ class MinAggregate : public MinMaxAggregate<T> {
       const SelectivityVector& rows,
       const std::vector<VectorPtr>& args,
       bool mayPushdown) override {
+    if (mayPushdown && args[0]->isLazy()) {
+      BaseAggregate::template pushdownOneGroup<MinMaxHook<T, true>>(
+          group, rows, args[0]);
+      return;
+    }
     BaseAggregate::updateOneGroup(
         group,
         rows,
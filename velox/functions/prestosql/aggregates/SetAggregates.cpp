@@ -23,7 +23,19 @@ namespace {
 
 template <typename T>
 struct Accumulator {
+  // Number of values stored inline in the accumulator before switching to
+  // 'uniqueValues'. Small sets are the common case and never allocate from
+  // the HashStringAllocator, which also keeps the allocator from fragmenting
+  // over many small per-group hash sets.
+  static constexpr int32_t kInlineCapacity = 8;
+
+  // Value of 'numInline' marking that the inline storage has overflowed into
+  // 'uniqueValues'.
+  static constexpr int8_t kOverflowed = -1;
+
   bool hasNull{false};
+  int8_t numInline{0};
+  std::array<T, kInlineCapacity> inlineValues;
   folly::
       F14FastSet<T, std::hash<T>, std::equal_to<T>, AlignedStlAllocator<T, 16>>
           uniqueValues;
@@ -31,11 +43,30 @@ struct Accumulator {
   explicit Accumulator(HashStringAllocator* allocator)
       : uniqueValues{AlignedStlAllocator<T, 16>(allocator)} {}
 
+  void insert(T value) {
+    if (numInline == kOverflowed) {
+      uniqueValues.insert(value);
+      return;
+    }
+    for (int8_t i = 0; i < numInline; ++i) {
+      if (inlineValues[i] == value) {
+        return;
+      }
+    }
+    if (numInline < kInlineCapacity) {
+      inlineValues[numInline++] = value;
+      return;
+    }
+    uniqueValues.insert(inlineValues.begin(), inlineValues.end());
+    uniqueValues.insert(value);
+    numInline = kOverflowed;
+  }
+
   void addValue(const DecodedVector& decoded, vector_size_t index) {
     if (decoded.isNullAt(index)) {
       hasNull = true;
     } else {
-      uniqueValues.insert(decoded.valueAt<T>(index));
+      insert(decoded.valueAt<T>(index));
     }
   }
 
@@ -50,20 +81,28 @@ struct Accumulator {
       if (values.isNullAt(offset + i)) {
         hasNull = true;
       } else {
-        uniqueValues.insert(values.valueAt<T>(offset + i));
+        insert(values.valueAt<T>(offset + i));
       }
     }
   }
 
   size_t size() const {
-    return uniqueValues.size() + (hasNull ? 1 : 0);
+    const auto numValues =
+        numInline == kOverflowed ? uniqueValues.size() : numInline;
+    return numValues + (hasNull ? 1 : 0);
   }
 
   vector_size_t extractValues(FlatVector<T>& values, vector_size_t offset)
       const {
     vector_size_t index = offset;
-    for (auto value : uniqueValues) {
-      values.set(index++, value);
+    if (numInline == kOverflowed) {
+      for (auto value : uniqueValues) {
+        values.set(index++, value);
+      }
+    } else {
+      for (int8_t i = 0; i < numInline; ++i) {
+        values.set(index++, inlineValues[i]);
+      }
     }
 
     if (hasNull) {
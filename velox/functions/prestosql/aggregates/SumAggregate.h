@@ -90,6 +90,11 @@ class SumAggregate
       const SelectivityVector& rows,
       const std::vector<VectorPtr>& args,
       bool mayPushdown) override {
+    if (mayPushdown && args[0]->isLazy()) {
+      BaseAggregate::template pushdownOneGroup<SumHook<TInput, TAccumulator>>(
+          group, rows, args[0]);
+      return;
+    }
     BaseAggregate::template updateOneGroup<TAccumulator>(
         group,
         rows,
@@ -105,6 +110,11 @@ class SumAggregate
       const SelectivityVector& rows,
       const std::vector<VectorPtr>& args,
       bool mayPushdown) override {
+    if (mayPushdown && args[0]->isLazy()) {
+      BaseAggregate::template pushdownOneGroup<
+          SumHook<TAccumulator, TAccumulator>>(group, rows, args[0]);
+      return;
+    }
     BaseAggregate::template updateOneGroup<TAccumulator, TAccumulator>(
         group,
         rows,
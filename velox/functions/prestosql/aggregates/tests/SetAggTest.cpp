@@ -144,5 +144,31 @@ TEST_F(SetAggTest, groupBy) {
       {data}, {"c0"}, {"set_agg(c1)"}, {"c0", "array_sort(a0)"}, {expected});
 }
 
+// Sets larger than the inline capacity of the accumulator (8 values) spill
+// over into the hash set.
+TEST_F(SetAggTest, largeSets) {
+  const vector_size_t size = 1'000;
+  auto data = makeRowVector({
+      makeFlatVector<int16_t>(size, [](auto row) { return row % 2; }),
+      makeFlatVector<int32_t>(size, [](auto row) { return row % 100; }),
+  });
+
+  // Even rows see even values, odd rows see odd values.
+  std::vector<int32_t> evens;
+  std::vector<int32_t> odds;
+  for (auto i = 0; i < 100; i += 2) {
+    evens.push_back(i);
+    odds.push_back(i + 1);
+  }
+
+  auto expected = makeRowVector({
+      makeFlatVector<int16_t>({0, 1}),
+      makeArrayVector<int32_t>({evens, odds}),
+  });
+
+  testAggregations(
+      {data}, {"c0"}, {"set_agg(c1)"}, {"c0", "array_sort(a0)"}, {expected});
+}
+
 } // namespace
 } // namespace facebook::velox::aggregate::test
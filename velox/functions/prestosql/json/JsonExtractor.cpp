@@ -24,6 +24,7 @@
 #include "folly/String.h"
 #include "folly/json.h"
 #include "velox/common/base/Exceptions.h"
+#include "velox/common/caching/SimpleLRUCache.h"
 #include "velox/functions/prestosql/json/JsonPathTokenizer.h"
 
 namespace facebook::velox::functions {
@@ -32,6 +33,306 @@ namespace {
 
 using JsonVector = std::vector<const folly::dynamic*>;
 
+// Cache of parsed documents shared by json functions evaluated on the same
+// thread. Multiple json_extract calls on the same column in one projection
+// evaluate the same documents once per expression; the cache lets the later
+// expressions reuse the parse of the earlier ones. Only documents small
+// enough to be worth keeping are cached and the entry count is bounded, so
+// the per-thread footprint stays modest.
+constexpr uint32_t kMaxParsedDocuments = 128;
+constexpr size_t kMaxCachedDocumentSize = 8192;
+
+using ParsedDocumentCache =
+    SimpleLRUCache<std::string, std::shared_ptr<const folly::dynamic>>;
+
+ParsedDocumentCache& parsedDocumentCache() {
+  thread_local ParsedDocumentCache cache{kMaxParsedDocuments};
+  return cache;
+}
+
+// Streaming evaluation of a json path over the raw document text. Walks the
+// document structurally (strings, nesting depth), skipping values that are
+// not on the path without materializing them, and returns the text slice of
+// the matched value. Only that slice is parsed into a folly::dynamic. Used
+// for paths without wildcards; any structural anomaly sets failed() and the
+// caller falls back to parsing the full document, so behavior on malformed
+// input matches the non-streaming path.
+class JsonStreamScanner {
+ public:
+  explicit JsonStreamScanner(folly::StringPiece json)
+      : pos_(json.begin()), end_(json.end()) {}
+
+  // Returns the text of the value at 'tokens', or folly::none when the path
+  // does not match. The whole document is scanned structurally, so malformed
+  // input is detected the same way a full parse would detect it; check
+  // failed() before using the result.
+  folly::Optional<folly::StringPiece> seek(
+      const std::vector<std::string>& tokens) {
+    skipWhitespace();
+    auto match = seekInValue(tokens, 0);
+    if (failed_) {
+      return folly::none;
+    }
+    skipWhitespace();
+    if (pos_ != end_) {
+      // Trailing garbage; the document would not have parsed.
+      failed_ = true;
+      return folly::none;
+    }
+    return match;
+  }
+
+  bool failed() const {
+    return failed_;
+  }
+
+ private:
+  void skipWhitespace() {
+    while (pos_ != end_ &&
+           std::isspace(static_cast<unsigned char>(*pos_))) {
+      ++pos_;
+    }
+  }
+
+  // Positioned on the opening quote of a string; consumes through the
+  // closing quote.
+  void skipString() {
+    ++pos_;
+    while (pos_ < end_) {
+      if (*pos_ == '\\') {
+        if (end_ - pos_ < 2) {
+          break;
+        }
+        pos_ += 2;
+      } else if (*pos_ == '"') {
+        ++pos_;
+        return;
+      } else {
+        ++pos_;
+      }
+    }
+    failed_ = true;
+  }
+
+  // Positioned on '{' or '['; consumes the whole structure by tracking
+  // nesting depth outside of strings.
+  void skipStructure() {
+    int32_t depth = 1;
+    ++pos_;
+    while (pos_ < end_ && depth > 0) {
+      const char c = *pos_;
+      if (c == '"') {
+        skipString();
+        if (failed_) {
+          return;
+        }
+        continue;
+      }
+      if (c == '{' || c == '[') {
+        ++depth;
+      } else if (c == '}' || c == ']') {
+        --depth;
+      }
+      ++pos_;
+    }
+    if (depth != 0) {
+      failed_ = true;
+    }
+  }
+
+  // Consumes a scalar literal (number, boolean or null) up to the next
+  // delimiter. The text is not validated; the slice parser reports errors
+  // the same way a full parse would.
+  void skipScalar() {
+    const char* start = pos_;
+    while (pos_ != end_ && *pos_ != ',' && *pos_ != '}' && *pos_ != ']' &&
+           *pos_ != '"' && !std::isspace(static_cast<unsigned char>(*pos_))) {
+      ++pos_;
+    }
+    if (pos_ == start) {
+      failed_ = true;
+    }
+  }
+
+  void skipValue() {
+    if (pos_ == end_) {
+      failed_ = true;
+      return;
+    }
+    switch (*pos_) {
+      case '"':
+        skipString();
+        break;
+      case '{':
+      case '[':
+        skipStructure();
+        break;
+      default:
+        skipScalar();
+        break;
+    }
+  }
+
+  // Positioned on the start of a value. Consumes the value and returns the
+  // text of the sub-value at tokens[depth:], or folly::none when the path
+  // does not match.
+  folly::Optional<folly::StringPiece> seekInValue(
+      const std::vector<std::string>& tokens,
+      size_t depth) {
+    if (depth == tokens.size()) {
+      const char* start = pos_;
+      skipValue();
+      if (failed_) {
+        return folly::none;
+      }
+      return folly::StringPiece{start, pos_};
+    }
+    if (pos_ == end_) {
+      failed_ = true;
+      return folly::none;
+    }
+    if (*pos_ == '{') {
+      return seekKey(tokens, depth);
+    }
+    if (*pos_ == '[') {
+      auto index = folly::tryTo<int32_t>(tokens[depth]);
+      if (!index.hasValue() || index.value() < 0) {
+        // Not an array subscript; consume the value so the caller can keep
+        // scanning.
+        skipValue();
+        return folly::none;
+      }
+      return seekIndex(tokens, depth, index.value());
+    }
+    // A scalar has no children.
+    skipValue();
+    return folly::none;
+  }
+
+  // Positioned on '{'. Scans all members, descending into every member whose
+  // key equals tokens[depth]. The last match wins, mirroring folly::dynamic
+  // where a duplicate key overwrites the earlier value.
+  folly::Optional<folly::StringPiece> seekKey(
+      const std::vector<std::string>& tokens,
+      size_t depth) {
+    const auto& token = tokens[depth];
+    folly::Optional<folly::StringPiece> match;
+    ++pos_;
+    for (;;) {
+      skipWhitespace();
+      if (pos_ == end_) {
+        failed_ = true;
+        return folly::none;
+      }
+      if (*pos_ == '}') {
+        ++pos_;
+        return match;
+      }
+      if (*pos_ != '"') {
+        failed_ = true;
+        return folly::none;
+      }
+      const char* keyStart = pos_;
+      skipString();
+      if (failed_) {
+        return folly::none;
+      }
+      const folly::StringPiece rawKey{keyStart + 1, pos_ - 1};
+      skipWhitespace();
+      if (pos_ == end_ || *pos_ != ':') {
+        failed_ = true;
+        return folly::none;
+      }
+      ++pos_;
+      skipWhitespace();
+      if (keyMatches(rawKey, token)) {
+        auto result = seekInValue(tokens, depth + 1);
+        if (result.hasValue()) {
+          match = result;
+        }
+      } else {
+        skipValue();
+      }
+      if (failed_) {
+        return folly::none;
+      }
+      skipWhitespace();
+      if (pos_ != end_ && *pos_ == ',') {
+        ++pos_;
+        continue;
+      }
+      if (pos_ != end_ && *pos_ == '}') {
+        ++pos_;
+        return match;
+      }
+      failed_ = true;
+      return folly::none;
+    }
+  }
+
+  // Positioned on '['. Scans all elements, descending into the one at
+  // 'index'.
+  folly::Optional<folly::StringPiece> seekIndex(
+      const std::vector<std::string>& tokens,
+      size_t depth,
+      int32_t index) {
+    folly::Optional<folly::StringPiece> match;
+    int32_t current = 0;
+    ++pos_;
+    for (;;) {
+      skipWhitespace();
+      if (pos_ == end_) {
+        failed_ = true;
+        return folly::none;
+      }
+      if (*pos_ == ']') {
+        ++pos_;
+        return match;
+      }
+      if (current == index) {
+        match = seekInValue(tokens, depth + 1);
+      } else {
+        skipValue();
+      }
+      if (failed_) {
+        return folly::none;
+      }
+      ++current;
+      skipWhitespace();
+      if (pos_ != end_ && *pos_ == ',') {
+        ++pos_;
+        continue;
+      }
+      if (pos_ != end_ && *pos_ == ']') {
+        ++pos_;
+        return match;
+      }
+      failed_ = true;
+      return folly::none;
+    }
+  }
+
+  // Compares the raw (possibly escaped) text of a key against the path
+  // token. Keys containing escapes are unescaped by parsing the quoted
+  // slice.
+  bool keyMatches(folly::StringPiece rawKey, const std::string& token) {
+    if (memchr(rawKey.data(), '\\', rawKey.size()) == nullptr) {
+      return rawKey == token;
+    }
+    try {
+      const folly::StringPiece quoted{rawKey.begin() - 1, rawKey.end() + 1};
+      return folly::parseJson(quoted).getString() == token;
+    } catch (const folly::json::parse_error&) {
+      failed_ = true;
+      return false;
+    }
+  }
+
+  const char* pos_;
+  const char* end_;
+  bool failed_{false};
+};
+
 class JsonExtractor {
  public:
   // Use this method to get an instance of JsonExtractor given a json path.
@@ -55,11 +356,24 @@ class JsonExtractor {
 
   folly::Optional<folly::dynamic> extract(const folly::dynamic& json);
 
+  // Extracts from the raw document text. Streamable paths are evaluated
+  // without parsing the full document; other paths parse through the
+  // per-thread document cache. May throw folly::json::parse_error.
+  folly::Optional<folly::dynamic> extract(folly::StringPiece json);
+
   // Shouldn't instantiate directly - use getInstance().
   explicit JsonExtractor(const std::string& path) {
     if (!tokenize(path)) {
       VELOX_USER_FAIL("Invalid JSON path: {}", path);
     }
+    streamable_ = true;
+    for (const auto& token : tokens_) {
+      if (token == "*") {
+        // Wildcards can match multiple values; they need the full document.
+        streamable_ = false;
+        break;
+      }
+    }
   }
 
  private:
@@ -93,6 +407,7 @@ class JsonExtractor {
   static const uint32_t kMaxCacheNum{32};
 
   std::vector<std::string> tokens_;
+  bool streamable_;
 };
 
 thread_local std::unordered_map<std::string, std::shared_ptr<JsonExtractor>>
@@ -166,6 +481,34 @@ folly::Optional<folly::dynamic> JsonExtractor::extract(
   }
 }
 
+folly::Optional<folly::dynamic> JsonExtractor::extract(
+    folly::StringPiece json) {
+  if (streamable_) {
+    JsonStreamScanner scanner(json);
+    auto slice = scanner.seek(tokens_);
+    if (!scanner.failed()) {
+      if (!slice.hasValue()) {
+        return folly::none;
+      }
+      return folly::parseJson(slice.value());
+    }
+    // The document could not be scanned structurally; fall through to the
+    // full parser for its regular error handling.
+  }
+  if (json.size() <= kMaxCachedDocumentSize) {
+    auto& cache = parsedDocumentCache();
+    auto key = json.str();
+    if (auto cached = cache.get(key)) {
+      return extract(**cached);
+    }
+    auto document =
+        std::make_shared<const folly::dynamic>(folly::parseJson(json));
+    cache.add(key, document);
+    return extract(*document);
+  }
+  return extract(folly::parseJson(json));
+}
+
 bool isScalarType(const folly::Optional<folly::dynamic>& json) {
   return json.has_value() && !json->isObject() && !json->isArray() &&
       !json->isNull();
@@ -182,7 +525,7 @@ folly::Optional<folly::dynamic> jsonExtract(
     // json parsing failures (in which cases we return folly::none instead of
     // throw).
     auto& extractor = JsonExtractor::getInstance(path);
-    return extractor.extract(folly::parseJson(json));
+    return extractor.extract(json);
   } catch (const folly::json::parse_error&) {
   } catch (const folly::ConversionError&) {
     // Folly might throw a conversion error while parsing the input json. In
@@ -501,3 +501,21 @@ TEST(JsonExtractorTest, jsonMultipleExtractsTest) {
   ASSERT_TRUE(extract2.hasValue());
   EXPECT_EQ(jsonExtract(json, "$.store.fruit").value(), extract2.value());
 }
+
+TEST(JsonExtractorTest, duplicateKeyTest) {
+  // The last value of a duplicate key wins, same as when the document is
+  // materialized with folly::parseJson.
+  EXPECT_JSON_VALUE_EQ("{\"a\": 1, \"a\": 2}"s, "$.a"s, "2"s);
+  EXPECT_JSON_VALUE_EQ(
+      "{\"a\": {\"b\": 1}, \"a\": {\"b\": 2}}"s, "$.a.b"s, "2"s);
+}
+
+TEST(JsonExtractorTest, malformedJsonTest) {
+  // Malformed documents extract to null whether or not the path portion of
+  // the document looks well formed.
+  EXPECT_JSON_VALUE_NULL("{\"a\": 1"s, "$.a"s);
+  EXPECT_JSON_VALUE_NULL("{\"a\": 1} trailing"s, "$.a"s);
+  EXPECT_JSON_VALUE_NULL("{\"a\": [1, 2}"s, "$.a[0]"s);
+  EXPECT_JSON_VALUE_NULL("not json"s, "$.a"s);
+  EXPECT_SCALAR_VALUE_NULL("{\"a\": \"unterminated"s, "$.a"s);
+}
@@ -96,6 +96,10 @@ void registerArrayFunctions(const std::string& prefix) {
   VELOX_REGISTER_VECTOR_FUNCTION(udf_array_shuffle, prefix + "shuffle");
   VELOX_REGISTER_VECTOR_FUNCTION(udf_array_sort, prefix + "array_sort");
   VELOX_REGISTER_VECTOR_FUNCTION(udf_array_sum, prefix + "array_sum");
+  // Bulk kernels for arrays of numeric primitives. Other element types
+  // fall through to the simple functions registered below.
+  VELOX_REGISTER_VECTOR_FUNCTION(udf_array_min, prefix + "array_min");
+  VELOX_REGISTER_VECTOR_FUNCTION(udf_array_max, prefix + "array_max");
   VELOX_REGISTER_VECTOR_FUNCTION(udf_repeat, prefix + "repeat");
   VELOX_REGISTER_VECTOR_FUNCTION(udf_sequence, prefix + "sequence");
 
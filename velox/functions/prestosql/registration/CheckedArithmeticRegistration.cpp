@@ -26,6 +26,15 @@ void registerCheckedArithmeticFunctions(const std::string& prefix) {
   registerBinaryIntegral<CheckedModulusFunction>({prefix + "mod"});
   registerBinaryIntegral<CheckedDivideFunction>({prefix + "divide"});
   registerUnaryIntegral<CheckedNegateFunction>({prefix + "negate"});
+
+  // Batch versions of checked plus, minus and multiply that defer the
+  // overflow check so the common no-overflow case stays vectorized.
+  // These take precedence over the simple functions above for flat and
+  // constant inputs.
+  VELOX_REGISTER_VECTOR_FUNCTION(udf_simd_checked_plus, prefix + "plus");
+  VELOX_REGISTER_VECTOR_FUNCTION(udf_simd_checked_minus, prefix + "minus");
+  VELOX_REGISTER_VECTOR_FUNCTION(
+      udf_simd_checked_multiply, prefix + "multiply");
 }
 
 } // namespace facebook::velox::functions
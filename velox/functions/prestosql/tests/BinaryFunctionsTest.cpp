@@ -434,6 +434,39 @@ TEST_F(BinaryFunctionsTest, fromBase64) {
   EXPECT_THROW(fromBase64("YQ==="), VeloxUserError);
 }
 
+TEST_F(BinaryFunctionsTest, hexAndBase64RoundTripLongInputs) {
+  // Inputs long enough to exercise the vectorized encode and decode
+  // paths, including all byte values and lengths that leave a scalar
+  // tail.
+  const auto roundTripHex = [&](std::optional<std::string> value) {
+    return evaluateOnce<std::string>(
+        "from_hex(to_hex(cast(c0 as varbinary)))", value);
+  };
+  const auto roundTripBase64 = [&](std::optional<std::string> value) {
+    return evaluateOnce<std::string>(
+        "from_base64(to_base64(cast(c0 as varbinary)))", value);
+  };
+
+  std::string allBytes;
+  for (auto i = 1; i < 256; ++i) {
+    allBytes.push_back(static_cast<char>(i));
+  }
+
+  for (auto length : {31, 32, 45, 64, 100, 255}) {
+    auto input = allBytes.substr(0, length);
+    EXPECT_EQ(input, roundTripHex(input)) << "at length " << length;
+    EXPECT_EQ(input, roundTripBase64(input)) << "at length " << length;
+  }
+
+  const auto fromHex = [&](std::optional<std::string> value) {
+    return evaluateOnce<std::string>("from_hex(c0)", value);
+  };
+
+  // An invalid character beyond the vectorized prefix is still reported.
+  auto invalidHex = std::string(64, '0') + "fg";
+  EXPECT_THROW(fromHex(invalidHex), VeloxUserError);
+}
+
 TEST_F(BinaryFunctionsTest, fromBase64Url) {
   const auto fromHex = [&](std::optional<std::string> value) {
     return evaluateOnce<std::string>("from_hex(cast(c0 as varchar))", value);
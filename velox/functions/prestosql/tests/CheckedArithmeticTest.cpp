@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <limits>
+#include <optional>
+
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/functions/prestosql/tests/utils/FunctionBaseTest.h"
+
+using namespace facebook::velox;
+using namespace facebook::velox::test;
+
+namespace {
+
+// Exercises the SIMD checked arithmetic vector functions registered for
+// plus, minus and multiply over integer types, including the deferred
+// overflow check that reruns the throwing scalar path.
+template <typename T>
+class CheckedArithmeticTest : public functions::test::FunctionBaseTest {
+ public:
+  static constexpr T kMin = std::numeric_limits<T>::min();
+  static constexpr T kMax = std::numeric_limits<T>::max();
+
+  void testFlat(const std::string& fn, const std::function<T(T, T)>& op) {
+    // Large enough to cover several SIMD batches plus a scalar tail.
+    std::vector<T> lhs(203);
+    std::vector<T> rhs(lhs.size());
+    for (auto i = 0; i < lhs.size(); i++) {
+      lhs[i] = i % 50;
+      rhs[i] = (i % 25) - 12;
+    }
+
+    auto result = evaluate<SimpleVector<T>>(
+        fmt::format("{}(c0, c1)", fn),
+        makeRowVector({makeFlatVector<T>(lhs), makeFlatVector<T>(rhs)}));
+
+    for (auto i = 0; i < lhs.size(); i++) {
+      ASSERT_FALSE(result->isNullAt(i));
+      ASSERT_EQ(result->valueAt(i), op(lhs[i], rhs[i])) << "at " << i;
+    }
+  }
+
+  void testConstant(const std::string& fn, const std::function<T(T, T)>& op) {
+    std::vector<T> data(67);
+    for (auto i = 0; i < data.size(); i++) {
+      data[i] = i % 40;
+    }
+    const T constant = 3;
+
+    auto flat = makeFlatVector<T>(data);
+    for (auto constantRhs : {true, false}) {
+      auto constVector = makeConstant<T>(constant, flat->size());
+      auto rowVector = constantRhs ? makeRowVector({flat, constVector})
+                                   : makeRowVector({constVector, flat});
+      auto result =
+          evaluate<SimpleVector<T>>(fmt::format("{}(c0, c1)", fn), rowVector);
+      for (auto i = 0; i < data.size(); i++) {
+        ASSERT_EQ(
+            result->valueAt(i),
+            constantRhs ? op(data[i], constant) : op(constant, data[i]))
+            << "at " << i;
+      }
+    }
+  }
+
+  void testNulls(const std::string& fn, const std::function<T(T, T)>& op) {
+    auto lhs = makeNullableFlatVector<T>({1, std::nullopt, 3, 4});
+    auto rhs = makeNullableFlatVector<T>({10, 20, std::nullopt, 40});
+    auto result = evaluate<SimpleVector<T>>(
+        fmt::format("{}(c0, c1)", fn), makeRowVector({lhs, rhs}));
+
+    ASSERT_EQ(result->valueAt(0), op(1, 10));
+    ASSERT_TRUE(result->isNullAt(1));
+    ASSERT_TRUE(result->isNullAt(2));
+    ASSERT_EQ(result->valueAt(3), op(4, 40));
+  }
+
+  void testOverflow(
+      const std::string& fn,
+      T lhsValue,
+      T rhsValue,
+      char opSign) {
+    // Place the overflowing pair in the middle of a SIMD batch so the
+    // error comes from the deferred rerun, not the scalar tail.
+    std::vector<T> lhs(64, 1);
+    std::vector<T> rhs(lhs.size(), 1);
+    lhs[13] = lhsValue;
+    rhs[13] = rhsValue;
+
+    auto rowVector =
+        makeRowVector({makeFlatVector<T>(lhs), makeFlatVector<T>(rhs)});
+    VELOX_ASSERT_THROW(
+        evaluate(fmt::format("{}(c0, c1)", fn), rowVector),
+        fmt::format("integer overflow: {} {} {}", lhsValue, opSign, rhsValue));
+
+    // TRY masks the overflowing row and keeps the rest.
+    auto result = evaluate<SimpleVector<T>>(
+        fmt::format("try({}(c0, c1))", fn), rowVector);
+    for (auto i = 0; i < lhs.size(); i++) {
+      if (i == 13) {
+        ASSERT_TRUE(result->isNullAt(i));
+      } else {
+        ASSERT_FALSE(result->isNullAt(i));
+      }
+    }
+  }
+};
+
+using IntegerTypes = ::testing::Types<int8_t, int16_t, int32_t, int64_t>;
+TYPED_TEST_SUITE(CheckedArithmeticTest, IntegerTypes, );
+
+TYPED_TEST(CheckedArithmeticTest, plus) {
+  using T = TypeParam;
+  auto plus = [](T a, T b) { return T(a + b); };
+  this->testFlat("plus", plus);
+  this->testConstant("plus", plus);
+  this->testNulls("plus", plus);
+  this->testOverflow("plus", this->kMax, 1, '+');
+  this->testOverflow("plus", this->kMin, -1, '+');
+}
+
+TYPED_TEST(CheckedArithmeticTest, minus) {
+  using T = TypeParam;
+  auto minus = [](T a, T b) { return T(a - b); };
+  this->testFlat("minus", minus);
+  this->testConstant("minus", minus);
+  this->testNulls("minus", minus);
+  this->testOverflow("minus", this->kMin, 1, '-');
+  this->testOverflow("minus", this->kMax, -1, '-');
+}
+
+TYPED_TEST(CheckedArithmeticTest, multiply) {
+  using T = TypeParam;
+  auto multiply = [](T a, T b) { return T(a * b); };
+  this->testFlat("multiply", multiply);
+  this->testConstant("multiply", multiply);
+  this->testNulls("multiply", multiply);
+  this->testOverflow("multiply", this->kMax, 2, '*');
+  this->testOverflow("multiply", this->kMin, -1, '*');
+}
+
+} // namespace
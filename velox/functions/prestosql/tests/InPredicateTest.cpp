@@ -169,6 +169,29 @@ class InPredicateTest : public FunctionBaseTest {
   }
 };
 
+TEST_F(InPredicateTest, bigintHashTable) {
+  // A large sparse IN list uses a hash table filter, which is probed a SIMD
+  // batch of rows at a time when the input is flat and null-free.
+  const vector_size_t size = 1'024;
+  auto vector =
+      makeFlatVector<int64_t>(size, [](auto row) { return row * 500; });
+  auto rowVector = makeRowVector({vector});
+
+  std::string inList;
+  for (auto i = 0; i < 2'000; ++i) {
+    if (i > 0) {
+      inList += ", ";
+    }
+    inList += std::to_string(i * 1'000);
+  }
+
+  auto result = evaluate<SimpleVector<bool>>(
+      fmt::format("c0 IN ({})", inList), rowVector);
+  auto expected =
+      makeFlatVector<bool>(size, [](auto row) { return row % 2 == 0; });
+  assertEqualVectors(expected, result);
+}
+
 TEST_F(InPredicateTest, bigint) {
   testIntegers<int64_t>();
   testsIntegerConstant<int64_t>();
@@ -122,5 +122,39 @@ TEST_F(StringAggregatesTest, nonFixedWidthAggregate) {
   testWindowFunction(input, "max(c2)", kOverClauses);
 }
 
+class StreamingWindowTest : public WindowTestBase {};
+
+// Tests the streaming Window operator over inputs sorted on the partition
+// and order by keys, with partitions spanning input batches.
+TEST_F(StreamingWindowTest, sortedInputs) {
+  const vector_size_t size = 100;
+  auto makeBatch = [&](vector_size_t offset) {
+    return makeRowVector({
+        makeFlatVector<int32_t>(
+            size, [&](auto row) { return (offset + row) / 25; }),
+        makeFlatVector<int32_t>(size, [&](auto row) { return offset + row; }),
+        makeFlatVector<int64_t>(size, [](auto row) { return row % 11 + 1; }),
+    });
+  };
+  std::vector<RowVectorPtr> input = {makeBatch(0), makeBatch(size)};
+  createDuckDbTable(input);
+
+  const std::vector<std::string> functions = {
+      "sum(c2) over (partition by c0 order by c1)",
+      "row_number() over (partition by c0 order by c1)",
+      "avg(c2) over (partition by c0 order by c1 "
+      "rows between 5 preceding and current row)",
+  };
+  for (const auto& functionSql : functions) {
+    SCOPED_TRACE(functionSql);
+    auto plan = PlanBuilder()
+                    .values(input)
+                    .streamingWindow({functionSql})
+                    .planNode();
+    assertQuery(
+        plan, fmt::format("SELECT c0, c1, c2, {} FROM tmp", functionSql));
+  }
+}
+
 }; // namespace
 }; // namespace facebook::velox::window::test
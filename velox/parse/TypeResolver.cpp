@@ -15,8 +15,11 @@
  */
 
 #include "velox/parse/TypeResolver.h"
+#include <folly/Synchronized.h>
+#include <folly/container/F14Map.h>
 #include "velox/core/ITypedExpr.h"
 #include "velox/expression/FunctionCallToSpecialForm.h"
+#include "velox/expression/FunctionRegistryVersion.h"
 #include "velox/expression/SignatureBinder.h"
 #include "velox/functions/FunctionRegistry.h"
 #include "velox/parse/Expressions.h"
@@ -52,6 +55,55 @@ std::string toString(
   return out.str();
 }
 
+// Process-wide cache of scalar function resolution results keyed by
+// function name and argument types. Binding a call site against many
+// generic signatures is expensive and machine-generated projections
+// resolve the same (name, argument types) combination thousands of
+// times per query. Entries become invalid whenever the function
+// registries change, tracked by the registry version. Only successful
+// resolutions are cached.
+class FunctionResolutionCache {
+ public:
+  TypePtr resolve(
+      const std::string& name,
+      const std::vector<TypePtr>& argTypes) {
+    const auto version = exec::functionRegistryVersion();
+    const auto key = toString(name, argTypes);
+    {
+      auto locked = cache_.rlock();
+      if (locked->version == version) {
+        auto it = locked->returnTypes.find(key);
+        if (it != locked->returnTypes.end()) {
+          return it->second;
+        }
+      }
+    }
+    auto returnType = velox::resolveFunction(name, argTypes);
+    if (returnType != nullptr) {
+      auto locked = cache_.wlock();
+      if (locked->version != version) {
+        locked->returnTypes.clear();
+        locked->version = version;
+      }
+      locked->returnTypes.emplace(key, returnType);
+    }
+    return returnType;
+  }
+
+ private:
+  struct Cache {
+    int64_t version{-1};
+    folly::F14FastMap<std::string, TypePtr> returnTypes;
+  };
+
+  folly::Synchronized<Cache> cache_;
+};
+
+FunctionResolutionCache& functionResolutionCache() {
+  static FunctionResolutionCache cache;
+  return cache;
+}
+
 TypePtr resolveType(
     const std::vector<std::shared_ptr<const core::ITypedExpr>>& inputs,
     const std::shared_ptr<const core::CallExpr>& expr,
@@ -93,7 +145,7 @@ TypePtr resolveScalarFunctionType(
     const std::string& name,
     const std::vector<TypePtr>& argTypes,
     bool nullOnFailure) {
-  auto returnType = resolveFunction(name, argTypes);
+  auto returnType = functionResolutionCache().resolve(name, argTypes);
   if (returnType) {
     return returnType;
   }
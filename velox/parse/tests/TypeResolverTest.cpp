@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+
+#include "velox/common/base/tests/GTestUtils.h"
+#include "velox/functions/Registerer.h"
+#include "velox/parse/TypeResolver.h"
+#include "velox/type/Type.h"
+
+namespace facebook::velox::parse {
+namespace {
+
+template <typename T>
+struct PlusOneFunction {
+  VELOX_DEFINE_FUNCTION_TYPES(T);
+
+  FOLLY_ALWAYS_INLINE void call(int64_t& result, const int64_t& input) {
+    result = input + 1;
+  }
+};
+
+TEST(TypeResolverTest, cachedResolutionFollowsRegistry) {
+  const std::vector<TypePtr> argTypes = {BIGINT()};
+
+  // The function is not registered yet.
+  EXPECT_EQ(resolveScalarFunctionType("plus_one", argTypes, true), nullptr);
+  VELOX_ASSERT_THROW(
+      resolveScalarFunctionType("plus_one", argTypes),
+      "Scalar function doesn't exist: plus_one");
+
+  // Registration invalidates any cached state: resolution succeeds now
+  // and repeated lookups agree.
+  registerFunction<PlusOneFunction, int64_t, int64_t>({"plus_one"});
+  EXPECT_EQ(
+      *resolveScalarFunctionType("plus_one", argTypes), *BIGINT());
+  EXPECT_EQ(
+      *resolveScalarFunctionType("plus_one", argTypes), *BIGINT());
+
+  // Unsupported argument types still fail.
+  EXPECT_EQ(
+      resolveScalarFunctionType("plus_one", {VARCHAR()}, true), nullptr);
+}
+
+} // namespace
+} // namespace facebook::velox::parse
@@ -121,6 +121,28 @@ int32_t UnsafeRowFast::rowSize(vector_size_t index) {
   return rowRowSize(index);
 }
 
+void UnsafeRowFast::rowSizes(
+    vector_size_t offset,
+    vector_size_t size,
+    int32_t* sizes) {
+  const int32_t fixedSize = rowNullBytes_ + children_.size() * kFieldWidth;
+  std::fill(sizes, sizes + size, fixedSize);
+
+  for (auto i = 0; i < children_.size(); ++i) {
+    if (childIsFixedWidth_[i]) {
+      continue;
+    }
+
+    auto& child = children_[i];
+    for (auto row = 0; row < size; ++row) {
+      const auto childIndex = decoded_.index(offset + row);
+      if (!child.isNullAt(childIndex)) {
+        sizes[row] += alignBytes(child.variableWidthRowSize(childIndex));
+      }
+    }
+  }
+}
+
 int32_t UnsafeRowFast::variableWidthRowSize(vector_size_t index) {
   switch (typeKind_) {
     case TypeKind::VARCHAR:
@@ -149,6 +171,68 @@ int32_t UnsafeRowFast::serialize(vector_size_t index, char* buffer) {
   return serializeRow(index, buffer);
 }
 
+void UnsafeRowFast::serialize(
+    vector_size_t offset,
+    vector_size_t size,
+    char* buffer,
+    const size_t* bufferOffsets) {
+  const int64_t fixedFieldsEnd = rowNullBytes_ + kFieldWidth * children_.size();
+
+  bool hasVariableWidth = false;
+  for (auto isFixedWidth : childIsFixedWidth_) {
+    if (!isFixedWidth) {
+      hasVariableWidth = true;
+      break;
+    }
+  }
+
+  // Per-row offsets of the next variable-width value, relative to the start
+  // of each row.
+  std::vector<int64_t> variableWidthOffsets;
+  if (hasVariableWidth) {
+    variableWidthOffsets.assign(size, fixedFieldsEnd);
+  }
+
+  for (auto i = 0; i < children_.size(); ++i) {
+    auto& child = children_[i];
+
+    if (childIsFixedWidth_[i]) {
+      for (auto row = 0; row < size; ++row) {
+        const auto childIndex = decoded_.index(offset + row);
+        auto* rowBuffer = buffer + bufferOffsets[row];
+
+        if (child.isNullAt(childIndex)) {
+          bits::setBit(rowBuffer, i, true);
+        } else {
+          child.serializeFixedWidth(
+              childIndex, rowBuffer + rowNullBytes_ + i * kFieldWidth);
+        }
+      }
+      continue;
+    }
+
+    for (auto row = 0; row < size; ++row) {
+      const auto childIndex = decoded_.index(offset + row);
+      auto* rowBuffer = buffer + bufferOffsets[row];
+
+      if (child.isNullAt(childIndex)) {
+        bits::setBit(rowBuffer, i, true);
+        continue;
+      }
+
+      auto& variableWidthOffset = variableWidthOffsets[row];
+      const auto serializedBytes = child.serializeVariableWidth(
+          childIndex, rowBuffer + variableWidthOffset);
+
+      // Write size and offset.
+      uint64_t sizeAndOffset = variableWidthOffset << 32 | serializedBytes;
+      reinterpret_cast<uint64_t*>(rowBuffer + rowNullBytes_)[i] = sizeAndOffset;
+
+      variableWidthOffset += alignBytes(serializedBytes);
+    }
+  }
+}
+
 void UnsafeRowFast::serializeFixedWidth(vector_size_t index, char* buffer) {
   VELOX_DCHECK(fixedWidthTypeKind_);
   switch (typeKind_) {
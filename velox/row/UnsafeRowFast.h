@@ -32,10 +32,25 @@ class UnsafeRowFast {
   /// 'fixedRowSize' returned std::nullopt.
   int32_t rowSize(vector_size_t index);
 
+  /// Computes serialized sizes of rows between 'offset' and 'offset + size'
+  /// into 'sizes' in a single pass over each variable-width field. Use only
+  /// if 'fixedRowSize' returned std::nullopt.
+  void rowSizes(vector_size_t offset, vector_size_t size, int32_t* sizes);
+
   /// Serializes row at specified index into 'buffer'.
   /// 'buffer' must have sufficient capacity and set to all zeros.
   int32_t serialize(vector_size_t index, char* buffer);
 
+  /// Serializes rows between 'offset' and 'offset + size' into 'buffer',
+  /// writing row 'offset + i' at 'buffer + bufferOffsets[i]'. Fields are
+  /// written one column at a time to avoid per-row dispatch. 'buffer' must
+  /// have sufficient capacity and set to all zeros.
+  void serialize(
+      vector_size_t offset,
+      vector_size_t size,
+      char* buffer,
+      const size_t* bufferOffsets);
+
  protected:
   explicit UnsafeRowFast(const VectorPtr& vector);
 
@@ -29,6 +29,7 @@ constexpr int8_t kCompressedBitMask = 1;
 constexpr int8_t kEncryptedBitMask = 2;
 constexpr int8_t kCheckSumBitMask = 4;
 constexpr folly::StringPiece kRLE{"RLE"};
+constexpr folly::StringPiece kDictionary{"DICTIONARY"};
 
 int64_t computeChecksum(
     PrestoOutputStreamListener* listener,
@@ -46,11 +47,12 @@ int64_t computeChecksum(
     ByteStream* source,
     int codecMarker,
     int numRows,
-    int uncompressedSize) {
+    int uncompressedSize,
+    int dataSize) {
   auto offset = source->tellp();
   bits::Crc32 crc32;
 
-  auto remainingBytes = uncompressedSize;
+  auto remainingBytes = dataSize;
   while (remainingBytes > 0) {
     auto data = source->nextView(remainingBytes);
     crc32.process_bytes(data.data(), data.size());
@@ -319,6 +321,102 @@ readNulls(ByteStream* source, vector_size_t size, BaseVector* result) {
   return nullCount;
 }
 
+// Reads the nulls of a column for deserializeIntoRows() into 'scratch'
+// as a bitmap with ones for nulls. Returns the number of nulls.
+vector_size_t readNullsBitmap(
+    ByteStream* source,
+    vector_size_t size,
+    std::vector<uint64_t>& scratch) {
+  if (source->readByte() == 0) {
+    return 0;
+  }
+  scratch.resize(bits::nwords(size));
+  auto rawNulls = reinterpret_cast<uint8_t*>(scratch.data());
+  auto numBytes = BaseVector::byteSize<bool>(size);
+  source->readBytes(rawNulls, numBytes);
+  bits::reverseBits(rawNulls, numBytes);
+  return bits::countBits(scratch.data(), 0, size);
+}
+
+// Writes the values of one column into rows for deserializeIntoRows().
+// 'nulls' is a bitmap with ones for nulls, nullptr if there are none.
+template <typename T>
+void readValuesIntoRows(
+    ByteStream* source,
+    vector_size_t size,
+    const uint64_t* nulls,
+    char** rows,
+    const PrestoVectorSerde::RowColumnInfo& column) {
+  auto offset = column.offset;
+  for (vector_size_t row = 0; row < size; ++row) {
+    if (nulls != nullptr && bits::isBitSet(nulls, row)) {
+      rows[row][column.nullByte] |= column.nullMask;
+      // Do not leave an uninitialized value in the case of a null, same
+      // as when storing from a vector.
+      *reinterpret_cast<T*>(rows[row] + offset) = T();
+    } else {
+      *reinterpret_cast<T*>(rows[row] + offset) = source->read<T>();
+    }
+  }
+}
+
+template <>
+void readValuesIntoRows<bool>(
+    ByteStream* source,
+    vector_size_t size,
+    const uint64_t* nulls,
+    char** rows,
+    const PrestoVectorSerde::RowColumnInfo& column) {
+  auto offset = column.offset;
+  for (vector_size_t row = 0; row < size; ++row) {
+    if (nulls != nullptr && bits::isBitSet(nulls, row)) {
+      rows[row][column.nullByte] |= column.nullMask;
+      *reinterpret_cast<bool*>(rows[row] + offset) = false;
+    } else {
+      *reinterpret_cast<bool*>(rows[row] + offset) =
+          source->read<int8_t>() != 0;
+    }
+  }
+}
+
+template <>
+void readValuesIntoRows<Date>(
+    ByteStream* source,
+    vector_size_t size,
+    const uint64_t* nulls,
+    char** rows,
+    const PrestoVectorSerde::RowColumnInfo& column) {
+  auto offset = column.offset;
+  for (vector_size_t row = 0; row < size; ++row) {
+    if (nulls != nullptr && bits::isBitSet(nulls, row)) {
+      rows[row][column.nullByte] |= column.nullMask;
+      *reinterpret_cast<Date*>(rows[row] + offset) = Date();
+    } else {
+      *reinterpret_cast<Date*>(rows[row] + offset) = readDate(source);
+    }
+  }
+}
+
+void readTimestampValuesIntoRows(
+    ByteStream* source,
+    vector_size_t size,
+    const uint64_t* nulls,
+    char** rows,
+    const PrestoVectorSerde::RowColumnInfo& column,
+    bool useLosslessTimestamp) {
+  auto offset = column.offset;
+  for (vector_size_t row = 0; row < size; ++row) {
+    if (nulls != nullptr && bits::isBitSet(nulls, row)) {
+      rows[row][column.nullByte] |= column.nullMask;
+      *reinterpret_cast<Timestamp*>(rows[row] + offset) = Timestamp();
+    } else {
+      *reinterpret_cast<Timestamp*>(rows[row] + offset) = useLosslessTimestamp
+          ? readLosslessTimestamp(source)
+          : readTimestamp(source);
+    }
+  }
+}
+
 template <typename T>
 void read(
     ByteStream* source,
@@ -432,6 +530,28 @@ void readConstantVector(
   *result = BaseVector::wrapInConstant(size, 0, children[0]);
 }
 
+void readDictionaryVector(
+    ByteStream* source,
+    const TypePtr& type,
+    velox::memory::MemoryPool* pool,
+    VectorPtr* result,
+    bool useLosslessTimestamp) {
+  auto size = source->read<int32_t>();
+  std::vector<TypePtr> childTypes = {type};
+  std::vector<VectorPtr> children(1);
+  readColumns(source, pool, childTypes, &children, useLosslessTimestamp);
+
+  // Read indices.
+  BufferPtr indices = allocateIndices(size, pool);
+  source->readBytes(indices->asMutable<char>(), size * sizeof(int32_t));
+
+  // Skip 3 * 8 bytes of 'instance id'. Velox doesn't use them.
+  source->skip(24);
+
+  *result = BaseVector::wrapInDictionary(
+      BufferPtr(nullptr), indices, size, children[0]);
+}
+
 void readArrayVector(
     ByteStream* source,
     std::shared_ptr<const Type> type,
@@ -704,6 +824,9 @@ void readColumns(
     if (encoding == kRLE) {
       readConstantVector(
           source, types[i], pool, &(*result)[i], useLosslessTimestamp);
+    } else if (encoding == kDictionary) {
+      readDictionaryVector(
+          source, types[i], pool, &(*result)[i], useLosslessTimestamp);
     } else {
       checkTypeEncoding(encoding, types[i]);
       auto it = readers.find(types[i]->kind());
@@ -737,6 +860,7 @@ class VectorStream {
       int32_t initialNumRows,
       bool useLosslessTimestamp)
       : type_(type),
+        streamArena_(streamArena),
         useLosslessTimestamp_(useLosslessTimestamp),
         nulls_(streamArena, true, true),
         lengths_(streamArena),
@@ -828,8 +952,53 @@ class VectorStream {
     return children_[index].get();
   }
 
+  bool isEmpty() const {
+    return nullCount_ == 0 && nonNullCount_ == 0 && !isDictionary();
+  }
+
+  bool isDictionary() const {
+    return dictionaryValues_ != nullptr;
+  }
+
+  const VectorPtr& dictionaryValues() const {
+    return dictionaryValues_;
+  }
+
+  // Switches the stream to dictionary mode: the contents are the indices
+  // appended via 'appendDictionaryIndices' into 'dictionaryValues'. Returns
+  // the stream to serialize the dictionary values into. The stream must be
+  // empty.
+  VectorStream* startDictionary(const VectorPtr& dictionaryValues) {
+    VELOX_DCHECK(isEmpty());
+    dictionaryValues_ = dictionaryValues;
+    dictionaryStream_ = std::make_unique<VectorStream>(
+        type_, streamArena_, dictionaryValues->size(), useLosslessTimestamp_);
+    return dictionaryStream_.get();
+  }
+
+  void appendDictionaryIndices(folly::Range<const vector_size_t*> indices) {
+    dictionaryIndices_.insert(
+        dictionaryIndices_.end(), indices.begin(), indices.end());
+  }
+
+  // Ends dictionary mode, moving the accumulated indices into 'indices' and
+  // returning the dictionary values. Leaves the stream empty.
+  VectorPtr clearDictionary(std::vector<vector_size_t>& indices) {
+    indices = std::move(dictionaryIndices_);
+    dictionaryIndices_.clear();
+    dictionaryStream_.reset();
+    auto values = std::move(dictionaryValues_);
+    dictionaryValues_ = nullptr;
+    return values;
+  }
+
   // Writes out the accumulated contents. Does not change the state.
   void flush(OutputStream* out) {
+    if (isDictionary()) {
+      flushDictionary(out);
+      return;
+    }
+
     out->write(reinterpret_cast<char*>(header_.buffer), header_.size);
     switch (type_->kind()) {
       case TypeKind::ROW:
@@ -908,7 +1077,26 @@ class VectorStream {
   }
 
  private:
+  // Writes out dictionary-mode contents: the DICTIONARY encoding name, the
+  // number of positions, the dictionary values block, the indices and the
+  // dictionary instance id.
+  void flushDictionary(OutputStream* out) {
+    writeInt32(out, kDictionary.size());
+    out->write(kDictionary.data(), kDictionary.size());
+    writeInt32(out, dictionaryIndices_.size());
+    dictionaryStream_->flush(out);
+    out->write(
+        reinterpret_cast<const char*>(dictionaryIndices_.data()),
+        dictionaryIndices_.size() * sizeof(vector_size_t));
+
+    // Write 3 * 8 bytes of 'instance id'. Velox doesn't use them.
+    writeInt64(out, 0);
+    writeInt64(out, 0);
+    writeInt64(out, 0);
+  }
+
   const TypePtr type_;
+  StreamArena* const streamArena_;
   /// Indicates whether to serialize timestamps with nanosecond precision.
   /// If false, they are serialized with millisecond precision which is
   /// compatible with presto.
@@ -922,14 +1110,33 @@ class VectorStream {
   ByteStream lengths_;
   ByteStream values_;
   std::vector<std::unique_ptr<VectorStream>> children_;
+
+  // Dictionary-mode state. When 'dictionaryValues_' is set, the stream
+  // accumulates dictionary indices in 'dictionaryIndices_' and the dictionary
+  // values are serialized into 'dictionaryStream_' instead of appending flat
+  // content above.
+  VectorPtr dictionaryValues_;
+  std::vector<vector_size_t> dictionaryIndices_;
+  std::unique_ptr<VectorStream> dictionaryStream_;
 };
 
 template <>
 inline void VectorStream::append(folly::Range<const StringView*> values) {
+  // Batch the string bodies so that 'values_' checks bounds once per batch
+  // instead of once per string.
+  std::array<folly::StringPiece, 64> pieces;
+  size_t numPieces = 0;
   for (auto& value : values) {
     auto size = value.size();
     appendLength(size);
-    values_.appendStringPiece(folly::StringPiece(value.data(), size));
+    pieces[numPieces++] = folly::StringPiece(value.data(), size);
+    if (numPieces == pieces.size()) {
+      values_.appendStringPieces(folly::Range(pieces.data(), numPieces));
+      numPieces = 0;
+    }
+  }
+  if (numPieces > 0) {
+    values_.appendStringPieces(folly::Range(pieces.data(), numPieces));
   }
 }
 
@@ -1095,6 +1302,55 @@ void serializeWrapped(
   }
 }
 
+// Returns true if the dictionary in 'vector' is the one 'stream' is currently
+// accumulating indices for.
+bool usesSameDictionary(const BaseVector* vector, const VectorStream* stream) {
+  return vector->encoding() == VectorEncoding::Simple::DICTIONARY &&
+      vector->rawNulls() == nullptr &&
+      vector->valueVector().get() == stream->dictionaryValues().get();
+}
+
+// Replays dictionary indices accumulated in 'stream' through the regular
+// serialization path. Called when a stream that started out dictionary
+// encoded receives content that cannot be expressed with the same dictionary.
+void flattenDictionaryStream(VectorStream* stream) {
+  std::vector<vector_size_t> indices;
+  auto dictionaryValues = stream->clearDictionary(indices);
+  std::vector<IndexRange> ranges;
+  ranges.reserve(indices.size());
+  for (auto index : indices) {
+    ranges.push_back(IndexRange{index, 1});
+  }
+  serializeColumn(dictionaryValues.get(), ranges, stream);
+}
+
+void serializeDictionaryVector(
+    const BaseVector* vector,
+    const folly::Range<const IndexRange*>& ranges,
+    VectorStream* stream) {
+  // Presto dictionary blocks cannot represent nulls added by the dictionary
+  // wrap and dictionary indices cannot follow already accumulated flat
+  // content.
+  if (vector->rawNulls() != nullptr ||
+      (!stream->isDictionary() && !stream->isEmpty())) {
+    serializeWrapped(vector, ranges, stream);
+    return;
+  }
+
+  if (!stream->isDictionary()) {
+    const auto& dictionaryValues = vector->valueVector();
+    auto* valuesStream = stream->startDictionary(dictionaryValues);
+    std::vector<IndexRange> valuesRange{{0, dictionaryValues->size()}};
+    serializeColumn(dictionaryValues.get(), valuesRange, valuesStream);
+  }
+
+  auto indices = vector->wrapInfo()->as<vector_size_t>();
+  for (const auto& range : ranges) {
+    stream->appendDictionaryIndices(
+        folly::Range(indices + range.begin, range.size));
+  }
+}
+
 void serializeTimestampWithTimeZone(
     const RowVector* rowVector,
     const folly::Range<const IndexRange*>& ranges,
@@ -1272,6 +1528,10 @@ void serializeColumn(
     const BaseVector* vector,
     const folly::Range<const IndexRange*>& ranges,
     VectorStream* stream) {
+  if (stream->isDictionary() && !usesSameDictionary(vector, stream)) {
+    flattenDictionaryStream(stream);
+  }
+
   switch (vector->encoding()) {
     case VectorEncoding::Simple::FLAT:
       VELOX_DYNAMIC_SCALAR_TYPE_DISPATCH_ALL(
@@ -1305,6 +1565,9 @@ void serializeColumn(
     case VectorEncoding::Simple::MAP:
       serializeMapVector(vector, ranges, stream);
       break;
+    case VectorEncoding::Simple::DICTIONARY:
+      serializeDictionaryVector(vector, ranges, stream);
+      break;
     case VectorEncoding::Simple::LAZY:
       serializeColumn(vector->loadedVector(), ranges, stream);
       break;
@@ -1583,7 +1846,9 @@ class PrestoVectorSerializer : public VectorSerializer {
       std::shared_ptr<const RowType> rowType,
       int32_t numRows,
       StreamArena* streamArena,
-      bool useLosslessTimestamp) {
+      bool useLosslessTimestamp,
+      folly::io::CodecType compressionCodec)
+      : streamArena_(streamArena), compressionCodec_(compressionCodec) {
     auto types = rowType->children();
     auto numTypes = types.size();
     streams_.resize(numTypes);
@@ -1629,10 +1894,16 @@ class PrestoVectorSerializer : public VectorSerializer {
       listener->reset();
     }
 
+    const bool compressed =
+        compressionCodec_ != folly::io::CodecType::NO_COMPRESSION;
+
     char codec = 0;
     if (listener) {
       codec = getCodecMarker();
     }
+    if (compressed) {
+      codec |= kCompressedBitMask;
+    }
 
     int32_t offset = out->tellp();
 
@@ -1653,18 +1924,25 @@ class PrestoVectorSerializer : public VectorSerializer {
     if (listener) {
       listener->resume();
     }
-    writeInt32(out, streams_.size());
 
-    if (rle) {
-      // Write RLE encoding marker.
-      writeInt32(out, kRLE.size());
-      out->write(kRLE.data(), kRLE.size());
-      // Write number of RLE values.
-      writeInt32(out, numRows);
-    }
-
-    for (auto& stream : streams_) {
-      stream->flush(out);
+    int32_t uncompressedSize;
+    if (!compressed) {
+      flushBody(numRows, rle, out);
+      uncompressedSize = (int32_t)out->tellp() - offset - kHeaderSize;
+    } else {
+      // Serialize the body into a temporary stream, compress it as a single
+      // frame and write out the codec id followed by the compressed bytes.
+      IOBufOutputStream body(*streamArena_->pool());
+      flushBody(numRows, rle, &body);
+      uncompressedSize = (int32_t)body.tellp();
+      auto iobuf = body.getIOBuf();
+      auto compressedBuf =
+          folly::io::getCodec(compressionCodec_)->compress(iobuf.get());
+      char codecId = static_cast<char>(compressionCodec_);
+      out->write(&codecId, 1);
+      for (auto range : *compressedBuf) {
+        out->write(reinterpret_cast<const char*>(range.data()), range.size());
+      }
     }
 
     // Pause CRC computation
@@ -1674,7 +1952,10 @@ class PrestoVectorSerializer : public VectorSerializer {
 
     // Fill in uncompressedSizeInBytes & sizeInBytes
     int32_t size = (int32_t)out->tellp() - offset;
-    int32_t uncompressedSize = size - kHeaderSize;
+    // For a compressed page, sizeInBytes is the size of the compressed body,
+    // not counting the codec id byte.
+    int32_t sizeInBytes =
+        compressed ? size - kHeaderSize - 1 : uncompressedSize;
     int64_t crc = 0;
     if (listener) {
       crc = computeChecksum(listener, codec, numRows, uncompressedSize);
@@ -1682,15 +1963,35 @@ class PrestoVectorSerializer : public VectorSerializer {
 
     out->seekp(offset + kSizeInBytesOffset);
     writeInt32(out, uncompressedSize);
-    writeInt32(out, uncompressedSize);
+    writeInt32(out, sizeInBytes);
     writeInt64(out, crc);
     out->seekp(offset + size);
   }
 
+  // Writes the page body, i.e. the number of columns followed by the column
+  // streams, to 'out'.
+  void flushBody(int32_t numRows, bool rle, OutputStream* out) {
+    writeInt32(out, streams_.size());
+
+    if (rle) {
+      // Write RLE encoding marker.
+      writeInt32(out, kRLE.size());
+      out->write(kRLE.data(), kRLE.size());
+      // Write number of RLE values.
+      writeInt32(out, numRows);
+    }
+
+    for (auto& stream : streams_) {
+      stream->flush(out);
+    }
+  }
+
  private:
   static const int32_t kSizeInBytesOffset{4 + 1};
   static const int32_t kHeaderSize{kSizeInBytesOffset + 4 + 4 + 8};
 
+  StreamArena* streamArena_;
+  const folly::io::CodecType compressionCodec_;
   int32_t numRows_{0};
   std::vector<std::unique_ptr<VectorStream>> streams_;
 };
@@ -1708,11 +2009,15 @@ std::unique_ptr<VectorSerializer> PrestoVectorSerde::createSerializer(
     int32_t numRows,
     StreamArena* streamArena,
     const Options* options) {
-  bool useLosslessTimestamp = options != nullptr
-      ? static_cast<const PrestoOptions*>(options)->useLosslessTimestamp
-      : false;
+  auto prestoOptions = options != nullptr
+      ? *static_cast<const PrestoOptions*>(options)
+      : PrestoOptions();
   return std::make_unique<PrestoVectorSerializer>(
-      type, numRows, streamArena, useLosslessTimestamp);
+      type,
+      numRows,
+      streamArena,
+      prestoOptions.useLosslessTimestamp,
+      prestoOptions.compressionCodec);
 }
 
 void PrestoVectorSerde::serializeConstants(
@@ -1745,27 +2050,166 @@ void PrestoVectorSerde::deserialize(
 
   auto pageCodecMarker = source->read<int8_t>();
   auto uncompressedSize = source->read<int32_t>();
-  // skip size in bytes
-  source->skip(4);
+  auto sizeInBytes = source->read<int32_t>();
   auto checksum = source->read<int64_t>();
 
+  const bool compressed = isCompressedBitSet(pageCodecMarker);
+
   int64_t actualCheckSum = 0;
   if (isChecksumBitSet(pageCodecMarker)) {
-    actualCheckSum =
-        computeChecksum(source, pageCodecMarker, numRows, uncompressedSize);
+    // For a compressed page the checksum covers the codec id byte and the
+    // compressed body as found in the stream.
+    actualCheckSum = computeChecksum(
+        source,
+        pageCodecMarker,
+        numRows,
+        uncompressedSize,
+        compressed ? sizeInBytes + 1 : uncompressedSize);
   }
 
   VELOX_CHECK_EQ(
       checksum, actualCheckSum, "Received corrupted serialized page.");
 
-  // skip number of columns
-  source->skip(4);
-
   auto children = &(*result)->children();
   auto childTypes = type->as<TypeKind::ROW>().children();
+
+  if (compressed) {
+    auto codecId = source->read<int8_t>();
+    auto compressedBuf = folly::IOBuf::create(sizeInBytes);
+    source->readBytes(compressedBuf->writableData(), sizeInBytes);
+    compressedBuf->append(sizeInBytes);
+    auto uncompressedBuf =
+        folly::io::getCodec(static_cast<folly::io::CodecType>(codecId))
+            ->uncompress(compressedBuf.get(), uncompressedSize);
+    std::vector<ByteRange> ranges;
+    for (const auto& range : *uncompressedBuf) {
+      ranges.push_back(ByteRange{
+          const_cast<uint8_t*>(range.data()),
+          static_cast<int32_t>(range.size()),
+          0});
+    }
+    ByteStream uncompressedSource;
+    uncompressedSource.resetInput(std::move(ranges));
+    // skip number of columns
+    uncompressedSource.skip(4);
+    readColumns(
+        &uncompressedSource, pool, childTypes, children, useLosslessTimestamp);
+    return;
+  }
+
+  // skip number of columns
+  source->skip(4);
   readColumns(source, pool, childTypes, children, useLosslessTimestamp);
 }
 
+// static
+bool PrestoVectorSerde::supportsDeserializeIntoRows(const RowTypePtr& type) {
+  for (const auto& child : type->children()) {
+    switch (child->kind()) {
+      case TypeKind::BOOLEAN:
+      case TypeKind::TINYINT:
+      case TypeKind::SMALLINT:
+      case TypeKind::INTEGER:
+      case TypeKind::BIGINT:
+      case TypeKind::REAL:
+      case TypeKind::DOUBLE:
+      case TypeKind::TIMESTAMP:
+      case TypeKind::DATE:
+        break;
+      default:
+        return false;
+    }
+  }
+  return true;
+}
+
+void PrestoVectorSerde::deserializeIntoRows(
+    ByteStream* source,
+    const RowTypePtr& type,
+    const std::vector<RowColumnInfo>& columns,
+    const std::function<char**(int32_t numRows)>& allocateRows,
+    const Options* options) {
+  bool useLosslessTimestamp = options != nullptr
+      ? static_cast<const PrestoOptions*>(options)->useLosslessTimestamp
+      : false;
+  const auto& childTypes = type->children();
+  VELOX_CHECK_EQ(columns.size(), childTypes.size());
+
+  auto numRows = source->read<int32_t>();
+  auto pageCodecMarker = source->read<int8_t>();
+  auto uncompressedSize = source->read<int32_t>();
+  // Size in bytes, same as 'uncompressedSize' for uncompressed pages.
+  source->read<int32_t>();
+  auto checksum = source->read<int64_t>();
+
+  VELOX_CHECK(
+      !isCompressedBitSet(pageCodecMarker),
+      "deserializeIntoRows supports only uncompressed pages");
+
+  int64_t actualCheckSum = 0;
+  if (isChecksumBitSet(pageCodecMarker)) {
+    actualCheckSum = computeChecksum(
+        source, pageCodecMarker, numRows, uncompressedSize, uncompressedSize);
+  }
+  VELOX_CHECK_EQ(
+      checksum, actualCheckSum, "Received corrupted serialized page.");
+
+  // skip number of columns
+  source->skip(4);
+
+  char** rows = allocateRows(numRows);
+  std::vector<uint64_t> nullsScratch;
+  for (int32_t i = 0; i < childTypes.size(); ++i) {
+    auto encoding = readLengthPrefixedString(source);
+    checkTypeEncoding(encoding, childTypes[i]);
+    auto size = source->read<int32_t>();
+    VELOX_CHECK_EQ(size, numRows);
+    auto nullCount = readNullsBitmap(source, size, nullsScratch);
+    if (nullCount > 0) {
+      VELOX_CHECK_NE(
+          0,
+          columns[i].nullMask,
+          "Null value for a row column with no null flag: {}",
+          type->nameOf(i));
+    }
+    const uint64_t* nulls = nullCount > 0 ? nullsScratch.data() : nullptr;
+    switch (childTypes[i]->kind()) {
+      case TypeKind::BOOLEAN:
+        readValuesIntoRows<bool>(source, size, nulls, rows, columns[i]);
+        break;
+      case TypeKind::TINYINT:
+        readValuesIntoRows<int8_t>(source, size, nulls, rows, columns[i]);
+        break;
+      case TypeKind::SMALLINT:
+        readValuesIntoRows<int16_t>(source, size, nulls, rows, columns[i]);
+        break;
+      case TypeKind::INTEGER:
+        readValuesIntoRows<int32_t>(source, size, nulls, rows, columns[i]);
+        break;
+      case TypeKind::BIGINT:
+        readValuesIntoRows<int64_t>(source, size, nulls, rows, columns[i]);
+        break;
+      case TypeKind::REAL:
+        readValuesIntoRows<float>(source, size, nulls, rows, columns[i]);
+        break;
+      case TypeKind::DOUBLE:
+        readValuesIntoRows<double>(source, size, nulls, rows, columns[i]);
+        break;
+      case TypeKind::TIMESTAMP:
+        readTimestampValuesIntoRows(
+            source, size, nulls, rows, columns[i], useLosslessTimestamp);
+        break;
+      case TypeKind::DATE:
+        readValuesIntoRows<Date>(source, size, nulls, rows, columns[i]);
+        break;
+      default:
+        VELOX_UNSUPPORTED(
+            "deserializeIntoRows does not support type {}",
+            childTypes[i]->toString());
+    }
+  }
+}
+
 // static
 void PrestoVectorSerde::registerVectorSerde() {
   velox::registerVectorSerde(std::make_unique<PrestoVectorSerde>());
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 #pragma once
+#include <folly/compression/Compression.h>
 #include "velox/common/base/Crc.h"
 #include "velox/vector/VectorStream.h"
 
@@ -22,13 +23,29 @@ class PrestoVectorSerde : public VectorSerde {
  public:
   // Input options that the serializer recognizes.
   struct PrestoOptions : VectorSerde::Options {
+    PrestoOptions() = default;
+
     explicit PrestoOptions(bool useLosslessTimestamp)
         : useLosslessTimestamp(useLosslessTimestamp) {}
+
+    PrestoOptions(
+        bool useLosslessTimestamp,
+        folly::io::CodecType compressionCodec)
+        : useLosslessTimestamp(useLosslessTimestamp),
+          compressionCodec(compressionCodec) {}
+
     // Currently presto only supports millisecond precision and the serializer
     // converts velox native timestamp to that resulting in loss of precision.
     // This option allows it to serialize with nanosecond precision and is
     // currently used for spilling. Is false by default.
     bool useLosslessTimestamp{false};
+
+    // Codec used to compress the page body. The codec is recorded in the
+    // page, so the reader does not need to know it up front and pages with
+    // different codecs can be mixed on the same exchange. Only affects
+    // serialization; deserialization always handles both compressed and
+    // uncompressed pages.
+    folly::io::CodecType compressionCodec{folly::io::CodecType::NO_COMPRESSION};
   };
 
   void estimateSerializedSize(
@@ -56,6 +73,40 @@ class PrestoVectorSerde : public VectorSerde {
       std::shared_ptr<RowVector>* result,
       const Options* options) override;
 
+  /// Position of one column inside a target row of deserializeIntoRows().
+  /// 'offset' is the byte offset of the value. The null flag is the bits
+  /// of 'nullMask' in the byte at 'nullByte'. A zero 'nullMask' means the
+  /// column has no null flag; a null in the page then raises an error.
+  /// The fields mirror exec::RowColumn, so a consumer can fill them from
+  /// exec::RowContainer::columnAt() without this serde depending on exec.
+  struct RowColumnInfo {
+    int32_t offset;
+    int32_t nullByte;
+    uint8_t nullMask;
+  };
+
+  /// True if deserializeIntoRows() supports all children of 'type', i.e.
+  /// all children are fixed-width scalar types. Variable width and
+  /// complex types still go through deserialize() because their row-wise
+  /// storage needs the consumer's string allocator.
+  static bool supportsDeserializeIntoRows(const RowTypePtr& type);
+
+  /// Deserializes one page from 'source' directly into row-wise storage,
+  /// e.g. exec::RowContainer rows, skipping the intermediate column
+  /// vectors. 'allocateRows' is called once with the number of rows in
+  /// the page and returns that many row pointers. The value of child 'i'
+  /// of 'type' is written into each row at 'columns[i]'; null values set
+  /// the null flag and zero the value bytes, as storing from a vector
+  /// would. Supports only uncompressed pages with flat column encodings,
+  /// as produced by this serde's serializer, and types accepted by
+  /// supportsDeserializeIntoRows().
+  void deserializeIntoRows(
+      ByteStream* source,
+      const RowTypePtr& type,
+      const std::vector<RowColumnInfo>& columns,
+      const std::function<char**(int32_t numRows)>& allocateRows,
+      const Options* options = nullptr);
+
   static void registerVectorSerde();
 };
 
@@ -40,17 +40,30 @@ class UnsafeRowVectorSerializer : public VectorSerializer {
       const folly::Range<const IndexRange*>& ranges) override {
     size_t totalSize = 0;
     row::UnsafeRowFast unsafeRow(vector);
-    if (auto fixedRowSize =
-            row::UnsafeRowFast::fixedRowSize(asRowType(vector->type()))) {
+    const auto fixedRowSize =
+        row::UnsafeRowFast::fixedRowSize(asRowType(vector->type()));
+
+    std::vector<int32_t> rowSizes;
+    if (fixedRowSize) {
       for (const auto& range : ranges) {
         totalSize += (fixedRowSize.value() + sizeof(TRowSize)) * range.size;
       }
-
     } else {
+      // Compute all row sizes in one columnar pass per range.
+      vector_size_t numRows = 0;
+      for (const auto& range : ranges) {
+        numRows += range.size;
+      }
+      rowSizes.resize(numRows);
+
+      auto* sizes = rowSizes.data();
       for (const auto& range : ranges) {
-        for (auto i = range.begin; i < range.begin + range.size; ++i) {
-          totalSize += unsafeRow.rowSize(i) + sizeof(TRowSize);
-        }
+        unsafeRow.rowSizes(range.begin, range.size, sizes);
+        sizes += range.size;
+      }
+
+      for (auto rowSize : rowSizes) {
+        totalSize += rowSize + sizeof(TRowSize);
       }
     }
 
@@ -63,16 +76,23 @@ class UnsafeRowVectorSerializer : public VectorSerializer {
     buffers_.push_back(std::move(buffer));
 
     size_t offset = 0;
+    auto* sizes = rowSizes.data();
+    std::vector<size_t> bufferOffsets;
     for (auto& range : ranges) {
-      for (auto i = range.begin; i < range.begin + range.size; ++i) {
-        // Write row data.
-        TRowSize size =
-            unsafeRow.serialize(i, rawBuffer + offset + sizeof(TRowSize));
+      bufferOffsets.resize(range.size);
+      for (auto i = 0; i < range.size; ++i) {
+        const TRowSize size = fixedRowSize ? fixedRowSize.value() : sizes[i];
 
         // Write raw size. Needs to be in big endian order.
         *(TRowSize*)(rawBuffer + offset) = folly::Endian::big(size);
+        bufferOffsets[i] = offset + sizeof(TRowSize);
         offset += sizeof(TRowSize) + size;
       }
+
+      // Write the row data one column at a time.
+      unsafeRow.serialize(
+          range.begin, range.size, rawBuffer, bufferOffsets.data());
+      sizes += range.size;
     }
   }
 
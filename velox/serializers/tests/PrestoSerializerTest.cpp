@@ -172,6 +172,81 @@ TEST_F(PrestoSerializerTest, dictionaryWithExtraNulls) {
   testRoundTrip(dictionary);
 }
 
+/// Test serialization of a dictionary vector without extra nulls. It is
+/// serialized as a Presto dictionary block and comes back as a dictionary
+/// vector.
+TEST_F(PrestoSerializerTest, dictionary) {
+  vector_size_t size = 1'000;
+
+  auto base = vectorMaker_->flatVector<StringView>(
+      {"apple", "banana", "a cherry that is long enough to not be inlined"});
+
+  BufferPtr indices = allocateIndices(size, pool_.get());
+  auto rawIndices = indices->asMutable<vector_size_t>();
+  for (auto i = 0; i < size; i++) {
+    rawIndices[i] = i % 3;
+  }
+
+  auto dictionary =
+      BaseVector::wrapInDictionary(BufferPtr(nullptr), indices, size, base);
+
+  auto rowVector = vectorMaker_->rowVector({dictionary});
+  std::ostringstream out;
+  serialize(rowVector, &out, nullptr);
+
+  auto rowType = asRowType(rowVector->type());
+  auto deserialized = deserialize(rowType, out.str(), nullptr);
+  assertEqualVectors(rowVector, deserialized);
+  ASSERT_EQ(
+      VectorEncoding::Simple::DICTIONARY,
+      deserialized->childAt(0)->encoding());
+}
+
+/// Test appending a dictionary-encoded batch followed by a flat batch to the
+/// same serializer. The accumulated dictionary content is flattened and the
+/// page round trips.
+TEST_F(PrestoSerializerTest, dictionaryAcrossBatches) {
+  vector_size_t size = 100;
+
+  auto base = vectorMaker_->flatVector<int64_t>({100, 200, 300});
+
+  BufferPtr indices = allocateIndices(size, pool_.get());
+  auto rawIndices = indices->asMutable<vector_size_t>();
+  for (auto i = 0; i < size; i++) {
+    rawIndices[i] = i % 3;
+  }
+
+  auto dictionary = vectorMaker_->rowVector({
+      BaseVector::wrapInDictionary(BufferPtr(nullptr), indices, size, base),
+  });
+  auto flat = vectorMaker_->rowVector({
+      vectorMaker_->flatVector<int64_t>(
+          size, [](auto row) { return row * 7; }),
+  });
+
+  auto arena = std::make_unique<StreamArena>(pool_.get());
+  auto rowType = asRowType(dictionary->type());
+  auto serializer =
+      serde_->createSerializer(rowType, size * 2, arena.get(), nullptr);
+  serializer->append(dictionary);
+  serializer->append(flat);
+
+  std::ostringstream out;
+  OStreamOutputStream outputStream(&out);
+  serializer->flush(&outputStream);
+
+  auto expected = vectorMaker_->rowVector({
+      vectorMaker_->flatVector<int64_t>(
+          size * 2,
+          [&](auto row) {
+            return row < size ? (row % 3 + 1) * 100 : (row - size) * 7;
+          }),
+  });
+
+  auto deserialized = deserialize(rowType, out.str(), nullptr);
+  assertEqualVectors(expected, deserialized);
+}
+
 TEST_F(PrestoSerializerTest, emptyPage) {
   auto rowVector = vectorMaker_->rowVector(ROW({"a"}, {BIGINT()}), 0);
 
@@ -290,6 +365,60 @@ TEST_F(PrestoSerializerTest, multiPage) {
   ASSERT_TRUE(byteStream->atEnd());
 }
 
+TEST_F(PrestoSerializerTest, compression) {
+  for (auto codec :
+       {folly::io::CodecType::LZ4, folly::io::CodecType::ZSTD}) {
+    const serializer::presto::PrestoVectorSerde::PrestoOptions options(
+        false, codec);
+    testRoundTrip(makeTestVector(1'000), &options);
+
+    // An empty page compresses and round trips as well.
+    auto emptyRowVector = vectorMaker_->rowVector(ROW({"a"}, {BIGINT()}), 0);
+    std::ostringstream out;
+    serialize(emptyRowVector, &out, &options);
+    auto deserialized =
+        deserialize(asRowType(emptyRowVector->type()), out.str(), &options);
+    assertEqualVectors(deserialized, emptyRowVector);
+  }
+}
+
+TEST_F(PrestoSerializerTest, mixedCompressionMultiPage) {
+  // Pages with different codecs, including none, coexist in one stream. The
+  // codec is recorded in the page, so the reader does not need any options.
+  std::ostringstream out;
+
+  auto a = makeTestVector(1'234);
+  serialize(a, &out, nullptr);
+
+  const serializer::presto::PrestoVectorSerde::PrestoOptions lz4Options(
+      false, folly::io::CodecType::LZ4);
+  auto b = makeTestVector(538);
+  serialize(b, &out, &lz4Options);
+
+  const serializer::presto::PrestoVectorSerde::PrestoOptions zstdOptions(
+      false, folly::io::CodecType::ZSTD);
+  auto c = makeTestVector(2'048);
+  serialize(c, &out, &zstdOptions);
+
+  auto bytes = out.str();
+  auto rowType = asRowType(a->type());
+  auto byteStream = toByteStream(bytes);
+
+  RowVectorPtr deserialized;
+  serde_->deserialize(
+      byteStream.get(), pool_.get(), rowType, &deserialized, nullptr);
+  assertEqualVectors(deserialized, a);
+
+  serde_->deserialize(
+      byteStream.get(), pool_.get(), rowType, &deserialized, nullptr);
+  assertEqualVectors(deserialized, b);
+
+  serde_->deserialize(
+      byteStream.get(), pool_.get(), rowType, &deserialized, nullptr);
+  assertEqualVectors(deserialized, c);
+  ASSERT_TRUE(byteStream->atEnd());
+}
+
 TEST_F(PrestoSerializerTest, timestampWithNanosecondPrecision) {
   // Verify that nanosecond precision is preserved when the right options are
   // passed to the serde.
@@ -368,6 +497,85 @@ TEST_F(PrestoSerializerTest, rle) {
       MAP(VARCHAR(), INTEGER()), 17, pool_.get()));
 }
 
+TEST_F(PrestoSerializerTest, deserializeIntoRows) {
+  using serializer::presto::PrestoVectorSerde;
+  constexpr vector_size_t kNumRows = 1'000;
+
+  auto a = vectorMaker_->flatVector<int64_t>(
+      kNumRows,
+      [](auto row) { return row; },
+      [](auto row) { return row % 7 == 0; });
+  auto b = vectorMaker_->flatVector<double>(
+      kNumRows,
+      [](auto row) { return row * 0.1; },
+      [](auto row) { return row % 11 == 0; });
+  auto c = vectorMaker_->flatVector<int32_t>(
+      kNumRows, [](auto row) { return row * 2; });
+  auto d = vectorMaker_->flatVector<bool>(
+      kNumRows, [](auto row) { return row % 3 == 0; });
+  auto rowVector = vectorMaker_->rowVector({a, b, c, d});
+  auto rowType = asRowType(rowVector->type());
+
+  EXPECT_TRUE(PrestoVectorSerde::supportsDeserializeIntoRows(rowType));
+  EXPECT_FALSE(
+      PrestoVectorSerde::supportsDeserializeIntoRows(ROW({VARCHAR()})));
+  EXPECT_FALSE(
+      PrestoVectorSerde::supportsDeserializeIntoRows(ROW({ARRAY(BIGINT())})));
+
+  std::ostringstream out;
+  serialize(rowVector, &out, nullptr);
+
+  // Row layout: a null byte, then the values of the four columns. 'c' has
+  // no null flag.
+  constexpr int32_t kRowSize = 32;
+  const std::vector<PrestoVectorSerde::RowColumnInfo> columns = {
+      {8, 0, 1}, {16, 0, 2}, {24, 0, 0}, {28, 0, 4}};
+
+  std::vector<char> buffer;
+  std::vector<char*> rows;
+  auto byteStream = toByteStream(out.str());
+  serde_->deserializeIntoRows(
+      byteStream.get(), rowType, columns, [&](int32_t numRows) {
+        buffer.resize(numRows * kRowSize, 0);
+        rows.resize(numRows);
+        for (auto i = 0; i < numRows; ++i) {
+          rows[i] = buffer.data() + i * kRowSize;
+        }
+        return rows.data();
+      });
+
+  ASSERT_EQ(kNumRows, rows.size());
+  for (vector_size_t i = 0; i < kNumRows; ++i) {
+    const char* row = rows[i];
+    EXPECT_EQ(a->isNullAt(i), (row[0] & 1) != 0) << "at " << i;
+    if (!a->isNullAt(i)) {
+      EXPECT_EQ(a->valueAt(i), *reinterpret_cast<const int64_t*>(row + 8));
+    }
+    EXPECT_EQ(b->isNullAt(i), (row[0] & 2) != 0) << "at " << i;
+    if (!b->isNullAt(i)) {
+      EXPECT_EQ(b->valueAt(i), *reinterpret_cast<const double*>(row + 16));
+    }
+    EXPECT_EQ(c->valueAt(i), *reinterpret_cast<const int32_t*>(row + 24));
+    EXPECT_EQ(d->valueAt(i), *reinterpret_cast<const bool*>(row + 28));
+  }
+
+  // A null in a column with no null flag in the row is an error.
+  auto nullableC = vectorMaker_->flatVector<int32_t>(
+      kNumRows,
+      [](auto row) { return row; },
+      [](auto row) { return row == 5; });
+  std::ostringstream badOut;
+  serialize(vectorMaker_->rowVector({a, b, nullableC, d}), &badOut, nullptr);
+  auto badStream = toByteStream(badOut.str());
+  VELOX_ASSERT_THROW(
+      serde_->deserializeIntoRows(
+          badStream.get(),
+          rowType,
+          columns,
+          [&](int32_t /*numRows*/) { return rows.data(); }),
+      "no null flag");
+}
+
 TEST_F(PrestoSerializerTest, lazy) {
   constexpr int kSize = 1000;
   auto rowVector = makeTestVector(kSize);
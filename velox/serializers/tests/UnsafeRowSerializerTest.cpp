@@ -170,6 +170,37 @@ TEST_F(UnsafeRowSerializerTest, manyRows) {
   testDeserialize(data, 140, expected);
 }
 
+TEST_F(UnsafeRowSerializerTest, batched) {
+  // Appending all rows as a single range must produce the same bytes as
+  // appending them row by row.
+  auto rowVector = makeRowVector({
+      makeNullableFlatVector<int64_t>({1, std::nullopt, 3, 4}),
+      makeNullableFlatVector<StringView>(
+          {"a string long enough to not be inlined",
+           "b",
+           std::nullopt,
+           "d"}),
+  });
+
+  std::ostringstream rowByRow;
+  serialize(rowVector, &rowByRow);
+
+  IndexRange range{0, rowVector->size()};
+  auto arena = std::make_unique<StreamArena>(pool_.get());
+  auto serializer = serde_->createSerializer(
+      asRowType(rowVector->type()), rowVector->size(), arena.get());
+  serializer->append(rowVector, folly::Range(&range, 1));
+
+  std::ostringstream batched;
+  OStreamOutputStream out(&batched);
+  serializer->flush(&out);
+
+  EXPECT_EQ(rowByRow.str(), batched.str());
+
+  auto deserialized = deserialize(asRowType(rowVector->type()), batched.str());
+  test::assertEqualVectors(rowVector, deserialized);
+}
+
 TEST_F(UnsafeRowSerializerTest, types) {
   auto rowType = ROW(
       {BOOLEAN(),
@@ -560,6 +560,17 @@ core::PlanNodePtr SubstraitVeloxPlanConverter::toVeloxPlan(
 
 core::PlanNodePtr SubstraitVeloxPlanConverter::toVeloxPlan(
     const ::substrait::Plan& substraitPlan) {
+  std::string cacheKey;
+  if (planCache_ != nullptr) {
+    // The serialized bytes identify the plan, so identical re-submissions
+    // reuse the converted plan tree and the split info map.
+    cacheKey = substraitPlan.SerializeAsString();
+    if (auto cached = planCache_->find(cacheKey)) {
+      splitInfoMap_ = cached->splitInfos;
+      return cached->plan;
+    }
+  }
+
   VELOX_CHECK(
       checkTypeExtension(substraitPlan),
       "The type extension only have unknown type.")
@@ -573,14 +584,36 @@ core::PlanNodePtr SubstraitVeloxPlanConverter::toVeloxPlan(
   // In fact, only one RelRoot or Rel is expected here.
   VELOX_CHECK_EQ(substraitPlan.relations_size(), 1);
   const auto& rel = substraitPlan.relations(0);
+  core::PlanNodePtr plan;
   if (rel.has_root()) {
-    return toVeloxPlan(rel.root());
+    plan = toVeloxPlan(rel.root());
+  } else if (rel.has_rel()) {
+    plan = toVeloxPlan(rel.rel());
+  } else {
+    VELOX_FAIL("RelRoot or Rel is expected in Plan.");
   }
-  if (rel.has_rel()) {
-    return toVeloxPlan(rel.rel());
+
+  if (planCache_ != nullptr) {
+    planCache_->put(cacheKey, plan, splitInfoMap_);
   }
+  return plan;
+}
+
+std::shared_ptr<const SubstraitVeloxPlanCache::CachedPlan>
+SubstraitVeloxPlanCache::find(const std::string& key) {
+  std::lock_guard<std::mutex> l(mutex_);
+  auto cached = cache_.get(key);
+  return cached.has_value() ? cached.value() : nullptr;
+}
 
-  VELOX_FAIL("RelRoot or Rel is expected in Plan.");
+void SubstraitVeloxPlanCache::put(
+    const std::string& key,
+    core::PlanNodePtr plan,
+    SplitInfoMap splitInfos) {
+  auto cached = std::make_shared<const CachedPlan>(
+      CachedPlan{std::move(plan), std::move(splitInfos)});
+  std::lock_guard<std::mutex> l(mutex_);
+  cache_.add(key, cached);
 }
 
 std::string SubstraitVeloxPlanConverter::nextPlanNodeId() {
@@ -16,17 +16,26 @@
 
 #pragma once
 
+#include "velox/common/caching/SimpleLRUCache.h"
 #include "velox/connectors/hive/HiveConnector.h"
 #include "velox/core/PlanNode.h"
 #include "velox/substrait/SubstraitToVeloxExpr.h"
 
 namespace facebook::velox::substrait {
 
+class SubstraitVeloxPlanCache;
+
 /// This class is used to convert the Substrait plan into Velox plan.
 class SubstraitVeloxPlanConverter {
  public:
-  explicit SubstraitVeloxPlanConverter(memory::MemoryPool* pool)
-      : pool_(pool) {}
+  /// 'planCache', if provided, is consulted before converting a whole
+  /// Substrait plan and filled after a conversion, so that repeated
+  /// submissions of an identical plan skip re-conversion. The cache may be
+  /// shared between converters.
+  explicit SubstraitVeloxPlanConverter(
+      memory::MemoryPool* pool,
+      std::shared_ptr<SubstraitVeloxPlanCache> planCache = nullptr)
+      : pool_(pool), planCache_(std::move(planCache)) {}
   struct SplitInfo {
     /// The Partition index.
     u_int32_t partitionIndex;
@@ -169,6 +178,9 @@ class SubstraitVeloxPlanConverter {
   /// Memory pool.
   memory::MemoryPool* pool_;
 
+  /// Optional cache of converted plans, see the constructor.
+  std::shared_ptr<SubstraitVeloxPlanCache> planCache_;
+
   /// Helper function to convert the input of Substrait Rel to Velox Node.
   template <typename T>
   core::PlanNodePtr convertSingleInput(T rel) {
@@ -177,4 +189,41 @@ class SubstraitVeloxPlanConverter {
   }
 };
 
+/// Thread-safe LRU cache of converted Substrait plans, keyed by the
+/// serialized plan bytes. A cached entry holds the immutable Velox plan tree
+/// and the split info map produced by the conversion, so a hit restores the
+/// full result of SubstraitVeloxPlanConverter::toVeloxPlan for a plan.
+class SubstraitVeloxPlanCache {
+ public:
+  using SplitInfoMap = std::unordered_map<
+      core::PlanNodeId,
+      std::shared_ptr<SubstraitVeloxPlanConverter::SplitInfo>>;
+
+  struct CachedPlan {
+    core::PlanNodePtr plan;
+    SplitInfoMap splitInfos;
+  };
+
+  static constexpr size_t kDefaultMaxSize = 100;
+
+  /// Constructs a cache holding at most 'maxSize' converted plans.
+  explicit SubstraitVeloxPlanCache(size_t maxSize = kDefaultMaxSize)
+      : cache_(maxSize) {}
+
+  /// Returns the cached conversion of the plan whose serialized bytes are
+  /// 'key', nullptr on miss.
+  std::shared_ptr<const CachedPlan> find(const std::string& key);
+
+  /// Caches 'plan' and 'splitInfos' as the conversion of the plan whose
+  /// serialized bytes are 'key'.
+  void put(
+      const std::string& key,
+      core::PlanNodePtr plan,
+      SplitInfoMap splitInfos);
+
+ private:
+  std::mutex mutex_;
+  SimpleLRUCache<std::string, std::shared_ptr<const CachedPlan>> cache_;
+};
+
 } // namespace facebook::velox::substrait
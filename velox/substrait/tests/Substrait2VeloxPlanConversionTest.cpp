@@ -286,3 +286,44 @@ TEST_F(Substrait2VeloxPlanConversionTest, q6) {
       .splits(makeSplits(planConverter, planNode))
       .assertResults(expectedResult);
 }
+
+TEST_F(Substrait2VeloxPlanConversionTest, planCache) {
+  // Find and deserialize Substrait plan json file.
+  std::string planPath =
+      getDataFilePath("velox/substrait/tests", "data/q6_first_stage.json");
+
+  ::substrait::Plan substraitPlan;
+  JsonToProtoConverter::readFromFile(planPath, substraitPlan);
+
+  auto planCache =
+      std::make_shared<facebook::velox::substrait::SubstraitVeloxPlanCache>();
+
+  // The first conversion populates the cache.
+  facebook::velox::substrait::SubstraitVeloxPlanConverter planConverter(
+      pool_.get(), planCache);
+  auto planNode = planConverter.toVeloxPlan(substraitPlan);
+
+  // Re-submitting the identical plan through another converter reuses the
+  // converted plan tree and the split info map.
+  facebook::velox::substrait::SubstraitVeloxPlanConverter cachedConverter(
+      pool_.get(), planCache);
+  auto cachedPlanNode = cachedConverter.toVeloxPlan(substraitPlan);
+  ASSERT_EQ(planNode.get(), cachedPlanNode.get());
+  ASSERT_EQ(
+      planConverter.splitInfos().size(), cachedConverter.splitInfos().size());
+  for (const auto& [nodeId, splitInfo] : planConverter.splitInfos()) {
+    ASSERT_EQ(splitInfo.get(), cachedConverter.splitInfos().at(nodeId).get());
+  }
+
+  // A different plan misses the cache and converts from scratch.
+  ::substrait::Plan otherPlan;
+  JsonToProtoConverter::readFromFile(planPath, otherPlan);
+  otherPlan.mutable_relations(0)
+      ->mutable_root()
+      ->mutable_names()
+      ->RemoveLast();
+  facebook::velox::substrait::SubstraitVeloxPlanConverter otherConverter(
+      pool_.get(), planCache);
+  auto otherPlanNode = otherConverter.toVeloxPlan(otherPlan);
+  ASSERT_NE(planNode.get(), otherPlanNode.get());
+}
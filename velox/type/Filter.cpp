@@ -122,6 +122,7 @@ std::unordered_map<FilterKind, std::string> filterKindNames() {
       {FilterKind::kBigintMultiRange, "kBigintMultiRange"},
       {FilterKind::kMultiRange, "kMultiRange"},
       {FilterKind::kHugeintRange, "kHugeintRange"},
+      {FilterKind::kBigintBloomFilter, "kBigintBloomFilter"},
   };
 }
 
@@ -174,6 +175,7 @@ void Filter::registerSerDe() {
   registry.Register("BigintMultiRange", BigintMultiRange::create);
   registry.Register("NegatedBytesValues", NegatedBytesValues::create);
   registry.Register("MultiRange", MultiRange::create);
+  registry.Register("BigintBloomFilter", BigintBloomFilter::create);
 }
 
 folly::dynamic Filter::serializeBase(std::string_view name) const {
@@ -443,6 +445,35 @@ bool NegatedBigintValuesUsingBitmask::testingEquals(const Filter& other) const {
       nonNegated_->testingEquals(*(otherNegatedBigintValues->nonNegated_));
 }
 
+folly::dynamic BigintBloomFilter::serialize() const {
+  auto obj = Filter::serializeBase("BigintBloomFilter");
+  folly::dynamic bits = folly::dynamic::array;
+  for (auto word : bloomFilter_.bits()) {
+    bits.push_back(static_cast<int64_t>(word));
+  }
+  obj["bits"] = bits;
+  return obj;
+}
+
+FilterPtr BigintBloomFilter::create(const folly::dynamic& obj) {
+  auto nullAllowed = deserializeNullAllowed(obj);
+  std::vector<uint64_t> bits;
+  bits.reserve(obj["bits"].size());
+  for (const auto& word : obj["bits"]) {
+    bits.push_back(static_cast<uint64_t>(word.asInt()));
+  }
+  BloomFilter<> bloomFilter;
+  bloomFilter.setBits(std::move(bits));
+  return std::make_unique<BigintBloomFilter>(
+      std::move(bloomFilter), nullAllowed);
+}
+
+bool BigintBloomFilter::testingEquals(const Filter& other) const {
+  auto otherBloomFilter = dynamic_cast<const BigintBloomFilter*>(&other);
+  return otherBloomFilter != nullptr && Filter::testingBaseEquals(other) &&
+      bloomFilter_.bits() == otherBloomFilter->bloomFilter_.bits();
+}
+
 template <>
 folly::dynamic FloatingPointRange<float>::serialize() const {
   auto obj = AbstractRange::serializeBase("FloatRange");
@@ -1712,6 +1743,7 @@ std::unique_ptr<Filter> BigintRange::mergeWith(const Filter* other) const {
     case FilterKind::kAlwaysTrue:
     case FilterKind::kAlwaysFalse:
     case FilterKind::kIsNull:
+    case FilterKind::kBigintBloomFilter:
       return other->mergeWith(this);
     case FilterKind::kIsNotNull:
       return std::make_unique<BigintRange>(lower_, upper_, false);
@@ -1780,6 +1812,7 @@ std::unique_ptr<Filter> NegatedBigintRange::mergeWith(
     case FilterKind::kAlwaysTrue:
     case FilterKind::kAlwaysFalse:
     case FilterKind::kIsNull:
+    case FilterKind::kBigintBloomFilter:
       return other->mergeWith(this);
     case FilterKind::kIsNotNull:
       return this->clone(false);
@@ -1873,6 +1906,7 @@ std::unique_ptr<Filter> BigintValuesUsingHashTable::mergeWith(
     case FilterKind::kAlwaysTrue:
     case FilterKind::kAlwaysFalse:
     case FilterKind::kIsNull:
+    case FilterKind::kBigintBloomFilter:
       return other->mergeWith(this);
     case FilterKind::kIsNotNull:
       return std::make_unique<BigintValuesUsingHashTable>(*this, false);
@@ -1964,6 +1998,7 @@ std::unique_ptr<Filter> BigintValuesUsingBitmask::mergeWith(
     case FilterKind::kAlwaysTrue:
     case FilterKind::kAlwaysFalse:
     case FilterKind::kIsNull:
+    case FilterKind::kBigintBloomFilter:
       return other->mergeWith(this);
     case FilterKind::kIsNotNull:
       return std::make_unique<BigintValuesUsingBitmask>(*this, false);
@@ -2047,6 +2082,7 @@ std::unique_ptr<Filter> NegatedBigintValuesUsingHashTable::mergeWith(
     case FilterKind::kAlwaysTrue:
     case FilterKind::kAlwaysFalse:
     case FilterKind::kIsNull:
+    case FilterKind::kBigintBloomFilter:
       return other->mergeWith(this);
     case FilterKind::kIsNotNull:
       return std::make_unique<NegatedBigintValuesUsingHashTable>(*this, false);
@@ -2086,6 +2122,7 @@ std::unique_ptr<Filter> NegatedBigintValuesUsingBitmask::mergeWith(
     case FilterKind::kAlwaysTrue:
     case FilterKind::kAlwaysFalse:
     case FilterKind::kIsNull:
+    case FilterKind::kBigintBloomFilter:
       return other->mergeWith(this);
     case FilterKind::kIsNotNull:
       return std::make_unique<NegatedBigintValuesUsingBitmask>(*this, false);
@@ -2116,11 +2153,56 @@ std::unique_ptr<Filter> NegatedBigintValuesUsingBitmask::mergeWith(
   }
 }
 
+std::unique_ptr<Filter> BigintBloomFilter::mergeWith(
+    const Filter* other) const {
+  switch (other->kind()) {
+    case FilterKind::kAlwaysTrue:
+    case FilterKind::kAlwaysFalse:
+    case FilterKind::kIsNull:
+      return other->mergeWith(this);
+    case FilterKind::kIsNotNull:
+      return std::make_unique<BigintBloomFilter>(*this, false);
+    case FilterKind::kBigintValuesUsingHashTable:
+    case FilterKind::kBigintValuesUsingBitmask: {
+      // The other filter enumerates its values; keep only the ones that may
+      // be in the Bloom filter.
+      bool bothNullAllowed = nullAllowed_ && other->testNull();
+      std::vector<int64_t> values;
+      if (other->kind() == FilterKind::kBigintValuesUsingHashTable) {
+        values = static_cast<const BigintValuesUsingHashTable*>(other)->values();
+      } else {
+        values = static_cast<const BigintValuesUsingBitmask*>(other)->values();
+      }
+      std::vector<int64_t> valuesToKeep;
+      valuesToKeep.reserve(values.size());
+      for (auto value : values) {
+        if (testInt64(value)) {
+          valuesToKeep.push_back(value);
+        }
+      }
+      return createBigintValues(valuesToKeep, bothNullAllowed);
+    }
+    case FilterKind::kBigintRange: {
+      bool bothNullAllowed = nullAllowed_ && other->testNull();
+      auto otherRange = static_cast<const BigintRange*>(other);
+      if (otherRange->isSingleValue() && !testInt64(otherRange->lower())) {
+        return nullOrFalse(bothNullAllowed);
+      }
+      return other->clone(bothNullAllowed);
+    }
+    default:
+      // A Bloom filter is an over-approximation, so dropping it in favor of
+      // the exact filter keeps the merge correct.
+      return other->clone(nullAllowed_ && other->testNull());
+  }
+}
+
 std::unique_ptr<Filter> BigintMultiRange::mergeWith(const Filter* other) const {
   switch (other->kind()) {
     case FilterKind::kAlwaysTrue:
     case FilterKind::kAlwaysFalse:
     case FilterKind::kIsNull:
+    case FilterKind::kBigintBloomFilter:
       return other->mergeWith(this);
     case FilterKind::kIsNotNull: {
       std::vector<std::unique_ptr<BigintRange>> ranges;
@@ -24,7 +24,9 @@
 
 #include <folly/Range.h>
 #include <folly/container/F14Set.h>
+#include <folly/hash/Hash.h>
 
+#include "velox/common/base/BloomFilter.h"
 #include "velox/common/base/Exceptions.h"
 #include "velox/common/base/SimdUtil.h"
 #include "velox/common/serialization/Serializable.h"
@@ -55,6 +57,7 @@ enum class FilterKind {
   kBigintMultiRange,
   kMultiRange,
   kHugeintRange,
+  kBigintBloomFilter,
 };
 
 class Filter;
@@ -1125,6 +1128,67 @@ class NegatedBigintValuesUsingBitmask final : public Filter {
   std::unique_ptr<BigintValuesUsingBitmask> nonNegated_;
 };
 
+/// Approximate IN-list filter for integral data types backed by a Bloom
+/// filter. Used for runtime filters built over the build side keys of a hash
+/// join when the set of distinct keys is too large to enumerate. May pass
+/// values that are not in the set (false positives) but never drops values
+/// that are, so the consumer must re-evaluate the exact condition on the
+/// passing rows.
+class BigintBloomFilter final : public Filter {
+ public:
+  /// @param bloomFilter Bloom filter over the hashes of the passing values.
+  /// Values are hashed with folly::hasher<int64_t> before insert and test.
+  /// @param nullAllowed Null values are passing the filter if true.
+  BigintBloomFilter(BloomFilter<> bloomFilter, bool nullAllowed)
+      : Filter(true, nullAllowed, FilterKind::kBigintBloomFilter),
+        bloomFilter_(std::move(bloomFilter)) {
+    VELOX_CHECK(bloomFilter_.isSet());
+  }
+
+  BigintBloomFilter(const BigintBloomFilter& other, bool nullAllowed)
+      : Filter(true, nullAllowed, FilterKind::kBigintBloomFilter),
+        bloomFilter_(other.bloomFilter_) {}
+
+  folly::dynamic serialize() const override;
+
+  static FilterPtr create(const folly::dynamic& obj);
+
+  std::unique_ptr<Filter> clone(
+      std::optional<bool> nullAllowed = std::nullopt) const final {
+    return std::make_unique<BigintBloomFilter>(
+        *this, nullAllowed.value_or(nullAllowed_));
+  }
+
+  bool testInt64(int64_t value) const final {
+    return bloomFilter_.mayContain(folly::hasher<int64_t>()(value));
+  }
+
+  bool testInt64Range(int64_t min, int64_t max, bool hasNull) const final {
+    if (hasNull && nullAllowed_) {
+      return true;
+    }
+    if (min == max) {
+      return testInt64(min);
+    }
+    // The Bloom filter cannot decide ranges of more than one value.
+    return true;
+  }
+
+  std::unique_ptr<Filter> mergeWith(const Filter* other) const final;
+
+  std::string toString() const final {
+    return fmt::format(
+        "BigintBloomFilter: {} words {}",
+        bloomFilter_.bits().size(),
+        nullAllowed_ ? "with nulls" : "no nulls");
+  }
+
+  bool testingEquals(const Filter& other) const final;
+
+ private:
+  BloomFilter<> bloomFilter_;
+};
+
 /// Base class for range filters on floating point and string data types.
 class AbstractRange : public Filter {
  public:
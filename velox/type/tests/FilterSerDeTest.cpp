@@ -93,6 +93,16 @@ TEST_F(FilterSerDeTest, valuesFilters) {
   }
 }
 
+TEST_F(FilterSerDeTest, bigintBloomFilter) {
+  BloomFilter<> bloom;
+  bloom.reset(100);
+  for (int64_t i = 0; i < 100; ++i) {
+    bloom.insert(folly::hasher<int64_t>()(i * 13));
+  }
+  testSerde(BigintBloomFilter(bloom, true));
+  testSerde(BigintBloomFilter(std::move(bloom), false));
+}
+
 TEST_F(FilterSerDeTest, rangeFilters) {
   FloatRange floatRange(1.0, true, true, 124.5, false, true, false);
   testSerde(floatRange);
@@ -454,6 +454,54 @@ TEST(FilterTest, bigintValuesUsingBitmask) {
   EXPECT_FALSE(filter->testInt64Range(1234, 2000, false));
 }
 
+TEST(FilterTest, bigintBloomFilter) {
+  BloomFilter<> bloom;
+  bloom.reset(4);
+  for (int64_t value : {1, 10, 100, 1000}) {
+    bloom.insert(folly::hasher<int64_t>()(value));
+  }
+  BigintBloomFilter filter(std::move(bloom), false);
+
+  // No false negatives.
+  EXPECT_TRUE(filter.testInt64(1));
+  EXPECT_TRUE(filter.testInt64(10));
+  EXPECT_TRUE(filter.testInt64(100));
+  EXPECT_TRUE(filter.testInt64(1000));
+
+  EXPECT_FALSE(filter.testNull());
+
+  // Values outside the set are mostly rejected; occasional false positives
+  // are allowed.
+  int32_t numPassing = 0;
+  for (int64_t value = 2'000; value < 3'000; ++value) {
+    numPassing += filter.testInt64(value);
+  }
+  EXPECT_LT(numPassing, 100);
+
+  // Multi-value ranges cannot be decided; single-value ranges follow
+  // testInt64.
+  EXPECT_TRUE(filter.testInt64Range(5, 50, false));
+  EXPECT_TRUE(filter.testInt64Range(10, 10, false));
+  EXPECT_EQ(filter.testInt64Range(11, 11, false), filter.testInt64(11));
+
+  // Merging with an exact values filter drops the values that cannot be in
+  // the Bloom filter.
+  auto values = createBigintValues({1, 10, 2'000'000'000'017}, false);
+  auto merged = values->mergeWith(&filter);
+  EXPECT_TRUE(merged->testInt64(1));
+  EXPECT_TRUE(merged->testInt64(10));
+  EXPECT_EQ(
+      merged->testInt64(2'000'000'000'017),
+      filter.testInt64(2'000'000'000'017));
+
+  // Merging with a filter the Bloom filter cannot prune keeps the exact
+  // filter.
+  BigintRange range(0, 100, false);
+  merged = range.mergeWith(&filter);
+  EXPECT_TRUE(merged->testInt64(1));
+  EXPECT_FALSE(merged->testInt64(101));
+}
+
 TEST(FilterTest, negatedBigintValuesUsingBitmask) {
   auto filter = createNegatedBigintValues({1, 6, 1000, 8, 9, 100, 10}, false);
   auto castedFilter =
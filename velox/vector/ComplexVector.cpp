@@ -268,8 +268,17 @@ void RowVector::copyRanges(
   }
 
   DecodedVector decoded(*source);
-  if (decoded.isIdentityMapping() && !decoded.mayHaveNulls()) {
-    if (rawNulls_) {
+  if (decoded.isIdentityMapping()) {
+    if (decoded.mayHaveNulls()) {
+      // Copy the null flags in bulk. Children of null rows hold
+      // arbitrary values, so they can be copied unconditionally.
+      auto* rawNulls = mutableRawNulls();
+      const auto* sourceNulls = decoded.nulls();
+      for (auto& r : ranges) {
+        bits::copyBits(
+            sourceNulls, r.sourceIndex, rawNulls, r.targetIndex, r.count);
+      }
+    } else if (rawNulls_) {
       auto* rawNulls = mutableRawNulls();
       for (auto& r : ranges) {
         bits::fillBits(rawNulls, r.targetIndex, r.count, bits::kNotNull);
@@ -414,10 +423,10 @@ void ArrayVectorBase::copyRangesImpl(
     // A null constant does not have a value vector, so wrappedVector
     // returns the constant.
     VELOX_CHECK(sourceValue->isNullAt(0));
+    auto* rawNulls = mutableRawNulls();
     for (auto& r : ranges) {
-      for (auto i = 0; i < r.count; ++i) {
-        setNull(r.targetIndex + i, true);
-      }
+      bits::fillBits(
+          rawNulls, r.targetIndex, r.targetIndex + r.count, bits::kNull);
     }
     return;
   }
@@ -50,6 +50,9 @@ void DecodedVector::decode(
     const BaseVector& vector,
     const SelectivityVector* rows,
     bool loadLazy) {
+  if (tryReuseCachedDecode(vector, rows, loadLazy)) {
+    return;
+  }
   reset(end(vector.size(), rows));
   loadLazy_ = loadLazy;
   bool isTopLevelLazyAndLoaded =
@@ -84,6 +87,7 @@ void DecodedVector::decode(
     case VectorEncoding::Simple::DICTIONARY:
     case VectorEncoding::Simple::SEQUENCE: {
       combineWrappers(&vector, rows);
+      maybeCacheDecode(vector, rows);
       break;
     }
     default:
@@ -105,7 +109,75 @@ void DecodedVector::makeIndices(
   combineWrappers(&vector, rows, numLevels);
 }
 
+bool DecodedVector::tryReuseCachedDecode(
+    const BaseVector& vector,
+    const SelectivityVector* rows,
+    bool loadLazy) {
+  if (cachedWrappings_.empty() || loadLazy != loadLazy_ ||
+      vector.encoding() != VectorEncoding::Simple::DICTIONARY) {
+    return false;
+  }
+  const auto newSize = end(vector.size(), rows);
+  if (newSize > cachedSize_) {
+    return false;
+  }
+  const BaseVector* current = &vector;
+  for (const auto& wrapping : cachedWrappings_) {
+    if (current->encoding() != VectorEncoding::Simple::DICTIONARY ||
+        current->wrapInfo().get() != wrapping.indices.get() ||
+        current->nulls().get() != wrapping.nulls.get()) {
+      return false;
+    }
+    current = current->valueVector().get();
+  }
+  if (current != baseVector_ ||
+      current->values().get() != cachedBaseValues_.get() ||
+      current->nulls().get() != cachedBaseNulls_.get()) {
+    return false;
+  }
+  size_ = newSize;
+  return true;
+}
+
+void DecodedVector::maybeCacheDecode(
+    const BaseVector& vector,
+    const SelectivityVector* rows) {
+  // The decoded state is only valid for the selected rows, so remember it
+  // only when the decode covered all rows in its range.
+  if (rows != nullptr && !rows->isAllSelected()) {
+    return;
+  }
+  const BaseVector* current = &vector;
+  while (current->encoding() == VectorEncoding::Simple::DICTIONARY) {
+    cachedWrappings_.push_back({current->wrapInfo(), current->nulls()});
+    current = current->valueVector().get();
+  }
+  // Cache only pure dictionary chains over a flat or complex base. If the
+  // walk did not end at the decoded base, the chain contains lazy, constant
+  // or sequence layers whose state cannot be revalidated by buffer identity.
+  if (cachedWrappings_.empty() || current != baseVector_) {
+    cachedWrappings_.clear();
+    return;
+  }
+  switch (current->encoding()) {
+    case VectorEncoding::Simple::FLAT:
+    case VectorEncoding::Simple::ROW:
+    case VectorEncoding::Simple::ARRAY:
+    case VectorEncoding::Simple::MAP:
+      break;
+    default:
+      cachedWrappings_.clear();
+      return;
+  }
+  cachedBaseValues_ = current->values();
+  cachedBaseNulls_ = current->nulls();
+  cachedSize_ = size_;
+}
+
 void DecodedVector::reset(vector_size_t size) {
+  cachedWrappings_.clear();
+  cachedBaseValues_ = nullptr;
+  cachedBaseNulls_ = nullptr;
   size_ = size;
   indices_ = nullptr;
   data_ = nullptr;
@@ -355,6 +427,12 @@ void DecodedVector::setFlatNulls(
       }
     });
     nulls_ = &copiedNulls_[0];
+  } else if (vector.getNullCount().value_or(1) == 0) {
+    // The producer asserted that the vector has no nulls, e.g. a scan
+    // of a non-null column. A nulls buffer may still be attached;
+    // ignore it so that consumers take the null-free path.
+    nulls_ = nullptr;
+    mayHaveNulls_ = false;
   } else {
     nulls_ = vector.rawNulls();
     mayHaveNulls_ = nulls_ != nullptr;
@@ -358,6 +358,22 @@ class DecodedVector {
 
   void reset(vector_size_t size);
 
+  // Checks whether 'vector' has the same dictionary wrappers and base
+  // buffers as the last full decode and, if so, reuses the decoded state
+  // without re-walking the encoding tree. Returns true on reuse.
+  bool tryReuseCachedDecode(
+      const BaseVector& vector,
+      const SelectivityVector* rows,
+      bool loadLazy);
+
+  // Remembers the identities of the dictionary wrappers and base buffers of
+  // 'vector' so that decoding the same layering again, e.g. the next batch
+  // from the same column reader, can skip the full decode. Only applies to
+  // pure dictionary-over-flat/complex chains decoded for all rows.
+  void maybeCacheDecode(
+      const BaseVector& vector,
+      const SelectivityVector* rows);
+
   // If `rows` is null applies the `func` to all rows in [0, size_)
   // otherwise, applies it to selected rows only.
   template <typename Func>
@@ -433,6 +449,26 @@ class DecodedVector {
   // dictionary and base values.
   std::vector<uint64_t> copiedNulls_;
 
+  // One dictionary layer remembered for fast revalidation. The buffers are
+  // referenced so that their addresses stay unique while cached and
+  // copy-on-write paths make a new buffer instead of mutating in place.
+  struct CachedWrapping {
+    BufferPtr indices;
+    BufferPtr nulls;
+  };
+
+  // Dictionary layers of the last decode, outermost first. Empty if the
+  // last decoded state cannot be reused.
+  std::vector<CachedWrapping> cachedWrappings_;
+
+  // Values and nulls buffers of the base vector of the last decode, set if
+  // 'cachedWrappings_' is not empty.
+  BufferPtr cachedBaseValues_;
+  BufferPtr cachedBaseNulls_;
+
+  // Number of rows covered by the cached decode.
+  vector_size_t cachedSize_ = 0;
+
   // Used as 'nulls_' for a null constant vector.
   static uint64_t constantNullMask_;
 };
@@ -285,6 +285,34 @@ void FlatVector<T>::copyValuesAndNulls(
       bits::fillBits(
           rawNulls, targetIndex, targetIndex + count, bits::kNotNull);
     }
+  } else if (
+      (sizeof(T) == 4 || sizeof(T) == 8) && Buffer::is_pod_like_v<T> &&
+      source->encoding() == VectorEncoding::Simple::DICTIONARY &&
+      !source->mayHaveNulls() && source->valueVector()->isFlatEncoding() &&
+      source->valueVector()->typeKind() != TypeKind::UNKNOWN) {
+    // Single level of null-free dictionary over flat values: translate
+    // the indices and gather the values in bulk instead of making a
+    // virtual call per element.
+    if constexpr (
+        (sizeof(T) == 4 || sizeof(T) == 8) && Buffer::is_pod_like_v<T>) {
+      const T* sourceValues =
+          source->valueVector()->asUnchecked<FlatVector<T>>()->rawValues();
+      const vector_size_t* indices =
+          source->wrapInfo()->as<vector_size_t>() + sourceIndex;
+      constexpr int32_t kWidth = xsimd::batch<T>::size;
+      vector_size_t i = 0;
+      for (; i + kWidth <= count; i += kWidth) {
+        simd::gather(sourceValues, indices + i)
+            .store_unaligned(rawValues_ + targetIndex + i);
+      }
+      for (; i < count; ++i) {
+        rawValues_[targetIndex + i] = sourceValues[indices[i]];
+      }
+      if (rawNulls) {
+        bits::fillBits(
+            rawNulls, targetIndex, targetIndex + count, bits::kNotNull);
+      }
+    }
   } else {
     auto sourceVector = source->asUnchecked<SimpleVector<T>>();
     for (int32_t i = 0; i < count; ++i) {
@@ -15,6 +15,9 @@
  */
 
 #include "velox/vector/FlatVector.h"
+
+#include <limits>
+
 #include "velox/vector/ComplexVector.h"
 #include "velox/vector/ConstantVector.h"
 #include "velox/vector/TypeAliases.h"
@@ -259,6 +262,66 @@ void FlatVector<StringView>::prepareForReuse() {
   }
 }
 
+template <>
+void FlatVector<StringView>::compactStringBuffers() {
+  if (stringBuffers_.empty()) {
+    return;
+  }
+
+  // The StringViews are rewritten in place, so the values buffer must be
+  // uniquely owned and mutable.
+  if (!values_ || !values_->unique() || !values_->isMutable()) {
+    return;
+  }
+
+  // Count the bytes referenced by non-inlined strings. Strings appearing in
+  // multiple rows are counted (and later copied) once per row; this
+  // overestimate is safe since it only makes compaction less likely.
+  uint64_t referencedBytes = 0;
+  for (auto i = 0; i < BaseVector::length_; ++i) {
+    if (BaseVector::rawNulls_ && bits::isBitNull(BaseVector::rawNulls_, i)) {
+      continue;
+    }
+    if (!rawValues_[i].isInline()) {
+      referencedBytes += rawValues_[i].size();
+    }
+  }
+
+  if (referencedBytes == 0) {
+    clearStringBuffers();
+    return;
+  }
+
+  uint64_t retainedBytes = 0;
+  for (const auto& buffer : stringBuffers_) {
+    retainedBytes += buffer->capacity();
+  }
+  if (retainedBytes < referencedBytes * kStringBufferCompactionFactor) {
+    return;
+  }
+
+  BufferPtr newBuffer = AlignedBuffer::allocate<char>(referencedBytes, pool());
+  newBuffer->setSize(referencedBytes);
+  auto* rawNewBuffer = newBuffer->asMutable<char>();
+
+  uint64_t offset = 0;
+  for (auto i = 0; i < BaseVector::length_; ++i) {
+    if (BaseVector::rawNulls_ && bits::isBitNull(BaseVector::rawNulls_, i)) {
+      continue;
+    }
+    const auto value = rawValues_[i];
+    if (value.isInline()) {
+      continue;
+    }
+    memcpy(rawNewBuffer + offset, value.data(), value.size());
+    rawValues_[i] = StringView(rawNewBuffer + offset, value.size());
+    offset += value.size();
+  }
+  VELOX_DCHECK_EQ(offset, referencedBytes);
+
+  setStringBuffers({std::move(newBuffer)});
+}
+
 template <>
 void FlatVector<StringView>::set(vector_size_t idx, StringView value) {
   VELOX_DCHECK(idx < BaseVector::length_);
@@ -485,13 +548,45 @@ void FlatVector<StringView>::copyRanges(
     }
     acquireSharedStringBuffers(source);
   } else {
+    // Reserve space for all non-inlined strings in one piece, then
+    // append them, instead of checking the buffer capacity for every
+    // string.
+    int64_t numBytes = 0;
+    for (auto& r : ranges) {
+      for (auto i = 0; i < r.count; ++i) {
+        if (!source->isNullAt(r.sourceIndex + i)) {
+          auto value = leaf->valueAt(source->wrappedIndex(r.sourceIndex + i));
+          if (!value.isInline()) {
+            numBytes += value.size();
+          }
+        }
+      }
+    }
+    char* rawBuffer = nullptr;
+    if (numBytes > 0 && numBytes < std::numeric_limits<int32_t>::max()) {
+      rawBuffer = getRawStringBufferWithSpace(numBytes);
+    }
     for (auto& r : ranges) {
       for (auto i = 0; i < r.count; ++i) {
         if (source->isNullAt(r.sourceIndex + i)) {
           setNull(r.targetIndex + i, true);
         } else {
-          set(r.targetIndex + i,
-              leaf->valueAt(source->wrappedIndex(r.sourceIndex + i)));
+          auto value = leaf->valueAt(source->wrappedIndex(r.sourceIndex + i));
+          if (BaseVector::rawNulls_) {
+            BaseVector::setNull(r.targetIndex + i, false);
+          }
+          if (value.isInline()) {
+            rawValues_[r.targetIndex + i] = value;
+          } else if (rawBuffer) {
+            memcpy(rawBuffer, value.data(), value.size());
+            rawValues_[r.targetIndex + i] =
+                StringView(rawBuffer, value.size());
+            rawBuffer += value.size();
+          } else {
+            // Total size did not fit in a single buffer; fall back to
+            // per-string buffer management.
+            set(r.targetIndex + i, value);
+          }
         }
       }
     }
@@ -51,6 +51,11 @@ class FlatVector final : public SimpleVector<T> {
   static constexpr vector_size_t kMaxStringSizeForReuse =
       (1 << 20) - sizeof(AlignedBuffer);
 
+  /// Minimum ratio of string buffer capacity to bytes actually referenced by
+  /// the StringViews at which compactStringBuffers() rewrites the strings
+  /// into a right-sized buffer.
+  static constexpr uint64_t kStringBufferCompactionFactor = 4;
+
   FlatVector(
       velox::memory::MemoryPool* pool,
       const TypePtr& type,
@@ -399,6 +404,17 @@ class FlatVector final : public SimpleVector<T> {
   // of its children recursively. The function throws if input encoding is lazy.
   void acquireSharedStringBuffersRecursive(const BaseVector* source);
 
+  /// For VARCHAR and VARBINARY vectors: rewrites the strings referenced by
+  /// the rows into a single right-sized buffer and drops references to the
+  /// old string buffers if these retain kStringBufferCompactionFactor times
+  /// more memory than the rows reference. A vector holding a small filtered
+  /// sample of a larger batch may share the original batch's string buffers
+  /// and pin them for as long as it lives; callers that buffer vectors for
+  /// a long time (e.g. the build side of a join) use this to release that
+  /// memory. No-op for other types and for vectors whose values buffer is
+  /// shared or not mutable.
+  void compactStringBuffers() {}
+
   Buffer* getBufferWithSpace(vector_size_t /* unused */) {
     return nullptr;
   }
@@ -527,6 +543,9 @@ char* FlatVector<StringView>::getRawStringBufferWithSpace(vector_size_t size);
 template <>
 void FlatVector<StringView>::prepareForReuse();
 
+template <>
+void FlatVector<StringView>::compactStringBuffers();
+
 template <typename T>
 using FlatVectorPtr = std::shared_ptr<FlatVector<T>>;
 
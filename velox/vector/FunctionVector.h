@@ -31,6 +31,14 @@ class Callable {
 
   virtual bool hasCapture() const = 0;
 
+  /// Returns true if at least one capture must be aligned with element
+  /// rows using the 'wrapCapture' indices passed to apply(). Constant
+  /// captures cover any row as is, so callers may skip building the
+  /// indices when this returns false.
+  virtual bool needsCaptureWrap() const {
+    return hasCapture();
+  }
+
   /// Applies 'this' to 'args' for 'rows' and returns the result in
   /// '*result'.
   /// @param rows The rows that this callable applies to. It is the element rows
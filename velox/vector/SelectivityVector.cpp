@@ -16,8 +16,18 @@
 #include "velox/vector/SelectivityVector.h"
 
 #include "velox/common/base/Nulls.h"
+#include "velox/common/base/SimdUtil.h"
 
 namespace facebook::velox {
+namespace {
+// A selection is considered sparse when at most one row in
+// 'kSparseSelectivityFactor' of the active range is selected. Iterating a
+// materialized list of row numbers then beats rescanning the bitmap.
+constexpr int32_t kSparseSelectivityFactor = 32;
+
+// Ranges below this size are cheap to scan, so no index list is built.
+constexpr vector_size_t kMinSparseRange = 1024;
+} // namespace
 
 // static
 const SelectivityVector& SelectivityVector::empty() {
@@ -29,6 +39,22 @@ SelectivityVector SelectivityVector::empty(vector_size_t size) {
   return SelectivityVector{size, false};
 }
 
+void SelectivityVector::rebuildSelectedIndices() const {
+  const auto range = end_ - begin_;
+  if (range < kMinSparseRange) {
+    indexCacheState_ = IndexCacheState::kDense;
+    return;
+  }
+  const auto numSelected = bits::countBits(bits_.data(), begin_, end_);
+  if (static_cast<int64_t>(numSelected) * kSparseSelectivityFactor > range) {
+    indexCacheState_ = IndexCacheState::kDense;
+    return;
+  }
+  selectedIndices_.resize(numSelected);
+  simd::indicesOfSetBits(bits_.data(), begin_, end_, selectedIndices_.data());
+  indexCacheState_ = IndexCacheState::kSparse;
+}
+
 std::string SelectivityVector::toString(
     vector_size_t maxSelectedRowsToPrint) const {
   const auto selectedCnt = countSelected();
@@ -88,6 +88,7 @@ class SelectivityVector {
     begin_ = 0;
     end_ = value ? size_ : 0;
     allSelected_ = value;
+    invalidateSelectedIndices();
   }
 
   /**
@@ -99,6 +100,7 @@ class SelectivityVector {
     VELOX_DCHECK_LT(idx, bits_.size() * sizeof(bits_[0]) * 8);
     bits::setBit(bits_.data(), idx, valid);
     allSelected_.reset();
+    invalidateSelectedIndices();
   }
 
   /**
@@ -114,6 +116,7 @@ class SelectivityVector {
     VELOX_DCHECK_LE(end, bits_.size() * sizeof(bits_[0]) * 8);
     bits::fillBits(bits_.data(), begin, end, valid);
     allSelected_.reset();
+    invalidateSelectedIndices();
   }
 
   /**
@@ -157,6 +160,7 @@ class SelectivityVector {
     begin_ = 0;
     end_ = 0;
     allSelected_ = false;
+    invalidateSelectedIndices();
   }
 
   /**
@@ -167,6 +171,7 @@ class SelectivityVector {
     begin_ = 0;
     end_ = size_;
     allSelected_ = true;
+    invalidateSelectedIndices();
   }
 
   void setFromBits(const uint64_t* bits, int32_t size) {
@@ -275,6 +280,7 @@ class SelectivityVector {
    * index (noting that the range in between may contain not selected indices).
    */
   void updateBounds() {
+    invalidateSelectedIndices();
     begin_ = bits::findFirstBit(bits_.data(), 0, size_);
     if (begin_ == -1) {
       begin_ = 0;
@@ -363,6 +369,34 @@ class SelectivityVector {
   }
 
  private:
+  // Cached representation of a sparse selection as a sorted list of
+  // selected row numbers.
+  enum class IndexCacheState {
+    // The bits have changed since the cache was last examined.
+    kInvalid,
+    // The selection is too dense for an index list to pay off.
+    kDense,
+    // 'selectedIndices_' holds the selected row numbers.
+    kSparse
+  };
+
+  // Returns the selected row numbers if the selection is sparse enough for
+  // iterating an index list to beat scanning the bitmap, nullptr otherwise.
+  // Builds and caches the list on first use; any mutation invalidates it.
+  const std::vector<vector_size_t>* sparseSelectedIndices() const {
+    if (indexCacheState_ == IndexCacheState::kInvalid) {
+      rebuildSelectedIndices();
+    }
+    return indexCacheState_ == IndexCacheState::kSparse ? &selectedIndices_
+                                                        : nullptr;
+  }
+
+  void rebuildSelectedIndices() const;
+
+  void invalidateSelectedIndices() {
+    indexCacheState_ = IndexCacheState::kInvalid;
+  }
+
   // The vector of bits for what is selected vs not (1 is selected).
   std::vector<uint64_t> bits_;
 
@@ -377,6 +411,11 @@ class SelectivityVector {
 
   mutable std::optional<bool> allSelected_;
 
+  mutable IndexCacheState indexCacheState_ = IndexCacheState::kInvalid;
+
+  // Row numbers of the selected rows, valid if 'indexCacheState_' is kSparse.
+  mutable std::vector<vector_size_t> selectedIndices_;
+
   friend class SelectivityIterator;
 };
 
@@ -428,9 +467,15 @@ inline void SelectivityVector::applyToSelected(Callable func) const {
     for (vector_size_t row = begin_; row < end_; ++row) {
       func(row);
     }
-  } else {
-    bits::forEachSetBit(bits_.data(), begin_, end_, func);
+    return;
   }
+  if (const auto* indices = sparseSelectedIndices()) {
+    for (auto row : *indices) {
+      func(row);
+    }
+    return;
+  }
+  bits::forEachSetBit(bits_.data(), begin_, end_, func);
 }
 
 template <typename Callable>
@@ -443,6 +488,14 @@ inline bool SelectivityVector::testSelected(Callable func) const {
     }
     return true;
   }
+  if (const auto* indices = sparseSelectedIndices()) {
+    for (auto row : *indices) {
+      if (!func(row)) {
+        return false;
+      }
+    }
+    return true;
+  }
   return bits::testSetBits(bits_.data(), begin_, end_, func);
 }
 
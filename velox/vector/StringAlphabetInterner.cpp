@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/vector/StringAlphabetInterner.h"
+
+#include "velox/common/base/BitUtil.h"
+
+namespace facebook::velox {
+namespace {
+
+uint64_t hashContent(const FlatVector<StringView>& alphabet) {
+  uint64_t hash = folly::hasher<int64_t>()(alphabet.size());
+  for (auto i = 0; i < alphabet.size(); ++i) {
+    hash =
+        bits::hashMix(hash, folly::hasher<StringView>()(alphabet.valueAt(i)));
+  }
+  return hash;
+}
+
+bool equalContent(
+    const FlatVector<StringView>& left,
+    const FlatVector<StringView>& right) {
+  if (left.size() != right.size()) {
+    return false;
+  }
+  for (auto i = 0; i < left.size(); ++i) {
+    if (left.valueAt(i) != right.valueAt(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+FlatVectorPtr<StringView> StringAlphabetInterner::intern(
+    const FlatVectorPtr<StringView>& alphabet) {
+  if (alphabet->mayHaveNulls()) {
+    return alphabet;
+  }
+  const auto hash = hashContent(*alphabet);
+  std::lock_guard<std::mutex> l(mutex_);
+  auto it = alphabets_.find(hash);
+  if (it != alphabets_.end()) {
+    for (const auto& candidate : it->second) {
+      if (equalContent(*candidate, *alphabet)) {
+        return candidate;
+      }
+    }
+  }
+  if (internedBytes_ + alphabet->retainedSize() > maxBytes_) {
+    return alphabet;
+  }
+  auto copy = BaseVector::create<FlatVector<StringView>>(
+      alphabet->type(), alphabet->size(), pool_.get());
+  copy->copy(alphabet.get(), 0, 0, alphabet->size());
+  internedBytes_ += copy->retainedSize();
+  alphabets_[hash].push_back(copy);
+  return copy;
+}
+
+} // namespace facebook::velox
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <folly/container/F14Map.h>
+#include "velox/vector/FlatVector.h"
+
+namespace facebook::velox {
+
+/// A query-wide pool of canonical string dictionary alphabets. Identical
+/// alphabets, e.g. country codes or event names, are otherwise
+/// materialized once per stripe or file and retained by every
+/// DictionaryVector in flight. intern() maps an alphabet to a single
+/// physical copy by content hash, so all DictionaryVectors over the same
+/// alphabet share one vector and alphabets compare equal by pointer.
+/// Canonical copies are allocated from 'pool', which must outlive the
+/// vectors returned by intern(), and stay retained until 'this' is
+/// destroyed, up to 'maxBytes' in total. Thread safe.
+class StringAlphabetInterner {
+ public:
+  StringAlphabetInterner(
+      std::shared_ptr<memory::MemoryPool> pool,
+      uint64_t maxBytes)
+      : pool_(std::move(pool)), maxBytes_(maxBytes) {}
+
+  /// Returns the canonical copy of 'alphabet', adding one if none exists.
+  /// Returns 'alphabet' itself if it has nulls or if adding a copy would
+  /// take the retained bytes over 'maxBytes'.
+  FlatVectorPtr<StringView> intern(const FlatVectorPtr<StringView>& alphabet);
+
+  /// Returns the total bytes retained by canonical copies.
+  uint64_t internedBytes() const {
+    std::lock_guard<std::mutex> l(mutex_);
+    return internedBytes_;
+  }
+
+ private:
+  const std::shared_ptr<memory::MemoryPool> pool_;
+  const uint64_t maxBytes_;
+
+  mutable std::mutex mutex_;
+
+  // Canonical alphabets keyed by content hash. Distinct alphabets with
+  // the same hash are listed in insertion order.
+  folly::F14FastMap<uint64_t, std::vector<FlatVectorPtr<StringView>>>
+      alphabets_;
+
+  uint64_t internedBytes_{0};
+};
+
+} // namespace facebook::velox
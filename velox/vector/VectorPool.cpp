@@ -50,11 +50,28 @@ FOLLY_ALWAYS_INLINE int32_t toCacheIndex(const TypePtr& type) {
 } // namespace
 
 VectorPtr VectorPool::get(const TypePtr& type, vector_size_t size) {
+  return get(type, size, *pool_);
+}
+
+VectorPtr VectorPool::get(
+    const TypePtr& type,
+    vector_size_t size,
+    memory::MemoryPool& pool) {
   auto cacheIndex = toCacheIndex(type);
   if (cacheIndex >= 0 && size <= kMaxRecycleSize) {
-    return vectors_[cacheIndex].pop(type, size, *pool_);
+    return vectors_[cacheIndex].pop(type, size, pool);
+  }
+  return BaseVector::create(type, size, &pool);
+}
+
+// static
+int32_t VectorPool::toBucketIndex(vector_size_t size) {
+  for (int32_t i = 0; i < kBucketSizes.size() - 1; ++i) {
+    if (size <= kBucketSizes[i]) {
+      return i;
+    }
   }
-  return BaseVector::create(type, size, pool_);
+  return kBucketSizes.size() - 1;
 }
 
 bool VectorPool::release(VectorPtr& vector) {
@@ -90,12 +107,17 @@ bool VectorPool::TypePool::maybePushBack(VectorPtr& vector) {
   if (!vector->isWritable() || !vector->isFlatEncoding() || !vector->values()) {
     return false;
   }
-  if (size >= kNumPerType) {
+  if (numVectors >= kNumPerType) {
+    return false;
+  }
+  auto& bucket = buckets[toBucketIndex(vector->size())];
+  if (bucket.size >= kNumPerType) {
     return false;
   }
 
   vector->prepareForReuse();
-  vectors[size++] = std::move(vector);
+  bucket.vectors[bucket.size++] = std::move(vector);
+  ++numVectors;
   return true;
 }
 
@@ -103,8 +125,28 @@ VectorPtr VectorPool::TypePool::pop(
     const TypePtr& type,
     vector_size_t vectorSize,
     memory::MemoryPool& pool) {
-  if (size) {
-    auto result = std::move(vectors[--size]);
+  // Prefer the bucket of the requested size, then the larger buckets whose
+  // vectors can be resized down without copy, then the smaller ones.
+  const auto bucketIndex = toBucketIndex(vectorSize);
+  int32_t found = -1;
+  for (auto i = bucketIndex; i < buckets.size(); ++i) {
+    if (buckets[i].size > 0) {
+      found = i;
+      break;
+    }
+  }
+  if (found < 0) {
+    for (auto i = bucketIndex - 1; i >= 0; --i) {
+      if (buckets[i].size > 0) {
+        found = i;
+        break;
+      }
+    }
+  }
+  if (found >= 0) {
+    auto& bucket = buckets[found];
+    auto result = std::move(bucket.vectors[--bucket.size]);
+    --numVectors;
     if (UNLIKELY(result->rawNulls() != nullptr)) {
       // This is a recyclable vector, no need to check uniqueness.
       simd::memset(
@@ -21,12 +21,15 @@
 namespace facebook::velox {
 
 /// A thread-level cache of pre-allocated flat vectors of different types.
-/// Keeps up to 10 recyclable vectors of each type. A vector is
-/// recyclable if it is flat and recursively singly-referenced.
-/// Only singleton built-in types are supported. Decimal types, fixed-size array
-/// type, complex and custom types are not supported. Calling 'get' for an
-/// unsupported type already returns a newly allocated vector. Calling 'release'
-/// for an unsupported type is a no-op.
+/// Keeps up to 10 recyclable vectors of each type in size-bucketed
+/// freelists so that a request for a small vector does not pin a large one
+/// and vice versa. A vector is recyclable if it is flat and recursively
+/// singly-referenced. Only singleton built-in types are supported. Decimal
+/// types, fixed-size array type, complex and custom types are not
+/// supported. Calling 'get' for an unsupported type already returns a newly
+/// allocated vector. Calling 'release' for an unsupported type is a no-op.
+/// 'this' is not thread-safe but may be shared by the operators of a driver
+/// pipeline which run serially on the driver thread.
 class VectorPool {
  public:
   explicit VectorPool(memory::MemoryPool* pool) : pool_{pool} {}
@@ -35,6 +38,12 @@ class VectorPool {
   /// 'pool_' if no pre-allocated vector or type is a complex type.
   VectorPtr get(const TypePtr& type, vector_size_t size);
 
+  /// Like the above but allocates from 'pool' if no pre-allocated vector.
+  /// Use this when 'this' is shared across the operators of a pipeline so
+  /// that new vectors are charged to the requesting operator's pool.
+  VectorPtr
+  get(const TypePtr& type, vector_size_t size, memory::MemoryPool& pool);
+
   /// Moves vector into 'this' if it is flat, recursively singly referenced and
   /// there is space. The function returns true if 'vector' is not null and has
   /// been returned back to this pool, otherwise returns false.
@@ -48,9 +57,27 @@ class VectorPool {
   static constexpr vector_size_t kMaxRecycleSize = 64 * 1024;
   static constexpr int32_t kNumPerType = 10;
 
+  /// Upper bounds on the number of elements of the per-type size buckets.
+  /// A vector is kept in the bucket of its size. 'get' prefers the bucket
+  /// of the requested size, then the larger buckets whose vectors can be
+  /// resized down without copy, then the smaller ones.
+  static constexpr std::array<vector_size_t, 4> kBucketSizes = {
+      1024,
+      4096,
+      16384,
+      kMaxRecycleSize};
+
+  static int32_t toBucketIndex(vector_size_t size);
+
   struct TypePool {
-    int32_t size{0};
-    std::array<VectorPtr, kNumPerType> vectors;
+    struct SizeBucket {
+      int32_t size{0};
+      std::array<VectorPtr, kNumPerType> vectors;
+    };
+
+    /// Total number of cached vectors across 'buckets'.
+    int32_t numVectors{0};
+    std::array<SizeBucket, kBucketSizes.size()> buckets;
 
     bool maybePushBack(VectorPtr& vector);
 
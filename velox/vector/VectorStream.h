@@ -110,6 +110,20 @@ class VectorStreamGroup : public StreamArena {
       int32_t numRows,
       const VectorSerde::Options* options = nullptr);
 
+  /// True if createStreamTree() has been called since construction or the
+  /// last clear().
+  bool hasStreamTree() const {
+    return serializer_ != nullptr;
+  }
+
+  /// Drops the stream tree and resets the arena for reuse, keeping the
+  /// arena memory in a freelist. Used to recycle a group across
+  /// serialization rounds instead of destroying and recreating it.
+  void clear() {
+    serializer_.reset();
+    StreamArena::clear();
+  }
+
   static void estimateSerializedSize(
       VectorPtr vector,
       const folly::Range<const IndexRange*>& ranges,
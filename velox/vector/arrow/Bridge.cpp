@@ -28,22 +28,42 @@ namespace facebook::velox {
 
 namespace {
 
-// The supported conversions use one buffer for nulls (0), one for values (1),
-// and one for offsets (2).
+// The common conversions use one buffer for nulls (0), one for values (1),
+// and one for offsets (2). String view conversions append the string data
+// buffers and a buffer of their sizes.
 static constexpr size_t kMaxBuffers{3};
 
+// Arrow string view (16 bytes), used by the "vu"/"vz" string view layout.
+// Strings of up to 12 characters are stored inline and are bit-compatible
+// with velox::StringView. Longer strings keep a 4 character prefix and
+// reference a range in one of the variadic data buffers of the array.
+struct ArrowStringView {
+  int32_t size;
+  char prefix[4];
+  union {
+    char inlined[8];
+    struct {
+      int32_t bufferIndex;
+      int32_t offset;
+    };
+  };
+};
+
+static_assert(sizeof(ArrowStringView) == sizeof(StringView));
+
 // Structure that will hold the buffers needed by ArrowArray. This is opaquely
 // carried by ArrowArray.private_data
 class VeloxToArrowBridgeHolder {
  public:
-  VeloxToArrowBridgeHolder() {
-    for (size_t i = 0; i < kMaxBuffers; ++i) {
-      buffers_[i] = nullptr;
-    }
-  }
+  VeloxToArrowBridgeHolder()
+      : buffers_(kMaxBuffers, nullptr), bufferPtrs_(kMaxBuffers) {}
 
-  // Acquires a buffer at index `idx`.
+  // Acquires a buffer at index `idx`, growing the buffer list if needed.
   void setBuffer(size_t idx, const BufferPtr& buffer) {
+    if (idx >= buffers_.size()) {
+      buffers_.resize(idx + 1, nullptr);
+      bufferPtrs_.resize(idx + 1);
+    }
     bufferPtrs_[idx] = buffer;
     if (buffer) {
       buffers_[idx] = buffer->as<void>();
@@ -56,7 +76,7 @@ class VeloxToArrowBridgeHolder {
   }
 
   const void** getArrowBuffers() {
-    return buffers_;
+    return buffers_.data();
   }
 
   // Allocates space for `numChildren` ArrowArray pointers.
@@ -87,11 +107,11 @@ class VeloxToArrowBridgeHolder {
 
  private:
   // Holds the pointers to the arrow buffers.
-  const void* buffers_[kMaxBuffers];
+  std::vector<const void*> buffers_;
 
   // Holds ownership over the Buffers being referenced by the buffers vector
   // above.
-  BufferPtr bufferPtrs_[kMaxBuffers];
+  std::vector<BufferPtr> bufferPtrs_;
 
   // Auxiliary buffers to hold ownership over ArrowArray children structures.
   std::vector<std::unique_ptr<ArrowArray>> childrenPtrs_;
@@ -410,12 +430,71 @@ void exportStrings(
   VELOX_DCHECK_EQ(bufSize, *rawOffsets);
 }
 
+// Exports a string vector using Arrow's string view layout: a fixed 16-byte
+// view per row plus the vector's string buffers exported as variadic data
+// buffers, so the string data itself is never copied. The last buffer holds
+// the sizes of the variadic data buffers, as required by the C data
+// interface.
+void exportStringViews(
+    const FlatVector<StringView>& vec,
+    const Selection& rows,
+    ArrowArray& out,
+    memory::MemoryPool* pool,
+    VeloxToArrowBridgeHolder& holder) {
+  const auto& stringBuffers = vec.stringBuffers();
+  const int32_t numDataBuffers = stringBuffers.size();
+
+  auto views = AlignedBuffer::allocate<StringView>(out.length, pool);
+  auto* rawViews = views->asMutable<ArrowStringView>();
+  vector_size_t j = 0;
+  rows.apply([&](vector_size_t i) {
+    auto& view = rawViews[j++];
+    if (vec.isNullAt(i)) {
+      memset(&view, 0, sizeof(view));
+      return;
+    }
+    const auto sv = vec.valueAtFast(i);
+    if (sv.isInline()) {
+      // Inline views are bit-compatible.
+      memcpy(&view, &sv, sizeof(view));
+      return;
+    }
+    view.size = sv.size();
+    memcpy(view.prefix, sv.data(), sizeof(view.prefix));
+    view.bufferIndex = -1;
+    for (int32_t k = 0; k < numDataBuffers; ++k) {
+      const auto* start = stringBuffers[k]->as<char>();
+      if (sv.data() >= start &&
+          sv.data() + sv.size() <= start + stringBuffers[k]->size()) {
+        view.bufferIndex = k;
+        view.offset = sv.data() - start;
+        break;
+      }
+    }
+    VELOX_CHECK_GE(
+        view.bufferIndex,
+        0,
+        "String is not backed by any string buffer of the vector.");
+  });
+  holder.setBuffer(1, views);
+
+  auto dataBufferSizes = AlignedBuffer::allocate<int64_t>(numDataBuffers, pool);
+  auto* rawDataBufferSizes = dataBufferSizes->asMutable<int64_t>();
+  for (int32_t k = 0; k < numDataBuffers; ++k) {
+    holder.setBuffer(2 + k, stringBuffers[k]);
+    rawDataBufferSizes[k] = stringBuffers[k]->size();
+  }
+  holder.setBuffer(2 + numDataBuffers, dataBufferSizes);
+  out.n_buffers = 3 + numDataBuffers;
+}
+
 void exportFlat(
     const BaseVector& vec,
     const Selection& rows,
     ArrowArray& out,
     memory::MemoryPool* pool,
-    VeloxToArrowBridgeHolder& holder) {
+    VeloxToArrowBridgeHolder& holder,
+    const ArrowOptions& options) {
   out.n_children = 0;
   out.children = nullptr;
   switch (vec.typeKind()) {
@@ -432,8 +511,21 @@ void exportFlat(
       break;
     case TypeKind::VARCHAR:
     case TypeKind::VARBINARY:
-      exportStrings(
-          *vec.asUnchecked<FlatVector<StringView>>(), rows, out, pool, holder);
+      if (options.exportToStringView) {
+        exportStringViews(
+            *vec.asUnchecked<FlatVector<StringView>>(),
+            rows,
+            out,
+            pool,
+            holder);
+      } else {
+        exportStrings(
+            *vec.asUnchecked<FlatVector<StringView>>(),
+            rows,
+            out,
+            pool,
+            holder);
+      }
       break;
     default:
       VELOX_NYI(
@@ -446,14 +538,16 @@ void exportBase(
     const BaseVector&,
     const Selection&,
     ArrowArray&,
-    memory::MemoryPool*);
+    memory::MemoryPool*,
+    const ArrowOptions&);
 
 void exportRows(
     const RowVector& vec,
     const Selection& rows,
     ArrowArray& out,
     memory::MemoryPool* pool,
-    VeloxToArrowBridgeHolder& holder) {
+    VeloxToArrowBridgeHolder& holder,
+    const ArrowOptions& options) {
   out.n_buffers = 1;
   holder.resizeChildren(vec.childrenSize());
   out.n_children = vec.childrenSize();
@@ -464,7 +558,8 @@ void exportRows(
           *vec.childAt(i)->loadedVector(),
           rows,
           *holder.allocateChild(i),
-          pool);
+          pool,
+          options);
     } catch (const VeloxException&) {
       for (column_index_t j = 0; j < i; ++j) {
         // When exception is thrown, i th child is guaranteed unset.
@@ -525,7 +620,8 @@ void exportArrays(
     const Selection& rows,
     ArrowArray& out,
     memory::MemoryPool* pool,
-    VeloxToArrowBridgeHolder& holder) {
+    VeloxToArrowBridgeHolder& holder,
+    const ArrowOptions& options) {
   Selection childRows(vec.elements()->size());
   exportOffsets(vec, rows, out, pool, holder, childRows);
   holder.resizeChildren(1);
@@ -533,7 +629,8 @@ void exportArrays(
       *vec.elements()->loadedVector(),
       childRows,
       *holder.allocateChild(0),
-      pool);
+      pool,
+      options);
   out.n_children = 1;
   out.children = holder.getChildrenArrays();
 }
@@ -543,7 +640,8 @@ void exportMaps(
     const Selection& rows,
     ArrowArray& out,
     memory::MemoryPool* pool,
-    VeloxToArrowBridgeHolder& holder) {
+    VeloxToArrowBridgeHolder& holder,
+    const ArrowOptions& options) {
   RowVector child(
       pool,
       ROW({"key", "value"}, {vec.mapKeys()->type(), vec.mapValues()->type()}),
@@ -553,7 +651,7 @@ void exportMaps(
   Selection childRows(child.size());
   exportOffsets(vec, rows, out, pool, holder, childRows);
   holder.resizeChildren(1);
-  exportBase(child, childRows, *holder.allocateChild(0), pool);
+  exportBase(child, childRows, *holder.allocateChild(0), pool, options);
   out.n_children = 1;
   out.children = holder.getChildrenArrays();
 }
@@ -563,7 +661,8 @@ void exportDictionary(
     const Selection& rows,
     ArrowArray& out,
     memory::MemoryPool* pool,
-    VeloxToArrowBridgeHolder& holder) {
+    VeloxToArrowBridgeHolder& holder,
+    const ArrowOptions& options) {
   out.n_buffers = 2;
   out.n_children = 0;
   if (rows.changed()) {
@@ -575,39 +674,45 @@ void exportDictionary(
   }
   auto& values = *vec.valueVector()->loadedVector();
   out.dictionary = holder.allocateDictionary();
-  exportBase(values, Selection(values.size()), *out.dictionary, pool);
+  exportBase(values, Selection(values.size()), *out.dictionary, pool, options);
 }
 
 void exportBase(
     const BaseVector& vec,
     const Selection& rows,
     ArrowArray& out,
-    memory::MemoryPool* pool) {
+    memory::MemoryPool* pool,
+    const ArrowOptions& options) {
   auto holder = std::make_unique<VeloxToArrowBridgeHolder>();
-  out.buffers = holder->getArrowBuffers();
   out.length = rows.count();
   out.offset = 0;
   out.dictionary = nullptr;
   exportNulls(vec, rows, out, pool, *holder);
   switch (vec.encoding()) {
     case VectorEncoding::Simple::FLAT:
-      exportFlat(vec, rows, out, pool, *holder);
+      exportFlat(vec, rows, out, pool, *holder, options);
       break;
     case VectorEncoding::Simple::ROW:
-      exportRows(*vec.asUnchecked<RowVector>(), rows, out, pool, *holder);
+      exportRows(
+          *vec.asUnchecked<RowVector>(), rows, out, pool, *holder, options);
       break;
     case VectorEncoding::Simple::ARRAY:
-      exportArrays(*vec.asUnchecked<ArrayVector>(), rows, out, pool, *holder);
+      exportArrays(
+          *vec.asUnchecked<ArrayVector>(), rows, out, pool, *holder, options);
       break;
     case VectorEncoding::Simple::MAP:
-      exportMaps(*vec.asUnchecked<MapVector>(), rows, out, pool, *holder);
+      exportMaps(
+          *vec.asUnchecked<MapVector>(), rows, out, pool, *holder, options);
       break;
     case VectorEncoding::Simple::DICTIONARY:
-      exportDictionary(vec, rows, out, pool, *holder);
+      exportDictionary(vec, rows, out, pool, *holder, options);
       break;
     default:
       VELOX_NYI("{} cannot be exported to Arrow yet.", vec.encoding());
   }
+  // Set the buffer pointers last: exporting may grow the holder's buffer
+  // list, which can reallocate it.
+  out.buffers = holder->getArrowBuffers();
   out.private_data = holder.release();
   out.release = releaseArrowArray;
 }
@@ -617,11 +722,15 @@ void exportBase(
 void exportToArrow(
     const VectorPtr& vector,
     ArrowArray& arrowArray,
-    memory::MemoryPool* pool) {
-  exportBase(*vector, Selection(vector->size()), arrowArray, pool);
+    memory::MemoryPool* pool,
+    const ArrowOptions& options) {
+  exportBase(*vector, Selection(vector->size()), arrowArray, pool, options);
 }
 
-void exportToArrow(const VectorPtr& vec, ArrowSchema& arrowSchema) {
+void exportToArrow(
+    const VectorPtr& vec,
+    ArrowSchema& arrowSchema,
+    const ArrowOptions& options) {
   auto& type = vec->type();
 
   arrowSchema.name = nullptr;
@@ -641,10 +750,16 @@ void exportToArrow(const VectorPtr& vec, ArrowSchema& arrowSchema) {
     arrowSchema.format = "i";
     bridgeHolder->dictionary = std::make_unique<ArrowSchema>();
     arrowSchema.dictionary = bridgeHolder->dictionary.get();
-    exportToArrow(vec->valueVector(), *arrowSchema.dictionary);
+    exportToArrow(vec->valueVector(), *arrowSchema.dictionary, options);
 
   } else {
-    arrowSchema.format = exportArrowFormatStr(type, bridgeHolder->formatBuffer);
+    if (options.exportToStringView &&
+        (type->isVarchar() || type->isVarbinary())) {
+      arrowSchema.format = type->isVarchar() ? "vu" : "vz";
+    } else {
+      arrowSchema.format =
+          exportArrowFormatStr(type, bridgeHolder->formatBuffer);
+    }
     arrowSchema.dictionary = nullptr;
 
     if (type->kind() == TypeKind::MAP) {
@@ -659,14 +774,14 @@ void exportToArrow(const VectorPtr& vec, ArrowSchema& arrowSchema) {
           0,
           std::vector<VectorPtr>{maps.mapKeys(), maps.mapValues()},
           maps.getNullCount());
-      exportToArrow(rows, *child);
+      exportToArrow(rows, *child, options);
       child->name = "entries";
       setUniqueChild(std::move(child), *bridgeHolder, arrowSchema);
 
     } else if (type->kind() == TypeKind::ARRAY) {
       auto child = std::make_unique<ArrowSchema>();
       auto& arrays = *vec->asUnchecked<ArrayVector>();
-      exportToArrow(arrays.elements(), *child);
+      exportToArrow(arrays.elements(), *child, options);
       // Name is required, and "item" is the default name used in arrow itself.
       child->name = "item";
       setUniqueChild(std::move(child), *bridgeHolder, arrowSchema);
@@ -699,7 +814,7 @@ void exportToArrow(const VectorPtr& vec, ArrowSchema& arrowSchema) {
         try {
           auto& currentSchema = bridgeHolder->childrenOwned[i];
           currentSchema = std::make_unique<ArrowSchema>();
-          exportToArrow(rows.childAt(i), *currentSchema);
+          exportToArrow(rows.childAt(i), *currentSchema, options);
           currentSchema->name = bridgeHolder->rowType->nameOf(i).data();
           arrowSchema.children[i] = currentSchema.get();
         } catch (const VeloxException& e) {
@@ -754,6 +869,15 @@ TypePtr importFromArrow(const ArrowSchema& arrowSchema) {
     case 'Z':
       return VARBINARY();
 
+    case 'v': // view types.
+      if (format[1] == 'u') {
+        return VARCHAR();
+      }
+      if (format[1] == 'z') {
+        return VARBINARY();
+      }
+      break;
+
     case 't': // temporal types.
       // Mapping it to ttn for now.
       if (format[1] == 't' && format[2] == 'n') {
@@ -945,6 +1069,68 @@ VectorPtr createStringFlatVector(
       optionalNullCount(nullCount));
 }
 
+// Creates a FlatVector<StringView> from an array in Arrow's string view
+// layout: buffers are nulls, 16-byte views, the variadic string data buffers
+// and the sizes of the data buffers. The data buffers are referenced without
+// copying; only the views are translated since Arrow addresses long strings
+// by buffer index and offset while Velox uses raw pointers.
+VectorPtr createStringViewFlatVector(
+    memory::MemoryPool* pool,
+    const TypePtr& type,
+    BufferPtr nulls,
+    const ArrowArray& arrowArray,
+    WrapInBufferViewFunc wrapInBufferView) {
+  VELOX_USER_CHECK_GE(
+      arrowArray.n_buffers,
+      3,
+      "Expecting at least three buffers as input for string view types.");
+  const int64_t numDataBuffers = arrowArray.n_buffers - 3;
+  const auto* views =
+      static_cast<const ArrowStringView*>(arrowArray.buffers[1]);
+  const auto* dataBufferSizes = static_cast<const int64_t*>(
+      arrowArray.buffers[arrowArray.n_buffers - 1]);
+
+  std::vector<BufferPtr> stringViewBuffers;
+  std::vector<const char*> rawDataBuffers;
+  stringViewBuffers.reserve(numDataBuffers);
+  rawDataBuffers.reserve(numDataBuffers);
+  for (int64_t i = 0; i < numDataBuffers; ++i) {
+    stringViewBuffers.push_back(
+        wrapInBufferView(arrowArray.buffers[2 + i], dataBufferSizes[i]));
+    rawDataBuffers.push_back(stringViewBuffers.back()->as<char>());
+  }
+
+  const auto length = arrowArray.length;
+  const auto* rawNulls = nulls != nullptr ? nulls->as<uint64_t>() : nullptr;
+  BufferPtr stringViews = AlignedBuffer::allocate<StringView>(length, pool);
+  auto* rawStringViews = stringViews->asMutable<StringView>();
+  for (int64_t i = 0; i < length; ++i) {
+    if (rawNulls != nullptr && bits::isBitNull(rawNulls, i)) {
+      rawStringViews[i] = StringView();
+      continue;
+    }
+    const auto& view = views[i];
+    if (view.size <= static_cast<int32_t>(StringView::kInlineSize)) {
+      rawStringViews[i] = StringView(view.prefix, view.size);
+    } else {
+      VELOX_USER_CHECK_LT(view.bufferIndex, numDataBuffers);
+      rawStringViews[i] =
+          StringView(rawDataBuffers[view.bufferIndex] + view.offset, view.size);
+    }
+  }
+
+  return std::make_shared<FlatVector<StringView>>(
+      pool,
+      type,
+      std::move(nulls),
+      length,
+      std::move(stringViews),
+      std::move(stringViewBuffers),
+      SimpleVectorStats<StringView>{},
+      std::nullopt,
+      optionalNullCount(arrowArray.null_count));
+}
+
 VectorPtr importFromArrowImpl(
     ArrowSchema& arrowSchema,
     ArrowArray& arrowArray,
@@ -1119,6 +1305,10 @@ VectorPtr importFromArrowImpl(
 
   // String data types (VARCHAR and VARBINARY).
   if (type->isVarchar() || type->isVarbinary()) {
+    if (arrowSchema.format[0] == 'v') {
+      return createStringViewFlatVector(
+          pool, type, nulls, arrowArray, wrapInBufferView);
+    }
     VELOX_USER_CHECK_EQ(
         arrowArray.n_buffers,
         3,
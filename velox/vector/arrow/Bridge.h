@@ -27,6 +27,16 @@ struct ArrowSchema;
 
 namespace facebook::velox {
 
+/// Options controlling the conversion between Velox vectors and Arrow arrays.
+struct ArrowOptions {
+  /// If true, exports VARCHAR and VARBINARY columns using Arrow's string view
+  /// layout ("vu"/"vz"). The vector's string buffers are exported as variadic
+  /// data buffers without copying the string data; only the fixed 16-byte
+  /// views are rebuilt. If false, strings are copied into the offset-based
+  /// "u"/"z" layout.
+  bool exportToStringView{false};
+};
+
 /// Export a generic Velox Vector to an ArrowArray, as defined by Arrow's C data
 /// interface:
 ///
@@ -57,7 +67,8 @@ namespace facebook::velox {
 void exportToArrow(
     const VectorPtr& vector,
     ArrowArray& arrowArray,
-    memory::MemoryPool* pool);
+    memory::MemoryPool* pool,
+    const ArrowOptions& options = {});
 
 /// Export the type of a Velox vector to an ArrowSchema.
 ///
@@ -78,7 +89,10 @@ void exportToArrow(
 ///
 /// NOTE: Since Arrow couples type and encoding, we need both Velox type and
 /// actual data (containing encoding) to create an ArrowSchema.
-void exportToArrow(const VectorPtr&, ArrowSchema&);
+void exportToArrow(
+    const VectorPtr&,
+    ArrowSchema&,
+    const ArrowOptions& options = {});
 
 /// Import an ArrowSchema into a Velox Type object.
 ///
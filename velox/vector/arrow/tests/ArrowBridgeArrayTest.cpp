@@ -335,6 +335,61 @@ TEST_F(ArrowBridgeArrayExportTest, flatString) {
   testFlatVector<std::string>({});
 }
 
+TEST_F(ArrowBridgeArrayExportTest, flatStringView) {
+  std::vector<std::optional<std::string>> inputData = {
+      "short",
+      "a much longer string which is for sure not stored inline",
+      std::nullopt,
+      "",
+      "another long string that needs to be referenced by buffer and offset",
+      "tiny",
+  };
+  auto flatVector = vectorMaker_.flatVectorNullable(inputData);
+
+  ArrowOptions options;
+  options.exportToStringView = true;
+
+  // The schema for a string vector exported as view uses the "vu" format.
+  ArrowSchema arrowSchema;
+  exportToArrow(flatVector, arrowSchema, options);
+  EXPECT_STREQ("vu", arrowSchema.format);
+  arrowSchema.release(&arrowSchema);
+
+  ArrowArray arrowArray;
+  exportToArrow(flatVector, arrowArray, pool_.get(), options);
+
+  EXPECT_EQ(inputData.size(), arrowArray.length);
+  EXPECT_EQ(1, arrowArray.null_count);
+
+  // Buffers are: nulls, views, variadic data buffers, and data buffer sizes.
+  const auto numDataBuffers = flatVector->stringBuffers().size();
+  ASSERT_EQ(3 + numDataBuffers, arrowArray.n_buffers);
+
+  // Data buffers must be shared with the vector (zero-copy).
+  const auto* bufferSizes = static_cast<const int64_t*>(
+      arrowArray.buffers[2 + numDataBuffers]);
+  for (size_t i = 0; i < numDataBuffers; ++i) {
+    const auto& stringBuffer = flatVector->stringBuffers()[i];
+    EXPECT_EQ(stringBuffer->as<char>(), arrowArray.buffers[2 + i]);
+    EXPECT_EQ(stringBuffer->size(), bufferSizes[i]);
+  }
+
+  // Round-trip the exported array back and compare contents.
+  auto arrowSchemaForImport = makeArrowSchema("vu");
+  auto imported =
+      importFromArrowAsViewer(arrowSchemaForImport, arrowArray, pool_.get());
+
+  EXPECT_EQ(inputData.size(), imported->size());
+  for (vector_size_t i = 0; i < imported->size(); ++i) {
+    ASSERT_TRUE(flatVector->equalValueAt(imported.get(), i, i))
+        << "at " << i << ": " << flatVector->toString(i) << " vs. "
+        << imported->toString(i);
+  }
+
+  imported.reset();
+  arrowArray.release(&arrowArray);
+}
+
 TEST_F(ArrowBridgeArrayExportTest, rowVector) {
   std::vector<std::optional<int64_t>> col1 = {1, 2, 3, 4};
   std::vector<std::optional<double>> col2 = {99.9, 88.8, 77.7, std::nullopt};
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/vector/fuzzer/FuzzerCorpus.h"
+
+#include <fstream>
+
+#include <folly/json.h>
+
+#include "velox/vector/VectorSaver.h"
+
+namespace facebook::velox {
+namespace {
+
+const char* kManifestFileName = "manifest.json";
+const char* kTypeFileName = "type";
+
+std::string batchFilePath(const std::string& directoryPath, size_t index) {
+  return fmt::format("{}/batch_{}", directoryPath, index);
+}
+
+folly::dynamic serializeOptions(const VectorFuzzer::Options& options) {
+  folly::dynamic charEncodings = folly::dynamic::array;
+  for (auto encoding : options.charEncodings) {
+    charEncodings.push_back(static_cast<int>(encoding));
+  }
+
+  folly::dynamic serialized = folly::dynamic::object;
+  serialized["vectorSize"] = options.vectorSize;
+  serialized["nullRatio"] = options.nullRatio;
+  serialized["containerHasNulls"] = options.containerHasNulls;
+  serialized["dictionaryHasNulls"] = options.dictionaryHasNulls;
+  serialized["stringLength"] = options.stringLength;
+  serialized["charEncodings"] = charEncodings;
+  serialized["stringVariableLength"] = options.stringVariableLength;
+  serialized["containerLength"] = options.containerLength;
+  serialized["containerVariableLength"] = options.containerVariableLength;
+  serialized["complexElementsMaxSize"] = options.complexElementsMaxSize;
+  serialized["normalizeMapKeys"] = options.normalizeMapKeys;
+  serialized["timestampPrecision"] =
+      static_cast<int>(options.timestampPrecision);
+  serialized["useMicrosecondPrecisionTimestamp"] =
+      options.useMicrosecondPrecisionTimestamp;
+  return serialized;
+}
+
+VectorFuzzer::Options deserializeOptions(const folly::dynamic& serialized) {
+  VectorFuzzer::Options options;
+  options.vectorSize = serialized["vectorSize"].asInt();
+  options.nullRatio = serialized["nullRatio"].asDouble();
+  options.containerHasNulls = serialized["containerHasNulls"].asBool();
+  options.dictionaryHasNulls = serialized["dictionaryHasNulls"].asBool();
+  options.stringLength = serialized["stringLength"].asInt();
+  options.charEncodings.clear();
+  for (const auto& encoding : serialized["charEncodings"]) {
+    options.charEncodings.push_back(
+        static_cast<UTF8CharList>(encoding.asInt()));
+  }
+  options.stringVariableLength = serialized["stringVariableLength"].asBool();
+  options.containerLength = serialized["containerLength"].asInt();
+  options.containerVariableLength =
+      serialized["containerVariableLength"].asBool();
+  options.complexElementsMaxSize =
+      serialized["complexElementsMaxSize"].asInt();
+  options.normalizeMapKeys = serialized["normalizeMapKeys"].asBool();
+  options.timestampPrecision =
+      static_cast<VectorFuzzer::Options::TimestampPrecision>(
+          serialized["timestampPrecision"].asInt());
+  options.useMicrosecondPrecisionTimestamp =
+      serialized["useMicrosecondPrecisionTimestamp"].asBool();
+  return options;
+}
+} // namespace
+
+void saveFuzzerCorpus(
+    const std::string& directoryPath,
+    const VectorFuzzer::Options& options,
+    size_t seed,
+    const RowTypePtr& rowType,
+    size_t numBatches,
+    memory::MemoryPool* pool) {
+  VELOX_CHECK(
+      !options.allowLazyVector, "Lazy vectors cannot be persisted.");
+
+  VectorFuzzer fuzzer(options, pool, seed);
+  for (size_t i = 0; i < numBatches; ++i) {
+    auto batch = fuzzer.fuzzInputRow(rowType);
+    saveVectorToFile(batch.get(), batchFilePath(directoryPath, i).c_str());
+  }
+
+  std::ofstream typeFile(
+      fmt::format("{}/{}", directoryPath, kTypeFileName),
+      std::ofstream::binary);
+  saveType(rowType, typeFile);
+  typeFile.close();
+
+  folly::dynamic manifest = folly::dynamic::object;
+  manifest["seed"] = seed;
+  manifest["numBatches"] = numBatches;
+  manifest["options"] = serializeOptions(options);
+  saveStringToFile(
+      folly::toJson(manifest),
+      fmt::format("{}/{}", directoryPath, kManifestFileName).c_str());
+}
+
+FuzzerCorpusManifest restoreFuzzerCorpusManifest(
+    const std::string& directoryPath) {
+  auto manifest = folly::parseJson(restoreStringFromFile(
+      fmt::format("{}/{}", directoryPath, kManifestFileName).c_str()));
+
+  std::ifstream typeFile(
+      fmt::format("{}/{}", directoryPath, kTypeFileName),
+      std::ifstream::binary);
+  auto rowType =
+      std::dynamic_pointer_cast<const RowType>(restoreType(typeFile));
+  VELOX_CHECK_NOT_NULL(rowType, "Corpus type must be a row type.");
+
+  return {
+      std::move(rowType),
+      deserializeOptions(manifest["options"]),
+      static_cast<size_t>(manifest["seed"].asInt()),
+      static_cast<size_t>(manifest["numBatches"].asInt())};
+}
+
+std::vector<RowVectorPtr> restoreFuzzerCorpus(
+    const std::string& directoryPath,
+    memory::MemoryPool* pool) {
+  auto manifest = restoreFuzzerCorpusManifest(directoryPath);
+
+  std::vector<RowVectorPtr> batches;
+  batches.reserve(manifest.numBatches);
+  for (size_t i = 0; i < manifest.numBatches; ++i) {
+    auto vector = restoreVectorFromFile(
+        batchFilePath(directoryPath, i).c_str(), pool);
+    auto rowVector = std::dynamic_pointer_cast<RowVector>(vector);
+    VELOX_CHECK_NOT_NULL(
+        rowVector, "Corpus batch {} is not a row vector.", i);
+    batches.push_back(std::move(rowVector));
+  }
+  return batches;
+}
+
+} // namespace facebook::velox
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "velox/vector/ComplexVector.h"
+#include "velox/vector/fuzzer/VectorFuzzer.h"
+
+namespace facebook::velox {
+
+/// Describes how a persisted fuzzer corpus was generated. A corpus is fully
+/// determined by the row type, fuzzer options and seed, so the manifest
+/// alone is enough to regenerate byte-identical batches with VectorFuzzer.
+struct FuzzerCorpusManifest {
+  RowTypePtr rowType;
+  VectorFuzzer::Options options;
+  size_t seed;
+  size_t numBatches;
+};
+
+/// Generates 'numBatches' input batches of 'rowType' using VectorFuzzer with
+/// the given options and seed and persists them to 'directoryPath' along
+/// with a manifest recording the generation parameters. 'directoryPath' must
+/// be an existing directory. Batches are written using VectorSaver, so
+/// encodings are preserved. Lazy vectors cannot be persisted;
+/// options.allowLazyVector must be false.
+///
+/// Used to pin down benchmark inputs: benchmarks run across releases can
+/// load the same corpus and process byte-identical data.
+void saveFuzzerCorpus(
+    const std::string& directoryPath,
+    const VectorFuzzer::Options& options,
+    size_t seed,
+    const RowTypePtr& rowType,
+    size_t numBatches,
+    memory::MemoryPool* pool);
+
+/// Reads the generation manifest of a corpus persisted by saveFuzzerCorpus().
+FuzzerCorpusManifest restoreFuzzerCorpusManifest(
+    const std::string& directoryPath);
+
+/// Loads all batches of a corpus persisted by saveFuzzerCorpus(), in
+/// generation order.
+std::vector<RowVectorPtr> restoreFuzzerCorpus(
+    const std::string& directoryPath,
+    memory::MemoryPool* pool);
+
+} // namespace facebook::velox
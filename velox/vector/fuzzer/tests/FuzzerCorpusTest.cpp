@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "velox/common/memory/Memory.h"
+#include "velox/exec/tests/utils/TempDirectoryPath.h"
+#include "velox/vector/fuzzer/FuzzerCorpus.h"
+
+using namespace facebook::velox;
+
+namespace {
+
+class FuzzerCorpusTest : public testing::Test {
+ public:
+  memory::MemoryPool* pool() const {
+    return pool_.get();
+  }
+
+  // Asserts that 'actual' and 'expected' contain exactly the same values.
+  void assertEqualVectors(
+      const VectorPtr& expected,
+      const VectorPtr& actual) {
+    ASSERT_EQ(expected->size(), actual->size());
+    for (vector_size_t i = 0; i < expected->size(); ++i) {
+      ASSERT_TRUE(expected->equalValueAt(actual.get(), i, i))
+          << "at " << i << ": expected " << expected->toString(i)
+          << ", got " << actual->toString(i);
+    }
+  }
+
+ private:
+  std::shared_ptr<memory::MemoryPool> pool_{
+      memory::addDefaultLeafMemoryPool()};
+};
+
+TEST_F(FuzzerCorpusTest, roundTrip) {
+  VectorFuzzer::Options opts;
+  opts.vectorSize = 64;
+  opts.nullRatio = 0.1;
+  opts.stringVariableLength = true;
+  opts.timestampPrecision =
+      VectorFuzzer::Options::TimestampPrecision::kMicroSeconds;
+
+  const size_t seed = 42;
+  const size_t numBatches = 3;
+  auto rowType =
+      ROW({"a", "b", "c"}, {BIGINT(), VARCHAR(), ARRAY(INTEGER())});
+
+  auto directory = exec::test::TempDirectoryPath::create();
+  saveFuzzerCorpus(
+      directory->path, opts, seed, rowType, numBatches, pool());
+
+  // The manifest records the generation parameters.
+  auto manifest = restoreFuzzerCorpusManifest(directory->path);
+  EXPECT_EQ(*rowType, *manifest.rowType);
+  EXPECT_EQ(seed, manifest.seed);
+  EXPECT_EQ(numBatches, manifest.numBatches);
+  EXPECT_EQ(opts.vectorSize, manifest.options.vectorSize);
+  EXPECT_EQ(opts.nullRatio, manifest.options.nullRatio);
+  EXPECT_EQ(
+      opts.stringVariableLength, manifest.options.stringVariableLength);
+  EXPECT_EQ(opts.timestampPrecision, manifest.options.timestampPrecision);
+  EXPECT_EQ(opts.charEncodings, manifest.options.charEncodings);
+
+  // Restored batches match a fresh generation with the same options and
+  // seed: the corpus is deterministic.
+  auto batches = restoreFuzzerCorpus(directory->path, pool());
+  ASSERT_EQ(numBatches, batches.size());
+
+  VectorFuzzer fuzzer(manifest.options, pool(), manifest.seed);
+  for (const auto& batch : batches) {
+    assertEqualVectors(fuzzer.fuzzInputRow(manifest.rowType), batch);
+  }
+}
+
+TEST_F(FuzzerCorpusTest, lazyNotSupported) {
+  VectorFuzzer::Options opts;
+  opts.allowLazyVector = true;
+
+  auto directory = exec::test::TempDirectoryPath::create();
+  EXPECT_THROW(
+      saveFuzzerCorpus(
+          directory->path, opts, 123, ROW({BIGINT()}), 1, pool()),
+      VeloxRuntimeError);
+}
+
+} // namespace
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include "velox/vector/tests/utils/VectorTestBase.h"
+
+using namespace facebook::velox;
+
+class CompactStringBuffersTest : public testing::Test,
+                                 public test::VectorTestBase {
+ protected:
+  FlatVectorPtr<StringView> makeLargeStringVector(vector_size_t size) {
+    std::string largeString(100, 'x');
+    return makeFlatVector<StringView>(size, [&](auto row) {
+      largeString[0] = 'a' + row % 26;
+      return StringView(largeString);
+    });
+  }
+};
+
+TEST_F(CompactStringBuffersTest, compactAfterShrink) {
+  auto vector = makeLargeStringVector(1'000);
+  auto originalBytes = vector->retainedSize();
+
+  // All bytes are referenced; compaction would gain nothing.
+  vector->compactStringBuffers();
+  ASSERT_EQ(originalBytes, vector->retainedSize());
+
+  // Keep only a handful of rows. The string buffers still retain the bytes
+  // of all 1'000 original strings until compacted.
+  std::vector<std::string> expected;
+  for (auto i = 0; i < 5; ++i) {
+    expected.push_back(vector->valueAt(i).str());
+  }
+  vector->resize(5);
+  ASSERT_EQ(originalBytes, vector->retainedSize());
+
+  vector->compactStringBuffers();
+  ASSERT_GT(originalBytes, vector->retainedSize());
+  ASSERT_EQ(1, vector->stringBuffers().size());
+  ASSERT_EQ(5 * 100, vector->stringBuffers().front()->size());
+
+  // The values survive compaction.
+  for (auto i = 0; i < 5; ++i) {
+    ASSERT_EQ(expected[i], vector->valueAt(i).str());
+  }
+}
+
+TEST_F(CompactStringBuffersTest, noopWhenValuesShared) {
+  auto vector = makeLargeStringVector(1'000);
+  vector->resize(5);
+
+  // A second reference to the values buffer prevents rewriting the
+  // StringViews in place.
+  auto values = vector->values();
+  auto buffersBefore = vector->stringBuffers();
+
+  vector->compactStringBuffers();
+  ASSERT_EQ(buffersBefore, vector->stringBuffers());
+}
+
+TEST_F(CompactStringBuffersTest, allRowsNull) {
+  auto vector = makeLargeStringVector(100);
+  for (auto i = 0; i < vector->size(); ++i) {
+    vector->setNull(i, true);
+  }
+  ASSERT_FALSE(vector->stringBuffers().empty());
+
+  // No row references the string buffers anymore; they get dropped.
+  vector->compactStringBuffers();
+  ASSERT_TRUE(vector->stringBuffers().empty());
+}
+
+TEST_F(CompactStringBuffersTest, inlineStrings) {
+  // Inline strings do not reference the string buffers.
+  auto vector = makeLargeStringVector(1'000);
+  for (auto i = 0; i < vector->size(); ++i) {
+    vector->set(i, "short");
+  }
+
+  vector->compactStringBuffers();
+  ASSERT_TRUE(vector->stringBuffers().empty());
+  for (auto i = 0; i < vector->size(); ++i) {
+    ASSERT_EQ("short", vector->valueAt(i).str());
+  }
+}
@@ -565,6 +565,49 @@ TEST_F(DecodedVectorTest, dictionary) {
       1000, [](vector_size_t i) { return std::make_shared<int>(i % 5); });
 }
 
+TEST_F(DecodedVectorTest, reuseCachedDecode) {
+  constexpr vector_size_t size = 1'000;
+  auto base = makeFlatVector<int64_t>(size, [](auto row) { return row * 3; });
+  auto indices =
+      makeIndices(size, [](auto row) { return (row * 7) % size; });
+  auto dictionary = BaseVector::wrapInDictionary(nullptr, indices, size, base);
+
+  auto verify = [&](DecodedVector& decoded, vector_size_t numRows) {
+    for (auto i = 0; i < numRows; ++i) {
+      ASSERT_EQ(decoded.valueAt<int64_t>(i), ((i * 7) % size) * 3);
+    }
+  };
+
+  DecodedVector decoded(*dictionary);
+  verify(decoded, size);
+
+  // Decoding the same dictionary layering again reuses the decoded state.
+  decoded.decode(*dictionary);
+  verify(decoded, size);
+
+  // A subset of the previously decoded rows also reuses the decoded state.
+  SelectivityVector rows(size / 2);
+  decoded.decode(*dictionary, rows);
+  verify(decoded, size / 2);
+
+  // A dictionary with different indices over the same base is re-decoded.
+  auto otherIndices = makeIndices(size, [](auto row) { return row % 5; });
+  auto otherDictionary =
+      BaseVector::wrapInDictionary(nullptr, otherIndices, size, base);
+  decoded.decode(*otherDictionary);
+  for (auto i = 0; i < size; ++i) {
+    ASSERT_EQ(decoded.valueAt<int64_t>(i), (i % 5) * 3);
+  }
+
+  // A flat decode in between drops the cached state.
+  decoded.decode(*base);
+  for (auto i = 0; i < size; ++i) {
+    ASSERT_EQ(decoded.valueAt<int64_t>(i), i * 3);
+  }
+  decoded.decode(*dictionary);
+  verify(decoded, size);
+}
+
 TEST_F(DecodedVectorTest, dictionaryOverLazy) {
   constexpr vector_size_t size = 1000;
   auto lazyVector = vectorMaker_.lazyFlatVector<int32_t>(
@@ -360,6 +360,52 @@ TEST(SelectivityVectorTest, iterator) {
   EXPECT_EQ(count, bits::countBits(&contiguous[0], 0, 240));
 }
 
+TEST(SelectivityVectorTest, sparseIteration) {
+  // Select a handful of rows out of 100K to exercise the cached index list
+  // used by applyToSelected for sparse selections.
+  SelectivityVector vector(100'000);
+  vector.clearAll();
+  std::vector<vector_size_t> selected;
+  for (vector_size_t row = 17; row < vector.size(); row += 3'000) {
+    selected.push_back(row);
+    vector.setValid(row, true);
+  }
+  vector.updateBounds();
+
+  auto assertSelected = [&]() {
+    std::vector<vector_size_t> rows;
+    vector.applyToSelected([&](auto row) { rows.push_back(row); });
+    ASSERT_EQ(selected, rows);
+  };
+
+  // Iterate twice: the first call builds the index list, the second uses it.
+  assertSelected();
+  assertSelected();
+
+  // testSelected visits rows in order and stops on false.
+  int32_t count = 0;
+  vector.testSelected([&](auto row) {
+    EXPECT_EQ(row, selected[count]);
+    return ++count < 10;
+  });
+  ASSERT_EQ(count, 10);
+
+  // Mutations invalidate the cached list.
+  vector.setValid(40'000, true);
+  vector.updateBounds();
+  selected.insert(
+      std::lower_bound(selected.begin(), selected.end(), 40'000), 40'000);
+  assertSelected();
+
+  SelectivityVector deselected(vector.size());
+  deselected.clearAll();
+  deselected.setValid(selected.front(), true);
+  deselected.updateBounds();
+  vector.deselect(deselected);
+  selected.erase(selected.begin());
+  assertSelected();
+}
+
 TEST(SelectivityVectorTest, resize) {
   SelectivityVector vector(64, false);
   vector.resize(128, /* value */ true);
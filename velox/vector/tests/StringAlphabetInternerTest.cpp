@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) Facebook, Inc. and its affiliates.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "velox/vector/StringAlphabetInterner.h"
+#include <gtest/gtest.h>
+#include "velox/vector/tests/utils/VectorTestBase.h"
+
+namespace facebook::velox::test {
+
+class StringAlphabetInternerTest : public testing::Test,
+                                   public test::VectorTestBase {
+ protected:
+  FlatVectorPtr<StringView> makeAlphabet(const std::vector<std::string>& data) {
+    return makeFlatVector<std::string>(data);
+  }
+};
+
+TEST_F(StringAlphabetInternerTest, basic) {
+  StringAlphabetInterner interner(pool_, 1 << 20);
+
+  auto alphabet = makeAlphabet({"DE", "FI", "FR", "US"});
+  auto canonical = interner.intern(alphabet);
+
+  // The first occurrence is copied into the interner's pool.
+  ASSERT_NE(canonical.get(), alphabet.get());
+  ASSERT_GT(interner.internedBytes(), 0);
+
+  // An identical alphabet in a different vector maps to the same copy.
+  auto duplicate = makeAlphabet({"DE", "FI", "FR", "US"});
+  ASSERT_EQ(interner.intern(duplicate).get(), canonical.get());
+  // Interning the canonical copy returns itself.
+  ASSERT_EQ(interner.intern(canonical).get(), canonical.get());
+
+  // Different contents get distinct canonical copies.
+  auto other = makeAlphabet({"DE", "FI", "FR", "UY"});
+  auto otherCanonical = interner.intern(other);
+  ASSERT_NE(otherCanonical.get(), canonical.get());
+  ASSERT_NE(otherCanonical.get(), other.get());
+
+  // A prefix of an alphabet is not the same alphabet.
+  auto prefix = makeAlphabet({"DE", "FI", "FR"});
+  ASSERT_NE(interner.intern(prefix).get(), canonical.get());
+}
+
+TEST_F(StringAlphabetInternerTest, maxBytes) {
+  StringAlphabetInterner interner(pool_, 1 << 20);
+
+  auto small = makeAlphabet({"aa", "bb"});
+  ASSERT_NE(interner.intern(small).get(), small.get());
+
+  // An alphabet that would take the pool over its cap is passed through.
+  std::vector<std::string> data;
+  for (auto i = 0; i < 100'000; ++i) {
+    data.push_back(fmt::format("long-alphabet-entry-number-{}", i));
+  }
+  auto large = makeAlphabet(data);
+  const auto bytesBefore = interner.internedBytes();
+  ASSERT_EQ(interner.intern(large).get(), large.get());
+  ASSERT_EQ(interner.internedBytes(), bytesBefore);
+}
+
+TEST_F(StringAlphabetInternerTest, nulls) {
+  StringAlphabetInterner interner(pool_, 1 << 20);
+
+  // Alphabets with nulls are passed through unchanged.
+  auto withNulls = makeNullableFlatVector<std::string>({"aa", std::nullopt});
+  ASSERT_EQ(interner.intern(withNulls).get(), withNulls.get());
+  ASSERT_EQ(interner.internedBytes(), 0);
+}
+
+} // namespace facebook::velox::test
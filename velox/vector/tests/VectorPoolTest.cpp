@@ -99,6 +99,39 @@ TEST_F(VectorPoolTest, limit) {
   ASSERT_EQ(vectorPool.release(vectors), 10);
 }
 
+TEST_F(VectorPoolTest, sizeBuckets) {
+  VectorPool vectorPool(pool());
+
+  // Cache a small and a large vector of the same type.
+  auto smallVector = vectorPool.get(BIGINT(), 100);
+  auto largeVector = vectorPool.get(BIGINT(), 50'000);
+  auto* smallVectorPtr = smallVector.get();
+  auto* largeVectorPtr = largeVector.get();
+  ASSERT_TRUE(vectorPool.release(smallVector));
+  ASSERT_TRUE(vectorPool.release(largeVector));
+
+  // A large request is served from the large vector's bucket and a small
+  // request from the small vector's bucket, regardless of release order.
+  auto recycledLarge = vectorPool.get(BIGINT(), 40'000);
+  ASSERT_EQ(largeVectorPtr, recycledLarge.get());
+  ASSERT_EQ(40'000, recycledLarge->size());
+
+  auto recycledSmall = vectorPool.get(BIGINT(), 100);
+  ASSERT_EQ(smallVectorPtr, recycledSmall.get());
+  ASSERT_EQ(100, recycledSmall->size());
+}
+
+TEST_F(VectorPoolTest, perCallMemoryPool) {
+  VectorPool vectorPool(pool());
+
+  // On a miss, the vector is allocated from the pool passed to 'get', not
+  // the pool the VectorPool was constructed with.
+  auto otherPool = memory::addDefaultLeafMemoryPool();
+  auto vector = vectorPool.get(BIGINT(), 1'000, *otherPool);
+  ASSERT_NE(vector, nullptr);
+  ASSERT_EQ(otherPool.get(), vector->pool());
+}
+
 TEST_F(VectorPoolTest, vectorRecycler) {
   VectorPool vectorPool(pool());
 